@@ -1,6 +1,7 @@
 #include <NazaraUtils/Bitset.hpp>
 #include <random>
 #include <string>
+#include <vector>
 #include <nanobench.h>
 
 template<typename T>
@@ -32,9 +33,81 @@ void TestBitOp()
 	});
 }
 
+template<typename T>
+void TestArrayBitOp(std::size_t count)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(count * sizeof(T));
+	bench.unit("byte");
+	bench.title("Arrays of " + std::to_string(count) + " Nz::UInt" + std::to_string(sizeof(T) * CHAR_BIT));
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<Nz::UInt64> dis(0, std::numeric_limits<T>::max());
+
+	std::vector<T> values(count);
+	for (T& value : values)
+		value = static_cast<T>(dis(gen));
+
+	bench.run("counting bits (scalar)", [&] {
+		std::size_t bitCount = 0;
+		for (T value : values)
+			bitCount += Nz::CountBits(value);
+
+		ankerl::nanobench::doNotOptimizeAway(bitCount);
+	});
+
+	bench.run("counting bits (array)", [&] {
+		std::size_t bitCount = Nz::CountBits(values.data(), values.size());
+		ankerl::nanobench::doNotOptimizeAway(bitCount);
+	});
+
+	bench.run("reversing bits (scalar)", [&] {
+		for (T& value : values)
+			value = Nz::ReverseBits(value);
+
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+
+	bench.run("reversing bits (array)", [&] {
+		Nz::ReverseBits(values.data(), values.size());
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+
+	std::vector<T> sparse(count, T(0));
+	if (!sparse.empty())
+		sparse.back() = T(1);
+
+	bench.run("finding the first active bit (scalar)", [&] {
+		std::size_t fsb = 0;
+		for (std::size_t i = 0; i < sparse.size(); ++i)
+		{
+			if (sparse[i] != 0)
+			{
+				fsb = i * Nz::BitCount<T>() + Nz::FindFirstBit(sparse[i]);
+				break;
+			}
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(fsb);
+	});
+
+	bench.run("finding the first active bit (array)", [&] {
+		std::size_t fsb = Nz::FindFirstBit(sparse.data(), sparse.size());
+		ankerl::nanobench::doNotOptimizeAway(fsb);
+	});
+}
+
 int main()
 {
 	TestBitOp<Nz::UInt16>();
 	TestBitOp<Nz::UInt32>();
 	TestBitOp<Nz::UInt64>();
+
+	for (std::size_t count : { 64, 4096, 1024 * 1024 })
+	{
+		TestArrayBitOp<Nz::UInt8>(count);
+		TestArrayBitOp<Nz::UInt32>(count);
+		TestArrayBitOp<Nz::UInt64>(count);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <NazaraUtils/BitPacking.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+int main()
+{
+	// Fits in L2 cache, like a network snapshot or a table page being decoded
+	constexpr std::size_t ValueCount = 64 * 1024;
+
+	std::mt19937 gen(std::random_device{}());
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(ValueCount);
+	bench.unit("integer");
+	bench.title("Bit packing of " + std::to_string(ValueCount) + " 32-bit integers");
+
+	std::vector<Nz::UInt32> output(ValueCount);
+	for (Nz::UInt32 bitWidth : { 4, 12, 24 })
+	{
+		std::uniform_int_distribution<Nz::UInt32> dis(0, (Nz::UInt32(1) << bitWidth) - 1);
+
+		std::vector<Nz::UInt32> values(ValueCount);
+		for (Nz::UInt32& value : values)
+			value = dis(gen);
+
+		std::vector<Nz::UInt8> packed(Nz::GetBitPackedSize(ValueCount, bitWidth));
+
+		bench.run("BitPack " + std::to_string(bitWidth) + " bits", [&] {
+			Nz::BitPack(values.data(), values.size(), bitWidth, packed.data());
+			ankerl::nanobench::doNotOptimizeAway(packed.data());
+		});
+
+		bench.run("BitUnpack " + std::to_string(bitWidth) + " bits", [&] {
+			Nz::BitUnpack(packed.data(), output.size(), bitWidth, output.data());
+			ankerl::nanobench::doNotOptimizeAway(output.data());
+		});
+	}
+
+	// Sorted IDs, with gaps of 0 to 15
+	std::vector<Nz::UInt32> ids(ValueCount);
+	std::uniform_int_distribution<Nz::UInt32> gapDis(0, 15);
+
+	Nz::UInt32 id = 0;
+	for (Nz::UInt32& value : ids)
+	{
+		id += gapDis(gen);
+		value = id;
+	}
+
+	std::vector<Nz::UInt8> buffer(Nz::GetMaxEncodedBitPackedSize(ValueCount));
+	for (Nz::BitPackTransform transform : { Nz::BitPackTransform::None, Nz::BitPackTransform::Delta })
+	{
+		std::string transformName = (transform == Nz::BitPackTransform::Delta) ? "delta" : "no transform";
+
+		std::size_t encodedSize = 0;
+		bench.run("EncodeBitPacked sorted IDs (" + transformName + ")", [&] {
+			Nz::ByteWriter writer(buffer.data(), buffer.size());
+			Nz::EncodeBitPacked(writer, ids.data(), ids.size(), transform);
+			encodedSize = writer.GetCursor();
+		});
+
+		bench.run("DecodeBitPacked sorted IDs (" + transformName + ", " + std::to_string(encodedSize) + " bytes)", [&] {
+			Nz::ByteReader reader(buffer.data(), encodedSize);
+			Nz::DecodeBitPacked(reader, output.data(), output.size(), transform);
+			ankerl::nanobench::doNotOptimizeAway(output.data());
+		});
+	}
+}
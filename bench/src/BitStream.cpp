@@ -0,0 +1,59 @@
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/BitStream.hpp>
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+int main()
+{
+	// Packet-like fields of 3, 7 and 11 bits
+	constexpr std::size_t FieldCount = 30'000;
+	constexpr std::array<unsigned int, 3> FieldBitCounts = { 3, 7, 11 };
+
+	std::mt19937 gen(std::random_device{}());
+
+	std::vector<Nz::UInt16> values(FieldCount);
+	std::size_t bitCount = 0;
+	for (std::size_t i = 0; i < FieldCount; ++i)
+	{
+		unsigned int fieldBitCount = FieldBitCounts[i % FieldBitCounts.size()];
+		values[i] = static_cast<Nz::UInt16>(gen() & ((1u << fieldBitCount) - 1));
+		bitCount += fieldBitCount;
+	}
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(FieldCount);
+	bench.unit("field");
+	bench.title("Bit fields (" + std::to_string(FieldCount) + " fields of 3, 7 and 11 bits)");
+
+	bench.run("Nz::Bitset::AppendBits", [&] {
+		Nz::Bitset<Nz::UInt64> bitset;
+		for (std::size_t i = 0; i < FieldCount; ++i)
+			bitset.AppendBits(values[i], FieldBitCounts[i % FieldBitCounts.size()]);
+
+		ankerl::nanobench::doNotOptimizeAway(bitset);
+	});
+
+	std::vector<Nz::UInt8> buffer((bitCount + 7) / 8);
+	bench.run("Nz::BitWriter::Write", [&] {
+		Nz::BitWriter writer(buffer.data(), buffer.size());
+		for (std::size_t i = 0; i < FieldCount; ++i)
+			writer.Write(values[i], FieldBitCounts[i % FieldBitCounts.size()]);
+
+		writer.Flush();
+		ankerl::nanobench::doNotOptimizeAway(buffer.data());
+	});
+
+	bench.run("Nz::BitReader::Read", [&] {
+		Nz::BitReader reader(buffer.data(), buffer.size());
+
+		Nz::UInt32 sum = 0;
+		for (std::size_t i = 0; i < FieldCount; ++i)
+			sum += reader.Read<Nz::UInt16>(FieldBitCounts[i % FieldBitCounts.size()]).GetValue();
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
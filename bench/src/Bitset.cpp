@@ -1,8 +1,28 @@
 #include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/BitsetView.hpp>
+#include <NazaraUtils/HierarchicalBitset.hpp>
+#include <NazaraUtils/ParallelAlgorithm.hpp>
+#include <NazaraUtils/RoaringBitset.hpp>
+#include <algorithm>
+#include <iterator>
 #include <random>
 #include <string>
+#include <vector>
 #include <nanobench.h>
 
+const char* BackendName(Nz::BitKernelBackend backend)
+{
+	switch (backend)
+	{
+		case Nz::BitKernelBackend::AVX2:   return "AVX2";
+		case Nz::BitKernelBackend::AVX512: return "AVX-512";
+		case Nz::BitKernelBackend::NEON:   return "NEON";
+		case Nz::BitKernelBackend::Scalar: return "scalar";
+	}
+
+	return "unknown";
+}
+
 template<typename T>
 void TestBitset()
 {
@@ -65,6 +85,37 @@ void TestBitset()
 		ankerl::nanobench::doNotOptimizeAway(bitset);
 	});
 
+	// Small bitsets, heap-allocated vs inline storage
+	{
+		Nz::Bitset<T> bitset(200, false);
+		Nz::SmallBitset<256, T> smallBitset(200, false);
+		for (std::size_t i = 0; i < 200; i += 7)
+		{
+			bitset.Set(i);
+			smallBitset.Set(i);
+		}
+
+		bench.run("copying a 200 bits bitset", [&] {
+			Nz::Bitset<T> copy(bitset);
+			ankerl::nanobench::doNotOptimizeAway(copy);
+		});
+
+		bench.run("copying a 200 bits bitset (inline storage)", [&] {
+			Nz::SmallBitset<256, T> copy(smallBitset);
+			ankerl::nanobench::doNotOptimizeAway(copy);
+		});
+
+		bench.run("AND of two 200 bits bitsets", [&] {
+			Nz::Bitset<T> result = bitset & bitset;
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("AND of two 200 bits bitsets (inline storage)", [&] {
+			Nz::SmallBitset<256, T> result = smallBitset & smallBitset;
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+	}
+
 	// Find first enabled bit
 	{
 		Nz::Bitset<T> bitset(sizeof(T) * CHAR_BIT, false);
@@ -111,6 +162,419 @@ void TestBitset()
 			ankerl::nanobench::doNotOptimizeAway(count);
 		});
 	}
+
+	// Converting to an index list
+	{
+		std::bernoulli_distribution setDis(0.25);
+
+		Nz::Bitset<T> bitset(BitsetSize / 8, false);
+		for (std::size_t i = 0; i < bitset.GetSize(); ++i)
+			bitset.Set(i, setDis(gen));
+
+		std::vector<std::size_t> indices;
+		indices.reserve(bitset.GetSize());
+
+		bench.run("extracting set bits using IterBits", [&] {
+			indices.clear();
+			for (std::size_t bit : bitset.IterBits())
+				indices.push_back(bit);
+
+			ankerl::nanobench::doNotOptimizeAway(indices);
+		});
+
+		bench.run("extracting set bits using ExtractSetBits", [&] {
+			indices.clear();
+			bitset.ExtractSetBits(std::back_inserter(indices));
+			ankerl::nanobench::doNotOptimizeAway(indices);
+		});
+
+		bench.run("extracting set bits using ForEachSetBit", [&] {
+			indices.clear();
+			bitset.ForEachSetBit([&](std::size_t bit) { indices.push_back(bit); });
+			ankerl::nanobench::doNotOptimizeAway(indices);
+		});
+	}
+
+	// Bulk operations
+	{
+		Nz::Bitset<T> first(BitsetSize, false);
+		Nz::Bitset<T> second(BitsetSize, false);
+		for (std::size_t i = 0; i < 100000; ++i)
+		{
+			first.Set(dis(gen), true);
+			second.Set(dis(gen), true);
+		}
+
+		Nz::Bitset<T> result;
+		bench.run("AND of two big bitsets", [&] {
+			result.PerformsAND(first, second);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("OR of two big bitsets", [&] {
+			result.PerformsOR(first, second);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("XOR of two big bitsets", [&] {
+			result.PerformsXOR(first, second);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("NOT of a big bitset", [&] {
+			result.PerformsNOT(first);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("testing intersection of two big disjoint bitsets", [&] {
+			bool r = first.Intersects(~first);
+			ankerl::nanobench::doNotOptimizeAway(r);
+		});
+
+		bench.run("counting bits of the AND of two big bitsets (temporary)", [&] {
+			std::size_t count = (first & second).Count();
+			ankerl::nanobench::doNotOptimizeAway(count);
+		});
+
+		bench.run("counting bits of the AND of two big bitsets (fused)", [&] {
+			std::size_t count = first.CountAnd(second);
+			ankerl::nanobench::doNotOptimizeAway(count);
+		});
+
+		bench.run("AND NOT of two big bitsets (temporary)", [&] {
+			result = first & ~second;
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("AND NOT of two big bitsets (fused)", [&] {
+			result.PerformsANDNOT(first, second);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+	}
+
+	// Same operations on raw blocks, comparing the dispatched kernels against the scalar ones
+	{
+		std::vector<T> first(BitsetSize / (sizeof(T) * CHAR_BIT));
+		std::vector<T> second(first.size());
+		std::vector<T> result(first.size());
+		for (std::size_t i = 0; i < first.size(); ++i)
+		{
+			first[i] = static_cast<T>(gen());
+			second[i] = static_cast<T>(gen());
+		}
+
+		std::size_t byteCount = first.size() * sizeof(T);
+
+		bench.run("AND kernel (" + std::string(BackendName(Nz::BitKernels::GetBackend())) + ")", [&] {
+			Nz::BitKernels::And(result.data(), first.data(), second.data(), byteCount);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("AND kernel (scalar)", [&] {
+			Nz::BitKernels::Scalar::And(result.data(), first.data(), second.data(), byteCount);
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("AND naive block loop", [&] {
+			for (std::size_t i = 0; i < first.size(); ++i)
+				result[i] = first[i] & second[i];
+
+			ankerl::nanobench::doNotOptimizeAway(result);
+		});
+
+		bench.run("Count kernel (" + std::string(BackendName(Nz::BitKernels::GetBackend())) + ")", [&] {
+			std::size_t count = Nz::BitKernels::Count(first.data(), byteCount);
+			ankerl::nanobench::doNotOptimizeAway(count);
+		});
+
+		bench.run("Count kernel (scalar)", [&] {
+			std::size_t count = Nz::BitKernels::Scalar::Count(first.data(), byteCount);
+			ankerl::nanobench::doNotOptimizeAway(count);
+		});
+
+		bench.run("Count naive block loop", [&] {
+			std::size_t count = 0;
+			for (T block : first)
+				count += Nz::CountBits(block);
+
+			ankerl::nanobench::doNotOptimizeAway(count);
+		});
+	}
+}
+
+template<typename T>
+void TestSparseBitset()
+{
+	constexpr std::size_t BitsetSize = 10'000'000;
+	constexpr std::size_t SetBitCount = 16;
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.title("Sparse bitsets using T = Nz::UInt" + std::to_string(sizeof(T) * CHAR_BIT));
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<std::size_t> dis(0, BitsetSize - 1);
+
+	Nz::Bitset<T> bitset(BitsetSize, false);
+	Nz::HierarchicalBitset<T> hierarchicalBitset(BitsetSize, false);
+	for (std::size_t i = 0; i < SetBitCount; ++i)
+	{
+		std::size_t bit = dis(gen);
+		bitset.Set(bit, true);
+		hierarchicalBitset.Set(bit, true);
+	}
+
+	bench.run("iterating a sparse Bitset", [&] {
+		std::size_t sum = 0;
+		for (std::size_t bit : bitset.IterBits())
+			sum += bit;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("iterating a sparse HierarchicalBitset", [&] {
+		std::size_t sum = 0;
+		for (std::size_t bit : hierarchicalBitset.IterBits())
+			sum += bit;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("a single FindNext on a sparse Bitset", [&] {
+		std::size_t bit = bitset.FindNext(dis(gen));
+		ankerl::nanobench::doNotOptimizeAway(bit);
+	});
+
+	bench.run("a single FindNext on a sparse HierarchicalBitset", [&] {
+		std::size_t bit = hierarchicalBitset.FindNext(dis(gen));
+		ankerl::nanobench::doNotOptimizeAway(bit);
+	});
+
+	bench.run("a single Set/Reset on a Bitset", [&] {
+		std::size_t bit = dis(gen);
+		bitset.Set(bit, true);
+		bitset.Reset(bit);
+		ankerl::nanobench::doNotOptimizeAway(bitset);
+	});
+
+	bench.run("a single Set/Reset on a HierarchicalBitset", [&] {
+		std::size_t bit = dis(gen);
+		bool wasSet = hierarchicalBitset.Test(bit);
+		hierarchicalBitset.Set(bit, true);
+		hierarchicalBitset.Set(bit, wasSet);
+		ankerl::nanobench::doNotOptimizeAway(hierarchicalBitset);
+	});
+}
+
+void TestRoaringBitset()
+{
+	constexpr std::size_t BitsetSize = 10'000'000;
+
+	// Clustered IDs, as replicated entities or dirty chunks usually are
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<std::size_t> dis(0, BitsetSize - 1);
+
+	Nz::Bitset<Nz::UInt64> first(BitsetSize, false);
+	Nz::Bitset<Nz::UInt64> second(BitsetSize, false);
+	for (std::size_t i = 0; i < 50; ++i)
+	{
+		std::size_t firstStart = dis(gen);
+		std::size_t secondStart = dis(gen);
+		for (std::size_t j = 0; j < 2000; ++j)
+		{
+			first.Set(std::min(firstStart + j, BitsetSize - 1), true);
+			second.Set(std::min(secondStart + j, BitsetSize - 1), true);
+		}
+	}
+
+	Nz::RoaringBitset<> roaringFirst = Nz::RoaringBitset<>::FromBitset(first);
+	Nz::RoaringBitset<> roaringSecond = Nz::RoaringBitset<>::FromBitset(second);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.title("Clustered bitsets (Bitset: " + std::to_string(first.GetBlockCount() * sizeof(Nz::UInt64)) + " bytes, RoaringBitset: " + std::to_string(roaringFirst.GetMemoryUsage()) + " bytes)");
+
+	bench.run("AND of two clustered Bitsets", [&] {
+		Nz::Bitset<Nz::UInt64> result = first & second;
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("AND of two clustered RoaringBitsets", [&] {
+		Nz::RoaringBitset<> result = roaringFirst & roaringSecond;
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("XOR of two clustered Bitsets", [&] {
+		Nz::Bitset<Nz::UInt64> result = first ^ second;
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("XOR of two clustered RoaringBitsets", [&] {
+		Nz::RoaringBitset<> result = roaringFirst ^ roaringSecond;
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("a single Test on a clustered Bitset", [&] {
+		bool r = first.Test(dis(gen));
+		ankerl::nanobench::doNotOptimizeAway(r);
+	});
+
+	bench.run("a single Test on a clustered RoaringBitset", [&] {
+		bool r = roaringFirst.Test(static_cast<Nz::UInt32>(dis(gen)));
+		ankerl::nanobench::doNotOptimizeAway(r);
+	});
+}
+
+void TestRankIndex()
+{
+	constexpr std::size_t BitsetSize = 10'000'000;
+
+	std::minstd_rand gen(std::random_device{}());
+	std::bernoulli_distribution setDis(0.3);
+	std::uniform_int_distribution<std::size_t> dis(0, BitsetSize);
+
+	Nz::Bitset<Nz::UInt64> bitset(BitsetSize, false);
+	for (std::size_t i = 0; i < BitsetSize; ++i)
+		bitset.Set(i, setDis(gen));
+
+	auto rankIndex = bitset.BuildRankIndex();
+	std::uniform_int_distribution<std::size_t> selectDis(0, rankIndex.Count() - 1);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.title("Rank/select (index: " + std::to_string(rankIndex.GetMemoryUsage()) + " bytes for " + std::to_string(bitset.GetBlockCount() * sizeof(Nz::UInt64)) + " bytes)");
+
+	bench.run("a single prefix count on a Bitset", [&] {
+		std::size_t bit = dis(gen);
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < bit / 64; ++i)
+			count += Nz::CountBits(bitset.GetBlock(i));
+
+		if (bit % 64 != 0)
+			count += Nz::CountBits(bitset.GetBlock(bit / 64) & ((Nz::UInt64(1) << (bit % 64)) - 1));
+
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("a single Rank on a RankIndex", [&] {
+		std::size_t count = rankIndex.Rank(dis(gen));
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("a single Select on a RankIndex", [&] {
+		std::size_t bit = rankIndex.Select(selectDis(gen));
+		ankerl::nanobench::doNotOptimizeAway(bit);
+	});
+
+	bench.run("building a RankIndex", [&] {
+		auto index = bitset.BuildRankIndex();
+		ankerl::nanobench::doNotOptimizeAway(index);
+	});
+}
+
+void TestBitsetView()
+{
+	constexpr std::size_t BitCount = 100'000;
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+	// Bitfields stored in a packet, right after a 3-bit header
+	std::vector<Nz::UInt8> packet(BitCount / 8 + 2);
+	for (Nz::UInt8& byte : packet)
+		byte = static_cast<Nz::UInt8>(dis(gen));
+
+	Nz::BitsetView first(packet.data(), 3, BitCount);
+	Nz::BitsetView second(packet.data(), 7, BitCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.title("Bitfields of " + std::to_string(BitCount) + " bits in external memory");
+
+	bench.run("Count after copying into a Bitset", [&] {
+		Nz::Bitset<Nz::UInt64> bitset;
+		bitset.Write(Nz::Bitset<Nz::UInt64>::PointerSequence(packet.data(), 3), BitCount);
+		std::size_t count = bitset.Count();
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("Count using BitsetView", [&] {
+		std::size_t count = first.Count();
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("CountAnd of two misaligned BitsetViews", [&] {
+		std::size_t count = first.CountAnd(second);
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+}
+
+void TestParallelBitset()
+{
+	constexpr std::size_t BitCount = 64ull * 1024ull * 1024ull;
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<std::size_t> dis(0, BitCount - 1);
+
+	Nz::Bitset<Nz::UInt64> a(BitCount, false);
+	Nz::Bitset<Nz::UInt64> b(BitCount, false);
+	for (std::size_t i = 0; i < BitCount / 16; ++i)
+	{
+		a.Set(dis(gen));
+		b.Set(dis(gen));
+	}
+
+	Nz::Bitset<Nz::UInt64> result;
+	std::vector<std::size_t> bits(a.Count());
+
+	Nz::TaskScheduler scheduler;
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(5);
+	bench.title("Whole-bitset operations on " + std::to_string(BitCount) + " bits (" + std::to_string(scheduler.GetWorkerCount()) + " workers)");
+
+	bench.run("Count", [&] {
+		std::size_t count = a.Count();
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("ParallelCount", [&] {
+		std::size_t count = Nz::ParallelCount(scheduler, a, 0);
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run("PerformsOR", [&] {
+		result.PerformsOR(a, b);
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("ParallelPerformsOR", [&] {
+		Nz::ParallelPerformsOR(scheduler, result, a, b, 0);
+		ankerl::nanobench::doNotOptimizeAway(result);
+	});
+
+	bench.run("ExtractSetBits", [&] {
+		a.ExtractSetBits(bits.data());
+		ankerl::nanobench::doNotOptimizeAway(bits);
+	});
+
+	bench.run("ParallelExtractSetBits", [&] {
+		Nz::ParallelExtractSetBits(scheduler, a, bits.data(), 0);
+		ankerl::nanobench::doNotOptimizeAway(bits);
+	});
+
+	Nz::Bitset<Nz::UInt64> lastBit(BitCount, false);
+	lastBit.Set(BitCount - 1);
+
+	bench.run("FindFirst (last bit set)", [&] {
+		std::size_t bit = lastBit.FindFirst();
+		ankerl::nanobench::doNotOptimizeAway(bit);
+	});
+
+	bench.run("ParallelFindFirst (last bit set)", [&] {
+		std::size_t bit = Nz::ParallelFindFirst(scheduler, lastBit, 0);
+		ankerl::nanobench::doNotOptimizeAway(bit);
+	});
 }
 
 int main()
@@ -119,4 +583,15 @@ int main()
 	TestBitset<Nz::UInt16>();
 	TestBitset<Nz::UInt32>();
 	TestBitset<Nz::UInt64>();
+
+	TestSparseBitset<Nz::UInt32>();
+	TestSparseBitset<Nz::UInt64>();
+
+	TestRoaringBitset();
+
+	TestRankIndex();
+
+	TestBitsetView();
+
+	TestParallelBitset();
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <NazaraUtils/BloomFilter.hpp>
+#include <NazaraUtils/CuckooFilter.hpp>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <nanobench.h>
+
+template<typename Filter>
+void BenchFilter(ankerl::nanobench::Bench& bench, const char* name, Filter& filter, const std::vector<Nz::UInt64>& keys, const std::vector<Nz::UInt64>& missingKeys)
+{
+	for (Nz::UInt64 key : keys)
+		filter.Insert(key);
+
+	bench.run(std::string(name) + " successful lookup", [&] {
+		std::size_t count = 0;
+		for (Nz::UInt64 key : keys)
+			count += filter.MayContain(key);
+
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run(std::string(name) + " failed lookup", [&] {
+		std::size_t count = 0;
+		for (Nz::UInt64 key : missingKeys)
+			count += filter.MayContain(key);
+
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+}
+
+int main()
+{
+	// Large enough for the filters to not fit in L2 cache
+	constexpr std::size_t KeyCount = 1'000'000;
+
+	std::mt19937_64 gen(std::random_device{}());
+
+	std::vector<Nz::UInt64> keys(KeyCount);
+	for (Nz::UInt64& key : keys)
+		key = gen();
+
+	std::vector<Nz::UInt64> missingKeys(KeyCount);
+	for (Nz::UInt64& key : missingKeys)
+		key = gen();
+
+	std::size_t bitCount = Nz::ComputeBloomFilterBitCount(KeyCount, 0.01);
+	std::size_t hashCount = Nz::ComputeBloomFilterHashCount(bitCount, KeyCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(3);
+	bench.title("Membership of " + std::to_string(KeyCount) + " 64-bit keys (1% false positive rate)");
+
+	std::unordered_set<Nz::UInt64> set(keys.begin(), keys.end());
+	bench.run("std::unordered_set failed lookup", [&] {
+		std::size_t count = 0;
+		for (Nz::UInt64 key : missingKeys)
+			count += set.count(key);
+
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	Nz::BloomFilter<Nz::UInt64> bloomFilter(bitCount, hashCount);
+	BenchFilter(bench, "BloomFilter", bloomFilter, keys, missingKeys);
+
+	Nz::BlockedBloomFilter<Nz::UInt64> blockedBloomFilter(bitCount, hashCount);
+	BenchFilter(bench, "BlockedBloomFilter", blockedBloomFilter, keys, missingKeys);
+
+	Nz::CuckooFilter<Nz::UInt64> cuckooFilter(KeyCount);
+	BenchFilter(bench, "CuckooFilter", cuckooFilter, keys, missingKeys);
+}
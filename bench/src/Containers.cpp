@@ -0,0 +1,340 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/SmallVector.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <NazaraUtils/StackVector.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nanobench.h>
+
+// Non-trivially copyable element counting its copies and moves (like CopyCounter in the tests), defeating memcpy fast paths
+class Counted
+{
+	public:
+		Counted() :
+		m_value(0)
+		{
+		}
+
+		explicit Counted(Nz::UInt32 value) :
+		m_value(value)
+		{
+		}
+
+		Counted(const Counted& counted) :
+		m_value(counted.m_value)
+		{
+			s_copyCount++;
+		}
+
+		Counted(Counted&& counted) noexcept :
+		m_value(counted.m_value)
+		{
+			s_moveCount++;
+		}
+
+		~Counted() = default;
+
+		Nz::UInt32 GetValue() const
+		{
+			return m_value;
+		}
+
+		Counted& operator=(const Counted& counted)
+		{
+			m_value = counted.m_value;
+			s_copyCount++;
+
+			return *this;
+		}
+
+		Counted& operator=(Counted&& counted) noexcept
+		{
+			m_value = counted.m_value;
+			s_moveCount++;
+
+			return *this;
+		}
+
+		static inline std::size_t s_copyCount = 0;
+		static inline std::size_t s_moveCount = 0;
+
+	private:
+		Nz::UInt32 m_value;
+};
+
+constexpr std::size_t ElementCount = 64;
+constexpr std::size_t RepeatCount = 1000;
+
+template<typename T>
+T MakeElement(std::size_t i)
+{
+	return T(Nz::UInt32(i));
+}
+
+template<typename T>
+Nz::UInt32 GetElementValue(const T& element)
+{
+	if constexpr (std::is_same_v<T, Counted>)
+		return element.GetValue();
+	else
+		return element;
+}
+
+template<typename Container>
+void FillContainer(Container& container)
+{
+	using T = typename Container::value_type;
+	for (std::size_t i = 0; i < ElementCount; ++i)
+		container.push_back(MakeElement<T>(i));
+}
+
+template<typename Container>
+Nz::UInt32 InsertEraseMiddle(Container& container)
+{
+	using T = typename Container::value_type;
+	for (std::size_t i = 0; i < ElementCount / 2; ++i)
+		container.push_back(MakeElement<T>(i));
+
+	for (std::size_t i = 0; i < ElementCount / 2; ++i)
+		container.insert(container.begin() + container.size() / 2, MakeElement<T>(i));
+
+	for (std::size_t i = 0; i < ElementCount / 2; ++i)
+		container.erase(container.begin() + container.size() / 2);
+
+	return GetElementValue(container.back());
+}
+
+template<typename Container>
+Nz::UInt32 SumContainer(const Container& container)
+{
+	Nz::UInt32 sum = 0;
+	for (const auto& element : container)
+		sum += GetElementValue(element);
+
+	return sum;
+}
+
+// Stack allocations are only released when the function returns, these helpers keep them from piling up in the benchmark loops
+template<typename T>
+Nz::UInt32 FillStackVector()
+{
+	auto vec = NazaraStackVector(T, ElementCount);
+	FillContainer(vec);
+
+	return GetElementValue(vec.back());
+}
+
+template<typename T>
+Nz::UInt32 FillStackArray()
+{
+	auto array = NazaraStackArrayNoInit(T, ElementCount);
+	for (std::size_t i = 0; i < ElementCount; ++i)
+		Nz::PlacementNew(&array[i], MakeElement<T>(i));
+
+	return GetElementValue(array.back());
+}
+
+template<typename T>
+Nz::UInt32 InsertEraseStackVector()
+{
+	auto vec = NazaraStackVector(T, ElementCount);
+	return InsertEraseMiddle(vec);
+}
+
+template<typename T>
+void BenchPushBack(const std::string& typeName)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ElementCount * RepeatCount);
+	bench.unit("element");
+	bench.title("push_back of " + std::to_string(ElementCount) + " " + typeName);
+
+	bench.run("std::vector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			std::vector<T> vec;
+			FillContainer(vec);
+			ankerl::nanobench::doNotOptimizeAway(vec.back());
+		}
+	});
+
+	bench.run("std::vector (reserved)", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			std::vector<T> vec;
+			vec.reserve(ElementCount);
+			FillContainer(vec);
+			ankerl::nanobench::doNotOptimizeAway(vec.back());
+		}
+	});
+
+	bench.run("Nz::FixedVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Nz::FixedVector<T, ElementCount> vec;
+			FillContainer(vec);
+			ankerl::nanobench::doNotOptimizeAway(vec.back());
+		}
+	});
+
+	bench.run("Nz::SmallVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Nz::SmallVector<T, ElementCount> vec;
+			FillContainer(vec);
+			ankerl::nanobench::doNotOptimizeAway(vec.back());
+		}
+	});
+
+#ifdef NAZARA_ALLOCA_SUPPORT
+	bench.run("NazaraStackVector (alloca)", [&] {
+#else
+	bench.run("NazaraStackVector (arena fallback)", [&] {
+#endif
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+			ankerl::nanobench::doNotOptimizeAway(FillStackVector<T>());
+	});
+
+	bench.run("NazaraArenaStackVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			auto vec = NazaraArenaStackVector(T, ElementCount);
+			FillContainer(vec);
+			ankerl::nanobench::doNotOptimizeAway(vec.back());
+		}
+	});
+
+#ifdef NAZARA_ALLOCA_SUPPORT
+	bench.run("NazaraStackArrayNoInit (alloca)", [&] {
+#else
+	bench.run("NazaraStackArrayNoInit (arena fallback)", [&] {
+#endif
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+			ankerl::nanobench::doNotOptimizeAway(FillStackArray<T>());
+	});
+}
+
+template<typename T>
+void BenchInsertErase(const std::string& typeName)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ElementCount * RepeatCount);
+	bench.unit("operation");
+	bench.title("insert/erase in the middle of " + std::to_string(ElementCount) + " " + typeName);
+
+	bench.run("std::vector (reserved)", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			std::vector<T> vec;
+			vec.reserve(ElementCount);
+			ankerl::nanobench::doNotOptimizeAway(InsertEraseMiddle(vec));
+		}
+	});
+
+	bench.run("Nz::FixedVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Nz::FixedVector<T, ElementCount> vec;
+			ankerl::nanobench::doNotOptimizeAway(InsertEraseMiddle(vec));
+		}
+	});
+
+	bench.run("Nz::SmallVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Nz::SmallVector<T, ElementCount> vec;
+			ankerl::nanobench::doNotOptimizeAway(InsertEraseMiddle(vec));
+		}
+	});
+
+	bench.run("NazaraStackVector", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+			ankerl::nanobench::doNotOptimizeAway(InsertEraseStackVector<T>());
+	});
+}
+
+template<typename Container>
+void BenchCopyMove(ankerl::nanobench::Bench& bench, const std::string& name)
+{
+	Container source;
+	FillContainer(source);
+
+	bench.run(name + " (copy)", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Container copy(source);
+			ankerl::nanobench::doNotOptimizeAway(copy.back());
+		}
+	});
+
+	bench.run(name + " (copy then move)", [&] {
+		for (std::size_t i = 0; i < RepeatCount; ++i)
+		{
+			Container copy(source);
+			Container moved(std::move(copy));
+			ankerl::nanobench::doNotOptimizeAway(moved.back());
+		}
+	});
+}
+
+template<typename T>
+void BenchCopyMove(const std::string& typeName)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ElementCount * RepeatCount);
+	bench.unit("element");
+	bench.title("copy/move of " + std::to_string(ElementCount) + " " + typeName);
+
+	BenchCopyMove<std::vector<T>>(bench, "std::vector");
+	BenchCopyMove<Nz::FixedVector<T, ElementCount>>(bench, "Nz::FixedVector");
+	BenchCopyMove<Nz::SmallVector<T, ElementCount>>(bench, "Nz::SmallVector");
+}
+
+template<typename T>
+void BenchIteration(const std::string& typeName)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(ElementCount);
+	bench.unit("element");
+	bench.title("iteration over " + std::to_string(ElementCount) + " " + typeName);
+
+	std::vector<T> vec;
+	FillContainer(vec);
+
+	Nz::FixedVector<T, ElementCount> fixedVec;
+	FillContainer(fixedVec);
+
+	Nz::SmallVector<T, ElementCount> smallVec;
+	FillContainer(smallVec);
+
+	auto stackVec = NazaraStackVector(T, ElementCount);
+	FillContainer(stackVec);
+
+	bench.run("std::vector", [&] { ankerl::nanobench::doNotOptimizeAway(SumContainer(vec)); });
+	bench.run("Nz::FixedVector", [&] { ankerl::nanobench::doNotOptimizeAway(SumContainer(fixedVec)); });
+	bench.run("Nz::SmallVector", [&] { ankerl::nanobench::doNotOptimizeAway(SumContainer(smallVec)); });
+	bench.run("NazaraStackVector", [&] { ankerl::nanobench::doNotOptimizeAway(SumContainer(stackVec)); });
+}
+
+template<typename T>
+void BenchElementType(const std::string& typeName)
+{
+	BenchPushBack<T>(typeName);
+	BenchInsertErase<T>(typeName);
+	BenchCopyMove<T>(typeName);
+	BenchIteration<T>(typeName);
+}
+
+int main()
+{
+	BenchElementType<Nz::UInt32>("UInt32 (trivial)");
+	BenchElementType<Counted>("Counted (non-trivial)");
+
+	ankerl::nanobench::doNotOptimizeAway(Counted::s_copyCount + Counted::s_moveCount);
+}
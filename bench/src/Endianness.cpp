@@ -0,0 +1,46 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <vector>
+#include <nanobench.h>
+
+template<typename T>
+void BenchByteSwap(const char* title)
+{
+	constexpr std::size_t ValueCount = 1'000'000;
+
+	std::vector<T> input(ValueCount);
+	for (std::size_t i = 0; i < ValueCount; ++i)
+		input[i] = static_cast<T>(i * 0x01020304);
+
+	std::vector<T> output(ValueCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ValueCount);
+	bench.unit("value");
+	bench.title(title);
+
+	bench.run("BigEndianToHost loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			output[i] = Nz::BigEndianToHost(input[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("BigEndianToHost array", [&] {
+		Nz::BigEndianToHost(input.data(), output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("ByteSwapArray in place", [&] {
+		Nz::ByteSwapArray(output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+}
+
+int main()
+{
+	BenchByteSwap<Nz::UInt16>("Byte swapping 1M UInt16");
+	BenchByteSwap<Nz::UInt32>("Byte swapping 1M UInt32");
+	BenchByteSwap<Nz::UInt64>("Byte swapping 1M UInt64");
+}
@@ -0,0 +1,53 @@
+#include <NazaraUtils/EnumString.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+enum class Keyword
+{
+	Alignas, Alignof, Auto, Bool, Break, Case, Catch, Char, Class, Const, Constexpr, Continue, Decltype, Default,
+	Delete, Do, Double, Else, Enum, Explicit, Extern, False, Float, For, Friend, Goto, If, Inline, Int, Long,
+
+	Max = Long
+};
+
+template<>
+struct Nz::EnumNames<Keyword>
+{
+	static constexpr std::string_view names[] = {
+		"alignas", "alignof", "auto", "bool", "break", "case", "catch", "char", "class", "const", "constexpr", "continue", "decltype", "default",
+		"delete", "do", "double", "else", "enum", "explicit", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long"
+	};
+};
+
+int main()
+{
+	std::vector<std::string> inputs;
+	for (std::string_view name : Nz::EnumNames<Keyword>::names)
+	{
+		inputs.emplace_back(name);
+		inputs.emplace_back(std::string(name) + "_");
+	}
+
+	std::unordered_map<std::string_view, Keyword> map;
+	for (std::size_t i = 0; i < std::size(Nz::EnumNames<Keyword>::names); ++i)
+		map.emplace(Nz::EnumNames<Keyword>::names[i], static_cast<Keyword>(i));
+
+	ankerl::nanobench::Bench bench;
+	bench.title("String to enum");
+	bench.batch(inputs.size());
+
+	bench.run("std::unordered_map", [&] {
+		for (const std::string& input : inputs)
+		{
+			auto it = map.find(input);
+			ankerl::nanobench::doNotOptimizeAway(it != map.end() ? it->second : Keyword::Max);
+		}
+	});
+
+	bench.run("Nz::EnumFromString", [&] {
+		for (const std::string& input : inputs)
+			ankerl::nanobench::doNotOptimizeAway(Nz::EnumFromString<Keyword>(input).value_or(Keyword::Max));
+	});
+}
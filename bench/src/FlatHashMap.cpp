@@ -0,0 +1,137 @@
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+template<typename Map>
+void BenchIntegerMap(ankerl::nanobench::Bench& bench, const char* name, const std::vector<Nz::UInt64>& keys, const std::vector<Nz::UInt64>& missingKeys)
+{
+	bench.run(std::string(name) + " insert", [&] {
+		Map map;
+		for (Nz::UInt64 key : keys)
+			map[key] = key;
+
+		ankerl::nanobench::doNotOptimizeAway(map.size());
+	});
+
+	Map map;
+	for (Nz::UInt64 key : keys)
+		map[key] = key;
+
+	bench.run(std::string(name) + " successful lookup", [&] {
+		Nz::UInt64 sum = 0;
+		for (Nz::UInt64 key : keys)
+			sum += map.find(key)->second;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run(std::string(name) + " failed lookup", [&] {
+		std::size_t count = 0;
+		for (Nz::UInt64 key : missingKeys)
+			count += map.count(key);
+
+		ankerl::nanobench::doNotOptimizeAway(count);
+	});
+
+	bench.run(std::string(name) + " iteration", [&] {
+		Nz::UInt64 sum = 0;
+		for (auto&& [key, value] : map)
+			sum += value;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run(std::string(name) + " erase and insert", [&] {
+		for (std::size_t i = 0; i < keys.size(); i += 4)
+		{
+			map.erase(keys[i]);
+			map[keys[i]] = i;
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(map.size());
+	});
+}
+
+void TestIntegerKeys(std::size_t count)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(count);
+	bench.unit("key");
+	bench.title(std::to_string(count) + " integer keys");
+
+	std::mt19937_64 gen(std::random_device{}());
+
+	std::vector<Nz::UInt64> keys(count);
+	for (Nz::UInt64& key : keys)
+		key = gen();
+
+	std::vector<Nz::UInt64> missingKeys(count);
+	for (Nz::UInt64& key : missingKeys)
+		key = gen();
+
+	BenchIntegerMap<std::unordered_map<Nz::UInt64, Nz::UInt64>>(bench, "std::unordered_map", keys, missingKeys);
+	BenchIntegerMap<Nz::FlatHashMap<Nz::UInt64, Nz::UInt64>>(bench, "Nz::FlatHashMap", keys, missingKeys);
+}
+
+void TestStringKeys(std::size_t count)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(count);
+	bench.unit("key");
+	bench.title(std::to_string(count) + " string keys");
+
+	std::mt19937_64 gen(std::random_device{}());
+
+	std::vector<std::string> keys(count);
+	for (std::string& key : keys)
+		key = "resource_" + std::to_string(gen());
+
+	std::vector<std::string_view> keyViews(keys.begin(), keys.end());
+
+	std::unordered_map<std::string, std::size_t, Nz::StringHash<>, std::equal_to<>> stdMap;
+	Nz::FlatHashMap<std::string, std::size_t> flatMap;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		stdMap[keys[i]] = i;
+		flatMap[keys[i]] = i;
+	}
+
+	bench.run("std::unordered_map lookup", [&] {
+		std::size_t sum = 0;
+		for (const std::string& key : keys)
+			sum += stdMap.find(key)->second;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("Nz::FlatHashMap lookup", [&] {
+		std::size_t sum = 0;
+		for (const std::string& key : keys)
+			sum += flatMap.find(key)->second;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("Nz::FlatHashMap heterogeneous lookup", [&] {
+		std::size_t sum = 0;
+		for (std::string_view key : keyViews)
+			sum += flatMap.find(key)->second;
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+int main()
+{
+	for (std::size_t count : { 100, 10'000, 1'000'000 })
+		TestIntegerKeys(count);
+
+	for (std::size_t count : { 100, 100'000 })
+		TestStringKeys(count);
+}
@@ -0,0 +1,277 @@
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+void TestCRC32(std::size_t size)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(size);
+	bench.unit("byte");
+	bench.title("CRC-32 of " + std::to_string(size) + " bytes");
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+	std::vector<Nz::UInt8> buffer(size);
+	for (Nz::UInt8& byte : buffer)
+		byte = static_cast<Nz::UInt8>(dis(gen));
+
+	bench.run("bytewise table", [&] {
+		Nz::UInt32 crc = 0xFFFFFFFFu;
+		for (Nz::UInt8 byte : buffer)
+			crc = Nz::Detail::s_crc32Table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+
+		ankerl::nanobench::doNotOptimizeAway(crc);
+	});
+
+	bench.run("slicing-by-8", [&] {
+		Nz::UInt32 crc = Nz::Detail::CRC32UpdateScalar(0xFFFFFFFFu, buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(crc);
+	});
+
+	bench.run("CRC32", [&] {
+		Nz::UInt32 crc = Nz::CRC32(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(crc);
+	});
+
+	bench.run("CRC32C", [&] {
+		Nz::UInt32 crc = Nz::CRC32C(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(crc);
+	});
+}
+
+void TestHashThroughput(std::size_t size)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations((size >= 1024 * 1024) ? 2 : 100);
+	bench.batch(size);
+	bench.unit("byte");
+	bench.title("Hash of " + std::to_string(size) + " bytes");
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+	std::vector<Nz::UInt8> buffer(size);
+	for (Nz::UInt8& byte : buffer)
+		byte = static_cast<Nz::UInt8>(dis(gen));
+
+	bench.run("CRC32", [&] {
+		Nz::UInt32 hash = Nz::CRC32(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("CRC32C", [&] {
+		Nz::UInt32 hash = Nz::CRC32C(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("FNV1a32", [&] {
+		Nz::UInt32 hash = Nz::FNV1a32(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("FNV1a64", [&] {
+		Nz::UInt64 hash = Nz::FNV1a64(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("WyHash64", [&] {
+		Nz::UInt64 hash = Nz::WyHash64(buffer.data(), buffer.size());
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	std::string_view str(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+	bench.run("std::hash<std::string_view>", [&] {
+		std::size_t hash = std::hash<std::string_view>{}(str);
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+}
+
+template<typename H>
+void BenchStringLookup(ankerl::nanobench::Bench& bench, const char* name, const std::vector<std::string>& keys, const std::vector<std::string>& lookups)
+{
+	std::unordered_map<std::string, std::size_t, Nz::StringHash<char, H>, std::equal_to<>> map;
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		map.emplace(keys[i], i);
+
+	bench.run(name, [&] {
+		std::size_t sum = 0;
+		for (const std::string& key : lookups)
+		{
+			auto it = map.find(key);
+			if (it != map.end())
+				sum += it->second;
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+void TestStringHashLookup(std::size_t keyLength)
+{
+	constexpr std::size_t KeyCount = 10'000;
+
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<int> dis('a', 'z');
+
+	// Identifier-like keys sharing a common prefix, as resource paths or shader option names do
+	std::vector<std::string> keys(KeyCount);
+	for (std::string& key : keys)
+	{
+		key = "prefix/";
+		while (key.size() < keyLength)
+			key.push_back(static_cast<char>(dis(gen)));
+	}
+
+	// Half of the lookups miss
+	std::vector<std::string> lookups;
+	for (std::size_t i = 0; i < KeyCount; ++i)
+	{
+		std::string key = keys[gen() % KeyCount];
+		if (i % 2 == 0)
+			key.back() = '#';
+
+		lookups.push_back(std::move(key));
+	}
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(lookups.size());
+	bench.unit("lookup");
+	bench.title("std::unordered_map lookups of " + std::to_string(keyLength) + " characters keys");
+
+	BenchStringLookup<std::hash<std::string_view>>(bench, "StringHash<std::hash>", keys, lookups);
+	BenchStringLookup<Nz::CRC32CHash>(bench, "StringHash<CRC32CHash>", keys, lookups);
+	BenchStringLookup<Nz::FNV1a64Hash>(bench, "StringHash<FNV1a64Hash>", keys, lookups);
+	BenchStringLookup<Nz::WyHash64Hash>(bench, "StringHash<WyHash64Hash>", keys, lookups);
+}
+
+void TestHashRange(std::size_t count)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(count);
+	bench.unit("element");
+	bench.title("Hash of " + std::to_string(count) + " integers");
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<Nz::UInt32> dis;
+
+	std::vector<Nz::UInt32> values(count);
+	for (Nz::UInt32& value : values)
+		value = dis(gen);
+
+	std::list<Nz::UInt32> valueList(values.begin(), values.end());
+
+	bench.run("HashCombine loop", [&] {
+		std::size_t hash = 0;
+		for (Nz::UInt32 value : values)
+			Nz::HashCombine(hash, value);
+
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("HashRange (contiguous)", [&] {
+		std::size_t hash = Nz::HashRange(values);
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+
+	bench.run("HashRange (list)", [&] {
+		std::size_t hash = Nz::HashRange(valueList);
+		ankerl::nanobench::doNotOptimizeAway(hash);
+	});
+}
+
+void TestHashCombineChain()
+{
+	// Hashing composite keys (as pipeline or sampler state caches do)
+	struct State
+	{
+		Nz::UInt32 shader;
+		Nz::UInt32 vertexLayout;
+		Nz::UInt16 blendMode;
+		Nz::UInt16 depthMode;
+		float depthBias;
+		bool scissorTest;
+	};
+
+	std::minstd_rand gen(42);
+	std::vector<State> states(4096);
+	for (State& state : states)
+		state = State{ Nz::UInt32(gen()), Nz::UInt32(gen()), Nz::UInt16(gen()), Nz::UInt16(gen()), float(gen() % 16), gen() % 2 == 0 };
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(states.size());
+	bench.unit("key");
+	bench.title("Hash of 6-field composite keys");
+
+	bench.run("HashCombine (seed chain)", [&] {
+		std::size_t sum = 0;
+		for (const State& state : states)
+		{
+			std::size_t hash = 0;
+			Nz::HashCombine(hash, state.shader);
+			Nz::HashCombine(hash, state.vertexLayout);
+			Nz::HashCombine(hash, state.blendMode);
+			Nz::HashCombine(hash, state.depthMode);
+			Nz::HashCombine(hash, state.depthBias);
+			Nz::HashCombine(hash, state.scissorTest);
+			sum += hash;
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("HashCombine (variadic)", [&] {
+		std::size_t sum = 0;
+		for (const State& state : states)
+			sum += Nz::HashCombine(state.shader, state.vertexLayout, state.blendMode, state.depthMode, state.depthBias, state.scissorTest);
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("WyHash64 (fields bytes)", [&] {
+		std::size_t sum = 0;
+		for (const State& state : states)
+		{
+			Nz::UInt8 bytes[17];
+			std::memcpy(&bytes[0], &state.shader, 4);
+			std::memcpy(&bytes[4], &state.vertexLayout, 4);
+			std::memcpy(&bytes[8], &state.blendMode, 2);
+			std::memcpy(&bytes[10], &state.depthMode, 2);
+			std::memcpy(&bytes[12], &state.depthBias, 4);
+			bytes[16] = state.scissorTest;
+
+			sum += Nz::WyHash64(bytes, sizeof(bytes));
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+int main()
+{
+	for (std::size_t size : { 16, 256, 4096, 1024 * 1024 })
+		TestCRC32(size);
+
+	for (std::size_t size : { 4, 16, 64, 256, 4096, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024 })
+		TestHashThroughput(size);
+
+	for (std::size_t keyLength : { 8, 24, 64 })
+		TestStringHashLookup(keyLength);
+
+	for (std::size_t count : { 4, 64, 4096 })
+		TestHashRange(count);
+
+	TestHashCombineChain();
+}
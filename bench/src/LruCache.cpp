@@ -0,0 +1,97 @@
+#include <NazaraUtils/ClockCache.hpp>
+#include <NazaraUtils/LruCache.hpp>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+// Usual implementation, with one list node and one map node allocated per entry
+class StdLruCache
+{
+	public:
+		StdLruCache(std::size_t capacity) :
+		m_capacity(capacity)
+		{
+		}
+
+		int* Get(Nz::UInt64 key)
+		{
+			auto it = m_entries.find(key);
+			if (it == m_entries.end())
+				return nullptr;
+
+			m_list.splice(m_list.begin(), m_list, it->second);
+			return &it->second->second;
+		}
+
+		void Put(Nz::UInt64 key, int value)
+		{
+			auto it = m_entries.find(key);
+			if (it != m_entries.end())
+			{
+				it->second->second = value;
+				m_list.splice(m_list.begin(), m_list, it->second);
+				return;
+			}
+
+			m_list.emplace_front(key, value);
+			m_entries.emplace(key, m_list.begin());
+			if (m_list.size() > m_capacity)
+			{
+				m_entries.erase(m_list.back().first);
+				m_list.pop_back();
+			}
+		}
+
+	private:
+		std::list<std::pair<Nz::UInt64, int>> m_list;
+		std::unordered_map<Nz::UInt64, std::list<std::pair<Nz::UInt64, int>>::iterator> m_entries;
+		std::size_t m_capacity;
+};
+
+template<typename Cache>
+void BenchCache(ankerl::nanobench::Bench& bench, const char* name, std::size_t capacity, const std::vector<Nz::UInt64>& accesses)
+{
+	Cache cache(capacity);
+
+	bench.run(name, [&] {
+		std::size_t hitCount = 0;
+		for (Nz::UInt64 key : accesses)
+		{
+			if (int* value = cache.Get(key))
+			{
+				hitCount++;
+				ankerl::nanobench::doNotOptimizeAway(*value);
+			}
+			else
+				cache.Put(key, int(key));
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(hitCount);
+	});
+}
+
+int main()
+{
+	constexpr std::size_t AccessCount = 1'000'000;
+	constexpr std::size_t KeyCount = 100'000;
+	constexpr std::size_t Capacity = 20'000;
+
+	// Skewed accesses, a few keys being accessed much more often than the others
+	std::mt19937_64 gen(std::random_device{}());
+	std::exponential_distribution<double> dis(10.0 / KeyCount);
+
+	std::vector<Nz::UInt64> accesses(AccessCount);
+	for (Nz::UInt64& key : accesses)
+		key = static_cast<Nz::UInt64>(dis(gen)) % KeyCount;
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(3);
+	bench.title(std::to_string(AccessCount) + " accesses to a cache of " + std::to_string(Capacity) + " entries");
+
+	BenchCache<StdLruCache>(bench, "std::list + std::unordered_map", Capacity, accesses);
+	BenchCache<Nz::LruCache<Nz::UInt64, int>>(bench, "Nz::LruCache", Capacity, accesses);
+	BenchCache<Nz::ClockCache<Nz::UInt64, int>>(bench, "Nz::ClockCache", Capacity, accesses);
+}
@@ -0,0 +1,130 @@
+#include <NazaraUtils/MathUtils.hpp>
+#include <random>
+#include <vector>
+#include <nanobench.h>
+
+template<typename T>
+void BenchMathKernels(const char* title)
+{
+	constexpr std::size_t ValueCount = 100'000;
+
+	std::minstd_rand gen(42);
+	std::uniform_real_distribution<T> dis(T(-100.0), T(100.0));
+
+	std::vector<T> from(ValueCount);
+	std::vector<T> to(ValueCount);
+	std::vector<T> factors(ValueCount);
+	for (std::size_t i = 0; i < ValueCount; ++i)
+	{
+		from[i] = dis(gen);
+		to[i] = dis(gen);
+		factors[i] = dis(gen) / T(100.0);
+	}
+
+	std::vector<T> output(ValueCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ValueCount);
+	bench.unit("value");
+	bench.title(title);
+
+	bench.run("Lerp loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			output[i] = Nz::Lerp(from[i], to[i], factors[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Lerp array", [&] {
+		Nz::Lerp(from.data(), to.data(), factors.data(), output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Clamp loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			output[i] = Nz::Clamp(from[i], T(-50.0), T(50.0));
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Clamp array", [&] {
+		Nz::Clamp(from.data(), T(-50.0), T(50.0), output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Approach loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			output[i] = Nz::Approach(from[i], T(0.0), T(1.0));
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Approach array", [&] {
+		Nz::Approach(from.data(), T(0.0), T(1.0), output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("MultiplyAdd loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			output[i] = Nz::MultiplyAdd(from[i], to[i], factors[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("MultiplyAdd array", [&] {
+		Nz::MultiplyAdd(from.data(), to.data(), factors.data(), output.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+}
+
+void BenchHalfConversions()
+{
+	constexpr std::size_t ValueCount = 100'000;
+
+	std::minstd_rand gen(42);
+	std::uniform_real_distribution<float> dis(-1000.f, 1000.f);
+
+	std::vector<float> floats(ValueCount);
+	for (float& value : floats)
+		value = dis(gen);
+
+	std::vector<Nz::UInt16> halves(ValueCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ValueCount);
+	bench.unit("value");
+	bench.title("Half-precision conversions of 100k values");
+
+	bench.run("FloatToHalf loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			halves[i] = Nz::FloatToHalf(floats[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(halves.data());
+	});
+
+	bench.run("FloatToHalf array", [&] {
+		Nz::FloatToHalf(floats.data(), halves.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(halves.data());
+	});
+
+	bench.run("HalfToFloat loop", [&] {
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			floats[i] = Nz::HalfToFloat(halves[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(floats.data());
+	});
+
+	bench.run("HalfToFloat array", [&] {
+		Nz::HalfToFloat(halves.data(), floats.data(), ValueCount);
+		ankerl::nanobench::doNotOptimizeAway(floats.data());
+	});
+}
+
+int main()
+{
+	BenchMathKernels<float>("Math operations on 100k floats");
+	BenchMathKernels<double>("Math operations on 100k doubles");
+	BenchHalfConversions();
+}
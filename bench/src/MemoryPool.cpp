@@ -0,0 +1,315 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L
+	#define NAZARA_BENCH_PMR
+#endif
+
+struct Particle
+{
+	Particle(float value) :
+	x(value), y(value), z(value),
+	vx(1.f), vy(1.f), vz(1.f)
+	{
+	}
+
+	float x, y, z;
+	float vx, vy, vz;
+	Nz::UInt32 color = 0xFFFFFFFF;
+	Nz::UInt32 lifetime = 100;
+};
+
+constexpr std::size_t BlockSize = 1024;
+constexpr std::size_t ParticleCount = 100'000;
+
+// Returns indices [0, count) in random order
+std::vector<std::size_t> ShuffledIndices(std::size_t count, std::mt19937& rand)
+{
+	std::vector<std::size_t> indices(count);
+	std::iota(indices.begin(), indices.end(), 0);
+	std::shuffle(indices.begin(), indices.end(), rand);
+
+	return indices;
+}
+
+void BenchSequential()
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ParticleCount);
+	bench.unit("particle");
+	bench.title("Allocating then freeing 100k particles");
+
+	std::vector<std::size_t> indices(ParticleCount);
+	std::vector<Particle*> pointers(ParticleCount);
+
+	bench.run("Nz::MemoryPool", [&] {
+		Nz::MemoryPool<Particle> pool(BlockSize);
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pool.Allocate(indices[i], float(i));
+
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pool.Free(indices[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(pool.GetBlockCount());
+	});
+
+	bench.run("Nz::MemoryPool (AllocateBulk)", [&] {
+		Nz::MemoryPool<Particle> pool(BlockSize);
+		pool.AllocateBulk(ParticleCount, indices.data(), 0.f);
+		pool.FreeBulk(indices.data(), ParticleCount);
+
+		ankerl::nanobench::doNotOptimizeAway(pool.GetBlockCount());
+	});
+
+	bench.run("new/delete", [&] {
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pointers[i] = new Particle(float(i));
+
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			delete pointers[i];
+
+		ankerl::nanobench::doNotOptimizeAway(pointers.front());
+	});
+
+#ifdef NAZARA_BENCH_PMR
+	bench.run("std::pmr::unsynchronized_pool_resource", [&] {
+		std::pmr::unsynchronized_pool_resource resource;
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pointers[i] = Nz::PlacementNew(static_cast<Particle*>(resource.allocate(sizeof(Particle), alignof(Particle))), float(i));
+
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+		{
+			Nz::PlacementDestroy(pointers[i]);
+			resource.deallocate(pointers[i], sizeof(Particle), alignof(Particle));
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(pointers.front());
+	});
+#endif
+}
+
+void BenchFragmentation()
+{
+	constexpr std::size_t ChurnCount = ParticleCount / 2;
+
+	// Free a random half of the particles, then allocate as many again
+	std::mt19937 rand(42);
+	std::vector<std::size_t> freeOrder = ShuffledIndices(ParticleCount, rand);
+	freeOrder.resize(ChurnCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ChurnCount);
+	bench.unit("particle");
+	bench.title("Freeing 50k random particles out of 100k then reallocating them");
+
+	{
+		Nz::MemoryPool<Particle> pool(BlockSize);
+		std::vector<std::size_t> indices(ParticleCount);
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pool.Allocate(indices[i], float(i));
+
+		bench.run("Nz::MemoryPool", [&] {
+			for (std::size_t i : freeOrder)
+				pool.Free(indices[i]);
+
+			for (std::size_t i : freeOrder)
+				pool.Allocate(indices[i], float(i));
+
+			ankerl::nanobench::doNotOptimizeAway(indices.front());
+		});
+	}
+
+	{
+		std::vector<Particle*> pointers(ParticleCount);
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pointers[i] = new Particle(float(i));
+
+		bench.run("new/delete", [&] {
+			for (std::size_t i : freeOrder)
+				delete pointers[i];
+
+			for (std::size_t i : freeOrder)
+				pointers[i] = new Particle(float(i));
+
+			ankerl::nanobench::doNotOptimizeAway(pointers.front());
+		});
+
+		for (Particle* particle : pointers)
+			delete particle;
+	}
+
+#ifdef NAZARA_BENCH_PMR
+	{
+		std::pmr::unsynchronized_pool_resource resource;
+		std::vector<Particle*> pointers(ParticleCount);
+		for (std::size_t i = 0; i < ParticleCount; ++i)
+			pointers[i] = Nz::PlacementNew(static_cast<Particle*>(resource.allocate(sizeof(Particle), alignof(Particle))), float(i));
+
+		bench.run("std::pmr::unsynchronized_pool_resource", [&] {
+			for (std::size_t i : freeOrder)
+			{
+				Nz::PlacementDestroy(pointers[i]);
+				resource.deallocate(pointers[i], sizeof(Particle), alignof(Particle));
+			}
+
+			for (std::size_t i : freeOrder)
+				pointers[i] = Nz::PlacementNew(static_cast<Particle*>(resource.allocate(sizeof(Particle), alignof(Particle))), float(i));
+
+			ankerl::nanobench::doNotOptimizeAway(pointers.front());
+		});
+	}
+#endif
+}
+
+void BenchIteration(std::size_t liveParticlePercent)
+{
+	std::mt19937 rand(42);
+
+	Nz::MemoryPool<Particle> pool(BlockSize);
+	std::vector<std::size_t> indices(ParticleCount);
+	for (std::size_t i = 0; i < ParticleCount; ++i)
+		pool.Allocate(indices[i], float(i));
+
+	std::vector<std::size_t> freeOrder = ShuffledIndices(ParticleCount, rand);
+	freeOrder.resize(ParticleCount - ParticleCount * liveParticlePercent / 100);
+	for (std::size_t i : freeOrder)
+		pool.Free(indices[i]);
+
+	std::vector<Particle> vector(pool.GetAllocatedEntryCount(), Particle(0.f));
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(pool.GetAllocatedEntryCount());
+	bench.unit("particle");
+	bench.title("Updating particles of a pool with " + std::to_string(liveParticlePercent) + "% live entries");
+
+	bench.run("std::vector (baseline)", [&] {
+		for (Particle& particle : vector)
+			particle.x += particle.vx;
+
+		ankerl::nanobench::doNotOptimizeAway(vector.front().x);
+	});
+
+	bench.run("Nz::MemoryPool (iterator)", [&] {
+		for (Particle& particle : pool)
+			particle.x += particle.vx;
+
+		ankerl::nanobench::doNotOptimizeAway(pool.GetAllocatedEntryCount());
+	});
+
+	bench.run("Nz::MemoryPool (ForEach)", [&] {
+		pool.ForEach([](Particle& particle)
+		{
+			particle.x += particle.vx;
+		});
+
+		ankerl::nanobench::doNotOptimizeAway(pool.GetAllocatedEntryCount());
+	});
+}
+
+void BenchRetrieveEntryIndex(std::size_t blockSize)
+{
+	Nz::MemoryPool<Particle> pool(blockSize);
+	std::vector<Particle*> pointers(ParticleCount);
+	for (std::size_t i = 0; i < ParticleCount; ++i)
+	{
+		std::size_t index;
+		pointers[i] = pool.Allocate(index, float(i));
+	}
+
+	std::mt19937 rand(42);
+	std::shuffle(pointers.begin(), pointers.end(), rand);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ParticleCount);
+	bench.unit("lookup");
+	bench.title("RetrieveEntryIndex from random pointers (" + std::to_string(pool.GetBlockCount()) + " blocks)");
+
+	bench.run("Nz::MemoryPool::RetrieveEntryIndex", [&] {
+		std::size_t sum = 0;
+		for (const Particle* particle : pointers)
+			sum += pool.RetrieveEntryIndex(particle);
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+void BenchSerialization(std::size_t liveParticlePercent)
+{
+	std::mt19937 rand(42);
+
+	Nz::MemoryPool<Particle> pool(BlockSize);
+	std::vector<std::size_t> indices(ParticleCount);
+	for (std::size_t i = 0; i < ParticleCount; ++i)
+		pool.Allocate(indices[i], float(i));
+
+	std::vector<std::size_t> freeOrder = ShuffledIndices(ParticleCount, rand);
+	freeOrder.resize(ParticleCount - ParticleCount * liveParticlePercent / 100);
+	for (std::size_t i : freeOrder)
+		pool.Free(indices[i]);
+
+	std::vector<Nz::UInt8> buffer(std::max(pool.GetSerializedSize(), pool.GetAllocatedEntryCount() * (sizeof(Nz::UInt64) + sizeof(Particle))));
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(pool.GetAllocatedEntryCount());
+	bench.unit("particle");
+	bench.title("Saving and restoring a pool with " + std::to_string(liveParticlePercent) + "% live entries");
+
+	bench.run("Writing entries one by one (index + value)", [&] {
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+		for (auto it = pool.begin(); it != pool.end(); ++it)
+		{
+			writer.Write(Nz::UInt64(it.GetIndex()));
+			writer.WriteBytes(&*it, sizeof(Particle));
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(writer.GetCursor());
+	});
+
+	bench.run("Nz::MemoryPool::Serialize", [&] {
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+		pool.Serialize(writer);
+
+		ankerl::nanobench::doNotOptimizeAway(writer.GetCursor());
+	});
+
+	Nz::MemoryPool<Particle> restoredPool(BlockSize);
+	bench.run("Nz::MemoryPool::Deserialize", [&] {
+		Nz::ByteReader reader(buffer.data(), buffer.size());
+		restoredPool.Deserialize(reader);
+
+		ankerl::nanobench::doNotOptimizeAway(restoredPool.GetBlockCount());
+	});
+}
+
+int main()
+{
+	BenchSequential();
+	BenchFragmentation();
+
+	BenchIteration(100);
+	BenchIteration(50);
+	BenchIteration(10);
+
+	BenchRetrieveEntryIndex(1024);
+	BenchRetrieveEntryIndex(64);
+	BenchRetrieveEntryIndex(8);
+
+	BenchSerialization(100);
+	BenchSerialization(50);
+}
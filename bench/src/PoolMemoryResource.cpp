@@ -0,0 +1,146 @@
+#include <NazaraUtils/PoolMemoryResource.hpp>
+#include <nanobench.h>
+
+#ifdef NAZARA_HAS_MEMORY_RESOURCE
+
+#include <list>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t ElementCount = 10'000;
+
+template<typename F>
+void RunWithResources(ankerl::nanobench::Bench& bench, F&& func)
+{
+	bench.run("std::pmr::new_delete_resource", [&] {
+		func(std::pmr::new_delete_resource());
+	});
+
+	bench.run("std::pmr::unsynchronized_pool_resource", [&] {
+		std::pmr::unsynchronized_pool_resource resource;
+		func(&resource);
+	});
+
+	bench.run("std::pmr::synchronized_pool_resource", [&] {
+		std::pmr::synchronized_pool_resource resource;
+		func(&resource);
+	});
+
+	bench.run("Nz::PoolMemoryResource", [&] {
+		Nz::PoolMemoryResource resource;
+		func(&resource);
+	});
+
+	bench.run("Nz::PoolMemoryResource (thread cache)", [&] {
+		Nz::PoolMemoryResource resource(std::pmr::get_default_resource(), true);
+		func(&resource);
+	});
+}
+
+void BenchContainers()
+{
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<int> dis;
+
+	std::vector<int> keys(ElementCount);
+	for (int& key : keys)
+		key = dis(rand);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ElementCount);
+	bench.unit("element");
+
+	bench.title("std::pmr::list (push_back then clear)");
+	RunWithResources(bench, [&](std::pmr::memory_resource* resource)
+	{
+		std::pmr::list<int> list(resource);
+		for (int key : keys)
+			list.push_back(key);
+
+		ankerl::nanobench::doNotOptimizeAway(list.back());
+	});
+
+	bench.title("std::pmr::map (insert then erase)");
+	RunWithResources(bench, [&](std::pmr::memory_resource* resource)
+	{
+		std::pmr::map<int, std::pmr::string> map(resource);
+		for (int key : keys)
+			map.emplace(key, "a string long enough to be allocated");
+
+		for (int key : keys)
+			map.erase(key);
+
+		ankerl::nanobench::doNotOptimizeAway(map.size());
+	});
+}
+
+void BenchThreads()
+{
+	constexpr std::size_t ThreadCount = 4;
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(5);
+	bench.batch(ThreadCount * ElementCount);
+	bench.unit("element");
+	bench.title("std::pmr::list from " + std::to_string(ThreadCount) + " threads");
+
+	auto func = [&](std::pmr::memory_resource* resource)
+	{
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < ThreadCount; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (std::size_t j = 0; j < 10; ++j)
+				{
+					std::pmr::list<int> list(resource);
+					for (std::size_t k = 0; k < ElementCount / 10; ++k)
+						list.push_back(int(k));
+
+					ankerl::nanobench::doNotOptimizeAway(list.back());
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+	};
+
+	// std::pmr::unsynchronized_pool_resource can't be used from multiple threads
+	bench.run("std::pmr::new_delete_resource", [&] {
+		func(std::pmr::new_delete_resource());
+	});
+
+	bench.run("std::pmr::synchronized_pool_resource", [&] {
+		std::pmr::synchronized_pool_resource resource;
+		func(&resource);
+	});
+
+	bench.run("Nz::PoolMemoryResource", [&] {
+		Nz::PoolMemoryResource resource;
+		func(&resource);
+	});
+
+	bench.run("Nz::PoolMemoryResource (thread cache)", [&] {
+		Nz::PoolMemoryResource resource(std::pmr::get_default_resource(), true);
+		func(&resource);
+	});
+}
+
+int main()
+{
+	BenchContainers();
+	BenchThreads();
+}
+
+#else
+
+int main()
+{
+}
+
+#endif
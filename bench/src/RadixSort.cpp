@@ -0,0 +1,56 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <nanobench.h>
+
+template<typename K>
+void BenchSort(ankerl::nanobench::Bench& bench, const char* title, const std::vector<K>& source)
+{
+	std::vector<K> keys;
+
+	bench.batch(source.size());
+	bench.title(title);
+
+	bench.run("std::sort", [&] {
+		keys = source;
+		std::sort(keys.begin(), keys.end());
+		ankerl::nanobench::doNotOptimizeAway(keys.front());
+	});
+
+	bench.run("Nz::RadixSort", [&] {
+		keys = source;
+		auto scratch = NazaraArenaStackArrayNoInit(K, keys.size());
+		Nz::RadixSort(keys.data(), keys.size(), scratch.data());
+		ankerl::nanobench::doNotOptimizeAway(keys.front());
+	});
+}
+
+int main()
+{
+	std::mt19937_64 rand(42);
+
+	std::vector<Nz::UInt64> drawCallKeys(100'000);
+	for (Nz::UInt64& key : drawCallKeys)
+		key = (rand() % 16) << 56 | (rand() % 1024) << 32 | (rand() & 0xFFFFFFFF); //< layer, material, depth
+
+	std::vector<Nz::UInt32> entityIds(100'000);
+	for (Nz::UInt32& id : entityIds)
+		id = Nz::UInt32(rand() % 1'000'000);
+
+	std::vector<Nz::UInt32> smallArray(16);
+	for (Nz::UInt32& value : smallArray)
+		value = Nz::UInt32(rand());
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.unit("key");
+
+	BenchSort(bench, "Sorting 100k 64-bit draw call keys", drawCallKeys);
+	BenchSort(bench, "Sorting 100k 32-bit entity IDs", entityIds);
+
+	bench.minEpochIterations(10'000);
+	BenchSort(bench, "Sorting 16 32-bit keys", smallArray);
+}
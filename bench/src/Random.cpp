@@ -0,0 +1,51 @@
+#include <NazaraUtils/Random.hpp>
+#include <random>
+#include <nanobench.h>
+
+template<typename Rng>
+void BenchEngine(ankerl::nanobench::Bench& bench, const char* name)
+{
+	Rng rng;
+	bench.run(name, [&] {
+		ankerl::nanobench::doNotOptimizeAway(rng());
+	});
+}
+
+template<typename Rng>
+void BenchBounded(ankerl::nanobench::Bench& bench, const char* name)
+{
+	Rng rng;
+	bench.run(name, [&] {
+		ankerl::nanobench::doNotOptimizeAway(rng.Bounded(1000));
+	});
+}
+
+int main()
+{
+	{
+		ankerl::nanobench::Bench bench;
+		bench.title("Raw generation");
+
+		BenchEngine<std::minstd_rand>(bench, "std::minstd_rand");
+		BenchEngine<std::mt19937>(bench, "std::mt19937");
+		BenchEngine<std::mt19937_64>(bench, "std::mt19937_64");
+		BenchEngine<Nz::Pcg32>(bench, "Nz::Pcg32");
+		BenchEngine<Nz::WyRand>(bench, "Nz::WyRand");
+		BenchEngine<Nz::Xoshiro256StarStar>(bench, "Nz::Xoshiro256StarStar");
+	}
+
+	{
+		ankerl::nanobench::Bench bench;
+		bench.title("Integers in [0, 1000)");
+
+		std::mt19937 mt;
+		std::uniform_int_distribution<unsigned int> dis(0, 999);
+		bench.run("std::mt19937 + std::uniform_int_distribution", [&] {
+			ankerl::nanobench::doNotOptimizeAway(dis(mt));
+		});
+
+		BenchBounded<Nz::Pcg32>(bench, "Nz::Pcg32::Bounded");
+		BenchBounded<Nz::WyRand>(bench, "Nz::WyRand::Bounded");
+		BenchBounded<Nz::Xoshiro256StarStar>(bench, "Nz::Xoshiro256StarStar::Bounded");
+	}
+}
@@ -0,0 +1,218 @@
+#include <NazaraUtils/ConcurrentSignal.hpp>
+#include <NazaraUtils/EventBus.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <NazaraUtils/SignalQueue.hpp>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+struct Receiver
+{
+	void OnEvent(int value)
+	{
+		total += value;
+	}
+
+	int total = 0;
+};
+
+void TestEmission(std::size_t slotCount)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(slotCount);
+	bench.unit("slot call");
+	bench.title("Emitting to " + std::to_string(slotCount) + " slot(s)");
+
+	std::vector<Receiver> receivers(slotCount);
+
+	{
+		Nz::Signal<int> signal;
+		for (Receiver& receiver : receivers)
+			signal.Connect(receiver, &Receiver::OnEvent);
+
+		bench.run("Signal (member function slots)", [&] {
+			signal(1);
+		});
+	}
+
+	{
+		Nz::Signal<int> signal;
+		for (Receiver& receiver : receivers)
+			signal.Connect([&receiver](int value) { receiver.total += value; });
+
+		bench.run("Signal (lambda slots)", [&] {
+			signal(1);
+		});
+	}
+
+	{
+		Nz::ConcurrentSignal<int> signal;
+		for (Receiver& receiver : receivers)
+			signal.Connect(receiver, &Receiver::OnEvent);
+
+		bench.run("ConcurrentSignal (member function slots)", [&] {
+			signal(1);
+		});
+	}
+
+	{
+		Nz::SignalQueue<int> queue(1);
+		for (Receiver& receiver : receivers)
+			queue.Connect(receiver, &Receiver::OnEvent);
+
+		bench.run("SignalQueue (queue + flush)", [&] {
+			queue(1);
+			queue.Flush();
+		});
+	}
+
+	int total = 0;
+	for (const Receiver& receiver : receivers)
+		total += receiver.total;
+
+	ankerl::nanobench::doNotOptimizeAway(total);
+}
+
+void TestConnection()
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.title("Connecting and disconnecting slots");
+
+	Receiver receiver;
+
+	{
+		Nz::Signal<int> signal;
+		bench.run("Signal connect + disconnect (empty signal)", [&] {
+			signal.Connect(receiver, &Receiver::OnEvent).Disconnect();
+		});
+	}
+
+	{
+		Nz::Signal<int> signal;
+		std::vector<Nz::Signal<int>::ConnectionGuard> guards;
+		for (std::size_t i = 0; i < 1000; ++i)
+			guards.emplace_back(signal.Connect(receiver, &Receiver::OnEvent));
+
+		bench.run("Signal connect + disconnect (1000 slots)", [&] {
+			signal.Connect(receiver, &Receiver::OnEvent).Disconnect();
+		});
+
+		std::size_t index = 0;
+		bench.run("Signal churn (replacing one of 1000 slots)", [&] {
+			guards[index] = signal.Connect(receiver, &Receiver::OnEvent);
+			index = (index + 1) % guards.size();
+		});
+	}
+
+	{
+		Nz::ConcurrentSignal<int> signal;
+		std::vector<Nz::ConcurrentSignal<int>::ConnectionGuard> guards;
+		for (std::size_t i = 0; i < 10; ++i)
+			guards.emplace_back(signal.Connect(receiver, &Receiver::OnEvent));
+
+		bench.run("ConcurrentSignal connect + disconnect (10 slots)", [&] {
+			signal.Connect(receiver, &Receiver::OnEvent).Disconnect();
+		});
+	}
+
+	ankerl::nanobench::doNotOptimizeAway(receiver.total);
+}
+
+void TestDisconnectDuringEmission()
+{
+	constexpr std::size_t SlotCount = 100;
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.batch(SlotCount);
+	bench.unit("slot");
+	bench.title("Disconnecting during emission");
+
+	Receiver receiver;
+	Nz::Signal<int> signal;
+	std::vector<Nz::Signal<int>::Connection> connections(SlotCount);
+
+	bench.run("Signal (every slot disconnects itself)", [&] {
+		for (Nz::Signal<int>::Connection& connection : connections)
+		{
+			connection = signal.Connect([&connection, &receiver](int value)
+			{
+				receiver.total += value;
+				connection.Disconnect();
+			});
+		}
+
+		signal(1);
+	});
+
+	bench.run("Signal (first slot clears the signal)", [&] {
+		signal.Connect([&signal](int) { signal.Clear(); });
+		for (std::size_t i = 1; i < SlotCount; ++i)
+			signal.Connect(receiver, &Receiver::OnEvent);
+
+		signal(1);
+	});
+
+	ankerl::nanobench::doNotOptimizeAway(receiver.total);
+}
+
+void TestEventDispatch()
+{
+	struct DamageEvent { int amount; };
+	struct HealEvent { int amount; };
+	struct MessageEvent { const char* message; };
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.title("Dispatching typed events (1 handler)");
+
+	int total = 0;
+
+	{
+		// Type-erased dispatcher, as found in many event systems
+		std::unordered_map<std::type_index, std::vector<std::function<void(const void*)>>> handlers;
+		handlers[typeid(DamageEvent)].emplace_back([&](const void* event) { total += static_cast<const DamageEvent*>(event)->amount; });
+		handlers[typeid(HealEvent)].emplace_back([&](const void* event) { total -= static_cast<const HealEvent*>(event)->amount; });
+		handlers[typeid(MessageEvent)].emplace_back([&](const void*) {});
+
+		bench.run("std::type_index map of std::function", [&] {
+			DamageEvent event{ 1 };
+			for (auto& handler : handlers[typeid(DamageEvent)])
+				handler(&event);
+		});
+	}
+
+	{
+		Nz::EventBus<Nz::TypeList<DamageEvent, HealEvent, MessageEvent>> bus;
+		bus.Connect<DamageEvent>([&](const DamageEvent& event) { total += event.amount; });
+		bus.Connect<HealEvent>([&](const HealEvent& event) { total -= event.amount; });
+		bus.Connect<MessageEvent>([&](const MessageEvent&) {});
+
+		bench.run("EventBus::Publish", [&] {
+			bus.Publish(DamageEvent{ 1 });
+		});
+
+		bus.Reserve<DamageEvent>(1);
+		bench.run("EventBus (enqueue + flush)", [&] {
+			bus.Enqueue<DamageEvent>(DamageEvent{ 1 });
+			bus.Flush();
+		});
+	}
+
+	ankerl::nanobench::doNotOptimizeAway(total);
+}
+
+int main()
+{
+	for (std::size_t slotCount : { 1, 10, 1000 })
+		TestEmission(slotCount);
+
+	TestConnection();
+	TestDisconnectDuringEmission();
+	TestEventDispatch();
+}
@@ -0,0 +1,59 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/SlotMap.hpp>
+#include <random>
+#include <vector>
+#include <nanobench.h>
+
+struct Transform
+{
+	float x, y, z;
+	float vx, vy, vz;
+};
+
+int main()
+{
+	constexpr std::size_t EntityCount = 100'000;
+
+	Nz::MemoryPool<Transform> pool(1024);
+	Nz::SlotMap<Transform> slotMap;
+
+	std::vector<std::size_t> poolIndices(EntityCount);
+	std::vector<Nz::SlotMap<Transform>::Key> slotMapKeys(EntityCount);
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		pool.Allocate(poolIndices[i], Transform{ 0.f, 0.f, 0.f, 1.f, 1.f, 1.f });
+		slotMapKeys[i] = slotMap.Insert(Transform{ 0.f, 0.f, 0.f, 1.f, 1.f, 1.f });
+	}
+
+	// Erase half of the entities randomly, leaving holes in the pool
+	std::mt19937 rand(42);
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		if (rand() % 2 == 0)
+		{
+			pool.Free(poolIndices[i]);
+			slotMap.Erase(slotMapKeys[i]);
+		}
+	}
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(slotMap.GetSize());
+	bench.unit("entity");
+	bench.title("Updating 50k live entities out of 100k");
+
+	bench.run("Nz::MemoryPool", [&] {
+		for (Transform& transform : pool)
+			transform.x += transform.vx;
+
+		ankerl::nanobench::doNotOptimizeAway((*pool.begin()).x);
+	});
+
+	bench.run("Nz::SlotMap", [&] {
+		for (Transform& transform : slotMap)
+			transform.x += transform.vx;
+
+		ankerl::nanobench::doNotOptimizeAway(slotMap.GetData()->x);
+	});
+}
@@ -0,0 +1,78 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/SmallVector.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+template<typename Vector>
+void BenchVector(ankerl::nanobench::Bench& bench, const char* name, const std::vector<std::size_t>& sizes)
+{
+	bench.run(name, [&] {
+		std::size_t sum = 0;
+		for (std::size_t size : sizes)
+		{
+			Vector vec;
+			for (std::size_t i = 0; i < size; ++i)
+				vec.push_back(Nz::UInt32(i));
+
+			sum += vec.back();
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+void TestPushBack(std::size_t bigListFrequency)
+{
+	// "usually 4, sometimes 200"
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<std::size_t> smallDis(1, 4);
+	std::uniform_int_distribution<std::size_t> bigDis(0, bigListFrequency - 1);
+
+	std::vector<std::size_t> sizes(10'000);
+	for (std::size_t& size : sizes)
+		size = (bigDis(rand) == 0) ? 200 : smallDis(rand);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(sizes.size());
+	bench.unit("vector");
+	bench.title("Building small vectors (1 in " + std::to_string(bigListFrequency) + " has 200 elements)");
+
+	BenchVector<std::vector<Nz::UInt32>>(bench, "std::vector", sizes);
+	BenchVector<Nz::SmallVector<Nz::UInt32, 4>>(bench, "Nz::SmallVector<4>", sizes);
+	BenchVector<Nz::SmallVector<Nz::UInt32, 16>>(bench, "Nz::SmallVector<16>", sizes);
+}
+
+void TestInsertErase()
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100);
+	bench.title("Inserting and erasing at the front of 64 strings");
+
+	auto Run = [&](const char* name, auto vec)
+	{
+		for (std::size_t i = 0; i < 64; ++i)
+			vec.emplace_back(32, char('a' + i % 26));
+
+		bench.run(name, [&] {
+			vec.insert(vec.begin(), std::string(32, 'z'));
+			vec.erase(vec.begin());
+
+			ankerl::nanobench::doNotOptimizeAway(vec.front());
+		});
+	};
+
+	// std::string isn't trivially relocatable, move assignments (std::vector) versus move constructions (Nz::SmallVector)
+	Run("std::vector<std::string>", std::vector<std::string>{});
+	Run("Nz::SmallVector<std::string, 64>", Nz::SmallVector<std::string, 64>{});
+}
+
+int main()
+{
+	for (std::size_t frequency : { 1'000, 10 })
+		TestPushBack(frequency);
+
+	TestInsertErase();
+}
@@ -0,0 +1,50 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/SoAVector.hpp>
+#include <vector>
+#include <nanobench.h>
+
+struct Particle
+{
+	float x, y, z;
+	float vx, vy, vz;
+	Nz::UInt32 color;
+	Nz::UInt32 lifetime;
+};
+
+int main()
+{
+	constexpr std::size_t ParticleCount = 100'000;
+
+	std::vector<Particle> aos(ParticleCount);
+	Nz::SoAVector<Nz::TypeList<float, float, float, float, float, float, Nz::UInt32, Nz::UInt32>> soa;
+	soa.resize(ParticleCount);
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(ParticleCount);
+	bench.unit("particle");
+	bench.title("Updating one field of 100k particles");
+
+	bench.run("std::vector<Particle>", [&] {
+		for (Particle& particle : aos)
+			particle.x += particle.vx;
+
+		ankerl::nanobench::doNotOptimizeAway(aos.front().x);
+	});
+
+	bench.run("Nz::SoAVector (columns)", [&] {
+		auto x = soa.column<0>();
+		auto vx = soa.column<3>();
+		for (std::size_t i = 0; i < x.size(); ++i)
+			x[i] += vx[i];
+
+		ankerl::nanobench::doNotOptimizeAway(x.front());
+	});
+
+	bench.run("Nz::SoAVector (zip iterator)", [&] {
+		for (auto&& [x, y, z, vx, vy, vz, color, lifetime] : soa)
+			x += vx;
+
+		ankerl::nanobench::doNotOptimizeAway(soa.column<0>().front());
+	});
+}
@@ -0,0 +1,67 @@
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/SparsePtr.hpp>
+#include <NazaraUtils/StaticSparsePtr.hpp>
+#include <vector>
+#include <nanobench.h>
+
+struct Vertex
+{
+	float position[3];
+	float normal[3];
+	float uv[2];
+};
+
+template<std::size_t AttributeCount>
+struct FloatVertex
+{
+	float attributes[AttributeCount];
+};
+
+template<typename V>
+void BenchGather(const char* title)
+{
+	constexpr std::size_t VertexCount = 100'000;
+
+	std::vector<V> vertices(VertexCount);
+	std::vector<float> output(VertexCount);
+
+	Nz::SparsePtr<const float> ptr(&vertices[0], sizeof(V));
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(VertexCount);
+	bench.unit("vertex");
+	bench.title(title);
+
+	bench.run("operator[]", [&] {
+		for (std::size_t i = 0; i < VertexCount; ++i)
+			output[i] = ptr[i];
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Nz::StaticSparsePtr::operator[]", [&] {
+		Nz::StaticSparsePtr<const float, sizeof(V)> staticPtr(ptr);
+		for (std::size_t i = 0; i < VertexCount; ++i)
+			output[i] = staticPtr[i];
+
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Nz::CopyTo", [&] {
+		Nz::CopyTo(ptr, output.data(), VertexCount);
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+
+	bench.run("Nz::Transform", [&] {
+		Nz::Transform(ptr, output.data(), VertexCount, [](float value) { return value * 2.f; });
+		ankerl::nanobench::doNotOptimizeAway(output.data());
+	});
+}
+
+int main()
+{
+	BenchGather<FloatVertex<2>>("Gathering one float out of 2");
+	BenchGather<FloatVertex<4>>("Gathering one float out of 4");
+	BenchGather<Vertex>("Gathering one float out of 8 (runtime stride)");
+}
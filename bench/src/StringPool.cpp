@@ -0,0 +1,72 @@
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/StringPool.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+int main()
+{
+	constexpr std::size_t NameCount = 512;
+	constexpr std::size_t LookupCount = 10'000;
+
+	std::vector<std::string> names;
+	for (std::size_t i = 0; i < NameCount; ++i)
+		names.push_back("assets/materials/common/material_" + std::to_string(i) + ".nzmat");
+
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<std::size_t> dis(0, NameCount - 1);
+
+	std::vector<std::string> strings;
+	std::vector<Nz::InternedString> interned;
+	Nz::StringPool pool;
+	for (std::size_t i = 0; i < LookupCount; ++i)
+	{
+		const std::string& name = names[dis(rng)];
+		strings.push_back(name);
+		interned.push_back(pool.Intern(name));
+	}
+
+	Nz::FlatHashMap<std::string, std::size_t> stringMap;
+	Nz::FlatHashMap<Nz::InternedString, std::size_t> internedMap;
+	for (std::size_t i = 0; i < NameCount; ++i)
+	{
+		stringMap[names[i]] = i;
+		internedMap[pool.Intern(names[i])] = i;
+	}
+
+	ankerl::nanobench::Bench bench;
+	bench.title("String keys");
+	bench.batch(LookupCount);
+
+	bench.run("std::string equality", [&] {
+		std::size_t equalCount = 0;
+		for (std::size_t i = 1; i < strings.size(); ++i)
+			equalCount += (strings[i] == strings[i - 1]);
+
+		ankerl::nanobench::doNotOptimizeAway(equalCount);
+	});
+
+	bench.run("Nz::InternedString equality", [&] {
+		std::size_t equalCount = 0;
+		for (std::size_t i = 1; i < interned.size(); ++i)
+			equalCount += (interned[i] == interned[i - 1]);
+
+		ankerl::nanobench::doNotOptimizeAway(equalCount);
+	});
+
+	bench.run("std::string map lookup", [&] {
+		for (const std::string& str : strings)
+			ankerl::nanobench::doNotOptimizeAway(stringMap.find(str)->second);
+	});
+
+	bench.run("Nz::InternedString map lookup", [&] {
+		for (const Nz::InternedString& str : interned)
+			ankerl::nanobench::doNotOptimizeAway(internedMap.find(str)->second);
+	});
+
+	bench.run("Nz::StringPool::Intern (existing)", [&] {
+		for (const std::string& str : strings)
+			ankerl::nanobench::doNotOptimizeAway(pool.Intern(str));
+	});
+}
@@ -0,0 +1,65 @@
+#include <NazaraUtils/StringUtils.hpp>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nanobench.h>
+
+void TestUtf8(const std::string& title, const std::string& text)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.batch(text.size());
+	bench.unit("byte");
+	bench.title(title + " (" + std::to_string(text.size()) + " bytes)");
+
+	const Nz::UInt8* data = reinterpret_cast<const Nz::UInt8*>(text.data());
+
+	bench.run("validation (scalar)", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::Detail::ScalarValidateUtf8(data, text.size()));
+	});
+
+	bench.run("validation", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::IsValidUtf8(text));
+	});
+
+	std::vector<char16_t> utf16(text.size());
+	bench.run("UTF-8 to UTF-16 (scalar)", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::Detail::ScalarUtf8ToUtf16(data, text.size(), utf16.data()));
+	});
+
+	bench.run("UTF-8 to UTF-16", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::Utf8ToUtf16(text, utf16.data()));
+	});
+
+	std::vector<char32_t> utf32(text.size());
+	bench.run("UTF-8 to UTF-32", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::Utf8ToUtf32(text, utf32.data()));
+	});
+
+	std::u16string_view utf16View(utf16.data(), *Nz::Utf8ToUtf16(text, utf16.data()));
+	std::vector<char> utf8(utf16View.size() * 3);
+	bench.run("UTF-16 to UTF-8", [&] {
+		ankerl::nanobench::doNotOptimizeAway(Nz::Utf16ToUtf8(utf16View, utf8.data()));
+	});
+}
+
+int main()
+{
+	std::minstd_rand gen(std::random_device{}());
+
+	const std::string_view words[] = { "lorem ", "ipsum ", "dolor ", "sit ", "amet ", "\xC3\xA9t\xC3\xA9 ", "\xE2\x82\xAC ", "\xE6\x97\xA5\xE6\x9C\xAC ", "\xF0\x9F\x98\x80 " };
+
+	std::string ascii;
+	std::string mixed;
+	std::uniform_int_distribution<std::size_t> asciiDis(0, 4);
+	std::uniform_int_distribution<std::size_t> mixedDis(0, std::size(words) - 1);
+	while (mixed.size() < 64 * 1024)
+	{
+		ascii += words[asciiDis(gen)];
+		mixed += words[mixedDis(gen)];
+	}
+
+	TestUtf8("ASCII text", ascii);
+	TestUtf8("Mixed text", mixed);
+}
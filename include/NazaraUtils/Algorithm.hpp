@@ -11,6 +11,7 @@
 #include <NazaraUtils/ConstantEvaluated.hpp>
 #include <NazaraUtils/TypeTraits.hpp>
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -43,6 +44,9 @@ namespace Nz
 	template<std::size_t N> [[nodiscard]] constexpr std::size_t CountOf(const char(&str)[N]) noexcept;
 	template<typename P, typename T> [[nodiscard]] NAZARA_CONSTEXPR_BITCAST P IntegerToPointer(T ptrAsInt) noexcept;
 	template<typename T, typename P> [[nodiscard]] NAZARA_CONSTEXPR_BITCAST T PointerToInteger(P* ptr) noexcept;
+	template<typename K> void RadixSort(K* keys, std::size_t count, K* scratchKeys);
+	template<typename K, typename V> void RadixSort(K* keys, V* values, std::size_t count, K* scratchKeys, V* scratchValues);
+	template<typename T, typename F> void RadixSort(T* elements, std::size_t count, T* scratchElements, F&& keyExtractor);
 	template<typename M, typename T> [[nodiscard]] auto& Retrieve(M& map, const T& key) noexcept;
 	template<typename M, typename T> [[nodiscard]] const auto& Retrieve(const M& map, const T& key) noexcept;
 	template<typename To, typename From> [[nodiscard]] To SafeCast(From&& value) noexcept;
@@ -3,7 +3,11 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <NazaraUtils/Algorithm.hpp>
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <limits>
+#include <utility>
 
 #ifdef NAZARA_HAS_CONSTEXPR_BITCAST_STD
 #include <bit>
@@ -54,6 +58,200 @@ namespace Nz
 			private:
 				From m_from;
 		};
+
+		// Maps a sort key to an unsigned integer of the same size, preserving its ordering
+		template<typename K, typename = void>
+		struct RadixSortKey
+		{
+			static_assert(AlwaysFalse<K>(), "radix sort keys must be integers, enums or floating-point values");
+		};
+
+		template<typename K>
+		struct RadixSortKey<K, std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>>>
+		{
+			using Type = std::make_unsigned_t<K>;
+
+			static constexpr Type Convert(K key)
+			{
+				if constexpr (std::is_signed_v<K>)
+					return static_cast<Type>(static_cast<Type>(key) ^ (Type(1) << (sizeof(Type) * 8 - 1))); //< flip sign bit
+				else
+					return key;
+			}
+		};
+
+		template<typename K>
+		struct RadixSortKey<K, std::enable_if_t<std::is_enum_v<K>>>
+		{
+			using Type = typename RadixSortKey<std::underlying_type_t<K>>::Type;
+
+			static constexpr Type Convert(K key)
+			{
+				return RadixSortKey<std::underlying_type_t<K>>::Convert(static_cast<std::underlying_type_t<K>>(key));
+			}
+		};
+
+		template<typename K>
+		struct RadixSortKey<K, std::enable_if_t<std::is_floating_point_v<K>>>
+		{
+			static_assert(sizeof(K) == sizeof(UInt32) || sizeof(K) == sizeof(UInt64), "unsupported floating-point type");
+
+			using Type = std::conditional_t<sizeof(K) == sizeof(UInt32), UInt32, UInt64>;
+
+			static Type Convert(K key)
+			{
+				// Negative values get all their bits flipped (to reverse their order), positive values only their sign bit
+				constexpr Type signBit = Type(1) << (sizeof(Type) * 8 - 1);
+
+				Type bits = BitCast<Type>(key);
+				Type mask = static_cast<Type>(Type(0) - (bits >> (sizeof(Type) * 8 - 1))) | signBit;
+				return bits ^ mask;
+			}
+		};
+
+		// Comparators of Batcher's odd-even merge sort network for 16 elements (comparators past the array size are skipped)
+		struct SortingNetworkComparator
+		{
+			UInt8 first;
+			UInt8 second;
+		};
+
+		constexpr std::size_t SortingNetworkSize = 16;
+
+		template<typename F>
+		constexpr void ForEachSortingNetworkComparator(F&& callback)
+		{
+			constexpr std::size_t n = SortingNetworkSize;
+			for (std::size_t p = 1; p < n; p *= 2)
+			{
+				for (std::size_t k = p; k >= 1; k /= 2)
+				{
+					for (std::size_t j = k % p; j + k < n; j += 2 * k)
+					{
+						for (std::size_t i = 0; i < k && i + j + k < n; ++i)
+						{
+							if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+								callback(i + j, i + j + k);
+						}
+					}
+				}
+			}
+		}
+
+		constexpr std::size_t CountSortingNetworkComparators()
+		{
+			std::size_t count = 0;
+			ForEachSortingNetworkComparator([&](std::size_t, std::size_t) { count++; });
+
+			return count;
+		}
+
+		constexpr auto BuildSortingNetwork()
+		{
+			std::array<SortingNetworkComparator, CountSortingNetworkComparators()> comparators = {};
+
+			std::size_t index = 0;
+			ForEachSortingNetworkComparator([&](std::size_t first, std::size_t second)
+			{
+				comparators[index++] = { static_cast<UInt8>(first), static_cast<UInt8>(second) };
+			});
+
+			return comparators;
+		}
+
+		constexpr auto SortingNetwork = BuildSortingNetwork();
+
+		template<typename K>
+		void SortingNetworkSort(K* keys, std::size_t count)
+		{
+			using KeyTraits = RadixSortKey<K>;
+
+			assert(count <= SortingNetworkSize);
+			for (const SortingNetworkComparator& comparator : SortingNetwork)
+			{
+				if (comparator.second >= count)
+					continue;
+
+				// Branchless compare-exchange (compiles to conditional moves)
+				K first = keys[comparator.first];
+				K second = keys[comparator.second];
+				bool swap = KeyTraits::Convert(second) < KeyTraits::Convert(first);
+				keys[comparator.first] = (swap) ? second : first;
+				keys[comparator.second] = (swap) ? first : second;
+			}
+		}
+
+		// Stable sort of small arrays, used when values are attached to keys
+		template<typename GetKey, typename Move>
+		void RadixInsertionSort(std::size_t count, GetKey&& getKey, Move&& move)
+		{
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				auto key = getKey(i);
+
+				std::size_t j = i;
+				while (j > 0 && key < getKey(j - 1))
+					--j;
+
+				if (j != i)
+					move(i, j);
+			}
+		}
+
+		/*
+		* LSD radix sort passes: getKey(i) returns the unsigned key of the i-th element of the current buffer,
+		* scatter(i, j) copies the i-th element of the current buffer to the j-th position of the other buffer and swapBuffers() swaps them.
+		* Returns the number of passes done, the sorted elements are in the scratch buffer if it's odd.
+		*/
+		template<typename U, typename GetKey, typename Scatter, typename SwapBuffers>
+		std::size_t RadixSortPasses(std::size_t count, GetKey&& getKey, Scatter&& scatter, SwapBuffers&& swapBuffers)
+		{
+			// 11 bits digits take three passes for 32 bits keys, other key sizes use bytes
+			constexpr std::size_t DigitBits = (sizeof(U) == sizeof(UInt32)) ? 11 : 8;
+			constexpr std::size_t DigitCount = (sizeof(U) * 8 + DigitBits - 1) / DigitBits;
+			constexpr std::size_t BucketCount = std::size_t(1) << DigitBits;
+			constexpr U DigitMask = static_cast<U>(BucketCount - 1);
+
+			assert(count <= std::numeric_limits<UInt32>::max());
+
+			// Build the histogram of every digit in a single read
+			std::array<std::array<UInt32, BucketCount>, DigitCount> histograms = {};
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				U key = getKey(i);
+				for (std::size_t digit = 0; digit < DigitCount; ++digit)
+					histograms[digit][(key >> (digit * DigitBits)) & DigitMask]++;
+			}
+
+			U firstKey = getKey(0);
+
+			std::size_t passCount = 0;
+			for (std::size_t digit = 0; digit < DigitCount; ++digit)
+			{
+				std::size_t shift = digit * DigitBits;
+
+				// Every element has the same digit, the pass would not change anything
+				auto& histogram = histograms[digit];
+				if (histogram[(firstKey >> shift) & DigitMask] == count)
+					continue;
+
+				UInt32 offset = 0;
+				for (UInt32& bucket : histogram)
+				{
+					UInt32 bucketSize = bucket;
+					bucket = offset;
+					offset += bucketSize;
+				}
+
+				for (std::size_t i = 0; i < count; ++i)
+					scatter(i, histogram[(getKey(i) >> shift) & DigitMask]++);
+
+				swapBuffers();
+				passCount++;
+			}
+
+			return passCount;
+		}
 	}
 
 
@@ -161,6 +359,144 @@ namespace Nz
 		return SafeCast<T>(BitCast<std::uintptr_t>(ptr));
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Sorts keys in ascending order using a LSD radix sort
+	*
+	* \param keys Keys to sort
+	* \param count Number of keys
+	* \param scratchKeys Memory for count keys used during the sort (can be a StackArray or arena memory to avoid any heap allocation)
+	*
+	* \remark Keys can be integers, enums or floating-point values (-0.0 is ordered before +0.0, and NaN values are ordered after infinities according to their sign)
+	* \remark Arrays of up to 16 keys are sorted by a sorting network
+	* \remark Passes over digits having the same value for every key are skipped
+	*/
+	template<typename K>
+	void RadixSort(K* keys, std::size_t count, K* scratchKeys)
+	{
+		using KeyTraits = Detail::RadixSortKey<K>;
+
+		if (count <= Detail::SortingNetworkSize)
+			return Detail::SortingNetworkSort(keys, count);
+
+		K* source = keys;
+		K* destination = scratchKeys;
+
+		std::size_t passCount = Detail::RadixSortPasses<typename KeyTraits::Type>(count,
+			[&](std::size_t i) { return KeyTraits::Convert(source[i]); },
+			[&](std::size_t from, std::size_t to) { destination[to] = source[from]; },
+			[&] { std::swap(source, destination); }
+		);
+
+		if (passCount % 2 != 0)
+			std::copy(scratchKeys, scratchKeys + count, keys);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Sorts keys in ascending order along with their values using a stable LSD radix sort
+	*
+	* \param keys Keys to sort
+	* \param values Values associated with the keys, reordered the same way
+	* \param count Number of keys and values
+	* \param scratchKeys Memory for count keys used during the sort
+	* \param scratchValues Memory for count values used during the sort
+	*
+	* \remark Values must be trivially copyable
+	* \remark Arrays of up to 16 keys are sorted by insertion, as sorting networks aren't stable
+	*
+	* \see RadixSort
+	*/
+	template<typename K, typename V>
+	void RadixSort(K* keys, V* values, std::size_t count, K* scratchKeys, V* scratchValues)
+	{
+		static_assert(std::is_trivially_copyable_v<V>, "radix sort values must be trivially copyable");
+
+		using KeyTraits = Detail::RadixSortKey<K>;
+
+		if (count <= Detail::SortingNetworkSize)
+		{
+			return Detail::RadixInsertionSort(count, [&](std::size_t i) { return KeyTraits::Convert(keys[i]); }, [&](std::size_t from, std::size_t to)
+			{
+				K key = keys[from];
+				V value = values[from];
+				std::copy_backward(keys + to, keys + from, keys + from + 1);
+				std::copy_backward(values + to, values + from, values + from + 1);
+				keys[to] = key;
+				values[to] = value;
+			});
+		}
+
+		K* sourceKeys = keys;
+		V* sourceValues = values;
+		K* destinationKeys = scratchKeys;
+		V* destinationValues = scratchValues;
+
+		std::size_t passCount = Detail::RadixSortPasses<typename KeyTraits::Type>(count,
+			[&](std::size_t i) { return KeyTraits::Convert(sourceKeys[i]); },
+			[&](std::size_t from, std::size_t to)
+			{
+				destinationKeys[to] = sourceKeys[from];
+				destinationValues[to] = sourceValues[from];
+			},
+			[&]
+			{
+				std::swap(sourceKeys, destinationKeys);
+				std::swap(sourceValues, destinationValues);
+			}
+		);
+
+		if (passCount % 2 != 0)
+		{
+			std::copy(scratchKeys, scratchKeys + count, keys);
+			std::copy(scratchValues, scratchValues + count, values);
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Sorts elements in ascending order of a key using a stable LSD radix sort
+	*
+	* \param elements Elements to sort
+	* \param count Number of elements
+	* \param scratchElements Memory for count elements used during the sort
+	* \param keyExtractor Callable returning the sort key of an element (called as keyExtractor(element)), once per element and per pass
+	*
+	* \remark Elements must be trivially copyable
+	* \remark Arrays of up to 16 elements are sorted by insertion, as sorting networks aren't stable
+	*
+	* \see RadixSort
+	*/
+	template<typename T, typename F>
+	void RadixSort(T* elements, std::size_t count, T* scratchElements, F&& keyExtractor)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "radix sort elements must be trivially copyable");
+
+		using KeyTraits = Detail::RadixSortKey<std::decay_t<decltype(keyExtractor(*elements))>>;
+
+		if (count <= Detail::SortingNetworkSize)
+		{
+			return Detail::RadixInsertionSort(count, [&](std::size_t i) { return KeyTraits::Convert(keyExtractor(elements[i])); }, [&](std::size_t from, std::size_t to)
+			{
+				T element = elements[from];
+				std::copy_backward(elements + to, elements + from, elements + from + 1);
+				elements[to] = element;
+			});
+		}
+
+		T* source = elements;
+		T* destination = scratchElements;
+
+		std::size_t passCount = Detail::RadixSortPasses<typename KeyTraits::Type>(count,
+			[&](std::size_t i) { return KeyTraits::Convert(keyExtractor(source[i])); },
+			[&](std::size_t from, std::size_t to) { destination[to] = source[from]; },
+			[&] { std::swap(source, destination); }
+		);
+
+		if (passCount % 2 != 0)
+			std::copy(scratchElements, scratchElements + count, elements);
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Helper function to retrieve a key in a map which has to exist
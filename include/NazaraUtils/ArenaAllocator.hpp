@@ -0,0 +1,109 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_ARENAALLOCATOR_HPP
+#define NAZARAUTILS_ARENAALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	class ArenaAllocator
+	{
+		struct Chunk;
+
+		public:
+			struct Marker
+			{
+				Chunk* chunk;
+				UInt8* current;
+				std::size_t liveAllocationCount;
+			};
+
+			inline explicit ArenaAllocator(std::size_t chunkSize = DefaultChunkSize);
+			ArenaAllocator(const ArenaAllocator&) = delete;
+			inline ArenaAllocator(ArenaAllocator&& arena) noexcept;
+			inline ~ArenaAllocator();
+
+			inline void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+			template<typename T> T* Allocate(std::size_t count);
+
+			inline void Deallocate(void* ptr, std::size_t size) noexcept;
+
+			inline std::size_t GetAllocatedSize() const noexcept;
+			inline std::size_t GetLiveAllocationCount() const noexcept;
+
+			inline Marker Mark() const noexcept;
+
+			inline void Release() noexcept;
+
+			inline void Rewind(const Marker& marker) noexcept;
+
+			ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+			inline ArenaAllocator& operator=(ArenaAllocator&& arena) noexcept;
+
+			static inline ArenaAllocator& GetThreadLocal();
+
+			static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+		private:
+			inline void* AllocateFromNextChunk(std::size_t size, std::size_t alignment);
+			inline void FreeChunksAfter(Chunk* chunk) noexcept;
+			inline void RewindToStart() noexcept;
+
+			struct alignas(std::max_align_t) Chunk
+			{
+				Chunk* next;
+				std::size_t size;
+
+				UInt8* GetBegin() noexcept { return reinterpret_cast<UInt8*>(this + 1); }
+				UInt8* GetEnd() noexcept { return GetBegin() + size; }
+			};
+
+			Chunk* m_firstChunk;
+			Chunk* m_currentChunk;
+			UInt8* m_current;
+			UInt8* m_end;
+			std::size_t m_allocatedSize;
+			std::size_t m_chunkSize;
+			std::size_t m_liveAllocationCount;
+	};
+
+	template<typename T>
+	class ArenaStlAllocator
+	{
+		template<typename U> friend class ArenaStlAllocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+			using is_always_equal = std::false_type;
+
+			ArenaStlAllocator() noexcept;
+			explicit ArenaStlAllocator(ArenaAllocator& arena) noexcept;
+			template<typename U> ArenaStlAllocator(const ArenaStlAllocator<U>& allocator) noexcept;
+
+			T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			ArenaAllocator& GetArena() const noexcept;
+
+			template<typename U> bool operator==(const ArenaStlAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const ArenaStlAllocator<U>& allocator) const noexcept;
+
+		private:
+			ArenaAllocator* m_arena;
+	};
+}
+
+#include <NazaraUtils/ArenaAllocator.inl>
+
+#endif // NAZARAUTILS_ARENAALLOCATOR_HPP
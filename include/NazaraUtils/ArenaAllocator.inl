@@ -0,0 +1,330 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ArenaAllocator
+	* \brief Monotonic allocator, carving allocations out of big chunks of memory which are kept for reuse
+	*
+	* Allocating is a pointer bump, and memory is reclaimed in three ways:
+	* - deallocating the most recent allocation gives its memory back immediately (temporary buffers are usually freed in reverse order)
+	* - deallocating the last live allocation rewinds the whole arena
+	* - Rewind gives back everything allocated since a Mark (allocations made after the mark must not be used nor deallocated afterwards)
+	*
+	* Other deallocations are no-op until one of these happens, which makes this allocator best suited to short-lived allocations.
+	*
+	* \remark An arena is not thread-safe, GetThreadLocal returns an arena per thread (used by NazaraStackArray/NazaraStackVector when alloca is not supported)
+	*/
+
+	/*!
+	* \brief Constructs an arena without allocating memory
+	*
+	* \param chunkSize Size of the first chunk of memory, which is allocated on first use (following chunks double in size)
+	*/
+	inline ArenaAllocator::ArenaAllocator(std::size_t chunkSize) :
+	m_firstChunk(nullptr),
+	m_currentChunk(nullptr),
+	m_current(nullptr),
+	m_end(nullptr),
+	m_allocatedSize(0),
+	m_chunkSize(std::max<std::size_t>(chunkSize, 64)),
+	m_liveAllocationCount(0)
+	{
+	}
+
+	inline ArenaAllocator::ArenaAllocator(ArenaAllocator&& arena) noexcept :
+	m_firstChunk(std::exchange(arena.m_firstChunk, nullptr)),
+	m_currentChunk(std::exchange(arena.m_currentChunk, nullptr)),
+	m_current(std::exchange(arena.m_current, nullptr)),
+	m_end(std::exchange(arena.m_end, nullptr)),
+	m_allocatedSize(std::exchange(arena.m_allocatedSize, 0)),
+	m_chunkSize(arena.m_chunkSize),
+	m_liveAllocationCount(std::exchange(arena.m_liveAllocationCount, 0))
+	{
+	}
+
+	inline ArenaAllocator::~ArenaAllocator()
+	{
+		Release();
+	}
+
+	/*!
+	* \brief Allocates memory from the arena
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the allocation in bytes
+	* \param alignment Alignment of the allocation, must be a power of two
+	*/
+	inline void* ArenaAllocator::Allocate(std::size_t size, std::size_t alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		std::uintptr_t current = reinterpret_cast<std::uintptr_t>(m_current);
+		std::uintptr_t aligned = (current + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+		std::uintptr_t end = reinterpret_cast<std::uintptr_t>(m_end);
+		if NAZARA_LIKELY(m_current && aligned <= end && size <= end - aligned)
+		{
+			UInt8* ptr = m_current + (aligned - current);
+			m_current = ptr + size;
+			m_liveAllocationCount++;
+
+			return ptr;
+		}
+
+		return AllocateFromNextChunk(size, alignment);
+	}
+
+	template<typename T>
+	T* ArenaAllocator::Allocate(std::size_t count)
+	{
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/*!
+	* \brief Gives back an allocation to the arena
+	*
+	* \param ptr Pointer returned by Allocate
+	* \param size Size of the allocation, as passed to Allocate
+	*
+	* \remark Memory is only reused right away if this is the last allocation, or if it was the last live allocation
+	*/
+	inline void ArenaAllocator::Deallocate(void* ptr, std::size_t size) noexcept
+	{
+		assert(m_liveAllocationCount > 0);
+		if (--m_liveAllocationCount == 0)
+		{
+			RewindToStart();
+			return;
+		}
+
+		UInt8* bytePtr = static_cast<UInt8*>(ptr);
+		if (bytePtr && bytePtr + size == m_current)
+			m_current = bytePtr;
+	}
+
+	/*!
+	* \brief Returns the size of the memory chunks owned by the arena
+	*/
+	inline std::size_t ArenaAllocator::GetAllocatedSize() const noexcept
+	{
+		return m_allocatedSize;
+	}
+
+	inline std::size_t ArenaAllocator::GetLiveAllocationCount() const noexcept
+	{
+		return m_liveAllocationCount;
+	}
+
+	/*!
+	* \brief Saves the current state of the arena, to rewind it later
+	* \return Marker to pass to Rewind
+	*/
+	inline auto ArenaAllocator::Mark() const noexcept -> Marker
+	{
+		return Marker{ m_currentChunk, m_current, m_liveAllocationCount };
+	}
+
+	/*!
+	* \brief Frees every chunk of memory
+	*
+	* \remark Every allocation and marker is invalidated
+	*/
+	inline void ArenaAllocator::Release() noexcept
+	{
+		FreeChunksAfter(nullptr);
+
+		m_firstChunk = nullptr;
+		m_currentChunk = nullptr;
+		m_current = nullptr;
+		m_end = nullptr;
+		m_liveAllocationCount = 0;
+	}
+
+	/*!
+	* \brief Gives back every allocation made since the marker was taken
+	*
+	* \param marker Marker returned by Mark, markers must be rewound in reverse order
+	*/
+	inline void ArenaAllocator::Rewind(const Marker& marker) noexcept
+	{
+		if (!marker.chunk)
+		{
+			m_liveAllocationCount = marker.liveAllocationCount;
+			RewindToStart();
+			return;
+		}
+
+		m_currentChunk = marker.chunk;
+		m_current = marker.current;
+		m_end = marker.chunk->GetEnd();
+		m_liveAllocationCount = marker.liveAllocationCount;
+	}
+
+	inline ArenaAllocator& ArenaAllocator::operator=(ArenaAllocator&& arena) noexcept
+	{
+		if (this != &arena)
+		{
+			Release();
+
+			m_firstChunk = std::exchange(arena.m_firstChunk, nullptr);
+			m_currentChunk = std::exchange(arena.m_currentChunk, nullptr);
+			m_current = std::exchange(arena.m_current, nullptr);
+			m_end = std::exchange(arena.m_end, nullptr);
+			m_allocatedSize = std::exchange(arena.m_allocatedSize, 0);
+			m_chunkSize = arena.m_chunkSize;
+			m_liveAllocationCount = std::exchange(arena.m_liveAllocationCount, 0);
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Returns the arena of the calling thread
+	*/
+	inline ArenaAllocator& ArenaAllocator::GetThreadLocal()
+	{
+		thread_local ArenaAllocator arena;
+		return arena;
+	}
+
+	inline void* ArenaAllocator::AllocateFromNextChunk(std::size_t size, std::size_t alignment)
+	{
+		// Chunk memory is aligned on max_align_t, overaligned allocations may need padding
+		std::size_t requiredSize = size + ((alignment > alignof(std::max_align_t)) ? alignment : 0);
+
+		Chunk* nextChunk = (m_currentChunk) ? m_currentChunk->next : m_firstChunk;
+		if (!nextChunk || nextChunk->size < requiredSize)
+		{
+			// Following chunks are too small, replace them by a bigger one
+			FreeChunksAfter(m_currentChunk);
+
+			std::size_t chunkSize = std::max(m_chunkSize, requiredSize);
+			void* memory = ::operator new(sizeof(Chunk) + chunkSize);
+			m_chunkSize = chunkSize * 2;
+			m_allocatedSize += chunkSize;
+
+			nextChunk = PlacementNew(static_cast<Chunk*>(memory));
+			nextChunk->next = nullptr;
+			nextChunk->size = chunkSize;
+
+			if (m_currentChunk)
+				m_currentChunk->next = nextChunk;
+			else
+				m_firstChunk = nextChunk;
+		}
+
+		m_currentChunk = nextChunk;
+		m_current = nextChunk->GetBegin();
+		m_end = nextChunk->GetEnd();
+
+		void* ptr = Allocate(size, alignment);
+		assert(ptr);
+
+		return ptr;
+	}
+
+	inline void ArenaAllocator::FreeChunksAfter(Chunk* chunk) noexcept
+	{
+		Chunk* nextChunk;
+		if (chunk)
+		{
+			nextChunk = chunk->next;
+			chunk->next = nullptr;
+		}
+		else
+			nextChunk = m_firstChunk;
+
+		while (nextChunk)
+		{
+			Chunk* next = nextChunk->next;
+			m_allocatedSize -= nextChunk->size;
+			::operator delete(nextChunk);
+
+			nextChunk = next;
+		}
+	}
+
+	inline void ArenaAllocator::RewindToStart() noexcept
+	{
+		m_currentChunk = m_firstChunk;
+		if (m_firstChunk)
+		{
+			m_current = m_firstChunk->GetBegin();
+			m_end = m_firstChunk->GetEnd();
+		}
+		else
+		{
+			m_current = nullptr;
+			m_end = nullptr;
+		}
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ArenaStlAllocator
+	* \brief Standard allocator allocating from an ArenaAllocator, to use an arena with standard containers or Bitset
+	*
+	* \remark Default-constructed allocators use the arena of the calling thread
+	*/
+
+	template<typename T>
+	ArenaStlAllocator<T>::ArenaStlAllocator() noexcept :
+	m_arena(&ArenaAllocator::GetThreadLocal())
+	{
+	}
+
+	template<typename T>
+	ArenaStlAllocator<T>::ArenaStlAllocator(ArenaAllocator& arena) noexcept :
+	m_arena(&arena)
+	{
+	}
+
+	template<typename T>
+	template<typename U>
+	ArenaStlAllocator<T>::ArenaStlAllocator(const ArenaStlAllocator<U>& allocator) noexcept :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	template<typename T>
+	T* ArenaStlAllocator<T>::allocate(std::size_t count)
+	{
+		return m_arena->Allocate<T>(count);
+	}
+
+	template<typename T>
+	void ArenaStlAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept
+	{
+		m_arena->Deallocate(ptr, count * sizeof(T));
+	}
+
+	template<typename T>
+	ArenaAllocator& ArenaStlAllocator<T>::GetArena() const noexcept
+	{
+		return *m_arena;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaStlAllocator<T>::operator==(const ArenaStlAllocator<U>& allocator) const noexcept
+	{
+		return m_arena == allocator.m_arena;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaStlAllocator<T>::operator!=(const ArenaStlAllocator<U>& allocator) const noexcept
+	{
+		return m_arena != allocator.m_arena;
+	}
+}
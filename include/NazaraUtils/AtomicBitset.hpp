@@ -0,0 +1,79 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_ATOMICBITSET_HPP
+#define NAZARAUTILS_ATOMICBITSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename Block = UInt64>
+	class AtomicBitset
+	{
+		static_assert(std::is_integral<Block>::value && std::is_unsigned<Block>::value, "Block must be a unsigned integral type");
+
+		public:
+			AtomicBitset();
+			explicit AtomicBitset(std::size_t bitCount, bool val = false);
+			AtomicBitset(const AtomicBitset&) = delete;
+			AtomicBitset(AtomicBitset&& bitset) noexcept;
+			~AtomicBitset() = default;
+
+			std::size_t ClaimFirstClear(std::size_t firstBit = 0, std::memory_order order = std::memory_order_acq_rel);
+
+			std::size_t Count() const;
+
+			Block ExchangeBlock(std::size_t i, Block block, std::memory_order order = std::memory_order_acq_rel);
+
+			Block FetchAnd(std::size_t i, Block mask, std::memory_order order = std::memory_order_acq_rel);
+			Block FetchOr(std::size_t i, Block mask, std::memory_order order = std::memory_order_acq_rel);
+
+			std::size_t FindFirst() const;
+			std::size_t FindNext(std::size_t bit) const;
+
+			Block GetBlock(std::size_t i, std::memory_order order = std::memory_order_acquire) const;
+			std::size_t GetBlockCount() const;
+			std::size_t GetSize() const;
+
+			void Reset(std::memory_order order = std::memory_order_release);
+			void Reset(std::size_t bit, std::memory_order order = std::memory_order_release);
+
+			void Set(std::size_t bit, std::memory_order order = std::memory_order_release);
+
+			bool Test(std::size_t bit, std::memory_order order = std::memory_order_acquire) const;
+			bool TestAndReset(std::size_t bit, std::memory_order order = std::memory_order_acq_rel);
+			bool TestAndSet(std::size_t bit, std::memory_order order = std::memory_order_acq_rel);
+
+			template<class Allocator = std::allocator<Block>> Bitset<Block, Allocator> ToBitset(const Allocator& allocator = Allocator()) const;
+
+			AtomicBitset& operator=(const AtomicBitset&) = delete;
+			AtomicBitset& operator=(AtomicBitset&& bitset) noexcept;
+
+			static constexpr Block fullBitMask = std::numeric_limits<Block>::max();
+			static constexpr std::size_t bitsPerBlock = BitCount<Block>();
+			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+		private:
+			Block GetBlockMask(std::size_t i) const;
+
+			static std::size_t ComputeBlockCount(std::size_t bitCount);
+
+			std::unique_ptr<std::atomic<Block>[]> m_blocks;
+			std::size_t m_bitCount;
+			std::size_t m_blockCount;
+	};
+}
+
+#include <NazaraUtils/AtomicBitset.inl>
+
+#endif // NAZARAUTILS_ATOMICBITSET_HPP
@@ -0,0 +1,385 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::AtomicBitset
+	* \brief Core class that represents a fixed-size set of bits which can be read and modified by multiple threads at once
+	*
+	* Each block is a std::atomic<Block>, bit operations are lock-free read-modify-write operations on them.
+	* Operations spanning multiple blocks (Count, FindFirst, FindNext, Reset(), ToBitset) read or write blocks one at a time and thus
+	* only give a snapshot which may be outdated by concurrent modifications.
+	*
+	* Unlike Bitset, the size is fixed at construction: resizing isn't safe while other threads access the blocks.
+	*
+	* \see Bitset
+	*/
+
+	/*!
+	* \brief Constructs an empty AtomicBitset object
+	*/
+	template<typename Block>
+	AtomicBitset<Block>::AtomicBitset() :
+	m_bitCount(0),
+	m_blockCount(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs an AtomicBitset object of bitCount bits to value val
+	*
+	* \param bitCount Number of bits
+	* \param val Value of those bits, by default false
+	*/
+	template<typename Block>
+	AtomicBitset<Block>::AtomicBitset(std::size_t bitCount, bool val) :
+	m_blocks(std::make_unique<std::atomic<Block>[]>(ComputeBlockCount(bitCount))),
+	m_bitCount(bitCount),
+	m_blockCount(ComputeBlockCount(bitCount))
+	{
+		for (std::size_t i = 0; i < m_blockCount; ++i)
+			m_blocks[i].store((val) ? GetBlockMask(i) : Block(0U), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Moves a bitset, this is not thread-safe
+	*
+	* \param bitset Bitset to move, which is left empty
+	*/
+	template<typename Block>
+	AtomicBitset<Block>::AtomicBitset(AtomicBitset&& bitset) noexcept :
+	m_blocks(std::move(bitset.m_blocks)),
+	m_bitCount(std::exchange(bitset.m_bitCount, 0)),
+	m_blockCount(std::exchange(bitset.m_blockCount, 0))
+	{
+	}
+
+	/*!
+	* \brief Atomically finds a bit set to zero and sets it to one
+	* \return Index of the claimed bit, or npos if every bit (from firstBit) is set
+	*
+	* \param firstBit Index of the first bit to consider, threads starting from different bits reduce contention
+	* \param order Memory order of the successful claim
+	*
+	* \remark When two threads try to claim the same bit, only one of them succeeds and the other one continues searching from it
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::ClaimFirstClear(std::size_t firstBit, std::memory_order order)
+	{
+		std::size_t firstBlock = firstBit / bitsPerBlock;
+		for (std::size_t i = firstBlock; i < m_blockCount; ++i)
+		{
+			Block candidateMask = GetBlockMask(i);
+			if (i == firstBlock)
+				candidateMask &= fullBitMask << (firstBit % bitsPerBlock);
+
+			Block block = m_blocks[i].load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Block clearBits = Block(~block) & candidateMask;
+				if (clearBits == 0)
+					break;
+
+				unsigned int bitIndex = FindFirstBit(clearBits) - 1;
+				Block mask = Block(1U) << bitIndex;
+
+				// If another thread claimed this bit, we get the up-to-date block and try the next one
+				block = m_blocks[i].fetch_or(mask, order);
+				if ((block & mask) == 0)
+					return i * bitsPerBlock + bitIndex;
+			}
+		}
+
+		return npos;
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1
+	* \return Number of bits set to 1
+	*
+	* \remark Blocks are loaded with relaxed ordering, the result may be outdated by concurrent modifications
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::Count() const
+	{
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < m_blockCount; ++i)
+			count += CountBits(m_blocks[i].load(std::memory_order_relaxed));
+
+		return count;
+	}
+
+	/*!
+	* \brief Atomically replaces the ith block
+	* \return Previous value of the block
+	*
+	* \param i Index of the block
+	* \param block New value of the block
+	* \param order Memory order of the operation
+	*
+	* \remark This can be used to consume bits set by other threads without losing any of them
+	*/
+	template<typename Block>
+	Block AtomicBitset<Block>::ExchangeBlock(std::size_t i, Block block, std::memory_order order)
+	{
+		assert(i < m_blockCount && "Block index out of range");
+
+		return m_blocks[i].exchange(block & GetBlockMask(i), order);
+	}
+
+	/*!
+	* \brief Atomically performs an "AND" with the ith block
+	* \return Previous value of the block
+	*
+	* \param i Index of the block
+	* \param mask Mask to apply
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	Block AtomicBitset<Block>::FetchAnd(std::size_t i, Block mask, std::memory_order order)
+	{
+		assert(i < m_blockCount && "Block index out of range");
+
+		return m_blocks[i].fetch_and(mask, order);
+	}
+
+	/*!
+	* \brief Atomically performs an "OR" with the ith block
+	* \return Previous value of the block
+	*
+	* \param i Index of the block
+	* \param mask Mask to apply, bits past the end of the bitset are ignored
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	Block AtomicBitset<Block>::FetchOr(std::size_t i, Block mask, std::memory_order order)
+	{
+		assert(i < m_blockCount && "Block index out of range");
+
+		return m_blocks[i].fetch_or(mask & GetBlockMask(i), order);
+	}
+
+	/*!
+	* \brief Finds the first bit set to one in the bitset
+	* \return The 0-based index of the first bit enabled, or npos if none is
+	*
+	* \remark Blocks are loaded with acquire ordering, the result may be outdated by concurrent modifications
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::FindFirst() const
+	{
+		for (std::size_t i = 0; i < m_blockCount; ++i)
+		{
+			if (Block block = m_blocks[i].load(std::memory_order_acquire))
+				return i * bitsPerBlock + FindFirstBit(block) - 1;
+		}
+
+		return npos;
+	}
+
+	/*!
+	* \brief Finds the next enabled in the bitset
+	* \return Index of the next enabled bit or npos if all the following bits are disabled
+	*
+	* \param bit Index of the last bit found, which will not be treated by this function
+	*
+	* \remark Blocks are loaded with acquire ordering, the result may be outdated by concurrent modifications
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::FindNext(std::size_t bit) const
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		if (++bit >= m_bitCount)
+			return npos;
+
+		std::size_t blockIndex = bit / bitsPerBlock;
+		Block block = m_blocks[blockIndex].load(std::memory_order_acquire) & (fullBitMask << (bit % bitsPerBlock));
+		while (block == 0)
+		{
+			if (++blockIndex >= m_blockCount)
+				return npos;
+
+			block = m_blocks[blockIndex].load(std::memory_order_acquire);
+		}
+
+		return blockIndex * bitsPerBlock + FindFirstBit(block) - 1;
+	}
+
+	/*!
+	* \brief Atomically loads the ith block
+	* \return Block in the bitset
+	*
+	* \param i Index of the block
+	* \param order Memory order of the load
+	*/
+	template<typename Block>
+	Block AtomicBitset<Block>::GetBlock(std::size_t i, std::memory_order order) const
+	{
+		assert(i < m_blockCount && "Block index out of range");
+
+		return m_blocks[i].load(order);
+	}
+
+	/*!
+	* \brief Gets the number of blocks
+	* \return Number of blocks
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::GetBlockCount() const
+	{
+		return m_blockCount;
+	}
+
+	/*!
+	* \brief Gets the number of bits
+	* \return Number of bits
+	*/
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::GetSize() const
+	{
+		return m_bitCount;
+	}
+
+	/*!
+	* \brief Sets every bit to zero
+	*
+	* \param order Memory order of each block store
+	*
+	* \remark Blocks are reset one after another, this is not a single atomic operation
+	*/
+	template<typename Block>
+	void AtomicBitset<Block>::Reset(std::memory_order order)
+	{
+		for (std::size_t i = 0; i < m_blockCount; ++i)
+			m_blocks[i].store(Block(0U), order);
+	}
+
+	/*!
+	* \brief Atomically sets a bit to zero
+	*
+	* \param bit Index of the bit
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	void AtomicBitset<Block>::Reset(std::size_t bit, std::memory_order order)
+	{
+		TestAndReset(bit, order);
+	}
+
+	/*!
+	* \brief Atomically sets a bit to one
+	*
+	* \param bit Index of the bit
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	void AtomicBitset<Block>::Set(std::size_t bit, std::memory_order order)
+	{
+		TestAndSet(bit, order);
+	}
+
+	/*!
+	* \brief Atomically tests a bit
+	* \return true if bit is set
+	*
+	* \param bit Index of the bit
+	* \param order Memory order of the load
+	*/
+	template<typename Block>
+	bool AtomicBitset<Block>::Test(std::size_t bit, std::memory_order order) const
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		return (m_blocks[bit / bitsPerBlock].load(order) & (Block(1U) << (bit % bitsPerBlock))) != 0;
+	}
+
+	/*!
+	* \brief Atomically sets a bit to zero and returns its previous value
+	* \return true if bit was set
+	*
+	* \param bit Index of the bit
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	bool AtomicBitset<Block>::TestAndReset(std::size_t bit, std::memory_order order)
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		Block mask = Block(1U) << (bit % bitsPerBlock);
+		return (m_blocks[bit / bitsPerBlock].fetch_and(Block(~mask), order) & mask) != 0;
+	}
+
+	/*!
+	* \brief Atomically sets a bit to one and returns its previous value
+	* \return true if bit was already set
+	*
+	* \param bit Index of the bit
+	* \param order Memory order of the operation
+	*/
+	template<typename Block>
+	bool AtomicBitset<Block>::TestAndSet(std::size_t bit, std::memory_order order)
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		Block mask = Block(1U) << (bit % bitsPerBlock);
+		return (m_blocks[bit / bitsPerBlock].fetch_or(mask, order) & mask) != 0;
+	}
+
+	/*!
+	* \brief Copies the bits to a non-atomic Bitset
+	* \return Bitset with the same size and bits
+	*
+	* \param allocator Allocator of the returned bitset
+	*
+	* \remark Blocks are loaded one after another with acquire ordering, this is not a consistent snapshot under concurrent modifications
+	*/
+	template<typename Block>
+	template<class Allocator>
+	Bitset<Block, Allocator> AtomicBitset<Block>::ToBitset(const Allocator& allocator) const
+	{
+		Bitset<Block, Allocator> bitset(m_bitCount, false, allocator);
+		for (std::size_t i = 0; i < m_blockCount; ++i)
+			bitset.SetBlock(i, m_blocks[i].load(std::memory_order_acquire));
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Moves a bitset, this is not thread-safe
+	* \return A reference to this
+	*
+	* \param bitset Bitset to move, which is left empty
+	*/
+	template<typename Block>
+	AtomicBitset<Block>& AtomicBitset<Block>::operator=(AtomicBitset&& bitset) noexcept
+	{
+		m_blocks = std::move(bitset.m_blocks);
+		m_bitCount = std::exchange(bitset.m_bitCount, 0);
+		m_blockCount = std::exchange(bitset.m_blockCount, 0);
+
+		return *this;
+	}
+
+	template<typename Block>
+	Block AtomicBitset<Block>::GetBlockMask(std::size_t i) const
+	{
+		std::size_t bitIndex = m_bitCount % bitsPerBlock;
+		if (i == m_blockCount - 1 && bitIndex != 0)
+			return Block((Block(1U) << bitIndex) - 1U);
+
+		return fullBitMask;
+	}
+
+	template<typename Block>
+	std::size_t AtomicBitset<Block>::ComputeBlockCount(std::size_t bitCount)
+	{
+		return (bitCount + bitsPerBlock - 1) / bitsPerBlock;
+	}
+}
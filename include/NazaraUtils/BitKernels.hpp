@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BITKERNELS_HPP
+#define NAZARAUTILS_BITKERNELS_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+
+#if !defined(NAZARA_BITKERNELS_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_BITKERNELS_X86
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_BITKERNELS_NEON
+	#endif
+#endif
+
+namespace Nz
+{
+	enum class BitKernelBackend
+	{
+		Scalar,
+		AVX2,
+		AVX512,
+		NEON
+	};
+
+	namespace BitKernels
+	{
+		inline void And(void* dst, const void* a, const void* b, std::size_t byteCount);
+		inline void AndNot(void* dst, const void* a, const void* b, std::size_t byteCount);
+		inline std::size_t Count(const void* data, std::size_t byteCount);
+		inline std::size_t CountAnd(const void* a, const void* b, std::size_t byteCount);
+		inline std::size_t CountAndNot(const void* a, const void* b, std::size_t byteCount);
+		inline std::size_t FindFirstNonZero(const void* data, std::size_t byteCount);
+		inline BitKernelBackend GetBackend();
+		inline bool Intersects(const void* a, const void* b, std::size_t byteCount);
+		inline bool IntersectsAndNot(const void* a, const void* b, std::size_t byteCount);
+		inline void Not(void* dst, const void* src, std::size_t byteCount);
+		inline void Or(void* dst, const void* a, const void* b, std::size_t byteCount);
+		inline void ReverseBits(void* dst, const void* src, std::size_t byteCount, std::size_t elementSize);
+		inline void Xor(void* dst, const void* a, const void* b, std::size_t byteCount);
+
+		namespace Scalar
+		{
+			inline void And(void* dst, const void* a, const void* b, std::size_t byteCount);
+			inline void AndNot(void* dst, const void* a, const void* b, std::size_t byteCount);
+			inline std::size_t Count(const void* data, std::size_t byteCount);
+			inline std::size_t CountAnd(const void* a, const void* b, std::size_t byteCount);
+			inline std::size_t CountAndNot(const void* a, const void* b, std::size_t byteCount);
+			inline std::size_t FindFirstNonZero(const void* data, std::size_t byteCount);
+			inline bool Intersects(const void* a, const void* b, std::size_t byteCount);
+			inline bool IntersectsAndNot(const void* a, const void* b, std::size_t byteCount);
+			inline void Not(void* dst, const void* src, std::size_t byteCount);
+			inline void Or(void* dst, const void* a, const void* b, std::size_t byteCount);
+			inline void ReverseBits(void* dst, const void* src, std::size_t byteCount, std::size_t elementSize);
+			inline void Xor(void* dst, const void* a, const void* b, std::size_t byteCount);
+		}
+	}
+}
+
+#include <NazaraUtils/BitKernels.inl>
+
+#endif // NAZARAUTILS_BITKERNELS_HPP
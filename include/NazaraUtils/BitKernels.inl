@@ -0,0 +1,1086 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <cassert>
+#include <cstring>
+
+#if defined(NAZARA_BITKERNELS_X86)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_BITKERNELS_NEON)
+	#include <arm_neon.h>
+#endif
+
+#if defined(NAZARA_BITKERNELS_X86) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_BITKERNELS_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_BITKERNELS_TARGET(features)
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		enum class BitKernelOp
+		{
+			And,
+			AndNot,
+			Or,
+			Xor
+		};
+
+		// Below this size, the cost of the dispatch outweighs the gains of the vectorized kernels
+		constexpr std::size_t BitKernelScalarThreshold = 64;
+
+		template<BitKernelOp Op, typename T>
+		T ApplyBitKernelOp(T a, T b)
+		{
+			if constexpr (Op == BitKernelOp::And)
+				return static_cast<T>(a & b);
+			else if constexpr (Op == BitKernelOp::AndNot)
+				return static_cast<T>(a & ~b);
+			else if constexpr (Op == BitKernelOp::Or)
+				return static_cast<T>(a | b);
+			else
+				return static_cast<T>(a ^ b);
+		}
+
+		template<BitKernelOp Op>
+		void ScalarBinaryOp(UInt8* dst, const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x, y;
+				std::memcpy(&x, a + i, sizeof(UInt64));
+				std::memcpy(&y, b + i, sizeof(UInt64));
+
+				UInt64 r = ApplyBitKernelOp<Op>(x, y);
+				std::memcpy(dst + i, &r, sizeof(UInt64));
+			}
+
+			for (; i < byteCount; ++i)
+				dst[i] = ApplyBitKernelOp<Op>(a[i], b[i]);
+		}
+
+		inline std::size_t ScalarCount(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t count = 0;
+
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x;
+				std::memcpy(&x, data + i, sizeof(UInt64));
+
+				count += CountBits(x);
+			}
+
+			for (; i < byteCount; ++i)
+				count += CountBits(data[i]);
+
+			return count;
+		}
+
+		template<BitKernelOp Op>
+		std::size_t ScalarCountBinaryOp(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t count = 0;
+
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x, y;
+				std::memcpy(&x, a + i, sizeof(UInt64));
+				std::memcpy(&y, b + i, sizeof(UInt64));
+
+				count += CountBits(ApplyBitKernelOp<Op>(x, y));
+			}
+
+			for (; i < byteCount; ++i)
+				count += CountBits(ApplyBitKernelOp<Op>(a[i], b[i]));
+
+			return count;
+		}
+
+		template<BitKernelOp Op>
+		bool ScalarIntersects(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x, y;
+				std::memcpy(&x, a + i, sizeof(UInt64));
+				std::memcpy(&y, b + i, sizeof(UInt64));
+
+				if (ApplyBitKernelOp<Op>(x, y))
+					return true;
+			}
+
+			for (; i < byteCount; ++i)
+			{
+				if (ApplyBitKernelOp<Op>(a[i], b[i]))
+					return true;
+			}
+
+			return false;
+		}
+
+		inline void ScalarNot(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x;
+				std::memcpy(&x, src + i, sizeof(UInt64));
+
+				x = ~x;
+				std::memcpy(dst + i, &x, sizeof(UInt64));
+			}
+
+			for (; i < byteCount; ++i)
+				dst[i] = static_cast<UInt8>(~src[i]);
+		}
+
+		inline std::size_t ScalarFindFirstNonZero(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(UInt64) <= byteCount; i += sizeof(UInt64))
+			{
+				UInt64 x;
+				std::memcpy(&x, data + i, sizeof(UInt64));
+
+				if (x != 0)
+					break;
+			}
+
+			for (; i < byteCount; ++i)
+			{
+				if (data[i] != 0)
+					return i;
+			}
+
+			return byteCount;
+		}
+
+		template<std::size_t Size>
+		void ScalarReverseBits(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			using T = std::conditional_t<Size == 1, UInt8, std::conditional_t<Size == 2, UInt16, std::conditional_t<Size == 4, UInt32, UInt64>>>;
+			static_assert(sizeof(T) == Size);
+
+			for (std::size_t i = 0; i + Size <= byteCount; i += Size)
+			{
+				T x;
+				std::memcpy(&x, src + i, Size);
+
+				x = ReverseBits(x);
+				std::memcpy(dst + i, &x, Size);
+			}
+		}
+
+#if defined(NAZARA_BITKERNELS_X86)
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx2") __m256i AVX2ApplyOp(__m256i x, __m256i y)
+		{
+			if constexpr (Op == BitKernelOp::And)
+				return _mm256_and_si256(x, y);
+			else if constexpr (Op == BitKernelOp::AndNot)
+				return _mm256_andnot_si256(y, x);
+			else if constexpr (Op == BitKernelOp::Or)
+				return _mm256_or_si256(x, y);
+			else
+				return _mm256_xor_si256(x, y);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline __m256i AVX2PopCount(__m256i v)
+		{
+			// Nibble lookup table popcount (Mula et al.), bytes counts are summed into 64-bit lanes using SAD against zero
+			const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			                                        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+			const __m256i lowMask = _mm256_set1_epi8(0x0F);
+
+			__m256i lo = _mm256_and_si256(v, lowMask);
+			__m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask);
+			__m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+
+			return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline std::size_t AVX2ReduceAdd(__m256i v)
+		{
+			alignas(__m256i) UInt64 sums[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(sums), v);
+
+			return static_cast<std::size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx2") void AVX2BinaryOp(UInt8* dst, const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), AVX2ApplyOp<Op>(x, y));
+			}
+
+			ScalarBinaryOp<Op>(dst + i, a + i, b + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline void AVX2CarrySaveAdd(__m256i& high, __m256i& low, __m256i a, __m256i b, __m256i c)
+		{
+			__m256i u = _mm256_xor_si256(a, b);
+			high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+			low = _mm256_xor_si256(u, c);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline __m256i AVX2Load(const UInt8* data, std::size_t index)
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + index);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline std::size_t AVX2Count(const UInt8* data, std::size_t byteCount)
+		{
+			// Harley-Seal (Mula, Kurz & Lemire): blocks of 16 vectors go through a carry-save adder tree,
+			// leaving only one vector (the sixteens) to popcount per block
+			constexpr std::size_t BlockSize = 16 * sizeof(__m256i);
+
+			__m256i total = _mm256_setzero_si256();
+			__m256i ones = _mm256_setzero_si256();
+			__m256i twos = _mm256_setzero_si256();
+			__m256i fours = _mm256_setzero_si256();
+			__m256i eights = _mm256_setzero_si256();
+
+			std::size_t i = 0;
+			for (; i + BlockSize <= byteCount; i += BlockSize)
+			{
+				const UInt8* block = data + i;
+
+				__m256i twosA, twosB, foursA, foursB, eightsA, eightsB, sixteens;
+				AVX2CarrySaveAdd(twosA, ones, ones, AVX2Load(block, 0), AVX2Load(block, 1));
+				AVX2CarrySaveAdd(twosB, ones, ones, AVX2Load(block, 2), AVX2Load(block, 3));
+				AVX2CarrySaveAdd(foursA, twos, twos, twosA, twosB);
+				AVX2CarrySaveAdd(twosA, ones, ones, AVX2Load(block, 4), AVX2Load(block, 5));
+				AVX2CarrySaveAdd(twosB, ones, ones, AVX2Load(block, 6), AVX2Load(block, 7));
+				AVX2CarrySaveAdd(foursB, twos, twos, twosA, twosB);
+				AVX2CarrySaveAdd(eightsA, fours, fours, foursA, foursB);
+				AVX2CarrySaveAdd(twosA, ones, ones, AVX2Load(block, 8), AVX2Load(block, 9));
+				AVX2CarrySaveAdd(twosB, ones, ones, AVX2Load(block, 10), AVX2Load(block, 11));
+				AVX2CarrySaveAdd(foursA, twos, twos, twosA, twosB);
+				AVX2CarrySaveAdd(twosA, ones, ones, AVX2Load(block, 12), AVX2Load(block, 13));
+				AVX2CarrySaveAdd(twosB, ones, ones, AVX2Load(block, 14), AVX2Load(block, 15));
+				AVX2CarrySaveAdd(foursB, twos, twos, twosA, twosB);
+				AVX2CarrySaveAdd(eightsB, fours, fours, foursA, foursB);
+				AVX2CarrySaveAdd(sixteens, eights, eights, eightsA, eightsB);
+
+				total = _mm256_add_epi64(total, AVX2PopCount(sixteens));
+			}
+
+			total = _mm256_slli_epi64(total, 4);
+			total = _mm256_add_epi64(total, _mm256_slli_epi64(AVX2PopCount(eights), 3));
+			total = _mm256_add_epi64(total, _mm256_slli_epi64(AVX2PopCount(fours), 2));
+			total = _mm256_add_epi64(total, _mm256_slli_epi64(AVX2PopCount(twos), 1));
+			total = _mm256_add_epi64(total, AVX2PopCount(ones));
+
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+				total = _mm256_add_epi64(total, AVX2PopCount(AVX2Load(data + i, 0)));
+
+			return AVX2ReduceAdd(total) + ScalarCount(data + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx2") std::size_t AVX2CountBinaryOp(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			__m256i acc = _mm256_setzero_si256();
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				acc = _mm256_add_epi64(acc, AVX2PopCount(AVX2ApplyOp<Op>(x, y)));
+			}
+
+			return AVX2ReduceAdd(acc) + ScalarCountBinaryOp<Op>(a + i, b + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx2") bool AVX2Intersects(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			static_assert(Op == BitKernelOp::And || Op == BitKernelOp::AndNot);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+
+				// testz: (x & y) == 0, testc: (~y & x) == 0
+				bool empty;
+				if constexpr (Op == BitKernelOp::And)
+					empty = _mm256_testz_si256(x, y);
+				else
+					empty = _mm256_testc_si256(y, x);
+
+				if (!empty)
+					return true;
+			}
+
+			return ScalarIntersects<Op>(a + i, b + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline void AVX2Not(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			const __m256i ones = _mm256_set1_epi32(-1);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(x, ones));
+			}
+
+			ScalarNot(dst + i, src + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx2") inline std::size_t AVX2FindFirstNonZero(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i v = AVX2Load(data + i, 0);
+				if (!_mm256_testz_si256(v, v))
+				{
+					UInt32 zeroMask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+					return i + FindFirstBit(~zeroMask) - 1;
+				}
+			}
+
+			return i + ScalarFindFirstNonZero(data + i, byteCount - i);
+		}
+
+		template<std::size_t Size, std::size_t N>
+		void FillByteReverseShuffleMask(UInt8(&mask)[N])
+		{
+			// Reverses the order of the bytes of each Size-bytes element of every 128-bit lane
+			for (std::size_t i = 0; i < N; ++i)
+				mask[i] = static_cast<UInt8>((i % 16 / Size) * Size + (Size - 1 - i % Size));
+		}
+
+		template<std::size_t Size>
+		NAZARA_BITKERNELS_TARGET("avx2") void AVX2ReverseBits(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			// Bits of each byte are reversed using a lookup per nibble, bytes are then reversed inside each element
+			// Loaded from UInt8 arrays, as _mm256_setr_epi8 takes chars which can't hold values above 0x7F without narrowing
+			static constexpr UInt8 lowLookupValues[32] = {
+				0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+				0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0
+			};
+
+			static constexpr UInt8 highLookupValues[32] = {
+				0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F,
+				0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F
+			};
+
+			const __m256i lowLookup = AVX2Load(lowLookupValues, 0);
+			const __m256i highLookup = AVX2Load(highLookupValues, 0);
+			const __m256i lowMask = _mm256_set1_epi8(0x0F);
+
+			UInt8 shuffleMask[32];
+			FillByteReverseShuffleMask<Size>(shuffleMask);
+			const __m256i byteShuffle = AVX2Load(shuffleMask, 0);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m256i) <= byteCount; i += sizeof(__m256i))
+			{
+				__m256i v = AVX2Load(src + i, 0);
+				__m256i lo = _mm256_shuffle_epi8(lowLookup, _mm256_and_si256(v, lowMask));
+				__m256i hi = _mm256_shuffle_epi8(highLookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask));
+				__m256i reversed = _mm256_or_si256(lo, hi);
+				if constexpr (Size > 1)
+					reversed = _mm256_shuffle_epi8(reversed, byteShuffle);
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), reversed);
+			}
+
+			ScalarReverseBits<Size>(dst + i, src + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") __m512i AVX512ApplyOp(__m512i x, __m512i y)
+		{
+			if constexpr (Op == BitKernelOp::And)
+				return _mm512_and_si512(x, y);
+			else if constexpr (Op == BitKernelOp::AndNot)
+				return _mm512_ternarylogic_epi64(x, y, y, 0x30); //< x & ~y (_mm512_andnot_si512 triggers false uninitialized warnings on GCC)
+			else if constexpr (Op == BitKernelOp::Or)
+				return _mm512_or_si512(x, y);
+			else
+				return _mm512_xor_si512(x, y);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") inline __m512i AVX512PopCount(__m512i v)
+		{
+			const __m512i lookup = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100); //< per-lane { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 }
+			const __m512i lowMask = _mm512_set1_epi8(0x0F);
+
+			__m512i lo = _mm512_and_si512(v, lowMask);
+			__m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), lowMask);
+			__m512i counts = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, lo), _mm512_shuffle_epi8(lookup, hi));
+
+			return _mm512_sad_epu8(counts, _mm512_setzero_si512());
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") inline std::size_t AVX512ReduceAdd(__m512i v)
+		{
+			alignas(__m512i) UInt64 sums[8];
+			_mm512_store_si512(sums, v);
+
+			UInt64 count = 0;
+			for (UInt64 sum : sums)
+				count += sum;
+
+			return static_cast<std::size_t>(count);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") void AVX512BinaryOp(UInt8* dst, const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i x = _mm512_loadu_si512(a + i);
+				__m512i y = _mm512_loadu_si512(b + i);
+				_mm512_storeu_si512(dst + i, AVX512ApplyOp<Op>(x, y));
+			}
+
+			ScalarBinaryOp<Op>(dst + i, a + i, b + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") inline std::size_t AVX512Count(const UInt8* data, std::size_t byteCount)
+		{
+			__m512i acc = _mm512_setzero_si512();
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+				acc = _mm512_add_epi64(acc, AVX512PopCount(_mm512_loadu_si512(data + i)));
+
+			return AVX512ReduceAdd(acc) + ScalarCount(data + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") std::size_t AVX512CountBinaryOp(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			__m512i acc = _mm512_setzero_si512();
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i x = _mm512_loadu_si512(a + i);
+				__m512i y = _mm512_loadu_si512(b + i);
+				acc = _mm512_add_epi64(acc, AVX512PopCount(AVX512ApplyOp<Op>(x, y)));
+			}
+
+			return AVX512ReduceAdd(acc) + ScalarCountBinaryOp<Op>(a + i, b + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") bool AVX512Intersects(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			static_assert(Op == BitKernelOp::And || Op == BitKernelOp::AndNot);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i x = _mm512_loadu_si512(a + i);
+				__m512i y = _mm512_loadu_si512(b + i);
+
+				__mmask8 nonZero;
+				if constexpr (Op == BitKernelOp::And)
+					nonZero = _mm512_test_epi64_mask(x, y);
+				else
+				{
+					__m512i r = AVX512ApplyOp<Op>(x, y);
+					nonZero = _mm512_test_epi64_mask(r, r);
+				}
+
+				if (nonZero != 0)
+					return true;
+			}
+
+			return ScalarIntersects<Op>(a + i, b + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") inline void AVX512Not(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			const __m512i ones = _mm512_set1_epi32(-1);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i x = _mm512_loadu_si512(src + i);
+				_mm512_storeu_si512(dst + i, _mm512_xor_si512(x, ones));
+			}
+
+			ScalarNot(dst + i, src + i, byteCount - i);
+		}
+
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") inline std::size_t AVX512FindFirstNonZero(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i v = _mm512_loadu_si512(data + i);
+				if (__mmask64 nonZeroMask = _mm512_test_epi8_mask(v, v))
+					return i + FindFirstBit(static_cast<UInt64>(nonZeroMask)) - 1;
+			}
+
+			return i + ScalarFindFirstNonZero(data + i, byteCount - i);
+		}
+
+		template<std::size_t Size>
+		NAZARA_BITKERNELS_TARGET("avx512f,avx512bw") void AVX512ReverseBits(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			const __m512i lowLookup = _mm512_set4_epi32(int(0xF070B030), int(0xD0509010), int(0xE060A020), int(0xC0408000)); //< per-lane { 0x00, 0x80, 0x40, 0xC0, ..., 0x70, 0xF0 }
+			const __m512i highLookup = _mm512_set4_epi32(0x0F070B03, 0x0D050901, 0x0E060A02, 0x0C040800); //< per-lane { 0x00, 0x08, 0x04, 0x0C, ..., 0x07, 0x0F }
+			const __m512i lowMask = _mm512_set1_epi8(0x0F);
+
+			UInt8 shuffleMask[64];
+			FillByteReverseShuffleMask<Size>(shuffleMask);
+			const __m512i byteShuffle = _mm512_loadu_si512(shuffleMask);
+
+			std::size_t i = 0;
+			for (; i + sizeof(__m512i) <= byteCount; i += sizeof(__m512i))
+			{
+				__m512i v = _mm512_loadu_si512(src + i);
+				__m512i lo = _mm512_shuffle_epi8(lowLookup, _mm512_and_si512(v, lowMask));
+				__m512i hi = _mm512_shuffle_epi8(highLookup, _mm512_and_si512(_mm512_srli_epi16(v, 4), lowMask));
+				__m512i reversed = _mm512_or_si512(lo, hi);
+				if constexpr (Size > 1)
+					reversed = _mm512_shuffle_epi8(reversed, byteShuffle);
+
+				_mm512_storeu_si512(dst + i, reversed);
+			}
+
+			ScalarReverseBits<Size>(dst + i, src + i, byteCount - i);
+		}
+#elif defined(NAZARA_BITKERNELS_NEON)
+		template<BitKernelOp Op>
+		uint8x16_t NEONApplyOp(uint8x16_t x, uint8x16_t y)
+		{
+			if constexpr (Op == BitKernelOp::And)
+				return vandq_u8(x, y);
+			else if constexpr (Op == BitKernelOp::AndNot)
+				return vbicq_u8(x, y);
+			else if constexpr (Op == BitKernelOp::Or)
+				return vorrq_u8(x, y);
+			else
+				return veorq_u8(x, y);
+		}
+
+		template<BitKernelOp Op>
+		void NEONBinaryOp(UInt8* dst, const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+				vst1q_u8(dst + i, NEONApplyOp<Op>(vld1q_u8(a + i), vld1q_u8(b + i)));
+
+			ScalarBinaryOp<Op>(dst + i, a + i, b + i, byteCount - i);
+		}
+
+		inline std::size_t NEONCount(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t count = 0;
+
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+				count += vaddvq_u8(vcntq_u8(vld1q_u8(data + i))); //< at most 128, fits in an 8-bit lane
+
+			return count + ScalarCount(data + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		std::size_t NEONCountBinaryOp(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t count = 0;
+
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+				count += vaddvq_u8(vcntq_u8(NEONApplyOp<Op>(vld1q_u8(a + i), vld1q_u8(b + i))));
+
+			return count + ScalarCountBinaryOp<Op>(a + i, b + i, byteCount - i);
+		}
+
+		template<BitKernelOp Op>
+		bool NEONIntersects(const UInt8* a, const UInt8* b, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+			{
+				if (vmaxvq_u8(NEONApplyOp<Op>(vld1q_u8(a + i), vld1q_u8(b + i))) != 0)
+					return true;
+			}
+
+			return ScalarIntersects<Op>(a + i, b + i, byteCount - i);
+		}
+
+		inline void NEONNot(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+				vst1q_u8(dst + i, vmvnq_u8(vld1q_u8(src + i)));
+
+			ScalarNot(dst + i, src + i, byteCount - i);
+		}
+
+		inline std::size_t NEONFindFirstNonZero(const UInt8* data, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+			{
+				if (vmaxvq_u8(vld1q_u8(data + i)) != 0)
+					break;
+			}
+
+			return i + ScalarFindFirstNonZero(data + i, byteCount - i);
+		}
+
+		template<std::size_t Size>
+		void NEONReverseBits(UInt8* dst, const UInt8* src, std::size_t byteCount)
+		{
+			std::size_t i = 0;
+			for (; i + sizeof(uint8x16_t) <= byteCount; i += sizeof(uint8x16_t))
+			{
+				uint8x16_t reversed = vrbitq_u8(vld1q_u8(src + i));
+				if constexpr (Size == 2)
+					reversed = vrev16q_u8(reversed);
+				else if constexpr (Size == 4)
+					reversed = vrev32q_u8(reversed);
+				else if constexpr (Size == 8)
+					reversed = vrev64q_u8(reversed);
+
+				vst1q_u8(dst + i, reversed);
+			}
+
+			ScalarReverseBits<Size>(dst + i, src + i, byteCount - i);
+		}
+#endif
+
+		struct BitKernelTable
+		{
+			using BinaryFunc = void(*)(UInt8* dst, const UInt8* a, const UInt8* b, std::size_t byteCount);
+			using CountFunc = std::size_t(*)(const UInt8* data, std::size_t byteCount);
+			using CountBinaryFunc = std::size_t(*)(const UInt8* a, const UInt8* b, std::size_t byteCount);
+			using FindFunc = std::size_t(*)(const UInt8* data, std::size_t byteCount);
+			using IntersectsFunc = bool(*)(const UInt8* a, const UInt8* b, std::size_t byteCount);
+			using UnaryFunc = void(*)(UInt8* dst, const UInt8* src, std::size_t byteCount);
+
+			BitKernelBackend backend;
+			BinaryFunc andFunc;
+			BinaryFunc andNotFunc;
+			CountFunc countFunc;
+			CountBinaryFunc countAndFunc;
+			CountBinaryFunc countAndNotFunc;
+			FindFunc findFirstNonZeroFunc;
+			IntersectsFunc intersectsFunc;
+			IntersectsFunc intersectsAndNotFunc;
+			UnaryFunc notFunc;
+			BinaryFunc orFunc;
+			UnaryFunc reverseBitsFuncs[4]; //< indexed by log2 of the element size
+			BinaryFunc xorFunc;
+		};
+
+		inline BitKernelBackend DetectBitKernelBackend()
+		{
+#if defined(NAZARA_BITKERNELS_X86)
+			const CpuFeatures& features = GetCpuFeatures();
+			if (features.avx512f && features.avx512bw)
+				return BitKernelBackend::AVX512;
+
+			if (features.avx2)
+				return BitKernelBackend::AVX2;
+#elif defined(NAZARA_BITKERNELS_NEON)
+			return BitKernelBackend::NEON;
+#endif
+
+			return BitKernelBackend::Scalar;
+		}
+
+		inline BitKernelTable BuildBitKernelTable(BitKernelBackend backend)
+		{
+#define NAZARA_BITKERNELS_TABLE(Prefix) { \
+			backend, \
+			&Prefix##BinaryOp<BitKernelOp::And>, \
+			&Prefix##BinaryOp<BitKernelOp::AndNot>, \
+			&Prefix##Count, \
+			&Prefix##CountBinaryOp<BitKernelOp::And>, \
+			&Prefix##CountBinaryOp<BitKernelOp::AndNot>, \
+			&Prefix##FindFirstNonZero, \
+			&Prefix##Intersects<BitKernelOp::And>, \
+			&Prefix##Intersects<BitKernelOp::AndNot>, \
+			&Prefix##Not, \
+			&Prefix##BinaryOp<BitKernelOp::Or>, \
+			{ &Prefix##ReverseBits<1>, &Prefix##ReverseBits<2>, &Prefix##ReverseBits<4>, &Prefix##ReverseBits<8> }, \
+			&Prefix##BinaryOp<BitKernelOp::Xor> \
+		}
+
+			switch (backend)
+			{
+#if defined(NAZARA_BITKERNELS_X86)
+				case BitKernelBackend::AVX2:
+					return NAZARA_BITKERNELS_TABLE(AVX2);
+
+				case BitKernelBackend::AVX512:
+					return NAZARA_BITKERNELS_TABLE(AVX512);
+#elif defined(NAZARA_BITKERNELS_NEON)
+				case BitKernelBackend::NEON:
+					return NAZARA_BITKERNELS_TABLE(NEON);
+#endif
+
+				default:
+					break;
+			}
+
+			backend = BitKernelBackend::Scalar;
+			return NAZARA_BITKERNELS_TABLE(Scalar);
+
+#undef NAZARA_BITKERNELS_TABLE
+		}
+
+		inline const BitKernelTable& GetBitKernelTable()
+		{
+			static const BitKernelTable table = BuildBitKernelTable(DetectBitKernelBackend());
+			return table;
+		}
+	}
+
+	namespace BitKernels
+	{
+		/*!
+		* \ingroup utils
+		* \brief Computes the bitwise AND of two byte ranges
+		*
+		* \param dst Destination bytes, may be the same as a or b (but should not partially overlap them)
+		* \param a First operand
+		* \param b Second operand
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::And
+		*/
+		inline void And(void* dst, const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::And(dst, a, b, byteCount);
+
+			Detail::GetBitKernelTable().andFunc(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Computes the bitwise AND of a byte range with the complement of another (a & ~b)
+		*
+		* \param dst Destination bytes, may be the same as a or b (but should not partially overlap them)
+		* \param a First operand
+		* \param b Second operand, negated
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::AndNot
+		*/
+		inline void AndNot(void* dst, const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::AndNot(dst, a, b, byteCount);
+
+			Detail::GetBitKernelTable().andNotFunc(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Counts the number of bits set to 1 in a byte range
+		*
+		* \param data Bytes to count
+		* \param byteCount Number of bytes to process
+		*
+		* \return Number of bits set to 1
+		*
+		* \see Scalar::Count
+		*/
+		inline std::size_t Count(const void* data, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::Count(data, byteCount);
+
+			return Detail::GetBitKernelTable().countFunc(static_cast<const UInt8*>(data), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Counts the number of bits set to 1 in both byte ranges, without storing the AND result
+		*
+		* \param a First operand
+		* \param b Second operand
+		* \param byteCount Number of bytes to process
+		*
+		* \return Number of bits set to 1 in (a & b)
+		*
+		* \see Scalar::CountAnd
+		*/
+		inline std::size_t CountAnd(const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::CountAnd(a, b, byteCount);
+
+			return Detail::GetBitKernelTable().countAndFunc(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Counts the number of bits set to 1 in a but not in b, without storing the result
+		*
+		* \param a First operand
+		* \param b Second operand, negated
+		* \param byteCount Number of bytes to process
+		*
+		* \return Number of bits set to 1 in (a & ~b)
+		*
+		* \see Scalar::CountAndNot
+		*/
+		inline std::size_t CountAndNot(const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::CountAndNot(a, b, byteCount);
+
+			return Detail::GetBitKernelTable().countAndNotFunc(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Finds the first non-zero byte of a byte range
+		*
+		* \param data Bytes to search
+		* \param byteCount Number of bytes to process
+		*
+		* \return Offset of the first non-zero byte, or byteCount if every byte is zero
+		*
+		* \see Scalar::FindFirstNonZero
+		*/
+		inline std::size_t FindFirstNonZero(const void* data, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::FindFirstNonZero(data, byteCount);
+
+			return Detail::GetBitKernelTable().findFirstNonZeroFunc(static_cast<const UInt8*>(data), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Returns the backend selected for this CPU
+		*
+		* The backend is selected once, on first use, depending on the instruction sets supported by the CPU.
+		* Defining NAZARA_BITKERNELS_NO_SIMD forces the scalar backend.
+		*/
+		inline BitKernelBackend GetBackend()
+		{
+			return Detail::GetBitKernelTable().backend;
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Checks if two byte ranges have at least one bit set in common
+		*
+		* \param a First operand
+		* \param b Second operand
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::Intersects
+		*/
+		inline bool Intersects(const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::Intersects(a, b, byteCount);
+
+			return Detail::GetBitKernelTable().intersectsFunc(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Checks if a byte range has at least one bit set which isn't set in another (a & ~b != 0)
+		*
+		* \param a First operand
+		* \param b Second operand, negated
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::IntersectsAndNot
+		*/
+		inline bool IntersectsAndNot(const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::IntersectsAndNot(a, b, byteCount);
+
+			return Detail::GetBitKernelTable().intersectsAndNotFunc(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Computes the bitwise NOT of a byte range
+		*
+		* \param dst Destination bytes, may be the same as src (but should not partially overlap it)
+		* \param src Bytes to negate
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::Not
+		*/
+		inline void Not(void* dst, const void* src, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::Not(dst, src, byteCount);
+
+			Detail::GetBitKernelTable().notFunc(static_cast<UInt8*>(dst), static_cast<const UInt8*>(src), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Computes the bitwise OR of two byte ranges
+		*
+		* \param dst Destination bytes, may be the same as a or b (but should not partially overlap them)
+		* \param a First operand
+		* \param b Second operand
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::Or
+		*/
+		inline void Or(void* dst, const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::Or(dst, a, b, byteCount);
+
+			Detail::GetBitKernelTable().orFunc(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Reverses the bit order of every element of a byte range
+		*
+		* \param dst Destination bytes, may be the same as src (but should not partially overlap it)
+		* \param src Elements to reverse
+		* \param byteCount Number of bytes to process, must be a multiple of elementSize
+		* \param elementSize Size of an element in bytes (1, 2, 4 or 8)
+		*
+		* \remark This gives the same result as calling ReverseBits on each element, whatever the platform endianness
+		*
+		* \see Scalar::ReverseBits
+		*/
+		inline void ReverseBits(void* dst, const void* src, std::size_t byteCount, std::size_t elementSize)
+		{
+			assert((elementSize == 1 || elementSize == 2 || elementSize == 4 || elementSize == 8) && "unsupported element size");
+			assert(byteCount % elementSize == 0);
+
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::ReverseBits(dst, src, byteCount, elementSize);
+
+			Detail::GetBitKernelTable().reverseBitsFuncs[IntegralLog2Pot(elementSize)](static_cast<UInt8*>(dst), static_cast<const UInt8*>(src), byteCount);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Computes the bitwise XOR of two byte ranges
+		*
+		* \param dst Destination bytes, may be the same as a or b (but should not partially overlap them)
+		* \param a First operand
+		* \param b Second operand
+		* \param byteCount Number of bytes to process
+		*
+		* \see Scalar::Xor
+		*/
+		inline void Xor(void* dst, const void* a, const void* b, std::size_t byteCount)
+		{
+			if (byteCount < Detail::BitKernelScalarThreshold)
+				return Scalar::Xor(dst, a, b, byteCount);
+
+			Detail::GetBitKernelTable().xorFunc(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+		}
+
+		namespace Scalar
+		{
+			inline void And(void* dst, const void* a, const void* b, std::size_t byteCount)
+			{
+				Detail::ScalarBinaryOp<Detail::BitKernelOp::And>(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline void AndNot(void* dst, const void* a, const void* b, std::size_t byteCount)
+			{
+				Detail::ScalarBinaryOp<Detail::BitKernelOp::AndNot>(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline std::size_t Count(const void* data, std::size_t byteCount)
+			{
+				return Detail::ScalarCount(static_cast<const UInt8*>(data), byteCount);
+			}
+
+			inline std::size_t CountAnd(const void* a, const void* b, std::size_t byteCount)
+			{
+				return Detail::ScalarCountBinaryOp<Detail::BitKernelOp::And>(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline std::size_t CountAndNot(const void* a, const void* b, std::size_t byteCount)
+			{
+				return Detail::ScalarCountBinaryOp<Detail::BitKernelOp::AndNot>(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline std::size_t FindFirstNonZero(const void* data, std::size_t byteCount)
+			{
+				return Detail::ScalarFindFirstNonZero(static_cast<const UInt8*>(data), byteCount);
+			}
+
+			inline bool Intersects(const void* a, const void* b, std::size_t byteCount)
+			{
+				return Detail::ScalarIntersects<Detail::BitKernelOp::And>(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline bool IntersectsAndNot(const void* a, const void* b, std::size_t byteCount)
+			{
+				return Detail::ScalarIntersects<Detail::BitKernelOp::AndNot>(static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline void Not(void* dst, const void* src, std::size_t byteCount)
+			{
+				Detail::ScalarNot(static_cast<UInt8*>(dst), static_cast<const UInt8*>(src), byteCount);
+			}
+
+			inline void Or(void* dst, const void* a, const void* b, std::size_t byteCount)
+			{
+				Detail::ScalarBinaryOp<Detail::BitKernelOp::Or>(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+
+			inline void ReverseBits(void* dst, const void* src, std::size_t byteCount, std::size_t elementSize)
+			{
+				UInt8* dstBytes = static_cast<UInt8*>(dst);
+				const UInt8* srcBytes = static_cast<const UInt8*>(src);
+
+				switch (elementSize)
+				{
+					case 1: return Detail::ScalarReverseBits<1>(dstBytes, srcBytes, byteCount);
+					case 2: return Detail::ScalarReverseBits<2>(dstBytes, srcBytes, byteCount);
+					case 4: return Detail::ScalarReverseBits<4>(dstBytes, srcBytes, byteCount);
+					case 8: return Detail::ScalarReverseBits<8>(dstBytes, srcBytes, byteCount);
+				}
+
+				assert(false && "unsupported element size");
+			}
+
+			inline void Xor(void* dst, const void* a, const void* b, std::size_t byteCount)
+			{
+				Detail::ScalarBinaryOp<Detail::BitKernelOp::Xor>(static_cast<UInt8*>(dst), static_cast<const UInt8*>(a), static_cast<const UInt8*>(b), byteCount);
+			}
+		}
+	}
+}
+
+#undef NAZARA_BITKERNELS_TARGET
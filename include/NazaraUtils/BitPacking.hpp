@@ -0,0 +1,47 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BITPACKING_HPP
+#define NAZARAUTILS_BITPACKING_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/ByteStream.hpp>
+
+#if !defined(NAZARA_BITPACKING_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_BITPACKING_X86
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_BITPACKING_NEON
+	#endif
+#endif
+
+namespace Nz
+{
+	enum class BitPackTransform
+	{
+		None,       //< values are packed as is
+		Delta,      //< differences between consecutive values are packed, for sorted values
+		ZigZag,     //< values are signed integers (stored as UInt32), small negative values are packed with few bits
+		ZigZagDelta //< zigzag-encoded differences between consecutive values, for slowly varying values
+	};
+
+	constexpr std::size_t BitPackBlockSize = 128;
+
+	inline std::size_t BitPack(const UInt32* values, std::size_t count, UInt32 bitWidth, void* output);
+	inline void BitUnpack(const void* input, std::size_t count, UInt32 bitWidth, UInt32* values);
+
+	inline UInt32 ComputeBitWidth(const UInt32* values, std::size_t count);
+
+	inline ByteStreamResult<void> DecodeBitPacked(ByteReader& reader, UInt32* values, std::size_t count, BitPackTransform transform = BitPackTransform::None);
+	inline ByteStreamResult<void> EncodeBitPacked(ByteWriter& writer, const UInt32* values, std::size_t count, BitPackTransform transform = BitPackTransform::None);
+
+	inline std::size_t GetBitPackedSize(std::size_t count, UInt32 bitWidth);
+	inline std::size_t GetMaxEncodedBitPackedSize(std::size_t count);
+}
+
+#include <NazaraUtils/BitPacking.inl>
+
+#endif // NAZARAUTILS_BITPACKING_HPP
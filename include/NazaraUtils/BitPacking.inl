@@ -0,0 +1,750 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+#if defined(NAZARA_BITPACKING_X86)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_BITPACKING_NEON)
+	#include <arm_neon.h>
+#endif
+
+#if defined(NAZARA_BITPACKING_X86) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_BITPACKING_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_BITPACKING_TARGET(features)
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// A block of BitPackBlockSize values is packed in the SIMD-BP128 layout: value i belongs to lane i % 4,
+		// each lane packs its 32 values in bitWidth little-endian 32-bit words, and the words of the four lanes are interleaved.
+		// Every backend produces this same layout, so packed data can be exchanged between machines
+		constexpr std::size_t BitPackLaneCount = 4;
+
+		using BitPackBlockFunc = void(*)(const UInt32* values, UInt8* output);
+		using BitUnpackBlockFunc = void(*)(const UInt8* input, UInt32* values);
+
+		inline UInt32 LoadBitPackWord(const UInt8* input)
+		{
+			UInt32 word;
+			std::memcpy(&word, input, sizeof(UInt32));
+
+			return LittleEndianToHost(word);
+		}
+
+		inline void StoreBitPackWord(UInt8* output, UInt32 word)
+		{
+			word = HostToLittleEndian(word);
+			std::memcpy(output, &word, sizeof(UInt32));
+		}
+
+		constexpr UInt32 ZigZagEncode(UInt32 value)
+		{
+			return (value << 1) ^ (UInt32(0) - (value >> 31));
+		}
+
+		constexpr UInt32 ZigZagDecode(UInt32 value)
+		{
+			return (value >> 1) ^ (UInt32(0) - (value & 1));
+		}
+
+		inline UInt32 ApplyBitPackTransform(const UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous, UInt32* output)
+		{
+			switch (transform)
+			{
+				case BitPackTransform::None:
+					std::copy(values, values + count, output);
+					break;
+
+				case BitPackTransform::Delta:
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						output[i] = values[i] - previous;
+						previous = values[i];
+					}
+					break;
+
+				case BitPackTransform::ZigZag:
+					for (std::size_t i = 0; i < count; ++i)
+						output[i] = ZigZagEncode(values[i]);
+					break;
+
+				case BitPackTransform::ZigZagDelta:
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						output[i] = ZigZagEncode(values[i] - previous);
+						previous = values[i];
+					}
+					break;
+			}
+
+			return previous;
+		}
+
+		// Values which don't fill a whole block are packed one after the other, least significant bit first, in ceil(count * bitWidth / 8) bytes
+		inline void PackBitStream(const UInt32* values, std::size_t count, UInt32 bitWidth, UInt8* output)
+		{
+			if (bitWidth == 0)
+				return;
+
+			UInt64 mask = (UInt64(1) << bitWidth) - 1;
+			UInt64 bits = 0;
+			UInt32 bitCount = 0;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				bits |= (values[i] & mask) << bitCount;
+				bitCount += bitWidth;
+				for (; bitCount >= 8; bitCount -= 8)
+				{
+					*output++ = static_cast<UInt8>(bits);
+					bits >>= 8;
+				}
+			}
+
+			if (bitCount > 0)
+				*output = static_cast<UInt8>(bits);
+		}
+
+		inline void UnpackBitStream(const UInt8* input, std::size_t count, UInt32 bitWidth, UInt32* values)
+		{
+			if (bitWidth == 0)
+			{
+				std::fill(values, values + count, UInt32(0));
+				return;
+			}
+
+			UInt64 mask = (UInt64(1) << bitWidth) - 1;
+			UInt64 bits = 0;
+			UInt32 bitCount = 0;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				for (; bitCount < bitWidth; bitCount += 8)
+					bits |= UInt64(*input++) << bitCount;
+
+				values[i] = static_cast<UInt32>(bits & mask);
+				bits >>= bitWidth;
+				bitCount -= bitWidth;
+			}
+		}
+
+		inline void ScalarPackBlock(const UInt32* values, UInt8* output, UInt32 bitWidth)
+		{
+			UInt64 mask = (UInt64(1) << bitWidth) - 1;
+			for (std::size_t lane = 0; lane < BitPackLaneCount; ++lane)
+			{
+				UInt64 bits = 0;
+				UInt32 bitCount = 0;
+				std::size_t wordIndex = 0;
+				for (std::size_t i = lane; i < BitPackBlockSize; i += BitPackLaneCount)
+				{
+					bits |= (values[i] & mask) << bitCount;
+					bitCount += bitWidth;
+					if (bitCount >= 32)
+					{
+						StoreBitPackWord(output + (wordIndex * BitPackLaneCount + lane) * sizeof(UInt32), static_cast<UInt32>(bits));
+						wordIndex++;
+
+						bits >>= 32;
+						bitCount -= 32;
+					}
+				}
+			}
+		}
+
+		inline void ScalarUnpackBlock(const UInt8* input, UInt32* values, UInt32 bitWidth)
+		{
+			UInt64 mask = (UInt64(1) << bitWidth) - 1;
+			for (std::size_t lane = 0; lane < BitPackLaneCount; ++lane)
+			{
+				UInt64 bits = 0;
+				UInt32 bitCount = 0;
+				std::size_t wordIndex = 0;
+				for (std::size_t i = lane; i < BitPackBlockSize; i += BitPackLaneCount)
+				{
+					if (bitCount < bitWidth)
+					{
+						bits |= UInt64(LoadBitPackWord(input + (wordIndex * BitPackLaneCount + lane) * sizeof(UInt32))) << bitCount;
+						wordIndex++;
+
+						bitCount += 32;
+					}
+
+					values[i] = static_cast<UInt32>(bits & mask);
+					bits >>= bitWidth;
+					bitCount -= bitWidth;
+				}
+			}
+		}
+
+		inline UInt32 ScalarDecodeTransform(UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous)
+		{
+			switch (transform)
+			{
+				case BitPackTransform::None:
+					break;
+
+				case BitPackTransform::Delta:
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						previous += values[i];
+						values[i] = previous;
+					}
+					break;
+
+				case BitPackTransform::ZigZag:
+					for (std::size_t i = 0; i < count; ++i)
+						values[i] = ZigZagDecode(values[i]);
+					break;
+
+				case BitPackTransform::ZigZagDelta:
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						previous += ZigZagDecode(values[i]);
+						values[i] = previous;
+					}
+					break;
+			}
+
+			return previous;
+		}
+
+#if defined(NAZARA_BITPACKING_X86)
+		// Kernels are instantiated for each bit width and fully unrolled (the 32 values of a lane use constant shifts and word offsets)
+		template<UInt32 BitWidth, UInt32 Index>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2PackStep(const UInt32* values, UInt8* output, __m128i mask, __m128i& word)
+		{
+			constexpr UInt32 shift = (Index * BitWidth) % 32;
+			constexpr UInt32 wordIndex = (Index * BitWidth) / 32;
+
+			__m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + Index * BitPackLaneCount)), mask);
+			if constexpr (shift == 0)
+				word = v;
+			else
+				word = _mm_or_si128(word, _mm_slli_epi32(v, shift));
+
+			if constexpr (shift + BitWidth >= 32)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + wordIndex * sizeof(__m128i)), word);
+				if constexpr (shift + BitWidth > 32)
+					word = _mm_srli_epi32(v, 32 - shift);
+			}
+		}
+
+		template<UInt32 BitWidth, UInt32... Index>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2PackSteps(const UInt32* values, UInt8* output, std::integer_sequence<UInt32, Index...>)
+		{
+			if constexpr (BitWidth > 0)
+			{
+				__m128i mask = _mm_set1_epi32(static_cast<int>((UInt64(1) << BitWidth) - 1));
+				__m128i word = _mm_setzero_si128();
+				(SSE2PackStep<BitWidth, Index>(values, output, mask, word), ...);
+			}
+		}
+
+		template<UInt32 BitWidth>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2PackBlockKernel(const UInt32* values, UInt8* output)
+		{
+			SSE2PackSteps<BitWidth>(values, output, std::make_integer_sequence<UInt32, 32>());
+		}
+
+		template<UInt32 BitWidth, UInt32 Index>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2UnpackStep(const UInt8* input, UInt32* values, __m128i mask)
+		{
+			constexpr UInt32 shift = (Index * BitWidth) % 32;
+			constexpr UInt32 wordIndex = (Index * BitWidth) / 32;
+
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + wordIndex * sizeof(__m128i)));
+			if constexpr (shift > 0)
+				v = _mm_srli_epi32(v, shift);
+
+			if constexpr (shift + BitWidth > 32)
+				v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + (wordIndex + 1) * sizeof(__m128i))), 32 - shift));
+
+			if constexpr (BitWidth < 32)
+				v = _mm_and_si128(v, mask);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values + Index * BitPackLaneCount), v);
+		}
+
+		template<UInt32 BitWidth, UInt32... Index>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2UnpackSteps(const UInt8* input, UInt32* values, std::integer_sequence<UInt32, Index...>)
+		{
+			if constexpr (BitWidth > 0)
+			{
+				__m128i mask = _mm_set1_epi32(static_cast<int>((UInt64(1) << BitWidth) - 1));
+				(SSE2UnpackStep<BitWidth, Index>(input, values, mask), ...);
+			}
+			else
+			{
+				__m128i zero = _mm_setzero_si128();
+				((_mm_storeu_si128(reinterpret_cast<__m128i*>(values + Index * BitPackLaneCount), zero)), ...);
+			}
+		}
+
+		template<UInt32 BitWidth>
+		NAZARA_BITPACKING_TARGET("sse2") void SSE2UnpackBlockKernel(const UInt8* input, UInt32* values)
+		{
+			SSE2UnpackSteps<BitWidth>(input, values, std::make_integer_sequence<UInt32, 32>());
+		}
+
+		template<UInt32... BitWidth>
+		void SSE2PackBlockTable(const UInt32* values, UInt8* output, UInt32 bitWidth, std::integer_sequence<UInt32, BitWidth...>)
+		{
+			static constexpr BitPackBlockFunc kernels[] = { &SSE2PackBlockKernel<BitWidth>... };
+			kernels[bitWidth](values, output);
+		}
+
+		inline void SSE2PackBlock(const UInt32* values, UInt8* output, UInt32 bitWidth)
+		{
+			SSE2PackBlockTable(values, output, bitWidth, std::make_integer_sequence<UInt32, 33>());
+		}
+
+		template<UInt32... BitWidth>
+		void SSE2UnpackBlockTable(const UInt8* input, UInt32* values, UInt32 bitWidth, std::integer_sequence<UInt32, BitWidth...>)
+		{
+			static constexpr BitUnpackBlockFunc kernels[] = { &SSE2UnpackBlockKernel<BitWidth>... };
+			kernels[bitWidth](input, values);
+		}
+
+		inline void SSE2UnpackBlock(const UInt8* input, UInt32* values, UInt32 bitWidth)
+		{
+			SSE2UnpackBlockTable(input, values, bitWidth, std::make_integer_sequence<UInt32, 33>());
+		}
+
+		template<bool ZigZag, bool Delta>
+		NAZARA_BITPACKING_TARGET("sse2") UInt32 SSE2DecodeTransformKernel(UInt32* values, std::size_t count, UInt32 previous)
+		{
+			__m128i one = _mm_set1_epi32(1);
+			__m128i last = _mm_set1_epi32(static_cast<int>(previous));
+
+			std::size_t i = 0;
+			for (; i + BitPackLaneCount <= count; i += BitPackLaneCount)
+			{
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+				if constexpr (ZigZag)
+					v = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+
+				if constexpr (Delta)
+				{
+					// Prefix sum of the four lanes (in log2(4) steps), plus the last value of the previous vector
+					v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+					v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+					v = _mm_add_epi32(v, last);
+					last = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+				}
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), v);
+			}
+
+			previous = static_cast<UInt32>(_mm_cvtsi128_si32(last));
+			return ScalarDecodeTransform(values + i, count - i, (ZigZag) ? ((Delta) ? BitPackTransform::ZigZagDelta : BitPackTransform::ZigZag) : BitPackTransform::Delta, previous);
+		}
+
+		inline UInt32 SSE2DecodeTransform(UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous)
+		{
+			switch (transform)
+			{
+				case BitPackTransform::None:        return previous;
+				case BitPackTransform::Delta:       return SSE2DecodeTransformKernel<false, true>(values, count, previous);
+				case BitPackTransform::ZigZag:      return SSE2DecodeTransformKernel<true, false>(values, count, previous);
+				case BitPackTransform::ZigZagDelta: return SSE2DecodeTransformKernel<true, true>(values, count, previous);
+			}
+
+			NAZARA_UNREACHABLE();
+		}
+#elif defined(NAZARA_BITPACKING_NEON)
+		template<UInt32 BitWidth, UInt32 Index>
+		void NEONPackStep(const UInt32* values, UInt8* output, uint32x4_t mask, uint32x4_t& word)
+		{
+			constexpr UInt32 shift = (Index * BitWidth) % 32;
+			constexpr UInt32 wordIndex = (Index * BitWidth) / 32;
+
+			uint32x4_t v = vandq_u32(vld1q_u32(values + Index * BitPackLaneCount), mask);
+			if constexpr (shift == 0)
+				word = v;
+			else
+				word = vorrq_u32(word, vshlq_n_u32(v, shift));
+
+			if constexpr (shift + BitWidth >= 32)
+			{
+				vst1q_u32(reinterpret_cast<UInt32*>(output) + wordIndex * BitPackLaneCount, word);
+				if constexpr (shift + BitWidth > 32)
+					word = vshrq_n_u32(v, 32 - shift);
+			}
+		}
+
+		template<UInt32 BitWidth, UInt32... Index>
+		void NEONPackSteps(const UInt32* values, UInt8* output, std::integer_sequence<UInt32, Index...>)
+		{
+			if constexpr (BitWidth > 0)
+			{
+				uint32x4_t mask = vdupq_n_u32(static_cast<UInt32>((UInt64(1) << BitWidth) - 1));
+				uint32x4_t word = vdupq_n_u32(0);
+				(NEONPackStep<BitWidth, Index>(values, output, mask, word), ...);
+			}
+		}
+
+		template<UInt32 BitWidth>
+		void NEONPackBlockKernel(const UInt32* values, UInt8* output)
+		{
+			NEONPackSteps<BitWidth>(values, output, std::make_integer_sequence<UInt32, 32>());
+		}
+
+		template<UInt32 BitWidth, UInt32 Index>
+		void NEONUnpackStep(const UInt8* input, UInt32* values, uint32x4_t mask)
+		{
+			constexpr UInt32 shift = (Index * BitWidth) % 32;
+			constexpr UInt32 wordIndex = (Index * BitWidth) / 32;
+
+			const UInt32* words = reinterpret_cast<const UInt32*>(input);
+			uint32x4_t v = vld1q_u32(words + wordIndex * BitPackLaneCount);
+			if constexpr (shift > 0)
+				v = vshrq_n_u32(v, shift);
+
+			if constexpr (shift + BitWidth > 32)
+				v = vorrq_u32(v, vshlq_n_u32(vld1q_u32(words + (wordIndex + 1) * BitPackLaneCount), 32 - shift));
+
+			if constexpr (BitWidth < 32)
+				v = vandq_u32(v, mask);
+
+			vst1q_u32(values + Index * BitPackLaneCount, v);
+		}
+
+		template<UInt32 BitWidth, UInt32... Index>
+		void NEONUnpackSteps(const UInt8* input, UInt32* values, std::integer_sequence<UInt32, Index...>)
+		{
+			if constexpr (BitWidth > 0)
+			{
+				uint32x4_t mask = vdupq_n_u32(static_cast<UInt32>((UInt64(1) << BitWidth) - 1));
+				(NEONUnpackStep<BitWidth, Index>(input, values, mask), ...);
+			}
+			else
+			{
+				uint32x4_t zero = vdupq_n_u32(0);
+				(vst1q_u32(values + Index * BitPackLaneCount, zero), ...);
+			}
+		}
+
+		template<UInt32 BitWidth>
+		void NEONUnpackBlockKernel(const UInt8* input, UInt32* values)
+		{
+			NEONUnpackSteps<BitWidth>(input, values, std::make_integer_sequence<UInt32, 32>());
+		}
+
+		template<UInt32... BitWidth>
+		void NEONPackBlockTable(const UInt32* values, UInt8* output, UInt32 bitWidth, std::integer_sequence<UInt32, BitWidth...>)
+		{
+			static constexpr BitPackBlockFunc kernels[] = { &NEONPackBlockKernel<BitWidth>... };
+			kernels[bitWidth](values, output);
+		}
+
+		inline void NEONPackBlock(const UInt32* values, UInt8* output, UInt32 bitWidth)
+		{
+			NEONPackBlockTable(values, output, bitWidth, std::make_integer_sequence<UInt32, 33>());
+		}
+
+		template<UInt32... BitWidth>
+		void NEONUnpackBlockTable(const UInt8* input, UInt32* values, UInt32 bitWidth, std::integer_sequence<UInt32, BitWidth...>)
+		{
+			static constexpr BitUnpackBlockFunc kernels[] = { &NEONUnpackBlockKernel<BitWidth>... };
+			kernels[bitWidth](input, values);
+		}
+
+		inline void NEONUnpackBlock(const UInt8* input, UInt32* values, UInt32 bitWidth)
+		{
+			NEONUnpackBlockTable(input, values, bitWidth, std::make_integer_sequence<UInt32, 33>());
+		}
+
+		template<bool ZigZag, bool Delta>
+		UInt32 NEONDecodeTransformKernel(UInt32* values, std::size_t count, UInt32 previous)
+		{
+			uint32x4_t zero = vdupq_n_u32(0);
+			uint32x4_t one = vdupq_n_u32(1);
+			uint32x4_t last = vdupq_n_u32(previous);
+
+			std::size_t i = 0;
+			for (; i + BitPackLaneCount <= count; i += BitPackLaneCount)
+			{
+				uint32x4_t v = vld1q_u32(values + i);
+				if constexpr (ZigZag)
+					v = veorq_u32(vshrq_n_u32(v, 1), vsubq_u32(zero, vandq_u32(v, one)));
+
+				if constexpr (Delta)
+				{
+					v = vaddq_u32(v, vextq_u32(zero, v, 3));
+					v = vaddq_u32(v, vextq_u32(zero, v, 2));
+					v = vaddq_u32(v, last);
+					last = vdupq_laneq_u32(v, 3);
+				}
+
+				vst1q_u32(values + i, v);
+			}
+
+			previous = vgetq_lane_u32(last, 0);
+			return ScalarDecodeTransform(values + i, count - i, (ZigZag) ? ((Delta) ? BitPackTransform::ZigZagDelta : BitPackTransform::ZigZag) : BitPackTransform::Delta, previous);
+		}
+
+		inline UInt32 NEONDecodeTransform(UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous)
+		{
+			switch (transform)
+			{
+				case BitPackTransform::None:        return previous;
+				case BitPackTransform::Delta:       return NEONDecodeTransformKernel<false, true>(values, count, previous);
+				case BitPackTransform::ZigZag:      return NEONDecodeTransformKernel<true, false>(values, count, previous);
+				case BitPackTransform::ZigZagDelta: return NEONDecodeTransformKernel<true, true>(values, count, previous);
+			}
+
+			NAZARA_UNREACHABLE();
+		}
+#endif
+
+		using PackBlockFunc = void(*)(const UInt32* values, UInt8* output, UInt32 bitWidth);
+		using UnpackBlockFunc = void(*)(const UInt8* input, UInt32* values, UInt32 bitWidth);
+		using DecodeTransformFunc = UInt32(*)(UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous);
+
+		constexpr PackBlockFunc SelectPackBlock([[maybe_unused]] const CpuFeatures& features)
+		{
+#if defined(NAZARA_BITPACKING_X86)
+			return (features.sse2) ? &SSE2PackBlock : &ScalarPackBlock;
+#elif defined(NAZARA_BITPACKING_NEON)
+			return &NEONPackBlock;
+#else
+			return &ScalarPackBlock;
+#endif
+		}
+
+		constexpr UnpackBlockFunc SelectUnpackBlock([[maybe_unused]] const CpuFeatures& features)
+		{
+#if defined(NAZARA_BITPACKING_X86)
+			return (features.sse2) ? &SSE2UnpackBlock : &ScalarUnpackBlock;
+#elif defined(NAZARA_BITPACKING_NEON)
+			return &NEONUnpackBlock;
+#else
+			return &ScalarUnpackBlock;
+#endif
+		}
+
+		constexpr DecodeTransformFunc SelectDecodeTransform([[maybe_unused]] const CpuFeatures& features)
+		{
+#if defined(NAZARA_BITPACKING_X86)
+			return (features.sse2) ? &SSE2DecodeTransform : &ScalarDecodeTransform;
+#elif defined(NAZARA_BITPACKING_NEON)
+			return &NEONDecodeTransform;
+#else
+			return &ScalarDecodeTransform;
+#endif
+		}
+
+		inline void PackBlock(const UInt32* values, UInt8* output, UInt32 bitWidth)
+		{
+			CpuDispatch<void(const UInt32*, UInt8*, UInt32), &SelectPackBlock>::Call(values, output, bitWidth);
+		}
+
+		inline void UnpackBlock(const UInt8* input, UInt32* values, UInt32 bitWidth)
+		{
+			CpuDispatch<void(const UInt8*, UInt32*, UInt32), &SelectUnpackBlock>::Call(input, values, bitWidth);
+		}
+
+		inline UInt32 DecodeTransform(UInt32* values, std::size_t count, BitPackTransform transform, UInt32 previous)
+		{
+			return CpuDispatch<UInt32(UInt32*, std::size_t, BitPackTransform, UInt32), &SelectDecodeTransform>::Call(values, count, transform, previous);
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Packs integers using a fixed number of bits per value
+	* \return Number of bytes written (see GetBitPackedSize)
+	*
+	* Whole blocks of BitPackBlockSize values are packed in the SIMD-BP128 layout (each block takes 16 * bitWidth bytes, using SSE2 or NEON when available),
+	* the remaining values are packed one after the other. The output is the same on every platform.
+	*
+	* \param values Values to pack, bits above bitWidth are ignored
+	* \param count Number of values to pack
+	* \param bitWidth Number of bits per value, from 0 to 32 (see ComputeBitWidth)
+	* \param output Buffer of at least GetBitPackedSize(count, bitWidth) bytes, with no alignment requirement
+	*
+	* \see BitUnpack, EncodeBitPacked
+	*/
+	inline std::size_t BitPack(const UInt32* values, std::size_t count, UInt32 bitWidth, void* output)
+	{
+		assert(bitWidth <= 32);
+
+		UInt8* outputPtr = static_cast<UInt8*>(output);
+		std::size_t blockByteSize = bitWidth * Detail::BitPackLaneCount * sizeof(UInt32);
+
+		std::size_t i = 0;
+		for (; i + BitPackBlockSize <= count; i += BitPackBlockSize)
+		{
+			Detail::PackBlock(values + i, outputPtr, bitWidth);
+			outputPtr += blockByteSize;
+		}
+
+		Detail::PackBitStream(values + i, count - i, bitWidth, outputPtr);
+
+		return GetBitPackedSize(count, bitWidth);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Unpacks integers packed by BitPack
+	*
+	* \param input Packed values, of GetBitPackedSize(count, bitWidth) bytes
+	* \param count Number of values to unpack
+	* \param bitWidth Number of bits per value used to pack them
+	* \param values Output values
+	*
+	* \see BitPack, DecodeBitPacked
+	*/
+	inline void BitUnpack(const void* input, std::size_t count, UInt32 bitWidth, UInt32* values)
+	{
+		assert(bitWidth <= 32);
+
+		const UInt8* inputPtr = static_cast<const UInt8*>(input);
+		std::size_t blockByteSize = bitWidth * Detail::BitPackLaneCount * sizeof(UInt32);
+
+		std::size_t i = 0;
+		for (; i + BitPackBlockSize <= count; i += BitPackBlockSize)
+		{
+			Detail::UnpackBlock(inputPtr, values + i, bitWidth);
+			inputPtr += blockByteSize;
+		}
+
+		Detail::UnpackBitStream(inputPtr, count - i, bitWidth, values + i);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of bits required to store every value
+	* \return Number of bits of the highest value, from 0 (every value is zero) to 32
+	*
+	* \param values Values to check
+	* \param count Number of values
+	*/
+	inline UInt32 ComputeBitWidth(const UInt32* values, std::size_t count)
+	{
+		UInt32 bits = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			bits |= values[i];
+
+		return (bits != 0) ? IntegralLog2(bits) + 1 : 0;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Decodes integers written by EncodeBitPacked
+	* \return Nothing, or an error if the data is truncated or corrupted
+	*
+	* \param reader Reader to read the packed values from
+	* \param values Output values
+	* \param count Number of values to decode, which must be the number of encoded values
+	* \param transform Transform used to encode the values
+	*
+	* \remark On failure, values may have been partially written
+	*
+	* \see EncodeBitPacked
+	*/
+	inline ByteStreamResult<void> DecodeBitPacked(ByteReader& reader, UInt32* values, std::size_t count, BitPackTransform transform)
+	{
+		UInt32 previous = 0;
+		for (std::size_t offset = 0; offset < count; offset += BitPackBlockSize)
+		{
+			std::size_t blockCount = std::min(count - offset, BitPackBlockSize);
+
+			NAZARA_TRY_VALUE(UInt8 bitWidth, reader.Read<UInt8>());
+			if NAZARA_UNLIKELY(bitWidth > 32)
+				return Err(ByteStreamError::InvalidData);
+
+			NAZARA_TRY_VALUE(const UInt8* packedValues, reader.ReadBytes(GetBitPackedSize(blockCount, bitWidth)));
+			BitUnpack(packedValues, blockCount, bitWidth, values + offset);
+
+			if (transform != BitPackTransform::None)
+				previous = Detail::DecodeTransform(values + offset, blockCount, transform, previous);
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Encodes integers by blocks of BitPackBlockSize values, each block using the fewest bits per value it can
+	* \return Nothing or ByteStreamError::EndOfBuffer
+	*
+	* Each block is written as its bit width (one byte) followed by its values packed by BitPack, the last block holding the remaining values.
+	* The count of values is not written.
+	*
+	* \param writer Writer to write the packed values to, the packed values are always little-endian
+	* \param values Values to encode
+	* \param count Number of values to encode
+	* \param transform Transform applied to the values before packing them, to reduce their bit width
+	*
+	* \see DecodeBitPacked, GetMaxEncodedBitPackedSize
+	*/
+	inline ByteStreamResult<void> EncodeBitPacked(ByteWriter& writer, const UInt32* values, std::size_t count, BitPackTransform transform)
+	{
+		UInt32 transformedValues[BitPackBlockSize];
+
+		UInt32 previous = 0;
+		for (std::size_t offset = 0; offset < count; offset += BitPackBlockSize)
+		{
+			std::size_t blockCount = std::min(count - offset, BitPackBlockSize);
+
+			const UInt32* blockValues = values + offset;
+			if (transform != BitPackTransform::None)
+			{
+				previous = Detail::ApplyBitPackTransform(blockValues, blockCount, transform, previous, transformedValues);
+				blockValues = transformedValues;
+			}
+
+			UInt32 bitWidth = ComputeBitWidth(blockValues, blockCount);
+			NAZARA_TRY(writer.Write(static_cast<UInt8>(bitWidth)));
+
+			NAZARA_TRY_VALUE(UInt8* packedValues, writer.Skip(GetBitPackedSize(blockCount, bitWidth)));
+			BitPack(blockValues, blockCount, bitWidth, packedValues);
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the number of bytes written by BitPack
+	*
+	* \param count Number of values
+	* \param bitWidth Number of bits per value
+	*/
+	inline std::size_t GetBitPackedSize(std::size_t count, UInt32 bitWidth)
+	{
+		std::size_t blockCount = count / BitPackBlockSize;
+		std::size_t remainingCount = count % BitPackBlockSize;
+
+		return blockCount * bitWidth * Detail::BitPackLaneCount * sizeof(UInt32) + (remainingCount * bitWidth + 7) / 8;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the maximum number of bytes written by EncodeBitPacked, when every value needs 32 bits
+	*
+	* \param count Number of values
+	*/
+	inline std::size_t GetMaxEncodedBitPackedSize(std::size_t count)
+	{
+		std::size_t blockCount = (count + BitPackBlockSize - 1) / BitPackBlockSize;
+		return blockCount + count * sizeof(UInt32);
+	}
+}
+
+#undef NAZARA_BITPACKING_TARGET
@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BITSTREAM_HPP
+#define NAZARAUTILS_BITSTREAM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/ByteStream.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	// Reads bit fields from a non-owning byte buffer
+	class BitReader
+	{
+		public:
+			inline BitReader(const void* data, std::size_t size);
+			BitReader(const BitReader&) = default;
+			~BitReader() = default;
+
+			inline void AlignToByte();
+
+			inline std::size_t GetBitCursor() const;
+			inline const UInt8* GetData() const;
+			inline std::size_t GetRemainingBits() const;
+			inline std::size_t GetSize() const;
+
+			template<typename T = UInt64> ByteStreamResult<T> Read(unsigned int bitCount);
+
+			inline ByteStreamResult<void> Skip(std::size_t bitCount);
+
+			BitReader& operator=(const BitReader&) = default;
+
+		private:
+			inline UInt64 ReadBits(unsigned int bitCount);
+			inline void Refill();
+
+			const UInt8* m_data;
+			std::size_t m_byteCursor; //< next byte to load in m_bits
+			std::size_t m_size;
+			UInt64 m_bits;            //< loaded bits, the next one being the least significant
+			unsigned int m_bitCount;  //< number of bits loaded in m_bits
+	};
+
+	// Writes bit fields to a non-owning byte buffer
+	class BitWriter
+	{
+		public:
+			inline BitWriter(void* data, std::size_t size);
+			BitWriter(const BitWriter&) = default;
+			~BitWriter() = default;
+
+			inline void AlignToByte();
+
+			inline std::size_t Flush();
+
+			inline std::size_t GetBitCursor() const;
+			inline UInt8* GetData() const;
+			inline std::size_t GetRemainingBits() const;
+			inline std::size_t GetSize() const;
+
+			template<typename T> ByteStreamResult<void> Write(T value, unsigned int bitCount);
+
+			BitWriter& operator=(const BitWriter&) = default;
+
+		private:
+			inline void StoreBits();
+			inline ByteStreamResult<void> WriteBits(UInt64 value, unsigned int bitCount);
+
+			UInt8* m_data;
+			std::size_t m_byteCursor; //< next byte to store m_bits to
+			std::size_t m_size;
+			UInt64 m_bits;            //< pending bits, not yet stored in the buffer
+			unsigned int m_bitCount;  //< number of pending bits in m_bits (less than 64)
+	};
+}
+
+#include <NazaraUtils/BitStream.inl>
+
+#endif // NAZARAUTILS_BITSTREAM_HPP
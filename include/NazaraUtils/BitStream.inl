@@ -0,0 +1,324 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T>
+		constexpr void CheckBitStreamType()
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "only integral and enum types can be read/written as bit fields");
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::BitReader
+	* \brief Reads bit fields written by BitWriter from a non-owning byte buffer, with bounds checking
+	*
+	* Bytes are loaded eight at a time in a 64-bit register, reading a field only takes a few shifts and masks, and nothing is ever allocated.
+	* Reading past the end of the buffer fails with ByteStreamError::EndOfBuffer and doesn't move the cursor.
+	*
+	* \see BitWriter, ByteReader
+	*/
+
+	/*!
+	* \brief Constructs a reader over a buffer
+	*
+	* \param data Pointer to the buffer
+	* \param size Size of the buffer in bytes
+	*/
+	inline BitReader::BitReader(const void* data, std::size_t size) :
+	m_data(static_cast<const UInt8*>(data)),
+	m_byteCursor(0),
+	m_size(size),
+	m_bits(0),
+	m_bitCount(0)
+	{
+		assert(data || size == 0);
+	}
+
+	/*!
+	* \brief Skips the remaining bits of the current byte, to read the padding added by BitWriter::AlignToByte
+	*/
+	inline void BitReader::AlignToByte()
+	{
+		// Bits are loaded by whole bytes, the bits of the current byte are the loaded bits in excess of a multiple of 8
+		unsigned int bitCount = m_bitCount % 8;
+		m_bits >>= bitCount;
+		m_bitCount -= bitCount;
+	}
+
+	/*!
+	* \brief Returns the number of bits read since the beginning of the buffer
+	*/
+	inline std::size_t BitReader::GetBitCursor() const
+	{
+		return m_byteCursor * 8 - m_bitCount;
+	}
+
+	inline const UInt8* BitReader::GetData() const
+	{
+		return m_data;
+	}
+
+	inline std::size_t BitReader::GetRemainingBits() const
+	{
+		return (m_size - m_byteCursor) * 8 + m_bitCount;
+	}
+
+	inline std::size_t BitReader::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Reads a bit field
+	* \return The value or ByteStreamError::EndOfBuffer
+	*
+	* Signed values are sign-extended from their most significant bit (see BitWriter::Write).
+	*
+	* \param bitCount Number of bits of the field, at most the number of bits of T (up to 64)
+	*/
+	template<typename T>
+	ByteStreamResult<T> BitReader::Read(unsigned int bitCount)
+	{
+		Detail::CheckBitStreamType<T>();
+		assert(bitCount <= BitCount<T>());
+
+		if NAZARA_UNLIKELY(bitCount > GetRemainingBits())
+			return Err(ByteStreamError::EndOfBuffer);
+
+		UInt64 value = ReadBits(bitCount);
+		if constexpr (std::is_same_v<T, bool>)
+			return value != 0;
+		else
+		{
+			if constexpr (Detail::IsSignedVarInt<T>)
+			{
+				if (bitCount > 0 && bitCount < 64)
+				{
+					UInt64 signBit = UInt64(1) << (bitCount - 1);
+					value = (value ^ signBit) - signBit;
+				}
+			}
+
+			return static_cast<T>(static_cast<Detail::VarIntType<T>>(value));
+		}
+	}
+
+	/*!
+	* \brief Skips bits
+	* \return Nothing or ByteStreamError::EndOfBuffer (in which case the cursor doesn't move)
+	*
+	* \param bitCount Number of bits to skip
+	*/
+	inline ByteStreamResult<void> BitReader::Skip(std::size_t bitCount)
+	{
+		if NAZARA_UNLIKELY(bitCount > GetRemainingBits())
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (bitCount <= m_bitCount)
+		{
+			ReadBits(static_cast<unsigned int>(bitCount));
+			return Ok();
+		}
+
+		bitCount -= m_bitCount;
+		m_bits = 0;
+		m_bitCount = 0;
+
+		m_byteCursor += bitCount / 8;
+		ReadBits(static_cast<unsigned int>(bitCount % 8));
+
+		return Ok();
+	}
+
+	inline UInt64 BitReader::ReadBits(unsigned int bitCount)
+	{
+		// A refill guarantees at least 57 bits (unless the end of the buffer is reached), wider fields are read in two parts
+		if (bitCount > 56)
+		{
+			UInt64 low = ReadBits(32);
+			return low | (ReadBits(bitCount - 32) << 32);
+		}
+
+		if (m_bitCount < bitCount)
+			Refill();
+
+		UInt64 value = m_bits & ((UInt64(1) << bitCount) - 1);
+		m_bits >>= bitCount;
+		m_bitCount -= bitCount;
+
+		return value;
+	}
+
+	inline void BitReader::Refill()
+	{
+		assert(m_bitCount < 64);
+
+		if NAZARA_LIKELY(m_size - m_byteCursor >= sizeof(UInt64))
+		{
+			UInt64 word;
+			std::memcpy(&word, &m_data[m_byteCursor], sizeof(UInt64));
+
+			// Only whole bytes are counted as loaded, the bits of a partially loaded byte are loaded again (at the same place) by the next refill
+			m_bits |= LittleEndianToHost(word) << m_bitCount;
+
+			unsigned int byteCount = (64 - m_bitCount) / 8;
+			m_byteCursor += byteCount;
+			m_bitCount += byteCount * 8;
+		}
+		else
+		{
+			for (; m_bitCount <= 56 && m_byteCursor < m_size; m_bitCount += 8)
+				m_bits |= UInt64(m_data[m_byteCursor++]) << m_bitCount;
+		}
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::BitWriter
+	* \brief Writes bit fields to a non-owning byte buffer, with bounds checking
+	*
+	* Fields are packed least significant bit first, and accumulated in a 64-bit register stored to the buffer each time it fills up:
+	* writing a field only takes a few shifts and ors, and nothing is ever allocated.
+	* Writing past the end of the buffer fails with ByteStreamError::EndOfBuffer and doesn't move the cursor.
+	*
+	* \remark Flush must be called once every field is written, to store the last pending bits to the buffer
+	* \see BitReader, ByteWriter
+	*/
+
+	/*!
+	* \brief Constructs a writer over a buffer
+	*
+	* \param data Pointer to the buffer
+	* \param size Size of the buffer in bytes
+	*/
+	inline BitWriter::BitWriter(void* data, std::size_t size) :
+	m_data(static_cast<UInt8*>(data)),
+	m_byteCursor(0),
+	m_size(size),
+	m_bits(0),
+	m_bitCount(0)
+	{
+		assert(data || size == 0);
+	}
+
+	/*!
+	* \brief Pads the current byte with zero bits, so that the next field starts on a byte boundary
+	*/
+	inline void BitWriter::AlignToByte()
+	{
+		// Pending bits above m_bitCount are always zero
+		m_bitCount = (m_bitCount + 7) & ~7u;
+		if (m_bitCount == 64)
+			StoreBits();
+	}
+
+	/*!
+	* \brief Stores the pending bits to the buffer, padding the last byte with zero bits
+	* \return Number of bytes of the buffer used so far
+	*
+	* The writer is then aligned to a byte boundary and can still be used.
+	*/
+	inline std::size_t BitWriter::Flush()
+	{
+		unsigned int byteCount = (m_bitCount + 7) / 8;
+		for (unsigned int i = 0; i < byteCount; ++i)
+			m_data[m_byteCursor++] = static_cast<UInt8>(m_bits >> (i * 8));
+
+		m_bits = 0;
+		m_bitCount = 0;
+
+		return m_byteCursor;
+	}
+
+	/*!
+	* \brief Returns the number of bits written since the beginning of the buffer
+	*/
+	inline std::size_t BitWriter::GetBitCursor() const
+	{
+		return m_byteCursor * 8 + m_bitCount;
+	}
+
+	inline UInt8* BitWriter::GetData() const
+	{
+		return m_data;
+	}
+
+	inline std::size_t BitWriter::GetRemainingBits() const
+	{
+		return (m_size - m_byteCursor) * 8 - m_bitCount;
+	}
+
+	inline std::size_t BitWriter::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Writes a bit field
+	* \return Nothing or ByteStreamError::EndOfBuffer
+	*
+	* Only the bitCount least significant bits of the value are written, signed values are written in two's complement.
+	*
+	* \param value Value of the field
+	* \param bitCount Number of bits of the field, at most the number of bits of T (up to 64)
+	*/
+	template<typename T>
+	ByteStreamResult<void> BitWriter::Write(T value, unsigned int bitCount)
+	{
+		Detail::CheckBitStreamType<T>();
+		assert(bitCount <= BitCount<T>());
+
+		if constexpr (std::is_same_v<T, bool>)
+			return WriteBits((value) ? 1 : 0, bitCount);
+		else
+			return WriteBits(static_cast<UInt64>(static_cast<Detail::VarIntType<T>>(value)), bitCount);
+	}
+
+	inline void BitWriter::StoreBits()
+	{
+		UInt64 word = HostToLittleEndian(m_bits);
+		std::memcpy(&m_data[m_byteCursor], &word, sizeof(UInt64));
+		m_byteCursor += sizeof(UInt64);
+
+		m_bits = 0;
+		m_bitCount = 0;
+	}
+
+	inline ByteStreamResult<void> BitWriter::WriteBits(UInt64 value, unsigned int bitCount)
+	{
+		if NAZARA_UNLIKELY(bitCount > GetRemainingBits())
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (bitCount < 64)
+			value &= (UInt64(1) << bitCount) - 1;
+
+		m_bits |= value << m_bitCount;
+
+		unsigned int bitCursor = m_bitCount + bitCount;
+		if (bitCursor >= 64)
+		{
+			// The register is full (the bounds check ensures the buffer has room for it), keep the bits of the value which didn't fit
+			unsigned int storedBitCount = 64 - m_bitCount;
+			StoreBits();
+
+			m_bits = (storedBitCount < 64) ? value >> storedBitCount : 0;
+			m_bitCount = bitCursor - 64;
+		}
+		else
+			m_bitCount = bitCursor;
+
+		return Ok();
+	}
+}
@@ -8,7 +8,11 @@
 #define NAZARAUTILS_BITSET_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/BitKernels.hpp>
+#include <NazaraUtils/ByteStream.hpp>
 #include <NazaraUtils/MathUtils.hpp>
+#include <array>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string>
@@ -17,7 +21,18 @@
 
 namespace Nz
 {
-	template<typename Block = UInt32, class Allocator = std::allocator<Block>>
+	namespace Detail
+	{
+		// Block algorithms shared between Bitset and StaticBitset
+		template<typename Block> NAZARA_CONSTEXPR20 std::size_t CountBlockBits(const Block* blocks, std::size_t blockCount);
+		template<typename Block> NAZARA_CONSTEXPR20 std::size_t FindFirstBlockBit(const Block* blocks, std::size_t blockCount, std::size_t firstBlock);
+		template<typename Block> NAZARA_CONSTEXPR20 std::size_t FindNextBlockBit(const Block* blocks, std::size_t blockCount, std::size_t bitCount, std::size_t bit);
+
+		// Block access for the parallel algorithms working on block ranges (see ParallelAlgorithm.hpp)
+		struct BitsetParallelAccess;
+	}
+
+	template<typename Block = UInt32, class Allocator = std::allocator<Block>, std::size_t InlineBlockCount = 0>
 	class Bitset
 	{
 		static_assert(std::is_integral<Block>::value && std::is_unsigned<Block>::value, "Block must be a unsigned integral type");
@@ -25,11 +40,13 @@ namespace Nz
 		public:
 			class Bit;
 			class BitIterator;
+			class RankIndex;
 			using PointerSequence = std::pair<const void*, std::size_t>; //< Start pointer, bit offset
 			struct bits_const_iter_tag;
 
 			Bitset();
-			explicit Bitset(std::size_t bitCount, bool val);
+			explicit Bitset(const Allocator& allocator);
+			explicit Bitset(std::size_t bitCount, bool val, const Allocator& allocator = Allocator());
 			explicit Bitset(const char* bits);
 			Bitset(const char* bits, std::size_t bitCount);
 			Bitset(const Bitset& bitset) = default;
@@ -40,25 +57,36 @@ namespace Nz
 			~Bitset() noexcept = default;
 
 			template<typename T> void AppendBits(T bits, std::size_t bitCount);
+			ByteStreamResult<void> ApplyDelta(ByteReader& reader, std::size_t maxBitCount = DefaultDeltaMaxBitCount);
+
+			RankIndex BuildRankIndex() const;
 
 			void Clear() noexcept;
 			std::size_t Count() const;
+			std::size_t CountAnd(const Bitset& bitset) const;
+			std::size_t CountAndNot(const Bitset& bitset) const;
+			template<typename OutputIt> OutputIt ExtractSetBits(OutputIt output, std::size_t startBit = 0) const;
 			void Flip();
 
 			std::size_t FindFirst() const;
 			std::size_t FindNext(std::size_t bit) const;
 
+			template<typename F> void ForEachSetBit(F&& callback) const;
+
 			Block GetBlock(std::size_t i) const;
 			std::size_t GetBlockCount() const;
 			std::size_t GetCapacity() const;
 			std::size_t GetSize() const;
 
 			void PerformsAND(const Bitset& a, const Bitset& b);
+			void PerformsANDNOT(const Bitset& a, const Bitset& b);
 			void PerformsNOT(const Bitset& a);
 			void PerformsOR(const Bitset& a, const Bitset& b);
 			void PerformsXOR(const Bitset& a, const Bitset& b);
 
 			bool Intersects(const Bitset& bitset) const;
+			bool IntersectsAndNot(const Bitset& bitset) const;
+			bool IsSubsetOf(const Bitset& bitset) const;
 
 			constexpr bits_const_iter_tag IterBits() const noexcept;
 
@@ -118,6 +146,10 @@ namespace Nz
 			static constexpr std::size_t bitsPerBlock = BitCount<Block>();
 			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
 
+			// Largest bitset ApplyDelta accepts by default (2 MiB of blocks), as the size read from the delta can't be trusted
+			static constexpr std::size_t DefaultDeltaMaxBitCount = std::size_t(1) << 24;
+
+			static ByteStreamResult<void> EncodeDelta(const Bitset& previous, const Bitset& current, ByteWriter& writer);
 			static Bitset FromPointer(const void* ptr, std::size_t bitCount, PointerSequence* sequence = nullptr);
 
 			struct bits_const_iter_tag
@@ -129,22 +161,99 @@ namespace Nz
 			};
 
 		private:
+			friend Detail::BitsetParallelAccess;
+
+			class InlineStorage;
+			using BlockStorage = std::conditional_t<InlineBlockCount == 0, std::vector<Block, Allocator>, InlineStorage>;
+
 			std::size_t FindFirstFrom(std::size_t blockIndex) const;
 			Block GetLastBlockMask() const;
 			void ResetExtraBits();
 
 			static std::size_t ComputeBlockCount(std::size_t bitCount);
+			static constexpr std::size_t DeltaChunkBlockCount = 1024 / sizeof(Block);
+			// Isolated zero blocks are sent as part of a literal run when they're smaller than the two varints needed to split it
+			static constexpr std::size_t DeltaMaxInlineZeroBlocks = 2 / sizeof(Block);
 			static std::size_t GetBitIndex(std::size_t bit);
 			static std::size_t GetBlockIndex(std::size_t bit);
 
-			std::vector<Block, Allocator> m_blocks;
+			BlockStorage m_blocks;
 			std::size_t m_bitCount;
 	};
 
-	template<typename Block, class Allocator>
-	class Bitset<Block, Allocator>::Bit
+	// Vector-like block storage with room for InlineBlockCount blocks in the object itself, spilling to the heap past that
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	class Bitset<Block, Allocator, InlineBlockCount>::InlineStorage
+	{
+		public:
+			using const_iterator = const Block*;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+			using iterator = Block*;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using value_type = Block;
+
+			explicit InlineStorage(const Allocator& allocator = Allocator()) noexcept;
+			InlineStorage(std::size_t count, Block value, const Allocator& allocator = Allocator());
+			InlineStorage(const InlineStorage& storage);
+			InlineStorage(InlineStorage&& storage) noexcept;
+			~InlineStorage();
+
+			Block& back();
+			Block back() const;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			std::size_t capacity() const noexcept;
+
+			void clear() noexcept;
+
+			Block* data() noexcept;
+			const Block* data() const noexcept;
+
+			bool empty() const noexcept;
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			void push_back(Block block);
+
+			reverse_iterator rbegin() noexcept;
+			const_reverse_iterator rbegin() const noexcept;
+
+			reverse_iterator rend() noexcept;
+			const_reverse_iterator rend() const noexcept;
+
+			void reserve(std::size_t capacity);
+
+			void resize(std::size_t size, Block value = Block(0U));
+
+			std::size_t size() const noexcept;
+
+			Block& operator[](std::size_t i);
+			Block operator[](std::size_t i) const;
+
+			InlineStorage& operator=(const InlineStorage& storage);
+			InlineStorage& operator=(InlineStorage&& storage) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || std::allocator_traits<Allocator>::is_always_equal::value);
+
+		private:
+			using AllocatorTraits = std::allocator_traits<Allocator>;
+
+			void Grow(std::size_t capacity);
+			bool IsInline() const noexcept;
+			void Release() noexcept;
+
+			std::array<Block, InlineBlockCount> m_inlineBlocks;
+			Allocator m_allocator;
+			Block* m_data;
+			std::size_t m_capacity;
+			std::size_t m_size;
+	};
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	class Bitset<Block, Allocator, InlineBlockCount>::Bit
 	{
-		friend Bitset<Block, Allocator>;
+		friend Bitset<Block, Allocator, InlineBlockCount>;
 
 		public:
 			Bit(const Bit& bit) = default;
@@ -177,8 +286,8 @@ namespace Nz
 			Block m_mask;
 	};
 	
-	template<typename Block, class Allocator>
-	class Bitset<Block, Allocator>::BitIterator
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	class Bitset<Block, Allocator, InlineBlockCount>::BitIterator
 	{
 		friend Bitset;
 
@@ -206,41 +315,85 @@ namespace Nz
 			const Bitset* m_owner;
 	};
 
-	template<typename Block, class Allocator>
-	std::ostream& operator<<(std::ostream& out, const Bitset<Block, Allocator>& bitset);
+	// Cumulative bit counts of a bitset every 512 bits, referencing the bitset (which must outlive it and not be modified)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	class Bitset<Block, Allocator, InlineBlockCount>::RankIndex
+	{
+		friend Bitset;
+
+		public:
+			RankIndex(const RankIndex&) = default;
+			RankIndex(RankIndex&&) noexcept = default;
+			~RankIndex() = default;
+
+			std::size_t Count() const;
+
+			const Bitset& GetBitset() const;
+			std::size_t GetMemoryUsage() const;
+
+			std::size_t Rank(std::size_t bit) const;
+			std::size_t Select(std::size_t k) const;
+
+			RankIndex& operator=(const RankIndex&) = default;
+			RankIndex& operator=(RankIndex&&) noexcept = default;
+
+			static constexpr std::size_t bitsPerSuperblock = 512;
+			static constexpr std::size_t blocksPerSuperblock = bitsPerSuperblock / bitsPerBlock;
+			static constexpr std::size_t superblocksPerRange = 128;
+			static constexpr std::size_t bitsPerRange = bitsPerSuperblock * superblocksPerRange;
+
+		private:
+			using RangeCountAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+			using SuperblockCountAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<UInt16>;
+
+			explicit RankIndex(const Bitset& bitset);
+
+			static std::size_t SelectInBlock(Block block, std::size_t k);
+
+			std::vector<std::size_t, RangeCountAllocator> m_rangeCounts; //< Number of bits set before each range
+			std::vector<UInt16, SuperblockCountAllocator> m_superblockCounts; //< Number of bits set before each superblock, relative to its range
+			const Bitset* m_bitset;
+			std::size_t m_count;
+	};
+
+	template<std::size_t InlineBitCount, typename Block = UInt64, class Allocator = std::allocator<Block>>
+	using SmallBitset = Bitset<Block, Allocator, (InlineBitCount + BitCount<Block>() - 1) / BitCount<Block>()>;
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::ostream& operator<<(std::ostream& out, const Bitset<Block, Allocator, InlineBlockCount>& bitset);
 
-	template<typename Block, class Allocator>
-	bool operator==(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator==(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	bool operator!=(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator!=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	bool operator<(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator<(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	bool operator<=(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator<=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	bool operator>(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator>(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	bool operator>=(const Bitset<Block, Allocator>& lhs, const Nz::Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator>=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator&(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator&(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator|(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator|(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs);
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator^(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs);
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator^(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs);
 }
 
 namespace std
 {
-	template<typename Block, class Allocator>
-	void swap(Nz::Bitset<Block, Allocator>& lhs, Nz::Bitset<Block, Allocator>& rhs) noexcept;
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void swap(Nz::Bitset<Block, Allocator, InlineBlockCount>& lhs, Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs) noexcept;
 }
 
 #include <NazaraUtils/Bitset.inl>
@@ -13,20 +13,85 @@ NAZARA_WARNING_MSVC_DISABLE(4146 4804)
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename Block>
+		NAZARA_CONSTEXPR20 std::size_t CountBlockBits(const Block* blocks, std::size_t blockCount)
+		{
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < blockCount; ++i)
+				count += CountBits(blocks[i]);
+
+			return count;
+		}
+
+		template<typename Block>
+		NAZARA_CONSTEXPR20 std::size_t FindFirstBlockBit(const Block* blocks, std::size_t blockCount, std::size_t firstBlock)
+		{
+			// We are looking for the first non-null block
+			for (std::size_t i = firstBlock; i < blockCount; ++i)
+			{
+				// Compute the position of LSB in the block (and adjustment of the position)
+				if (blocks[i])
+					return FindFirstBit(blocks[i]) + i * BitCount<Block>() - 1;
+			}
+
+			return std::numeric_limits<std::size_t>::max();
+		}
+
+		template<typename Block>
+		NAZARA_CONSTEXPR20 std::size_t FindNextBlockBit(const Block* blocks, std::size_t blockCount, std::size_t bitCount, std::size_t bit)
+		{
+			if (++bit >= bitCount)
+				return std::numeric_limits<std::size_t>::max();
+
+			// The bit block and its index
+			std::size_t blockIndex = bit / BitCount<Block>();
+			std::size_t bitIndex = bit % BitCount<Block>();
+
+			// We get the block and ignore its X least significant bits
+			Block block = blocks[blockIndex];
+			block >>= bitIndex;
+
+			// If the block is not empty, it's good, else we must keep trying with the next block
+			if (block)
+				return FindFirstBit(block) + bit - 1;
+			else
+				return FindFirstBlockBit(blocks, blockCount, blockIndex + 1);
+		}
+	}
+
 	/*!
 	* \ingroup utils
 	* \class Nz::Bitset
 	* \brief Core class that represents a set of bits
 	*
 	* This class meets the requirements of Container, AllocatorAwareContainer, SequenceContainer
+	*
+	* When InlineBlockCount is not zero, up to InlineBlockCount blocks are stored in the bitset itself and the allocator is only used past that.
+	*
+	* \see SmallBitset
 	*/
 
 	/*!
 	* \brief Constructs a Bitset object by default
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset() :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset() :
+	m_bitCount(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty Bitset object using a specific allocator
+	*
+	* \param allocator Allocator used for block storage
+	*/
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(const Allocator& allocator) :
+	m_blocks(allocator),
 	m_bitCount(0)
 	{
 	}
@@ -36,11 +101,12 @@ namespace Nz
 	*
 	* \param bitCount Number of bits
 	* \param val Value of those bits, by default false
+	* \param allocator Allocator used for block storage
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset(std::size_t bitCount, bool val) :
-	Bitset()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(std::size_t bitCount, bool val, const Allocator& allocator) :
+	Bitset(allocator)
 	{
 		Resize(bitCount, val);
 	}
@@ -53,8 +119,8 @@ namespace Nz
 	* \remark The length of the string is determined by the first null character, if there is no null character, the behaviour is undefined
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset(const char* bits) :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(const char* bits) :
 	Bitset(bits, std::strlen(bits))
 	{
 	}
@@ -68,8 +134,8 @@ namespace Nz
 	* \remark If the length of the string is inferior to the bitCount, the behaviour is undefined
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset(const char* bits, std::size_t bitCount) :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(const char* bits, std::size_t bitCount) :
 	m_blocks(ComputeBlockCount(bitCount), 0U),
 	m_bitCount(bitCount)
 	{
@@ -98,8 +164,8 @@ namespace Nz
 	*
 	* \param bits String containing only '0' and '1'
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset(const std::string_view& bits) :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(const std::string_view& bits) :
 	Bitset(bits.data(), bits.size())
 	{
 	}
@@ -109,8 +175,8 @@ namespace Nz
 	*
 	* \param bits String containing only '0' and '1'
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bitset(const std::string& bits) :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(const std::string& bits) :
 	Bitset(bits.data(), bits.size())
 	{
 	}
@@ -120,9 +186,9 @@ namespace Nz
 	*
 	* \param value Number to be used as a base
 	*/
-	template<typename Block, class Allocator>
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
 	template<typename T>
-	Bitset<Block, Allocator>::Bitset(T value) :
+	Bitset<Block, Allocator, InlineBlockCount>::Bitset(T value) :
 	Bitset()
 	{
 		if constexpr (sizeof(T) <= sizeof(Block))
@@ -155,13 +221,17 @@ namespace Nz
 	* \see AppendBits
 	* \see Read
 	*/
-	template<typename Block, class Allocator>
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
 	template<typename T>
-	void Bitset<Block, Allocator>::AppendBits(T bits, std::size_t bitCount)
+	void Bitset<Block, Allocator, InlineBlockCount>::AppendBits(T bits, std::size_t bitCount)
 	{
 		std::size_t bitShift = m_bitCount % bitsPerBlock;
 		m_bitCount += bitCount;
 
+		// Bits past bitCount must not end up in the last block
+		if (bitCount < BitCount<T>())
+			bits &= static_cast<T>((T(1U) << bitCount) - 1U);
+
 		if (bitShift != 0)
 		{
 			std::size_t remainingBits = bitsPerBlock - bitShift;
@@ -189,6 +259,78 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Applies a delta written by EncodeDelta
+	* \return Nothing, or an error if the delta is truncated or corrupted
+	*
+	* This bitset must hold the previous state used to encode the delta, it is resized and updated to the current state.
+	*
+	* \param reader Reader to read the delta from (with the same endianness as the writer used to encode it)
+	* \param maxBitCount Maximum size of the bitset, a delta resizing it past this size fails with ByteStreamError::InvalidData (before allocating anything)
+	*
+	* \remark Runs of unchanged blocks are compressed, so a short delta can legitimately resize the bitset to a large size:
+	*         maxBitCount is what prevents a corrupted or malicious delta from making it allocate an arbitrary amount of memory
+	* \remark On failure, the bitset may have been partially updated and should be resynchronized (e.g. from a full snapshot)
+	*
+	* \see EncodeDelta
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	ByteStreamResult<void> Bitset<Block, Allocator, InlineBlockCount>::ApplyDelta(ByteReader& reader, std::size_t maxBitCount)
+	{
+		NAZARA_TRY_VALUE(std::size_t bitCount, reader.ReadVarInt<std::size_t>());
+		if NAZARA_UNLIKELY(bitCount > maxBitCount || bitCount > std::numeric_limits<std::size_t>::max() - bitsPerBlock)
+			return Err(ByteStreamError::InvalidData);
+
+		Resize(bitCount);
+
+		std::size_t blockCount = m_blocks.size();
+		std::size_t blockIndex = 0;
+		while (blockIndex < blockCount)
+		{
+			NAZARA_TRY_VALUE(std::size_t zeroBlockCount, reader.ReadVarInt<std::size_t>());
+			NAZARA_TRY_VALUE(std::size_t literalBlockCount, reader.ReadVarInt<std::size_t>());
+
+			std::size_t remainingBlockCount = blockCount - blockIndex;
+			if NAZARA_UNLIKELY(zeroBlockCount > remainingBlockCount || literalBlockCount > remainingBlockCount - zeroBlockCount || zeroBlockCount + literalBlockCount == 0)
+				return Err(ByteStreamError::InvalidData);
+
+			blockIndex += zeroBlockCount;
+			if (literalBlockCount == 0)
+				continue;
+
+			NAZARA_TRY_VALUE(const UInt8* literalBlocks, reader.ReadBytes(literalBlockCount * sizeof(Block)));
+			if (sizeof(Block) == 1 || reader.GetEndianness() == PlatformEndianness)
+				BitKernels::Xor(&m_blocks[blockIndex], &m_blocks[blockIndex], literalBlocks, literalBlockCount * sizeof(Block));
+			else
+			{
+				for (std::size_t i = 0; i < literalBlockCount; ++i)
+				{
+					Block block;
+					std::memcpy(&block, literalBlocks + i * sizeof(Block), sizeof(Block));
+					m_blocks[blockIndex + i] ^= ByteSwap(block);
+				}
+			}
+
+			blockIndex += literalBlockCount;
+		}
+
+		ResetExtraBits();
+		return Ok();
+	}
+
+	/*!
+	* \brief Builds a rank index of the bitset
+	* \return Index answering Rank and Select queries in constant time
+	*
+	* \remark The index references this bitset, and must be rebuilt each time the bitset is modified
+	* \remark The index stores a 16-bit count every 512 bits and a std::size_t count every 65536 bits, for a memory overhead of about 3.2%
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::BuildRankIndex() const -> RankIndex
+	{
+		return RankIndex(*this);
+	}
+
 	/*!
 	* \brief Clears the content of the bitset
 	*
@@ -199,8 +341,8 @@ namespace Nz
 	*
 	* \see Reset()
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Clear() noexcept
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Clear() noexcept
 	{
 		m_bitCount = 0;
 		m_blocks.clear();
@@ -211,26 +353,101 @@ namespace Nz
 	*
 	* \return Number of bits set to 1
 	*/
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::Count() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::Count() const
 	{
 		if (m_blocks.empty())
 			return 0;
 
-		std::size_t count = 0;
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-			count += CountBits(m_blocks[i]);
+		// Extra bits are always zero, so we can count whole blocks
+		return BitKernels::Count(m_blocks.data(), m_blocks.size() * sizeof(Block));
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1 in both bitsets
+	*
+	* \param bitset Other bitset
+	*
+	* \return Number of bits set to 1 in (*this & bitset)
+	*
+	* \remark This is equivalent to (*this & bitset).Count() but doesn't build a temporary bitset
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::CountAnd(const Bitset& bitset) const
+	{
+		// Bits outside of the smallest bitset are ANDed with zero
+		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
+		return BitKernels::CountAnd(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks * sizeof(Block));
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1 in this bitset but not in the other one
+	*
+	* \param bitset Other bitset, missing bits are considered to be 0
+	*
+	* \return Number of bits set to 1 in (*this & ~bitset)
+	*
+	* \remark This is equivalent to (*this & ~bitset).Count() (with bitset resized to our size) but doesn't build temporary bitsets
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::CountAndNot(const Bitset& bitset) const
+	{
+		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
+
+		std::size_t count = BitKernels::CountAndNot(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks * sizeof(Block));
+		count += BitKernels::Count(m_blocks.data() + sharedBlocks, (m_blocks.size() - sharedBlocks) * sizeof(Block));
 
 		return count;
 	}
 
+	/*!
+	* \brief Writes the index of every bit set to an output iterator
+	* \return Output iterator past the last written index
+	*
+	* \param output Output iterator receiving the indices of the bits set (as std::size_t), in increasing order
+	* \param startBit Index of the first bit to consider, can be equal to the bitset size
+	*
+	* \remark Unlike IterBits, this processes a whole block at a time (clearing its lowest bit set after each index)
+	*
+	* \see ForEachSetBit
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	template<typename OutputIt>
+	OutputIt Bitset<Block, Allocator, InlineBlockCount>::ExtractSetBits(OutputIt output, std::size_t startBit) const
+	{
+		assert((startBit <= m_bitCount) && "Bit index out of range");
+
+		std::size_t blockIndex = GetBlockIndex(startBit);
+		if (blockIndex >= m_blocks.size())
+			return output;
+
+		// Ignore the bits before startBit in the first block
+		Block block = m_blocks[blockIndex] & Block(fullBitMask << GetBitIndex(startBit));
+		for (;;)
+		{
+			std::size_t firstBit = blockIndex * bitsPerBlock;
+			while (block != 0)
+			{
+				*output++ = firstBit + FindFirstBit(block) - 1;
+				block &= Block(block - 1U);
+			}
+
+			if (++blockIndex >= m_blocks.size())
+				break;
+
+			block = m_blocks[blockIndex];
+		}
+
+		return output;
+	}
+
 	/*!
 	* \brief Flips each bit of the bitset
 	*
 	* This function flips every bit of the bitset, which means every '1' turns into a '0' and conversely.
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Flip()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Flip()
 	{
 		for (Block& block : m_blocks)
 			block ^= fullBitMask;
@@ -243,8 +460,8 @@ namespace Nz
 	*
 	* \return The 0-based index of the first bit enabled
 	*/
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::FindFirst() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::FindFirst() const
 	{
 		return FindFirstFrom(0);
 	}
@@ -258,27 +475,33 @@ namespace Nz
 	*
 	* \remark This function is typically used in for-loops to iterate on bits
 	*/
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::FindNext(std::size_t bit) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::FindNext(std::size_t bit) const
 	{
 		assert((bit < m_bitCount) &&  "Bit index out of range");
 
-		if (++bit >= m_bitCount)
-			return npos;
-
-		// The bit block and its index
-		std::size_t blockIndex = GetBlockIndex(bit);
-		std::size_t bitIndex = GetBitIndex(bit);
-
-		// We get the block and ignore its X least significant bits
-		Block block = m_blocks[blockIndex];
-		block >>= bitIndex;
+		return Detail::FindNextBlockBit(m_blocks.data(), m_blocks.size(), m_bitCount, bit);
+	}
 
-		// If the block is not empty, it's good, else we must keep trying with the next block
-		if (block)
-			return FindFirstBit(block) + bit - 1;
-		else
-			return FindFirstFrom(blockIndex + 1);
+	/*!
+	* \brief Calls a function with the index of every bit set
+	*
+	* \param callback Function called with the index of each bit set (as std::size_t), in increasing order
+	*
+	* \remark Unlike IterBits, this processes a whole block at a time (clearing its lowest bit set after each index)
+	*
+	* \see ExtractSetBits
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	template<typename F>
+	void Bitset<Block, Allocator, InlineBlockCount>::ForEachSetBit(F&& callback) const
+	{
+		for (std::size_t i = 0; i < m_blocks.size(); ++i)
+		{
+			std::size_t firstBit = i * bitsPerBlock;
+			for (Block block = m_blocks[i]; block != 0; block &= Block(block - 1U))
+				callback(firstBit + FindFirstBit(block) - 1);
+		}
 	}
 
 	/*!
@@ -290,8 +513,8 @@ namespace Nz
 	* \remark Produce a NazaraAssert if i is greather than number of blocks in bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Block Bitset<Block, Allocator>::GetBlock(std::size_t i) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block Bitset<Block, Allocator, InlineBlockCount>::GetBlock(std::size_t i) const
 	{
 		assert((i < m_blocks.size()) &&  "Block index out of range");
 
@@ -303,8 +526,8 @@ namespace Nz
 	* \return Number of blocks
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::GetBlockCount() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::GetBlockCount() const
 	{
 		return m_blocks.size();
 	}
@@ -314,8 +537,8 @@ namespace Nz
 	* \return Capacity of the bitset
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::GetCapacity() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::GetCapacity() const
 	{
 		return m_blocks.capacity()*bitsPerBlock;
 	}
@@ -325,8 +548,8 @@ namespace Nz
 	* \return Number of bits
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::GetSize() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::GetSize() const
 	{
 		return m_bitCount;
 	}
@@ -347,8 +570,8 @@ namespace Nz
 	* \see Read
 	* \see Write
 	*/
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::PointerSequence Bitset<Block, Allocator>::Write(const void* ptr, std::size_t bitCount)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::PointerSequence Bitset<Block, Allocator, InlineBlockCount>::Write(const void* ptr, std::size_t bitCount)
 	{
 		return Write(PointerSequence(ptr, 0U), bitCount);
 	}
@@ -369,8 +592,8 @@ namespace Nz
 	* \see Read
 	* \see Write
 	*/
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::PointerSequence Bitset<Block, Allocator>::Write(const PointerSequence& sequence, std::size_t bitCount)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::PointerSequence Bitset<Block, Allocator, InlineBlockCount>::Write(const PointerSequence& sequence, std::size_t bitCount)
 	{
 		assert((sequence.first) &&  "Invalid pointer sequence");
 		assert((sequence.second < 8) &&  "Invalid next bit index (must be < 8)");
@@ -412,8 +635,8 @@ namespace Nz
 	* \remark The "AND" is performed with all the bits of the smallest bitset and the capacity of this is set to the largest of the two bitsets
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::PerformsAND(const Bitset& a, const Bitset& b)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::PerformsAND(const Bitset& a, const Bitset& b)
 	{
 		std::pair<std::size_t, std::size_t> minmax = std::minmax(a.GetBlockCount(), b.GetBlockCount());
 
@@ -421,12 +644,40 @@ namespace Nz
 		m_bitCount = std::max(a.GetSize(), b.GetSize());
 
 		// In case of the "AND", we can stop with the smallest size (because x & 0 = 0)
-		for (std::size_t i = 0; i < minmax.first; ++i)
-			m_blocks[i] = a.GetBlock(i) & b.GetBlock(i);
+		BitKernels::And(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minmax.first * sizeof(Block));
 
 		// And then reset every other block to zero
-		for (std::size_t i = minmax.first; i < minmax.second; ++i)
-			m_blocks[i] = 0U;
+		std::fill(m_blocks.begin() + minmax.first, m_blocks.end(), Block(0U));
+
+		ResetExtraBits();
+	}
+
+	/*!
+	* \brief Performs the "AND NOT" operator between two bitsets (a & ~b)
+	*
+	* \param a First bitset
+	* \param b Second bitset, which is negated
+	*
+	* \remark This is equivalent to a & ~b (with b resized to the size of a if smaller), but doesn't build a temporary bitset
+	* \remark The capacity of this is set to the largest of the two bitsets
+	*/
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::PerformsANDNOT(const Bitset& a, const Bitset& b)
+	{
+		std::size_t aBlockCount = a.GetBlockCount();
+		std::size_t minBlockCount = std::min(aBlockCount, b.GetBlockCount());
+
+		m_blocks.resize(std::max(aBlockCount, b.GetBlockCount()));
+		m_bitCount = std::max(a.GetSize(), b.GetSize());
+
+		BitKernels::AndNot(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount * sizeof(Block));
+
+		// Past the end of b, we're computing x & ~0 = x, and past the end of a, 0 & ~x = 0
+		if (&a != this)
+			std::copy(a.m_blocks.begin() + minBlockCount, a.m_blocks.end(), m_blocks.begin() + minBlockCount);
+
+		std::fill(m_blocks.begin() + aBlockCount, m_blocks.end(), Block(0U));
 
 		ResetExtraBits();
 	}
@@ -437,14 +688,13 @@ namespace Nz
 	* \param a Bitset to negate
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::PerformsNOT(const Bitset& a)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::PerformsNOT(const Bitset& a)
 	{
 		m_blocks.resize(a.GetBlockCount());
 		m_bitCount = a.GetSize();
 
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-			m_blocks[i] = ~a.GetBlock(i);
+		BitKernels::Not(m_blocks.data(), a.m_blocks.data(), m_blocks.size() * sizeof(Block));
 
 		ResetExtraBits();
 	}
@@ -458,8 +708,8 @@ namespace Nz
 	* \remark The "OR" is performed with all the bits of the smallest bitset and the others are copied from the largest and the capacity of this is set to the largest of the two bitsets
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::PerformsOR(const Bitset& a, const Bitset& b)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::PerformsOR(const Bitset& a, const Bitset& b)
 	{
 		const Bitset& greater = (a.GetSize() > b.GetSize()) ? a : b;
 		const Bitset& lesser = (a.GetSize() > b.GetSize()) ? b : a;
@@ -469,11 +719,10 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) | b.GetBlock(i);
+		BitKernels::Or(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount * sizeof(Block));
 
-		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
-			m_blocks[i] = greater.GetBlock(i); // (x | 0 = x)
+		if (&greater != this)
+			std::copy(greater.m_blocks.begin() + minBlockCount, greater.m_blocks.end(), m_blocks.begin() + minBlockCount); // (x | 0 = x)
 
 		ResetExtraBits();
 	}
@@ -487,8 +736,8 @@ namespace Nz
 	* \remark The "XOR" is performed with all the bits of the smallest bitset and the others are copied from the largest and the capacity of this is set to the largest of the two bitsets
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::PerformsXOR(const Bitset& a, const Bitset& b)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::PerformsXOR(const Bitset& a, const Bitset& b)
 	{
 		const Bitset& greater = (a.GetSize() > b.GetSize()) ? a : b;
 		const Bitset& lesser = (a.GetSize() > b.GetSize()) ? b : a;
@@ -498,11 +747,10 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) ^ b.GetBlock(i);
+		BitKernels::Xor(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount * sizeof(Block));
 
-		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
-			m_blocks[i] = greater.GetBlock(i); // (x ^ 0 = x)
+		if (&greater != this)
+			std::copy(greater.m_blocks.begin() + minBlockCount, greater.m_blocks.end(), m_blocks.begin() + minBlockCount); // (x ^ 0 = x)
 
 		ResetExtraBits();
 	}
@@ -513,24 +761,54 @@ namespace Nz
 	* \param bitset Bitset to test
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::Intersects(const Bitset& bitset) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::Intersects(const Bitset& bitset) const
 	{
 		// We only test the blocks in common
 		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
-		for (std::size_t i = 0; i < sharedBlocks; ++i)
-		{
-			Block a = GetBlock(i);
-			Block b = bitset.GetBlock(i);
-			if (a & b)
-				return true;
-		}
+		return BitKernels::Intersects(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks * sizeof(Block));
+	}
 
-		return false;
+	/*!
+	* \brief Checks if this bitset has at least one bit set which isn't set in the other one
+	*
+	* \param bitset Other bitset, missing bits are considered to be 0
+	*
+	* \return True if (*this & ~bitset) has any bit set
+	*
+	* \see IsSubsetOf
+	*/
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::IntersectsAndNot(const Bitset& bitset) const
+	{
+		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
+		if (BitKernels::IntersectsAndNot(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks * sizeof(Block)))
+			return true;
+
+		// Any bit set past the end of the other bitset is a bit it doesn't have (x & x is non-zero if any bit of x is set)
+		const Block* remainingBlocks = m_blocks.data() + sharedBlocks;
+		return BitKernels::Intersects(remainingBlocks, remainingBlocks, (m_blocks.size() - sharedBlocks) * sizeof(Block));
+	}
+
+	/*!
+	* \brief Checks if every bit set in this bitset is also set in the other one
+	*
+	* \param bitset Other bitset, missing bits are considered to be 0
+	*
+	* \return True if this bitset is a subset of the other one
+	*
+	* \see IntersectsAndNot
+	*/
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::IsSubsetOf(const Bitset& bitset) const
+	{
+		return !IntersectsAndNot(bitset);
 	}
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::IterBits() const noexcept -> bits_const_iter_tag
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::IterBits() const noexcept -> bits_const_iter_tag
 	{
 		return bits_const_iter_tag{ *this };
 	}
@@ -541,8 +819,8 @@ namespace Nz
 	* \param bitCount Number of bits to reserve
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Reserve(std::size_t bitCount)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Reserve(std::size_t bitCount)
 	{
 		m_blocks.reserve(ComputeBlockCount(bitCount));
 	}
@@ -554,8 +832,8 @@ namespace Nz
 	* \param defaultVal Value of the bits if new size is greather than the old one
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Resize(std::size_t bitCount, bool defaultVal)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Resize(std::size_t bitCount, bool defaultVal)
 	{
 		std::size_t remainingBits = GetBitIndex(m_bitCount);
 		if (bitCount > m_bitCount && remainingBits > 0 && defaultVal)
@@ -575,8 +853,8 @@ namespace Nz
 	/*!
 	* \brief Reset all bits value to zero
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Reset()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Reset()
 	{
 		Set(false);
 	}
@@ -589,8 +867,8 @@ namespace Nz
 	* \see UnboundReset
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Reset(std::size_t bit)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Reset(std::size_t bit)
 	{
 		Set(bit, false);
 	}
@@ -600,8 +878,8 @@ namespace Nz
 	*
 	* Reverse the order of bits in the bitset (first bit swap with the last one, etc.)
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Reverse()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Reverse()
 	{
 		if (m_bitCount == 0)
 			return;
@@ -625,8 +903,8 @@ namespace Nz
 	* \param val Value of the bits
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Set(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Set(bool val)
 	{
 		std::fill(m_blocks.begin(), m_blocks.end(), (val) ? fullBitMask : Block(0U));
 		if (val)
@@ -644,8 +922,8 @@ namespace Nz
 	* \see UnboundSet
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Set(std::size_t bit, bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Set(std::size_t bit, bool val)
 	{
 		assert((bit < m_bitCount) &&  "Bit index out of range");
 
@@ -665,8 +943,8 @@ namespace Nz
 	*
 	* \remark Produce a NazaraAssert if i is greather than number of blocks in bitset
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::SetBlock(std::size_t i, Block block)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::SetBlock(std::size_t i, Block block)
 	{
 		assert((i < m_blocks.size()) &&  "Block index out of range");
 
@@ -684,8 +962,8 @@ namespace Nz
 	*
 	* \see operator<<=
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::ShiftLeft(std::size_t pos)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::ShiftLeft(std::size_t pos)
 	{
 		if (pos == 0)
 			return;
@@ -738,8 +1016,8 @@ namespace Nz
 	*
 	* \see operator>>=
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::ShiftRight(std::size_t pos)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::ShiftRight(std::size_t pos)
 	{
 		if (pos == 0)
 			return;
@@ -788,8 +1066,8 @@ namespace Nz
 	*
 	* \param bitset Other bitset to swap
 	*/
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::Swap(Bitset& bitset) noexcept
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::Swap(Bitset& bitset) noexcept
 	{
 		std::swap(m_bitCount, bitset.m_bitCount);
 		std::swap(m_blocks,   bitset.m_blocks);
@@ -806,8 +1084,8 @@ namespace Nz
 	* \see UnboundTest
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::Test(std::size_t bit) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::Test(std::size_t bit) const
 	{
 		assert((bit < m_bitCount) &&  "Bit index out of range");
 
@@ -819,8 +1097,8 @@ namespace Nz
 	* \return true if each block is set
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::TestAll() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::TestAll() const
 	{
 		// Special case for the last block
 		Block lastBlockMask = GetLastBlockMask();
@@ -840,8 +1118,8 @@ namespace Nz
 	* \return true if one bit is set
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::TestAny() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::TestAny() const
 	{
 		if (m_blocks.empty())
 			return false;
@@ -860,8 +1138,8 @@ namespace Nz
 	* \return true if one bit is not set
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::TestNone() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::TestNone() const
 	{
 		return !TestAny();
 	}
@@ -873,9 +1151,9 @@ namespace Nz
 	* \remark Produce a NazaraAssert if the template type can not hold the number of bits
 	*/
 
-	template<typename Block, class Allocator>
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
 	template<typename T>
-	T Bitset<Block, Allocator>::To() const
+	T Bitset<Block, Allocator, InlineBlockCount>::To() const
 	{
 		static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "T must be a unsigned integral type");
 
@@ -893,8 +1171,8 @@ namespace Nz
 	* \return A string representation of the object with only '0' and '1'
 	*/
 
-	template<typename Block, class Allocator>
-	std::string Bitset<Block, Allocator>::ToString() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::string Bitset<Block, Allocator, InlineBlockCount>::ToString() const
 	{
 		std::string str(m_bitCount, '0');
 
@@ -917,8 +1195,8 @@ namespace Nz
 	* \see Reset
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::UnboundedReset(std::size_t bit)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::UnboundedReset(std::size_t bit)
 	{
 		UnboundedSet(bit, false);
 	}
@@ -934,8 +1212,8 @@ namespace Nz
 	* \see Set
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::UnboundedSet(std::size_t bit, bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::UnboundedSet(std::size_t bit, bool val)
 	{
 		if NAZARA_LIKELY(bit < m_bitCount)
 			Set(bit, val);
@@ -956,8 +1234,8 @@ namespace Nz
 	* \see Test
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::UnboundedTest(std::size_t bit) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::UnboundedTest(std::size_t bit) const
 	{
 		if NAZARA_LIKELY(bit < m_bitCount)
 			return Test(bit);
@@ -970,8 +1248,8 @@ namespace Nz
 	* \return bit in ith position
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit Bitset<Block, Allocator>::operator[](std::size_t index)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit Bitset<Block, Allocator, InlineBlockCount>::operator[](std::size_t index)
 	{
 		return Bit(m_blocks[GetBlockIndex(index)], Block(1U) << GetBitIndex(index));
 	}
@@ -981,8 +1259,8 @@ namespace Nz
 	* \return bit in ith position
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::operator[](std::size_t index) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::operator[](std::size_t index) const
 	{
 		return Test(index);
 	}
@@ -992,8 +1270,8 @@ namespace Nz
 	* \return A new bitset which is the "NOT" of this bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> Bitset<Block, Allocator>::operator~() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> Bitset<Block, Allocator, InlineBlockCount>::operator~() const
 	{
 		Bitset bitset;
 		bitset.PerformsNOT(*this);
@@ -1008,8 +1286,8 @@ namespace Nz
 	* \param bits String containing only '0' and '1'
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator=(const std::string_view& bits)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator=(const std::string_view& bits)
 	{
 		Bitset bitset(bits);
 		std::swap(*this, bitset);
@@ -1023,9 +1301,9 @@ namespace Nz
 	*
 	* \param value Unsigned number which will be used as a source
 	*/
-	template<typename Block, class Allocator>
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
 	template<typename T>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator=(T value)
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator=(T value)
 	{
 		Bitset bitset(value);
 		std::swap(*this, bitset);
@@ -1044,8 +1322,8 @@ namespace Nz
 	*
 	* \see ShiftLeft
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> Bitset<Block, Allocator>::operator<<(std::size_t pos) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> Bitset<Block, Allocator, InlineBlockCount>::operator<<(std::size_t pos) const
 	{
 		Bitset bitset(*this);
 		return bitset <<= pos;
@@ -1062,8 +1340,8 @@ namespace Nz
 	*
 	* \see ShiftLeft
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator<<=(std::size_t pos)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator<<=(std::size_t pos)
 	{
 		ShiftLeft(pos);
 
@@ -1081,8 +1359,8 @@ namespace Nz
 	*
 	* \see ShiftRight
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> Bitset<Block, Allocator>::operator>>(std::size_t pos) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> Bitset<Block, Allocator, InlineBlockCount>::operator>>(std::size_t pos) const
 	{
 		Bitset bitset(*this);
 		return bitset >>= pos;
@@ -1099,8 +1377,8 @@ namespace Nz
 	*
 	* \see ShiftRight
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator>>=(std::size_t pos)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator>>=(std::size_t pos)
 	{
 		ShiftRight(pos);
 
@@ -1114,8 +1392,8 @@ namespace Nz
 	* \param bitset Other bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator&=(const Bitset& bitset)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator&=(const Bitset& bitset)
 	{
 		PerformsAND(*this, bitset);
 
@@ -1129,8 +1407,8 @@ namespace Nz
 	* \param bitset Other bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator|=(const Bitset& bitset)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator|=(const Bitset& bitset)
 	{
 		PerformsOR(*this, bitset);
 
@@ -1144,14 +1422,103 @@ namespace Nz
 	* \param bitset Other bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>& Bitset<Block, Allocator>::operator^=(const Bitset& bitset)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>& Bitset<Block, Allocator, InlineBlockCount>::operator^=(const Bitset& bitset)
 	{
 		PerformsXOR(*this, bitset);
 
 		return *this;
 	}
 
+	/*!
+	* \brief Encodes the difference between two states of a bitset, to send only changed blocks (e.g. to replicate a bitset over the network)
+	* \return Nothing or ByteStreamError::EndOfBuffer if the writer is full
+	*
+	* The delta is the XOR of both states, encoded as the size of current followed by runs of unchanged blocks (as a varint)
+	* and of changed blocks (a varint count and the XOR-ed blocks). Blocks are processed in chunks using BitKernels.
+	*
+	* A delta against an empty bitset is a compressed full snapshot.
+	*
+	* \param previous Previous state, known by the reader (e.g. the last state acknowledged by the remote peer)
+	* \param current State to encode
+	* \param writer Writer to write the delta to
+	*
+	* \remark On failure, the writer cursor is left past the partially written delta
+	*
+	* \see ApplyDelta
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	ByteStreamResult<void> Bitset<Block, Allocator, InlineBlockCount>::EncodeDelta(const Bitset& previous, const Bitset& current, ByteWriter& writer)
+	{
+		NAZARA_TRY(writer.WriteVarInt(current.m_bitCount));
+
+		std::size_t blockCount = current.m_blocks.size();
+		std::size_t sharedBlockCount = std::min(blockCount, previous.m_blocks.size());
+
+		std::array<Block, DeltaChunkBlockCount> delta;
+		std::size_t zeroBlockCount = 0;
+		for (std::size_t chunkOffset = 0; chunkOffset < blockCount; chunkOffset += DeltaChunkBlockCount)
+		{
+			std::size_t chunkBlockCount = std::min(DeltaChunkBlockCount, blockCount - chunkOffset);
+			std::size_t xorBlockCount = (chunkOffset < sharedBlockCount) ? std::min(chunkBlockCount, sharedBlockCount - chunkOffset) : 0;
+
+			if (xorBlockCount > 0)
+				BitKernels::Xor(delta.data(), &current.m_blocks[chunkOffset], &previous.m_blocks[chunkOffset], xorBlockCount * sizeof(Block));
+
+			// Blocks past the end of previous are XOR-ed with zero
+			std::copy_n(current.m_blocks.data() + chunkOffset + xorBlockCount, chunkBlockCount - xorBlockCount, delta.data() + xorBlockCount);
+
+			// previous may be larger and have bits set past the end of current
+			if (chunkOffset + chunkBlockCount == blockCount)
+				delta[chunkBlockCount - 1] &= current.GetLastBlockMask();
+
+			std::size_t blockIndex = 0;
+			while (blockIndex < chunkBlockCount)
+			{
+				std::size_t nonZeroOffset = BitKernels::FindFirstNonZero(&delta[blockIndex], (chunkBlockCount - blockIndex) * sizeof(Block)) / sizeof(Block);
+				zeroBlockCount += nonZeroOffset;
+				blockIndex += nonZeroOffset;
+				if (blockIndex == chunkBlockCount)
+					break;
+
+				std::size_t literalBegin = blockIndex;
+				std::size_t literalEnd = ++blockIndex;
+				while (blockIndex < chunkBlockCount)
+				{
+					if (delta[blockIndex] != 0)
+					{
+						literalEnd = ++blockIndex;
+						continue;
+					}
+
+					std::size_t zeroEnd = blockIndex;
+					while (zeroEnd < chunkBlockCount && delta[zeroEnd] == 0 && zeroEnd - blockIndex <= DeltaMaxInlineZeroBlocks)
+						++zeroEnd;
+
+					if (zeroEnd == chunkBlockCount || zeroEnd - blockIndex > DeltaMaxInlineZeroBlocks)
+						break;
+
+					blockIndex = zeroEnd;
+				}
+
+				NAZARA_TRY(writer.WriteVarInt(zeroBlockCount));
+				NAZARA_TRY(writer.WriteVarInt(literalEnd - literalBegin));
+				NAZARA_TRY(writer.WriteArray(&delta[literalBegin], literalEnd - literalBegin));
+
+				zeroBlockCount = 0;
+				blockIndex = literalEnd;
+			}
+		}
+
+		if (zeroBlockCount > 0)
+		{
+			NAZARA_TRY(writer.WriteVarInt(zeroBlockCount));
+			NAZARA_TRY(writer.WriteVarInt(std::size_t(0)));
+		}
+
+		return Ok();
+	}
+
 	/*!
 	* \brief Builds a bitset from a byte sequence
 	*
@@ -1168,8 +1535,8 @@ namespace Nz
 	* \see AppendBits
 	* \see Read
 	*/
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> Bitset<Block, Allocator>::FromPointer(const void* ptr, std::size_t bitCount, PointerSequence* sequence)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> Bitset<Block, Allocator, InlineBlockCount>::FromPointer(const void* ptr, std::size_t bitCount, PointerSequence* sequence)
 	{
 		Bitset bitset;
 
@@ -1187,28 +1554,10 @@ namespace Nz
 	*
 	* \param blockIndex Index of the block
 	*/
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::FindFirstFrom(std::size_t blockIndex) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::FindFirstFrom(std::size_t blockIndex) const
 	{
-		if NAZARA_UNLIKELY(blockIndex >= m_blocks.size())
-			return npos;
-
-		// We are looking for the first non-null block
-		std::size_t i = blockIndex;
-		for (; i < m_blocks.size(); ++i)
-		{
-			if (m_blocks[i])
-				break;
-		}
-
-		// Do we have a non-null block ?
-		if (i == m_blocks.size())
-			return npos;
-
-		Block block = m_blocks[i];
-
-		// Compute the position of LSB in the block (and adjustment of the position)
-		return FindFirstBit(block) + i * bitsPerBlock - 1;
+		return Detail::FindFirstBlockBit(m_blocks.data(), m_blocks.size(), blockIndex);
 	}
 
 	/*!
@@ -1216,8 +1565,8 @@ namespace Nz
 	* \return Block which represents the mask
 	*/
 
-	template<typename Block, class Allocator>
-	Block Bitset<Block, Allocator>::GetLastBlockMask() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block Bitset<Block, Allocator, InlineBlockCount>::GetLastBlockMask() const
 	{
 		std::size_t bitIndex = GetBitIndex(m_bitCount);
 		return (bitIndex) ? (Block(1U) << bitIndex) - 1U : fullBitMask;
@@ -1227,8 +1576,8 @@ namespace Nz
 	* \brief Sets to '0' the last bits unassigned in the last block
 	*/
 
-	template<typename Block, class Allocator>
-	void Bitset<Block, Allocator>::ResetExtraBits()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::ResetExtraBits()
 	{
 		if (!m_blocks.empty())
 			m_blocks.back() &= GetLastBlockMask();
@@ -1239,8 +1588,8 @@ namespace Nz
 	* \return Number of the blocks to contain the bit
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::ComputeBlockCount(std::size_t bitCount)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::ComputeBlockCount(std::size_t bitCount)
 	{
 		return GetBlockIndex(bitCount) + ((GetBitIndex(bitCount) != 0U) ? 1U : 0U);
 	}
@@ -1250,8 +1599,8 @@ namespace Nz
 	* \return Index of the bit in the block
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::GetBitIndex(std::size_t bit)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::GetBitIndex(std::size_t bit)
 	{
 		return bit & (bitsPerBlock - 1U); // bit % bitsPerBlock
 	}
@@ -1261,21 +1610,21 @@ namespace Nz
 	* \return Index of the block containing the bit
 	*/
 
-	template<typename Block, class Allocator>
-	std::size_t Bitset<Block, Allocator>::GetBlockIndex(std::size_t bit)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::GetBlockIndex(std::size_t bit)
 	{
 		return bit / bitsPerBlock;
 	}
 
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::bits_const_iter_tag::begin() const noexcept -> BitIterator
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::bits_const_iter_tag::begin() const noexcept -> BitIterator
 	{
 		return BitIterator(*this, bitsetRef.FindFirst());
 	}
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::bits_const_iter_tag::end() const noexcept -> BitIterator
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::bits_const_iter_tag::end() const noexcept -> BitIterator
 	{
 		return BitIterator(*this, bitsetRef.npos);
 	}
@@ -1284,8 +1633,8 @@ namespace Nz
 	* \brief Flips the bit
 	* \return A reference to this
 	*/
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::Flip()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::Flip()
 	{
 		m_block ^= m_mask;
 
@@ -1297,8 +1646,8 @@ namespace Nz
 	* \return A reference to this
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::Reset()
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::Reset()
 	{
 		return Set(false);
 	}
@@ -1310,8 +1659,8 @@ namespace Nz
 	* \param val Value of the bit
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::Set(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::Set(bool val)
 	{
 		// https://graphics.stanford.edu/~seander/bithacks.html#ConditionalSetOrClearBitsWithoutBranching
 		m_block = (m_block & ~m_mask) | (-val & m_mask);
@@ -1324,8 +1673,8 @@ namespace Nz
 	* \return A reference to this
 	*/
 
-	template<typename Block, class Allocator>
-	bool Bitset<Block, Allocator>::Bit::Test() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::Bit::Test() const
 	{
 		return (m_block & m_mask) != 0;
 	}
@@ -1337,9 +1686,9 @@ namespace Nz
 	* \see std::addressof
 	*/
 
-	template<typename Block, class Allocator>
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
 	template<bool BadCall>
-	void* Bitset<Block, Allocator>::Bit::operator&() const
+	void* Bitset<Block, Allocator, InlineBlockCount>::Bit::operator&() const
 	{
 		// The template is necessary to make it fail only when used
 		static_assert(!BadCall, "It is impossible to take the address of a bit in a bitset");
@@ -1352,8 +1701,8 @@ namespace Nz
 	* \return true if bit set to '1'
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator>::Bit::operator bool() const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::Bit::operator bool() const
 	{
 		return Test();
 	}
@@ -1365,8 +1714,8 @@ namespace Nz
 	* \param val Value of the bit
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator=(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator=(bool val)
 	{
 		return Set(val);
 	}
@@ -1378,8 +1727,8 @@ namespace Nz
 	* \param bit Other bit
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator=(const Bit& bit)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator=(const Bit& bit)
 	{
 		return Set(bit);
 	}
@@ -1391,8 +1740,8 @@ namespace Nz
 	* \param val Value
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator|=(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator|=(bool val)
 	{
 		// Version without branching:
 		Set((val) ? true : Test());
@@ -1413,8 +1762,8 @@ namespace Nz
 	* \param val Value
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator&=(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator&=(bool val)
 	{
 		// Version without branching:
 		Set((val) ? Test() : false);
@@ -1435,8 +1784,8 @@ namespace Nz
 	* \param val Value
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator^=(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator^=(bool val)
 	{
 		// Version without branching:
 		Set((val) ? !Test() : Test());
@@ -1457,8 +1806,8 @@ namespace Nz
 	* \param val Value
 	*/
 
-	template<typename Block, class Allocator>
-	typename Bitset<Block, Allocator>::Bit& Bitset<Block, Allocator>::Bit::operator-=(bool val)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	typename Bitset<Block, Allocator, InlineBlockCount>::Bit& Bitset<Block, Allocator, InlineBlockCount>::Bit::operator-=(bool val)
 	{
 		// Version without branching:
 		Set((val) ? false : Test());
@@ -1473,49 +1822,487 @@ namespace Nz
 	}
 
 
-	template<typename Block, class Allocator>
-	constexpr Bitset<Block, Allocator>::BitIterator::BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex) :
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr Bitset<Block, Allocator, InlineBlockCount>::BitIterator::BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex) :
 	m_bitIndex(bitIndex),
 	m_owner(&bitsetTag.bitsetRef)
 	{
 	}
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::BitIterator::operator++(int) -> BitIterator
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::BitIterator::operator++(int) -> BitIterator
 	{
 		BitIterator copy(*this);
 		++copy;
 		return copy;
 	}
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::BitIterator::operator++() -> BitIterator&
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::BitIterator::operator++() -> BitIterator&
 	{
 		m_bitIndex = m_owner->FindNext(m_bitIndex);
 		return *this;
 	}
 
-	template<typename Block, class Allocator>
-	constexpr bool Bitset<Block, Allocator>::BitIterator::operator==(const BitIterator& rhs) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr bool Bitset<Block, Allocator, InlineBlockCount>::BitIterator::operator==(const BitIterator& rhs) const
 	{
 		return m_bitIndex == rhs.m_bitIndex;
 	}
 
-	template<typename Block, class Allocator>
-	constexpr bool Bitset<Block, Allocator>::BitIterator::operator!=(const BitIterator& rhs) const
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr bool Bitset<Block, Allocator, InlineBlockCount>::BitIterator::operator!=(const BitIterator& rhs) const
 	{
 		return m_bitIndex != rhs.m_bitIndex;
 	}
 
-	template<typename Block, class Allocator>
-	constexpr auto Bitset<Block, Allocator>::BitIterator::operator*() const -> value_type
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	constexpr auto Bitset<Block, Allocator, InlineBlockCount>::BitIterator::operator*() const -> value_type
 	{
 		return m_bitIndex;
 	}
 
 
-	template<typename Block, class Allocator>
-	std::ostream& operator<<(std::ostream& out, const Bitset<Block, Allocator>& bitset)
+	/*!
+	* \brief Gets the number of bits set in the indexed bitset
+	* \return Number of bits set to 1
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::RankIndex::Count() const
+	{
+		return m_count;
+	}
+
+	/*!
+	* \brief Gets the indexed bitset
+	* \return Reference to the bitset this index was built from
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::RankIndex::GetBitset() const -> const Bitset&
+	{
+		return *m_bitset;
+	}
+
+	/*!
+	* \brief Gets the memory used by the index
+	* \return Number of bytes allocated by the index
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::RankIndex::GetMemoryUsage() const
+	{
+		return m_rangeCounts.capacity() * sizeof(std::size_t) + m_superblockCounts.capacity() * sizeof(UInt16);
+	}
+
+	/*!
+	* \brief Counts the number of bits set before a bit
+	* \return Number of bits set in [0, bit)
+	*
+	* \param bit Index of the bit, can be equal to the bitset size
+	*
+	* \remark This reads two cumulative counts and at most 512 bits of the bitset
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::RankIndex::Rank(std::size_t bit) const
+	{
+		assert(bit <= m_bitset->GetSize() && "Bit index out of range");
+
+		const Block* blocks = m_bitset->m_blocks.data();
+
+		std::size_t superblock = bit / bitsPerSuperblock;
+		std::size_t firstBlock = superblock * blocksPerSuperblock;
+		std::size_t lastBlock = bit / bitsPerBlock;
+
+		std::size_t rank = m_rangeCounts[bit / bitsPerRange] + m_superblockCounts[superblock] + Detail::CountBlockBits(blocks + firstBlock, lastBlock - firstBlock);
+		if (std::size_t bitIndex = bit % bitsPerBlock; bitIndex != 0)
+			rank += CountBits(Block(blocks[lastBlock] & ((Block(1U) << bitIndex) - 1U)));
+
+		return rank;
+	}
+
+	/*!
+	* \brief Finds the kth bit set
+	* \return Index of the bit set having k bits set before it
+	*
+	* \param k Number of bits set before the bit to find, must be lower than Count()
+	*
+	* \remark The superblock is found by binary searches over the cumulative counts, which costs O(log(n / 512))
+	*/
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::RankIndex::Select(std::size_t k) const
+	{
+		assert(k < Count() && "Not enough bits set");
+
+		auto rangeIt = std::upper_bound(m_rangeCounts.begin(), m_rangeCounts.end(), k);
+		std::size_t range = static_cast<std::size_t>(rangeIt - m_rangeCounts.begin()) - 1;
+		std::size_t remaining = k - m_rangeCounts[range];
+
+		auto firstSuperblockIt = m_superblockCounts.begin() + range * superblocksPerRange;
+		auto lastSuperblockIt = m_superblockCounts.begin() + std::min((range + 1) * superblocksPerRange, m_superblockCounts.size());
+		auto superblockIt = std::upper_bound(firstSuperblockIt, lastSuperblockIt, remaining);
+		std::size_t superblock = static_cast<std::size_t>(superblockIt - m_superblockCounts.begin()) - 1;
+		remaining -= m_superblockCounts[superblock];
+
+		const Block* blocks = m_bitset->m_blocks.data();
+		for (std::size_t i = superblock * blocksPerSuperblock;; ++i)
+		{
+			std::size_t count = CountBits(blocks[i]);
+			if (remaining < count)
+				return i * bitsPerBlock + SelectInBlock(blocks[i], remaining);
+
+			remaining -= count;
+		}
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::RankIndex::RankIndex(const Bitset& bitset) :
+	m_bitset(&bitset)
+	{
+		const Block* blocks = bitset.m_blocks.data();
+		std::size_t blockCount = bitset.m_blocks.size();
+		std::size_t superblockCount = (blockCount + blocksPerSuperblock - 1) / blocksPerSuperblock;
+
+		// One more superblock count is stored so that Rank(GetSize()) doesn't need a special case
+		m_rangeCounts.reserve(superblockCount / superblocksPerRange + 1);
+		m_superblockCounts.reserve(superblockCount + 1);
+
+		std::size_t count = 0;
+		for (std::size_t i = 0; i <= superblockCount; ++i)
+		{
+			if (i % superblocksPerRange == 0)
+				m_rangeCounts.push_back(count);
+
+			m_superblockCounts.push_back(static_cast<UInt16>(count - m_rangeCounts.back()));
+
+			if (i < superblockCount)
+			{
+				std::size_t firstBlock = i * blocksPerSuperblock;
+				count += Detail::CountBlockBits(blocks + firstBlock, std::min(blocksPerSuperblock, blockCount - firstBlock));
+			}
+		}
+
+		m_count = count;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::RankIndex::SelectInBlock(Block block, std::size_t k)
+	{
+		// Skip whole bytes first, then clear the lowest bits one by one
+		std::size_t offset = 0;
+		if constexpr (bitsPerBlock > 8)
+		{
+			for (;;)
+			{
+				std::size_t byteCount = CountBits(UInt8(block & 0xFF));
+				if (k < byteCount)
+					break;
+
+				k -= byteCount;
+				block >>= 8;
+				offset += 8;
+			}
+		}
+
+		for (std::size_t i = 0; i < k; ++i)
+			block &= block - 1;
+
+		return offset + FindFirstBit(block) - 1;
+	}
+
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::InlineStorage(const Allocator& allocator) noexcept :
+	m_allocator(allocator),
+	m_capacity(InlineBlockCount),
+	m_size(0)
+	{
+		// Set in the body, as using m_inlineBlocks (left uninitialized) in the initializer list triggers -Wuninitialized
+		m_data = m_inlineBlocks.data();
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::InlineStorage(std::size_t count, Block value, const Allocator& allocator) :
+	InlineStorage(allocator)
+	{
+		resize(count, value);
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::InlineStorage(const InlineStorage& storage) :
+	InlineStorage(AllocatorTraits::select_on_container_copy_construction(storage.m_allocator))
+	{
+		*this = storage;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::InlineStorage(InlineStorage&& storage) noexcept :
+	m_allocator(std::move(storage.m_allocator)),
+	m_capacity(storage.m_capacity),
+	m_size(storage.m_size)
+	{
+		if (storage.IsInline())
+		{
+			m_data = m_inlineBlocks.data();
+			std::memcpy(m_data, storage.m_data, m_size * sizeof(Block));
+		}
+		else
+		{
+			m_data = storage.m_data;
+
+			storage.m_data = storage.m_inlineBlocks.data();
+			storage.m_capacity = InlineBlockCount;
+		}
+
+		storage.m_size = 0;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::~InlineStorage()
+	{
+		Release();
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block& Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::back()
+	{
+		assert(m_size > 0);
+		return m_data[m_size - 1];
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::back() const
+	{
+		assert(m_size > 0);
+		return m_data[m_size - 1];
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::begin() noexcept -> iterator
+	{
+		return m_data;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::begin() const noexcept -> const_iterator
+	{
+		return m_data;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::clear() noexcept
+	{
+		m_size = 0;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block* Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::data() noexcept
+	{
+		return m_data;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	const Block* Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::end() noexcept -> iterator
+	{
+		return m_data + m_size;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::end() const noexcept -> const_iterator
+	{
+		return m_data + m_size;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::push_back(Block block)
+	{
+		if (m_size >= m_capacity)
+			Grow(m_size + 1);
+
+		m_data[m_size++] = block;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::rbegin() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::rbegin() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::rend() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::rend() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::reserve(std::size_t capacity)
+	{
+		if (capacity > m_capacity)
+			Grow(capacity);
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::resize(std::size_t size, Block value)
+	{
+		if (size > m_capacity)
+			Grow(size);
+
+		if (size > m_size)
+			std::fill(m_data + m_size, m_data + size, value);
+
+		m_size = size;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::size_t Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block& Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::operator[](std::size_t i)
+	{
+		assert(i < m_size);
+		return m_data[i];
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Block Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::operator[](std::size_t i) const
+	{
+		assert(i < m_size);
+		return m_data[i];
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::operator=(const InlineStorage& storage) -> InlineStorage&
+	{
+		if (this == &storage)
+			return *this;
+
+		if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+		{
+			if (m_allocator != storage.m_allocator)
+			{
+				Release();
+				m_data = m_inlineBlocks.data();
+				m_capacity = InlineBlockCount;
+			}
+
+			m_allocator = storage.m_allocator;
+		}
+
+		if (storage.m_size > m_capacity)
+		{
+			m_size = 0;
+			Grow(storage.m_size);
+		}
+
+		// Blocks are trivially copyable
+		std::memcpy(m_data, storage.m_data, storage.m_size * sizeof(Block));
+		m_size = storage.m_size;
+
+		return *this;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	auto Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::operator=(InlineStorage&& storage) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || std::allocator_traits<Allocator>::is_always_equal::value) -> InlineStorage&
+	{
+		if (this == &storage)
+			return *this;
+
+		bool canSteal = !storage.IsInline();
+		if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value)
+			canSteal = canSteal && m_allocator == storage.m_allocator;
+
+		if (!canSteal)
+		{
+			// Inline blocks (or blocks we can't take ownership of) have to be copied
+			if (storage.m_size > m_capacity)
+			{
+				m_size = 0;
+				Grow(storage.m_size);
+			}
+
+			std::memcpy(m_data, storage.m_data, storage.m_size * sizeof(Block));
+			m_size = storage.m_size;
+			storage.m_size = 0;
+
+			return *this;
+		}
+
+		Release();
+
+		if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+			m_allocator = std::move(storage.m_allocator);
+
+		m_data = storage.m_data;
+		m_capacity = storage.m_capacity;
+		m_size = storage.m_size;
+
+		storage.m_data = storage.m_inlineBlocks.data();
+		storage.m_capacity = InlineBlockCount;
+		storage.m_size = 0;
+
+		return *this;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::Grow(std::size_t capacity)
+	{
+		capacity = std::max(capacity, m_capacity * 2);
+
+		Block* newData = AllocatorTraits::allocate(m_allocator, capacity);
+		std::memcpy(newData, m_data, m_size * sizeof(Block));
+
+		Release();
+
+		m_data = newData;
+		m_capacity = capacity;
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::IsInline() const noexcept
+	{
+		return m_data == m_inlineBlocks.data();
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void Bitset<Block, Allocator, InlineBlockCount>::InlineStorage::Release() noexcept
+	{
+		if (!IsInline())
+			AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+	}
+
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	std::ostream& operator<<(std::ostream& out, const Bitset<Block, Allocator, InlineBlockCount>& bitset)
 	{
 		return out << bitset.ToString();
 	}
@@ -1531,13 +2318,13 @@ namespace Nz
 	* \remark If one is bigger, they are equal only if the largest has the last bit set to '0'
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator==(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator==(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
 		// The comparison uses that (uint8) 00001100 == (uint16) 00000000 00001100
 		// and thus conserve this property
-		const Bitset<Block, Allocator>& greater = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? lhs : rhs;
-		const Bitset<Block, Allocator>& lesser = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? rhs : lhs;
+		const Bitset<Block, Allocator, InlineBlockCount>& greater = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? lhs : rhs;
+		const Bitset<Block, Allocator, InlineBlockCount>& lesser = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? rhs : lhs;
 
 		std::size_t maxBlockCount = greater.GetBlockCount();
 		std::size_t minBlockCount = lesser.GetBlockCount();
@@ -1565,8 +2352,8 @@ namespace Nz
 	* \param rhs Other bitset to compare with
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator!=(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator!=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
 		return !(lhs == rhs);
 	}
@@ -1579,11 +2366,11 @@ namespace Nz
 	* \param rhs Other bitset to compare with
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator<(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator<(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
-		const Bitset<Block, Allocator>& greater = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? lhs : rhs;
-		const Bitset<Block, Allocator>& lesser = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? rhs : lhs;
+		const Bitset<Block, Allocator, InlineBlockCount>& greater = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? lhs : rhs;
+		const Bitset<Block, Allocator, InlineBlockCount>& lesser = (lhs.GetBlockCount() > rhs.GetBlockCount()) ? rhs : lhs;
 
 		std::size_t maxBlockCount = greater.GetBlockCount();
 		std::size_t minBlockCount = lesser.GetBlockCount();
@@ -1614,8 +2401,8 @@ namespace Nz
 	* \param rhs Other bitset to compare with
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator<=(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator<=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
 		return lhs < rhs || lhs == rhs;
 	}
@@ -1628,8 +2415,8 @@ namespace Nz
 	* \param rhs Other bitset to compare with
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator>(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator>(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
 		return rhs < lhs;
 	}
@@ -1642,8 +2429,8 @@ namespace Nz
 	* \param rhs Other bitset to compare with
 	*/
 
-	template<typename Block, class Allocator>
-	bool operator>=(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	bool operator>=(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
 		return rhs <= lhs;
 	}
@@ -1656,10 +2443,10 @@ namespace Nz
 	* \param rhs Second bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator&(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator&(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
-		Bitset<Block, Allocator> bitset;
+		Bitset<Block, Allocator, InlineBlockCount> bitset;
 		bitset.PerformsAND(lhs, rhs);
 
 		return bitset;
@@ -1673,10 +2460,10 @@ namespace Nz
 	* \param rhs Second bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator|(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator|(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
-		Bitset<Block, Allocator> bitset;
+		Bitset<Block, Allocator, InlineBlockCount> bitset;
 		bitset.PerformsOR(lhs, rhs);
 
 		return bitset;
@@ -1690,10 +2477,10 @@ namespace Nz
 	* \param rhs Second bitset
 	*/
 
-	template<typename Block, class Allocator>
-	Bitset<Block, Allocator> operator^(const Bitset<Block, Allocator>& lhs, const Bitset<Block, Allocator>& rhs)
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	Bitset<Block, Allocator, InlineBlockCount> operator^(const Bitset<Block, Allocator, InlineBlockCount>& lhs, const Bitset<Block, Allocator, InlineBlockCount>& rhs)
 	{
-		Bitset<Block, Allocator> bitset;
+		Bitset<Block, Allocator, InlineBlockCount> bitset;
 		bitset.PerformsXOR(lhs, rhs);
 
 		return bitset;
@@ -1710,8 +2497,8 @@ namespace std
 	* \param rhs Second bitset
 	*/
 
-	template<typename Block, class Allocator>
-	void swap(Nz::Bitset<Block, Allocator>& lhs, Nz::Bitset<Block, Allocator>& rhs) noexcept
+	template<typename Block, class Allocator, std::size_t InlineBlockCount>
+	void swap(Nz::Bitset<Block, Allocator, InlineBlockCount>& lhs, Nz::Bitset<Block, Allocator, InlineBlockCount>& rhs) noexcept
 	{
 		lhs.Swap(rhs);
 	}
@@ -0,0 +1,169 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BITSETVIEW_HPP
+#define NAZARAUTILS_BITSETVIEW_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/BitKernels.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Nz
+{
+	class MutableBitsetView;
+
+	class BitsetView
+	{
+		friend MutableBitsetView;
+
+		public:
+			class BitIterator;
+			using PointerSequence = std::pair<const void*, std::size_t>; //< Start pointer, bit offset
+			struct bits_const_iter_tag;
+
+			BitsetView();
+			BitsetView(const void* ptr, std::size_t bitCount);
+			BitsetView(const void* ptr, std::size_t bitOffset, std::size_t bitCount);
+			BitsetView(const PointerSequence& sequence, std::size_t bitCount);
+			BitsetView(const BitsetView&) = default;
+			BitsetView(BitsetView&&) noexcept = default;
+			~BitsetView() = default;
+
+			std::size_t Count() const;
+			std::size_t CountAnd(const BitsetView& view) const;
+			std::size_t CountAndNot(const BitsetView& view) const;
+
+			std::size_t FindFirst() const;
+			std::size_t FindNext(std::size_t bit) const;
+
+			std::size_t GetBitOffset() const;
+			PointerSequence GetEndSequence() const;
+			const void* GetPointer() const;
+			std::size_t GetSize() const;
+			BitsetView GetSubView(std::size_t firstBit, std::size_t bitCount) const;
+
+			bool Intersects(const BitsetView& view) const;
+			bool IntersectsAndNot(const BitsetView& view) const;
+			bool IsSubsetOf(const BitsetView& view) const;
+
+			constexpr bits_const_iter_tag IterBits() const noexcept;
+
+			bool Test(std::size_t bit) const;
+			bool TestAll() const;
+			bool TestAny() const;
+			bool TestNone() const;
+
+			template<typename Block = UInt32, class Allocator = std::allocator<Block>> Bitset<Block, Allocator> ToBitset(const Allocator& allocator = Allocator()) const;
+			std::string ToString() const;
+
+			bool operator[](std::size_t bit) const;
+
+			BitsetView& operator=(const BitsetView&) = default;
+			BitsetView& operator=(BitsetView&&) noexcept = default;
+
+			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+			struct bits_const_iter_tag
+			{
+				BitIterator begin() const;
+				BitIterator end() const;
+
+				const BitsetView& viewRef;
+			};
+
+		protected:
+			std::size_t FindFrom(std::size_t bit) const;
+			const UInt8* GetBytePointer(std::size_t bit) const;
+			UInt64 LoadWord(std::size_t bit, std::size_t bitCount) const;
+			UInt64 LoadWordOrZero(std::size_t bit, std::size_t bitCount) const;
+
+			template<typename WordFunc, typename ByteFunc> static bool ForEachSpan(std::size_t bitOffset, std::size_t bitCount, bool byteAligned, WordFunc&& wordFunc, ByteFunc&& byteFunc);
+
+			static constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+			const UInt8* m_ptr;
+			std::size_t m_bitCount;
+			std::size_t m_bitOffset;
+	};
+
+	class MutableBitsetView : public BitsetView
+	{
+		public:
+			MutableBitsetView() = default;
+			MutableBitsetView(void* ptr, std::size_t bitCount);
+			MutableBitsetView(void* ptr, std::size_t bitOffset, std::size_t bitCount);
+			MutableBitsetView(const MutableBitsetView&) = default;
+			MutableBitsetView(MutableBitsetView&&) noexcept = default;
+			~MutableBitsetView() = default;
+
+			void Flip();
+
+			void* GetPointer() const;
+			MutableBitsetView GetSubView(std::size_t firstBit, std::size_t bitCount) const;
+
+			void PerformsAND(const BitsetView& a, const BitsetView& b);
+			void PerformsANDNOT(const BitsetView& a, const BitsetView& b);
+			void PerformsNOT(const BitsetView& a);
+			void PerformsOR(const BitsetView& a, const BitsetView& b);
+			void PerformsXOR(const BitsetView& a, const BitsetView& b);
+
+			void Reset();
+			void Reset(std::size_t bit);
+
+			void Set(bool val = true);
+			void Set(std::size_t bit, bool val = true);
+
+			MutableBitsetView& operator=(const MutableBitsetView&) = default;
+			MutableBitsetView& operator=(MutableBitsetView&&) noexcept = default;
+
+			MutableBitsetView& operator&=(const BitsetView& view);
+			MutableBitsetView& operator|=(const BitsetView& view);
+			MutableBitsetView& operator^=(const BitsetView& view);
+
+		private:
+			template<typename WordOp, typename ByteOp> void PerformsOp(const BitsetView& a, const BitsetView& b, WordOp&& wordOp, ByteOp&& byteOp);
+			void StoreWord(std::size_t bit, std::size_t bitCount, UInt64 word);
+	};
+
+	class BitsetView::BitIterator
+	{
+		friend BitsetView;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::size_t;
+
+			constexpr BitIterator(const BitIterator&) = default;
+			constexpr BitIterator(BitIterator&&) noexcept = default;
+
+			constexpr BitIterator& operator=(const BitIterator&) = default;
+			constexpr BitIterator& operator=(BitIterator&&) noexcept = default;
+
+			BitIterator operator++(int);
+			BitIterator& operator++();
+
+			constexpr bool operator==(const BitIterator& rhs) const;
+			constexpr bool operator!=(const BitIterator& rhs) const;
+			constexpr value_type operator*() const;
+
+		private:
+			constexpr BitIterator(bits_const_iter_tag viewTag, std::size_t bitIndex);
+
+			std::size_t m_bitIndex;
+			const BitsetView* m_owner;
+	};
+}
+
+#include <NazaraUtils/BitsetView.inl>
+
+#endif // NAZARAUTILS_BITSETVIEW_HPP
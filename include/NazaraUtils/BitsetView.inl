@@ -0,0 +1,811 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::BitsetView
+	* \brief Core class that represents a non-owning read-only view over bits stored in external memory
+	*
+	* Bits are read in the same order as Bitset::Write and Bitset::FromPointer: bit i of the view is bit (bitOffset + i) % 8 of the byte (bitOffset + i) / 8.
+	* Unlike those functions, no bit is ever copied nor allocated, which makes it suitable to query bitfields from network packets or memory-mapped files.
+	*
+	* Operations between views with the same bit offset (modulo 8) use the bit kernels on whole bytes, other views are processed 64 bits at a time.
+	*
+	* \remark The memory must outlive the view, and only the ceil((bitOffset + bitCount) / 8) bytes covered by the view are ever accessed
+	*
+	* \see Bitset
+	* \see MutableBitsetView
+	*/
+
+	/*!
+	* \brief Constructs an empty view
+	*/
+	inline BitsetView::BitsetView() :
+	m_ptr(nullptr),
+	m_bitCount(0),
+	m_bitOffset(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a view over bitCount bits starting at ptr
+	*
+	* \param ptr Pointer to the first byte of the bits
+	* \param bitCount Number of bits of the view
+	*/
+	inline BitsetView::BitsetView(const void* ptr, std::size_t bitCount) :
+	BitsetView(ptr, 0, bitCount)
+	{
+	}
+
+	/*!
+	* \brief Constructs a view over bitCount bits starting at bitOffset bits after ptr
+	*
+	* \param ptr Pointer to the memory holding the bits
+	* \param bitOffset Index of the first bit of the view, can be greater than 8
+	* \param bitCount Number of bits of the view
+	*/
+	inline BitsetView::BitsetView(const void* ptr, std::size_t bitOffset, std::size_t bitCount) :
+	m_ptr(static_cast<const UInt8*>(ptr) + bitOffset / 8),
+	m_bitCount(bitCount),
+	m_bitOffset(bitOffset % 8)
+	{
+		assert((ptr || bitCount == 0) && "Invalid pointer");
+	}
+
+	/*!
+	* \brief Constructs a view over bitCount bits starting at a pointer sequence
+	*
+	* \param sequence Pointer sequence (as returned by Bitset::Write or GetEndSequence) to the first bit of the view
+	* \param bitCount Number of bits of the view
+	*/
+	inline BitsetView::BitsetView(const PointerSequence& sequence, std::size_t bitCount) :
+	BitsetView(sequence.first, sequence.second, bitCount)
+	{
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1
+	* \return Number of bits set to 1
+	*/
+	inline std::size_t BitsetView::Count() const
+	{
+		std::size_t count = 0;
+		ForEachSpan(m_bitOffset, m_bitCount, true, [&](std::size_t bit, std::size_t bitCount)
+		{
+			count += CountBits(LoadWord(bit, bitCount));
+			return true;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			count += BitKernels::Count(GetBytePointer(bit), byteCount);
+			return true;
+		});
+
+		return count;
+	}
+
+	/*!
+	* \brief Counts the number of bits set in both views
+	* \return Number of bits set in this & view
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline std::size_t BitsetView::CountAnd(const BitsetView& view) const
+	{
+		std::size_t count = 0;
+		ForEachSpan(m_bitOffset, std::min(m_bitCount, view.m_bitCount), m_bitOffset == view.m_bitOffset, [&](std::size_t bit, std::size_t bitCount)
+		{
+			count += CountBits(LoadWord(bit, bitCount) & view.LoadWord(bit, bitCount));
+			return true;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			count += BitKernels::CountAnd(GetBytePointer(bit), view.GetBytePointer(bit), byteCount);
+			return true;
+		});
+
+		return count;
+	}
+
+	/*!
+	* \brief Counts the number of bits set in this view but not in the other one
+	* \return Number of bits set in this & ~view
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline std::size_t BitsetView::CountAndNot(const BitsetView& view) const
+	{
+		std::size_t sharedBitCount = std::min(m_bitCount, view.m_bitCount);
+
+		std::size_t count = 0;
+		ForEachSpan(m_bitOffset, sharedBitCount, m_bitOffset == view.m_bitOffset, [&](std::size_t bit, std::size_t bitCount)
+		{
+			count += CountBits(LoadWord(bit, bitCount) & ~view.LoadWord(bit, bitCount));
+			return true;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			count += BitKernels::CountAndNot(GetBytePointer(bit), view.GetBytePointer(bit), byteCount);
+			return true;
+		});
+
+		return count + GetSubView(sharedBitCount, m_bitCount - sharedBitCount).Count();
+	}
+
+	/*!
+	* \brief Finds the first bit set to one in the view
+	* \return Index of the first bit set to one, npos if there's none
+	*/
+	inline std::size_t BitsetView::FindFirst() const
+	{
+		return FindFrom(0);
+	}
+
+	/*!
+	* \brief Finds the next bit set to one in the view
+	* \return Index of the next bit set to one after bit, npos if there's none
+	*
+	* \param bit Index of the bit, the search begin with bit + 1
+	*/
+	inline std::size_t BitsetView::FindNext(std::size_t bit) const
+	{
+		assert((bit < m_bitCount) && "Bit index out of range");
+
+		return FindFrom(bit + 1);
+	}
+
+	/*!
+	* \brief Gets the index of the first bit of the view in the byte returned by GetPointer
+	* \return Bit offset, always lower than 8
+	*/
+	inline std::size_t BitsetView::GetBitOffset() const
+	{
+		return m_bitOffset;
+	}
+
+	/*!
+	* \brief Gets the pointer sequence following the last bit of the view
+	* \return A pointer to the next byte to read along with the next bit index, useful to read consecutive bitfields
+	*/
+	inline auto BitsetView::GetEndSequence() const -> PointerSequence
+	{
+		std::size_t endBit = m_bitOffset + m_bitCount;
+		return PointerSequence(m_ptr + endBit / 8, endBit % 8);
+	}
+
+	/*!
+	* \brief Gets the pointer to the byte holding the first bit of the view
+	* \return Pointer to the first byte of the view
+	*/
+	inline const void* BitsetView::GetPointer() const
+	{
+		return m_ptr;
+	}
+
+	/*!
+	* \brief Gets the number of bits of the view
+	* \return Size of the view
+	*/
+	inline std::size_t BitsetView::GetSize() const
+	{
+		return m_bitCount;
+	}
+
+	/*!
+	* \brief Gets a view over part of this view
+	* \return View over bitCount bits starting at firstBit
+	*
+	* \param firstBit Index of the first bit of the sub-view
+	* \param bitCount Number of bits of the sub-view
+	*/
+	inline BitsetView BitsetView::GetSubView(std::size_t firstBit, std::size_t bitCount) const
+	{
+		assert((firstBit + bitCount <= m_bitCount) && "Sub-view out of range");
+
+		return BitsetView(m_ptr, m_bitOffset + firstBit, bitCount);
+	}
+
+	/*!
+	* \brief Checks if both views have at least one bit set in common
+	* \return True if this & view is not zero
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline bool BitsetView::Intersects(const BitsetView& view) const
+	{
+		return !ForEachSpan(m_bitOffset, std::min(m_bitCount, view.m_bitCount), m_bitOffset == view.m_bitOffset, [&](std::size_t bit, std::size_t bitCount)
+		{
+			return (LoadWord(bit, bitCount) & view.LoadWord(bit, bitCount)) == 0;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			return !BitKernels::Intersects(GetBytePointer(bit), view.GetBytePointer(bit), byteCount);
+		});
+	}
+
+	/*!
+	* \brief Checks if this view has at least one bit set which isn't set in the other one
+	* \return True if this & ~view is not zero
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline bool BitsetView::IntersectsAndNot(const BitsetView& view) const
+	{
+		std::size_t sharedBitCount = std::min(m_bitCount, view.m_bitCount);
+
+		bool intersects = !ForEachSpan(m_bitOffset, sharedBitCount, m_bitOffset == view.m_bitOffset, [&](std::size_t bit, std::size_t bitCount)
+		{
+			return (LoadWord(bit, bitCount) & ~view.LoadWord(bit, bitCount)) == 0;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			return !BitKernels::IntersectsAndNot(GetBytePointer(bit), view.GetBytePointer(bit), byteCount);
+		});
+
+		return intersects || GetSubView(sharedBitCount, m_bitCount - sharedBitCount).TestAny();
+	}
+
+	/*!
+	* \brief Checks if every bit set in this view is also set in the other one
+	* \return True if this view is a subset of the other one
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline bool BitsetView::IsSubsetOf(const BitsetView& view) const
+	{
+		return !IntersectsAndNot(view);
+	}
+
+	constexpr auto BitsetView::IterBits() const noexcept -> bits_const_iter_tag
+	{
+		return bits_const_iter_tag{ *this };
+	}
+
+	/*!
+	* \brief Tests the bit at the index
+	* \return True if the bit is set to 1
+	*
+	* \param bit Index of the bit
+	*/
+	inline bool BitsetView::Test(std::size_t bit) const
+	{
+		assert((bit < m_bitCount) && "Bit index out of range");
+
+		std::size_t absoluteBit = m_bitOffset + bit;
+		return (m_ptr[absoluteBit / 8] & (1U << (absoluteBit % 8))) != 0;
+	}
+
+	/*!
+	* \brief Tests if all bits are set
+	* \return True if every bit of the view is set to 1 (or if the view is empty)
+	*/
+	inline bool BitsetView::TestAll() const
+	{
+		for (std::size_t i = 0; i < m_bitCount; i += bitsPerWord)
+		{
+			std::size_t bitCount = std::min(bitsPerWord, m_bitCount - i);
+			if (LoadWord(i, bitCount) != (std::numeric_limits<UInt64>::max() >> (bitsPerWord - bitCount)))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Tests if one bit is set
+	* \return True if at least one bit of the view is set to 1
+	*/
+	inline bool BitsetView::TestAny() const
+	{
+		// x & x is non-zero if any bit of x is set
+		return Intersects(*this);
+	}
+
+	/*!
+	* \brief Tests if no bit is set
+	* \return True if every bit of the view is set to 0
+	*/
+	inline bool BitsetView::TestNone() const
+	{
+		return !TestAny();
+	}
+
+	/*!
+	* \brief Copies the bits of the view into a bitset
+	* \return Bitset holding a copy of the bits
+	*
+	* \param allocator Allocator used for the bitset storage
+	*/
+	template<typename Block, class Allocator>
+	Bitset<Block, Allocator> BitsetView::ToBitset(const Allocator& allocator) const
+	{
+		Bitset<Block, Allocator> bitset(allocator);
+		if (m_bitCount > 0)
+			bitset.Write(typename Bitset<Block, Allocator>::PointerSequence(m_ptr, m_bitOffset), m_bitCount);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Gives a string representation
+	* \return A string representation of the view, from the last bit to the first one
+	*/
+	inline std::string BitsetView::ToString() const
+	{
+		std::string str(m_bitCount, '0');
+
+		for (std::size_t i = 0; i < m_bitCount; ++i)
+		{
+			if (Test(i))
+				str[m_bitCount - i - 1] = '1';
+		}
+
+		return str;
+	}
+
+	/*!
+	* \brief Tests the bit at the index
+	* \return True if the bit is set to 1
+	*
+	* \param bit Index of the bit
+	*/
+	inline bool BitsetView::operator[](std::size_t bit) const
+	{
+		return Test(bit);
+	}
+
+	inline std::size_t BitsetView::FindFrom(std::size_t bit) const
+	{
+		for (std::size_t i = bit; i < m_bitCount; i += bitsPerWord)
+		{
+			UInt64 word = LoadWord(i, std::min(bitsPerWord, m_bitCount - i));
+			if (word != 0)
+				return i + FindFirstBit(word) - 1;
+		}
+
+		return npos;
+	}
+
+	inline const UInt8* BitsetView::GetBytePointer(std::size_t bit) const
+	{
+		assert(((m_bitOffset + bit) % 8 == 0) && "Bit is not the first one of a byte");
+
+		return m_ptr + (m_bitOffset + bit) / 8;
+	}
+
+	/*!
+	* \brief Reads up to 64 consecutive bits of the view
+	* \return Bits [bit, bit + bitCount) of the view, higher bits being zero
+	*
+	* \param bit Index of the first bit to read
+	* \param bitCount Number of bits to read, from 1 to 64
+	*
+	* \remark Only the bytes holding the requested bits are read
+	*/
+	inline UInt64 BitsetView::LoadWord(std::size_t bit, std::size_t bitCount) const
+	{
+		assert((bitCount > 0 && bitCount <= bitsPerWord) && "Invalid bit count");
+		assert((bit + bitCount <= m_bitCount) && "Bit index out of range");
+
+		std::size_t absoluteBit = m_bitOffset + bit;
+		const UInt8* ptr = m_ptr + absoluteBit / 8;
+		std::size_t shift = absoluteBit % 8;
+		std::size_t byteCount = (shift + bitCount + 7) / 8; //< up to 9 bytes
+
+		UInt64 word;
+		if (byteCount >= 8)
+		{
+			std::memcpy(&word, ptr, sizeof(UInt64));
+			word = LittleEndianToHost(word) >> shift;
+			if (byteCount > 8)
+				word |= UInt64(ptr[8]) << (bitsPerWord - shift);
+		}
+		else
+		{
+			word = 0;
+			for (std::size_t i = 0; i < byteCount; ++i)
+				word |= UInt64(ptr[i]) << (i * 8);
+
+			word >>= shift;
+		}
+
+		if (bitCount < bitsPerWord)
+			word &= (UInt64(1U) << bitCount) - 1U;
+
+		return word;
+	}
+
+	inline UInt64 BitsetView::LoadWordOrZero(std::size_t bit, std::size_t bitCount) const
+	{
+		if (bit >= m_bitCount)
+			return 0;
+
+		return LoadWord(bit, std::min(bitCount, m_bitCount - bit));
+	}
+
+	/*!
+	* \brief Splits a range of bits in spans of at most 64 bits and spans of whole bytes
+	* \return False if one of the callbacks returned false (which stops the iteration), true otherwise
+	*
+	* \param bitOffset Bit offset of the views
+	* \param bitCount Number of bits to process
+	* \param byteAligned Whether every view processed has the same bit offset, if false only spans of at most 64 bits are used
+	* \param wordFunc Callback taking a bit index and a bit count (up to 64)
+	* \param byteFunc Callback taking the index of a bit starting a byte and a byte count
+	*/
+	template<typename WordFunc, typename ByteFunc>
+	bool BitsetView::ForEachSpan(std::size_t bitOffset, std::size_t bitCount, bool byteAligned, WordFunc&& wordFunc, ByteFunc&& byteFunc)
+	{
+		if (!byteAligned)
+		{
+			for (std::size_t i = 0; i < bitCount; i += bitsPerWord)
+			{
+				if (!wordFunc(i, std::min(bitsPerWord, bitCount - i)))
+					return false;
+			}
+
+			return true;
+		}
+
+		// Bits up to the first byte boundary, then whole bytes and then the remaining bits
+		std::size_t headBitCount = std::min(bitCount, (8 - bitOffset) % 8);
+		if (headBitCount > 0 && !wordFunc(0, headBitCount))
+			return false;
+
+		std::size_t byteCount = (bitCount - headBitCount) / 8;
+		if (byteCount > 0 && !byteFunc(headBitCount, byteCount))
+			return false;
+
+		std::size_t tailBit = headBitCount + byteCount * 8;
+		if (tailBit < bitCount && !wordFunc(tailBit, bitCount - tailBit))
+			return false;
+
+		return true;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::MutableBitsetView
+	* \brief Core class that represents a non-owning view over bits stored in external memory, which can be modified
+	*
+	* Bits of the bytes covered by the view but outside of it are never modified.
+	*
+	* \see BitsetView
+	*/
+
+	/*!
+	* \brief Constructs a view over bitCount bits starting at ptr
+	*
+	* \param ptr Pointer to the first byte of the bits
+	* \param bitCount Number of bits of the view
+	*/
+	inline MutableBitsetView::MutableBitsetView(void* ptr, std::size_t bitCount) :
+	BitsetView(ptr, bitCount)
+	{
+	}
+
+	/*!
+	* \brief Constructs a view over bitCount bits starting at bitOffset bits after ptr
+	*
+	* \param ptr Pointer to the memory holding the bits
+	* \param bitOffset Index of the first bit of the view, can be greater than 8
+	* \param bitCount Number of bits of the view
+	*/
+	inline MutableBitsetView::MutableBitsetView(void* ptr, std::size_t bitOffset, std::size_t bitCount) :
+	BitsetView(ptr, bitOffset, bitCount)
+	{
+	}
+
+	/*!
+	* \brief Flips each bit of the view
+	*/
+	inline void MutableBitsetView::Flip()
+	{
+		PerformsNOT(*this);
+	}
+
+	/*!
+	* \brief Gets the pointer to the byte holding the first bit of the view
+	* \return Pointer to the first byte of the view
+	*/
+	inline void* MutableBitsetView::GetPointer() const
+	{
+		return const_cast<UInt8*>(m_ptr);
+	}
+
+	/*!
+	* \brief Gets a view over part of this view
+	* \return View over bitCount bits starting at firstBit
+	*
+	* \param firstBit Index of the first bit of the sub-view
+	* \param bitCount Number of bits of the sub-view
+	*/
+	inline MutableBitsetView MutableBitsetView::GetSubView(std::size_t firstBit, std::size_t bitCount) const
+	{
+		assert((firstBit + bitCount <= m_bitCount) && "Sub-view out of range");
+
+		return MutableBitsetView(GetPointer(), m_bitOffset + firstBit, bitCount);
+	}
+
+	/*!
+	* \brief Performs the "AND" operator between two views and stores the result in this view
+	*
+	* \param a First view
+	* \param b Second view
+	*
+	* \remark Missing bits of a and b are considered to be 0, the size of this view never changes
+	* \remark a and b may be this view, but must not partially overlap it
+	*/
+	inline void MutableBitsetView::PerformsAND(const BitsetView& a, const BitsetView& b)
+	{
+		PerformsOp(a, b, [](UInt64 x, UInt64 y) { return x & y; }, BitKernels::And);
+	}
+
+	/*!
+	* \brief Performs the "AND NOT" operator between two views (a & ~b) and stores the result in this view
+	*
+	* \param a First view
+	* \param b Second view, which is negated
+	*
+	* \remark Missing bits of a and b are considered to be 0, the size of this view never changes
+	* \remark a and b may be this view, but must not partially overlap it
+	*/
+	inline void MutableBitsetView::PerformsANDNOT(const BitsetView& a, const BitsetView& b)
+	{
+		PerformsOp(a, b, [](UInt64 x, UInt64 y) { return x & ~y; }, BitKernels::AndNot);
+	}
+
+	/*!
+	* \brief Performs the "NOT" operator on a view and stores the result in this view
+	*
+	* \param a View to negate
+	*
+	* \remark Missing bits of a are considered to be 0 (and are thus set to 1 in this view)
+	* \remark a may be this view, but must not partially overlap it
+	*/
+	inline void MutableBitsetView::PerformsNOT(const BitsetView& a)
+	{
+		PerformsOp(a, a, [](UInt64 x, UInt64 /*y*/) { return ~x; }, [](void* dst, const void* x, const void* /*y*/, std::size_t byteCount)
+		{
+			BitKernels::Not(dst, x, byteCount);
+		});
+	}
+
+	/*!
+	* \brief Performs the "OR" operator between two views and stores the result in this view
+	*
+	* \param a First view
+	* \param b Second view
+	*
+	* \remark Missing bits of a and b are considered to be 0, the size of this view never changes
+	* \remark a and b may be this view, but must not partially overlap it
+	*/
+	inline void MutableBitsetView::PerformsOR(const BitsetView& a, const BitsetView& b)
+	{
+		PerformsOp(a, b, [](UInt64 x, UInt64 y) { return x | y; }, BitKernels::Or);
+	}
+
+	/*!
+	* \brief Performs the "XOR" operator between two views and stores the result in this view
+	*
+	* \param a First view
+	* \param b Second view
+	*
+	* \remark Missing bits of a and b are considered to be 0, the size of this view never changes
+	* \remark a and b may be this view, but must not partially overlap it
+	*/
+	inline void MutableBitsetView::PerformsXOR(const BitsetView& a, const BitsetView& b)
+	{
+		PerformsOp(a, b, [](UInt64 x, UInt64 y) { return x ^ y; }, BitKernels::Xor);
+	}
+
+	/*!
+	* \brief Sets every bit of the view to 0
+	*/
+	inline void MutableBitsetView::Reset()
+	{
+		Set(false);
+	}
+
+	/*!
+	* \brief Sets the bit at the index to 0
+	*
+	* \param bit Index of the bit
+	*/
+	inline void MutableBitsetView::Reset(std::size_t bit)
+	{
+		Set(bit, false);
+	}
+
+	/*!
+	* \brief Sets every bit of the view
+	*
+	* \param val Value of the bits
+	*/
+	inline void MutableBitsetView::Set(bool val)
+	{
+		ForEachSpan(m_bitOffset, m_bitCount, true, [&](std::size_t bit, std::size_t bitCount)
+		{
+			StoreWord(bit, bitCount, (val) ? std::numeric_limits<UInt64>::max() : 0U);
+			return true;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			std::memset(const_cast<UInt8*>(GetBytePointer(bit)), (val) ? 0xFF : 0x00, byteCount);
+			return true;
+		});
+	}
+
+	/*!
+	* \brief Sets the bit at the index
+	*
+	* \param bit Index of the bit
+	* \param val Value of the bit
+	*/
+	inline void MutableBitsetView::Set(std::size_t bit, bool val)
+	{
+		assert((bit < m_bitCount) && "Bit index out of range");
+
+		std::size_t absoluteBit = m_bitOffset + bit;
+		UInt8& byte = const_cast<UInt8&>(m_ptr[absoluteBit / 8]);
+		UInt8 mask = UInt8(1U << (absoluteBit % 8));
+
+		byte = (val) ? UInt8(byte | mask) : UInt8(byte & ~mask);
+	}
+
+	/*!
+	* \brief Performs an "AND" with another view
+	* \return A reference to this
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline MutableBitsetView& MutableBitsetView::operator&=(const BitsetView& view)
+	{
+		PerformsAND(*this, view);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs an "OR" with another view
+	* \return A reference to this
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline MutableBitsetView& MutableBitsetView::operator|=(const BitsetView& view)
+	{
+		PerformsOR(*this, view);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs a "XOR" with another view
+	* \return A reference to this
+	*
+	* \param view Other view, missing bits are considered to be 0
+	*/
+	inline MutableBitsetView& MutableBitsetView::operator^=(const BitsetView& view)
+	{
+		PerformsXOR(*this, view);
+
+		return *this;
+	}
+
+	template<typename WordOp, typename ByteOp>
+	void MutableBitsetView::PerformsOp(const BitsetView& a, const BitsetView& b, WordOp&& wordOp, ByteOp&& byteOp)
+	{
+		std::size_t sharedBitCount = std::min({ m_bitCount, a.m_bitCount, b.m_bitCount });
+		bool byteAligned = (a.m_bitOffset == m_bitOffset && b.m_bitOffset == m_bitOffset);
+
+		ForEachSpan(m_bitOffset, sharedBitCount, byteAligned, [&](std::size_t bit, std::size_t bitCount)
+		{
+			StoreWord(bit, bitCount, wordOp(a.LoadWord(bit, bitCount), b.LoadWord(bit, bitCount)));
+			return true;
+		},
+		[&](std::size_t bit, std::size_t byteCount)
+		{
+			byteOp(const_cast<UInt8*>(GetBytePointer(bit)), a.GetBytePointer(bit), b.GetBytePointer(bit), byteCount);
+			return true;
+		});
+
+		for (std::size_t i = sharedBitCount; i < m_bitCount; i += bitsPerWord)
+		{
+			std::size_t bitCount = std::min(bitsPerWord, m_bitCount - i);
+			StoreWord(i, bitCount, wordOp(a.LoadWordOrZero(i, bitCount), b.LoadWordOrZero(i, bitCount)));
+		}
+	}
+
+	/*!
+	* \brief Writes up to 64 consecutive bits of the view
+	*
+	* \param bit Index of the first bit to write
+	* \param bitCount Number of bits to write, from 1 to 64
+	* \param word Bits to write, higher bits are ignored
+	*
+	* \remark Bits sharing a byte with the written bits are left untouched
+	*/
+	inline void MutableBitsetView::StoreWord(std::size_t bit, std::size_t bitCount, UInt64 word)
+	{
+		assert((bitCount > 0 && bitCount <= bitsPerWord) && "Invalid bit count");
+		assert((bit + bitCount <= m_bitCount) && "Bit index out of range");
+
+		std::size_t absoluteBit = m_bitOffset + bit;
+		UInt8* ptr = const_cast<UInt8*>(m_ptr) + absoluteBit / 8;
+		std::size_t shift = absoluteBit % 8;
+
+		if (shift == 0 && bitCount == bitsPerWord)
+		{
+			word = HostToLittleEndian(word);
+			std::memcpy(ptr, &word, sizeof(UInt64));
+			return;
+		}
+
+		for (; bitCount > 0; ++ptr)
+		{
+			std::size_t byteBitCount = std::min(8 - shift, bitCount);
+			UInt8 mask = UInt8(((1U << byteBitCount) - 1U) << shift);
+
+			*ptr = UInt8((*ptr & ~mask) | ((word << shift) & mask));
+
+			word >>= byteBitCount;
+			bitCount -= byteBitCount;
+			shift = 0;
+		}
+	}
+
+
+	inline auto BitsetView::bits_const_iter_tag::begin() const -> BitIterator
+	{
+		return BitIterator(*this, viewRef.FindFirst());
+	}
+
+	inline auto BitsetView::bits_const_iter_tag::end() const -> BitIterator
+	{
+		return BitIterator(*this, viewRef.npos);
+	}
+
+
+	constexpr BitsetView::BitIterator::BitIterator(bits_const_iter_tag viewTag, std::size_t bitIndex) :
+	m_bitIndex(bitIndex),
+	m_owner(&viewTag.viewRef)
+	{
+	}
+
+	inline auto BitsetView::BitIterator::operator++(int) -> BitIterator
+	{
+		BitIterator copy(*this);
+		operator++();
+		return copy;
+	}
+
+	inline auto BitsetView::BitIterator::operator++() -> BitIterator&
+	{
+		m_bitIndex = m_owner->FindNext(m_bitIndex);
+		return *this;
+	}
+
+	constexpr bool BitsetView::BitIterator::operator==(const BitIterator& rhs) const
+	{
+		return m_bitIndex == rhs.m_bitIndex;
+	}
+
+	constexpr bool BitsetView::BitIterator::operator!=(const BitIterator& rhs) const
+	{
+		return m_bitIndex != rhs.m_bitIndex;
+	}
+
+	constexpr auto BitsetView::BitIterator::operator*() const -> value_type
+	{
+		return m_bitIndex;
+	}
+}
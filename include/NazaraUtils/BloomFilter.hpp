@@ -0,0 +1,90 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BLOOMFILTER_HPP
+#define NAZARAUTILS_BLOOMFILTER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename Key, typename Hash = FastHash<Key>>
+	class BloomFilter
+	{
+		public:
+			BloomFilter(std::size_t bitCount, std::size_t hashCount, const Hash& hash = Hash());
+			BloomFilter(const BloomFilter&) = default;
+			BloomFilter(BloomFilter&&) noexcept = default;
+			~BloomFilter() = default;
+
+			void Clear();
+
+			std::size_t GetBitCount() const;
+			std::size_t GetHashCount() const;
+
+			void Insert(const Key& key);
+
+			bool MayContain(const Key& key) const;
+			void Merge(const BloomFilter& filter);
+
+			BloomFilter& operator=(const BloomFilter&) = default;
+			BloomFilter& operator=(BloomFilter&&) noexcept = default;
+
+		private:
+			template<typename F> bool ForEachProbe(const Key& key, F&& func) const;
+
+			Bitset<UInt64> m_bits;
+			Hash m_hash;
+			std::size_t m_bitMask;
+			std::size_t m_hashCount;
+	};
+
+	template<typename Key, typename Hash = FastHash<Key>>
+	class BlockedBloomFilter
+	{
+		public:
+			BlockedBloomFilter(std::size_t bitCount, std::size_t hashCount, const Hash& hash = Hash());
+			BlockedBloomFilter(const BlockedBloomFilter&) = default;
+			BlockedBloomFilter(BlockedBloomFilter&&) noexcept = default;
+			~BlockedBloomFilter() = default;
+
+			void Clear();
+
+			std::size_t GetBitCount() const;
+			std::size_t GetHashCount() const;
+
+			void Insert(const Key& key);
+
+			bool MayContain(const Key& key) const;
+			void Merge(const BlockedBloomFilter& filter);
+
+			BlockedBloomFilter& operator=(const BlockedBloomFilter&) = default;
+			BlockedBloomFilter& operator=(BlockedBloomFilter&&) noexcept = default;
+
+			static constexpr std::size_t BlockBitCount = CacheLineSize * 8;
+
+		private:
+			static constexpr std::size_t WordsPerBlock = CacheLineSize / sizeof(UInt64);
+
+			template<typename F> bool ForEachProbe(const Key& key, F&& func) const;
+
+			Bitset<UInt64, AlignedAllocator<UInt64, CacheLineSize>> m_bits;
+			Hash m_hash;
+			std::size_t m_blockMask;
+			std::size_t m_hashCount;
+	};
+
+	inline std::size_t ComputeBloomFilterBitCount(std::size_t expectedCount, double falsePositiveRate);
+	inline std::size_t ComputeBloomFilterHashCount(std::size_t bitCount, std::size_t expectedCount);
+}
+
+#include <NazaraUtils/BloomFilter.inl>
+
+#endif // NAZARAUTILS_BLOOMFILTER_HPP
@@ -0,0 +1,292 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::BloomFilter
+	* \brief Probabilistic set answering "definitely not present" or "maybe present", using a fixed amount of memory
+	*
+	* Each key sets hashCount bits of a Bitset, chosen by double hashing a single 64-bit hash (the hash of the key is mixed, an identity std::hash is fine).
+	* A key whose bits are not all set was never inserted, keys cannot be removed.
+	*
+	* \remark The bit count is rounded up to a power of two
+	* \see BlockedBloomFilter, CuckooFilter, ComputeBloomFilterBitCount, ComputeBloomFilterHashCount
+	*/
+
+	/*!
+	* \brief Constructs an empty filter
+	*
+	* \param bitCount Number of bits of the filter, rounded up to a power of two (see ComputeBloomFilterBitCount)
+	* \param hashCount Number of bits set by each key (see ComputeBloomFilterHashCount)
+	* \param hash Hasher of the keys
+	*/
+	template<typename Key, typename Hash>
+	BloomFilter<Key, Hash>::BloomFilter(std::size_t bitCount, std::size_t hashCount, const Hash& hash) :
+	m_bits(RoundToPow2(std::max<std::size_t>(bitCount, Bitset<UInt64>::bitsPerBlock)), false),
+	m_hash(hash),
+	m_hashCount(hashCount)
+	{
+		assert(hashCount > 0);
+		m_bitMask = m_bits.GetSize() - 1;
+	}
+
+	/*!
+	* \brief Removes every key from the filter
+	*/
+	template<typename Key, typename Hash>
+	void BloomFilter<Key, Hash>::Clear()
+	{
+		m_bits.Reset();
+	}
+
+	/*!
+	* \brief Returns the number of bits of the filter
+	*/
+	template<typename Key, typename Hash>
+	std::size_t BloomFilter<Key, Hash>::GetBitCount() const
+	{
+		return m_bits.GetSize();
+	}
+
+	/*!
+	* \brief Returns the number of bits set by each key
+	*/
+	template<typename Key, typename Hash>
+	std::size_t BloomFilter<Key, Hash>::GetHashCount() const
+	{
+		return m_hashCount;
+	}
+
+	/*!
+	* \brief Inserts a key in the filter
+	*
+	* \param key Key to insert
+	*/
+	template<typename Key, typename Hash>
+	void BloomFilter<Key, Hash>::Insert(const Key& key)
+	{
+		ForEachProbe(key, [&](std::size_t bit)
+		{
+			m_bits.Set(bit);
+			return true;
+		});
+	}
+
+	/*!
+	* \brief Checks if a key may have been inserted
+	* \return False if the key was never inserted, true if it was inserted or in case of a false positive
+	*
+	* \param key Key to check
+	*/
+	template<typename Key, typename Hash>
+	bool BloomFilter<Key, Hash>::MayContain(const Key& key) const
+	{
+		return ForEachProbe(key, [&](std::size_t bit)
+		{
+			return m_bits.Test(bit);
+		});
+	}
+
+	/*!
+	* \brief Adds every key of another filter to this one (bitwise OR), to combine filters built separately (for example, by multiple threads)
+	*
+	* \param filter Filter to merge, must have the same bit count, hash count and hasher than this one
+	*/
+	template<typename Key, typename Hash>
+	void BloomFilter<Key, Hash>::Merge(const BloomFilter& filter)
+	{
+		assert(filter.m_bits.GetSize() == m_bits.GetSize() && filter.m_hashCount == m_hashCount);
+		m_bits |= filter.m_bits;
+	}
+
+	template<typename Key, typename Hash>
+	template<typename F>
+	bool BloomFilter<Key, Hash>::ForEachProbe(const Key& key, F&& func) const
+	{
+		// Kirsch-Mitzenmacher double hashing: probe i is h1 + i * h2, with an odd h2 to visit different bits of the power of two sized bitset
+		UInt64 hash = Detail::WyMix(static_cast<UInt64>(m_hash(key)), 0x9E3779B97F4A7C15ull);
+		UInt64 h1 = hash;
+		UInt64 h2 = ((hash >> 32) | (hash << 32)) | 1;
+
+		for (std::size_t i = 0; i < m_hashCount; ++i)
+		{
+			if (!func(static_cast<std::size_t>(h1 & m_bitMask)))
+				return false;
+
+			h1 += h2;
+		}
+
+		return true;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::BlockedBloomFilter
+	* \brief Bloom filter whose bits of a key all lie in the same cache line
+	*
+	* The filter is split in blocks of one cache line (aligned in memory), a key selects a block and sets hashCount bits in it:
+	* inserting or querying a key touches a single cache line, at the cost of a slightly higher false positive rate than BloomFilter for the same size.
+	*
+	* \remark The bit count is rounded up to a power of two number of blocks
+	* \see BloomFilter
+	*/
+
+	/*!
+	* \brief Constructs an empty filter
+	*
+	* \param bitCount Number of bits of the filter, rounded up to a power of two number of blocks (see ComputeBloomFilterBitCount)
+	* \param hashCount Number of bits set by each key in its block (see ComputeBloomFilterHashCount)
+	* \param hash Hasher of the keys
+	*/
+	template<typename Key, typename Hash>
+	BlockedBloomFilter<Key, Hash>::BlockedBloomFilter(std::size_t bitCount, std::size_t hashCount, const Hash& hash) :
+	m_bits(RoundToPow2(std::max<std::size_t>((bitCount + BlockBitCount - 1) / BlockBitCount, 1)) * BlockBitCount, false),
+	m_hash(hash),
+	m_hashCount(hashCount)
+	{
+		assert(hashCount > 0);
+		m_blockMask = m_bits.GetSize() / BlockBitCount - 1;
+	}
+
+	/*!
+	* \brief Removes every key from the filter
+	*/
+	template<typename Key, typename Hash>
+	void BlockedBloomFilter<Key, Hash>::Clear()
+	{
+		m_bits.Reset();
+	}
+
+	/*!
+	* \brief Returns the number of bits of the filter
+	*/
+	template<typename Key, typename Hash>
+	std::size_t BlockedBloomFilter<Key, Hash>::GetBitCount() const
+	{
+		return m_bits.GetSize();
+	}
+
+	/*!
+	* \brief Returns the number of bits set by each key
+	*/
+	template<typename Key, typename Hash>
+	std::size_t BlockedBloomFilter<Key, Hash>::GetHashCount() const
+	{
+		return m_hashCount;
+	}
+
+	/*!
+	* \brief Inserts a key in the filter
+	*
+	* \param key Key to insert
+	*/
+	template<typename Key, typename Hash>
+	void BlockedBloomFilter<Key, Hash>::Insert(const Key& key)
+	{
+		ForEachProbe(key, [&](std::size_t wordIndex, UInt64 bitMask)
+		{
+			m_bits.SetBlock(wordIndex, m_bits.GetBlock(wordIndex) | bitMask);
+			return true;
+		});
+	}
+
+	/*!
+	* \brief Checks if a key may have been inserted
+	* \return False if the key was never inserted, true if it was inserted or in case of a false positive
+	*
+	* \param key Key to check
+	*/
+	template<typename Key, typename Hash>
+	bool BlockedBloomFilter<Key, Hash>::MayContain(const Key& key) const
+	{
+		return ForEachProbe(key, [&](std::size_t wordIndex, UInt64 bitMask)
+		{
+			return (m_bits.GetBlock(wordIndex) & bitMask) != 0;
+		});
+	}
+
+	/*!
+	* \brief Adds every key of another filter to this one (bitwise OR), to combine filters built separately (for example, by multiple threads)
+	*
+	* \param filter Filter to merge, must have the same bit count, hash count and hasher than this one
+	*/
+	template<typename Key, typename Hash>
+	void BlockedBloomFilter<Key, Hash>::Merge(const BlockedBloomFilter& filter)
+	{
+		assert(filter.m_bits.GetSize() == m_bits.GetSize() && filter.m_hashCount == m_hashCount);
+		m_bits |= filter.m_bits;
+	}
+
+	template<typename Key, typename Hash>
+	template<typename F>
+	bool BlockedBloomFilter<Key, Hash>::ForEachProbe(const Key& key, F&& func) const
+	{
+		constexpr std::size_t BitsPerWord = BitCount<UInt64>();
+
+		UInt64 hash = Detail::WyMix(static_cast<UInt64>(m_hash(key)), 0x9E3779B97F4A7C15ull);
+
+		// The upper half selects the block, the lower half the bits in the block (using double hashing)
+		std::size_t firstWord = (static_cast<std::size_t>(hash >> 32) & m_blockMask) * WordsPerBlock;
+		UInt32 h1 = static_cast<UInt32>(hash);
+		UInt32 h2 = (h1 >> 16) | 1;
+
+		for (std::size_t i = 0; i < m_hashCount; ++i)
+		{
+			std::size_t bit = h1 % BlockBitCount;
+			if (!func(firstWord + bit / BitsPerWord, UInt64(1) << (bit % BitsPerWord)))
+				return false;
+
+			h1 += h2;
+		}
+
+		return true;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of bits a Bloom filter needs to keep a false positive rate
+	* \return Optimal bit count (-n * ln(p) / ln(2)^2)
+	*
+	* \param expectedCount Number of keys expected to be inserted
+	* \param falsePositiveRate Wanted false positive rate once every key is inserted, between 0 and 1 (exclusive)
+	*
+	* \see ComputeBloomFilterHashCount
+	*/
+	std::size_t ComputeBloomFilterBitCount(std::size_t expectedCount, double falsePositiveRate)
+	{
+		assert(falsePositiveRate > 0.0 && falsePositiveRate < 1.0);
+
+		constexpr double Ln2 = 0.69314718055994530942;
+		double bitCount = -static_cast<double>(std::max<std::size_t>(expectedCount, 1)) * std::log(falsePositiveRate) / (Ln2 * Ln2);
+
+		return std::max<std::size_t>(static_cast<std::size_t>(std::ceil(bitCount)), 1);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of bits each key should set to minimize the false positive rate of a Bloom filter
+	* \return Optimal hash count (m / n * ln(2)), at least one
+	*
+	* \param bitCount Number of bits of the filter
+	* \param expectedCount Number of keys expected to be inserted
+	*
+	* \see ComputeBloomFilterBitCount
+	*/
+	std::size_t ComputeBloomFilterHashCount(std::size_t bitCount, std::size_t expectedCount)
+	{
+		constexpr double Ln2 = 0.69314718055994530942;
+		double hashCount = static_cast<double>(bitCount) / static_cast<double>(std::max<std::size_t>(expectedCount, 1)) * Ln2;
+
+		return std::max<std::size_t>(static_cast<std::size_t>(std::round(hashCount)), 1);
+	}
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_BYTESTREAM_HPP
+#define NAZARAUTILS_BYTESTREAM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <NazaraUtils/Result.hpp>
+#include <cstddef>
+#include <string_view>
+
+namespace Nz
+{
+	enum class ByteStreamError
+	{
+		EndOfBuffer,    //< not enough bytes left in the buffer
+		InvalidData,    //< decoded data is inconsistent (e.g. a corrupted delta)
+		VarIntOverflow  //< encoded variable-length integer doesn't fit in the requested type
+	};
+
+	template<typename T> using ByteStreamResult = Result<T, ByteStreamError>;
+
+	// Reads binary data from a non-owning byte buffer
+	class ByteReader
+	{
+		public:
+			inline ByteReader(const void* data, std::size_t size, Endianness endianness = Endianness::LittleEndian);
+			ByteReader(const ByteReader&) = default;
+			~ByteReader() = default;
+
+			inline std::size_t GetCursor() const;
+			inline const UInt8* GetData() const;
+			inline Endianness GetEndianness() const;
+			inline std::size_t GetRemainingSize() const;
+			inline std::size_t GetSize() const;
+
+			inline bool IsAtEnd() const;
+
+			template<typename T> ByteStreamResult<T> Read();
+			template<typename T> ByteStreamResult<void> ReadArray(T* values, std::size_t count);
+			inline ByteStreamResult<const UInt8*> ReadBytes(std::size_t size);
+			inline ByteStreamResult<std::string_view> ReadString();
+			inline ByteStreamResult<std::string_view> ReadString(std::size_t length);
+			template<typename T = UInt64> ByteStreamResult<T> ReadVarInt();
+
+			inline ByteStreamResult<void> Skip(std::size_t size);
+
+			inline void SetCursor(std::size_t cursor);
+
+			ByteReader& operator=(const ByteReader&) = default;
+
+		private:
+			const UInt8* m_data;
+			std::size_t m_cursor;
+			std::size_t m_size;
+			Endianness m_endianness;
+	};
+
+	// Writes binary data to a non-owning byte buffer
+	class ByteWriter
+	{
+		public:
+			inline ByteWriter(void* data, std::size_t size, Endianness endianness = Endianness::LittleEndian);
+			ByteWriter(const ByteWriter&) = default;
+			~ByteWriter() = default;
+
+			inline std::size_t GetCursor() const;
+			inline UInt8* GetData() const;
+			inline Endianness GetEndianness() const;
+			inline std::size_t GetRemainingSize() const;
+			inline std::size_t GetSize() const;
+
+			inline void SetCursor(std::size_t cursor);
+
+			inline ByteStreamResult<UInt8*> Skip(std::size_t size);
+
+			template<typename T> ByteStreamResult<void> Write(T value);
+			template<typename T> ByteStreamResult<void> WriteArray(const T* values, std::size_t count);
+			inline ByteStreamResult<void> WriteBytes(const void* data, std::size_t size);
+			inline ByteStreamResult<void> WriteString(std::string_view str);
+			template<typename T> ByteStreamResult<void> WriteVarInt(T value);
+
+			ByteWriter& operator=(const ByteWriter&) = default;
+
+		private:
+			UInt8* m_data;
+			std::size_t m_cursor;
+			std::size_t m_size;
+			Endianness m_endianness;
+	};
+}
+
+#include <NazaraUtils/ByteStream.inl>
+
+#endif // NAZARAUTILS_BYTESTREAM_HPP
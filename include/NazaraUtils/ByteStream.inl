@@ -0,0 +1,482 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T>
+		constexpr void CheckByteStreamType()
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be read/written");
+		}
+
+		// Variable-length integers are encoded using (unsigned) LEB128, signed integers are zigzag-encoded first
+		template<typename T, typename = void>
+		struct VarIntBase
+		{
+			using Type = T;
+		};
+
+		template<typename T>
+		struct VarIntBase<T, std::enable_if_t<std::is_enum_v<T>>>
+		{
+			using Type = std::underlying_type_t<T>;
+		};
+
+		template<typename T>
+		using VarIntType = std::make_unsigned_t<typename VarIntBase<T>::Type>;
+
+		template<typename T>
+		constexpr bool IsSignedVarInt = std::is_signed_v<typename VarIntBase<T>::Type>;
+
+		template<typename T>
+		constexpr std::size_t MaxVarIntSize = (BitCount<T>() + 6) / 7;
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ByteReader
+	* \brief Reads binary data from a non-owning byte buffer, with endianness conversion and bounds checking
+	*
+	* Reading past the end of the buffer fails with ByteStreamError::EndOfBuffer and doesn't move the cursor.
+	* Strings and bytes are returned as views into the buffer (which must outlive them), nothing is ever allocated.
+	*/
+
+	/*!
+	* \brief Constructs a reader over a buffer
+	*
+	* \param data Pointer to the buffer
+	* \param size Size of the buffer in bytes
+	* \param endianness Endianness of the data stored in the buffer
+	*/
+	inline ByteReader::ByteReader(const void* data, std::size_t size, Endianness endianness) :
+	m_data(static_cast<const UInt8*>(data)),
+	m_cursor(0),
+	m_size(size),
+	m_endianness(endianness)
+	{
+		assert(data || size == 0);
+	}
+
+	inline std::size_t ByteReader::GetCursor() const
+	{
+		return m_cursor;
+	}
+
+	inline const UInt8* ByteReader::GetData() const
+	{
+		return m_data;
+	}
+
+	inline Endianness ByteReader::GetEndianness() const
+	{
+		return m_endianness;
+	}
+
+	inline std::size_t ByteReader::GetRemainingSize() const
+	{
+		return m_size - m_cursor;
+	}
+
+	inline std::size_t ByteReader::GetSize() const
+	{
+		return m_size;
+	}
+
+	inline bool ByteReader::IsAtEnd() const
+	{
+		return m_cursor == m_size;
+	}
+
+	/*!
+	* \brief Reads a value, converting it from the reader endianness
+	* \return The value or ByteStreamError::EndOfBuffer
+	*/
+	template<typename T>
+	ByteStreamResult<T> ByteReader::Read()
+	{
+		Detail::CheckByteStreamType<T>();
+
+		if NAZARA_UNLIKELY(GetRemainingSize() < sizeof(T))
+			return Err(ByteStreamError::EndOfBuffer);
+
+		T value;
+		std::memcpy(&value, &m_data[m_cursor], sizeof(T));
+		m_cursor += sizeof(T);
+
+		if (m_endianness != PlatformEndianness)
+			value = ByteSwap(value);
+
+		return value;
+	}
+
+	/*!
+	* \brief Reads multiple values at once, converting them from the reader endianness
+	* \return Nothing or ByteStreamError::EndOfBuffer (in which case nothing is read)
+	*
+	* \param values Pointer to the memory which will receive the values
+	* \param count Number of values to read
+	*
+	* \remark Values are copied in bulk, and byte swapped using ByteSwapArray if necessary
+	*/
+	template<typename T>
+	ByteStreamResult<void> ByteReader::ReadArray(T* values, std::size_t count)
+	{
+		Detail::CheckByteStreamType<T>();
+
+		if NAZARA_UNLIKELY(GetRemainingSize() / sizeof(T) < count)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (count > 0)
+		{
+			std::memcpy(values, &m_data[m_cursor], count * sizeof(T));
+			m_cursor += count * sizeof(T);
+
+			if (m_endianness != PlatformEndianness)
+				ByteSwapArray(values, count);
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \brief Reads raw bytes
+	* \return Pointer to the bytes in the buffer or ByteStreamError::EndOfBuffer
+	*
+	* \param size Number of bytes to read
+	*/
+	inline ByteStreamResult<const UInt8*> ByteReader::ReadBytes(std::size_t size)
+	{
+		if NAZARA_UNLIKELY(GetRemainingSize() < size)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		const UInt8* ptr = &m_data[m_cursor];
+		m_cursor += size;
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Reads a string prefixed by its length (as a variable-length integer)
+	* \return View of the string in the buffer, or an error
+	*
+	* \see ByteWriter::WriteString
+	*/
+	inline ByteStreamResult<std::string_view> ByteReader::ReadString()
+	{
+		std::size_t cursor = m_cursor;
+
+		ByteStreamResult<UInt64> length = ReadVarInt<UInt64>();
+		if NAZARA_UNLIKELY(!length)
+			return Err(length.GetError());
+
+		if NAZARA_UNLIKELY(length.GetValue() > GetRemainingSize())
+		{
+			m_cursor = cursor;
+			return Err(ByteStreamError::EndOfBuffer);
+		}
+
+		return ReadString(static_cast<std::size_t>(length.GetValue()));
+	}
+
+	/*!
+	* \brief Reads a string of a known length
+	* \return View of the string in the buffer or ByteStreamError::EndOfBuffer
+	*
+	* \param length Length of the string in bytes
+	*/
+	inline ByteStreamResult<std::string_view> ByteReader::ReadString(std::size_t length)
+	{
+		if NAZARA_UNLIKELY(GetRemainingSize() < length)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		std::string_view str(reinterpret_cast<const char*>(&m_data[m_cursor]), length);
+		m_cursor += length;
+
+		return str;
+	}
+
+	/*!
+	* \brief Reads a variable-length integer (LEB128, zigzag-encoded for signed types)
+	* \return The integer, ByteStreamError::EndOfBuffer or ByteStreamError::VarIntOverflow if it doesn't fit in T
+	*
+	* \see ByteWriter::WriteVarInt
+	*/
+	template<typename T>
+	ByteStreamResult<T> ByteReader::ReadVarInt()
+	{
+		static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "T must be an integral type");
+		using UInt = Detail::VarIntType<T>;
+
+		constexpr std::size_t bitCount = BitCount<UInt>();
+		constexpr std::size_t maxSize = Detail::MaxVarIntSize<UInt>;
+
+		UInt value = 0;
+		std::size_t offset = 0;
+		for (;;)
+		{
+			if NAZARA_UNLIKELY(m_cursor + offset >= m_size)
+				return Err(ByteStreamError::EndOfBuffer);
+
+			UInt8 byte = m_data[m_cursor + offset];
+			std::size_t shift = offset * 7;
+			offset++;
+
+			if NAZARA_UNLIKELY(offset == maxSize && (byte >> (bitCount - shift)) != 0)
+				return Err(ByteStreamError::VarIntOverflow); //< last byte has more bits than the type can hold (or a continuation bit)
+
+			value |= static_cast<UInt>(static_cast<UInt>(byte & 0x7F) << shift);
+			if ((byte & 0x80) == 0)
+				break;
+		}
+
+		m_cursor += offset;
+
+		if constexpr (Detail::IsSignedVarInt<T>)
+			return static_cast<T>(static_cast<std::make_signed_t<UInt>>((value >> 1) ^ (~(value & 1) + 1)));
+		else
+			return static_cast<T>(value);
+	}
+
+	/*!
+	* \brief Moves the cursor forward without reading
+	* \return Nothing or ByteStreamError::EndOfBuffer
+	*
+	* \param size Number of bytes to skip
+	*/
+	inline ByteStreamResult<void> ByteReader::Skip(std::size_t size)
+	{
+		if NAZARA_UNLIKELY(GetRemainingSize() < size)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		m_cursor += size;
+		return Ok();
+	}
+
+	inline void ByteReader::SetCursor(std::size_t cursor)
+	{
+		assert(cursor <= m_size);
+		m_cursor = cursor;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ByteWriter
+	* \brief Writes binary data to a non-owning byte buffer, with endianness conversion and bounds checking
+	*
+	* Writing past the end of the buffer fails with ByteStreamError::EndOfBuffer and doesn't move the cursor (nor write anything).
+	*/
+
+	/*!
+	* \brief Constructs a writer over a buffer
+	*
+	* \param data Pointer to the buffer
+	* \param size Size of the buffer in bytes
+	* \param endianness Endianness of the data written in the buffer
+	*/
+	inline ByteWriter::ByteWriter(void* data, std::size_t size, Endianness endianness) :
+	m_data(static_cast<UInt8*>(data)),
+	m_cursor(0),
+	m_size(size),
+	m_endianness(endianness)
+	{
+		assert(data || size == 0);
+	}
+
+	inline std::size_t ByteWriter::GetCursor() const
+	{
+		return m_cursor;
+	}
+
+	inline UInt8* ByteWriter::GetData() const
+	{
+		return m_data;
+	}
+
+	inline Endianness ByteWriter::GetEndianness() const
+	{
+		return m_endianness;
+	}
+
+	inline std::size_t ByteWriter::GetRemainingSize() const
+	{
+		return m_size - m_cursor;
+	}
+
+	inline std::size_t ByteWriter::GetSize() const
+	{
+		return m_size;
+	}
+
+	inline void ByteWriter::SetCursor(std::size_t cursor)
+	{
+		assert(cursor <= m_size);
+		m_cursor = cursor;
+	}
+
+	/*!
+	* \brief Reserves bytes to be written later (for example a size known only once the rest of the packet is written)
+	* \return Pointer to the reserved bytes, or ByteStreamError::EndOfBuffer
+	*
+	* \param size Number of bytes to reserve
+	*/
+	inline ByteStreamResult<UInt8*> ByteWriter::Skip(std::size_t size)
+	{
+		if NAZARA_UNLIKELY(GetRemainingSize() < size)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		UInt8* ptr = &m_data[m_cursor];
+		m_cursor += size;
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Writes a value, converting it to the writer endianness
+	* \return Nothing or ByteStreamError::EndOfBuffer
+	*/
+	template<typename T>
+	ByteStreamResult<void> ByteWriter::Write(T value)
+	{
+		Detail::CheckByteStreamType<T>();
+
+		if NAZARA_UNLIKELY(GetRemainingSize() < sizeof(T))
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (m_endianness != PlatformEndianness)
+			value = ByteSwap(value);
+
+		std::memcpy(&m_data[m_cursor], &value, sizeof(T));
+		m_cursor += sizeof(T);
+
+		return Ok();
+	}
+
+	/*!
+	* \brief Writes multiple values at once, converting them to the writer endianness
+	* \return Nothing or ByteStreamError::EndOfBuffer (in which case nothing is written)
+	*
+	* \param values Pointer to the values
+	* \param count Number of values to write
+	*
+	* \remark Values are copied in bulk, or byte swapped using ByteSwapArray if necessary
+	*/
+	template<typename T>
+	ByteStreamResult<void> ByteWriter::WriteArray(const T* values, std::size_t count)
+	{
+		Detail::CheckByteStreamType<T>();
+
+		if NAZARA_UNLIKELY(GetRemainingSize() / sizeof(T) < count)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (count > 0)
+		{
+			UInt8* dst = &m_data[m_cursor];
+			if (sizeof(T) > 1 && m_endianness != PlatformEndianness)
+			{
+				if constexpr (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+					Detail::ByteSwapArray<sizeof(T)>(reinterpret_cast<const UInt8*>(values), dst, count);
+				else
+				{
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						T value = ByteSwap(values[i]);
+						std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+					}
+				}
+			}
+			else
+				std::memcpy(dst, values, count * sizeof(T));
+
+			m_cursor += count * sizeof(T);
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \brief Writes raw bytes
+	* \return Nothing or ByteStreamError::EndOfBuffer
+	*
+	* \param data Pointer to the bytes
+	* \param size Number of bytes to write
+	*/
+	inline ByteStreamResult<void> ByteWriter::WriteBytes(const void* data, std::size_t size)
+	{
+		if NAZARA_UNLIKELY(GetRemainingSize() < size)
+			return Err(ByteStreamError::EndOfBuffer);
+
+		if (size > 0)
+		{
+			std::memcpy(&m_data[m_cursor], data, size);
+			m_cursor += size;
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \brief Writes a string prefixed by its length (as a variable-length integer)
+	* \return Nothing or ByteStreamError::EndOfBuffer (in which case nothing is written)
+	*
+	* \see ByteReader::ReadString
+	*/
+	inline ByteStreamResult<void> ByteWriter::WriteString(std::string_view str)
+	{
+		std::size_t cursor = m_cursor;
+		NAZARA_TRY(WriteVarInt(UInt64(str.size())));
+
+		ByteStreamResult<void> result = WriteBytes(str.data(), str.size());
+		if NAZARA_UNLIKELY(!result)
+			m_cursor = cursor;
+
+		return result;
+	}
+
+	/*!
+	* \brief Writes a variable-length integer (LEB128, zigzag-encoded for signed types)
+	* \return Nothing or ByteStreamError::EndOfBuffer (in which case nothing is written)
+	*
+	* \see ByteReader::ReadVarInt
+	*/
+	template<typename T>
+	ByteStreamResult<void> ByteWriter::WriteVarInt(T value)
+	{
+		static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "T must be an integral type");
+		using UInt = Detail::VarIntType<T>;
+
+		UInt encoded;
+		if constexpr (Detail::IsSignedVarInt<T>)
+		{
+			using Int = std::make_signed_t<UInt>;
+			Int signedValue = static_cast<Int>(value);
+			encoded = static_cast<UInt>(static_cast<UInt>(signedValue) << 1) ^ static_cast<UInt>(signedValue >> (BitCount<UInt>() - 1));
+		}
+		else
+			encoded = static_cast<UInt>(value);
+
+		UInt8 bytes[Detail::MaxVarIntSize<UInt>];
+		std::size_t size = 0;
+		do
+		{
+			UInt8 byte = static_cast<UInt8>(encoded & 0x7F);
+			encoded >>= 7;
+			if (encoded != 0)
+				byte |= 0x80;
+
+			bytes[size++] = byte;
+		}
+		while (encoded != 0);
+
+		return WriteBytes(bytes, size);
+	}
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CACHEALIGNED_HPP
+#define NAZARAUTILS_CACHEALIGNED_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace Nz
+{
+NAZARA_WARNING_PUSH()
+NAZARA_WARNING_MSVC_DISABLE(4324) // structure was padded due to alignment specifier
+
+	template<typename T>
+	class alignas(CacheLineSize) CacheAligned
+	{
+		public:
+			constexpr CacheAligned();
+			constexpr CacheAligned(const T& value);
+			constexpr CacheAligned(T&& value);
+			template<typename... Args> constexpr explicit CacheAligned(std::in_place_t, Args&&... args);
+			constexpr CacheAligned(const CacheAligned&) = default;
+			constexpr CacheAligned(CacheAligned&&) = default;
+			~CacheAligned() = default;
+
+			constexpr T& Get() & noexcept;
+			constexpr const T& Get() const & noexcept;
+
+			constexpr T& operator*() & noexcept;
+			constexpr const T& operator*() const & noexcept;
+			constexpr T* operator->() noexcept;
+			constexpr const T* operator->() const noexcept;
+
+			constexpr CacheAligned& operator=(const CacheAligned&) = default;
+			constexpr CacheAligned& operator=(CacheAligned&&) = default;
+
+		private:
+			T m_value;
+	};
+
+NAZARA_WARNING_POP()
+
+	constexpr std::size_t AlignToCacheLine(std::size_t size);
+	constexpr std::size_t GetCacheLinePadding(std::size_t size);
+}
+
+#include <NazaraUtils/CacheAligned.inl>
+
+#endif // NAZARAUTILS_CACHEALIGNED_HPP
@@ -0,0 +1,103 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::CacheAligned
+	* \brief Wraps a value so it starts on its own cache line and nothing else shares its last cache line
+	*
+	* Useful for data written by a thread next to data written by other threads (per-thread counters, queue indices, lock shards, ...),
+	* which would otherwise suffer from false sharing. The wrapper is aligned and sized to a multiple of CacheLineSize (see NAZARA_CACHELINE_SIZE).
+	*
+	* \see PerThreadArray
+	*/
+
+	/*!
+	* \brief Value-initializes the wrapped object
+	*/
+	template<typename T>
+	constexpr CacheAligned<T>::CacheAligned() :
+	m_value()
+	{
+	}
+
+	template<typename T>
+	constexpr CacheAligned<T>::CacheAligned(const T& value) :
+	m_value(value)
+	{
+	}
+
+	template<typename T>
+	constexpr CacheAligned<T>::CacheAligned(T&& value) :
+	m_value(std::move(value))
+	{
+	}
+
+	template<typename T>
+	template<typename... Args>
+	constexpr CacheAligned<T>::CacheAligned(std::in_place_t, Args&&... args) :
+	m_value(std::forward<Args>(args)...)
+	{
+	}
+
+	template<typename T>
+	constexpr T& CacheAligned<T>::Get() & noexcept
+	{
+		return m_value;
+	}
+
+	template<typename T>
+	constexpr const T& CacheAligned<T>::Get() const & noexcept
+	{
+		return m_value;
+	}
+
+	template<typename T>
+	constexpr T& CacheAligned<T>::operator*() & noexcept
+	{
+		return m_value;
+	}
+
+	template<typename T>
+	constexpr const T& CacheAligned<T>::operator*() const & noexcept
+	{
+		return m_value;
+	}
+
+	template<typename T>
+	constexpr T* CacheAligned<T>::operator->() noexcept
+	{
+		return &m_value;
+	}
+
+	template<typename T>
+	constexpr const T* CacheAligned<T>::operator->() const noexcept
+	{
+		return &m_value;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Rounds a size up to a multiple of the cache line size
+	* \return Smallest multiple of CacheLineSize greater or equal to size
+	*/
+	constexpr std::size_t AlignToCacheLine(std::size_t size)
+	{
+		return (size + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes how many padding bytes are required after an object to fill its last cache line
+	* \return Number of bytes between size and the next multiple of CacheLineSize
+	*
+	* \param size Size of the data to pad (for example sizeof of the members preceding the padding)
+	*/
+	constexpr std::size_t GetCacheLinePadding(std::size_t size)
+	{
+		return AlignToCacheLine(size) - size;
+	}
+}
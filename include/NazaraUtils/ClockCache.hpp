@@ -0,0 +1,80 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CLOCKCACHE_HPP
+#define NAZARAUTILS_CLOCKCACHE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace Nz
+{
+	template<typename K, typename V, typename Hash = FastHash<K>, typename KeyEqual = std::equal_to<>>
+	class ClockCache
+	{
+		public:
+			using hasher = Hash;
+			using key_type = K;
+			using mapped_type = V;
+
+			explicit ClockCache(std::size_t capacity, std::size_t poolBlockSize = 64);
+			ClockCache(const ClockCache&) = delete;
+			ClockCache(ClockCache&&) noexcept = default;
+			~ClockCache() = default;
+
+			void Clear();
+			bool Contains(const K& key) const;
+
+			bool Erase(const K& key);
+
+			V* Get(const K& key);
+			std::size_t GetCapacity() const;
+			std::size_t GetCost() const;
+			std::size_t GetSize() const;
+
+			const V* Peek(const K& key) const;
+			V& Put(const K& key, V value, std::size_t cost = 1);
+
+			void SetCapacity(std::size_t capacity);
+
+			ClockCache& operator=(const ClockCache&) = delete;
+			ClockCache& operator=(ClockCache&&) noexcept = default;
+
+		private:
+			struct Node
+			{
+				Node(const K& k, V&& v, std::size_t c);
+
+				K key;
+				V value;
+				std::size_t cost;
+				std::size_t previous;
+				std::size_t next;
+			};
+
+			void EvictOverflow(std::size_t protectedIndex);
+			void LinkBeforeHand(std::size_t index);
+			void Remove(std::size_t index);
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+			FlatHashMap<K, std::size_t, Hash, KeyEqual> m_entries;
+			Bitset<UInt64> m_referencedNodes;
+			MemoryPool<Node> m_nodes;
+			std::size_t m_capacity;
+			std::size_t m_cost;
+			std::size_t m_hand; //< Next eviction candidate of the node ring
+	};
+}
+
+#include <NazaraUtils/ClockCache.inl>
+
+#endif // NAZARAUTILS_CLOCKCACHE_HPP
@@ -0,0 +1,264 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ClockCache
+	* \brief Key-value cache evicting entries using the CLOCK algorithm (an approximation of LRU) once its capacity is exceeded
+	*
+	* Entries live in a MemoryPool and are linked by index in a ring, in insertion order. A hit only sets the "referenced" bit of the entry in a Bitset,
+	* which is cheaper than LruCache moving the entry to the front of its list.
+	* To evict an entry, the clock hand walks the ring: referenced entries get a second chance (their bit is cleared), the first unreferenced entry is evicted.
+	*
+	* The capacity is a total cost, each entry having a cost given when it is inserted (one by default, making the capacity an entry count,
+	* but it can be a size in bytes for example).
+	*
+	* \remark The entry being inserted is never evicted, even if its cost alone exceeds the capacity
+	* \remark Pointers and references to values stay valid until their entry is evicted or erased
+	* \see LruCache, ShardedCache
+	*/
+
+	/*!
+	* \brief Constructs an empty cache
+	*
+	* \param capacity Maximum total cost of the entries
+	* \param poolBlockSize Number of entries allocated at once by the memory pool
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	ClockCache<K, V, Hash, KeyEqual>::ClockCache(std::size_t capacity, std::size_t poolBlockSize) :
+	m_nodes(poolBlockSize),
+	m_capacity(capacity),
+	m_cost(0),
+	m_hand(InvalidIndex)
+	{
+	}
+
+	/*!
+	* \brief Removes every entry from the cache, keeping its memory
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void ClockCache<K, V, Hash, KeyEqual>::Clear()
+	{
+		m_entries.clear();
+		m_nodes.Reset();
+		m_referencedNodes.Reset();
+		m_cost = 0;
+		m_hand = InvalidIndex;
+	}
+
+	/*!
+	* \brief Checks if the cache has an entry for a key, without marking it as referenced
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	bool ClockCache<K, V, Hash, KeyEqual>::Contains(const K& key) const
+	{
+		return m_entries.find(key) != m_entries.end();
+	}
+
+	/*!
+	* \brief Removes the entry of a key
+	* \return True if the key had an entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	bool ClockCache<K, V, Hash, KeyEqual>::Erase(const K& key)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return false;
+
+		Remove(it->second);
+		return true;
+	}
+
+	/*!
+	* \brief Gets the value of a key and marks it as referenced
+	* \return Pointer to the value, or nullptr if the key has no entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	V* ClockCache<K, V, Hash, KeyEqual>::Get(const K& key)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return nullptr;
+
+		m_referencedNodes.Set(it->second);
+		return &m_nodes.RetrieveFromIndex(it->second)->value;
+	}
+
+	/*!
+	* \brief Returns the maximum total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t ClockCache<K, V, Hash, KeyEqual>::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	/*!
+	* \brief Returns the total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t ClockCache<K, V, Hash, KeyEqual>::GetCost() const
+	{
+		return m_cost;
+	}
+
+	/*!
+	* \brief Returns the number of entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t ClockCache<K, V, Hash, KeyEqual>::GetSize() const
+	{
+		return m_entries.size();
+	}
+
+	/*!
+	* \brief Gets the value of a key without marking it as referenced
+	* \return Pointer to the value, or nullptr if the key has no entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	const V* ClockCache<K, V, Hash, KeyEqual>::Peek(const K& key) const
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return nullptr;
+
+		return &m_nodes.RetrieveFromIndex(it->second)->value;
+	}
+
+	/*!
+	* \brief Inserts or replaces the entry of a key, then evicts entries until the capacity is respected
+	* \return Reference to the value stored in the cache
+	*
+	* A new entry is not referenced and is placed right behind the clock hand (it will be the last one considered for eviction),
+	* replacing the value of an existing entry marks it as referenced.
+	*
+	* \param key Key of the entry
+	* \param value Value of the entry
+	* \param cost Cost of the entry, counted against the capacity
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	V& ClockCache<K, V, Hash, KeyEqual>::Put(const K& key, V value, std::size_t cost)
+	{
+		std::size_t index;
+		Node* node;
+
+		auto it = m_entries.find(key);
+		if (it != m_entries.end())
+		{
+			index = it->second;
+			node = m_nodes.RetrieveFromIndex(index);
+			node->value = std::move(value);
+
+			m_cost -= node->cost;
+			node->cost = cost;
+
+			m_referencedNodes.Set(index);
+		}
+		else
+		{
+			node = m_nodes.Allocate(index, key, std::move(value), cost);
+			m_entries.try_emplace(key, index);
+
+			// Keep the bitset as large as the pool, so that hits never allocate
+			std::size_t poolCapacity = m_nodes.GetBlockCount() * m_nodes.GetBlockSize();
+			if (m_referencedNodes.GetSize() < poolCapacity)
+				m_referencedNodes.Resize(poolCapacity);
+
+			m_referencedNodes.Reset(index);
+			LinkBeforeHand(index);
+		}
+
+		m_cost += cost;
+		EvictOverflow(index);
+
+		return node->value;
+	}
+
+	/*!
+	* \brief Changes the capacity of the cache, evicting entries exceeding it
+	*
+	* \param capacity Maximum total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void ClockCache<K, V, Hash, KeyEqual>::SetCapacity(std::size_t capacity)
+	{
+		m_capacity = capacity;
+		EvictOverflow(InvalidIndex);
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void ClockCache<K, V, Hash, KeyEqual>::EvictOverflow(std::size_t protectedIndex)
+	{
+		// Every entry is visited at most twice (once to clear its referenced bit), which bounds the loop
+		while (m_cost > m_capacity && m_entries.size() > 1)
+		{
+			std::size_t index = m_hand;
+			m_hand = m_nodes.RetrieveFromIndex(index)->next;
+
+			if (index == protectedIndex)
+				continue;
+
+			if (m_referencedNodes.Test(index))
+			{
+				m_referencedNodes.Reset(index);
+				continue;
+			}
+
+			Remove(index);
+		}
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void ClockCache<K, V, Hash, KeyEqual>::LinkBeforeHand(std::size_t index)
+	{
+		Node* node = m_nodes.RetrieveFromIndex(index);
+		if (m_hand == InvalidIndex)
+		{
+			node->previous = index;
+			node->next = index;
+			m_hand = index;
+			return;
+		}
+
+		Node* handNode = m_nodes.RetrieveFromIndex(m_hand);
+		node->previous = handNode->previous;
+		node->next = m_hand;
+
+		m_nodes.RetrieveFromIndex(handNode->previous)->next = index;
+		handNode->previous = index;
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void ClockCache<K, V, Hash, KeyEqual>::Remove(std::size_t index)
+	{
+		Node* node = m_nodes.RetrieveFromIndex(index);
+		if (node->next == index)
+			m_hand = InvalidIndex; //< last node of the ring
+		else
+		{
+			m_nodes.RetrieveFromIndex(node->previous)->next = node->next;
+			m_nodes.RetrieveFromIndex(node->next)->previous = node->previous;
+
+			if (m_hand == index)
+				m_hand = node->next;
+		}
+
+		m_cost -= node->cost;
+		m_entries.erase(node->key);
+		m_nodes.Free(index);
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	ClockCache<K, V, Hash, KeyEqual>::Node::Node(const K& k, V&& v, std::size_t c) :
+	key(k),
+	value(std::move(v)),
+	cost(c)
+	{
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CONCURRENTMEMORYPOOL_HPP
+#define NAZARAUTILS_CONCURRENTMEMORYPOOL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/CacheAligned.hpp>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace Nz
+{
+	template<typename T, std::size_t Alignment = alignof(T)>
+	class ConcurrentMemoryPool
+	{
+		public:
+			class Cache;
+			class DeferConstruct_t {};
+			class NoDestruction_t {};
+
+			ConcurrentMemoryPool(std::size_t blockSize, std::size_t maxBlockCount = 1024);
+			ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool(ConcurrentMemoryPool&&) = delete;
+			~ConcurrentMemoryPool();
+
+			T* Allocate(DeferConstruct_t, std::size_t& index);
+			template<typename... Args> T* Allocate(std::size_t& index, Args&&... args);
+
+			void Free(std::size_t index);
+			void Free(std::size_t index, NoDestruction_t);
+
+			std::size_t GetAllocatedEntryCount() const;
+			std::size_t GetBlockCount() const;
+			std::size_t GetBlockSize() const;
+			std::size_t GetMaxBlockCount() const;
+
+			T* RetrieveFromIndex(std::size_t index);
+			const T* RetrieveFromIndex(std::size_t index) const;
+
+			ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool& operator=(ConcurrentMemoryPool&&) = delete;
+
+			static constexpr DeferConstruct_t DeferConstruct = {};
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+			static constexpr NoDestruction_t NoDestruction = {};
+
+		private:
+			static constexpr std::size_t EntryAlignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+
+			// Aligned operator new[] (used by std::make_unique) honors the over-alignment of this type
+			struct alignas(EntryAlignment) AlignedStorage
+			{
+				std::byte data[sizeof(T)];
+			};
+
+			std::size_t AllocateEntries(UInt32* indices, std::size_t count);
+			UInt32 AllocateBlock();
+			T* GetEntryPointer(UInt32 index) const;
+			std::atomic<UInt32>& GetNextFreeEntry(UInt32 index) const;
+			void MarkAllocated(UInt32 index);
+			void MarkFreed(UInt32 index);
+			std::size_t PopFreeEntries(UInt32* indices, std::size_t count);
+			void PushFreeEntries(const UInt32* indices, std::size_t count);
+			void PushFreeList(UInt32 firstIndex, UInt32 lastIndex);
+
+			struct Block
+			{
+				std::unique_ptr<AlignedStorage[]> memory;
+				std::unique_ptr<std::atomic<UInt32>[]> nextFreeEntries; //< Free list links (entry index + 1, 0 for none)
+				std::unique_ptr<std::atomic<UInt64>[]> occupiedEntries;
+			};
+
+			CacheAligned<std::atomic<UInt64>> m_freeListHead; //< Low 32 bits: entry index + 1 (0 if empty), high 32 bits: ABA tag, alone on its cache line as every allocation and free CAS it
+			std::atomic<std::size_t> m_blockCount;
+			std::mutex m_blockMutex;
+			std::size_t m_blockSize;
+			std::size_t m_maxBlockCount;
+			std::unique_ptr<Block[]> m_blocks;
+	};
+
+	template<typename T, std::size_t Alignment>
+	class ConcurrentMemoryPool<T, Alignment>::Cache
+	{
+		public:
+			Cache(ConcurrentMemoryPool& pool, std::size_t capacity = 64);
+			Cache(const Cache&) = delete;
+			Cache(Cache&&) = delete;
+			~Cache();
+
+			T* Allocate(DeferConstruct_t, std::size_t& index);
+			template<typename... Args> T* Allocate(std::size_t& index, Args&&... args);
+
+			void Flush();
+
+			void Free(std::size_t index);
+			void Free(std::size_t index, NoDestruction_t);
+
+			std::size_t GetCachedEntryCount() const;
+
+			Cache& operator=(const Cache&) = delete;
+			Cache& operator=(Cache&&) = delete;
+
+		private:
+			void Release(UInt32 index);
+
+			ConcurrentMemoryPool& m_pool;
+			std::size_t m_capacity;
+			std::size_t m_entryCount;
+			std::unique_ptr<UInt32[]> m_entries;
+	};
+}
+
+#include <NazaraUtils/ConcurrentMemoryPool.inl>
+
+#endif // NAZARAUTILS_CONCURRENTMEMORYPOOL_HPP
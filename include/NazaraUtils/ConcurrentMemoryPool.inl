@@ -0,0 +1,506 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ConcurrentMemoryPool
+	* \brief Thread-safe memory pool, with stable entry indices
+	*
+	* Free entries are kept in a lock-free shared free list, blocks are only allocated under a lock.
+	* Allocation and deallocation can either be done directly on the pool or through a per-thread Cache, which keeps a small set of free entries locally
+	* and exchanges them with the shared free list in batches.
+	*
+	* \remark Blocks are never freed nor moved before the pool destruction, which means indices and pointers stay valid until entries are freed
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentMemoryPool object
+	*
+	* \param blockSize Size of blocks that will be allocated
+	* \param maxBlockCount Maximum number of blocks the pool can allocate, the block directory is allocated once for that many blocks
+	*
+	* \remark blockSize * maxBlockCount must fit in 32 bits
+	*/
+	template<typename T, std::size_t Alignment>
+	ConcurrentMemoryPool<T, Alignment>::ConcurrentMemoryPool(std::size_t blockSize, std::size_t maxBlockCount) :
+	m_freeListHead(std::in_place, 0),
+	m_blockCount(0),
+	m_blockSize(blockSize),
+	m_maxBlockCount(maxBlockCount),
+	m_blocks(std::make_unique<Block[]>(maxBlockCount))
+	{
+		assert(blockSize > 0);
+		assert(maxBlockCount > 0);
+		assert(blockSize <= (std::numeric_limits<UInt32>::max() - 1) / maxBlockCount);
+	}
+
+	/*!
+	* \brief Destroy the memory pool, calling the destructor for every allocated object and desallocating blocks
+	*
+	* \remark Every Cache referencing this pool must have been destroyed before
+	*/
+	template<typename T, std::size_t Alignment>
+	ConcurrentMemoryPool<T, Alignment>::~ConcurrentMemoryPool()
+	{
+		constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+		std::size_t blockCount = m_blockCount.load(std::memory_order_acquire);
+		std::size_t wordCount = (m_blockSize + bitsPerWord - 1) / bitsPerWord;
+		for (std::size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+		{
+			Block& block = m_blocks[blockIndex];
+			for (std::size_t i = 0; i < wordCount; ++i)
+			{
+				for (UInt64 word = block.occupiedEntries[i].load(std::memory_order_relaxed); word != 0; word &= word - 1)
+				{
+					std::size_t localIndex = i * bitsPerWord + FindFirstBit(word) - 1;
+					PlacementDestroy(std::launder(reinterpret_cast<T*>(&block.memory[localIndex])));
+				}
+			}
+		}
+	}
+
+	/*!
+	* \brief Allocates an entry without constructing it
+	* \return A pointer to memory allocated
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	*
+	* \remark This takes an entry from the shared free list on every call, prefer using a Cache for frequent allocations
+	* \remark Throws std::bad_alloc if the pool reached its maximum block count
+	*/
+	template<typename T, std::size_t Alignment>
+	T* ConcurrentMemoryPool<T, Alignment>::Allocate(DeferConstruct_t, std::size_t& index)
+	{
+		UInt32 entryIndex;
+		AllocateEntries(&entryIndex, 1);
+		MarkAllocated(entryIndex);
+
+		index = entryIndex;
+		return GetEntryPointer(entryIndex);
+	}
+
+	/*!
+	* \brief Allocates and constructs an entry
+	* \return A pointer to the constructed entry
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	* \param args Arguments used to construct the entry
+	*
+	* \remark This takes an entry from the shared free list on every call, prefer using a Cache for frequent allocations
+	*/
+	template<typename T, std::size_t Alignment>
+	template<typename... Args>
+	T* ConcurrentMemoryPool<T, Alignment>::Allocate(std::size_t& index, Args&&... args)
+	{
+		T* entry = Allocate(DeferConstruct, index);
+		PlacementNew(entry, std::forward<Args>(args)...);
+
+		return entry;
+	}
+
+	/*!
+	* \brief Returns an object memory to the memory pool
+	*
+	* Calls the destructor of the target object and returns its memory to the shared free list
+	*
+	* \param index Index of the allocated object
+	*/
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Free(std::size_t index)
+	{
+		PlacementDestroy(RetrieveFromIndex(index));
+		Free(index, NoDestruction);
+	}
+
+	/*!
+	* \brief Returns an object memory to the memory pool without calling its destructor
+	*
+	* \param index Index of the allocated object
+	*/
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Free(std::size_t index, NoDestruction_t)
+	{
+		UInt32 entryIndex = SafeCast<UInt32>(index);
+		MarkFreed(entryIndex);
+		PushFreeEntries(&entryIndex, 1);
+	}
+
+	/*!
+	* \brief Returns the number of allocated entries
+	* \return How many entries are currently allocated
+	*
+	* \remark This is only a snapshot if other threads are allocating or freeing entries at the same time
+	*/
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::GetAllocatedEntryCount() const
+	{
+		constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+		std::size_t count = 0;
+
+		std::size_t blockCount = m_blockCount.load(std::memory_order_acquire);
+		std::size_t wordCount = (m_blockSize + bitsPerWord - 1) / bitsPerWord;
+		for (std::size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+		{
+			for (std::size_t i = 0; i < wordCount; ++i)
+				count += CountBits(m_blocks[blockIndex].occupiedEntries[i].load(std::memory_order_relaxed));
+		}
+
+		return count;
+	}
+
+	/*!
+	* \brief Gets the block count
+	* \return How many block are currently allocated for this memory pool
+	*/
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::GetBlockCount() const
+	{
+		return m_blockCount.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Gets the block size
+	* \return Size of each block (i.e. how many items can fit in a block)
+	*/
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the maximum block count
+	* \return How many blocks this pool can allocate at most
+	*/
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::GetMaxBlockCount() const
+	{
+		return m_maxBlockCount;
+	}
+
+	/*!
+	* \brief Retrieve an allocated pointer based on a valid entry index
+	*
+	* \param index Entry index
+	*
+	* \return Pointer to the allocated entry
+	*
+	* \remark index must be valid, this doesn't take any lock
+	*/
+	template<typename T, std::size_t Alignment>
+	T* ConcurrentMemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index)
+	{
+		return GetEntryPointer(SafeCast<UInt32>(index));
+	}
+
+	/*!
+	* \brief Retrieve an allocated pointer based on a valid entry index
+	*
+	* \param index Entry index
+	*
+	* \return Pointer to the allocated entry
+	*
+	* \remark index must be valid, this doesn't take any lock
+	*/
+	template<typename T, std::size_t Alignment>
+	const T* ConcurrentMemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index) const
+	{
+		return GetEntryPointer(SafeCast<UInt32>(index));
+	}
+
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::AllocateEntries(UInt32* indices, std::size_t count)
+	{
+		std::size_t entryCount = PopFreeEntries(indices, count);
+		if (entryCount > 0)
+			return entryCount;
+
+		std::lock_guard lock(m_blockMutex);
+
+		// Another thread may have allocated a block while we were waiting for the lock
+		entryCount = PopFreeEntries(indices, count);
+		if (entryCount > 0)
+			return entryCount;
+
+		UInt32 firstIndex = AllocateBlock();
+
+		// Take the first entries of the new block and share the remaining ones
+		entryCount = std::min(count, m_blockSize);
+		for (std::size_t i = 0; i < entryCount; ++i)
+			indices[i] = SafeCast<UInt32>(firstIndex + i);
+
+		if (entryCount < m_blockSize)
+		{
+			UInt32 first = SafeCast<UInt32>(firstIndex + entryCount);
+			UInt32 last = SafeCast<UInt32>(firstIndex + m_blockSize - 1);
+			for (UInt32 i = first; i < last; ++i)
+				GetNextFreeEntry(i).store(i + 2, std::memory_order_relaxed);
+
+			PushFreeList(first, last);
+		}
+
+		return entryCount;
+	}
+
+	template<typename T, std::size_t Alignment>
+	UInt32 ConcurrentMemoryPool<T, Alignment>::AllocateBlock()
+	{
+		// m_blockMutex must be locked by the caller
+		constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+		std::size_t blockIndex = m_blockCount.load(std::memory_order_relaxed);
+		if (blockIndex >= m_maxBlockCount)
+			throw std::bad_alloc();
+
+		Block& block = m_blocks[blockIndex];
+		block.memory = std::make_unique<AlignedStorage[]>(m_blockSize);
+		block.nextFreeEntries = std::make_unique<std::atomic<UInt32>[]>(m_blockSize);
+		block.occupiedEntries = std::make_unique<std::atomic<UInt64>[]>((m_blockSize + bitsPerWord - 1) / bitsPerWord);
+
+		// Entries of this block can only be reached once they were pushed to the free list (with release semantics), so this store is only here for GetBlockCount
+		m_blockCount.store(blockIndex + 1, std::memory_order_release);
+
+		return SafeCast<UInt32>(blockIndex * m_blockSize);
+	}
+
+	template<typename T, std::size_t Alignment>
+	T* ConcurrentMemoryPool<T, Alignment>::GetEntryPointer(UInt32 index) const
+	{
+		std::size_t blockIndex = index / m_blockSize;
+		std::size_t localIndex = index % m_blockSize;
+		assert(blockIndex < m_blockCount.load(std::memory_order_relaxed));
+
+		return std::launder(reinterpret_cast<T*>(&m_blocks[blockIndex].memory[localIndex]));
+	}
+
+	template<typename T, std::size_t Alignment>
+	std::atomic<UInt32>& ConcurrentMemoryPool<T, Alignment>::GetNextFreeEntry(UInt32 index) const
+	{
+		return m_blocks[index / m_blockSize].nextFreeEntries[index % m_blockSize];
+	}
+
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::MarkAllocated(UInt32 index)
+	{
+		constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+		std::size_t localIndex = index % m_blockSize;
+		UInt64 bit = UInt64(1) << (localIndex % bitsPerWord);
+
+		[[maybe_unused]] UInt64 previous = m_blocks[index / m_blockSize].occupiedEntries[localIndex / bitsPerWord].fetch_or(bit, std::memory_order_relaxed);
+		assert((previous & bit) == 0 && "entry is already allocated");
+	}
+
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::MarkFreed(UInt32 index)
+	{
+		constexpr std::size_t bitsPerWord = BitCount<UInt64>();
+
+		std::size_t localIndex = index % m_blockSize;
+		UInt64 bit = UInt64(1) << (localIndex % bitsPerWord);
+
+		[[maybe_unused]] UInt64 previous = m_blocks[index / m_blockSize].occupiedEntries[localIndex / bitsPerWord].fetch_and(~bit, std::memory_order_relaxed);
+		assert((previous & bit) != 0 && "entry is not allocated");
+	}
+
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::PopFreeEntries(UInt32* indices, std::size_t count)
+	{
+		std::size_t entryCount = 0;
+
+		UInt64 head = m_freeListHead->load(std::memory_order_acquire);
+		while (entryCount < count)
+		{
+			UInt32 headEntry = UInt32(head & 0xFFFFFFFF);
+			if (headEntry == 0)
+				break;
+
+			// The tag is incremented on every change to the head, preventing ABA issues if this entry is popped and pushed back concurrently
+			UInt32 nextEntry = GetNextFreeEntry(headEntry - 1).load(std::memory_order_relaxed);
+			UInt64 newHead = (((head >> 32) + 1) << 32) | nextEntry;
+			if (m_freeListHead->compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				indices[entryCount++] = headEntry - 1;
+				head = newHead;
+			}
+		}
+
+		return entryCount;
+	}
+
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::PushFreeEntries(const UInt32* indices, std::size_t count)
+	{
+		if (count == 0)
+			return;
+
+		// Link entries together before pushing them all at once
+		for (std::size_t i = 0; i < count - 1; ++i)
+			GetNextFreeEntry(indices[i]).store(indices[i + 1] + 1, std::memory_order_relaxed);
+
+		PushFreeList(indices[0], indices[count - 1]);
+	}
+
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::PushFreeList(UInt32 firstIndex, UInt32 lastIndex)
+	{
+		// Entries from firstIndex to lastIndex must already be linked together
+		std::atomic<UInt32>& lastNext = GetNextFreeEntry(lastIndex);
+
+		UInt64 head = m_freeListHead->load(std::memory_order_relaxed);
+		UInt64 newHead;
+		do
+		{
+			lastNext.store(UInt32(head & 0xFFFFFFFF), std::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | (firstIndex + 1);
+		}
+		while (!m_freeListHead->compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ConcurrentMemoryPool::Cache
+	* \brief Per-thread magazine of free entries of a ConcurrentMemoryPool
+	*
+	* A cache must only be used by one thread at a time, it refills itself from the shared free list (or by allocating a new block) when empty
+	* and gives back half of its entries when full, keeping most allocations and deallocations free of any atomic operation on the free list.
+	* Entries can be freed through any cache, regardless of the cache used to allocate them.
+	*/
+
+	/*!
+	* \brief Constructs a Cache object
+	*
+	* \param pool Memory pool owning the entries, must outlive the cache
+	* \param capacity Maximum number of free entries kept locally (refills and flushes are made by half of this)
+	*/
+	template<typename T, std::size_t Alignment>
+	ConcurrentMemoryPool<T, Alignment>::Cache::Cache(ConcurrentMemoryPool& pool, std::size_t capacity) :
+	m_pool(pool),
+	m_capacity(std::max<std::size_t>(capacity, 2)),
+	m_entryCount(0),
+	m_entries(std::make_unique<UInt32[]>(m_capacity))
+	{
+	}
+
+	/*!
+	* \brief Destroys the cache, returning its free entries to the pool
+	*/
+	template<typename T, std::size_t Alignment>
+	ConcurrentMemoryPool<T, Alignment>::Cache::~Cache()
+	{
+		Flush();
+	}
+
+	/*!
+	* \brief Allocates an entry without constructing it
+	* \return A pointer to memory allocated
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	*/
+	template<typename T, std::size_t Alignment>
+	T* ConcurrentMemoryPool<T, Alignment>::Cache::Allocate(DeferConstruct_t, std::size_t& index)
+	{
+		if (m_entryCount == 0)
+			m_entryCount = m_pool.AllocateEntries(&m_entries[0], m_capacity / 2);
+
+		UInt32 entryIndex = m_entries[--m_entryCount];
+		m_pool.MarkAllocated(entryIndex);
+
+		index = entryIndex;
+		return m_pool.GetEntryPointer(entryIndex);
+	}
+
+	/*!
+	* \brief Allocates and constructs an entry
+	* \return A pointer to the constructed entry
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	* \param args Arguments used to construct the entry
+	*/
+	template<typename T, std::size_t Alignment>
+	template<typename... Args>
+	T* ConcurrentMemoryPool<T, Alignment>::Cache::Allocate(std::size_t& index, Args&&... args)
+	{
+		T* entry = Allocate(DeferConstruct, index);
+		PlacementNew(entry, std::forward<Args>(args)...);
+
+		return entry;
+	}
+
+	/*!
+	* \brief Returns every locally kept free entry to the pool shared free list
+	*/
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Cache::Flush()
+	{
+		m_pool.PushFreeEntries(&m_entries[0], m_entryCount);
+		m_entryCount = 0;
+	}
+
+	/*!
+	* \brief Returns an object memory to the cache
+	*
+	* Calls the destructor of the target object and keeps its entry locally for future allocations
+	*
+	* \param index Index of the allocated object
+	*/
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Cache::Free(std::size_t index)
+	{
+		PlacementDestroy(m_pool.RetrieveFromIndex(index));
+		Free(index, NoDestruction);
+	}
+
+	/*!
+	* \brief Returns an object memory to the cache without calling its destructor
+	*
+	* \param index Index of the allocated object
+	*/
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Cache::Free(std::size_t index, NoDestruction_t)
+	{
+		UInt32 entryIndex = SafeCast<UInt32>(index);
+		m_pool.MarkFreed(entryIndex);
+		Release(entryIndex);
+	}
+
+	/*!
+	* \brief Returns the number of free entries kept by this cache
+	* \return How many entries can be allocated before having to refill from the pool
+	*/
+	template<typename T, std::size_t Alignment>
+	std::size_t ConcurrentMemoryPool<T, Alignment>::Cache::GetCachedEntryCount() const
+	{
+		return m_entryCount;
+	}
+
+	template<typename T, std::size_t Alignment>
+	void ConcurrentMemoryPool<T, Alignment>::Cache::Release(UInt32 index)
+	{
+		if (m_entryCount == m_capacity)
+		{
+			// Give back the oldest half of our entries in one batch
+			std::size_t flushCount = m_capacity / 2;
+			m_pool.PushFreeEntries(&m_entries[0], flushCount);
+
+			std::copy(&m_entries[flushCount], &m_entries[m_entryCount], &m_entries[0]);
+			m_entryCount -= flushCount;
+		}
+
+		m_entries[m_entryCount++] = index;
+	}
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CONCURRENTSIGNAL_HPP
+#define NAZARAUTILS_CONCURRENTSIGNAL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Nz
+{
+	template<typename... Args>
+	class ConcurrentSignal
+	{
+		public:
+			using Callback = InplaceFunction<void(Args...)>;
+			class Connection;
+			class ConnectionGuard;
+
+			ConcurrentSignal();
+			ConcurrentSignal(const ConcurrentSignal&);
+			ConcurrentSignal(ConcurrentSignal&& signal) noexcept = default;
+			~ConcurrentSignal() = default;
+
+			void Clear();
+
+			Connection Connect(const Callback& func);
+			Connection Connect(Callback&& func);
+			template<typename O> Connection Connect(O& object, void (O::*method)(Args...));
+			template<typename O> Connection Connect(O* object, void (O::*method)(Args...));
+			template<typename O> Connection Connect(const O& object, void (O::*method)(Args...) const);
+			template<typename O> Connection Connect(const O* object, void (O::*method)(Args...) const);
+
+			std::size_t GetSlotCount() const;
+
+			void operator()(Args... args) const;
+
+			ConcurrentSignal& operator=(const ConcurrentSignal&);
+			ConcurrentSignal& operator=(ConcurrentSignal&& signal) noexcept;
+
+		private:
+			struct Slot
+			{
+				Slot(Callback&& func);
+
+				Callback callback;
+				std::atomic_bool connected;
+			};
+
+			struct Snapshot
+			{
+				std::vector<std::shared_ptr<Slot>> slots;
+			};
+
+			struct State
+			{
+				~State();
+
+				void Disconnect(Slot& slot);
+				void Publish(std::unique_ptr<Snapshot> newSnapshot);
+				void TryReclaim();
+
+				std::atomic<Snapshot*> snapshot = nullptr; //< Immutable once published
+				std::atomic<std::size_t> activeEmissions = 0;
+				std::atomic_bool hasRetiredSnapshots = false;
+				std::mutex mutex; //< Serializes writers
+				std::vector<Snapshot*> retiredSnapshots; //< Replaced snapshots possibly still used by emissions, freed once no emission is running
+			};
+
+			std::shared_ptr<State> m_state;
+	};
+
+	template<typename... Args>
+	class ConcurrentSignal<Args...>::Connection
+	{
+		using BaseClass = ConcurrentSignal<Args...>;
+		friend BaseClass;
+
+		public:
+			Connection() = default;
+			Connection(const Connection& connection) = default;
+			Connection(Connection&& connection) noexcept = default;
+			~Connection() = default;
+
+			template<typename... ConnectArgs>
+			void Connect(BaseClass& signal, ConnectArgs&&... args);
+			void Disconnect();
+
+			bool IsConnected() const;
+
+			Connection& operator=(const Connection& connection) = default;
+			Connection& operator=(Connection&& connection) noexcept = default;
+
+		private:
+			Connection(const std::shared_ptr<State>& state, const std::shared_ptr<Slot>& slot);
+
+			std::weak_ptr<State> m_state;
+			std::weak_ptr<Slot> m_slot;
+	};
+
+	template<typename... Args>
+	class ConcurrentSignal<Args...>::ConnectionGuard
+	{
+		using BaseClass = ConcurrentSignal<Args...>;
+		using Connection = typename BaseClass::Connection;
+
+		public:
+			ConnectionGuard() = default;
+			ConnectionGuard(const Connection& connection);
+			ConnectionGuard(const ConnectionGuard& connection) = delete;
+			ConnectionGuard(Connection&& connection);
+			ConnectionGuard(ConnectionGuard&& connection) noexcept = default;
+			~ConnectionGuard();
+
+			template<typename... ConnectArgs>
+			void Connect(BaseClass& signal, ConnectArgs&&... args);
+			void Disconnect();
+
+			Connection& GetConnection();
+
+			bool IsConnected() const;
+
+			ConnectionGuard& operator=(const Connection& connection);
+			ConnectionGuard& operator=(const ConnectionGuard& connection) = delete;
+			ConnectionGuard& operator=(Connection&& connection);
+			ConnectionGuard& operator=(ConnectionGuard&& connection);
+
+		private:
+			Connection m_connection;
+	};
+}
+
+#include <NazaraUtils/ConcurrentSignal.inl>
+
+#endif // NAZARAUTILS_CONCURRENTSIGNAL_HPP
@@ -0,0 +1,531 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ConcurrentSignal
+	* \brief Thread-safe variant of Signal, which can be emitted, connected to and disconnected from by multiple threads at once
+	*
+	* Slots are stored in an immutable snapshot, emissions only read the current snapshot, and never lock or allocate memory.
+	* Connecting and disconnecting slots copies the snapshot (under a lock) and publishes the new one, the replaced snapshot is
+	* freed once no emission is running anymore.
+	*
+	* \remark Slots connected during an emission will only be called by the next emissions
+	* \remark Slots disconnected while other threads are emitting may still be running (or be about to run) when Disconnect returns, but they won't be called by emissions starting afterwards
+	* \remark Moving or assigning a signal while it is used by other threads is not thread-safe
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal object by default
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConcurrentSignal() :
+	m_state(std::make_shared<State>())
+	{
+	}
+
+	/*!
+	* \brief Constructs a ConcurrentSignal object by default
+	*
+	* \remark It doesn't make sense to copy a signal, this is only available for convenience to allow compiler-generated copy constructors
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConcurrentSignal(const ConcurrentSignal&) :
+	ConcurrentSignal()
+	{
+	}
+
+	/*!
+	* \brief Disconnects every slot of the signal
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::Clear()
+	{
+		if (!m_state)
+			return;
+
+		std::lock_guard lock(m_state->mutex);
+
+		if (Snapshot* snapshot = m_state->snapshot.load(std::memory_order_relaxed))
+		{
+			for (const std::shared_ptr<Slot>& slot : snapshot->slots)
+				slot->connected.store(false, std::memory_order_relaxed);
+		}
+
+		m_state->Publish(nullptr);
+	}
+
+	/*!
+	* \brief Connects a function to the signal
+	* \return Connection attached to the signal
+	*
+	* \param func Non-member function
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::Connect(const Callback& func) -> Connection
+	{
+		return Connect(Callback(func));
+	}
+
+	/*!
+	* \brief Connects a function to the signal
+	* \return Connection attached to the signal
+	*
+	* \param func Non-member function
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::Connect(Callback&& func) -> Connection
+	{
+		assert((func) && "Invalid function");
+
+		// moved-from signal
+		if (!m_state)
+			m_state = std::make_shared<State>();
+
+		std::shared_ptr<Slot> slot = std::make_shared<Slot>(std::move(func));
+
+		std::lock_guard lock(m_state->mutex);
+
+		auto newSnapshot = std::make_unique<Snapshot>();
+		if (Snapshot* snapshot = m_state->snapshot.load(std::memory_order_relaxed))
+		{
+			newSnapshot->slots.reserve(snapshot->slots.size() + 1);
+			newSnapshot->slots.insert(newSnapshot->slots.end(), snapshot->slots.begin(), snapshot->slots.end());
+		}
+		newSnapshot->slots.push_back(slot);
+
+		m_state->Publish(std::move(newSnapshot));
+
+		return Connection(m_state, slot);
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+	template<typename... Args>
+	template<typename O>
+	auto ConcurrentSignal<Args...>::Connect(O& object, void (O::*method) (Args...)) -> Connection
+	{
+		return Connect(&object, method);
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+	template<typename... Args>
+	template<typename O>
+	auto ConcurrentSignal<Args...>::Connect(O* object, void (O::*method)(Args...)) -> Connection
+	{
+		auto callback = [object, method] (Args&&... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+	template<typename... Args>
+	template<typename O>
+	auto ConcurrentSignal<Args...>::Connect(const O& object, void (O::*method) (Args...) const) -> Connection
+	{
+		return Connect(&object, method);
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+	template<typename... Args>
+	template<typename O>
+	auto ConcurrentSignal<Args...>::Connect(const O* object, void (O::*method)(Args...) const) -> Connection
+	{
+		auto callback = [object, method] (Args&&... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
+	}
+
+	/*!
+	* \brief Gets the number of slots connected to the signal
+	* \return Slot count at the time of the call
+	*/
+	template<typename... Args>
+	std::size_t ConcurrentSignal<Args...>::GetSlotCount() const
+	{
+		if (!m_state)
+			return 0;
+
+		std::lock_guard lock(m_state->mutex);
+
+		Snapshot* snapshot = m_state->snapshot.load(std::memory_order_relaxed);
+		return (snapshot) ? snapshot->slots.size() : 0;
+	}
+
+	/*!
+	* \brief Applies the list of arguments to every callback functions
+	*
+	* \param args Arguments to send with the message
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::operator()(Args... args) const
+	{
+		State* state = m_state.get();
+		if (!state)
+			return;
+
+		// Registering the emission before reading the snapshot (both sequentially consistent) guarantees writers
+		// observing no emission also published their snapshot before any emission could read it
+		state->activeEmissions.fetch_add(1);
+		NAZARA_DEFER(
+		{
+			if (state->activeEmissions.fetch_sub(1) == 1 && state->hasRetiredSnapshots.load())
+			{
+				// Don't wait for writers, they will reclaim the snapshots themselves
+				std::unique_lock lock(state->mutex, std::try_to_lock);
+				if (lock.owns_lock())
+					state->TryReclaim();
+			}
+		});
+
+		const Snapshot* snapshot = state->snapshot.load();
+		if (!snapshot)
+			return;
+
+		for (const std::shared_ptr<Slot>& slot : snapshot->slots)
+		{
+			if (slot->connected.load(std::memory_order_relaxed))
+				slot->callback(args...);
+		}
+	}
+
+	/*!
+	* \brief Doesn't do anything
+	* \return A reference to this
+	*
+	* \remark This is only for convenience to allow compiled-generated assignation operator
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>& ConcurrentSignal<Args...>::operator=(const ConcurrentSignal&)
+	{
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the signal into this
+	* \return A reference to this
+	*
+	* \param signal Signal to move in this
+	*
+	* \remark Connections to this signal are disconnected, while connections to the moved signal now refer to this one
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>& ConcurrentSignal<Args...>::operator=(ConcurrentSignal&& signal) noexcept
+	{
+		m_state = std::move(signal.m_state);
+		return *this;
+	}
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::Slot::Slot(Callback&& func) :
+	callback(std::move(func)),
+	connected(true)
+	{
+	}
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::State::~State()
+	{
+		// No emission can be running at this point
+		delete snapshot.load(std::memory_order_relaxed);
+		for (Snapshot* retiredSnapshot : retiredSnapshots)
+			delete retiredSnapshot;
+	}
+
+	/*!
+	* \brief Removes a slot from the current snapshot
+	*
+	* \param slot Slot to remove
+	*
+	* \remark Does nothing if the slot was already disconnected
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::Disconnect(Slot& slot)
+	{
+		std::lock_guard lock(mutex);
+
+		if (!slot.connected.exchange(false, std::memory_order_relaxed))
+			return;
+
+		Snapshot* currentSnapshot = snapshot.load(std::memory_order_relaxed);
+		assert(currentSnapshot);
+
+		std::unique_ptr<Snapshot> newSnapshot;
+		if (currentSnapshot->slots.size() > 1)
+		{
+			newSnapshot = std::make_unique<Snapshot>();
+			newSnapshot->slots.reserve(currentSnapshot->slots.size() - 1);
+			for (const std::shared_ptr<Slot>& otherSlot : currentSnapshot->slots)
+			{
+				if (otherSlot.get() != &slot)
+					newSnapshot->slots.push_back(otherSlot);
+			}
+		}
+
+		Publish(std::move(newSnapshot));
+	}
+
+	/*!
+	* \brief Replaces the current snapshot and retires the previous one
+	*
+	* \param newSnapshot Snapshot to publish, can be null if the signal has no slot
+	*
+	* \remark The mutex must be locked
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::Publish(std::unique_ptr<Snapshot> newSnapshot)
+	{
+		if (Snapshot* previousSnapshot = snapshot.exchange(newSnapshot.release()))
+		{
+			retiredSnapshots.push_back(previousSnapshot);
+			hasRetiredSnapshots.store(true);
+		}
+
+		TryReclaim();
+	}
+
+	/*!
+	* \brief Frees retired snapshots if no emission is running
+	*
+	* \remark The mutex must be locked
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::TryReclaim()
+	{
+		if (retiredSnapshots.empty() || activeEmissions.load() != 0)
+			return;
+
+		// Emissions starting from now can only read the current snapshot
+		for (Snapshot* retiredSnapshot : retiredSnapshots)
+			delete retiredSnapshot;
+
+		retiredSnapshots.clear();
+		hasRetiredSnapshots.store(false);
+	}
+
+	/*!
+	* \class Nz::ConcurrentSignal::Connection
+	* \brief Core class that represents a connection attached to a concurrent signal
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::Connection object with a slot
+	*
+	* \param state Shared state of the signal
+	* \param slot Connected slot
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::Connection::Connection(const std::shared_ptr<State>& state, const std::shared_ptr<Slot>& slot) :
+	m_state(state),
+	m_slot(slot)
+	{
+	}
+
+	/*!
+	* \brief Connects to a signal with arguments
+	*
+	* \param signal New signal to listen
+	* \param args Arguments for the signal
+	*/
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	void ConcurrentSignal<Args...>::Connection::Connect(BaseClass& signal, ConnectArgs&&... args)
+	{
+		operator=(signal.Connect(std::forward<ConnectArgs>(args)...));
+	}
+
+	/*!
+	* \brief Disconnects the connection from the signal
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::Connection::Disconnect()
+	{
+		if (std::shared_ptr<Slot> slot = m_slot.lock())
+		{
+			if (std::shared_ptr<State> state = m_state.lock())
+				state->Disconnect(*slot);
+		}
+	}
+
+	/*!
+	* \brief Checks whether the connection is still active with the signal
+	* \return true if signal is still active
+	*/
+	template<typename... Args>
+	bool ConcurrentSignal<Args...>::Connection::IsConnected() const
+	{
+		if (m_state.expired())
+			return false;
+
+		std::shared_ptr<Slot> slot = m_slot.lock();
+		return slot && slot->connected.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \class Nz::ConcurrentSignal::ConnectionGuard
+	* \brief Core class that represents a RAII for a connection attached to a concurrent signal
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::ConnectionGuard object with a connection
+	*
+	* \param connection Connection for the scope
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::ConnectionGuard(const Connection& connection) :
+	m_connection(connection)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::ConnectionGuard object with a connection by move semantic
+	*
+	* \param connection Connection for the scope
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::ConnectionGuard(Connection&& connection) :
+	m_connection(std::move(connection))
+	{
+	}
+
+	/*!
+	* \brief Destructs the object and disconnects the connection
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::~ConnectionGuard()
+	{
+		m_connection.Disconnect();
+	}
+
+	/*!
+	* \brief Connects to a signal with arguments
+	*
+	* \param signal New signal to listen
+	* \param args Arguments for the signal
+	*/
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	void ConcurrentSignal<Args...>::ConnectionGuard::Connect(BaseClass& signal, ConnectArgs&&... args)
+	{
+		m_connection.Disconnect();
+		m_connection.Connect(signal, std::forward<ConnectArgs>(args)...);
+	}
+
+	/*!
+	* \brief Disconnects the connection from the signal
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::ConnectionGuard::Disconnect()
+	{
+		m_connection.Disconnect();
+	}
+
+	/*!
+	* \brief Gets the connection attached to the signal
+	* \return Connection of the signal
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::ConnectionGuard::GetConnection() -> Connection&
+	{
+		return m_connection;
+	}
+
+	/*!
+	* \brief Checks whether the connection is still active with the signal
+	* \return true if signal is still active
+	*/
+	template<typename... Args>
+	bool ConcurrentSignal<Args...>::ConnectionGuard::IsConnected() const
+	{
+		return m_connection.IsConnected();
+	}
+
+	/*!
+	* \brief Assigns the connection into this
+	* \return A reference to this
+	*
+	* \param connection Connection to assign into this
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::ConnectionGuard::operator=(const Connection& connection) -> ConnectionGuard&
+	{
+		m_connection.Disconnect();
+		m_connection = connection;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the Connection into this
+	* \return A reference to this
+	*
+	* \param connection Connection to move in this
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::ConnectionGuard::operator=(Connection&& connection) -> ConnectionGuard&
+	{
+		if (&connection != &m_connection)
+		{
+			m_connection.Disconnect();
+			m_connection = std::move(connection);
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the ConnectionGuard into this
+	* \return A reference to this
+	*
+	* \param connection ConnectionGuard to move in this
+	*/
+	template<typename... Args>
+	auto ConcurrentSignal<Args...>::ConnectionGuard::operator=(ConnectionGuard&& connection) -> ConnectionGuard&
+	{
+		if (&connection != this)
+		{
+			m_connection.Disconnect();
+			m_connection = std::move(connection.m_connection);
+		}
+
+		return *this;
+	}
+}
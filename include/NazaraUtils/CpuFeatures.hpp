@@ -0,0 +1,92 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CPUFEATURES_HPP
+#define NAZARAUTILS_CPUFEATURES_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <atomic>
+#include <type_traits>
+
+// Define NAZARA_NO_CPU_DISPATCH to disable runtime CPU detection: only the features enabled at compile-time (-mavx2, /arch:AVX2, ...) are used,
+// and CpuDispatch calls the selected kernel directly
+#if defined(NAZARA_NO_CPU_DISPATCH)
+	#define NAZARA_CPU_DETECTION_NONE
+#elif (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL))
+	#define NAZARA_CPU_DETECTION_CPUID
+#elif defined(NAZARA_ARCH_aarch64) && (defined(NAZARA_PLATFORM_LINUX) || defined(NAZARA_PLATFORM_ANDROID))
+	#define NAZARA_CPU_DETECTION_HWCAP
+#else
+	#define NAZARA_CPU_DETECTION_NONE
+#endif
+
+namespace Nz
+{
+	struct CpuFeatures
+	{
+		// x86
+		bool sse2 = false;
+		bool sse3 = false;
+		bool ssse3 = false;
+		bool sse41 = false;
+		bool sse42 = false;
+		bool popcnt = false;
+		bool pclmul = false;
+		bool avx = false; //< only set if the OS saves YMM registers, like every other AVX feature
+		bool f16c = false;
+		bool fma = false;
+		bool bmi1 = false;
+		bool bmi2 = false;
+		bool avx2 = false;
+		bool avx512f = false; //< only set if the OS saves ZMM and opmask registers
+		bool avx512bw = false;
+
+		// aarch64
+		bool neon = false;
+		bool crc32 = false;
+		bool pmull = false;
+		bool dotProduct = false;
+
+		static constexpr CpuFeatures All();
+	};
+
+	namespace Detail
+	{
+		template<auto Function> struct FunctionConstant {};
+	}
+
+	constexpr CpuFeatures GetCompileTimeCpuFeatures();
+	inline const CpuFeatures& GetCpuFeatures();
+
+	template<typename Signature, auto Selector> class CpuDispatch;
+
+	template<typename R, typename... Args, auto Selector>
+	class CpuDispatch<R(Args...), Selector>
+	{
+		public:
+			using Function = R(*)(Args...);
+
+			CpuDispatch() = delete;
+			~CpuDispatch() = delete;
+
+			static R Call(Args... args);
+			static Function GetFunction();
+
+			static constexpr bool IsStatic();
+
+		private:
+			static R Resolve(Args... args);
+
+			static constexpr Function BestFunction = Selector(CpuFeatures::All());
+			static constexpr Function CompileTimeFunction = Selector(GetCompileTimeCpuFeatures());
+
+			static inline std::atomic<Function> s_function = &Resolve;
+	};
+}
+
+#include <NazaraUtils/CpuFeatures.inl>
+
+#endif // NAZARAUTILS_CPUFEATURES_HPP
@@ -0,0 +1,329 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <utility>
+
+#if defined(NAZARA_CPU_DETECTION_CPUID)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#elif defined(NAZARA_CPU_DETECTION_HWCAP)
+	#include <sys/auxv.h>
+#endif
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::CpuFeatures
+	* \brief Instruction set extensions supported by a CPU, see GetCpuFeatures and GetCompileTimeCpuFeatures
+	*/
+
+	/*!
+	* \brief Returns a feature set with every feature enabled, to find the best kernel a selector can pick
+	*/
+	constexpr CpuFeatures CpuFeatures::All()
+	{
+		CpuFeatures features;
+		features.sse2 = true;
+		features.sse3 = true;
+		features.ssse3 = true;
+		features.sse41 = true;
+		features.sse42 = true;
+		features.popcnt = true;
+		features.pclmul = true;
+		features.avx = true;
+		features.f16c = true;
+		features.fma = true;
+		features.bmi1 = true;
+		features.bmi2 = true;
+		features.avx2 = true;
+		features.avx512f = true;
+		features.avx512bw = true;
+		features.neon = true;
+		features.crc32 = true;
+		features.pmull = true;
+		features.dotProduct = true;
+
+		return features;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::CpuDispatch
+	* \brief Calls the best kernel for the running CPU through a function pointer, chosen on first call
+	*
+	* Selector is a constexpr function taking a CpuFeatures and returning a function pointer matching the signature.
+	* The first call goes through a resolver which runs the selector on GetCpuFeatures() and replaces the pointer, following calls cost an indirect call.
+	*
+	* When the features enabled at compile-time already select the best kernel (or when NAZARA_NO_CPU_DISPATCH is defined), the kernel is called directly without any dispatch cost.
+	*
+	* \code
+	* constexpr SumFunc SelectSum(const Nz::CpuFeatures& features)
+	* {
+	*     return (features.avx2) ? &SumAVX2 : &SumScalar;
+	* }
+	*
+	* int sum = Nz::CpuDispatch<int(const int*, std::size_t), &SelectSum>::Call(values, count);
+	* \endcode
+	*/
+
+	/*!
+	* \brief Calls the selected kernel
+	* \return Result of the kernel
+	*
+	* \param args Arguments forwarded to the kernel
+	*/
+	template<typename R, typename... Args, auto Selector>
+	R CpuDispatch<R(Args...), Selector>::Call(Args... args)
+	{
+		if constexpr (IsStatic())
+			return CompileTimeFunction(std::forward<Args>(args)...);
+		else
+			return s_function.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Returns the kernel selected for the running CPU, selecting it if needed
+	*/
+	template<typename R, typename... Args, auto Selector>
+	auto CpuDispatch<R(Args...), Selector>::GetFunction() -> Function
+	{
+		if constexpr (IsStatic())
+			return CompileTimeFunction;
+		else
+		{
+			Function function = s_function.load(std::memory_order_relaxed);
+			if NAZARA_UNLIKELY(function == &Resolve)
+			{
+				function = Selector(GetCpuFeatures());
+				s_function.store(function, std::memory_order_relaxed);
+			}
+
+			return function;
+		}
+	}
+
+	/*!
+	* \brief Returns true if the kernel is known at compile-time (and called directly)
+	*/
+	template<typename R, typename... Args, auto Selector>
+	constexpr bool CpuDispatch<R(Args...), Selector>::IsStatic()
+	{
+#ifdef NAZARA_CPU_DETECTION_NONE
+		return true;
+#else
+		// Function pointers cannot always be compared in constant expressions (e.g. inline functions), but they can be compared as template arguments
+		return std::is_same_v<Detail::FunctionConstant<CompileTimeFunction>, Detail::FunctionConstant<BestFunction>>;
+#endif
+	}
+
+	template<typename R, typename... Args, auto Selector>
+	R CpuDispatch<R(Args...), Selector>::Resolve(Args... args)
+	{
+		// Selecting is idempotent, multiple threads resolving at the same time store the same pointer
+		Function function = Selector(GetCpuFeatures());
+		s_function.store(function, std::memory_order_relaxed);
+
+		return function(std::forward<Args>(args)...);
+	}
+
+
+	namespace Detail
+	{
+#if defined(NAZARA_CPU_DETECTION_CPUID)
+		inline void CpuId(UInt32 leaf, UInt32 subleaf, UInt32(&registers)[4])
+		{
+	#ifdef NAZARA_COMPILER_MSVC
+			int values[4];
+			__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for (std::size_t i = 0; i < 4; ++i)
+				registers[i] = static_cast<UInt32>(values[i]);
+	#else
+			__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+	#endif
+		}
+
+		inline UInt64 ReadXCR0()
+		{
+	#ifdef NAZARA_COMPILER_MSVC
+			return _xgetbv(0);
+	#else
+			UInt32 eax, edx;
+			__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (UInt64(edx) << 32) | eax;
+	#endif
+		}
+#endif
+
+		inline CpuFeatures DetectCpuFeatures()
+		{
+			CpuFeatures features = GetCompileTimeCpuFeatures();
+
+#if defined(NAZARA_CPU_DETECTION_CPUID)
+			UInt32 registers[4];
+			CpuId(0, 0, registers);
+			UInt32 maxLeaf = registers[0];
+			if (maxLeaf < 1)
+				return features;
+
+			CpuId(1, 0, registers);
+			UInt32 ecx = registers[2];
+			UInt32 edx = registers[3];
+
+			features.sse2 |= (edx & (1u << 26)) != 0;
+			features.sse3 |= (ecx & (1u << 0)) != 0;
+			features.pclmul |= (ecx & (1u << 1)) != 0;
+			features.ssse3 |= (ecx & (1u << 9)) != 0;
+			features.sse41 |= (ecx & (1u << 19)) != 0;
+			features.sse42 |= (ecx & (1u << 20)) != 0;
+			features.popcnt |= (ecx & (1u << 23)) != 0;
+
+			// AVX requires OS support for saving YMM registers (OSXSAVE + XCR0), AVX-512 also requires opmask and ZMM registers
+			UInt64 xcr0 = ((ecx & (1u << 27)) != 0) ? ReadXCR0() : 0;
+			bool ymmEnabled = (xcr0 & 0x06) == 0x06;
+			bool zmmEnabled = (xcr0 & 0xE6) == 0xE6;
+
+			if (ymmEnabled && (ecx & (1u << 28)) != 0)
+			{
+				features.avx = true;
+				features.fma |= (ecx & (1u << 12)) != 0;
+				features.f16c |= (ecx & (1u << 29)) != 0;
+			}
+
+			if (maxLeaf >= 7)
+			{
+				CpuId(7, 0, registers);
+				UInt32 ebx = registers[1];
+
+				features.bmi1 |= (ebx & (1u << 3)) != 0;
+				features.bmi2 |= (ebx & (1u << 8)) != 0;
+
+				if (features.avx)
+				{
+					features.avx2 |= (ebx & (1u << 5)) != 0;
+
+					if (zmmEnabled)
+					{
+						features.avx512f |= (ebx & (1u << 16)) != 0;
+						features.avx512bw |= (ebx & (1u << 30)) != 0;
+					}
+				}
+			}
+#elif defined(NAZARA_CPU_DETECTION_HWCAP)
+			// Bits from <asm/hwcap.h>, which isn't available on every libc
+			constexpr unsigned long HwcapAsimd = 1ul << 1;
+			constexpr unsigned long HwcapPmull = 1ul << 4;
+			constexpr unsigned long HwcapCrc32 = 1ul << 7;
+			constexpr unsigned long HwcapAsimdDp = 1ul << 20;
+
+			unsigned long hwcap = getauxval(AT_HWCAP);
+			features.neon |= (hwcap & HwcapAsimd) != 0;
+			features.pmull |= (hwcap & HwcapPmull) != 0;
+			features.crc32 |= (hwcap & HwcapCrc32) != 0;
+			features.dotProduct |= (hwcap & HwcapAsimdDp) != 0;
+#endif
+
+			return features;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the CPU features the code is compiled for (and which can be used without any check)
+	*
+	* \see GetCpuFeatures
+	*/
+	constexpr CpuFeatures GetCompileTimeCpuFeatures()
+	{
+		CpuFeatures features;
+
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+	#if defined(__SSE2__) || defined(NAZARA_ARCH_x86_64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		features.sse2 = true;
+	#endif
+	// MSVC only defines __AVX__, __AVX2__ and __AVX512*__ macros, which imply the previous extensions
+	#if defined(__SSE3__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX__))
+		features.sse3 = true;
+	#endif
+	#if defined(__SSSE3__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX__))
+		features.ssse3 = true;
+	#endif
+	#if defined(__SSE4_1__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX__))
+		features.sse41 = true;
+	#endif
+	#if defined(__SSE4_2__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX__))
+		features.sse42 = true;
+	#endif
+	#if defined(__POPCNT__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX__))
+		features.popcnt = true;
+	#endif
+	#if defined(__PCLMUL__)
+		features.pclmul = true;
+	#endif
+	#if defined(__AVX__)
+		features.avx = true;
+	#endif
+	#if defined(__F16C__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX2__))
+		features.f16c = true;
+	#endif
+	#if defined(__FMA__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX2__))
+		features.fma = true;
+	#endif
+	#if defined(__BMI__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX2__))
+		features.bmi1 = true;
+	#endif
+	#if defined(__BMI2__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX2__))
+		features.bmi2 = true;
+	#endif
+	#if defined(__AVX2__)
+		features.avx2 = true;
+	#endif
+	#if defined(__AVX512F__)
+		features.avx512f = true;
+	#endif
+	#if defined(__AVX512BW__)
+		features.avx512bw = true;
+	#endif
+#elif defined(NAZARA_ARCH_aarch64)
+	#if defined(__ARM_NEON) || defined(_M_ARM64)
+		features.neon = true;
+	#endif
+	#if defined(__ARM_FEATURE_CRC32) || defined(_M_ARM64)
+		features.crc32 = true;
+	#endif
+	#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+		features.pmull = true;
+	#endif
+	#if defined(__ARM_FEATURE_DOTPROD)
+		features.dotProduct = true;
+	#endif
+#endif
+
+		return features;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the CPU features of the running CPU
+	*
+	* Features are detected once (using CPUID on x86 and getauxval on Linux/Android aarch64) and cached,
+	* features enabled at compile-time are always reported.
+	*
+	* \remark If NAZARA_NO_CPU_DISPATCH is defined, or on platforms without runtime detection, this returns GetCompileTimeCpuFeatures()
+	* \remark AVX features are only reported if the OS saves the extended registers on context switches
+	*/
+	inline const CpuFeatures& GetCpuFeatures()
+	{
+#ifdef NAZARA_CPU_DETECTION_NONE
+		static constexpr CpuFeatures features = GetCompileTimeCpuFeatures();
+#else
+		static const CpuFeatures features = Detail::DetectCpuFeatures();
+#endif
+		return features;
+	}
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CUCKOOFILTER_HPP
+#define NAZARAUTILS_CUCKOOFILTER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	template<typename Key, typename Hash = FastHash<Key>>
+	class CuckooFilter
+	{
+		public:
+			explicit CuckooFilter(std::size_t capacity, const Hash& hash = Hash());
+			CuckooFilter(const CuckooFilter&) = default;
+			CuckooFilter(CuckooFilter&&) noexcept = default;
+			~CuckooFilter() = default;
+
+			void Clear();
+
+			std::size_t GetBucketCount() const;
+			std::size_t GetCapacity() const;
+			std::size_t GetSize() const;
+
+			bool Insert(const Key& key);
+
+			bool MayContain(const Key& key) const;
+			bool Merge(const CuckooFilter& filter);
+
+			bool Remove(const Key& key);
+
+			CuckooFilter& operator=(const CuckooFilter&) = default;
+			CuckooFilter& operator=(CuckooFilter&&) noexcept = default;
+
+			static constexpr std::size_t BucketSize = 4;
+			static constexpr std::size_t MaxKickCount = 500;
+
+		private:
+			using Fingerprint = UInt16;
+
+			// Fingerprint which couldn't be stored after MaxKickCount relocations, once set the filter is full
+			struct Victim
+			{
+				std::size_t bucketIndex;
+				Fingerprint fingerprint;
+				bool isUsed = false;
+			};
+
+			bool BucketContains(std::size_t bucketIndex, Fingerprint fingerprint) const;
+			std::size_t ComputeAlternateBucket(std::size_t bucketIndex, Fingerprint fingerprint) const;
+			std::pair<std::size_t, Fingerprint> ComputeBucketAndFingerprint(const Key& key) const;
+			void InsertFingerprint(std::size_t bucketIndex, Fingerprint fingerprint);
+			bool RemoveFromBucket(std::size_t bucketIndex, Fingerprint fingerprint);
+			bool TryInsertInBucket(std::size_t bucketIndex, Fingerprint fingerprint);
+
+			std::vector<Fingerprint> m_fingerprints; //< BucketSize fingerprints per bucket, zero marks an empty slot
+			Hash m_hash;
+			Victim m_victim;
+			std::size_t m_bucketMask;
+			std::size_t m_size;
+			UInt64 m_randomState;
+	};
+}
+
+#include <NazaraUtils/CuckooFilter.inl>
+
+#endif // NAZARAUTILS_CUCKOOFILTER_HPP
@@ -0,0 +1,284 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/Random.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::CuckooFilter
+	* \brief Probabilistic set answering "definitely not present" or "maybe present", supporting removal
+	*
+	* Keys are stored as 16-bit fingerprints in buckets of BucketSize slots, each key having two candidate buckets (partial-key cuckoo hashing:
+	* the alternate bucket is computed from the bucket and the fingerprint only, so fingerprints can be relocated without the key).
+	* The false positive rate is about 8 / 65536 at full load, regardless of the capacity.
+	*
+	* \remark Only keys which were inserted can be removed, removing other keys could remove a key sharing the same fingerprint
+	* \remark Inserting the same key multiple times stores multiple fingerprints, which must all be removed
+	* \see BloomFilter
+	*/
+
+	/*!
+	* \brief Constructs an empty filter
+	*
+	* \param capacity Number of keys the filter should be able to hold, the bucket count is rounded up to a power of two leaving some room (insertions start failing around 95% load)
+	* \param hash Hasher of the keys
+	*/
+	template<typename Key, typename Hash>
+	CuckooFilter<Key, Hash>::CuckooFilter(std::size_t capacity, const Hash& hash) :
+	m_hash(hash),
+	m_size(0),
+	m_randomState(0)
+	{
+		std::size_t bucketCount = RoundToPow2(std::max<std::size_t>((capacity * 100 / 95 + BucketSize - 1) / BucketSize, 1));
+		m_fingerprints.resize(bucketCount * BucketSize, 0);
+		m_bucketMask = bucketCount - 1;
+	}
+
+	/*!
+	* \brief Removes every key from the filter
+	*/
+	template<typename Key, typename Hash>
+	void CuckooFilter<Key, Hash>::Clear()
+	{
+		std::fill(m_fingerprints.begin(), m_fingerprints.end(), Fingerprint(0));
+		m_victim.isUsed = false;
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Returns the number of buckets of the filter
+	*/
+	template<typename Key, typename Hash>
+	std::size_t CuckooFilter<Key, Hash>::GetBucketCount() const
+	{
+		return m_bucketMask + 1;
+	}
+
+	/*!
+	* \brief Returns the number of fingerprint slots of the filter
+	*/
+	template<typename Key, typename Hash>
+	std::size_t CuckooFilter<Key, Hash>::GetCapacity() const
+	{
+		return m_fingerprints.size();
+	}
+
+	/*!
+	* \brief Returns the number of keys stored in the filter
+	*/
+	template<typename Key, typename Hash>
+	std::size_t CuckooFilter<Key, Hash>::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Inserts a key in the filter
+	* \return True if the key was inserted, false if the filter is full
+	*
+	* \param key Key to insert
+	*/
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::Insert(const Key& key)
+	{
+		if (m_victim.isUsed)
+			return false;
+
+		auto [bucketIndex, fingerprint] = ComputeBucketAndFingerprint(key);
+		InsertFingerprint(bucketIndex, fingerprint);
+
+		return true;
+	}
+
+	/*!
+	* \brief Checks if a key may have been inserted
+	* \return False if the key is not in the filter, true if it is or in case of a false positive
+	*
+	* \param key Key to check
+	*/
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::MayContain(const Key& key) const
+	{
+		auto [bucketIndex, fingerprint] = ComputeBucketAndFingerprint(key);
+		std::size_t alternateIndex = ComputeAlternateBucket(bucketIndex, fingerprint);
+
+		if (BucketContains(bucketIndex, fingerprint) || BucketContains(alternateIndex, fingerprint))
+			return true;
+
+		return m_victim.isUsed && m_victim.fingerprint == fingerprint && (m_victim.bucketIndex == bucketIndex || m_victim.bucketIndex == alternateIndex);
+	}
+
+	/*!
+	* \brief Adds every key of another filter to this one, to combine filters built separately (for example, by multiple threads)
+	* \return True if every key was added, false if this filter became full (some keys are then missing)
+	*
+	* Unlike Bloom filters, fingerprints cannot be merged with a bitwise OR: they are inserted one by one, starting from the bucket they occupy in the other filter.
+	*
+	* \param filter Filter to merge, must have the same bucket count and hasher than this one
+	*/
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::Merge(const CuckooFilter& filter)
+	{
+		assert(filter.m_fingerprints.size() == m_fingerprints.size());
+
+		for (std::size_t i = 0; i < filter.m_fingerprints.size(); ++i)
+		{
+			Fingerprint fingerprint = filter.m_fingerprints[i];
+			if (fingerprint == 0)
+				continue;
+
+			if (m_victim.isUsed)
+				return false;
+
+			InsertFingerprint(i / BucketSize, fingerprint);
+		}
+
+		if (filter.m_victim.isUsed)
+		{
+			if (m_victim.isUsed)
+				return false;
+
+			InsertFingerprint(filter.m_victim.bucketIndex, filter.m_victim.fingerprint);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Removes a key from the filter
+	* \return True if a fingerprint of the key was found and removed
+	*
+	* \param key Key to remove, which must have been inserted
+	*/
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::Remove(const Key& key)
+	{
+		auto [bucketIndex, fingerprint] = ComputeBucketAndFingerprint(key);
+		std::size_t alternateIndex = ComputeAlternateBucket(bucketIndex, fingerprint);
+
+		if (RemoveFromBucket(bucketIndex, fingerprint) || RemoveFromBucket(alternateIndex, fingerprint))
+		{
+			m_size--;
+
+			// A slot is now free, try to store the victim again
+			if (m_victim.isUsed)
+			{
+				m_victim.isUsed = false;
+				m_size--;
+				InsertFingerprint(m_victim.bucketIndex, m_victim.fingerprint);
+			}
+
+			return true;
+		}
+
+		if (m_victim.isUsed && m_victim.fingerprint == fingerprint && (m_victim.bucketIndex == bucketIndex || m_victim.bucketIndex == alternateIndex))
+		{
+			m_victim.isUsed = false;
+			m_size--;
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::BucketContains(std::size_t bucketIndex, Fingerprint fingerprint) const
+	{
+		const Fingerprint* bucket = &m_fingerprints[bucketIndex * BucketSize];
+		for (std::size_t i = 0; i < BucketSize; ++i)
+		{
+			if (bucket[i] == fingerprint)
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename Key, typename Hash>
+	std::size_t CuckooFilter<Key, Hash>::ComputeAlternateBucket(std::size_t bucketIndex, Fingerprint fingerprint) const
+	{
+		// XOR with the hash of the fingerprint (and not the fingerprint itself, to spread keys of nearby buckets), applying it twice gives the first bucket back
+		return (bucketIndex ^ static_cast<std::size_t>(Detail::WyMix(fingerprint, 0x9E3779B97F4A7C15ull))) & m_bucketMask;
+	}
+
+	template<typename Key, typename Hash>
+	auto CuckooFilter<Key, Hash>::ComputeBucketAndFingerprint(const Key& key) const -> std::pair<std::size_t, Fingerprint>
+	{
+		UInt64 hash = Detail::WyMix(static_cast<UInt64>(m_hash(key)), 0x9E3779B97F4A7C15ull);
+
+		// Zero marks empty slots
+		Fingerprint fingerprint = static_cast<Fingerprint>(hash >> 48);
+		if (fingerprint == 0)
+			fingerprint = 1;
+
+		return { static_cast<std::size_t>(hash) & m_bucketMask, fingerprint };
+	}
+
+	template<typename Key, typename Hash>
+	void CuckooFilter<Key, Hash>::InsertFingerprint(std::size_t bucketIndex, Fingerprint fingerprint)
+	{
+		assert(!m_victim.isUsed);
+		m_size++;
+
+		if (TryInsertInBucket(bucketIndex, fingerprint))
+			return;
+
+		bucketIndex = ComputeAlternateBucket(bucketIndex, fingerprint);
+		if (TryInsertInBucket(bucketIndex, fingerprint))
+			return;
+
+		// Both buckets are full, evict a random fingerprint to its alternate bucket until one has a free slot
+		for (std::size_t kick = 0; kick < MaxKickCount; ++kick)
+		{
+			std::size_t slot = bucketIndex * BucketSize + static_cast<std::size_t>(SplitMix64(m_randomState) % BucketSize);
+			std::swap(fingerprint, m_fingerprints[slot]);
+
+			bucketIndex = ComputeAlternateBucket(bucketIndex, fingerprint);
+			if (TryInsertInBucket(bucketIndex, fingerprint))
+				return;
+		}
+
+		// Keep the last evicted fingerprint aside, to never lose a key
+		m_victim.bucketIndex = bucketIndex;
+		m_victim.fingerprint = fingerprint;
+		m_victim.isUsed = true;
+	}
+
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::RemoveFromBucket(std::size_t bucketIndex, Fingerprint fingerprint)
+	{
+		Fingerprint* bucket = &m_fingerprints[bucketIndex * BucketSize];
+		for (std::size_t i = 0; i < BucketSize; ++i)
+		{
+			if (bucket[i] == fingerprint)
+			{
+				bucket[i] = 0;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template<typename Key, typename Hash>
+	bool CuckooFilter<Key, Hash>::TryInsertInBucket(std::size_t bucketIndex, Fingerprint fingerprint)
+	{
+		Fingerprint* bucket = &m_fingerprints[bucketIndex * BucketSize];
+		for (std::size_t i = 0; i < BucketSize; ++i)
+		{
+			if (bucket[i] == 0)
+			{
+				bucket[i] = fingerprint;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
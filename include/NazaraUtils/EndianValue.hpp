@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_ENDIANVALUE_HPP
+#define NAZARAUTILS_ENDIANVALUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <array>
+#include <type_traits>
+
+namespace Nz
+{
+	// Stores a value using a fixed endianness, converting it on access (for in-place access to file formats and network packets)
+	template<typename T, Endianness E, bool Aligned = true>
+	class EndianValue
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+		static_assert(E == Endianness::BigEndian || E == Endianness::LittleEndian, "invalid endianness");
+
+		public:
+			using value_type = T;
+
+			EndianValue() = default;
+			constexpr EndianValue(T value) noexcept;
+			EndianValue(const EndianValue&) = default;
+			EndianValue(EndianValue&&) noexcept = default;
+			~EndianValue() = default;
+
+			constexpr T Get() const noexcept;
+
+			constexpr void Set(T value) noexcept;
+
+			constexpr operator T() const noexcept;
+
+			constexpr EndianValue& operator=(T value) noexcept;
+			EndianValue& operator=(const EndianValue&) = default;
+			EndianValue& operator=(EndianValue&&) noexcept = default;
+
+			static constexpr Endianness StorageEndianness = E;
+
+		private:
+			using Storage = std::conditional_t<Aligned, T, std::array<UInt8, sizeof(T)>>;
+
+			Storage m_storage;
+	};
+
+	template<typename T> using BigEndian = EndianValue<T, Endianness::BigEndian>;
+	template<typename T> using LittleEndian = EndianValue<T, Endianness::LittleEndian>;
+
+	template<typename T> using UnalignedBigEndian = EndianValue<T, Endianness::BigEndian, false>;
+	template<typename T> using UnalignedLittleEndian = EndianValue<T, Endianness::LittleEndian, false>;
+}
+
+#include <NazaraUtils/EndianValue.inl>
+
+#endif // NAZARAUTILS_ENDIANVALUE_HPP
@@ -0,0 +1,90 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cstring>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::EndianValue
+	* \brief Trivially copyable wrapper storing a value in a fixed endianness
+	*
+	* The value is byte swapped on load and store if E differs from PlatformEndianness, which allows a struct of EndianValue
+	* (such as a file header) to be read directly from a memory-mapped file or a network buffer, without any copy.
+	*
+	* Aligned wrappers have the size and alignment of T, unaligned ones have the size of T and an alignment of 1 (and are accessed through memcpy)
+	* which makes them suitable for packed structures.
+	*
+	* \see BigEndian, LittleEndian, UnalignedBigEndian, UnalignedLittleEndian
+	*/
+
+	/*!
+	* \brief Stores a value
+	*
+	* \param value Value in host endianness
+	*/
+	template<typename T, Endianness E, bool Aligned>
+	constexpr EndianValue<T, E, Aligned>::EndianValue(T value) noexcept :
+	m_storage()
+	{
+		Set(value);
+	}
+
+	/*!
+	* \brief Loads the value
+	* \return Value in host endianness
+	*/
+	template<typename T, Endianness E, bool Aligned>
+	constexpr T EndianValue<T, E, Aligned>::Get() const noexcept
+	{
+		if constexpr (Aligned)
+		{
+			if constexpr (E != PlatformEndianness)
+				return ByteSwap(m_storage);
+			else
+				return m_storage;
+		}
+		else
+		{
+			T value;
+			std::memcpy(&value, m_storage.data(), sizeof(T));
+
+			if constexpr (E != PlatformEndianness)
+				value = ByteSwap(value);
+
+			return value;
+		}
+	}
+
+	/*!
+	* \brief Stores a value
+	*
+	* \param value Value in host endianness
+	*/
+	template<typename T, Endianness E, bool Aligned>
+	constexpr void EndianValue<T, E, Aligned>::Set(T value) noexcept
+	{
+		if constexpr (E != PlatformEndianness)
+			value = ByteSwap(value);
+
+		if constexpr (Aligned)
+			m_storage = value;
+		else
+			std::memcpy(m_storage.data(), &value, sizeof(T));
+	}
+
+	template<typename T, Endianness E, bool Aligned>
+	constexpr EndianValue<T, E, Aligned>::operator T() const noexcept
+	{
+		return Get();
+	}
+
+	template<typename T, Endianness E, bool Aligned>
+	constexpr auto EndianValue<T, E, Aligned>::operator=(T value) noexcept -> EndianValue&
+	{
+		Set(value);
+		return *this;
+	}
+}
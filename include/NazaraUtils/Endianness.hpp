@@ -42,6 +42,14 @@
 	#error You cannot define both NAZARA_BIG_ENDIAN and NAZARA_LITTLE_ENDIAN
 #endif
 
+#if !defined(NAZARA_ENDIANNESS_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_ENDIANNESS_SSSE3
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_ENDIANNESS_NEON
+	#endif
+#endif
+
 namespace Nz
 {
 	enum class Endianness
@@ -65,6 +73,15 @@ namespace Nz
 
 	template<typename T> constexpr T HostToBigEndian(T value);
 	template<typename T> constexpr T HostToLittleEndian(T value);
+
+	template<typename T> void BigEndianToHost(const T* src, T* dst, std::size_t count);
+	template<typename T> void LittleEndianToHost(const T* src, T* dst, std::size_t count);
+
+	template<typename T> void HostToBigEndian(const T* src, T* dst, std::size_t count);
+	template<typename T> void HostToLittleEndian(const T* src, T* dst, std::size_t count);
+
+	template<typename T> void ByteSwapArray(T* data, std::size_t count);
+	template<typename T> void ByteSwapArray(const T* src, T* dst, std::size_t count);
 }
 
 #include <NazaraUtils/Endianness.inl>
@@ -3,9 +3,131 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <NazaraUtils/Endianness.hpp>
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+#if defined(NAZARA_ENDIANNESS_SSSE3)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_ENDIANNESS_NEON)
+	#include <arm_neon.h>
+#endif
+
+#if defined(NAZARA_ENDIANNESS_SSSE3) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_ENDIANNESS_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_ENDIANNESS_TARGET(features)
+#endif
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Below this size, the cost of the dispatch outweighs the gains of the vectorized kernels
+		constexpr std::size_t ByteSwapScalarThreshold = 32;
+
+		template<std::size_t Size>
+		void ScalarByteSwapArray(const UInt8* src, UInt8* dst, std::size_t count)
+		{
+			using UInt = std::conditional_t<Size == 2, UInt16, std::conditional_t<Size == 4, UInt32, UInt64>>;
+			static_assert(sizeof(UInt) == Size);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				UInt value;
+				std::memcpy(&value, src + i * Size, Size);
+				value = ByteSwap(value);
+				std::memcpy(dst + i * Size, &value, Size);
+			}
+		}
+
+#if defined(NAZARA_ENDIANNESS_SSSE3)
+		inline bool HasSSSE3()
+		{
+			return GetCompileTimeCpuFeatures().ssse3 || GetCpuFeatures().ssse3;
+		}
+
+		template<std::size_t Size>
+		NAZARA_ENDIANNESS_TARGET("ssse3") void SSSE3ByteSwapArray(const UInt8* src, UInt8* dst, std::size_t count)
+		{
+			__m128i mask;
+			if constexpr (Size == 2)
+				mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			else if constexpr (Size == 4)
+				mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			else
+				mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+			std::size_t byteCount = count * Size;
+			std::size_t offset = 0;
+			for (; byteCount - offset >= 32; offset += 32)
+			{
+				__m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + offset));
+				__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + offset + 16));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + offset), _mm_shuffle_epi8(first, mask));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + offset + 16), _mm_shuffle_epi8(second, mask));
+			}
+
+			if (byteCount - offset >= 16)
+			{
+				__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + offset));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + offset), _mm_shuffle_epi8(value, mask));
+				offset += 16;
+			}
+
+			ScalarByteSwapArray<Size>(src + offset, dst + offset, (byteCount - offset) / Size);
+		}
+#elif defined(NAZARA_ENDIANNESS_NEON)
+		template<std::size_t Size>
+		void NEONByteSwapArray(const UInt8* src, UInt8* dst, std::size_t count)
+		{
+			std::size_t byteCount = count * Size;
+			std::size_t offset = 0;
+			for (; byteCount - offset >= 16; offset += 16)
+			{
+				uint8x16_t value = vld1q_u8(src + offset);
+				if constexpr (Size == 2)
+					value = vrev16q_u8(value);
+				else if constexpr (Size == 4)
+					value = vrev32q_u8(value);
+				else
+					value = vrev64q_u8(value);
+
+				vst1q_u8(dst + offset, value);
+			}
+
+			ScalarByteSwapArray<Size>(src + offset, dst + offset, (byteCount - offset) / Size);
+		}
+#endif
+
+		template<std::size_t Size>
+		void ByteSwapArray(const UInt8* src, UInt8* dst, std::size_t count)
+		{
+#if defined(NAZARA_ENDIANNESS_SSSE3)
+			if (count * Size >= ByteSwapScalarThreshold && HasSSSE3())
+				return SSSE3ByteSwapArray<Size>(src, dst, count);
+#elif defined(NAZARA_ENDIANNESS_NEON)
+			if (count * Size >= ByteSwapScalarThreshold)
+				return NEONByteSwapArray<Size>(src, dst, count);
+#endif
+
+			return ScalarByteSwapArray<Size>(src, dst, count);
+		}
+
+		template<typename T>
+		void CopyArray(const T* src, T* dst, std::size_t count)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+			if (src != dst && count > 0)
+				std::memcpy(dst, src, count * sizeof(T));
+		}
+	}
+
 	template<typename T>
 	constexpr T BigEndianToHost(T value)
 	{
@@ -37,5 +159,105 @@ namespace Nz
 	{
 		return LittleEndianToHost(value);
 	}
+
+	/*!
+	* \ingroup utils
+	* \brief Converts an array of big-endian values to host endianness
+	*
+	* \param src Pointer to the values to convert
+	* \param dst Pointer to the converted values, may be equal to src (for an in-place conversion) but must not partially overlap it
+	* \param count Number of values
+	*
+	* \remark This is a memcpy (or a no-op if src == dst) on big-endian platforms
+	*
+	* \see ByteSwapArray
+	*/
+	template<typename T>
+	void BigEndianToHost(const T* src, T* dst, std::size_t count)
+	{
+#if defined(NAZARA_BIG_ENDIAN)
+		Detail::CopyArray(src, dst, count);
+#elif defined(NAZARA_LITTLE_ENDIAN)
+		ByteSwapArray(src, dst, count);
+#endif
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Converts an array of little-endian values to host endianness
+	*
+	* \param src Pointer to the values to convert
+	* \param dst Pointer to the converted values, may be equal to src (for an in-place conversion) but must not partially overlap it
+	* \param count Number of values
+	*
+	* \remark This is a memcpy (or a no-op if src == dst) on little-endian platforms
+	*
+	* \see ByteSwapArray
+	*/
+	template<typename T>
+	void LittleEndianToHost(const T* src, T* dst, std::size_t count)
+	{
+#if defined(NAZARA_BIG_ENDIAN)
+		ByteSwapArray(src, dst, count);
+#elif defined(NAZARA_LITTLE_ENDIAN)
+		Detail::CopyArray(src, dst, count);
+#endif
+	}
+
+	template<typename T>
+	void HostToBigEndian(const T* src, T* dst, std::size_t count)
+	{
+		BigEndianToHost(src, dst, count);
+	}
+
+	template<typename T>
+	void HostToLittleEndian(const T* src, T* dst, std::size_t count)
+	{
+		LittleEndianToHost(src, dst, count);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reverses the bytes of every value of an array, in place
+	*
+	* \param data Pointer to the values
+	* \param count Number of values
+	*
+	* \see ByteSwap
+	*/
+	template<typename T>
+	void ByteSwapArray(T* data, std::size_t count)
+	{
+		ByteSwapArray(data, data, count);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reverses the bytes of every value of an array
+	*
+	* 2, 4 and 8 bytes values are swapped using SSSE3 (pshufb, if supported by the CPU) or NEON (rev) kernels, other sizes are swapped one by one using ByteSwap.
+	*
+	* \param src Pointer to the values to swap
+	* \param dst Pointer to the swapped values, may be equal to src (for an in-place swap) but must not partially overlap it
+	* \param count Number of values
+	*
+	* \see ByteSwap
+	*/
+	template<typename T>
+	void ByteSwapArray(const T* src, T* dst, std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+		if constexpr (sizeof(T) == 1)
+			Detail::CopyArray(src, dst, count);
+		else if constexpr (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+			Detail::ByteSwapArray<sizeof(T)>(reinterpret_cast<const UInt8*>(src), reinterpret_cast<UInt8*>(dst), count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = ByteSwap(src[i]);
+		}
+	}
 }
 
+#undef NAZARA_ENDIANNESS_TARGET
@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_ENUMSTRING_HPP
+#define NAZARAUTILS_ENUMSTRING_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <array>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace Nz
+{
+	// Specialize with a `static constexpr std::string_view names[]` member, indexed by enum value
+	template<typename E>
+	struct EnumNames
+	{
+	};
+
+	template<typename, typename = void>
+	struct HasEnumNames : std::false_type {};
+
+	template<typename E>
+	struct HasEnumNames<E, std::void_t<decltype(EnumNames<E>::names)>> : std::true_type {};
+
+	template<typename E> constexpr bool HasEnumNames_v = HasEnumNames<E>::value;
+
+	template<typename E> [[nodiscard]] constexpr std::optional<E> EnumFromString(std::string_view str) noexcept;
+	template<typename E> [[nodiscard]] constexpr std::string_view EnumToString(E value) noexcept;
+
+	namespace Detail
+	{
+		template<std::size_t NameCount, std::size_t BucketCount, std::size_t SlotCount>
+		struct EnumStringHashTable
+		{
+			static_assert(NameCount < 0xFFFF, "too many enum names");
+
+			std::array<UInt32, BucketCount> bucketSeeds{};
+			std::array<UInt16, SlotCount> slots{}; //< name index + 1, 0 for an empty slot
+			bool valid = true;
+		};
+
+		template<typename E> constexpr auto BuildEnumStringHashTable();
+
+		template<typename E> constexpr auto EnumStringHashTable_v = BuildEnumStringHashTable<E>();
+	}
+}
+
+#include <NazaraUtils/EnumString.inl>
+
+#endif // NAZARAUTILS_ENUMSTRING_HPP
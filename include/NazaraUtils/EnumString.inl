@@ -0,0 +1,195 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/EnumString.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <iterator>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Seeds above this are not tried, a bucket needing more than that means the table is full of unlucky hashes
+		constexpr UInt32 EnumStringMaxSeed = 0x10000;
+
+		constexpr UInt32 EnumStringMix(UInt32 hash, UInt32 seed) noexcept
+		{
+			// MurmurHash3 finalizer
+			hash ^= seed * 0x9E3779B9u;
+			hash ^= hash >> 16;
+			hash *= 0x85EBCA6Bu;
+			hash ^= hash >> 13;
+			hash *= 0xC2B2AE35u;
+			hash ^= hash >> 16;
+
+			return hash;
+		}
+
+		template<typename E>
+		constexpr std::size_t EnumNameCount() noexcept
+		{
+			return std::size(EnumNames<E>::names);
+		}
+
+		template<typename E>
+		constexpr auto BuildEnumStringHashTable()
+		{
+			constexpr auto& names = EnumNames<E>::names;
+
+			constexpr std::size_t NameCount = EnumNameCount<E>();
+			constexpr std::size_t BucketCount = RoundToPow2(std::max<std::size_t>(NameCount / 2, 1));
+			constexpr std::size_t SlotCount = RoundToPow2(NameCount + NameCount / 4 + 1);
+
+			EnumStringHashTable<NameCount, BucketCount, SlotCount> table;
+
+			std::array<UInt32, NameCount> hashes{};
+			std::array<std::size_t, BucketCount + 1> bucketOffsets{};
+			for (std::size_t i = 0; i < NameCount; ++i)
+			{
+				hashes[i] = FNV1a32(names[i]);
+				bucketOffsets[(EnumStringMix(hashes[i], 0) & (BucketCount - 1)) + 1]++;
+			}
+
+			// Group names by bucket (counting sort)
+			for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+				bucketOffsets[bucket + 1] += bucketOffsets[bucket];
+
+			std::array<std::size_t, NameCount> bucketNames{};
+			std::array<std::size_t, BucketCount> bucketFill{};
+			for (std::size_t i = 0; i < NameCount; ++i)
+			{
+				std::size_t bucket = EnumStringMix(hashes[i], 0) & (BucketCount - 1);
+				bucketNames[bucketOffsets[bucket] + bucketFill[bucket]++] = i;
+			}
+
+			// Two names sharing the same hash (or a duplicate name) end up in the same bucket and can never be told apart
+			for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+			{
+				for (std::size_t i = bucketOffsets[bucket]; i < bucketOffsets[bucket + 1]; ++i)
+				{
+					for (std::size_t j = bucketOffsets[bucket]; j < i; ++j)
+					{
+						if (hashes[bucketNames[i]] == hashes[bucketNames[j]])
+						{
+							table.valid = false;
+							return table;
+						}
+					}
+				}
+			}
+
+			// Hash and displace: place the largest buckets first, searching for each one a seed sending its names to free slots
+			std::size_t maxBucketSize = 0;
+			for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+				maxBucketSize = std::max(maxBucketSize, bucketOffsets[bucket + 1] - bucketOffsets[bucket]);
+
+			std::array<std::size_t, NameCount> placed{};
+			for (std::size_t bucketSize = maxBucketSize; bucketSize > 0; --bucketSize)
+			{
+				for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+				{
+					std::size_t first = bucketOffsets[bucket];
+					if (bucketOffsets[bucket + 1] - first != bucketSize)
+						continue;
+
+					UInt32 seed = 1;
+					for (;; ++seed)
+					{
+						if (seed > EnumStringMaxSeed)
+						{
+							table.valid = false;
+							return table;
+						}
+
+						std::size_t placedCount = 0;
+						for (; placedCount < bucketSize; ++placedCount)
+						{
+							std::size_t nameIndex = bucketNames[first + placedCount];
+
+							std::size_t slot = EnumStringMix(hashes[nameIndex], seed) & (SlotCount - 1);
+							if (table.slots[slot] != 0)
+								break;
+
+							table.slots[slot] = static_cast<UInt16>(nameIndex + 1);
+							placed[placedCount] = slot;
+						}
+
+						if (placedCount == bucketSize)
+							break;
+
+						// Roll back
+						for (std::size_t i = 0; i < placedCount; ++i)
+							table.slots[placed[i]] = 0;
+					}
+
+					table.bucketSeeds[bucket] = seed;
+				}
+			}
+
+			return table;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Converts a string to the enum value it names
+	* \return The enum value named by str, or std::nullopt if no value has this name
+	*
+	* \param str Name of the enum value
+	*
+	* The names are taken from the EnumNames<E> specialization, from which a perfect hash table is built at compile-time.
+	* A lookup costs one FNV-1a hash of the string and one string comparison, without any allocation nor startup cost.
+	*
+	* \remark Names are case-sensitive
+	*
+	* \see EnumToString
+	*/
+	template<typename E>
+	constexpr std::optional<E> EnumFromString(std::string_view str) noexcept
+	{
+		static_assert(std::is_enum_v<E>, "Type must be an enumeration");
+		static_assert(HasEnumNames_v<E>, "Enum has no name table, specialize EnumNames");
+
+		constexpr auto& names = EnumNames<E>::names;
+		constexpr auto& table = Detail::EnumStringHashTable_v<E>;
+		static_assert(table.valid, "failed to build a perfect hash for enum names, are there duplicate names?");
+
+		constexpr std::size_t BucketCount = std::tuple_size_v<decltype(table.bucketSeeds)>;
+		constexpr std::size_t SlotCount = std::tuple_size_v<decltype(table.slots)>;
+
+		UInt32 hash = FNV1a32(str);
+		UInt32 seed = table.bucketSeeds[Detail::EnumStringMix(hash, 0) & (BucketCount - 1)];
+		UInt16 entry = table.slots[Detail::EnumStringMix(hash, seed) & (SlotCount - 1)];
+		if (entry == 0 || names[entry - 1] != str)
+			return std::nullopt;
+
+		return static_cast<E>(entry - 1);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the name of an enum value
+	* \return The name of value from the EnumNames<E> specialization, or an empty string if value has no name
+	*
+	* \param value Enum value
+	*
+	* \see EnumFromString
+	*/
+	template<typename E>
+	constexpr std::string_view EnumToString(E value) noexcept
+	{
+		static_assert(std::is_enum_v<E>, "Type must be an enumeration");
+		static_assert(HasEnumNames_v<E>, "Enum has no name table, specialize EnumNames");
+
+		constexpr auto& names = EnumNames<E>::names;
+
+		auto index = static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(value);
+		if (index >= std::size(names))
+			return {};
+
+		return names[index];
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_EVENTBUS_HPP
+#define NAZARAUTILS_EVENTBUS_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <NazaraUtils/TypeList.hpp>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename EventList> class EventBus;
+
+	template<typename... Events>
+	class EventBus<TypeList<Events...>>
+	{
+		static_assert(std::is_same_v<TypeListUnique<TypeList<Events...>>, TypeList<Events...>>, "event types must be unique");
+		static_assert((std::is_same_v<Events, std::decay_t<Events>> && ...), "event types must not be references nor cv-qualified");
+
+		public:
+			using EventList = TypeList<Events...>;
+			template<typename E> using Connection = typename Signal<const E&>::Connection;
+			template<typename E> using ConnectionGuard = typename Signal<const E&>::ConnectionGuard;
+
+			EventBus() = default;
+			EventBus(const EventBus&) = default;
+			EventBus(EventBus&&) = default;
+			~EventBus() = default;
+
+			void Clear();
+			template<typename E> void Clear();
+
+			template<typename E, typename... ConnectArgs> Connection<E> Connect(ConnectArgs&&... args);
+
+			template<typename E, typename... Args> void Enqueue(Args&&... args);
+
+			void Flush();
+			template<typename E> void Flush();
+
+			std::size_t GetPendingCount() const;
+			template<typename E> std::size_t GetPendingCount() const;
+			template<typename E> Signal<const E&>& GetSignal();
+			template<typename E> const Signal<const E&>& GetSignal() const;
+
+			template<typename E> void Publish(const E& event) const;
+
+			template<typename E> void Reserve(std::size_t capacity);
+
+			EventBus& operator=(const EventBus&) = default;
+			EventBus& operator=(EventBus&&) = default;
+
+			template<typename E> static constexpr bool Handles();
+
+		private:
+			template<typename E>
+			struct Channel
+			{
+				std::vector<E> flushedEvents; //< Kept to reuse its memory
+				std::vector<E> pendingEvents;
+				Signal<const E&> signal;
+				bool isFlushing = false;
+			};
+
+			template<typename E> Channel<E>& GetChannel();
+			template<typename E> const Channel<E>& GetChannel() const;
+
+			std::tuple<Channel<Events>...> m_channels;
+	};
+}
+
+#include <NazaraUtils/EventBus.inl>
+
+#endif // NAZARAUTILS_EVENTBUS_HPP
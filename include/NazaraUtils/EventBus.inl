@@ -0,0 +1,208 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::EventBus
+	* \brief Dispatches events to handlers by event type, the set of event types being known at compile-time
+	*
+	* Each event type gets its own Signal (storing its handlers contiguously), found at compile-time from the position of the type in the list:
+	* publishing an event costs no lookup, only the handler calls.
+	*
+	* Events can also be queued with Enqueue and delivered in batches by Flush, event types are flushed in the order of the list
+	* (and events of the same type in the order they were queued).
+	*
+	* \code
+	* using Bus = Nz::EventBus<Nz::TypeList<CollisionEvent, DamageEvent>>;
+	*
+	* Bus bus;
+	* auto connection = bus.Connect<DamageEvent>([](const DamageEvent& event) { ... });
+	* bus.Publish(DamageEvent{ 42 });
+	* \endcode
+	*
+	* \remark Events queued while flushing are delivered by the next flush
+	*/
+
+	/*!
+	* \brief Drops every queued event without calling the handlers
+	*/
+	template<typename... Events>
+	void EventBus<TypeList<Events...>>::Clear()
+	{
+		(Clear<Events>(), ...);
+	}
+
+	/*!
+	* \brief Drops queued events of a type without calling the handlers
+	*/
+	template<typename... Events>
+	template<typename E>
+	void EventBus<TypeList<Events...>>::Clear()
+	{
+		GetChannel<E>().pendingEvents.clear();
+	}
+
+	/*!
+	* \brief Connects a handler to an event type
+	* \return Connection attached to the signal of the event type
+	*
+	* \param args Arguments forwarded to Signal::Connect, handlers take a const E&
+	*/
+	template<typename... Events>
+	template<typename E, typename... ConnectArgs>
+	auto EventBus<TypeList<Events...>>::Connect(ConnectArgs&&... args) -> Connection<E>
+	{
+		return GetChannel<E>().signal.Connect(std::forward<ConnectArgs>(args)...);
+	}
+
+	/*!
+	* \brief Queues an event, to be delivered by the next flush
+	*
+	* \param args Arguments used to construct the event
+	*/
+	template<typename... Events>
+	template<typename E, typename... Args>
+	void EventBus<TypeList<Events...>>::Enqueue(Args&&... args)
+	{
+		GetChannel<E>().pendingEvents.emplace_back(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Delivers every queued event, one event type after the other
+	*/
+	template<typename... Events>
+	void EventBus<TypeList<Events...>>::Flush()
+	{
+		(Flush<Events>(), ...);
+	}
+
+	/*!
+	* \brief Delivers queued events of a type, in the order they were queued
+	*
+	* \remark Flushing an event type from one of its handlers does nothing
+	*/
+	template<typename... Events>
+	template<typename E>
+	void EventBus<TypeList<Events...>>::Flush()
+	{
+		Channel<E>& channel = GetChannel<E>();
+		if (channel.isFlushing || channel.pendingEvents.empty())
+			return;
+
+		assert(channel.flushedEvents.empty());
+		std::swap(channel.flushedEvents, channel.pendingEvents);
+
+		channel.isFlushing = true;
+		NAZARA_DEFER(
+		{
+			channel.flushedEvents.clear();
+			channel.isFlushing = false;
+		});
+
+		for (const E& event : channel.flushedEvents)
+			channel.signal(event);
+	}
+
+	/*!
+	* \brief Gets the number of events waiting for the next flush
+	* \return Queued event count, for every event type
+	*/
+	template<typename... Events>
+	std::size_t EventBus<TypeList<Events...>>::GetPendingCount() const
+	{
+		return (GetPendingCount<Events>() + ... + 0);
+	}
+
+	/*!
+	* \brief Gets the number of events of a type waiting for the next flush
+	* \return Queued event count
+	*/
+	template<typename... Events>
+	template<typename E>
+	std::size_t EventBus<TypeList<Events...>>::GetPendingCount() const
+	{
+		return GetChannel<E>().pendingEvents.size();
+	}
+
+	/*!
+	* \brief Gets the signal handling an event type
+	* \return Signal called when an event of this type is published
+	*/
+	template<typename... Events>
+	template<typename E>
+	auto EventBus<TypeList<Events...>>::GetSignal() -> Signal<const E&>&
+	{
+		return GetChannel<E>().signal;
+	}
+
+	/*!
+	* \brief Gets the signal handling an event type
+	* \return Signal called when an event of this type is published
+	*/
+	template<typename... Events>
+	template<typename E>
+	auto EventBus<TypeList<Events...>>::GetSignal() const -> const Signal<const E&>&
+	{
+		return GetChannel<E>().signal;
+	}
+
+	/*!
+	* \brief Calls the handlers of an event type immediately
+	*
+	* \param event Event sent to the handlers
+	*/
+	template<typename... Events>
+	template<typename E>
+	void EventBus<TypeList<Events...>>::Publish(const E& event) const
+	{
+		GetChannel<E>().signal(event);
+	}
+
+	/*!
+	* \brief Allocates memory for a number of queued events of a type, queuing them won't allocate memory afterwards
+	*
+	* \param capacity Number of events to allocate memory for
+	*/
+	template<typename... Events>
+	template<typename E>
+	void EventBus<TypeList<Events...>>::Reserve(std::size_t capacity)
+	{
+		Channel<E>& channel = GetChannel<E>();
+		channel.pendingEvents.reserve(capacity);
+		channel.flushedEvents.reserve(capacity);
+	}
+
+	/*!
+	* \brief Checks if the bus handles an event type
+	* \return True if the event type is part of the event list
+	*/
+	template<typename... Events>
+	template<typename E>
+	constexpr bool EventBus<TypeList<Events...>>::Handles()
+	{
+		return TypeListHas<EventList, E>;
+	}
+
+	template<typename... Events>
+	template<typename E>
+	auto EventBus<TypeList<Events...>>::GetChannel() -> Channel<E>&
+	{
+		static_assert(Handles<E>(), "event type is not part of the event list");
+		return std::get<TypeListFind<EventList, E>>(m_channels);
+	}
+
+	template<typename... Events>
+	template<typename E>
+	auto EventBus<TypeList<Events...>>::GetChannel() const -> const Channel<E>&
+	{
+		static_assert(Handles<E>(), "event type is not part of the event list");
+		return std::get<TypeListFind<EventList, E>>(m_channels);
+	}
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FASTDIVIDER_HPP
+#define NAZARAUTILS_FASTDIVIDER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	// Divides unsigned integers by a runtime-invariant divisor using a precomputed multiplication and shift
+	template<typename T>
+	class FastDivider
+	{
+		static_assert(std::is_unsigned_v<T> && (sizeof(T) == 4 || sizeof(T) == 8), "FastDivider only supports 32 and 64-bit unsigned integers");
+
+		public:
+			constexpr FastDivider(T divisor);
+			constexpr FastDivider(const FastDivider&) = default;
+			constexpr FastDivider(FastDivider&&) noexcept = default;
+			~FastDivider() = default;
+
+			constexpr T Divide(T value) const noexcept;
+			constexpr std::pair<T, T> DivMod(T value) const noexcept;
+
+			constexpr T GetDivisor() const noexcept;
+
+			constexpr T Mod(T value) const noexcept;
+
+			constexpr FastDivider& operator=(const FastDivider&) = default;
+			constexpr FastDivider& operator=(FastDivider&&) noexcept = default;
+
+		private:
+			static constexpr T MultiplyHigh(T x, T y) noexcept;
+
+			T m_divisor;
+			T m_magic;
+			UInt8 m_shift;
+			bool m_addIndicator;
+	};
+}
+
+#include <NazaraUtils/FastDivider.inl>
+
+#endif // NAZARAUTILS_FASTDIVIDER_HPP
@@ -0,0 +1,160 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <cassert>
+
+#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_ARCH_x86_64)
+#include <intrin.h>
+#endif
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::FastDivider
+	* \brief Replaces the division by a runtime-invariant divisor with a multiplication, an addition and shifts
+	*
+	* The magic multiplier is computed once (Granlund & Montgomery, as done by libdivide), which makes FastDivider
+	* worth it when dividing by the same value many times (for example when splitting indices into block and local indices).
+	*/
+
+	/*!
+	* \brief Precomputes the magic multiplier and shift for a divisor
+	*
+	* \param divisor Divisor, must not be zero
+	*/
+	template<typename T>
+	constexpr FastDivider<T>::FastDivider(T divisor) :
+	m_divisor(divisor),
+	m_magic(0),
+	m_shift(0),
+	m_addIndicator(false)
+	{
+		assert(divisor != 0);
+
+		unsigned int log2 = IntegralLog2(divisor);
+		m_shift = static_cast<UInt8>(log2);
+
+		if (IsPow2(divisor))
+			return; //< plain shift, m_magic stays zero
+
+		constexpr unsigned int bitCount = static_cast<unsigned int>(BitCount<T>());
+
+		// Compute floor(2^(bitCount + log2) / divisor) using a long division (the quotient fits in T since 2^log2 < divisor)
+		T quotient = 0;
+		T remainder = T(1) << log2;
+		for (unsigned int i = 0; i < bitCount; ++i)
+		{
+			bool carry = (remainder >> (bitCount - 1)) != 0;
+			remainder <<= 1;
+			quotient <<= 1;
+			if (carry || remainder >= divisor)
+			{
+				remainder -= divisor;
+				quotient |= 1;
+			}
+		}
+
+		T error = divisor - remainder;
+		if (error < (T(1) << log2))
+		{
+			// The magic number fits in T, (value * magic) >> (bitCount + log2) gives the exact quotient
+			m_magic = quotient + 1;
+		}
+		else
+		{
+			// The magic number requires bitCount + 1 bits, its top bit is handled by an extra addition when dividing
+			T doubledRemainder = remainder + remainder;
+			quotient += quotient;
+			if (doubledRemainder >= divisor || doubledRemainder < remainder)
+				quotient += 1;
+
+			m_magic = quotient + 1;
+			m_addIndicator = true;
+		}
+	}
+
+	/*!
+	* \brief Divides a value by the divisor
+	* \return value / divisor
+	*
+	* \param value Dividend
+	*/
+	template<typename T>
+	constexpr T FastDivider<T>::Divide(T value) const noexcept
+	{
+		if (m_magic == 0)
+			return value >> m_shift;
+
+		T quotient = MultiplyHigh(m_magic, value);
+		if (m_addIndicator)
+			return (((value - quotient) >> 1) + quotient) >> m_shift;
+		else
+			return quotient >> m_shift;
+	}
+
+	/*!
+	* \brief Divides a value by the divisor and computes the remainder
+	* \return Pair of (value / divisor, value % divisor)
+	*
+	* \param value Dividend
+	*/
+	template<typename T>
+	constexpr std::pair<T, T> FastDivider<T>::DivMod(T value) const noexcept
+	{
+		T quotient = Divide(value);
+		return { quotient, value - quotient * m_divisor };
+	}
+
+	template<typename T>
+	constexpr T FastDivider<T>::GetDivisor() const noexcept
+	{
+		return m_divisor;
+	}
+
+	/*!
+	* \brief Computes the remainder of the division of a value by the divisor
+	* \return value % divisor
+	*
+	* \param value Dividend
+	*/
+	template<typename T>
+	constexpr T FastDivider<T>::Mod(T value) const noexcept
+	{
+		return value - Divide(value) * m_divisor;
+	}
+
+	template<typename T>
+	constexpr T FastDivider<T>::MultiplyHigh(T x, T y) noexcept
+	{
+		if constexpr (sizeof(T) == 4)
+			return static_cast<T>((static_cast<UInt64>(x) * y) >> 32);
+		else
+		{
+#if defined(__SIZEOF_INT128__)
+			// __extension__ keeps -Wpedantic from warning about __int128
+			return static_cast<T>(__extension__ (static_cast<unsigned __int128>(x) * y) >> 64);
+#else
+	#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_ARCH_x86_64)
+			if NAZARA_IS_RUNTIME_EVAL()
+				return __umulh(x, y);
+	#endif
+
+			UInt64 xLow = x & 0xFFFFFFFF;
+			UInt64 xHigh = x >> 32;
+			UInt64 yLow = y & 0xFFFFFFFF;
+			UInt64 yHigh = y >> 32;
+
+			UInt64 lowLow = xLow * yLow;
+			UInt64 lowHigh = xLow * yHigh;
+			UInt64 highLow = xHigh * yLow;
+			UInt64 highHigh = xHigh * yHigh;
+
+			UInt64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+			return highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+		}
+	}
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FIXEDFUNCTION_HPP
+#define NAZARAUTILS_FIXEDFUNCTION_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity = 4 * sizeof(void*)>
+	class FixedFunction;
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	class FixedFunction<Ret(Args...), Capacity>
+	{
+		public:
+			FixedFunction() noexcept;
+			FixedFunction(std::nullptr_t) noexcept;
+			template<typename F, typename = std::enable_if_t<std::is_invocable_r_v<Ret, std::decay_t<F>&, Args...> && !std::is_same_v<std::decay_t<F>, FixedFunction>>> FixedFunction(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>);
+			FixedFunction(const FixedFunction&) = delete;
+			FixedFunction(FixedFunction&& function) noexcept;
+			~FixedFunction();
+
+			Ret operator()(Args... args) const;
+
+			explicit operator bool() const noexcept;
+
+			FixedFunction& operator=(std::nullptr_t) noexcept;
+			FixedFunction& operator=(const FixedFunction&) = delete;
+			FixedFunction& operator=(FixedFunction&& function) noexcept;
+
+			template<typename F> static constexpr bool CanStore();
+
+			static constexpr std::size_t BufferSize = Capacity;
+			static constexpr std::size_t BufferAlignment = alignof(std::max_align_t);
+
+		private:
+			using Callback = Ret(*)(void* functor, Args... args);
+			using Relocator = void(*)(void* storage, void* source); //< Moves source into storage and destroys it, or destroys storage if source is null
+
+			template<typename F> static Ret Invoke(void* functor, Args... args);
+			template<typename F> static void Relocate(void* storage, void* source);
+
+			void Reset() noexcept;
+
+			mutable std::aligned_storage_t<Capacity, BufferAlignment> m_storage;
+			Callback m_callback;
+			Relocator m_relocator;
+	};
+}
+
+#include <NazaraUtils/FixedFunction.inl>
+
+#endif // NAZARAUTILS_FIXEDFUNCTION_HPP
@@ -0,0 +1,187 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::FixedFunction
+	* \brief Owning, move-only type-erased callable which never allocates memory
+	*
+	* The callable is constructed in an internal buffer of Capacity bytes and called through a single function pointer, like FunctionRef does.
+	* Storing a callable which doesn't fit in the buffer (or isn't nothrow move-constructible) is a compile-time error, which makes this class
+	* suitable for task queues and callbacks which must never touch the heap. Move-only callables (such as lambdas capturing a std::unique_ptr) are supported.
+	*
+	* Trivially copyable callables (function pointers, lambdas capturing pointers or integers) have no relocation function, moving them is a buffer copy.
+	*
+	* \remark InplaceFunction is the copyable counterpart, falling back to the heap for big callables
+	*/
+
+	/*!
+	* \brief Constructs an empty FixedFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	FixedFunction<Ret(Args...), Capacity>::FixedFunction() noexcept :
+	m_callback(nullptr),
+	m_relocator(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty FixedFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	FixedFunction<Ret(Args...), Capacity>::FixedFunction(std::nullptr_t) noexcept :
+	FixedFunction()
+	{
+	}
+
+	/*!
+	* \brief Constructs a FixedFunction storing a callable in its buffer
+	*
+	* \param f Callable to store, null function and member pointers result in an empty FixedFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F, typename>
+	FixedFunction<Ret(Args...), Capacity>::FixedFunction(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>) :
+	FixedFunction()
+	{
+		using Functor = std::decay_t<F>;
+		static_assert(sizeof(Functor) <= Capacity, "callable doesn't fit in the FixedFunction buffer, increase its capacity");
+		static_assert(alignof(Functor) <= BufferAlignment, "callable alignment is too strict for the FixedFunction buffer");
+		static_assert(std::is_nothrow_move_constructible_v<Functor>, "callable must be nothrow move-constructible");
+
+		// function references decay to pointers but can't be null
+		if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<Functor>)
+		{
+			if (f == nullptr)
+				return;
+		}
+
+		new (&m_storage) Functor(std::forward<F>(f));
+
+		m_callback = &Invoke<Functor>;
+		if constexpr (!std::is_trivially_copyable_v<Functor>)
+			m_relocator = &Relocate<Functor>;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	FixedFunction<Ret(Args...), Capacity>::FixedFunction(FixedFunction&& function) noexcept :
+	FixedFunction()
+	{
+		operator=(std::move(function));
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	FixedFunction<Ret(Args...), Capacity>::~FixedFunction()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Calls the stored callable
+	* \return Value returned by the callable
+	*
+	* \param args Arguments passed to the callable
+	*
+	* \remark The FixedFunction must not be empty
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	Ret FixedFunction<Ret(Args...), Capacity>::operator()(Args... args) const
+	{
+		assert(m_callback && "calling an empty FixedFunction");
+		return m_callback(&m_storage, std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Checks if the FixedFunction stores a callable
+	* \return True if a callable is stored
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	FixedFunction<Ret(Args...), Capacity>::operator bool() const noexcept
+	{
+		return m_callback != nullptr;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto FixedFunction<Ret(Args...), Capacity>::operator=(std::nullptr_t) noexcept -> FixedFunction&
+	{
+		Reset();
+		return *this;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto FixedFunction<Ret(Args...), Capacity>::operator=(FixedFunction&& function) noexcept -> FixedFunction&
+	{
+		if (this != &function)
+		{
+			Reset();
+
+			if (function.m_callback)
+			{
+				if (function.m_relocator)
+					function.m_relocator(&m_storage, &function.m_storage);
+				else
+					std::memcpy(&m_storage, &function.m_storage, Capacity);
+
+				m_callback = std::exchange(function.m_callback, nullptr);
+				m_relocator = std::exchange(function.m_relocator, nullptr);
+			}
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Checks if a callable type can be stored in the buffer
+	* \return True if a callable of type F fits in the buffer and is nothrow move-constructible
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	constexpr bool FixedFunction<Ret(Args...), Capacity>::CanStore()
+	{
+		using Functor = std::decay_t<F>;
+		return sizeof(Functor) <= Capacity && alignof(Functor) <= BufferAlignment && std::is_nothrow_move_constructible_v<Functor>;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	Ret FixedFunction<Ret(Args...), Capacity>::Invoke(void* functor, Args... args)
+	{
+		if constexpr (std::is_void_v<Ret>)
+			std::invoke(*std::launder(static_cast<F*>(functor)), std::forward<Args>(args)...);
+		else
+			return std::invoke(*std::launder(static_cast<F*>(functor)), std::forward<Args>(args)...);
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	void FixedFunction<Ret(Args...), Capacity>::Relocate(void* storage, void* source)
+	{
+		if (source)
+		{
+			F* sourceFunctor = std::launder(static_cast<F*>(source));
+			new (storage) F(std::move(*sourceFunctor));
+			sourceFunctor->~F();
+		}
+		else
+			std::launder(static_cast<F*>(storage))->~F();
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	void FixedFunction<Ret(Args...), Capacity>::Reset() noexcept
+	{
+		if (m_relocator)
+			m_relocator(&m_storage, nullptr);
+
+		m_callback = nullptr;
+		m_relocator = nullptr;
+	}
+}
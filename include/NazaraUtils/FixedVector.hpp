@@ -37,6 +37,9 @@ namespace Nz
 			constexpr FixedVector(FixedVector&& vec) noexcept;
 			~FixedVector();
 
+			template<typename InputIt>
+			constexpr iterator append(InputIt first, InputIt last);
+
 			constexpr reference back();
 			constexpr const_reference back() const;
 
@@ -74,6 +77,8 @@ namespace Nz
 
 			constexpr iterator insert(const_iterator pos, const T& value);
 			constexpr iterator insert(const_iterator pos, T&& value);
+			template<typename InputIt>
+			constexpr iterator insert(const_iterator pos, InputIt first, InputIt last);
 
 			constexpr size_type max_size() const noexcept;
 
@@ -84,6 +89,8 @@ namespace Nz
 
 			constexpr void resize(size_type count);
 			constexpr void resize(size_type count, const value_type& value);
+			constexpr void resize_default_init(size_type count);
+			constexpr void resize_uninitialized(size_type count);
 
 			constexpr reverse_iterator rbegin() noexcept;
 			constexpr const_reverse_iterator rbegin() const noexcept;
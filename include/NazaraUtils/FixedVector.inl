@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <memory>
 #include <new>
 #include <utility>
 
@@ -13,6 +15,8 @@ namespace Nz
 	* \ingroup utils
 	* \class FixedVector
 	* \brief Core class that represents an inplace vector with a compile-time capacity (and thus no allocation required)
+	*
+	* \remark Trivially copyable types are copied using memcpy, trivially relocatable types (see IsTriviallyRelocatable) are inserted and erased using memmove
 	*/
 
 	template<typename T, std::size_t Capacity>
@@ -32,16 +36,32 @@ namespace Nz
 	constexpr FixedVector<T, Capacity>::FixedVector(const FixedVector& vec) :
 	FixedVector()
 	{
-		for (size_type i = 0; i < vec.size(); ++i)
-			push_back(vec[i]);
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memcpy(&m_data[0], &vec.m_data[0], vec.m_size * sizeof(T));
+			m_size = vec.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < vec.size(); ++i)
+				push_back(vec[i]);
+		}
 	}
 
 	template<typename T, std::size_t Capacity>
 	constexpr FixedVector<T, Capacity>::FixedVector(FixedVector&& vec) noexcept :
 	FixedVector()
 	{
-		for (size_type i = 0; i < vec.size(); ++i)
-			push_back(std::move(vec[i]));
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memcpy(&m_data[0], &vec.m_data[0], vec.m_size * sizeof(T));
+			m_size = vec.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < vec.size(); ++i)
+				push_back(std::move(vec[i]));
+		}
 	}
 
 	template<typename T, std::size_t Capacity>
@@ -50,6 +70,37 @@ namespace Nz
 		clear();
 	}
 
+	/*!
+	* \brief Appends a range of elements at the end of the vector
+	* \return Iterator to the first appended element
+	*
+	* \param first Iterator to the first element to append
+	* \param last Iterator past the last element to append
+	*
+	* \remark With forward iterators, this checks capacity once and copies the range in bulk
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	constexpr auto FixedVector<T, Capacity>::append(InputIt first, InputIt last) -> iterator
+	{
+		std::size_t index = m_size;
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			assert(m_size + count <= Capacity);
+
+			std::uninitialized_copy(first, last, data(m_size));
+			m_size += count;
+		}
+		else
+		{
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+
+		return iterator(data(index));
+	}
+
 	template<typename T, std::size_t Capacity>
 	constexpr auto FixedVector<T, Capacity>::back() -> reference
 	{
@@ -80,8 +131,11 @@ namespace Nz
 	constexpr void FixedVector<T, Capacity>::clear() noexcept
 	{
 		// can't use resize(0); since it will try to instantiate the default-construction part (which won't compile for classes having no default constructor)
-		for (std::size_t i = 0; i < m_size; ++i)
-			PlacementDestroy(data(i));
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (std::size_t i = 0; i < m_size; ++i)
+				PlacementDestroy(data(i));
+		}
 
 		m_size = 0;
 	}
@@ -142,7 +196,20 @@ namespace Nz
 		assert(pos >= begin() && pos <= end());
 
 		std::size_t index = std::distance(cbegin(), pos);
-		if (pos < end())
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			if (index < m_size)
+			{
+				// args may reference an element we're about to relocate
+				T value(std::forward<Args>(args)...);
+
+				RelocateRange(data(index), data(index + 1), m_size - index);
+				m_size++;
+
+				return PlacementNew(data(index), std::move(value));
+			}
+		}
+		else if (pos < end())
 		{
 			iterator lastElement = end() - 1;
 			PlacementNew(data(m_size), std::move(*lastElement));
@@ -188,8 +255,17 @@ namespace Nz
 	{
 		assert(pos < end());
 		std::size_t index = std::distance(cbegin(), pos);
-		std::move(begin() + index + 1, end(), begin() + index);
-		pop_back();
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			PlacementDestroy(data(index));
+			RelocateRange(data(index + 1), data(index), m_size - index - 1);
+			m_size--;
+		}
+		else
+		{
+			std::move(begin() + index + 1, end(), begin() + index);
+			pop_back();
+		}
 
 		return iterator(data(index));
 	}
@@ -207,8 +283,17 @@ namespace Nz
 
 		std::size_t count = std::distance(first, last);
 
-		std::move(begin() + index + count, end(), begin() + index);
-		resize(size() - count);
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			std::destroy(data(index), data(index + count));
+			RelocateRange(data(index + count), data(index), m_size - index - count);
+			m_size -= count;
+		}
+		else
+		{
+			std::move(begin() + index + count, end(), begin() + index);
+			resize(size() - count);
+		}
 
 		return iterator(data(index));
 	}
@@ -239,6 +324,43 @@ namespace Nz
 		return emplace(pos, std::move(value));
 	}
 
+	/*!
+	* \brief Inserts a range of elements before pos
+	* \return Iterator to the first inserted element
+	*
+	* \param pos Iterator before which the elements are inserted
+	* \param first Iterator to the first element to insert
+	* \param last Iterator past the last element to insert
+	*
+	* \remark The range must not be part of the vector
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	constexpr auto FixedVector<T, Capacity>::insert(const_iterator pos, InputIt first, InputIt last) -> iterator
+	{
+		assert(pos >= begin() && pos <= end());
+
+		std::size_t index = std::distance(cbegin(), pos);
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			assert(m_size + count <= Capacity);
+
+			RelocateRange(data(index), data(index + count), m_size - index);
+
+			std::uninitialized_copy(first, last, data(index));
+			m_size += count;
+		}
+		else
+		{
+			std::size_t oldSize = m_size;
+			append(first, last);
+			std::rotate(begin() + index, begin() + oldSize, end());
+		}
+
+		return iterator(data(index));
+	}
+
 	template<typename T, std::size_t Capacity>
 	constexpr auto FixedVector<T, Capacity>::max_size() const noexcept -> size_type
 	{
@@ -279,8 +401,11 @@ namespace Nz
 		}
 		else if (count < m_size)
 		{
-			for (std::size_t i = count; i < m_size; ++i)
-				PlacementDestroy(data(i));
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(data(i));
+			}
 
 			m_size = count;
 		}
@@ -299,13 +424,65 @@ namespace Nz
 		}
 		else if (count < m_size)
 		{
-			for (std::size_t i = count; i < m_size; ++i)
-				PlacementDestroy(data(i));
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(data(i));
+			}
 
 			m_size = count;
 		}
 	}
 
+	/*!
+	* \brief Resizes the vector, default-initializing new elements
+	*
+	* \param count New size of the vector
+	*
+	* \remark Unlike resize, this leaves new elements of trivial types uninitialized (useful for buffers which are about to be filled)
+	*/
+	template<typename T, std::size_t Capacity>
+	constexpr void FixedVector<T, Capacity>::resize_default_init(size_type count)
+	{
+		assert(count <= Capacity);
+		if (count > m_size)
+		{
+			if constexpr (!std::is_trivially_default_constructible_v<T>)
+			{
+				for (std::size_t i = m_size; i < count; ++i)
+					::new (static_cast<void*>(data(i))) T;
+			}
+
+			m_size = count;
+		}
+		else if (count < m_size)
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(data(i));
+			}
+
+			m_size = count;
+		}
+	}
+
+	/*!
+	* \brief Resizes the vector without initializing new elements, which must be written before being read
+	*
+	* \param count New size of the vector
+	*
+	* \remark T must be a trivial type
+	*/
+	template<typename T, std::size_t Capacity>
+	constexpr void FixedVector<T, Capacity>::resize_uninitialized(size_type count)
+	{
+		static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>, "resize_uninitialized requires a trivial type");
+
+		assert(count <= Capacity);
+		m_size = count;
+	}
+
 	template<typename T, std::size_t Capacity>
 	constexpr auto FixedVector<T, Capacity>::rbegin() noexcept -> reverse_iterator
 	{
@@ -353,9 +530,20 @@ namespace Nz
 	template<typename T, std::size_t Capacity>
 	constexpr auto FixedVector<T, Capacity>::operator=(const FixedVector& vec) -> FixedVector&
 	{
+		if (this == &vec)
+			return *this;
+
 		clear();
-		for (size_type i = 0; i < vec.size(); ++i)
-			push_back(vec[i]);
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memcpy(&m_data[0], &vec.m_data[0], vec.m_size * sizeof(T));
+			m_size = vec.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < vec.size(); ++i)
+				push_back(vec[i]);
+		}
 
 		return *this;
 	}
@@ -363,9 +551,20 @@ namespace Nz
 	template<typename T, std::size_t Capacity>
 	constexpr auto FixedVector<T, Capacity>::operator=(FixedVector&& vec) noexcept -> FixedVector&
 	{
+		if (this == &vec)
+			return *this;
+
 		clear();
-		for (size_type i = 0; i < vec.size(); ++i)
-			push_back(std::move(vec[i]));
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			std::memcpy(&m_data[0], &vec.m_data[0], vec.m_size * sizeof(T));
+			m_size = vec.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < vec.size(); ++i)
+				push_back(std::move(vec[i]));
+		}
 
 		return *this;
 	}
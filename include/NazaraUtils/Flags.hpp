@@ -9,6 +9,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/StaticBitset.hpp>
 #include <iterator>
 #include <type_traits>
 
@@ -33,6 +34,11 @@ namespace Nz
 	template<typename T>
 	struct GetEnumAutoFlag<T, std::void_t<decltype(T::AutoFlag)>> : std::bool_constant<T::AutoFlag> {};
 
+	namespace Detail
+	{
+		template<typename BitField, std::size_t MaxValue> constexpr BitField FlagsValueMask();
+	}
+
 	template<typename E>
 	class Flags
 	{
@@ -45,20 +51,28 @@ namespace Nz
 
 		using BitField16 = std::conditional_t<(MaxValue >= 8), UInt16, UInt8>;
 		using BitField32 = std::conditional_t<(MaxValue >= 16), UInt32, BitField16>;
+		using BitField64 = std::conditional_t<(MaxValue >= 32), UInt64, BitField32>;
 
 		public:
 			class iterator;
 			friend iterator;
 
-			using BitField = std::conditional_t<(MaxValue >= 32), UInt64, BitField32>;
+			// Enums with more than 64 values use an inline array of 64-bit words instead of a single integer
+			static constexpr bool IsMultiWord = (MaxValue >= 64);
 
-			constexpr Flags(BitField value = 0);
+			using BitField = std::conditional_t<IsMultiWord, StaticBitset<MaxValue + 1, UInt64>, BitField64>;
+
+			static_assert(AutoFlag || !IsMultiWord, "enums with more than 64 values must use AutoFlag");
+
+			constexpr Flags(BitField value = BitField());
 			constexpr Flags(E enumVal);
 
 			constexpr void Clear();
 			constexpr void Clear(const Flags& flags);
 			std::size_t Count() const;
 
+			constexpr const BitField& GetBitField() const;
+
 			constexpr void Set(const Flags& flags);
 
 			constexpr bool Test(const Flags& flags) const;
@@ -84,7 +98,7 @@ namespace Nz
 
 			static constexpr BitField GetFlagValue(E enumValue);
 
-			static constexpr BitField ValueMask = BitField((UInt64(1) << (MaxValue + 1)) - 1);
+			static constexpr BitField ValueMask = Detail::FlagsValueMask<BitField, MaxValue>();
 
 		private:
 			BitField m_value;
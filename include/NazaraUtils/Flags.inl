@@ -7,10 +7,25 @@
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename BitField, std::size_t MaxValue>
+		constexpr BitField FlagsValueMask()
+		{
+			if constexpr (std::is_integral_v<BitField>)
+				return BitField(~UInt64(0) >> (63 - MaxValue));
+			else
+				return ~BitField();
+		}
+	}
+
 	/*!
 	* \ingroup utils
 	* \class Nz::Flags
 	* \brief Core class used to combine enumeration values into flags bitfield
+	*
+	* Flags are stored in the smallest unsigned integer able to hold them, or in a StaticBitset of 64-bit words
+	* for enums with more than 64 values, which keeps every operation constexpr and allocation-free.
 	*/
 
 	/*!
@@ -47,7 +62,7 @@ namespace Nz
 	template<typename E>
 	constexpr void Flags<E>::Clear()
 	{
-		m_value = 0;
+		m_value = BitField();
 	}
 
 	/*!
@@ -66,7 +81,20 @@ namespace Nz
 	template<typename E>
 	std::size_t Flags<E>::Count() const
 	{
-		return CountBits(m_value);
+		if constexpr (IsMultiWord)
+			return m_value.Count();
+		else
+			return CountBits(m_value);
+	}
+
+	/*!
+	* \brief Returns the underlying bitfield
+	* \return Integer holding the flags, or a StaticBitset for enums with more than 64 values
+	*/
+	template<typename E>
+	constexpr auto Flags<E>::GetBitField() const -> const BitField&
+	{
+		return m_value;
 	}
 
 	/*!
@@ -104,7 +132,7 @@ namespace Nz
 	template<typename E>
 	constexpr auto Flags<E>::end() const -> iterator
 	{
-		return iterator{ 0 };
+		return iterator{ BitField() };
 	}
 
 	template<typename E>
@@ -122,7 +150,10 @@ namespace Nz
 	template<typename E>
 	constexpr Flags<E>::operator bool() const
 	{
-		return m_value != 0;
+		if constexpr (IsMultiWord)
+			return m_value.TestAny();
+		else
+			return m_value != 0;
 	}
 
 	/*!
@@ -282,8 +313,15 @@ namespace Nz
 	template<typename E>
 	constexpr typename Flags<E>::BitField Flags<E>::GetFlagValue(E enumValue)
 	{
-		if constexpr (AutoFlag)
-			return 1U << static_cast<BitField>(enumValue);
+		if constexpr (IsMultiWord)
+		{
+			BitField bitField;
+			bitField.Set(static_cast<std::size_t>(enumValue));
+
+			return bitField;
+		}
+		else if constexpr (AutoFlag)
+			return BitField(1) << static_cast<BitField>(enumValue);
 		else
 			return enumValue;
 	}
@@ -306,9 +344,19 @@ namespace Nz
 	template<typename T>
 	auto Flags<T>::iterator::operator++() -> iterator&
 	{
-		unsigned int bitIndex = FindFirstBit(m_remainingFlags);
-		assert(bitIndex != 0);
-		m_remainingFlags = ClearBit(m_remainingFlags, static_cast<BitField>(bitIndex - 1));
+		if constexpr (IsMultiWord)
+		{
+			std::size_t bitIndex = m_remainingFlags.FindFirst();
+			assert(bitIndex != BitField::npos);
+			m_remainingFlags.Reset(bitIndex);
+		}
+		else
+		{
+			unsigned int bitIndex = FindFirstBit(m_remainingFlags);
+			assert(bitIndex != 0);
+			m_remainingFlags = ClearBit(m_remainingFlags, static_cast<BitField>(bitIndex - 1));
+		}
+
 		return *this;
 	}
 
@@ -327,9 +375,18 @@ namespace Nz
 	template<typename T>
 	auto Flags<T>::iterator::operator*() const -> value_type
 	{
-		unsigned int bitIndex = FindFirstBit(m_remainingFlags);
-		assert(bitIndex != 0);
-		return static_cast<T>(bitIndex - 1);
+		if constexpr (IsMultiWord)
+		{
+			std::size_t bitIndex = m_remainingFlags.FindFirst();
+			assert(bitIndex != BitField::npos);
+			return static_cast<T>(bitIndex);
+		}
+		else
+		{
+			unsigned int bitIndex = FindFirstBit(m_remainingFlags);
+			assert(bitIndex != 0);
+			return static_cast<T>(bitIndex - 1);
+		}
 	}
 
 	/*!
@@ -451,9 +508,23 @@ namespace std
 		std::size_t operator()(const Nz::Flags<E>& flags)
 		{
 			using UnderlyingType = typename Nz::Flags<E>::BitField;
-			using Hasher = hash<UnderlyingType>;
-			Hasher hasher;
-			return hasher(static_cast<UnderlyingType>(flags));
+			if constexpr (Nz::Flags<E>::IsMultiWord)
+			{
+				hash<Nz::UInt64> hasher;
+
+				const UnderlyingType& bitField = flags.GetBitField();
+				std::size_t seed = 0;
+				for (std::size_t i = 0; i < bitField.GetBlockCount(); ++i)
+					seed ^= hasher(bitField.GetBlock(i)) + 0x9E3779B9 + (seed << 6) + (seed >> 2);
+
+				return seed;
+			}
+			else
+			{
+				using Hasher = hash<UnderlyingType>;
+				Hasher hasher;
+				return hasher(static_cast<UnderlyingType>(flags));
+			}
 		}
 	};
 }
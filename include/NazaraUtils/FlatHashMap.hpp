@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FLATHASHMAP_HPP
+#define NAZARAUTILS_FLATHASHMAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FlatHashTable.hpp>
+#include <functional>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename Key, typename T>
+		struct FlatHashMapPolicy
+		{
+			using key_type = Key;
+			using value_type = std::pair<Key, T>;
+
+			static const Key& GetKey(const value_type& value) { return value.first; }
+		};
+	}
+
+	template<typename Key, typename T, typename Hash = FastHash<Key>, typename KeyEqual = std::equal_to<>>
+	class FlatHashMap : public Detail::FlatHashTable<Detail::FlatHashMapPolicy<Key, T>, Hash, KeyEqual>
+	{
+		using Base = Detail::FlatHashTable<Detail::FlatHashMapPolicy<Key, T>, Hash, KeyEqual>;
+		template<typename K> using KeyArg = typename Base::template KeyArg<K>;
+
+		public:
+			using typename Base::const_iterator;
+			using typename Base::iterator;
+			using typename Base::key_type;
+			using typename Base::value_type;
+			using mapped_type = T;
+
+			using Base::Base;
+			FlatHashMap() = default;
+			FlatHashMap(const FlatHashMap&) = default;
+			FlatHashMap(FlatHashMap&&) noexcept = default;
+			~FlatHashMap() = default;
+
+			template<typename K = key_type> T& at(const KeyArg<K>& key);
+			template<typename K = key_type> const T& at(const KeyArg<K>& key) const;
+
+			template<typename M> std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value);
+			template<typename M> std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value);
+
+			template<typename... Args> std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+			template<typename... Args> std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
+
+			FlatHashMap& operator=(const FlatHashMap&) = default;
+			FlatHashMap& operator=(FlatHashMap&&) noexcept = default;
+
+			T& operator[](const key_type& key);
+			T& operator[](key_type&& key);
+	};
+}
+
+#include <NazaraUtils/FlatHashMap.inl>
+
+#endif // NAZARAUTILS_FLATHASHMAP_HPP
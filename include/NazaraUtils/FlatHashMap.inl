@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <stdexcept>
+#include <tuple>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::FlatHashMap
+	* \brief Open-addressing hash map storing its elements in a single array (SwissTable design), much faster than std::unordered_map
+	*
+	* \tparam Key Key type
+	* \tparam T Mapped type
+	* \tparam Hash Hasher, defaults to FastHash (heterogeneous lookup is enabled when both Hash and KeyEqual are transparent)
+	* \tparam KeyEqual Key comparator
+	*
+	* \remark Unlike std::unordered_map, elements are moved when the map grows, references and iterators are invalidated by insertions
+	* \remark Keys are stored as non-const (to be moved on rehash) but must not be modified through iterators
+	*
+	* \see Detail::FlatHashTable
+	*/
+
+	/*!
+	* \brief Returns the value associated with a key, throwing if it doesn't exist
+	* \return Reference to the value
+	*
+	* \param key Key of the element
+	*
+	* \throw std::out_of_range if the map doesn't contain the key
+	*/
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename K>
+	T& FlatHashMap<Key, T, Hash, KeyEqual>::at(const KeyArg<K>& key)
+	{
+		auto it = this->find(key);
+		if (it == this->end())
+			throw std::out_of_range("key not found");
+
+		return it->second;
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename K>
+	const T& FlatHashMap<Key, T, Hash, KeyEqual>::at(const KeyArg<K>& key) const
+	{
+		auto it = this->find(key);
+		if (it == this->end())
+			throw std::out_of_range("key not found");
+
+		return it->second;
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename M>
+	auto FlatHashMap<Key, T, Hash, KeyEqual>::insert_or_assign(const key_type& key, M&& value) -> std::pair<iterator, bool>
+	{
+		auto location = this->FindOrPrepareInsert(key);
+		if (location.found)
+		{
+			iterator it = this->MakeIterator(location.index);
+			it->second = std::forward<M>(value);
+			return { it, false };
+		}
+
+		this->InsertAt(location, key, std::forward<M>(value));
+		return { this->MakeIterator(location.index), true };
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename M>
+	auto FlatHashMap<Key, T, Hash, KeyEqual>::insert_or_assign(key_type&& key, M&& value) -> std::pair<iterator, bool>
+	{
+		auto location = this->FindOrPrepareInsert(key);
+		if (location.found)
+		{
+			iterator it = this->MakeIterator(location.index);
+			it->second = std::forward<M>(value);
+			return { it, false };
+		}
+
+		this->InsertAt(location, std::move(key), std::forward<M>(value));
+		return { this->MakeIterator(location.index), true };
+	}
+
+	/*!
+	* \brief Constructs a value in-place if the key doesn't exist
+	* \return Iterator to the element with the key and a boolean telling if the element was inserted
+	*
+	* \param key Key of the element
+	* \param args Arguments used to construct the value, which are not used if the key already exists
+	*/
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename... Args>
+	auto FlatHashMap<Key, T, Hash, KeyEqual>::try_emplace(const key_type& key, Args&&... args) -> std::pair<iterator, bool>
+	{
+		auto location = this->FindOrPrepareInsert(key);
+		if (!location.found)
+			this->InsertAt(location, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+
+		return { this->MakeIterator(location.index), !location.found };
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	template<typename... Args>
+	auto FlatHashMap<Key, T, Hash, KeyEqual>::try_emplace(key_type&& key, Args&&... args) -> std::pair<iterator, bool>
+	{
+		auto location = this->FindOrPrepareInsert(key);
+		if (!location.found)
+			this->InsertAt(location, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+		return { this->MakeIterator(location.index), !location.found };
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	T& FlatHashMap<Key, T, Hash, KeyEqual>::operator[](const key_type& key)
+	{
+		return try_emplace(key).first->second;
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	T& FlatHashMap<Key, T, Hash, KeyEqual>::operator[](key_type&& key)
+	{
+		return try_emplace(std::move(key)).first->second;
+	}
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FLATHASHSET_HPP
+#define NAZARAUTILS_FLATHASHSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FlatHashTable.hpp>
+#include <functional>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename Key>
+		struct FlatHashSetPolicy
+		{
+			using key_type = Key;
+			using value_type = Key;
+
+			static const Key& GetKey(const value_type& value) { return value; }
+		};
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::FlatHashSet
+	* \brief Open-addressing hash set storing its elements in a single array (SwissTable design), much faster than std::unordered_set
+	*
+	* \tparam Key Element type
+	* \tparam Hash Hasher, defaults to FastHash (heterogeneous lookup is enabled when both Hash and KeyEqual are transparent)
+	* \tparam KeyEqual Element comparator
+	*
+	* \remark Unlike std::unordered_set, elements are moved when the set grows, references and iterators are invalidated by insertions
+	*
+	* \see Detail::FlatHashTable
+	*/
+	template<typename Key, typename Hash = FastHash<Key>, typename KeyEqual = std::equal_to<>>
+	class FlatHashSet : public Detail::FlatHashTable<Detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>
+	{
+		using Base = Detail::FlatHashTable<Detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>;
+
+		public:
+			using Base::Base;
+	};
+}
+
+#endif // NAZARAUTILS_FLATHASHSET_HPP
@@ -0,0 +1,296 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FLATHASHTABLE_HPP
+#define NAZARAUTILS_FLATHASHTABLE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/TypeTraits.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if !defined(NAZARA_FLATHASH_NO_SIMD)
+	#if defined(NAZARA_ARCH_x86_64) || (defined(NAZARA_ARCH_x86) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+		#define NAZARA_FLATHASH_SSE2
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_FLATHASH_NEON
+	#endif
+#endif
+
+#if defined(NAZARA_FLATHASH_SSE2)
+	#include <emmintrin.h>
+#elif defined(NAZARA_FLATHASH_NEON)
+	#include <arm_neon.h>
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Control byte of a slot: empty, deleted (tombstone) or full (holding the 7 lower bits of the hash)
+		enum class FlatHashCtrl : Int8
+		{
+			Deleted = -2,
+			Empty = -128
+		};
+
+		// Set of slots matching a condition in a group, iterable as indices
+		template<typename T, unsigned int Shift>
+		class FlatHashBitMask
+		{
+			public:
+				class Iterator
+				{
+					public:
+						explicit Iterator(T mask) : m_mask(mask) {}
+
+						unsigned int operator*() const { return FlatHashBitMask(m_mask).GetLowestIndex(); }
+						Iterator& operator++() { m_mask &= m_mask - 1; return *this; }
+						bool operator!=(const Iterator& other) const { return m_mask != other.m_mask; }
+
+					private:
+						T m_mask;
+				};
+
+				explicit FlatHashBitMask(T mask) : m_mask(mask) {}
+
+				Iterator begin() const { return Iterator(m_mask); }
+				Iterator end() const { return Iterator(0); }
+
+				unsigned int GetLeadingZeros(unsigned int width) const;
+				unsigned int GetLowestIndex() const;
+				unsigned int GetTrailingZeros() const;
+
+				explicit operator bool() const { return m_mask != 0; }
+
+			private:
+				T m_mask;
+		};
+
+		// Groups of control bytes, matched at once using SIMD when available
+		class FlatHashGroup
+		{
+			public:
+#if defined(NAZARA_FLATHASH_NEON)
+				using BitMask = FlatHashBitMask<UInt64, 2>;
+#else
+				using BitMask = FlatHashBitMask<UInt32, 0>;
+#endif
+
+				inline explicit FlatHashGroup(const Int8* ctrl);
+
+				inline BitMask Match(Int8 h2) const;
+				inline BitMask MatchEmpty() const;
+				inline BitMask MatchEmptyOrDeleted() const;
+				inline BitMask MatchFull() const;
+
+				static constexpr std::size_t Width = 16;
+
+			private:
+#if defined(NAZARA_FLATHASH_NEON)
+				static inline BitMask ToBitMask(uint8x16_t comparison);
+#endif
+
+#if defined(NAZARA_FLATHASH_SSE2)
+				__m128i m_ctrl;
+#elif defined(NAZARA_FLATHASH_NEON)
+				int8x16_t m_ctrl;
+#else
+				const Int8* m_ctrl;
+#endif
+		};
+
+		template<bool Transparent>
+		struct FlatHashKeyArg
+		{
+			template<typename K, typename Key> using Type = K;
+		};
+
+		template<>
+		struct FlatHashKeyArg<false>
+		{
+			template<typename K, typename Key> using Type = Key;
+		};
+
+		template<typename T, typename = void>
+		struct IsTransparent : std::false_type {};
+
+		template<typename T>
+		struct IsTransparent<T, LazyVoid_t<typename T::is_transparent>> : std::true_type {};
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		class FlatHashTable
+		{
+			template<bool Const> class Iterator;
+
+			public:
+				using key_type = typename Policy::key_type;
+				using value_type = typename Policy::value_type;
+				using size_type = std::size_t;
+				using difference_type = std::ptrdiff_t;
+				using hasher = Hash;
+				using key_equal = KeyEqual;
+				using reference = value_type&;
+				using const_reference = const value_type&;
+				using pointer = value_type*;
+				using const_pointer = const value_type*;
+				using iterator = Iterator<false>;
+				using const_iterator = Iterator<true>;
+
+			protected:
+				template<typename K> using KeyArg = typename FlatHashKeyArg<IsTransparent<Hash>::value && IsTransparent<KeyEqual>::value>::template Type<K, key_type>;
+
+			public:
+				FlatHashTable() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_default_constructible_v<KeyEqual>);
+				explicit FlatHashTable(size_type bucketCount, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual());
+				template<typename InputIt> FlatHashTable(InputIt first, InputIt last, size_type bucketCount = 0, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual());
+				FlatHashTable(std::initializer_list<value_type> values, size_type bucketCount = 0, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual());
+				FlatHashTable(const FlatHashTable& table);
+				FlatHashTable(FlatHashTable&& table) noexcept;
+				~FlatHashTable();
+
+				iterator begin() noexcept;
+				const_iterator begin() const noexcept;
+
+				size_type capacity() const noexcept;
+
+				const_iterator cbegin() const noexcept;
+				const_iterator cend() const noexcept;
+
+				void clear() noexcept;
+
+				template<typename K = key_type> bool contains(const KeyArg<K>& key) const;
+
+				template<typename K = key_type> size_type count(const KeyArg<K>& key) const;
+
+				template<typename... Args> std::pair<iterator, bool> emplace(Args&&... args);
+
+				bool empty() const noexcept;
+
+				iterator end() noexcept;
+				const_iterator end() const noexcept;
+
+				iterator erase(iterator pos);
+				iterator erase(const_iterator pos);
+				iterator erase(const_iterator first, const_iterator last);
+				template<typename K = key_type> size_type erase(const KeyArg<K>& key);
+
+				template<typename K = key_type> iterator find(const KeyArg<K>& key);
+				template<typename K = key_type> const_iterator find(const KeyArg<K>& key) const;
+
+				hasher hash_function() const;
+
+				std::pair<iterator, bool> insert(const value_type& value);
+				std::pair<iterator, bool> insert(value_type&& value);
+				template<typename InputIt> void insert(InputIt first, InputIt last);
+				void insert(std::initializer_list<value_type> values);
+
+				key_equal key_eq() const;
+
+				float load_factor() const noexcept;
+
+				size_type max_size() const noexcept;
+
+				void rehash(size_type count);
+				void reserve(size_type count);
+
+				size_type size() const noexcept;
+
+				void swap(FlatHashTable& table) noexcept;
+
+				FlatHashTable& operator=(const FlatHashTable& table);
+				FlatHashTable& operator=(FlatHashTable&& table) noexcept;
+
+				static constexpr float max_load_factor() noexcept;
+
+			protected:
+				struct InsertLocation
+				{
+					std::size_t index;
+					Int8 h2;
+					bool found;
+				};
+
+				template<typename K> std::size_t FindIndex(const K& key) const;
+				template<typename K> InsertLocation FindOrPrepareInsert(const K& key);
+				template<typename... Args> void InsertAt(const InsertLocation& location, Args&&... args);
+				iterator MakeIterator(std::size_t index) noexcept;
+				const_iterator MakeIterator(std::size_t index) const noexcept;
+
+			private:
+				void Allocate(std::size_t capacity);
+				void EraseAt(std::size_t index);
+				std::size_t FindFirstNonFull(UInt64 hash) const;
+				void Free() noexcept;
+				void Grow();
+				void Resize(std::size_t newCapacity);
+				void SetCtrl(std::size_t index, Int8 ctrl) noexcept;
+
+				static constexpr std::size_t CapacityToGrowth(std::size_t capacity);
+				static constexpr std::size_t ComputeCapacity(std::size_t count);
+				static constexpr std::size_t ComputeSlotOffset(std::size_t capacity);
+				static constexpr std::size_t ComputeAllocationSize(std::size_t capacity);
+				template<typename K> UInt64 ComputeHash(const K& key) const;
+
+				static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+				static constexpr std::size_t MinCapacity = FlatHashGroup::Width;
+				static constexpr std::size_t SlotAlignment = (alignof(value_type) > alignof(std::max_align_t)) ? alignof(value_type) : alignof(std::max_align_t);
+
+				Int8* m_ctrl;
+				value_type* m_slots;
+				std::size_t m_capacity;
+				std::size_t m_growthLeft;
+				std::size_t m_size;
+				Hash m_hash;
+				KeyEqual m_keyEqual;
+		};
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		class FlatHashTable<Policy, Hash, KeyEqual>::Iterator
+		{
+			friend FlatHashTable;
+			friend Iterator<true>;
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = typename FlatHashTable::value_type;
+				using difference_type = std::ptrdiff_t;
+				using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+				using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+				Iterator() = default;
+				template<bool C = Const, typename = std::enable_if_t<C>> Iterator(const Iterator<false>& it);
+
+				reference operator*() const;
+				pointer operator->() const;
+
+				Iterator& operator++();
+				Iterator operator++(int);
+
+				bool operator==(const Iterator& other) const;
+				bool operator!=(const Iterator& other) const;
+
+			private:
+				Iterator(const Int8* ctrl, const Int8* ctrlEnd, pointer slot);
+
+				void SkipEmptySlots();
+
+				const Int8* m_ctrl = nullptr;
+				const Int8* m_ctrlEnd = nullptr;
+				pointer m_slot = nullptr;
+		};
+	}
+}
+
+#include <NazaraUtils/FlatHashTable.inl>
+
+#endif // NAZARAUTILS_FLATHASHTABLE_HPP
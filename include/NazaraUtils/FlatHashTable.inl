@@ -0,0 +1,916 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, unsigned int Shift>
+		unsigned int FlatHashBitMask<T, Shift>::GetLeadingZeros(unsigned int width) const
+		{
+			assert(m_mask != 0);
+			return width - 1 - (Nz::IntegralLog2(m_mask) >> Shift);
+		}
+
+		template<typename T, unsigned int Shift>
+		unsigned int FlatHashBitMask<T, Shift>::GetLowestIndex() const
+		{
+			assert(m_mask != 0);
+			return (Nz::FindFirstBit(m_mask) - 1) >> Shift;
+		}
+
+		template<typename T, unsigned int Shift>
+		unsigned int FlatHashBitMask<T, Shift>::GetTrailingZeros() const
+		{
+			return GetLowestIndex();
+		}
+
+#if defined(NAZARA_FLATHASH_SSE2)
+		inline FlatHashGroup::FlatHashGroup(const Int8* ctrl) :
+		m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+		{
+		}
+
+		inline auto FlatHashGroup::Match(Int8 h2) const -> BitMask
+		{
+			return BitMask(static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+		}
+
+		inline auto FlatHashGroup::MatchEmpty() const -> BitMask
+		{
+			return Match(static_cast<Int8>(FlatHashCtrl::Empty));
+		}
+
+		inline auto FlatHashGroup::MatchEmptyOrDeleted() const -> BitMask
+		{
+			// Empty and deleted are the only control bytes with their sign bit set
+			return BitMask(static_cast<UInt32>(_mm_movemask_epi8(m_ctrl)));
+		}
+
+		inline auto FlatHashGroup::MatchFull() const -> BitMask
+		{
+			return BitMask(static_cast<UInt32>(_mm_movemask_epi8(m_ctrl)) ^ 0xFFFF);
+		}
+#elif defined(NAZARA_FLATHASH_NEON)
+		inline FlatHashGroup::FlatHashGroup(const Int8* ctrl) :
+		m_ctrl(vld1q_s8(ctrl))
+		{
+		}
+
+		inline auto FlatHashGroup::Match(Int8 h2) const -> BitMask
+		{
+			return ToBitMask(vceqq_s8(m_ctrl, vdupq_n_s8(h2)));
+		}
+
+		inline auto FlatHashGroup::MatchEmpty() const -> BitMask
+		{
+			return Match(static_cast<Int8>(FlatHashCtrl::Empty));
+		}
+
+		inline auto FlatHashGroup::MatchEmptyOrDeleted() const -> BitMask
+		{
+			return ToBitMask(vcltzq_s8(m_ctrl));
+		}
+
+		inline auto FlatHashGroup::MatchFull() const -> BitMask
+		{
+			return ToBitMask(vcgezq_s8(m_ctrl));
+		}
+
+		inline auto FlatHashGroup::ToBitMask(uint8x16_t comparison) -> BitMask
+		{
+			// Narrow each byte of the comparison to a nibble (there's no movemask on NEON) and keep one bit per nibble
+			uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(comparison), 4);
+			return BitMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull);
+		}
+#else
+		inline FlatHashGroup::FlatHashGroup(const Int8* ctrl) :
+		m_ctrl(ctrl)
+		{
+		}
+
+		inline auto FlatHashGroup::Match(Int8 h2) const -> BitMask
+		{
+			UInt32 mask = 0;
+			for (std::size_t i = 0; i < Width; ++i)
+				mask |= UInt32(m_ctrl[i] == h2) << i;
+
+			return BitMask(mask);
+		}
+
+		inline auto FlatHashGroup::MatchEmpty() const -> BitMask
+		{
+			return Match(static_cast<Int8>(FlatHashCtrl::Empty));
+		}
+
+		inline auto FlatHashGroup::MatchEmptyOrDeleted() const -> BitMask
+		{
+			UInt32 mask = 0;
+			for (std::size_t i = 0; i < Width; ++i)
+				mask |= UInt32(m_ctrl[i] < 0) << i;
+
+			return BitMask(mask);
+		}
+
+		inline auto FlatHashGroup::MatchFull() const -> BitMask
+		{
+			UInt32 mask = 0;
+			for (std::size_t i = 0; i < Width; ++i)
+				mask |= UInt32(m_ctrl[i] >= 0) << i;
+
+			return BitMask(mask);
+		}
+#endif
+
+		/*!
+		* \ingroup utils
+		* \class Nz::Detail::FlatHashTable
+		* \brief Open-addressing hash table shared by FlatHashMap and FlatHashSet, following the SwissTable design
+		*
+		* Elements are stored in a single array of slots, along with an array of control bytes (one per slot) telling if the slot is empty,
+		* deleted or full, in which case the control byte holds 7 bits of the hash of the element.
+		* Lookups compare 16 control bytes at once (using SSE2 or NEON when available) and only compare keys of slots whose 7 bits of hash match.
+		*
+		* The capacity is always a power of two (and at least 16), the table grows when it reaches a load factor of 7/8.
+		* The first control bytes are mirrored after the last one, so that a group can be read starting from any slot.
+		*
+		* \remark Erasing only invalidates iterators and references to the erased element, but any insertion may trigger a rehash which invalidates all of them
+		*/
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_default_constructible_v<KeyEqual>) :
+		m_ctrl(nullptr),
+		m_slots(nullptr),
+		m_capacity(0),
+		m_growthLeft(0),
+		m_size(0)
+		{
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(size_type bucketCount, const Hash& hash, const KeyEqual& keyEqual) :
+		m_ctrl(nullptr),
+		m_slots(nullptr),
+		m_capacity(0),
+		m_growthLeft(0),
+		m_size(0),
+		m_hash(hash),
+		m_keyEqual(keyEqual)
+		{
+			if (bucketCount > 0)
+				Allocate(ComputeCapacity(bucketCount));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename InputIt>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(InputIt first, InputIt last, size_type bucketCount, const Hash& hash, const KeyEqual& keyEqual) :
+		FlatHashTable(bucketCount, hash, keyEqual)
+		{
+			insert(first, last);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(std::initializer_list<value_type> values, size_type bucketCount, const Hash& hash, const KeyEqual& keyEqual) :
+		FlatHashTable(std::max(bucketCount, values.size()), hash, keyEqual)
+		{
+			insert(values);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(const FlatHashTable& table) :
+		FlatHashTable(table.size(), table.m_hash, table.m_keyEqual)
+		{
+			for (const value_type& value : table)
+			{
+				// Keys are known to be unique, skip the lookup
+				UInt64 hash = ComputeHash(Policy::GetKey(value));
+				InsertAt(InsertLocation{ FindFirstNonFull(hash), static_cast<Int8>(hash & 0x7F), false }, value);
+			}
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(FlatHashTable&& table) noexcept :
+		m_ctrl(std::exchange(table.m_ctrl, nullptr)),
+		m_slots(std::exchange(table.m_slots, nullptr)),
+		m_capacity(std::exchange(table.m_capacity, 0)),
+		m_growthLeft(std::exchange(table.m_growthLeft, 0)),
+		m_size(std::exchange(table.m_size, 0)),
+		m_hash(std::move(table.m_hash)),
+		m_keyEqual(std::move(table.m_keyEqual))
+		{
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		FlatHashTable<Policy, Hash, KeyEqual>::~FlatHashTable()
+		{
+			Free();
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::begin() noexcept -> iterator
+		{
+			iterator it = MakeIterator(0);
+			it.SkipEmptySlots();
+
+			return it;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::begin() const noexcept -> const_iterator
+		{
+			const_iterator it = MakeIterator(0);
+			it.SkipEmptySlots();
+
+			return it;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::capacity() const noexcept -> size_type
+		{
+			return m_capacity;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::cbegin() const noexcept -> const_iterator
+		{
+			return begin();
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::cend() const noexcept -> const_iterator
+		{
+			return end();
+		}
+
+		/*!
+		* \brief Destroys every element, keeping the allocated memory
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::clear() noexcept
+		{
+			if (m_capacity == 0)
+				return;
+
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+				for (std::size_t i = 0; i < m_capacity; ++i)
+				{
+					if (m_ctrl[i] >= 0)
+						std::destroy_at(&m_slots[i]);
+				}
+			}
+
+			std::memset(m_ctrl, static_cast<Int8>(FlatHashCtrl::Empty), m_capacity + FlatHashGroup::Width);
+			m_growthLeft = CapacityToGrowth(m_capacity);
+			m_size = 0;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		bool FlatHashTable<Policy, Hash, KeyEqual>::contains(const KeyArg<K>& key) const
+		{
+			return FindIndex(key) != InvalidIndex;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::count(const KeyArg<K>& key) const -> size_type
+		{
+			return (FindIndex(key) != InvalidIndex) ? 1 : 0;
+		}
+
+		/*!
+		* \brief Constructs an element in-place if no element with the same key exists
+		* \return Iterator to the element with the key and a boolean telling if the element was inserted
+		*
+		* \remark The element is constructed before the lookup (to retrieve its key) and destroyed if the key already exists, prefer try_emplace for maps
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename... Args>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::emplace(Args&&... args) -> std::pair<iterator, bool>
+		{
+			value_type value(std::forward<Args>(args)...);
+
+			InsertLocation location = FindOrPrepareInsert(Policy::GetKey(value));
+			if (!location.found)
+				InsertAt(location, std::move(value));
+
+			return { MakeIterator(location.index), !location.found };
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		bool FlatHashTable<Policy, Hash, KeyEqual>::empty() const noexcept
+		{
+			return m_size == 0;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::end() noexcept -> iterator
+		{
+			return MakeIterator(m_capacity);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::end() const noexcept -> const_iterator
+		{
+			return MakeIterator(m_capacity);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::erase(iterator pos) -> iterator
+		{
+			return erase(const_iterator(pos));
+		}
+
+		/*!
+		* \brief Erases an element
+		* \return Iterator to the element following the erased one
+		*
+		* \param pos Iterator to the element to erase, must be valid and dereferenceable
+		*
+		* \remark Erasing never moves other elements, iterators to other elements stay valid
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::erase(const_iterator pos) -> iterator
+		{
+			assert(pos != end());
+
+			std::size_t index = static_cast<std::size_t>(pos.m_ctrl - m_ctrl);
+			EraseAt(index);
+
+			iterator next = MakeIterator(index);
+			++next;
+
+			return next;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::erase(const_iterator first, const_iterator last) -> iterator
+		{
+			while (first != last)
+				first = erase(first);
+
+			return MakeIterator(static_cast<std::size_t>(last.m_ctrl - m_ctrl));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::erase(const KeyArg<K>& key) -> size_type
+		{
+			std::size_t index = FindIndex(key);
+			if (index == InvalidIndex)
+				return 0;
+
+			EraseAt(index);
+			return 1;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::find(const KeyArg<K>& key) -> iterator
+		{
+			std::size_t index = FindIndex(key);
+			return MakeIterator((index != InvalidIndex) ? index : m_capacity);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::find(const KeyArg<K>& key) const -> const_iterator
+		{
+			std::size_t index = FindIndex(key);
+			return MakeIterator((index != InvalidIndex) ? index : m_capacity);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::hash_function() const -> hasher
+		{
+			return m_hash;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::insert(const value_type& value) -> std::pair<iterator, bool>
+		{
+			InsertLocation location = FindOrPrepareInsert(Policy::GetKey(value));
+			if (!location.found)
+				InsertAt(location, value);
+
+			return { MakeIterator(location.index), !location.found };
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::insert(value_type&& value) -> std::pair<iterator, bool>
+		{
+			InsertLocation location = FindOrPrepareInsert(Policy::GetKey(value));
+			if (!location.found)
+				InsertAt(location, std::move(value));
+
+			return { MakeIterator(location.index), !location.found };
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename InputIt>
+		void FlatHashTable<Policy, Hash, KeyEqual>::insert(InputIt first, InputIt last)
+		{
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+				reserve(m_size + static_cast<std::size_t>(std::distance(first, last)));
+
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::insert(std::initializer_list<value_type> values)
+		{
+			insert(values.begin(), values.end());
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::key_eq() const -> key_equal
+		{
+			return m_keyEqual;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		float FlatHashTable<Policy, Hash, KeyEqual>::load_factor() const noexcept
+		{
+			return (m_capacity > 0) ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.f;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::max_size() const noexcept -> size_type
+		{
+			return (std::numeric_limits<size_type>::max() / 2) / (sizeof(value_type) + 1);
+		}
+
+		/*!
+		* \brief Changes the capacity of the table to hold at least count elements (or the current size if greater) without growing
+		*
+		* \param count Element count
+		*
+		* \remark rehash(0) releases the memory of an empty table, and purges deleted slots otherwise
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::rehash(size_type count)
+		{
+			std::size_t newCapacity = ComputeCapacity(std::max(count, m_size));
+			if (newCapacity == 0)
+			{
+				Free();
+				m_ctrl = nullptr;
+				m_slots = nullptr;
+				m_capacity = 0;
+				m_growthLeft = 0;
+				return;
+			}
+
+			Resize(newCapacity);
+		}
+
+		/*!
+		* \brief Ensures the table can hold count elements without rehashing
+		*
+		* \param count Element count
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::reserve(size_type count)
+		{
+			if (count > m_size + m_growthLeft)
+				Resize(ComputeCapacity(count));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::size() const noexcept -> size_type
+		{
+			return m_size;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::swap(FlatHashTable& table) noexcept
+		{
+			std::swap(m_ctrl, table.m_ctrl);
+			std::swap(m_slots, table.m_slots);
+			std::swap(m_capacity, table.m_capacity);
+			std::swap(m_growthLeft, table.m_growthLeft);
+			std::swap(m_size, table.m_size);
+			std::swap(m_hash, table.m_hash);
+			std::swap(m_keyEqual, table.m_keyEqual);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::operator=(const FlatHashTable& table) -> FlatHashTable&
+		{
+			if (this != &table)
+			{
+				FlatHashTable copy(table);
+				swap(copy);
+			}
+
+			return *this;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::operator=(FlatHashTable&& table) noexcept -> FlatHashTable&
+		{
+			if (this != &table)
+			{
+				Free();
+
+				m_ctrl = std::exchange(table.m_ctrl, nullptr);
+				m_slots = std::exchange(table.m_slots, nullptr);
+				m_capacity = std::exchange(table.m_capacity, 0);
+				m_growthLeft = std::exchange(table.m_growthLeft, 0);
+				m_size = std::exchange(table.m_size, 0);
+				m_hash = std::move(table.m_hash);
+				m_keyEqual = std::move(table.m_keyEqual);
+			}
+
+			return *this;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		constexpr float FlatHashTable<Policy, Hash, KeyEqual>::max_load_factor() noexcept
+		{
+			return 7.f / 8.f;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		std::size_t FlatHashTable<Policy, Hash, KeyEqual>::FindIndex(const K& key) const
+		{
+			if (m_size == 0)
+				return InvalidIndex;
+
+			UInt64 hash = ComputeHash(key);
+			Int8 h2 = static_cast<Int8>(hash & 0x7F);
+
+			std::size_t mask = m_capacity - 1;
+			std::size_t pos = static_cast<std::size_t>(hash >> 7) & mask;
+			std::size_t step = 0;
+			for (;;)
+			{
+				FlatHashGroup group(m_ctrl + pos);
+				for (unsigned int i : group.Match(h2))
+				{
+					std::size_t index = (pos + i) & mask;
+					if NAZARA_LIKELY(m_keyEqual(Policy::GetKey(m_slots[index]), key))
+						return index;
+				}
+
+				// An empty slot means the key was never inserted further in the probe sequence
+				if (group.MatchEmpty())
+					return InvalidIndex;
+
+				// Triangular probing visits every group when the capacity is a power of two
+				step += FlatHashGroup::Width;
+				pos = (pos + step) & mask;
+			}
+		}
+
+		/*!
+		* \brief Looks for a key, finding a slot to insert it if it's not in the table (growing the table if required)
+		* \return Index of the element with that key, or of the slot where it should be inserted using InsertAt
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::FindOrPrepareInsert(const K& key) -> InsertLocation
+		{
+			UInt64 hash = ComputeHash(key);
+			Int8 h2 = static_cast<Int8>(hash & 0x7F);
+
+			if (m_size > 0)
+			{
+				std::size_t mask = m_capacity - 1;
+				std::size_t pos = static_cast<std::size_t>(hash >> 7) & mask;
+				std::size_t step = 0;
+				for (;;)
+				{
+					FlatHashGroup group(m_ctrl + pos);
+					for (unsigned int i : group.Match(h2))
+					{
+						std::size_t index = (pos + i) & mask;
+						if NAZARA_LIKELY(m_keyEqual(Policy::GetKey(m_slots[index]), key))
+							return { index, h2, true };
+					}
+
+					if (group.MatchEmpty())
+						break;
+
+					step += FlatHashGroup::Width;
+					pos = (pos + step) & mask;
+				}
+			}
+
+			std::size_t index = (m_capacity > 0) ? FindFirstNonFull(hash) : 0;
+			if (m_growthLeft == 0 && (m_capacity == 0 || m_ctrl[index] != static_cast<Int8>(FlatHashCtrl::Deleted)))
+			{
+				Grow();
+				index = FindFirstNonFull(hash);
+			}
+
+			return { index, h2, false };
+		}
+
+		/*!
+		* \brief Constructs an element in the slot prepared by FindOrPrepareInsert
+		*
+		* \param location Location returned by FindOrPrepareInsert, with no modification of the table in between
+		* \param args Arguments used to construct the element
+		*/
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename... Args>
+		void FlatHashTable<Policy, Hash, KeyEqual>::InsertAt(const InsertLocation& location, Args&&... args)
+		{
+			assert(!location.found);
+			assert(m_ctrl[location.index] < 0);
+
+			// Construct first, so the table is left untouched if it throws
+			new (&m_slots[location.index]) value_type(std::forward<Args>(args)...);
+
+			if (m_ctrl[location.index] == static_cast<Int8>(FlatHashCtrl::Empty))
+				m_growthLeft--;
+
+			SetCtrl(location.index, location.h2);
+			m_size++;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::MakeIterator(std::size_t index) noexcept -> iterator
+		{
+			return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::MakeIterator(std::size_t index) const noexcept -> const_iterator
+		{
+			return const_iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::Allocate(std::size_t capacity)
+		{
+			assert(IsPow2(capacity) && capacity >= MinCapacity);
+
+			void* memory = ::operator new(ComputeAllocationSize(capacity), std::align_val_t(SlotAlignment));
+
+			m_ctrl = static_cast<Int8*>(memory);
+			m_slots = reinterpret_cast<value_type*>(static_cast<UInt8*>(memory) + ComputeSlotOffset(capacity));
+			m_capacity = capacity;
+			m_growthLeft = CapacityToGrowth(capacity);
+
+			std::memset(m_ctrl, static_cast<Int8>(FlatHashCtrl::Empty), capacity + FlatHashGroup::Width);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::EraseAt(std::size_t index)
+		{
+			assert(m_ctrl[index] >= 0);
+
+			std::destroy_at(&m_slots[index]);
+			m_size--;
+
+			// If every group window containing this slot also contains an empty slot, no probe sequence ever went past it
+			// and it can be marked as empty, otherwise it has to become a tombstone
+			std::size_t indexBefore = (index - FlatHashGroup::Width) & (m_capacity - 1);
+			auto emptyAfter = FlatHashGroup(m_ctrl + index).MatchEmpty();
+			auto emptyBefore = FlatHashGroup(m_ctrl + indexBefore).MatchEmpty();
+
+			bool wasNeverFull = emptyBefore && emptyAfter && (emptyAfter.GetTrailingZeros() + emptyBefore.GetLeadingZeros(FlatHashGroup::Width)) < FlatHashGroup::Width;
+			if (wasNeverFull)
+			{
+				SetCtrl(index, static_cast<Int8>(FlatHashCtrl::Empty));
+				m_growthLeft++;
+			}
+			else
+				SetCtrl(index, static_cast<Int8>(FlatHashCtrl::Deleted));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		std::size_t FlatHashTable<Policy, Hash, KeyEqual>::FindFirstNonFull(UInt64 hash) const
+		{
+			std::size_t mask = m_capacity - 1;
+			std::size_t pos = static_cast<std::size_t>(hash >> 7) & mask;
+			std::size_t step = 0;
+			for (;;)
+			{
+				if (auto nonFull = FlatHashGroup(m_ctrl + pos).MatchEmptyOrDeleted())
+					return (pos + nonFull.GetLowestIndex()) & mask;
+
+				step += FlatHashGroup::Width;
+				pos = (pos + step) & mask;
+			}
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::Free() noexcept
+		{
+			if (!m_ctrl)
+				return;
+
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+				for (std::size_t i = 0; i < m_capacity; ++i)
+				{
+					if (m_ctrl[i] >= 0)
+						std::destroy_at(&m_slots[i]);
+				}
+			}
+
+			::operator delete(m_ctrl, std::align_val_t(SlotAlignment));
+			m_size = 0;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::Grow()
+		{
+			// Many tombstones: rehash in-place to purge them instead of doubling the capacity
+			if (m_capacity > 0 && m_size <= CapacityToGrowth(m_capacity) / 2)
+				Resize(m_capacity);
+			else
+				Resize((m_capacity > 0) ? m_capacity * 2 : MinCapacity);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::Resize(std::size_t newCapacity)
+		{
+			Int8* oldCtrl = m_ctrl;
+			value_type* oldSlots = m_slots;
+			std::size_t oldCapacity = m_capacity;
+
+			Allocate(newCapacity);
+
+			for (std::size_t i = 0; i < oldCapacity; ++i)
+			{
+				if (oldCtrl[i] < 0)
+					continue;
+
+				UInt64 hash = ComputeHash(Policy::GetKey(oldSlots[i]));
+				std::size_t index = FindFirstNonFull(hash);
+
+				new (&m_slots[index]) value_type(std::move(oldSlots[i]));
+				std::destroy_at(&oldSlots[i]);
+
+				SetCtrl(index, static_cast<Int8>(hash & 0x7F));
+			}
+			m_growthLeft -= m_size;
+
+			if (oldCtrl)
+				::operator delete(oldCtrl, std::align_val_t(SlotAlignment));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		void FlatHashTable<Policy, Hash, KeyEqual>::SetCtrl(std::size_t index, Int8 ctrl) noexcept
+		{
+			// Also update the mirrored control byte (for the first group, otherwise this writes the same byte twice)
+			m_ctrl[index] = ctrl;
+			m_ctrl[((index - FlatHashGroup::Width) & (m_capacity - 1)) + FlatHashGroup::Width] = ctrl;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		constexpr std::size_t FlatHashTable<Policy, Hash, KeyEqual>::CapacityToGrowth(std::size_t capacity)
+		{
+			return capacity - capacity / 8;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		constexpr std::size_t FlatHashTable<Policy, Hash, KeyEqual>::ComputeCapacity(std::size_t count)
+		{
+			if (count == 0)
+				return 0;
+
+			std::size_t capacity = MinCapacity;
+			while (CapacityToGrowth(capacity) < count)
+				capacity *= 2;
+
+			return capacity;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		constexpr std::size_t FlatHashTable<Policy, Hash, KeyEqual>::ComputeSlotOffset(std::size_t capacity)
+		{
+			return Align(capacity + FlatHashGroup::Width, alignof(value_type));
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		constexpr std::size_t FlatHashTable<Policy, Hash, KeyEqual>::ComputeAllocationSize(std::size_t capacity)
+		{
+			return ComputeSlotOffset(capacity) + capacity * sizeof(value_type);
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<typename K>
+		UInt64 FlatHashTable<Policy, Hash, KeyEqual>::ComputeHash(const K& key) const
+		{
+			// Mix the hash, as std::hash is the identity for integers on most implementations and we use its lower 7 bits
+			return WyMix(static_cast<UInt64>(m_hash(key)), 0x9E3779B97F4A7C15ull);
+		}
+
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		template<bool C, typename>
+		FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::Iterator(const Iterator<false>& it) :
+		m_ctrl(it.m_ctrl),
+		m_ctrlEnd(it.m_ctrlEnd),
+		m_slot(it.m_slot)
+		{
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::Iterator(const Int8* ctrl, const Int8* ctrlEnd, pointer slot) :
+		m_ctrl(ctrl),
+		m_ctrlEnd(ctrlEnd),
+		m_slot(slot)
+		{
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator*() const -> reference
+		{
+			assert(m_ctrl < m_ctrlEnd && *m_ctrl >= 0);
+			return *m_slot;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator->() const -> pointer
+		{
+			assert(m_ctrl < m_ctrlEnd && *m_ctrl >= 0);
+			return m_slot;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator++() -> Iterator&
+		{
+			assert(m_ctrl < m_ctrlEnd);
+			++m_ctrl;
+			++m_slot;
+			SkipEmptySlots();
+
+			return *this;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		auto FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator++(int) -> Iterator
+		{
+			Iterator it = *this;
+			operator++();
+
+			return it;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		bool FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator==(const Iterator& other) const
+		{
+			return m_ctrl == other.m_ctrl;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		bool FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::operator!=(const Iterator& other) const
+		{
+			return m_ctrl != other.m_ctrl;
+		}
+
+		template<typename Policy, typename Hash, typename KeyEqual>
+		template<bool Const>
+		void FlatHashTable<Policy, Hash, KeyEqual>::Iterator<Const>::SkipEmptySlots()
+		{
+			// Tables are mostly full, the next slot is likely to hold an element
+			if (m_ctrl >= m_ctrlEnd || *m_ctrl >= 0)
+				return;
+
+			const Int8* ctrl = m_ctrl;
+			while (ctrl < m_ctrlEnd)
+			{
+				if (auto fullSlots = FlatHashGroup(ctrl).MatchFull())
+				{
+					ctrl += fullSlots.GetLowestIndex();
+					break;
+				}
+
+				ctrl += FlatHashGroup::Width;
+			}
+
+			// Mirrored control bytes may have matched past the end
+			if (ctrl > m_ctrlEnd)
+				ctrl = m_ctrlEnd;
+
+			m_slot += ctrl - m_ctrl;
+			m_ctrl = ctrl;
+		}
+	}
+}
@@ -8,12 +8,33 @@
 #define NAZARAUTILS_HASH_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
+
+#if !defined(NAZARA_HASH_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_HASH_X86
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_FEATURE_CRC32) || defined(_M_ARM64))
+		#define NAZARA_HASH_ARM_CRC32
+	#endif
+#endif
 
 namespace Nz
 {
 	template<typename T> void HashCombine(std::size_t& seed, const T& v);
 	template<typename T, typename... Args> std::size_t HashCombine(const T& v, const Args&... args);
+	template<typename T> std::size_t HashObject(const T& value);
+	template<typename Range> std::size_t HashRange(const Range& range);
+	template<typename It> std::size_t HashRange(It first, It last);
+
+	struct TupleHash
+	{
+		template<typename... Args> std::size_t operator()(const std::tuple<Args...>& tuple) const;
+		template<typename First, typename Second> std::size_t operator()(const std::pair<First, Second>& pair) const;
+	};
 
 	template<typename T>
 	struct HashFunctor
@@ -29,7 +50,18 @@ namespace Nz
 
 	struct CRC32Hash
 	{
-		template<typename... Args> UInt32 operator()(Args&&... args);
+		template<typename... Args> constexpr UInt32 operator()(Args&&... args) const;
+	};
+
+	// Cyclic Redundancy Check (CRC) - 32bits, Castagnoli polynomial
+	constexpr UInt32 CRC32C(const char* str) noexcept;
+	constexpr UInt32 CRC32C(std::string_view str) noexcept;
+	constexpr UInt32 CRC32C(const UInt8* data, std::size_t size) noexcept;
+	template<std::size_t N> constexpr UInt32 CRC32C(const char(&str)[N]) noexcept;
+
+	struct CRC32CHash
+	{
+		template<typename... Args> constexpr UInt32 operator()(Args&&... args) const;
 	};
 
 	// Fowler–Noll–Vo (FNV) 1a - 32bits
@@ -40,7 +72,7 @@ namespace Nz
 
 	struct FNV1a32Hash
 	{
-		template<typename... Args> UInt32 operator()(Args&&... args);
+		template<typename... Args> constexpr UInt32 operator()(Args&&... args) const;
 	};
 
 	// Fowler–Noll–Vo (FNV) 1a - 64bits
@@ -51,7 +83,118 @@ namespace Nz
 
 	struct FNV1a64Hash
 	{
-		template<typename... Args> UInt64 operator()(Args&&... args);
+		template<typename... Args> constexpr UInt64 operator()(Args&&... args) const;
+	};
+
+	// wyhash (final version 4) - 64bits
+	constexpr UInt64 WyHash64(const char* str, UInt64 seed = 0) noexcept;
+	constexpr UInt64 WyHash64(std::string_view str, UInt64 seed = 0) noexcept;
+	constexpr UInt64 WyHash64(const UInt8* data, std::size_t size, UInt64 seed = 0) noexcept;
+
+	struct WyHash64Hash
+	{
+		template<typename... Args> constexpr UInt64 operator()(Args&&... args) const;
+	};
+
+	// Default hasher of the flat hash containers (wyhash for strings, std::hash otherwise)
+	template<typename T>
+	struct FastHash
+	{
+		std::size_t operator()(const T& value) const;
+	};
+
+	template<typename Allocator> struct FastHash<std::basic_string<char, std::char_traits<char>, Allocator>> : StringHash<char, WyHash64Hash> {};
+	template<> struct FastHash<std::string_view> : StringHash<char, WyHash64Hash> {};
+
+	// Incremental hashers, giving the same result as hashing the concatenation of every Update in one call
+	class CRC32Hasher
+	{
+		public:
+			CRC32Hasher() noexcept;
+			CRC32Hasher(const CRC32Hasher&) = default;
+			~CRC32Hasher() = default;
+
+			UInt32 Finalize() const noexcept;
+
+			void Reset() noexcept;
+
+			void Update(const void* data, std::size_t size) noexcept;
+
+			CRC32Hasher& operator=(const CRC32Hasher&) = default;
+
+			static constexpr UInt32 Combine(UInt32 crcA, UInt32 crcB, UInt64 lengthB) noexcept;
+
+		private:
+			UInt32 m_crc;
+	};
+
+	class CRC32CHasher
+	{
+		public:
+			CRC32CHasher() noexcept;
+			CRC32CHasher(const CRC32CHasher&) = default;
+			~CRC32CHasher() = default;
+
+			UInt32 Finalize() const noexcept;
+
+			void Reset() noexcept;
+
+			void Update(const void* data, std::size_t size) noexcept;
+
+			CRC32CHasher& operator=(const CRC32CHasher&) = default;
+
+			static constexpr UInt32 Combine(UInt32 crcA, UInt32 crcB, UInt64 lengthB) noexcept;
+
+		private:
+			UInt32 m_crc;
+	};
+
+	class FNV1a64Hasher
+	{
+		public:
+			FNV1a64Hasher() noexcept;
+			FNV1a64Hasher(const FNV1a64Hasher&) = default;
+			~FNV1a64Hasher() = default;
+
+			UInt64 Finalize() const noexcept;
+
+			void Reset() noexcept;
+
+			void Update(const void* data, std::size_t size) noexcept;
+
+			FNV1a64Hasher& operator=(const FNV1a64Hasher&) = default;
+
+		private:
+			UInt64 m_hash;
+	};
+
+	class WyHash64Hasher
+	{
+		public:
+			WyHash64Hasher(UInt64 seed = 0) noexcept;
+			WyHash64Hasher(const WyHash64Hasher&) = default;
+			~WyHash64Hasher() = default;
+
+			UInt64 Finalize() const noexcept;
+
+			void Reset() noexcept;
+
+			void Update(const void* data, std::size_t size) noexcept;
+
+			WyHash64Hasher& operator=(const WyHash64Hasher&) = default;
+
+		private:
+			static constexpr std::size_t BlockSize = 48;
+			static constexpr std::size_t TailSize = 16;
+
+			void ProcessBlock(const UInt8* block) noexcept;
+
+			UInt8 m_buffer[BlockSize];
+			UInt8 m_previousTail[TailSize]; //< Last bytes of the last processed block, the finalization may read them
+			UInt64 m_lanes[3];
+			UInt64 m_length;
+			UInt64 m_seed;
+			std::size_t m_bufferSize;
 	};
 }
 
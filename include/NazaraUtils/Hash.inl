@@ -2,7 +2,34 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <NazaraUtils/ConstantEvaluated.hpp>
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <NazaraUtils/Endianness.hpp>
+#include <NazaraUtils/TypeTraits.hpp>
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#if defined(NAZARA_HASH_X86)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_HASH_ARM_CRC32)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#else
+		#include <arm_acle.h>
+	#endif
+#endif
+
+#if defined(NAZARA_HASH_X86) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_HASH_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_HASH_TARGET(features)
+#endif
 
 namespace Nz
 {
@@ -47,11 +74,400 @@ NAZARA_WARNING_POP()
 			"GenerateCRC32Table generated unexpected result."
 		);
 
+		// Slicing-by-N tables, table K gives the CRC of a byte followed by K zero bytes
+		template<std::size_t N>
+		constexpr auto GenerateCRC32SlicingTables(UInt32 polynomial)
+		{
+			std::array<std::array<UInt32, 256>, N> tables{};
+			tables[0] = GenerateCRC32Table(polynomial);
+			for (std::size_t slice = 1; slice < N; ++slice)
+			{
+				for (std::size_t byte = 0; byte < 256; ++byte)
+				{
+					UInt32 previous = tables[slice - 1][byte];
+					tables[slice][byte] = (previous >> 8) ^ tables[0][previous & 0xFF];
+				}
+			}
+
+			return tables;
+		}
+
+		using CRC32SlicingTables = std::array<std::array<UInt32, 256>, 8>;
+
+		inline constexpr CRC32SlicingTables s_crc32SlicingTables = GenerateCRC32SlicingTables<8>(0xEDB88320);
+		inline constexpr CRC32SlicingTables s_crc32cSlicingTables = GenerateCRC32SlicingTables<8>(0x82F63B78);
+		static_assert(s_crc32cSlicingTables[0][1] == 0xF26B8303, "GenerateCRC32SlicingTables generated unexpected result.");
+
+		// CRC functions below work on the internal CRC state (initialized to 0xFFFFFFFF and inverted to get the final CRC)
+		using CRC32UpdateFunc = UInt32(*)(UInt32 crc, const UInt8* data, std::size_t size);
+
+		inline UInt32 CRC32UpdateSlicingBy8(const CRC32SlicingTables& tables, UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			for (; size >= 8; size -= 8, data += 8)
+			{
+				UInt32 low, high;
+				std::memcpy(&low, data, sizeof(UInt32));
+				std::memcpy(&high, data + 4, sizeof(UInt32));
+				low = LittleEndianToHost(low) ^ crc;
+				high = LittleEndianToHost(high);
+
+				crc = tables[7][low & 0xFF] ^ tables[6][(low >> 8) & 0xFF] ^ tables[5][(low >> 16) & 0xFF] ^ tables[4][low >> 24] ^
+				      tables[3][high & 0xFF] ^ tables[2][(high >> 8) & 0xFF] ^ tables[1][(high >> 16) & 0xFF] ^ tables[0][high >> 24];
+			}
+
+			for (; size > 0; --size)
+				crc = tables[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+			return crc;
+		}
+
+		inline UInt32 CRC32UpdateScalar(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			return CRC32UpdateSlicingBy8(s_crc32SlicingTables, crc, data, size);
+		}
+
+		inline UInt32 CRC32CUpdateScalar(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			return CRC32UpdateSlicingBy8(s_crc32cSlicingTables, crc, data, size);
+		}
+
+#if defined(NAZARA_HASH_X86)
+		// Folding with carry-less multiplication followed by a Barrett reduction, from Intel's
+		// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (constants for the reflected CRC-32 polynomial)
+		NAZARA_HASH_TARGET("sse4.1,pclmul") inline __m128i CRC32FoldPCLMUL(__m128i x, __m128i k, __m128i next)
+		{
+			__m128i low = _mm_clmulepi64_si128(x, k, 0x00);
+			__m128i high = _mm_clmulepi64_si128(x, k, 0x11);
+			return _mm_xor_si128(_mm_xor_si128(low, high), next);
+		}
+
+		NAZARA_HASH_TARGET("sse4.1,pclmul") inline UInt32 CRC32UpdatePCLMUL(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			if (size < 64)
+				return CRC32UpdateScalar(crc, data, size);
+
+			const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+			const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+			const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163CD6124);
+			const __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+			const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+			__m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+			__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+			__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+			__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+			x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+			data += 64;
+			size -= 64;
+
+			// Fold four 128-bit lanes at a time
+			for (; size >= 64; size -= 64, data += 64)
+			{
+				x1 = CRC32FoldPCLMUL(x1, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+				x2 = CRC32FoldPCLMUL(x2, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+				x3 = CRC32FoldPCLMUL(x3, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+				x4 = CRC32FoldPCLMUL(x4, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+			}
+
+			// Fold the four lanes into one, then the remaining 16 bytes blocks
+			x1 = CRC32FoldPCLMUL(x1, k3k4, x2);
+			x1 = CRC32FoldPCLMUL(x1, k3k4, x3);
+			x1 = CRC32FoldPCLMUL(x1, k3k4, x4);
+			for (; size >= 16; size -= 16, data += 16)
+				x1 = CRC32FoldPCLMUL(x1, k3k4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+
+			// Fold 128 bits to 64 bits
+			__m128i x2b = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2b);
+			x2b = _mm_srli_si128(x1, 4);
+			x1 = _mm_and_si128(x1, mask32);
+			x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+			x1 = _mm_xor_si128(x1, x2b);
+
+			// Barrett reduction to 32 bits
+			x2b = _mm_and_si128(x1, mask32);
+			x2b = _mm_clmulepi64_si128(x2b, poly, 0x10);
+			x2b = _mm_and_si128(x2b, mask32);
+			x2b = _mm_clmulepi64_si128(x2b, poly, 0x00);
+			x1 = _mm_xor_si128(x1, x2b);
+
+			crc = static_cast<UInt32>(_mm_extract_epi32(x1, 1));
+
+			return CRC32UpdateScalar(crc, data, size);
+		}
+
+		NAZARA_HASH_TARGET("sse4.2") inline UInt32 CRC32CUpdateSSE42(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+#ifdef NAZARA_ARCH_x86_64
+			UInt64 crc64 = crc;
+			for (; size >= 8; size -= 8, data += 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(UInt64));
+				crc64 = _mm_crc32_u64(crc64, value);
+			}
+			crc = static_cast<UInt32>(crc64);
+#endif
+
+			for (; size >= 4; size -= 4, data += 4)
+			{
+				UInt32 value;
+				std::memcpy(&value, data, sizeof(UInt32));
+				crc = _mm_crc32_u32(crc, value);
+			}
+
+			for (; size > 0; --size)
+				crc = _mm_crc32_u8(crc, *data++);
+
+			return crc;
+		}
+#elif defined(NAZARA_HASH_ARM_CRC32)
+	#if !defined(NAZARA_COMPILER_MSVC) && !defined(__ARM_FEATURE_CRC32)
+		#define NAZARA_HASH_ARM_TARGET __attribute__((target("+crc")))
+	#else
+		#define NAZARA_HASH_ARM_TARGET
+	#endif
+
+		template<bool Castagnoli>
+		NAZARA_HASH_ARM_TARGET UInt32 CRC32UpdateARMv8(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			for (; size >= 8; size -= 8, data += 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(UInt64));
+				crc = (Castagnoli) ? __crc32cd(crc, value) : __crc32d(crc, value);
+			}
+
+			for (; size > 0; --size)
+				crc = (Castagnoli) ? __crc32cb(crc, *data++) : __crc32b(crc, *data++);
+
+			return crc;
+		}
+
+	#undef NAZARA_HASH_ARM_TARGET
+#endif
+
+		template<bool Castagnoli>
+		constexpr CRC32UpdateFunc SelectCRC32Update([[maybe_unused]] const CpuFeatures& features)
+		{
+#if defined(NAZARA_HASH_X86)
+			if constexpr (Castagnoli)
+				return (features.sse42) ? &CRC32CUpdateSSE42 : &CRC32CUpdateScalar;
+			else
+				return (features.sse41 && features.pclmul) ? &CRC32UpdatePCLMUL : &CRC32UpdateScalar;
+#elif defined(NAZARA_HASH_ARM_CRC32)
+			return &CRC32UpdateARMv8<Castagnoli>;
+#else
+			return (Castagnoli) ? &CRC32CUpdateScalar : &CRC32UpdateScalar;
+#endif
+		}
+
+		inline UInt32 CRC32Update(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			return CpuDispatch<UInt32(UInt32, const UInt8*, std::size_t), &SelectCRC32Update<false>>::Call(crc, data, size);
+		}
+
+		inline UInt32 CRC32CUpdate(UInt32 crc, const UInt8* data, std::size_t size)
+		{
+			return CpuDispatch<UInt32(UInt32, const UInt8*, std::size_t), &SelectCRC32Update<true>>::Call(crc, data, size);
+		}
+
+		// wyhash default secret
+		constexpr UInt64 WyHashSecret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+		// 64x64 => 128 bits multiplication, low bits are stored in a and high bits in b
+		constexpr void WyMultiply(UInt64& a, UInt64& b) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			__extension__ typedef unsigned __int128 UInt128;
+
+			UInt128 r = UInt128(a) * b;
+			a = static_cast<UInt64>(r);
+			b = static_cast<UInt64>(r >> 64);
+#else
+	#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_ARCH_x86_64) && defined(NAZARA_HAS_CONSTEVAL)
+			if NAZARA_IS_RUNTIME_EVAL()
+			{
+				UInt64 high;
+				a = _umul128(a, b, &high);
+				b = high;
+				return;
+			}
+	#endif
+
+			UInt64 ha = a >> 32, hb = b >> 32, la = UInt32(a), lb = UInt32(b);
+			UInt64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+			UInt64 t = rl + (rm0 << 32);
+			UInt64 carry = (t < rl) ? 1 : 0;
+			UInt64 low = t + (rm1 << 32);
+			carry += (low < t) ? 1 : 0;
+			a = low;
+			b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+		}
+
+		constexpr UInt64 WyMix(UInt64 a, UInt64 b) noexcept
+		{
+			WyMultiply(a, b);
+			return a ^ b;
+		}
+
+		template<typename C>
+		constexpr UInt64 WyRead(const C* ptr, std::size_t byteCount) noexcept
+		{
+			static_assert(sizeof(C) == 1);
+
+#ifdef NAZARA_HAS_CONSTEVAL
+			if NAZARA_IS_RUNTIME_EVAL()
+			{
+				if (byteCount == sizeof(UInt64))
+				{
+					UInt64 value = 0;
+					std::memcpy(&value, ptr, sizeof(UInt64));
+					return LittleEndianToHost(value);
+				}
+				else
+				{
+					UInt32 value = 0;
+					std::memcpy(&value, ptr, sizeof(UInt32));
+					return LittleEndianToHost(value);
+				}
+			}
+#endif
+
+			UInt64 value = 0;
+			for (std::size_t i = 0; i < byteCount; ++i)
+				value |= UInt64(static_cast<UInt8>(ptr[i])) << (i * 8);
+
+			return value;
+		}
+
+		template<typename C>
+		constexpr UInt64 WyHash64(const C* ptr, std::size_t size, UInt64 seed) noexcept
+		{
+			const UInt64* secret = WyHashSecret;
+
+			seed ^= WyMix(seed ^ secret[0], secret[1]);
+
+			UInt64 a = 0;
+			UInt64 b = 0;
+			if NAZARA_LIKELY(size <= 16)
+			{
+				if (size >= 4)
+				{
+					std::size_t offset = (size >> 3) << 2;
+					a = (WyRead(ptr, 4) << 32) | WyRead(ptr + offset, 4);
+					b = (WyRead(ptr + size - 4, 4) << 32) | WyRead(ptr + size - 4 - offset, 4);
+				}
+				else if (size > 0)
+					a = (UInt64(static_cast<UInt8>(ptr[0])) << 16) | (UInt64(static_cast<UInt8>(ptr[size >> 1])) << 8) | UInt64(static_cast<UInt8>(ptr[size - 1]));
+			}
+			else
+			{
+				std::size_t i = size;
+				if (i >= 48)
+				{
+					// Three independent lanes to hide the multiplication latency
+					UInt64 seed1 = seed;
+					UInt64 seed2 = seed;
+					do
+					{
+						seed = WyMix(WyRead(ptr, 8) ^ secret[1], WyRead(ptr + 8, 8) ^ seed);
+						seed1 = WyMix(WyRead(ptr + 16, 8) ^ secret[2], WyRead(ptr + 24, 8) ^ seed1);
+						seed2 = WyMix(WyRead(ptr + 32, 8) ^ secret[3], WyRead(ptr + 40, 8) ^ seed2);
+						ptr += 48;
+						i -= 48;
+					}
+					while (i >= 48);
+
+					seed ^= seed1 ^ seed2;
+				}
+
+				for (; i > 16; i -= 16, ptr += 16)
+					seed = WyMix(WyRead(ptr, 8) ^ secret[1], WyRead(ptr + 8, 8) ^ seed);
+
+				a = WyRead(ptr + i - 16, 8);
+				b = WyRead(ptr + i - 8, 8);
+			}
+
+			a ^= secret[1];
+			b ^= seed;
+			WyMultiply(a, b);
+
+			return WyMix(a ^ secret[0] ^ size, b ^ secret[1]);
+		}
+
+		// Multiplication of two polynomials modulo the CRC polynomial (in reflected representation)
+		constexpr UInt32 CRC32MultiplyModP(UInt32 polynomial, UInt32 a, UInt32 b) noexcept
+		{
+			UInt32 product = 0;
+			for (UInt32 mask = 1u << 31; mask != 0; mask >>= 1)
+			{
+				if (a & mask)
+					product ^= b;
+
+				b = (b & 1) ? (b >> 1) ^ polynomial : b >> 1;
+			}
+
+			return product;
+		}
+
+		// Same approach as zlib's crc32_combine: CRC(A+B) = CRC(A) * x^(8*len(B)) mod P ^ CRC(B)
+		constexpr UInt32 CRC32Combine(UInt32 polynomial, UInt32 crcA, UInt32 crcB, UInt64 lengthB) noexcept
+		{
+			UInt32 power = 1u << 31; //< x^0
+			UInt32 square = 1u << 23; //< x^8 (one byte)
+			for (UInt64 n = lengthB; n != 0; n >>= 1)
+			{
+				if (n & 1)
+					power = CRC32MultiplyModP(polynomial, square, power);
+
+				square = CRC32MultiplyModP(polynomial, square, square);
+			}
+
+			return CRC32MultiplyModP(polynomial, power, crcA) ^ crcB;
+		}
+
 		constexpr UInt32 FNV1OffsetBasis_32 = 0x811c9dc5u;
 		constexpr UInt32 FNV1Prime_32 = 0x1000193u;
 
 		constexpr UInt64 FNV1OffsetBasis_64 = 0xcbf29ce484222325ull;
 		constexpr UInt64 FNV1Prime_64 = 0x100000001b3ull;
+
+		template<typename T> struct IsTupleLike : std::false_type {};
+		template<typename... Args> struct IsTupleLike<std::tuple<Args...>> : std::true_type {};
+		template<typename First, typename Second> struct IsTupleLike<std::pair<First, Second>> : std::true_type {};
+
+		template<typename It>
+		constexpr bool IsContiguousIterator()
+		{
+#if NAZARA_CHECK_CPP_VER(NAZARA_CPP20)
+			return std::contiguous_iterator<It>;
+#else
+			return std::is_pointer_v<It>;
+#endif
+		}
+
+		template<typename Range, typename = void>
+		struct IsContiguousRange : std::false_type {};
+
+		template<typename Range>
+		struct IsContiguousRange<Range, LazyVoid_t<decltype(std::data(std::declval<const Range&>()) + std::size(std::declval<const Range&>()))>> : std::true_type {};
+
+		// std::hash, extended to pairs and tuples
+		template<typename T>
+		std::size_t HashValue(const T& value)
+		{
+			if constexpr (IsTupleLike<T>::value)
+			{
+				if constexpr (std::tuple_size_v<T> == 0)
+					return 0;
+				else
+					return std::apply([](const auto&... elements) { return HashCombine(elements...); }, value);
+			}
+			else
+				return std::hash<T>{}(value);
+		}
 	}
 
 	/*!
@@ -68,8 +484,7 @@ NAZARA_WARNING_POP()
 	{
 		constexpr UInt64 kMul = 0x9ddfea08eb382d69ULL;
 
-		std::hash<T> hasher;
-		UInt64 a = (hasher(v) ^ seed) * kMul;
+		UInt64 a = (Detail::HashValue(v) ^ seed) * kMul;
 		a ^= (a >> 47);
 
 		UInt64 b = (seed ^ a) * kMul;
@@ -81,7 +496,7 @@ NAZARA_WARNING_POP()
 	template<typename T, typename... Args>
 	std::size_t HashCombine(const T& v, const Args&... args)
 	{
-		std::size_t hash = std::hash<T>{}(v);
+		std::size_t hash = Detail::HashValue(v);
 
 		if constexpr (sizeof...(Args) > 0)
 			HashCombine(hash, HashCombine(args...));
@@ -97,9 +512,23 @@ NAZARA_WARNING_POP()
 	}
 
 
+	/*!
+	* \ingroup utils
+	* \brief Computes the CRC-32 (ISO-HDLC, as used by zlib and PNG) of a string
+	* \return CRC-32 of the string
+	*
+	* \param str Null-terminated string
+	*
+	* \remark At runtime, this uses the fastest implementation available (carry-less multiplication, ARMv8 CRC instructions or slicing-by-8 tables)
+	*/
 	// From https://stackoverflow.com/questions/28675727/using-crc32-algorithm-to-hash-string-at-compile-time
 	constexpr UInt32 CRC32(const char* str) noexcept
 	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return CRC32(std::string_view(str));
+#endif
+
 		UInt32 crc = 0xFFFFFFFFu;
 
 		for (std::size_t i = 0u; str[i]; ++i)
@@ -110,6 +539,11 @@ NAZARA_WARNING_POP()
 
 	constexpr UInt32 CRC32(std::string_view str) noexcept
 	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return CRC32(reinterpret_cast<const UInt8*>(str.data()), str.size());
+#endif
+
 		UInt32 crc = 0xFFFFFFFFu;
 
 		for (std::size_t i = 0u; i < str.size(); ++i)
@@ -120,6 +554,11 @@ NAZARA_WARNING_POP()
 
 	constexpr UInt32 CRC32(const UInt8* input, std::size_t size) noexcept
 	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return ~Detail::CRC32Update(0xFFFFFFFFu, input, size);
+#endif
+
 		UInt32 crc = 0xFFFFFFFFu;
 
 		for (std::size_t i = 0u; i < size; ++i)
@@ -135,12 +574,79 @@ NAZARA_WARNING_POP()
 	}
 
 	template<typename... Args>
-	UInt32 CRC32Hash::operator()(Args&&... args)
+	constexpr UInt32 CRC32Hash::operator()(Args&&... args) const
 	{
 		return CRC32(std::forward<Args>(args)...);
 	}
 
 
+	/*!
+	* \ingroup utils
+	* \brief Computes the CRC-32C (Castagnoli polynomial, as used by iSCSI and ext4) of a string
+	* \return CRC-32C of the string
+	*
+	* \param str Null-terminated string
+	*
+	* \remark At runtime, this uses the fastest implementation available (SSE4.2 or ARMv8 CRC instructions, or slicing-by-8 tables)
+	*/
+	constexpr UInt32 CRC32C(const char* str) noexcept
+	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return CRC32C(std::string_view(str));
+#endif
+
+		UInt32 crc = 0xFFFFFFFFu;
+
+		for (std::size_t i = 0u; str[i]; ++i)
+			crc = Detail::s_crc32cSlicingTables[0][(crc ^ str[i]) & 0xFF] ^ (crc >> 8);
+
+		return ~crc;
+	}
+
+	constexpr UInt32 CRC32C(std::string_view str) noexcept
+	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return CRC32C(reinterpret_cast<const UInt8*>(str.data()), str.size());
+#endif
+
+		UInt32 crc = 0xFFFFFFFFu;
+
+		for (std::size_t i = 0u; i < str.size(); ++i)
+			crc = Detail::s_crc32cSlicingTables[0][(crc ^ str[i]) & 0xFF] ^ (crc >> 8);
+
+		return ~crc;
+	}
+
+	constexpr UInt32 CRC32C(const UInt8* input, std::size_t size) noexcept
+	{
+#ifdef NAZARA_HAS_CONSTEVAL
+		if NAZARA_IS_RUNTIME_EVAL()
+			return ~Detail::CRC32CUpdate(0xFFFFFFFFu, input, size);
+#endif
+
+		UInt32 crc = 0xFFFFFFFFu;
+
+		for (std::size_t i = 0u; i < size; ++i)
+			crc = Detail::s_crc32cSlicingTables[0][(crc ^ input[i]) & 0xFF] ^ (crc >> 8);
+
+		return ~crc;
+	}
+
+	template<std::size_t N>
+	constexpr UInt32 CRC32C(const char(&str)[N]) noexcept
+	{
+		return CRC32C(std::string_view(str, N));
+	}
+
+	template<typename... Args>
+	constexpr UInt32 CRC32CHash::operator()(Args&&... args) const
+	{
+		return CRC32C(std::forward<Args>(args)...);
+	}
+
+
 	constexpr UInt32 FNV1a32(const char* str) noexcept
 	{
 		UInt32 hash = Detail::FNV1OffsetBasis_32;
@@ -187,7 +693,7 @@ NAZARA_WARNING_POP()
 	}
 
 	template<typename... Args>
-	UInt32 FNV1a32Hash::operator()(Args&&... args)
+	constexpr UInt32 FNV1a32Hash::operator()(Args&&... args) const
 	{
 		return FNV1a32(std::forward<Args>(args)...);
 	}
@@ -239,9 +745,385 @@ NAZARA_WARNING_POP()
 	}
 
 	template<typename... Args>
-	UInt64 FNV1a64Hash::operator()(Args&&... args)
+	constexpr UInt64 FNV1a64Hash::operator()(Args&&... args) const
 	{
 		return FNV1a64(std::forward<Args>(args)...);
 	}
+
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the wyhash (final version 4) of a string
+	* \return 64bits hash of the string
+	*
+	* \param str Null-terminated string
+	* \param seed Seed of the hash
+	*
+	* \remark wyhash is much faster than FNV-1a on anything but tiny inputs, and better distributed, it's the recommended hash for hash tables
+	*/
+	constexpr UInt64 WyHash64(const char* str, UInt64 seed) noexcept
+	{
+		return WyHash64(std::string_view(str), seed);
+	}
+
+	constexpr UInt64 WyHash64(std::string_view str, UInt64 seed) noexcept
+	{
+		return Detail::WyHash64(str.data(), str.size(), seed);
+	}
+
+	constexpr UInt64 WyHash64(const UInt8* data, std::size_t size, UInt64 seed) noexcept
+	{
+		return Detail::WyHash64(data, size, seed);
+	}
+
+	template<typename... Args>
+	constexpr UInt64 WyHash64Hash::operator()(Args&&... args) const
+	{
+		return WyHash64(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::FastHash
+	* \brief Default hasher of flat hash containers
+	*
+	* Strings are hashed using WyHash64 (and the hasher is transparent, allowing heterogeneous lookup with string views, C strings and HashedStringView).
+	* Pairs and tuples are hashed using HashCombine and other types using std::hash.
+	*
+	* \remark Flat hash containers mix the hash anyway, an identity std::hash (as for integers) is fine
+	*/
+	template<typename T>
+	std::size_t FastHash<T>::operator()(const T& value) const
+	{
+		return Detail::HashValue(value);
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::CRC32Hasher
+	* \brief Computes a CRC32 over data given in multiple chunks
+	*/
+	inline CRC32Hasher::CRC32Hasher() noexcept
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Gets the CRC of the data given so far
+	* \return CRC32 of the concatenation of the chunks
+	*
+	* \remark The hasher can still be updated afterwards
+	*/
+	inline UInt32 CRC32Hasher::Finalize() const noexcept
+	{
+		return ~m_crc;
+	}
+
+	inline void CRC32Hasher::Reset() noexcept
+	{
+		m_crc = 0xFFFFFFFFu;
+	}
+
+	inline void CRC32Hasher::Update(const void* data, std::size_t size) noexcept
+	{
+		m_crc = Detail::CRC32Update(m_crc, static_cast<const UInt8*>(data), size);
+	}
+
+	/*!
+	* \brief Computes the CRC32 of two concatenated buffers from their CRC32
+	* \return CRC32 of A followed by B
+	*
+	* \param crcA CRC32 of the first buffer
+	* \param crcB CRC32 of the second buffer
+	* \param lengthB Size of the second buffer, in bytes
+	*
+	* \remark This allows to hash chunks in parallel, complexity is logarithmic in lengthB
+	*/
+	constexpr UInt32 CRC32Hasher::Combine(UInt32 crcA, UInt32 crcB, UInt64 lengthB) noexcept
+	{
+		return Detail::CRC32Combine(0xEDB88320, crcA, crcB, lengthB);
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::CRC32CHasher
+	* \brief Computes a CRC32C over data given in multiple chunks
+	*/
+	inline CRC32CHasher::CRC32CHasher() noexcept
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Gets the CRC of the data given so far
+	* \return CRC32C of the concatenation of the chunks
+	*
+	* \remark The hasher can still be updated afterwards
+	*/
+	inline UInt32 CRC32CHasher::Finalize() const noexcept
+	{
+		return ~m_crc;
+	}
+
+	inline void CRC32CHasher::Reset() noexcept
+	{
+		m_crc = 0xFFFFFFFFu;
+	}
+
+	inline void CRC32CHasher::Update(const void* data, std::size_t size) noexcept
+	{
+		m_crc = Detail::CRC32CUpdate(m_crc, static_cast<const UInt8*>(data), size);
+	}
+
+	/*!
+	* \brief Computes the CRC32C of two concatenated buffers from their CRC32C
+	* \return CRC32C of A followed by B
+	*
+	* \param crcA CRC32C of the first buffer
+	* \param crcB CRC32C of the second buffer
+	* \param lengthB Size of the second buffer, in bytes
+	*/
+	constexpr UInt32 CRC32CHasher::Combine(UInt32 crcA, UInt32 crcB, UInt64 lengthB) noexcept
+	{
+		return Detail::CRC32Combine(0x82F63B78, crcA, crcB, lengthB);
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::FNV1a64Hasher
+	* \brief Computes a FNV-1a (64bits) hash over data given in multiple chunks
+	*/
+	inline FNV1a64Hasher::FNV1a64Hasher() noexcept
+	{
+		Reset();
+	}
+
+	inline UInt64 FNV1a64Hasher::Finalize() const noexcept
+	{
+		return m_hash;
+	}
+
+	inline void FNV1a64Hasher::Reset() noexcept
+	{
+		m_hash = Detail::FNV1OffsetBasis_64;
+	}
+
+	inline void FNV1a64Hasher::Update(const void* data, std::size_t size) noexcept
+	{
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+
+		UInt64 hash = m_hash;
+		for (std::size_t i = 0u; i < size; ++i)
+		{
+			hash ^= ptr[i];
+			hash *= Detail::FNV1Prime_64;
+		}
+
+		m_hash = hash;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::WyHash64Hasher
+	* \brief Computes a wyhash over data given in multiple chunks
+	*
+	* Every complete 48 bytes block is processed as soon as possible, only the last incomplete block is buffered.
+	*/
+	inline WyHash64Hasher::WyHash64Hasher(UInt64 seed) noexcept :
+	m_seed(seed)
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Gets the hash of the data given so far
+	* \return WyHash64 of the concatenation of the chunks
+	*
+	* \remark The hasher can still be updated afterwards
+	*/
+	inline UInt64 WyHash64Hasher::Finalize() const noexcept
+	{
+		// No block was processed, inputs smaller than 48 bytes are hashed differently
+		if (m_length < BlockSize)
+			return Detail::WyHash64(m_buffer, m_bufferSize, m_seed);
+
+		const UInt64* secret = Detail::WyHashSecret;
+
+		UInt64 seed = m_lanes[0] ^ m_lanes[1] ^ m_lanes[2];
+
+		const UInt8* ptr = m_buffer;
+		std::size_t i = m_bufferSize;
+		for (; i > 16; i -= 16, ptr += 16)
+			seed = Detail::WyMix(Detail::WyRead(ptr, 8) ^ secret[1], Detail::WyRead(ptr + 8, 8) ^ seed);
+
+		// Last 16 bytes of the input, which may start in the last processed block
+		UInt8 tail[TailSize];
+		const UInt8* lastBytes;
+		if (m_bufferSize >= TailSize)
+			lastBytes = m_buffer + m_bufferSize - TailSize;
+		else
+		{
+			std::memcpy(tail, m_previousTail + m_bufferSize, TailSize - m_bufferSize);
+			std::memcpy(tail + TailSize - m_bufferSize, m_buffer, m_bufferSize);
+			lastBytes = tail;
+		}
+
+		UInt64 a = Detail::WyRead(lastBytes, 8) ^ secret[1];
+		UInt64 b = Detail::WyRead(lastBytes + 8, 8) ^ seed;
+		Detail::WyMultiply(a, b);
+
+		return Detail::WyMix(a ^ secret[0] ^ m_length, b ^ secret[1]);
+	}
+
+	inline void WyHash64Hasher::Reset() noexcept
+	{
+		const UInt64* secret = Detail::WyHashSecret;
+		UInt64 seed = m_seed ^ Detail::WyMix(m_seed ^ secret[0], secret[1]);
+
+		m_lanes[0] = seed;
+		m_lanes[1] = seed;
+		m_lanes[2] = seed;
+		m_length = 0;
+		m_bufferSize = 0;
+	}
+
+	inline void WyHash64Hasher::Update(const void* data, std::size_t size) noexcept
+	{
+		if (size == 0)
+			return;
+
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+		m_length += size;
+
+		if (m_bufferSize > 0)
+		{
+			std::size_t copySize = std::min(BlockSize - m_bufferSize, size);
+			std::memcpy(m_buffer + m_bufferSize, ptr, copySize);
+			m_bufferSize += copySize;
+			ptr += copySize;
+			size -= copySize;
+
+			if (m_bufferSize < BlockSize)
+				return;
+
+			ProcessBlock(m_buffer);
+			m_bufferSize = 0;
+		}
+
+		for (; size >= BlockSize; size -= BlockSize, ptr += BlockSize)
+			ProcessBlock(ptr);
+
+		std::memcpy(m_buffer, ptr, size);
+		m_bufferSize = size;
+	}
+
+	inline void WyHash64Hasher::ProcessBlock(const UInt8* block) noexcept
+	{
+		const UInt64* secret = Detail::WyHashSecret;
+
+		m_lanes[0] = Detail::WyMix(Detail::WyRead(block, 8) ^ secret[1], Detail::WyRead(block + 8, 8) ^ m_lanes[0]);
+		m_lanes[1] = Detail::WyMix(Detail::WyRead(block + 16, 8) ^ secret[2], Detail::WyRead(block + 24, 8) ^ m_lanes[1]);
+		m_lanes[2] = Detail::WyMix(Detail::WyRead(block + 32, 8) ^ secret[3], Detail::WyRead(block + 40, 8) ^ m_lanes[2]);
+
+		std::memcpy(m_previousTail, block + BlockSize - TailSize, TailSize);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Hashes the bytes of an object
+	* \return Hash of the object representation
+	*
+	* \param value Object to hash, its type must not have padding bytes (which would make the hash unreliable)
+	*
+	* \remark Hashing a struct this way is much faster than combining the hash of each of its fields
+	*/
+	template<typename T>
+	std::size_t HashObject(const T& value)
+	{
+		static_assert(std::has_unique_object_representations_v<T>, "type must be trivially copyable and have no padding bytes");
+		return static_cast<std::size_t>(WyHash64(reinterpret_cast<const UInt8*>(std::addressof(value)), sizeof(T)));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Hashes every element of a range
+	* \return Hash of the range
+	*
+	* \param range Range to hash (must be compatible with std::begin/std::end)
+	*
+	* \see HashRange(It, It)
+	*/
+	template<typename Range>
+	std::size_t HashRange(const Range& range)
+	{
+		if constexpr (Detail::IsContiguousRange<Range>::value)
+		{
+			auto first = std::data(range);
+			return HashRange(first, first + std::size(range));
+		}
+		else
+			return HashRange(std::begin(range), std::end(range));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Hashes every element of a range
+	* \return Hash of the range
+	*
+	* \param first Iterator to the first element
+	* \param last Iterator past the last element
+	*
+	* \remark Contiguous ranges of types without padding are hashed as a single byte buffer
+	* \remark Other ranges hash each element with std::hash (or TupleHash) and feed the results to an incremental wyhash, which is faster than a HashCombine chain
+	*/
+	template<typename It>
+	std::size_t HashRange(It first, It last)
+	{
+		using T = typename std::iterator_traits<It>::value_type;
+
+		if constexpr (Detail::IsContiguousIterator<It>() && std::has_unique_object_representations_v<T>)
+		{
+			if (first == last)
+				return static_cast<std::size_t>(WyHash64(static_cast<const UInt8*>(nullptr), 0));
+
+			std::size_t size = static_cast<std::size_t>(last - first) * sizeof(T);
+			return static_cast<std::size_t>(WyHash64(reinterpret_cast<const UInt8*>(std::addressof(*first)), size));
+		}
+		else
+		{
+			WyHash64Hasher hasher;
+
+			std::array<UInt64, 6> hashes; //< 48 bytes, the block size of wyhash
+			std::size_t hashCount = 0;
+			for (; first != last; ++first)
+			{
+				hashes[hashCount++] = Detail::HashValue(*first);
+				if (hashCount == hashes.size())
+				{
+					hasher.Update(hashes.data(), sizeof(hashes));
+					hashCount = 0;
+				}
+			}
+
+			hasher.Update(hashes.data(), hashCount * sizeof(UInt64));
+			return static_cast<std::size_t>(hasher.Finalize());
+		}
+	}
+
+	template<typename... Args>
+	std::size_t TupleHash::operator()(const std::tuple<Args...>& tuple) const
+	{
+		return Detail::HashValue(tuple);
+	}
+
+	template<typename First, typename Second>
+	std::size_t TupleHash::operator()(const std::pair<First, Second>& pair) const
+	{
+		return Detail::HashValue(pair);
+	}
 }
 
+#undef NAZARA_HASH_TARGET
@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_HASHEDSTRING_HPP
+#define NAZARAUTILS_HASHEDSTRING_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Nz
+{
+	template<typename T = char, typename H = WyHash64Hash>
+	class BasicHashedStringView
+	{
+		public:
+			using hash_type = H;
+
+			constexpr explicit BasicHashedStringView(const T* str);
+			constexpr explicit BasicHashedStringView(std::basic_string_view<T> str);
+			constexpr BasicHashedStringView(std::basic_string_view<T> str, std::size_t hash);
+			constexpr BasicHashedStringView(const BasicHashedStringView&) = default;
+			constexpr BasicHashedStringView(BasicHashedStringView&&) noexcept = default;
+			~BasicHashedStringView() = default;
+
+			constexpr std::size_t GetHash() const;
+			constexpr std::basic_string_view<T> GetString() const;
+
+			constexpr BasicHashedStringView& operator=(const BasicHashedStringView&) = default;
+			constexpr BasicHashedStringView& operator=(BasicHashedStringView&&) noexcept = default;
+
+			friend constexpr bool operator==(const BasicHashedStringView& lhs, const BasicHashedStringView& rhs) { return lhs.m_hash == rhs.m_hash && lhs.m_str == rhs.m_str; }
+			friend constexpr bool operator==(const BasicHashedStringView& lhs, std::basic_string_view<T> rhs) { return lhs.m_str == rhs; }
+			friend constexpr bool operator==(std::basic_string_view<T> lhs, const BasicHashedStringView& rhs) { return lhs == rhs.m_str; }
+			friend constexpr bool operator!=(const BasicHashedStringView& lhs, const BasicHashedStringView& rhs) { return !(lhs == rhs); }
+			friend constexpr bool operator!=(const BasicHashedStringView& lhs, std::basic_string_view<T> rhs) { return !(lhs == rhs); }
+			friend constexpr bool operator!=(std::basic_string_view<T> lhs, const BasicHashedStringView& rhs) { return !(lhs == rhs); }
+
+		private:
+			std::basic_string_view<T> m_str;
+			std::size_t m_hash;
+	};
+
+	template<typename T = char, typename H = WyHash64Hash, typename Allocator = std::allocator<T>>
+	class BasicHashedString
+	{
+		public:
+			using hash_type = H;
+			using string_type = std::basic_string<T, std::char_traits<T>, Allocator>;
+
+			explicit BasicHashedString(const T* str);
+			explicit BasicHashedString(std::basic_string_view<T> str);
+			explicit BasicHashedString(string_type str);
+			explicit BasicHashedString(BasicHashedStringView<T, H> str);
+			BasicHashedString(const BasicHashedString&) = default;
+			BasicHashedString(BasicHashedString&&) noexcept = default;
+			~BasicHashedString() = default;
+
+			std::size_t GetHash() const;
+			const string_type& GetString() const;
+
+			operator BasicHashedStringView<T, H>() const;
+
+			BasicHashedString& operator=(const BasicHashedString&) = default;
+			BasicHashedString& operator=(BasicHashedString&&) noexcept = default;
+
+			friend bool operator==(const BasicHashedString& lhs, const BasicHashedString& rhs) { return lhs.m_hash == rhs.m_hash && lhs.m_str == rhs.m_str; }
+			friend bool operator==(const BasicHashedString& lhs, std::basic_string_view<T> rhs) { return lhs.m_str == rhs; }
+			friend bool operator==(std::basic_string_view<T> lhs, const BasicHashedString& rhs) { return lhs == rhs.m_str; }
+			friend bool operator!=(const BasicHashedString& lhs, const BasicHashedString& rhs) { return !(lhs == rhs); }
+			friend bool operator!=(const BasicHashedString& lhs, std::basic_string_view<T> rhs) { return !(lhs == rhs); }
+			friend bool operator!=(std::basic_string_view<T> lhs, const BasicHashedString& rhs) { return !(lhs == rhs); }
+
+		private:
+			string_type m_str;
+			std::size_t m_hash;
+	};
+
+	using HashedString = BasicHashedString<char>;
+	using HashedStringView = BasicHashedStringView<char>;
+}
+
+#include <NazaraUtils/HashedString.inl>
+
+#endif // NAZARAUTILS_HASHEDSTRING_HPP
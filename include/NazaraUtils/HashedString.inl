@@ -0,0 +1,126 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/HashedString.hpp>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::BasicHashedStringView
+	* \brief Non-owning string view carrying its hash, usable as a heterogeneous key with StringHash<T, H> without rehashing
+	*
+	* \tparam T Character type
+	* \tparam H Hasher, which must be the one used by the StringHash of the container (the hash is computed at compile-time if H supports it, as WyHash64Hash does)
+	*
+	* \remark constexpr Nz::HashedStringView key("MaterialName"); map.find(key); won't hash anything at runtime
+	*/
+
+	/*!
+	* \brief Constructs the view from a null-terminated string, hashing it
+	*
+	* \param str Null-terminated string, which must outlive the view
+	*/
+	template<typename T, typename H>
+	constexpr BasicHashedStringView<T, H>::BasicHashedStringView(const T* str) :
+	BasicHashedStringView(std::basic_string_view<T>(str))
+	{
+	}
+
+	/*!
+	* \brief Constructs the view from a string, hashing it
+	*
+	* \param str String, which must outlive the view
+	*/
+	template<typename T, typename H>
+	constexpr BasicHashedStringView<T, H>::BasicHashedStringView(std::basic_string_view<T> str) :
+	m_str(str),
+	m_hash(static_cast<std::size_t>(hash_type{}(str)))
+	{
+	}
+
+	/*!
+	* \brief Constructs the view from a string and its precomputed hash
+	*
+	* \param str String, which must outlive the view
+	* \param hash Hash of str, as computed by H
+	*/
+	template<typename T, typename H>
+	constexpr BasicHashedStringView<T, H>::BasicHashedStringView(std::basic_string_view<T> str, std::size_t hash) :
+	m_str(str),
+	m_hash(hash)
+	{
+	}
+
+	template<typename T, typename H>
+	constexpr std::size_t BasicHashedStringView<T, H>::GetHash() const
+	{
+		return m_hash;
+	}
+
+	template<typename T, typename H>
+	constexpr std::basic_string_view<T> BasicHashedStringView<T, H>::GetString() const
+	{
+		return m_str;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::BasicHashedString
+	* \brief String owning its content and carrying its hash, usable as a key with StringHash<T, H> without rehashing
+	*
+	* \tparam T Character type
+	* \tparam H Hasher, which must be the one used by the StringHash of the container
+	* \tparam Allocator Allocator of the string
+	*/
+
+	template<typename T, typename H, typename Allocator>
+	BasicHashedString<T, H, Allocator>::BasicHashedString(const T* str) :
+	BasicHashedString(string_type(str))
+	{
+	}
+
+	template<typename T, typename H, typename Allocator>
+	BasicHashedString<T, H, Allocator>::BasicHashedString(std::basic_string_view<T> str) :
+	BasicHashedString(string_type(str))
+	{
+	}
+
+	template<typename T, typename H, typename Allocator>
+	BasicHashedString<T, H, Allocator>::BasicHashedString(string_type str) :
+	m_str(std::move(str)),
+	m_hash(static_cast<std::size_t>(hash_type{}(std::basic_string_view<T>(m_str))))
+	{
+	}
+
+	/*!
+	* \brief Constructs the string by copying a hashed view, reusing its hash
+	*/
+	template<typename T, typename H, typename Allocator>
+	BasicHashedString<T, H, Allocator>::BasicHashedString(BasicHashedStringView<T, H> str) :
+	m_str(str.GetString()),
+	m_hash(str.GetHash())
+	{
+	}
+
+	template<typename T, typename H, typename Allocator>
+	std::size_t BasicHashedString<T, H, Allocator>::GetHash() const
+	{
+		return m_hash;
+	}
+
+	template<typename T, typename H, typename Allocator>
+	auto BasicHashedString<T, H, Allocator>::GetString() const -> const string_type&
+	{
+		return m_str;
+	}
+
+	template<typename T, typename H, typename Allocator>
+	BasicHashedString<T, H, Allocator>::operator BasicHashedStringView<T, H>() const
+	{
+		return BasicHashedStringView<T, H>(m_str, m_hash);
+	}
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_HIERARCHICALBITSET_HPP
+#define NAZARAUTILS_HIERARCHICALBITSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/BitKernels.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename Block = UInt64, class Allocator = std::allocator<Block>>
+	class HierarchicalBitset
+	{
+		static_assert(std::is_integral<Block>::value && std::is_unsigned<Block>::value, "Block must be a unsigned integral type");
+
+		public:
+			class BitIterator;
+			struct bits_const_iter_tag;
+
+			HierarchicalBitset();
+			explicit HierarchicalBitset(const Allocator& allocator);
+			explicit HierarchicalBitset(std::size_t bitCount, bool val = false, const Allocator& allocator = Allocator());
+			HierarchicalBitset(const HierarchicalBitset& bitset) = default;
+			HierarchicalBitset(HierarchicalBitset&& bitset) noexcept = default;
+			~HierarchicalBitset() noexcept = default;
+
+			void Clear() noexcept;
+			std::size_t Count() const;
+
+			std::size_t FindFirst() const;
+			std::size_t FindNext(std::size_t bit) const;
+
+			Block GetBlock(std::size_t i) const;
+			std::size_t GetBlockCount() const;
+			std::size_t GetLevelCount() const;
+			std::size_t GetSize() const;
+
+			constexpr bits_const_iter_tag IterBits() const noexcept;
+
+			void Resize(std::size_t bitCount, bool defaultVal = false);
+
+			void Reset();
+			void Reset(std::size_t bit);
+
+			void Set(bool val = true);
+			void Set(std::size_t bit, bool val = true);
+
+			void Swap(HierarchicalBitset& bitset) noexcept;
+
+			bool Test(std::size_t bit) const;
+			bool TestAny() const;
+			bool TestNone() const;
+
+			std::string ToString() const;
+
+			void UnboundedReset(std::size_t bit);
+			void UnboundedSet(std::size_t bit, bool val = true);
+			bool UnboundedTest(std::size_t bit) const;
+
+			bool operator[](std::size_t index) const;
+
+			HierarchicalBitset& operator=(const HierarchicalBitset& bitset) = default;
+			HierarchicalBitset& operator=(HierarchicalBitset&& bitset) noexcept = default;
+
+			static constexpr Block fullBitMask = std::numeric_limits<Block>::max();
+			static constexpr std::size_t bitsPerBlock = BitCount<Block>();
+			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+			struct bits_const_iter_tag
+			{
+				constexpr BitIterator begin() const noexcept;
+				constexpr BitIterator end() const noexcept;
+
+				const HierarchicalBitset& bitsetRef;
+			};
+
+		private:
+			void BuildSummaries();
+			std::size_t FindFrom(std::size_t bit) const;
+			std::size_t GetLevelBlockCount(std::size_t level) const;
+			void ResetExtraBits();
+
+			static std::size_t ComputeBlockCount(std::size_t bitCount);
+
+			// Each level has one bit per block of the level below, the first level being the bits themselves
+			static constexpr std::size_t MaxLevelCount = (BitCount<std::size_t>() + IntegralLog2Pot(bitsPerBlock) - 1) / IntegralLog2Pot(bitsPerBlock) + 1;
+
+			std::array<std::size_t, MaxLevelCount + 1> m_levelOffsets; //< Offset of each level in m_blocks, followed by the total block count
+			std::vector<Block, Allocator> m_blocks; //< Every level, from the bits (level 0) to the single top block
+			std::size_t m_bitCount;
+			std::size_t m_levelCount;
+	};
+
+	template<typename Block, class Allocator>
+	class HierarchicalBitset<Block, Allocator>::BitIterator
+	{
+		friend HierarchicalBitset;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::size_t;
+
+			constexpr BitIterator(const BitIterator&) = default;
+			constexpr BitIterator(BitIterator&&) noexcept = default;
+
+			constexpr BitIterator& operator=(const BitIterator&) = default;
+			constexpr BitIterator& operator=(BitIterator&&) noexcept = default;
+
+			BitIterator operator++(int);
+			BitIterator& operator++();
+
+			constexpr bool operator==(const BitIterator& rhs) const;
+			constexpr bool operator!=(const BitIterator& rhs) const;
+			constexpr value_type operator*() const;
+
+		private:
+			constexpr BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex);
+
+			std::size_t m_bitIndex;
+			const HierarchicalBitset* m_owner;
+	};
+}
+
+namespace std
+{
+	template<typename Block, class Allocator>
+	void swap(Nz::HierarchicalBitset<Block, Allocator>& lhs, Nz::HierarchicalBitset<Block, Allocator>& rhs) noexcept;
+}
+
+#include <NazaraUtils/HierarchicalBitset.inl>
+
+#endif // NAZARAUTILS_HIERARCHICALBITSET_HPP
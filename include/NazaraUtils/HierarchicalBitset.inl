@@ -0,0 +1,593 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::HierarchicalBitset
+	* \brief Core class that represents a set of bits along with summary levels to quickly find set bits
+	*
+	* Each summary level has one bit per block of the level below it, set if that block has any bit set, up to a single top block.
+	* This makes FindFirst/FindNext cost O(log(n) / log(bitsPerBlock)) block reads instead of scanning every block, at the price of
+	* updating up to one block per level in Set/Reset (usually only the first one) and about 1/bitsPerBlock of additional memory.
+	*
+	* This is well suited to large sparse bitsets which are frequently iterated, for dense bitsets or bulk operations prefer Bitset.
+	*
+	* \see Bitset
+	*/
+
+	/*!
+	* \brief Constructs a HierarchicalBitset object by default
+	*/
+	template<typename Block, class Allocator>
+	HierarchicalBitset<Block, Allocator>::HierarchicalBitset() :
+	HierarchicalBitset(Allocator())
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty HierarchicalBitset object using an allocator
+	*
+	* \param allocator Allocator used for the bitset storage
+	*/
+	template<typename Block, class Allocator>
+	HierarchicalBitset<Block, Allocator>::HierarchicalBitset(const Allocator& allocator) :
+	m_levelOffsets{},
+	m_blocks(allocator),
+	m_bitCount(0),
+	m_levelCount(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a HierarchicalBitset object of bitCount bits to value val
+	*
+	* \param bitCount Number of bits
+	* \param val Value of those bits, by default false
+	* \param allocator Allocator used for the bitset storage
+	*/
+	template<typename Block, class Allocator>
+	HierarchicalBitset<Block, Allocator>::HierarchicalBitset(std::size_t bitCount, bool val, const Allocator& allocator) :
+	HierarchicalBitset(allocator)
+	{
+		Resize(bitCount, val);
+	}
+
+	/*!
+	* \brief Clears the content of the bitset
+	*
+	* This function clears the bitset content, resetting its bit and block count at zero.
+	*
+	* \remark This does not changes the bits values to zero but empties the bitset, to reset the bits use the Reset() function
+	* \remark This call does not changes the bitset capacity
+	*
+	* \see Reset()
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Clear() noexcept
+	{
+		m_bitCount = 0;
+		m_blocks.clear();
+		m_levelCount = 0;
+		m_levelOffsets.fill(0);
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1
+	* \return Number of bits set to 1
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::Count() const
+	{
+		return BitKernels::Count(m_blocks.data(), GetBlockCount() * sizeof(Block));
+	}
+
+	/*!
+	* \brief Finds the first bit set to one in the bitset
+	* \return The 0-based index of the first bit enabled, or npos if none is
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::FindFirst() const
+	{
+		return FindFrom(0);
+	}
+
+	/*!
+	* \brief Finds the next enabled in the bitset
+	* \return Index of the next enabled bit or npos if all the following bits are disabled
+	*
+	* \param bit Index of the last bit found, which will not be treated by this function
+	*
+	* \remark This only reads one block per level in the worst case, instead of every block between bit and the next enabled bit
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::FindNext(std::size_t bit) const
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		return FindFrom(bit + 1);
+	}
+
+	/*!
+	* \brief Gets the ith block of bits
+	* \return Block in the bitset
+	*
+	* \param i Index of the block
+	*
+	* \remark Summary levels are not accessible through this function
+	*/
+	template<typename Block, class Allocator>
+	Block HierarchicalBitset<Block, Allocator>::GetBlock(std::size_t i) const
+	{
+		assert(i < GetBlockCount() && "Block index out of range");
+
+		return m_blocks[i];
+	}
+
+	/*!
+	* \brief Gets the number of blocks holding the bits
+	* \return Number of blocks, excluding summary levels
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::GetBlockCount() const
+	{
+		return GetLevelBlockCount(0);
+	}
+
+	/*!
+	* \brief Gets the number of levels of the bitset
+	* \return Number of levels, including the one holding the bits (zero if the bitset is empty)
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::GetLevelCount() const
+	{
+		return m_levelCount;
+	}
+
+	/*!
+	* \brief Gets the number of bits
+	* \return Number of bits
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::GetSize() const
+	{
+		return m_bitCount;
+	}
+
+	template<typename Block, class Allocator>
+	constexpr auto HierarchicalBitset<Block, Allocator>::IterBits() const noexcept -> bits_const_iter_tag
+	{
+		return bits_const_iter_tag{ *this };
+	}
+
+	/*!
+	* \brief Resizes the bitset to the size of bitCount
+	*
+	* \param bitCount Number of bits
+	* \param defaultVal Value of the bits if new size is greather than the old one
+	*
+	* \remark Summary levels are rebuilt, which costs O(GetBlockCount())
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Resize(std::size_t bitCount, bool defaultVal)
+	{
+		// Drop summary levels, bits are stored first
+		m_blocks.resize(GetBlockCount());
+
+		// Enabling the bits of the last block past the old size
+		if (defaultVal && bitCount > m_bitCount && (m_bitCount % bitsPerBlock) != 0)
+			m_blocks.back() |= fullBitMask << (m_bitCount % bitsPerBlock);
+
+		m_blocks.resize(ComputeBlockCount(bitCount), (defaultVal) ? fullBitMask : Block(0U));
+		m_bitCount = bitCount;
+
+		ResetExtraBits();
+		BuildSummaries();
+	}
+
+	/*!
+	* \brief Resets the bitset to zero bits
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Reset()
+	{
+		Set(false);
+	}
+
+	/*!
+	* \brief Resets the bit at the index
+	*
+	* \param bit Index of the bit
+	*
+	* \see UnboundReset
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Reset(std::size_t bit)
+	{
+		Set(bit, false);
+	}
+
+	/*!
+	* \brief Sets the bitset to val
+	*
+	* \param val Value of the bits
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Set(bool val)
+	{
+		m_blocks.resize(GetBlockCount());
+		std::fill(m_blocks.begin(), m_blocks.end(), (val) ? fullBitMask : Block(0U));
+
+		ResetExtraBits();
+		BuildSummaries();
+	}
+
+	/*!
+	* \brief Sets the bit at the index
+	*
+	* \param bit Index of the bit
+	* \param val Value of the bit
+	*
+	* \remark Summary levels are only updated when a block becomes empty or stops being empty
+	*
+	* \see UnboundSet
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Set(std::size_t bit, bool val)
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		std::size_t index = bit;
+		for (std::size_t level = 0; level < m_levelCount; ++level)
+		{
+			Block& block = m_blocks[m_levelOffsets[level] + index / bitsPerBlock];
+			Block mask = Block(1U) << (index % bitsPerBlock);
+
+			if (val)
+			{
+				bool wasEmpty = (block == 0);
+				block |= mask;
+
+				// Parent bit is already set
+				if (!wasEmpty)
+					break;
+			}
+			else
+			{
+				if ((block & mask) == 0)
+					break;
+
+				block &= ~mask;
+
+				// Parent bit must stay set
+				if (block != 0)
+					break;
+			}
+
+			index /= bitsPerBlock;
+		}
+	}
+
+	/*!
+	* \brief Swaps the two bitsets
+	*
+	* \param bitset Other bitset to swap
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::Swap(HierarchicalBitset& bitset) noexcept
+	{
+		std::swap(m_bitCount,     bitset.m_bitCount);
+		std::swap(m_blocks,       bitset.m_blocks);
+		std::swap(m_levelCount,   bitset.m_levelCount);
+		std::swap(m_levelOffsets, bitset.m_levelOffsets);
+	}
+
+	/*!
+	* \brief Tests the ith bit
+	* \return true if bit is set
+	*
+	* \param bit Index of the bit
+	*
+	* \see UnboundTest
+	*/
+	template<typename Block, class Allocator>
+	bool HierarchicalBitset<Block, Allocator>::Test(std::size_t bit) const
+	{
+		assert(bit < m_bitCount && "Bit index out of range");
+
+		return (m_blocks[bit / bitsPerBlock] & (Block(1U) << (bit % bitsPerBlock))) != 0;
+	}
+
+	/*!
+	* \brief Tests if one bit is set
+	* \return true if one bit is set
+	*
+	* \remark This only reads the top summary block
+	*/
+	template<typename Block, class Allocator>
+	bool HierarchicalBitset<Block, Allocator>::TestAny() const
+	{
+		if (m_levelCount == 0)
+			return false;
+
+		return m_blocks[m_levelOffsets[m_levelCount - 1]] != 0;
+	}
+
+	/*!
+	* \brief Tests if one bit is not set
+	* \return true if one bit is not set
+	*/
+	template<typename Block, class Allocator>
+	bool HierarchicalBitset<Block, Allocator>::TestNone() const
+	{
+		return !TestAny();
+	}
+
+	/*!
+	* \brief Gives a string representation
+	* \return A string representation of the object with only '0' and '1'
+	*/
+	template<typename Block, class Allocator>
+	std::string HierarchicalBitset<Block, Allocator>::ToString() const
+	{
+		std::string str(m_bitCount, '0');
+
+		for (std::size_t i = 0; i < m_bitCount; ++i)
+		{
+			if (Test(i))
+				str[m_bitCount - i - 1] = '1';
+		}
+
+		return str;
+	}
+
+	/*!
+	* \brief Resets the bit at the index
+	*
+	* \param bit Index of the bit
+	*
+	* \see Reset
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::UnboundedReset(std::size_t bit)
+	{
+		UnboundedSet(bit, false);
+	}
+
+	/*!
+	* \brief Sets the bit at the index
+	*
+	* \param bit Index of the bit
+	* \param val Value of the bit
+	*
+	* \remark if bit is greater than the number of bits, the bitset is enlarged and the added bits are set to false and the one at bit is set to val
+	* \remark Enlarging the bitset rebuilds its summary levels, prefer calling Resize beforehand when the final size is known
+	*
+	* \see Set
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::UnboundedSet(std::size_t bit, bool val)
+	{
+		if NAZARA_LIKELY(bit < m_bitCount)
+			Set(bit, val);
+		else if (val)
+		{
+			Resize(bit + 1, false);
+			Set(bit, true);
+		}
+	}
+
+	/*!
+	* \brief Tests the ith bit
+	* \return true if bit is set
+	*
+	* \param bit Index of the bit
+	*
+	* \see Test
+	*/
+	template<typename Block, class Allocator>
+	bool HierarchicalBitset<Block, Allocator>::UnboundedTest(std::size_t bit) const
+	{
+		if NAZARA_LIKELY(bit < m_bitCount)
+			return Test(bit);
+		else
+			return false;
+	}
+
+	/*!
+	* \brief Gets the ith bit
+	* \return bit in ith position
+	*/
+	template<typename Block, class Allocator>
+	bool HierarchicalBitset<Block, Allocator>::operator[](std::size_t index) const
+	{
+		return Test(index);
+	}
+
+	/*!
+	* \brief Builds summary levels from the bits, which must be the only blocks stored
+	*/
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::BuildSummaries()
+	{
+		std::size_t levelBlockCount = m_blocks.size();
+		assert(levelBlockCount == ComputeBlockCount(m_bitCount));
+
+		// Offsets above the new level count must not keep the values of a previous (larger) layout
+		m_levelCount = 0;
+		m_levelOffsets.fill(0);
+
+		std::size_t totalBlockCount = levelBlockCount;
+		if (levelBlockCount > 0)
+		{
+			m_levelCount = 1;
+			while (levelBlockCount > 1)
+			{
+				assert(m_levelCount < MaxLevelCount);
+				m_levelOffsets[m_levelCount++] = totalBlockCount;
+
+				levelBlockCount = ComputeBlockCount(levelBlockCount);
+				totalBlockCount += levelBlockCount;
+			}
+		}
+		m_levelOffsets[m_levelCount] = totalBlockCount;
+
+		m_blocks.resize(totalBlockCount, Block(0U));
+
+		for (std::size_t level = 1; level < m_levelCount; ++level)
+		{
+			const Block* childBlocks = &m_blocks[m_levelOffsets[level - 1]];
+			Block* parentBlocks = &m_blocks[m_levelOffsets[level]];
+
+			std::size_t childBlockCount = GetLevelBlockCount(level - 1);
+			for (std::size_t i = 0; i < childBlockCount; ++i)
+			{
+				if (childBlocks[i] != 0)
+					parentBlocks[i / bitsPerBlock] |= Block(1U) << (i % bitsPerBlock);
+			}
+		}
+	}
+
+	/*!
+	* \brief Finds the first enabled bit starting from a bit index (included)
+	* \return Index of the enabled bit or npos if all the following bits are disabled
+	*
+	* \param bit First bit to check
+	*/
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::FindFrom(std::size_t bit) const
+	{
+		// Go up until we find a block with an enabled bit at or after our position
+		std::size_t level = 0;
+		std::size_t index = bit;
+		for (;;)
+		{
+			if (level >= m_levelCount)
+				return npos;
+
+			std::size_t blockIndex = index / bitsPerBlock;
+			if (blockIndex >= GetLevelBlockCount(level))
+				return npos;
+
+			Block block = m_blocks[m_levelOffsets[level] + blockIndex] & (fullBitMask << (index % bitsPerBlock));
+			if (block != 0)
+			{
+				index = blockIndex * bitsPerBlock + FindFirstBit(block) - 1;
+				break;
+			}
+
+			// Continue with the next block of this level, which is the next bit of the level above
+			index = blockIndex + 1;
+			level++;
+		}
+
+		// Go down by following the first enabled bit of each block
+		while (level > 0)
+		{
+			level--;
+
+			Block block = m_blocks[m_levelOffsets[level] + index];
+			assert(block != 0);
+
+			index = index * bitsPerBlock + FindFirstBit(block) - 1;
+		}
+
+		return index;
+	}
+
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::GetLevelBlockCount(std::size_t level) const
+	{
+		return m_levelOffsets[level + 1] - m_levelOffsets[level];
+	}
+
+	template<typename Block, class Allocator>
+	void HierarchicalBitset<Block, Allocator>::ResetExtraBits()
+	{
+		std::size_t bitIndex = m_bitCount % bitsPerBlock;
+		if (bitIndex != 0)
+			m_blocks[ComputeBlockCount(m_bitCount) - 1] &= (Block(1U) << bitIndex) - 1U;
+	}
+
+	template<typename Block, class Allocator>
+	std::size_t HierarchicalBitset<Block, Allocator>::ComputeBlockCount(std::size_t bitCount)
+	{
+		return (bitCount + bitsPerBlock - 1) / bitsPerBlock;
+	}
+
+
+	template<typename Block, class Allocator>
+	constexpr auto HierarchicalBitset<Block, Allocator>::bits_const_iter_tag::begin() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, bitsetRef.FindFirst());
+	}
+
+	template<typename Block, class Allocator>
+	constexpr auto HierarchicalBitset<Block, Allocator>::bits_const_iter_tag::end() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, bitsetRef.npos);
+	}
+
+
+	template<typename Block, class Allocator>
+	constexpr HierarchicalBitset<Block, Allocator>::BitIterator::BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex) :
+	m_bitIndex(bitIndex),
+	m_owner(&bitsetTag.bitsetRef)
+	{
+	}
+
+	template<typename Block, class Allocator>
+	auto HierarchicalBitset<Block, Allocator>::BitIterator::operator++(int) -> BitIterator
+	{
+		BitIterator copy(*this);
+		++copy;
+		return copy;
+	}
+
+	template<typename Block, class Allocator>
+	auto HierarchicalBitset<Block, Allocator>::BitIterator::operator++() -> BitIterator&
+	{
+		m_bitIndex = m_owner->FindNext(m_bitIndex);
+		return *this;
+	}
+
+	template<typename Block, class Allocator>
+	constexpr bool HierarchicalBitset<Block, Allocator>::BitIterator::operator==(const BitIterator& rhs) const
+	{
+		return m_bitIndex == rhs.m_bitIndex;
+	}
+
+	template<typename Block, class Allocator>
+	constexpr bool HierarchicalBitset<Block, Allocator>::BitIterator::operator!=(const BitIterator& rhs) const
+	{
+		return m_bitIndex != rhs.m_bitIndex;
+	}
+
+	template<typename Block, class Allocator>
+	constexpr auto HierarchicalBitset<Block, Allocator>::BitIterator::operator*() const -> value_type
+	{
+		return m_bitIndex;
+	}
+}
+
+namespace std
+{
+	/*!
+	* \ingroup utils
+	* \brief Swaps two bitsets, specialisation of std
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<typename Block, class Allocator>
+	void swap(Nz::HierarchicalBitset<Block, Allocator>& lhs, Nz::HierarchicalBitset<Block, Allocator>& rhs) noexcept
+	{
+		lhs.Swap(rhs);
+	}
+}
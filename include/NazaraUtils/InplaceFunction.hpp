@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_INPLACEFUNCTION_HPP
+#define NAZARAUTILS_INPLACEFUNCTION_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity = 4 * sizeof(void*)>
+	class InplaceFunction;
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	class InplaceFunction<Ret(Args...), Capacity>
+	{
+		public:
+			InplaceFunction() noexcept;
+			InplaceFunction(std::nullptr_t) noexcept;
+			template<typename F, typename = std::enable_if_t<std::is_invocable_r_v<Ret, std::decay_t<F>&, Args...> && !std::is_same_v<std::decay_t<F>, InplaceFunction>>> InplaceFunction(F&& f);
+			InplaceFunction(const InplaceFunction& function);
+			InplaceFunction(InplaceFunction&& function) noexcept;
+			~InplaceFunction();
+
+			Ret operator()(Args... args) const;
+
+			explicit operator bool() const noexcept;
+
+			InplaceFunction& operator=(std::nullptr_t) noexcept;
+			InplaceFunction& operator=(const InplaceFunction& function);
+			InplaceFunction& operator=(InplaceFunction&& function) noexcept;
+
+			template<typename F> static constexpr bool IsStoredInline();
+
+			static constexpr std::size_t BufferSize = Capacity;
+			static constexpr std::size_t BufferAlignment = alignof(std::max_align_t);
+
+		private:
+			enum class Operation
+			{
+				Copy,
+				Destroy,
+				Move //< Moves and destroys the source
+			};
+
+			using Invoker = Ret(*)(void* storage, Args&&... args);
+			using Manager = void(*)(Operation operation, void* storage, void* otherStorage);
+
+			template<typename F> static Ret Invoke(void* storage, Args&&... args);
+			template<typename F> static void Manage(Operation operation, void* storage, void* otherStorage);
+
+			void Reset() noexcept;
+
+			mutable std::aligned_storage_t<Capacity, BufferAlignment> m_storage;
+			Invoker m_invoker;
+			Manager m_manager;
+	};
+}
+
+#include <NazaraUtils/InplaceFunction.inl>
+
+#endif // NAZARAUTILS_INPLACEFUNCTION_HPP
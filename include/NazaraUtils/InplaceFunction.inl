@@ -0,0 +1,239 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::InplaceFunction
+	* \brief Owning type-erased callable storing its target in an internal buffer, similar to std::function
+	*
+	* Callables fitting in the buffer (and nothrow move-constructible) are constructed in-place and never trigger
+	* a heap allocation, bigger callables are allocated on the heap.
+	*
+	* \remark Capacity of the internal buffer can be increased with the second template parameter, IsStoredInline tells if a callable type fits in it
+	*/
+
+	/*!
+	* \brief Constructs an empty InplaceFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction() noexcept :
+	m_invoker(nullptr),
+	m_manager(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty InplaceFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(std::nullptr_t) noexcept :
+	InplaceFunction()
+	{
+	}
+
+	/*!
+	* \brief Constructs an InplaceFunction storing a copy of a callable
+	*
+	* \param f Callable to store, null function and member pointers result in an empty InplaceFunction
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F, typename>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(F&& f) :
+	InplaceFunction()
+	{
+		using Functor = std::decay_t<F>;
+
+		// function references decay to pointers but can't be null
+		if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<Functor>)
+		{
+			if (f == nullptr)
+				return;
+		}
+
+		if constexpr (IsStoredInline<Functor>())
+			new (&m_storage) Functor(std::forward<F>(f));
+		else
+			*reinterpret_cast<Functor**>(&m_storage) = new Functor(std::forward<F>(f));
+
+		m_invoker = &Invoke<Functor>;
+		m_manager = &Manage<Functor>;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(const InplaceFunction& function) :
+	InplaceFunction()
+	{
+		if (function.m_manager)
+		{
+			function.m_manager(Operation::Copy, &m_storage, &function.m_storage);
+			m_invoker = function.m_invoker;
+			m_manager = function.m_manager;
+		}
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(InplaceFunction&& function) noexcept :
+	InplaceFunction()
+	{
+		operator=(std::move(function));
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::~InplaceFunction()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Calls the stored callable
+	* \return Value returned by the callable
+	*
+	* \param args Arguments passed to the callable
+	*
+	* \remark The InplaceFunction must not be empty
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	Ret InplaceFunction<Ret(Args...), Capacity>::operator()(Args... args) const
+	{
+		assert(m_invoker && "calling an empty InplaceFunction");
+		return m_invoker(&m_storage, std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Checks if the InplaceFunction stores a callable
+	* \return True if a callable is stored
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::operator bool() const noexcept
+	{
+		return m_invoker != nullptr;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto InplaceFunction<Ret(Args...), Capacity>::operator=(std::nullptr_t) noexcept -> InplaceFunction&
+	{
+		Reset();
+		return *this;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto InplaceFunction<Ret(Args...), Capacity>::operator=(const InplaceFunction& function) -> InplaceFunction&
+	{
+		if (this != &function)
+		{
+			InplaceFunction copy(function);
+			operator=(std::move(copy));
+		}
+
+		return *this;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto InplaceFunction<Ret(Args...), Capacity>::operator=(InplaceFunction&& function) noexcept -> InplaceFunction&
+	{
+		if (this != &function)
+		{
+			Reset();
+
+			if (function.m_manager)
+			{
+				function.m_manager(Operation::Move, &m_storage, &function.m_storage);
+				m_invoker = std::exchange(function.m_invoker, nullptr);
+				m_manager = std::exchange(function.m_manager, nullptr);
+			}
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Checks if a callable type would be stored in the internal buffer
+	* \return True if a callable of type F is stored without heap allocation
+	*/
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	constexpr bool InplaceFunction<Ret(Args...), Capacity>::IsStoredInline()
+	{
+		using Functor = std::decay_t<F>;
+		return sizeof(Functor) <= Capacity && alignof(Functor) <= BufferAlignment && std::is_nothrow_move_constructible_v<Functor>;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	Ret InplaceFunction<Ret(Args...), Capacity>::Invoke(void* storage, Args&&... args)
+	{
+		F* functor;
+		if constexpr (IsStoredInline<F>())
+			functor = std::launder(static_cast<F*>(storage));
+		else
+			functor = *static_cast<F**>(storage);
+
+		if constexpr (std::is_void_v<Ret>)
+			std::invoke(*functor, std::forward<Args>(args)...);
+		else
+			return std::invoke(*functor, std::forward<Args>(args)...);
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	void InplaceFunction<Ret(Args...), Capacity>::Manage(Operation operation, void* storage, void* otherStorage)
+	{
+		if constexpr (IsStoredInline<F>())
+		{
+			switch (operation)
+			{
+				case Operation::Copy:
+					new (storage) F(*std::launder(static_cast<const F*>(otherStorage)));
+					break;
+
+				case Operation::Destroy:
+					std::launder(static_cast<F*>(storage))->~F();
+					break;
+
+				case Operation::Move:
+				{
+					F* source = std::launder(static_cast<F*>(otherStorage));
+					new (storage) F(std::move(*source));
+					source->~F();
+					break;
+				}
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+				case Operation::Copy:
+					*static_cast<F**>(storage) = new F(**static_cast<const F* const*>(otherStorage));
+					break;
+
+				case Operation::Destroy:
+					delete *static_cast<F**>(storage);
+					break;
+
+				case Operation::Move:
+					*static_cast<F**>(storage) = *static_cast<F**>(otherStorage);
+					break;
+			}
+		}
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	void InplaceFunction<Ret(Args...), Capacity>::Reset() noexcept
+	{
+		if (m_manager)
+		{
+			m_manager(Operation::Destroy, &m_storage, nullptr);
+			m_invoker = nullptr;
+			m_manager = nullptr;
+		}
+	}
+}
@@ -0,0 +1,259 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::LruCache
+	* \brief Key-value cache evicting the least recently used entries once its capacity is exceeded
+	*
+	* Entries live in a MemoryPool and are linked by index in recency order, a FlatHashMap maps keys to entry indices:
+	* inserting an entry allocates nothing once the pool and the map are large enough, and lookups and evictions run in constant time.
+	*
+	* The capacity is a total cost, each entry having a cost given when it is inserted (one by default, making the capacity an entry count,
+	* but it can be a size in bytes for example).
+	*
+	* \remark The most recent entry is never evicted, even if its cost alone exceeds the capacity
+	* \remark Pointers and references to values stay valid until their entry is evicted or erased
+	* \see ClockCache, ShardedCache
+	*/
+
+	/*!
+	* \brief Constructs an empty cache
+	*
+	* \param capacity Maximum total cost of the entries
+	* \param poolBlockSize Number of entries allocated at once by the memory pool
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	LruCache<K, V, Hash, KeyEqual>::LruCache(std::size_t capacity, std::size_t poolBlockSize) :
+	m_nodes(poolBlockSize),
+	m_capacity(capacity),
+	m_cost(0),
+	m_head(InvalidIndex),
+	m_tail(InvalidIndex)
+	{
+	}
+
+	/*!
+	* \brief Removes every entry from the cache, keeping its memory
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::Clear()
+	{
+		m_entries.clear();
+		m_nodes.Reset();
+		m_cost = 0;
+		m_head = InvalidIndex;
+		m_tail = InvalidIndex;
+	}
+
+	/*!
+	* \brief Checks if the cache has an entry for a key, without marking it as used
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	bool LruCache<K, V, Hash, KeyEqual>::Contains(const K& key) const
+	{
+		return m_entries.find(key) != m_entries.end();
+	}
+
+	/*!
+	* \brief Removes the entry of a key
+	* \return True if the key had an entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	bool LruCache<K, V, Hash, KeyEqual>::Erase(const K& key)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return false;
+
+		Remove(it->second);
+		return true;
+	}
+
+	/*!
+	* \brief Gets the value of a key and marks it as the most recently used entry
+	* \return Pointer to the value, or nullptr if the key has no entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	V* LruCache<K, V, Hash, KeyEqual>::Get(const K& key)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return nullptr;
+
+		std::size_t index = it->second;
+		if (index != m_head)
+		{
+			Unlink(index);
+			LinkFront(index);
+		}
+
+		return &m_nodes.RetrieveFromIndex(index)->value;
+	}
+
+	/*!
+	* \brief Returns the maximum total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t LruCache<K, V, Hash, KeyEqual>::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	/*!
+	* \brief Returns the total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t LruCache<K, V, Hash, KeyEqual>::GetCost() const
+	{
+		return m_cost;
+	}
+
+	/*!
+	* \brief Returns the number of entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	std::size_t LruCache<K, V, Hash, KeyEqual>::GetSize() const
+	{
+		return m_entries.size();
+	}
+
+	/*!
+	* \brief Gets the value of a key without marking it as used
+	* \return Pointer to the value, or nullptr if the key has no entry
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	const V* LruCache<K, V, Hash, KeyEqual>::Peek(const K& key) const
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return nullptr;
+
+		return &m_nodes.RetrieveFromIndex(it->second)->value;
+	}
+
+	/*!
+	* \brief Inserts or replaces the entry of a key, making it the most recently used, then evicts the least recently used entries exceeding the capacity
+	* \return Reference to the value stored in the cache
+	*
+	* \param key Key of the entry
+	* \param value Value of the entry
+	* \param cost Cost of the entry, counted against the capacity
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	V& LruCache<K, V, Hash, KeyEqual>::Put(const K& key, V value, std::size_t cost)
+	{
+		Node* node;
+
+		auto it = m_entries.find(key);
+		if (it != m_entries.end())
+		{
+			std::size_t index = it->second;
+			node = m_nodes.RetrieveFromIndex(index);
+			node->value = std::move(value);
+
+			m_cost -= node->cost;
+			node->cost = cost;
+
+			if (index != m_head)
+			{
+				Unlink(index);
+				LinkFront(index);
+			}
+		}
+		else
+		{
+			std::size_t index;
+			node = m_nodes.Allocate(index, key, std::move(value), cost);
+			m_entries.try_emplace(key, index);
+
+			LinkFront(index);
+		}
+
+		m_cost += cost;
+		EvictOverflow();
+
+		return node->value;
+	}
+
+	/*!
+	* \brief Changes the capacity of the cache, evicting the least recently used entries exceeding it
+	*
+	* \param capacity Maximum total cost of the entries
+	*/
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::SetCapacity(std::size_t capacity)
+	{
+		m_capacity = capacity;
+		EvictOverflow();
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::EvictOverflow()
+	{
+		while (m_cost > m_capacity && m_tail != m_head)
+			Remove(m_tail);
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::LinkFront(std::size_t index)
+	{
+		Node* node = m_nodes.RetrieveFromIndex(index);
+		node->previous = InvalidIndex;
+		node->next = m_head;
+
+		if (m_head != InvalidIndex)
+			m_nodes.RetrieveFromIndex(m_head)->previous = index;
+		else
+			m_tail = index;
+
+		m_head = index;
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::Remove(std::size_t index)
+	{
+		Unlink(index);
+
+		Node* node = m_nodes.RetrieveFromIndex(index);
+		m_cost -= node->cost;
+		m_entries.erase(node->key);
+		m_nodes.Free(index);
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	void LruCache<K, V, Hash, KeyEqual>::Unlink(std::size_t index)
+	{
+		Node* node = m_nodes.RetrieveFromIndex(index);
+
+		if (node->previous != InvalidIndex)
+			m_nodes.RetrieveFromIndex(node->previous)->next = node->next;
+		else
+		{
+			assert(m_head == index);
+			m_head = node->next;
+		}
+
+		if (node->next != InvalidIndex)
+			m_nodes.RetrieveFromIndex(node->next)->previous = node->previous;
+		else
+		{
+			assert(m_tail == index);
+			m_tail = node->previous;
+		}
+	}
+
+	template<typename K, typename V, typename Hash, typename KeyEqual>
+	LruCache<K, V, Hash, KeyEqual>::Node::Node(const K& k, V&& v, std::size_t c) :
+	key(k),
+	value(std::move(v)),
+	cost(c)
+	{
+	}
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_MAPPEDFILE_HPP
+#define NAZARAUTILS_MAPPEDFILE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Result.hpp>
+#include <filesystem>
+
+#if NAZARA_CHECK_CPP_VER(NAZARA_CPP20)
+#include <span>
+#endif
+
+namespace Nz
+{
+	enum class MappedFileAccess
+	{
+		Normal,     //< no particular access pattern
+		Random,     //< pages are accessed in random order, read-ahead is useless
+		Sequential, //< pages are accessed in order and can be dropped soon after
+		WillNeed    //< pages will be accessed soon, start loading them now
+	};
+
+	enum class MappedFileError
+	{
+		AccessDenied,  //< file exists but cannot be read
+		FileNotFound,  //< file (or one of its parent directories) doesn't exist
+		MappingFailed, //< file was opened but couldn't be mapped in memory (too large for the address space, not a regular file, ...)
+		OpenFailed     //< file couldn't be opened for another reason
+	};
+
+	enum class MappedFileMode
+	{
+		ReadOnly,   //< mapped memory can only be read
+		CopyOnWrite //< mapped memory can be written, modified pages are private copies and are never written back to the file
+	};
+
+	// Maps a whole file in memory, pages are loaded by the OS on first access and shared with its file cache
+	class MappedFile
+	{
+		public:
+			inline MappedFile();
+			MappedFile(const MappedFile&) = delete;
+			inline MappedFile(MappedFile&& file) noexcept;
+			inline ~MappedFile();
+
+			inline void Advise(MappedFileAccess access);
+			inline void Advise(MappedFileAccess access, std::size_t offset, std::size_t size);
+
+			inline void Close();
+
+			inline const UInt8* GetData() const;
+			inline MappedFileMode GetMode() const;
+			inline UInt8* GetMutableData();
+			inline std::size_t GetSize() const;
+#if NAZARA_CHECK_CPP_VER(NAZARA_CPP20)
+			inline std::span<UInt8> GetMutableSpan();
+			inline std::span<const UInt8> GetSpan() const;
+#endif
+
+			inline bool IsEmpty() const;
+
+			MappedFile& operator=(const MappedFile&) = delete;
+			inline MappedFile& operator=(MappedFile&& file) noexcept;
+
+			static inline Result<MappedFile, MappedFileError> Open(const std::filesystem::path& path, MappedFileMode mode = MappedFileMode::ReadOnly, MappedFileAccess access = MappedFileAccess::Normal);
+
+		private:
+			inline MappedFile(UInt8* data, std::size_t size, MappedFileMode mode);
+
+			UInt8* m_data;
+			std::size_t m_size;
+			MappedFileMode m_mode;
+	};
+}
+
+#include <NazaraUtils/MappedFile.inl>
+
+#endif // NAZARAUTILS_MAPPEDFILE_HPP
@@ -0,0 +1,349 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <limits>
+#include <utility>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+		#define NAZARA_MAPPEDFILE_UNDEF_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+		#define NAZARA_MAPPEDFILE_UNDEF_NOMINMAX
+	#endif
+	#include <windows.h>
+	#ifdef NAZARA_MAPPEDFILE_UNDEF_LEAN_AND_MEAN
+		#undef WIN32_LEAN_AND_MEAN
+		#undef NAZARA_MAPPEDFILE_UNDEF_LEAN_AND_MEAN
+	#endif
+	#ifdef NAZARA_MAPPEDFILE_UNDEF_NOMINMAX
+		#undef NOMINMAX
+		#undef NAZARA_MAPPEDFILE_UNDEF_NOMINMAX
+	#endif
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class MappedFile
+	* \brief Read-only or copy-on-write memory mapping of a whole file
+	*
+	* The file is mapped with mmap (POSIX) or a file mapping object (Windows), which avoids copying it to a buffer: pages are loaded
+	* on first access and shared with the file cache of the OS.
+	*
+	* \remark The file shouldn't be modified (and especially not truncated) by another process while it's mapped
+	*/
+
+	/*!
+	* \brief Constructs an empty mapping
+	*/
+	inline MappedFile::MappedFile() :
+	m_data(nullptr),
+	m_size(0),
+	m_mode(MappedFileMode::ReadOnly)
+	{
+	}
+
+	inline MappedFile::MappedFile(UInt8* data, std::size_t size, MappedFileMode mode) :
+	m_data(data),
+	m_size(size),
+	m_mode(mode)
+	{
+	}
+
+	inline MappedFile::MappedFile(MappedFile&& file) noexcept :
+	m_data(std::exchange(file.m_data, nullptr)),
+	m_size(std::exchange(file.m_size, 0)),
+	m_mode(file.m_mode)
+	{
+	}
+
+	inline MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Tells the OS how the mapping will be accessed
+	*
+	* \param access Expected access pattern
+	*
+	* \remark This is only a hint, which may be ignored (Windows only supports MappedFileAccess::WillNeed and Sequential, as a prefetch)
+	*/
+	inline void MappedFile::Advise(MappedFileAccess access)
+	{
+		Advise(access, 0, m_size);
+	}
+
+	/*!
+	* \brief Tells the OS how a range of the mapping will be accessed
+	*
+	* \param access Expected access pattern
+	* \param offset Offset of the range, in bytes
+	* \param size Size of the range, in bytes
+	*
+	* \remark This is only a hint, which may be ignored (Windows only supports MappedFileAccess::WillNeed and Sequential, as a prefetch)
+	*/
+	inline void MappedFile::Advise([[maybe_unused]] MappedFileAccess access, std::size_t offset, std::size_t size)
+	{
+		assert(offset <= m_size && size <= m_size - offset);
+		if (size == 0)
+			return;
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#if defined(_WIN32_WINNT_WIN8) && _WIN32_WINNT >= _WIN32_WINNT_WIN8
+		if (access == MappedFileAccess::Sequential || access == MappedFileAccess::WillNeed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY range;
+			range.VirtualAddress = m_data + offset;
+			range.NumberOfBytes = size;
+
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+	#endif
+#elif defined(NAZARA_PLATFORM_POSIX)
+		int advice;
+		switch (access)
+		{
+			case MappedFileAccess::Normal:     advice = POSIX_MADV_NORMAL; break;
+			case MappedFileAccess::Random:     advice = POSIX_MADV_RANDOM; break;
+			case MappedFileAccess::Sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+			case MappedFileAccess::WillNeed:   advice = POSIX_MADV_WILLNEED; break;
+			default:                           return;
+		}
+
+		// Address has to be aligned on a page
+		std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+		std::size_t alignedOffset = offset - offset % pageSize;
+
+		posix_madvise(m_data + alignedOffset, size + (offset - alignedOffset), advice);
+#endif
+	}
+
+	/*!
+	* \brief Unmaps the file, the mapping becomes empty
+	*/
+	inline void MappedFile::Close()
+	{
+		if (!m_data)
+			return;
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+		UnmapViewOfFile(m_data);
+#elif defined(NAZARA_PLATFORM_POSIX)
+		munmap(m_data, m_size);
+#endif
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Returns a pointer to the mapped bytes, or nullptr if the mapping is empty
+	*/
+	inline const UInt8* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	inline MappedFileMode MappedFile::GetMode() const
+	{
+		return m_mode;
+	}
+
+	/*!
+	* \brief Returns a writable pointer to the mapped bytes, or nullptr if the mapping is empty
+	*
+	* \remark The file must have been opened with MappedFileMode::CopyOnWrite, writes are never visible in the file
+	*/
+	inline UInt8* MappedFile::GetMutableData()
+	{
+		assert(m_mode == MappedFileMode::CopyOnWrite);
+		return m_data;
+	}
+
+	inline std::size_t MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+#if NAZARA_CHECK_CPP_VER(NAZARA_CPP20)
+	/*!
+	* \brief Returns the mapped bytes as a writable span
+	*
+	* \remark The file must have been opened with MappedFileMode::CopyOnWrite, writes are never visible in the file
+	*/
+	inline std::span<UInt8> MappedFile::GetMutableSpan()
+	{
+		return std::span<UInt8>(GetMutableData(), m_size);
+	}
+
+	inline std::span<const UInt8> MappedFile::GetSpan() const
+	{
+		return std::span<const UInt8>(m_data, m_size);
+	}
+#endif
+
+	/*!
+	* \brief Checks if the mapping is empty (closed, or mapping an empty file)
+	*/
+	inline bool MappedFile::IsEmpty() const
+	{
+		return m_size == 0;
+	}
+
+	inline MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+	{
+		if (this != &file)
+		{
+			Close();
+
+			m_data = std::exchange(file.m_data, nullptr);
+			m_size = std::exchange(file.m_size, 0);
+			m_mode = file.m_mode;
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Maps a whole file in memory
+	* \return The mapping, or the reason why it failed
+	*
+	* \param path Path to the file (use Utf8Path to open a UTF-8 path)
+	* \param mode Whether the mapped memory is read-only or copy-on-write
+	* \param access Expected access pattern, see Advise
+	*
+	* Mapping an empty file succeeds and returns an empty mapping.
+	*/
+	inline Result<MappedFile, MappedFileError> MappedFile::Open([[maybe_unused]] const std::filesystem::path& path, [[maybe_unused]] MappedFileMode mode, [[maybe_unused]] MappedFileAccess access)
+	{
+#if defined(NAZARA_PLATFORM_WINDOWS)
+		DWORD flags = FILE_ATTRIBUTE_NORMAL;
+		if (access == MappedFileAccess::Random)
+			flags |= FILE_FLAG_RANDOM_ACCESS;
+		else if (access == MappedFileAccess::Sequential)
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			switch (GetLastError())
+			{
+				case ERROR_FILE_NOT_FOUND:
+				case ERROR_PATH_NOT_FOUND:
+					return Err(MappedFileError::FileNotFound);
+
+				case ERROR_ACCESS_DENIED:
+				case ERROR_SHARING_VIOLATION:
+					return Err(MappedFileError::AccessDenied);
+
+				default:
+					return Err(MappedFileError::OpenFailed);
+			}
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			CloseHandle(file);
+			return Err(MappedFileError::OpenFailed);
+		}
+
+		if (fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return MappedFile(nullptr, 0, mode);
+		}
+
+		if (static_cast<UInt64>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max())
+		{
+			CloseHandle(file);
+			return Err(MappedFileError::MappingFailed);
+		}
+
+		// The view keeps the mapping object (and the file) alive, so both handles can be closed right away
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (!mapping)
+			return Err(MappedFileError::MappingFailed);
+
+		void* data = MapViewOfFile(mapping, (mode == MappedFileMode::CopyOnWrite) ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+
+		if (!data)
+			return Err(MappedFileError::MappingFailed);
+
+		MappedFile mappedFile(static_cast<UInt8*>(data), static_cast<std::size_t>(fileSize.QuadPart), mode);
+#elif defined(NAZARA_PLATFORM_POSIX)
+		int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+		{
+			switch (errno)
+			{
+				case ENOENT:
+				case ENOTDIR:
+					return Err(MappedFileError::FileNotFound);
+
+				case EACCES:
+				case EPERM:
+					return Err(MappedFileError::AccessDenied);
+
+				default:
+					return Err(MappedFileError::OpenFailed);
+			}
+		}
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) != 0)
+		{
+			close(fd);
+			return Err(MappedFileError::OpenFailed);
+		}
+
+		if (!S_ISREG(fileStat.st_mode) || static_cast<UInt64>(fileStat.st_size) > std::numeric_limits<std::size_t>::max())
+		{
+			close(fd);
+			return Err(MappedFileError::MappingFailed);
+		}
+
+		std::size_t size = static_cast<std::size_t>(fileStat.st_size);
+		if (size == 0)
+		{
+			close(fd);
+			return MappedFile(nullptr, 0, mode);
+		}
+
+		// The mapping keeps a reference to the file, which can be closed right away
+		void* data = mmap(nullptr, size, (mode == MappedFileMode::CopyOnWrite) ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+
+		if (data == MAP_FAILED)
+			return Err(MappedFileError::MappingFailed);
+
+		MappedFile mappedFile(static_cast<UInt8*>(data), size, mode);
+#else
+		// No memory mapping on this platform
+		return Err(MappedFileError::OpenFailed);
+#endif
+
+#if defined(NAZARA_PLATFORM_WINDOWS) || defined(NAZARA_PLATFORM_POSIX)
+		if (access != MappedFileAccess::Normal)
+			mappedFile.Advise(access);
+
+		return mappedFile;
+#endif
+	}
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_MATHKERNELS_HPP
+#define NAZARAUTILS_MATHKERNELS_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <cstddef>
+
+#if !defined(NAZARA_MATHKERNELS_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_MATHKERNELS_X86
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_MATHKERNELS_NEON
+	#endif
+#endif
+
+namespace Nz
+{
+	enum class MathKernelBackend
+	{
+		Scalar,
+		SSE2,
+		AVX,
+		NEON
+	};
+
+	// Batch versions of Approach, Clamp, Lerp and MultiplyAdd over float and double arrays, and of half-precision conversions
+	namespace MathKernels
+	{
+		template<typename T> void Approach(const T* values, T objective, T increment, T* output, std::size_t count);
+		template<typename T> void Clamp(const T* values, T min, T max, T* output, std::size_t count);
+		inline void FloatToHalf(const float* src, UInt16* dst, std::size_t count);
+		inline MathKernelBackend GetBackend();
+		inline void HalfToFloat(const UInt16* src, float* dst, std::size_t count);
+		template<typename T> void Lerp(const T* from, const T* to, T interpolation, T* output, std::size_t count);
+		template<typename T> void Lerp(const T* from, const T* to, const T* interpolations, T* output, std::size_t count);
+		template<typename T> void MultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count);
+	}
+}
+
+#include <NazaraUtils/MathKernels.inl>
+
+#endif // NAZARAUTILS_MATHKERNELS_HPP
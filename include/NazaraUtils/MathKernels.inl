@@ -0,0 +1,665 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <cmath>
+#include <type_traits>
+
+#if defined(NAZARA_MATHKERNELS_X86)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_MATHKERNELS_NEON)
+	#include <arm_neon.h>
+#endif
+
+#if defined(NAZARA_MATHKERNELS_X86) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_MATHKERNELS_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_MATHKERNELS_TARGET(features)
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Below this count, the cost of the dispatch outweighs the gains of the vectorized kernels
+		constexpr std::size_t MathKernelScalarThreshold = 16;
+
+		// Vectorized kernels reproduce the scalar functions operation by operation (including std::min/std::max operand order,
+		// which matters for NaNs and signed zeros) and only fuse multiply-adds when MultiplyAdd does, so results are bit-exact
+		template<typename T>
+		constexpr bool UseFusedMultiplyAdd()
+		{
+#if defined(FP_FAST_FMAF)
+			if constexpr (std::is_same_v<T, float>)
+				return true;
+#endif
+
+#if defined(FP_FAST_FMA)
+			if constexpr (std::is_same_v<T, double>)
+				return true;
+#endif
+
+			return false;
+		}
+
+		template<typename T>
+		void ScalarApproach(const T* values, T objective, T increment, T* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Nz::Approach(values[i], objective, increment);
+		}
+
+		template<typename T>
+		void ScalarClamp(const T* values, T min, T max, T* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Nz::Clamp(values[i], min, max);
+		}
+
+		template<typename T>
+		void ScalarLerp(const T* from, const T* to, T interpolation, T* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Nz::Lerp(from[i], to[i], interpolation);
+		}
+
+		template<typename T>
+		void ScalarLerpArray(const T* from, const T* to, const T* interpolations, T* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Nz::Lerp(from[i], to[i], interpolations[i]);
+		}
+
+		template<typename T>
+		void ScalarMultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Nz::MultiplyAdd(x[i], y[i], z[i]);
+		}
+
+#if defined(NAZARA_MATHKERNELS_X86)
+		template<typename T> struct SSE2Vector;
+
+		template<>
+		struct SSE2Vector<float>
+		{
+			using Type = __m128;
+			static constexpr std::size_t Size = 4;
+
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Add(Type a, Type b) { return _mm_add_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Greater(Type a, Type b) { return _mm_cmpgt_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Less(Type a, Type b) { return _mm_cmplt_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Load(const float* ptr) { return _mm_loadu_ps(ptr); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Max(Type a, Type b) { return _mm_max_ps(b, a); } //< (a < b) ? b : a, like std::max
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Min(Type a, Type b) { return _mm_min_ps(b, a); } //< (b < a) ? b : a, like std::min
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Select(Type mask, Type a, Type b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Set(float value) { return _mm_set1_ps(value); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static void Store(float* ptr, Type value) { _mm_storeu_ps(ptr, value); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMAF)
+				return _mm_fmadd_ps(a, b, c);
+#else
+				return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+			}
+		};
+
+		template<>
+		struct SSE2Vector<double>
+		{
+			using Type = __m128d;
+			static constexpr std::size_t Size = 2;
+
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Add(Type a, Type b) { return _mm_add_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Greater(Type a, Type b) { return _mm_cmpgt_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Less(Type a, Type b) { return _mm_cmplt_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Load(const double* ptr) { return _mm_loadu_pd(ptr); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Max(Type a, Type b) { return _mm_max_pd(b, a); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Min(Type a, Type b) { return _mm_min_pd(b, a); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Mul(Type a, Type b) { return _mm_mul_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Select(Type mask, Type a, Type b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Set(double value) { return _mm_set1_pd(value); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static void Store(double* ptr, Type value) { _mm_storeu_pd(ptr, value); }
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type Sub(Type a, Type b) { return _mm_sub_pd(a, b); }
+
+			NAZARA_MATHKERNELS_TARGET("sse2") static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMA)
+				return _mm_fmadd_pd(a, b, c);
+#else
+				return _mm_add_pd(_mm_mul_pd(a, b), c);
+#endif
+			}
+		};
+
+		template<typename T> struct AVXVector;
+
+		template<>
+		struct AVXVector<float>
+		{
+			using Type = __m256;
+			static constexpr std::size_t Size = 8;
+
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Add(Type a, Type b) { return _mm256_add_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Greater(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Less(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Max(Type a, Type b) { return _mm256_max_ps(b, a); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Min(Type a, Type b) { return _mm256_min_ps(b, a); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Mul(Type a, Type b) { return _mm256_mul_ps(a, b); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Select(Type mask, Type a, Type b) { return _mm256_or_ps(_mm256_and_ps(mask, a), _mm256_andnot_ps(mask, b)); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Set(float value) { return _mm256_set1_ps(value); }
+			NAZARA_MATHKERNELS_TARGET("avx") static void Store(float* ptr, Type value) { _mm256_storeu_ps(ptr, value); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Sub(Type a, Type b) { return _mm256_sub_ps(a, b); }
+
+			NAZARA_MATHKERNELS_TARGET("avx") static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMAF)
+				return _mm256_fmadd_ps(a, b, c);
+#else
+				return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+			}
+		};
+
+		template<>
+		struct AVXVector<double>
+		{
+			using Type = __m256d;
+			static constexpr std::size_t Size = 4;
+
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Add(Type a, Type b) { return _mm256_add_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Greater(Type a, Type b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Less(Type a, Type b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Max(Type a, Type b) { return _mm256_max_pd(b, a); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Min(Type a, Type b) { return _mm256_min_pd(b, a); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Mul(Type a, Type b) { return _mm256_mul_pd(a, b); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Select(Type mask, Type a, Type b) { return _mm256_or_pd(_mm256_and_pd(mask, a), _mm256_andnot_pd(mask, b)); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Set(double value) { return _mm256_set1_pd(value); }
+			NAZARA_MATHKERNELS_TARGET("avx") static void Store(double* ptr, Type value) { _mm256_storeu_pd(ptr, value); }
+			NAZARA_MATHKERNELS_TARGET("avx") static Type Sub(Type a, Type b) { return _mm256_sub_pd(a, b); }
+
+			NAZARA_MATHKERNELS_TARGET("avx") static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMA)
+				return _mm256_fmadd_pd(a, b, c);
+#else
+				return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+			}
+		};
+#elif defined(NAZARA_MATHKERNELS_NEON)
+		template<typename T> struct NEONVector;
+
+		template<>
+		struct NEONVector<float>
+		{
+			using Type = float32x4_t;
+			static constexpr std::size_t Size = 4;
+
+			static Type Add(Type a, Type b) { return vaddq_f32(a, b); }
+			static Type Greater(Type a, Type b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+			static Type Less(Type a, Type b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+			static Type Load(const float* ptr) { return vld1q_f32(ptr); }
+			static Type Max(Type a, Type b) { return vbslq_f32(vcltq_f32(a, b), b, a); } //< vmaxq_f32 doesn't follow std::max semantics for NaNs
+			static Type Min(Type a, Type b) { return vbslq_f32(vcltq_f32(b, a), b, a); }
+			static Type Mul(Type a, Type b) { return vmulq_f32(a, b); }
+			static Type Select(Type mask, Type a, Type b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+			static Type Set(float value) { return vdupq_n_f32(value); }
+			static void Store(float* ptr, Type value) { vst1q_f32(ptr, value); }
+			static Type Sub(Type a, Type b) { return vsubq_f32(a, b); }
+
+			static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMAF)
+				return vfmaq_f32(c, a, b);
+#else
+				return vaddq_f32(vmulq_f32(a, b), c);
+#endif
+			}
+		};
+
+		template<>
+		struct NEONVector<double>
+		{
+			using Type = float64x2_t;
+			static constexpr std::size_t Size = 2;
+
+			static Type Add(Type a, Type b) { return vaddq_f64(a, b); }
+			static Type Greater(Type a, Type b) { return vreinterpretq_f64_u64(vcgtq_f64(a, b)); }
+			static Type Less(Type a, Type b) { return vreinterpretq_f64_u64(vcltq_f64(a, b)); }
+			static Type Load(const double* ptr) { return vld1q_f64(ptr); }
+			static Type Max(Type a, Type b) { return vbslq_f64(vcltq_f64(a, b), b, a); }
+			static Type Min(Type a, Type b) { return vbslq_f64(vcltq_f64(b, a), b, a); }
+			static Type Mul(Type a, Type b) { return vmulq_f64(a, b); }
+			static Type Select(Type mask, Type a, Type b) { return vbslq_f64(vreinterpretq_u64_f64(mask), a, b); }
+			static Type Set(double value) { return vdupq_n_f64(value); }
+			static void Store(double* ptr, Type value) { vst1q_f64(ptr, value); }
+			static Type Sub(Type a, Type b) { return vsubq_f64(a, b); }
+
+			static Type MulAdd(Type a, Type b, Type c)
+			{
+#if defined(FP_FAST_FMA)
+				return vfmaq_f64(c, a, b);
+#else
+				return vaddq_f64(vmulq_f64(a, b), c);
+#endif
+			}
+		};
+#endif
+
+		// Kernels are written once per instruction set (sharing the vector wrappers above), as target attributes cannot depend on a template parameter
+#define NAZARA_MATHKERNELS_DEFINE(Prefix, Features) \
+		template<typename T> \
+		NAZARA_MATHKERNELS_TARGET(Features) void Prefix##Approach(const T* values, T objective, T increment, T* output, std::size_t count) \
+		{ \
+			using V = Prefix##Vector<T>; \
+			const typename V::Type objectiveVec = V::Set(objective); \
+			const typename V::Type incrementVec = V::Set(increment); \
+			std::size_t i = 0; \
+			for (; i + V::Size <= count; i += V::Size) \
+			{ \
+				typename V::Type value = V::Load(values + i); \
+				typename V::Type up = V::Min(V::Add(value, incrementVec), objectiveVec); \
+				typename V::Type down = V::Max(V::Sub(value, incrementVec), objectiveVec); \
+				V::Store(output + i, V::Select(V::Less(value, objectiveVec), up, V::Select(V::Greater(value, objectiveVec), down, value))); \
+			} \
+			ScalarApproach(values + i, objective, increment, output + i, count - i); \
+		} \
+		\
+		template<typename T> \
+		NAZARA_MATHKERNELS_TARGET(Features) void Prefix##Clamp(const T* values, T min, T max, T* output, std::size_t count) \
+		{ \
+			using V = Prefix##Vector<T>; \
+			const typename V::Type minVec = V::Set(min); \
+			const typename V::Type maxVec = V::Set(max); \
+			std::size_t i = 0; \
+			for (; i + V::Size <= count; i += V::Size) \
+				V::Store(output + i, V::Max(V::Min(V::Load(values + i), maxVec), minVec)); \
+			ScalarClamp(values + i, min, max, output + i, count - i); \
+		} \
+		\
+		template<typename T> \
+		NAZARA_MATHKERNELS_TARGET(Features) void Prefix##Lerp(const T* from, const T* to, T interpolation, T* output, std::size_t count) \
+		{ \
+			using V = Prefix##Vector<T>; \
+			const typename V::Type interpolationVec = V::Set(interpolation); \
+			std::size_t i = 0; \
+			for (; i + V::Size <= count; i += V::Size) \
+			{ \
+				typename V::Type fromVec = V::Load(from + i); \
+				V::Store(output + i, V::Add(fromVec, V::Mul(interpolationVec, V::Sub(V::Load(to + i), fromVec)))); \
+			} \
+			ScalarLerp(from + i, to + i, interpolation, output + i, count - i); \
+		} \
+		\
+		template<typename T> \
+		NAZARA_MATHKERNELS_TARGET(Features) void Prefix##LerpArray(const T* from, const T* to, const T* interpolations, T* output, std::size_t count) \
+		{ \
+			using V = Prefix##Vector<T>; \
+			std::size_t i = 0; \
+			for (; i + V::Size <= count; i += V::Size) \
+			{ \
+				typename V::Type fromVec = V::Load(from + i); \
+				V::Store(output + i, V::Add(fromVec, V::Mul(V::Load(interpolations + i), V::Sub(V::Load(to + i), fromVec)))); \
+			} \
+			ScalarLerpArray(from + i, to + i, interpolations + i, output + i, count - i); \
+		} \
+		\
+		template<typename T> \
+		NAZARA_MATHKERNELS_TARGET(Features) void Prefix##MultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count) \
+		{ \
+			using V = Prefix##Vector<T>; \
+			std::size_t i = 0; \
+			for (; i + V::Size <= count; i += V::Size) \
+				V::Store(output + i, V::MulAdd(V::Load(x + i), V::Load(y + i), V::Load(z + i))); \
+			ScalarMultiplyAdd(x + i, y + i, z + i, output + i, count - i); \
+		}
+
+#if defined(NAZARA_MATHKERNELS_X86)
+		NAZARA_MATHKERNELS_DEFINE(SSE2, "sse2")
+		NAZARA_MATHKERNELS_DEFINE(AVX, "avx")
+#elif defined(NAZARA_MATHKERNELS_NEON)
+		NAZARA_MATHKERNELS_DEFINE(NEON, "")
+#endif
+
+#undef NAZARA_MATHKERNELS_DEFINE
+
+		template<typename T>
+		struct MathKernelTable
+		{
+			using ApproachFunc = void(*)(const T* values, T objective, T increment, T* output, std::size_t count);
+			using ClampFunc = void(*)(const T* values, T min, T max, T* output, std::size_t count);
+			using LerpFunc = void(*)(const T* from, const T* to, T interpolation, T* output, std::size_t count);
+			using LerpArrayFunc = void(*)(const T* from, const T* to, const T* interpolations, T* output, std::size_t count);
+			using MultiplyAddFunc = void(*)(const T* x, const T* y, const T* z, T* output, std::size_t count);
+
+			MathKernelBackend backend;
+			ApproachFunc approachFunc;
+			ClampFunc clampFunc;
+			LerpFunc lerpFunc;
+			LerpArrayFunc lerpArrayFunc;
+			MultiplyAddFunc multiplyAddFunc;
+		};
+
+		inline MathKernelBackend DetectMathKernelBackend()
+		{
+#if defined(NAZARA_MATHKERNELS_X86)
+			const CpuFeatures& features = GetCpuFeatures();
+			if (features.avx)
+				return MathKernelBackend::AVX;
+
+			if (features.sse2)
+				return MathKernelBackend::SSE2;
+#elif defined(NAZARA_MATHKERNELS_NEON)
+			return MathKernelBackend::NEON;
+#endif
+
+			return MathKernelBackend::Scalar;
+		}
+
+		template<typename T>
+		MathKernelTable<T> BuildMathKernelTable(MathKernelBackend backend)
+		{
+#define NAZARA_MATHKERNELS_TABLE(Prefix) { \
+			backend, \
+			&Prefix##Approach<T>, \
+			&Prefix##Clamp<T>, \
+			&Prefix##Lerp<T>, \
+			&Prefix##LerpArray<T>, \
+			&Prefix##MultiplyAdd<T> \
+		}
+
+			switch (backend)
+			{
+#if defined(NAZARA_MATHKERNELS_X86)
+				case MathKernelBackend::SSE2:
+					return NAZARA_MATHKERNELS_TABLE(SSE2);
+
+				case MathKernelBackend::AVX:
+					return NAZARA_MATHKERNELS_TABLE(AVX);
+#elif defined(NAZARA_MATHKERNELS_NEON)
+				case MathKernelBackend::NEON:
+					return NAZARA_MATHKERNELS_TABLE(NEON);
+#endif
+
+				default:
+					break;
+			}
+
+			backend = MathKernelBackend::Scalar;
+			return NAZARA_MATHKERNELS_TABLE(Scalar);
+
+#undef NAZARA_MATHKERNELS_TABLE
+		}
+
+		template<typename T>
+		const MathKernelTable<T>& GetMathKernelTable()
+		{
+			static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "math kernels only support float and double");
+
+			static const MathKernelTable<T> table = BuildMathKernelTable<T>(DetectMathKernelBackend());
+			return table;
+		}
+
+		inline void ScalarFloatToHalf(const float* src, UInt16* dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = Nz::FloatToHalf(src[i]);
+		}
+
+		inline void ScalarHalfToFloat(const UInt16* src, float* dst, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = Nz::HalfToFloat(src[i]);
+		}
+
+#if defined(NAZARA_MATHKERNELS_X86)
+		inline bool HasF16C()
+		{
+			// F16C works on YMM registers, avx is only reported if the OS saves them
+			const CpuFeatures& features = GetCpuFeatures();
+			return features.avx && features.f16c;
+		}
+
+		// Rounding is explicitly set to nearest-even (like FloatToHalf) instead of using the current MXCSR mode
+		constexpr int F16CRounding = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+
+		NAZARA_MATHKERNELS_TARGET("avx,f16c") inline void F16CFloatToHalf(const float* src, UInt16* dst, std::size_t count)
+		{
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i first = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), F16CRounding);
+				__m128i second = _mm256_cvtps_ph(_mm256_loadu_ps(src + i + 8), F16CRounding);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), first);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), second);
+			}
+
+			if (i + 8 <= count)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), F16CRounding));
+				i += 8;
+			}
+
+			ScalarFloatToHalf(src + i, dst + i, count - i);
+		}
+
+		NAZARA_MATHKERNELS_TARGET("avx,f16c") inline void F16CHalfToFloat(const UInt16* src, float* dst, std::size_t count)
+		{
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				__m256 first = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+				__m256 second = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)));
+				_mm256_storeu_ps(dst + i, first);
+				_mm256_storeu_ps(dst + i + 8, second);
+			}
+
+			if (i + 8 <= count)
+			{
+				_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+				i += 8;
+			}
+
+			ScalarHalfToFloat(src + i, dst + i, count - i);
+		}
+#elif defined(NAZARA_MATHKERNELS_NEON)
+		// Conversions follow the FPCR rounding mode, which is nearest-even unless changed by the application
+		inline void NEONFloatToHalf(const float* src, UInt16* dst, std::size_t count)
+		{
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				float16x8_t halves = vcvt_high_f16_f32(vcvt_f16_f32(vld1q_f32(src + i)), vld1q_f32(src + i + 4));
+				vst1q_u16(dst + i, vreinterpretq_u16_f16(halves));
+			}
+
+			ScalarFloatToHalf(src + i, dst + i, count - i);
+		}
+
+		inline void NEONHalfToFloat(const UInt16* src, float* dst, std::size_t count)
+		{
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				float16x8_t halves = vreinterpretq_f16_u16(vld1q_u16(src + i));
+				vst1q_f32(dst + i, vcvt_f32_f16(vget_low_f16(halves)));
+				vst1q_f32(dst + i + 4, vcvt_high_f32_f16(halves));
+			}
+
+			ScalarHalfToFloat(src + i, dst + i, count - i);
+		}
+#endif
+	}
+
+	namespace MathKernels
+	{
+		/*!
+		* \ingroup utils
+		* \brief Approaches the objective from every value of an array, see Nz::Approach
+		*
+		* \param values Initial values
+		* \param objective Target value
+		* \param increment One step value
+		* \param output Results, may be the same as values (but should not partially overlap it)
+		* \param count Number of values
+		*/
+		template<typename T>
+		void Approach(const T* values, T objective, T increment, T* output, std::size_t count)
+		{
+			if (count < Detail::MathKernelScalarThreshold)
+				return Detail::ScalarApproach(values, objective, increment, output, count);
+
+			Detail::GetMathKernelTable<T>().approachFunc(values, objective, increment, output, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Clamps every value of an array between min and max, see Nz::Clamp
+		*
+		* \param values Values to clamp
+		* \param min Minimum of the interval
+		* \param max Maximum of the interval
+		* \param output Results, may be the same as values (but should not partially overlap it)
+		* \param count Number of values
+		*/
+		template<typename T>
+		void Clamp(const T* values, T min, T max, T* output, std::size_t count)
+		{
+			if (count < Detail::MathKernelScalarThreshold)
+				return Detail::ScalarClamp(values, min, max, output, count);
+
+			Detail::GetMathKernelTable<T>().clampFunc(values, min, max, output, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Converts an array of floats to half-precision floats, see Nz::FloatToHalf
+		*
+		* \param src Floats to convert
+		* \param dst Half-precision results
+		* \param count Number of values
+		*
+		* \remark Uses F16C (if supported by the CPU) or NEON to convert 8 to 16 values per iteration
+		*/
+		inline void FloatToHalf(const float* src, UInt16* dst, std::size_t count)
+		{
+#if defined(NAZARA_MATHKERNELS_X86)
+			if (count >= Detail::MathKernelScalarThreshold && Detail::HasF16C())
+				return Detail::F16CFloatToHalf(src, dst, count);
+#elif defined(NAZARA_MATHKERNELS_NEON)
+			if (count >= Detail::MathKernelScalarThreshold)
+				return Detail::NEONFloatToHalf(src, dst, count);
+#endif
+
+			return Detail::ScalarFloatToHalf(src, dst, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Returns the backend selected for this CPU
+		*
+		* The backend is selected once, on first use, depending on the instruction sets supported by the CPU.
+		* Defining NAZARA_MATHKERNELS_NO_SIMD forces the scalar backend.
+		*/
+		inline MathKernelBackend GetBackend()
+		{
+			return Detail::GetMathKernelTable<float>().backend;
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Converts an array of half-precision floats to floats, see Nz::HalfToFloat
+		*
+		* \param src Half-precision floats to convert
+		* \param dst Float results
+		* \param count Number of values
+		*
+		* \remark Uses F16C (if supported by the CPU) or NEON to convert 8 to 16 values per iteration
+		*/
+		inline void HalfToFloat(const UInt16* src, float* dst, std::size_t count)
+		{
+#if defined(NAZARA_MATHKERNELS_X86)
+			if (count >= Detail::MathKernelScalarThreshold && Detail::HasF16C())
+				return Detail::F16CHalfToFloat(src, dst, count);
+#elif defined(NAZARA_MATHKERNELS_NEON)
+			if (count >= Detail::MathKernelScalarThreshold)
+				return Detail::NEONHalfToFloat(src, dst, count);
+#endif
+
+			return Detail::ScalarHalfToFloat(src, dst, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Interpolates two arrays with the same factor, see Nz::Lerp
+		*
+		* \param from Initial values
+		* \param to Target values
+		* \param interpolation Factor of interpolation
+		* \param output Results, may be the same as from or to (but should not partially overlap them)
+		* \param count Number of values
+		*/
+		template<typename T>
+		void Lerp(const T* from, const T* to, T interpolation, T* output, std::size_t count)
+		{
+			if (count < Detail::MathKernelScalarThreshold)
+				return Detail::ScalarLerp(from, to, interpolation, output, count);
+
+			Detail::GetMathKernelTable<T>().lerpFunc(from, to, interpolation, output, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Interpolates two arrays with per-element factors, see Nz::Lerp
+		*
+		* \param from Initial values
+		* \param to Target values
+		* \param interpolations Factors of interpolation
+		* \param output Results, may be the same as from, to or interpolations (but should not partially overlap them)
+		* \param count Number of values
+		*/
+		template<typename T>
+		void Lerp(const T* from, const T* to, const T* interpolations, T* output, std::size_t count)
+		{
+			if (count < Detail::MathKernelScalarThreshold)
+				return Detail::ScalarLerpArray(from, to, interpolations, output, count);
+
+			Detail::GetMathKernelTable<T>().lerpArrayFunc(from, to, interpolations, output, count);
+		}
+
+		/*!
+		* \ingroup utils
+		* \brief Computes x * y + z for every element of three arrays, see Nz::MultiplyAdd
+		*
+		* \param x Array of X
+		* \param y Array of Y
+		* \param z Array of Z
+		* \param output Results, may be the same as x, y or z (but should not partially overlap them)
+		* \param count Number of values
+		*
+		* \remark Multiply-adds are fused if (and only if) Nz::MultiplyAdd fuses them
+		*/
+		template<typename T>
+		void MultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count)
+		{
+			if (count < Detail::MathKernelScalarThreshold)
+				return Detail::ScalarMultiplyAdd(x, y, z, output, count);
+
+			Detail::GetMathKernelTable<T>().multiplyAddFunc(x, y, z, output, count);
+		}
+	}
+}
+
+#undef NAZARA_MATHKERNELS_TARGET
@@ -12,9 +12,15 @@
 #include <NazaraUtils/ConstantEvaluated.hpp>
 #include <NazaraUtils/Constants.hpp>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <type_traits>
 
+#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(__BMI2__) || (defined(NAZARA_COMPILER_MSVC) && defined(__AVX2__)))
+	// pdep/pext are only used when the whole program targets BMI2, a per-call CPU check would cost more than the portable version
+	#define NAZARA_MATHUTILS_BMI2
+#endif
+
 namespace Nz
 {
 	// Bit/bytes utils
@@ -29,8 +35,15 @@ namespace Nz
 	template<typename T> [[nodiscard]] constexpr T ByteSwap(T value) noexcept;
 	template<typename T> [[nodiscard]] constexpr T ClearBit(T number, T bit) noexcept;
 	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 std::size_t CountBits(T value) noexcept;
+	template<typename T> [[nodiscard]] std::size_t CountBits(const T* values, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 unsigned int FindFirstBit(T number) noexcept;
+	template<typename T> [[nodiscard]] std::size_t FindFirstBit(const T* values, std::size_t count) noexcept;
+	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 std::array<T, 2> MortonDecode2D(T code) noexcept;
+	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 std::array<T, 3> MortonDecode3D(T code) noexcept;
+	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 T MortonEncode2D(T x, T y) noexcept;
+	template<typename T> [[nodiscard]] NAZARA_CONSTEXPR20 T MortonEncode3D(T x, T y, T z) noexcept;
 	template<typename T> [[nodiscard]] constexpr T ReverseBits(T integer) noexcept;
+	template<typename T> void ReverseBits(T* values, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr T SetBit(T number, T bit) noexcept;
 	inline void SwapBytes(void* buffer, std::size_t size) noexcept;
 	template<typename T> [[nodiscard]] constexpr bool TestBit(T number, T bit) noexcept;
@@ -40,16 +53,25 @@ namespace Nz
 	template<typename T> [[nodiscard]] constexpr T Align(T offset, T alignment) noexcept;
 	template<typename T> [[nodiscard]] constexpr T AlignPow2(T offset, T alignment) noexcept;
 	template<typename T> [[nodiscard]] constexpr T Approach(T value, T objective, T increment) noexcept;
+	template<typename T> void Approach(const T* values, T objective, T increment, T* output, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr T Clamp(T value, T min, T max) noexcept;
+	template<typename T> void Clamp(const T* values, T min, T max, T* output, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr T DegreeToRadian(T degrees) noexcept;
+	[[nodiscard]] inline NAZARA_CONSTEXPR_BITCAST UInt16 FloatToHalf(float value) noexcept;
+	inline void FloatToHalf(const float* src, UInt16* dst, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr T GetNearestPowerOfTwo(T number) noexcept;
+	[[nodiscard]] inline NAZARA_CONSTEXPR_BITCAST float HalfToFloat(UInt16 value) noexcept;
+	inline void HalfToFloat(const UInt16* src, float* dst, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr unsigned int IntegralLog2(T number) noexcept;
 	template<typename T> [[nodiscard]] constexpr unsigned int IntegralLog2Pot(T pot) noexcept;
 	template<typename T> [[nodiscard]] constexpr T IntegralPow(T base, unsigned int exponent) noexcept;
 	template<typename T> [[nodiscard]] constexpr bool IsPow2(T value) noexcept;
 	template<typename T, typename T2> [[nodiscard]] constexpr T Lerp(const T& from, const T& to, const T2& interpolation) noexcept;
+	template<typename T> void Lerp(const T* from, const T* to, T interpolation, T* output, std::size_t count) noexcept;
+	template<typename T> void Lerp(const T* from, const T* to, const T* interpolations, T* output, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr T Mod(T x, T y) noexcept;
 	template<typename T> [[nodiscard]] constexpr T MultiplyAdd(T x, T y, T z) noexcept;
+	template<typename T> void MultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count) noexcept;
 	template<typename T> [[nodiscard]] constexpr bool NumberEquals(T a, T b) noexcept;
 	template<typename T> [[nodiscard]] constexpr bool NumberEquals(T a, T b, T maxDifference) noexcept;
 	template<typename T> [[nodiscard]] constexpr T RadianToDegree(T radians) noexcept;
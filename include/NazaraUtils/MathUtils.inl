@@ -3,6 +3,12 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/BitKernels.hpp>
+#include <NazaraUtils/MathKernels.hpp>
+
+#ifdef NAZARA_MATHUTILS_BMI2
+#include <immintrin.h>
+#endif
 
 namespace Nz
 {
@@ -42,6 +48,104 @@ namespace Nz
 		};
 
 
+		// Bits of the first coordinate of a Morton code (the other coordinates use the same mask shifted by their index)
+		template<typename T> constexpr T MortonMask2D = T(0x5555555555555555ULL);
+		template<typename T> constexpr T MortonMask3D = T(0x1249249249249249ULL & (~0ULL >> (64 - BitCount<T>() / 3 * 3)));
+
+		template<typename T>
+		constexpr void AssertMortonType()
+		{
+			static_assert(std::is_unsigned_v<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8), "morton codes are 16, 32 or 64 bits unsigned integers");
+		}
+
+		// https://graphics.stanford.edu/~seander/bithacks.html#InterleaveBMN
+		constexpr UInt32 MortonSpread2D(UInt32 value)
+		{
+			value &= 0x0000FFFF;
+			value = (value | (value << 8)) & 0x00FF00FF;
+			value = (value | (value << 4)) & 0x0F0F0F0F;
+			value = (value | (value << 2)) & 0x33333333;
+			value = (value | (value << 1)) & 0x55555555;
+			return value;
+		}
+
+		constexpr UInt64 MortonSpread2D(UInt64 value)
+		{
+			value &= 0x00000000FFFFFFFF;
+			value = (value | (value << 16)) & 0x0000FFFF0000FFFF;
+			value = (value | (value << 8)) & 0x00FF00FF00FF00FF;
+			value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0F;
+			value = (value | (value << 2)) & 0x3333333333333333;
+			value = (value | (value << 1)) & 0x5555555555555555;
+			return value;
+		}
+
+		constexpr UInt32 MortonSpread3D(UInt32 value)
+		{
+			value &= 0x000003FF;
+			value = (value | (value << 16)) & 0x030000FF;
+			value = (value | (value << 8)) & 0x0300F00F;
+			value = (value | (value << 4)) & 0x030C30C3;
+			value = (value | (value << 2)) & 0x09249249;
+			return value;
+		}
+
+		constexpr UInt64 MortonSpread3D(UInt64 value)
+		{
+			value &= 0x00000000001FFFFF;
+			value = (value | (value << 32)) & 0x001F00000000FFFF;
+			value = (value | (value << 16)) & 0x001F0000FF0000FF;
+			value = (value | (value << 8)) & 0x100F00F00F00F00F;
+			value = (value | (value << 4)) & 0x10C30C30C30C30C3;
+			value = (value | (value << 2)) & 0x1249249249249249;
+			return value;
+		}
+
+		constexpr UInt32 MortonCompact2D(UInt32 value)
+		{
+			value &= 0x55555555;
+			value = (value | (value >> 1)) & 0x33333333;
+			value = (value | (value >> 2)) & 0x0F0F0F0F;
+			value = (value | (value >> 4)) & 0x00FF00FF;
+			value = (value | (value >> 8)) & 0x0000FFFF;
+			return value;
+		}
+
+		constexpr UInt64 MortonCompact2D(UInt64 value)
+		{
+			value &= 0x5555555555555555;
+			value = (value | (value >> 1)) & 0x3333333333333333;
+			value = (value | (value >> 2)) & 0x0F0F0F0F0F0F0F0F;
+			value = (value | (value >> 4)) & 0x00FF00FF00FF00FF;
+			value = (value | (value >> 8)) & 0x0000FFFF0000FFFF;
+			value = (value | (value >> 16)) & 0x00000000FFFFFFFF;
+			return value;
+		}
+
+		constexpr UInt32 MortonCompact3D(UInt32 value)
+		{
+			value &= 0x09249249;
+			value = (value | (value >> 2)) & 0x030C30C3;
+			value = (value | (value >> 4)) & 0x0300F00F;
+			value = (value | (value >> 8)) & 0xFF0000FF;
+			value = (value | (value >> 16)) & 0x000003FF;
+			return value;
+		}
+
+		constexpr UInt64 MortonCompact3D(UInt64 value)
+		{
+			value &= 0x1249249249249249;
+			value = (value | (value >> 2)) & 0x10C30C30C30C30C3;
+			value = (value | (value >> 4)) & 0x100F00F00F00F00F;
+			value = (value | (value >> 8)) & 0x001F0000FF0000FF;
+			value = (value | (value >> 16)) & 0x001F00000000FFFF;
+			value = (value | (value >> 32)) & 0x00000000001FFFFF;
+			return value;
+		}
+
+		template<typename T>
+		using MortonWord = std::conditional_t<(sizeof(T) <= sizeof(UInt32)), UInt32, UInt64>;
+
 		template<typename T>
 		constexpr std::enable_if_t<sizeof(T) <= sizeof(UInt32), unsigned int> IntegralLog2(UInt32 number)
 		{
@@ -70,9 +174,8 @@ namespace Nz
 				T val = (number & mask) >> i * 8; // Masking and shifting bits to the right (to bring it back to 32 bits)
 
 				// Call of the function with 32 bits number, if the result is non-null we have our answer
-				unsigned int log2 = IntegralLog2<UInt32>(static_cast<UInt32>(val));
-				if (log2)
-					return log2 + i * 8;
+				if (val != 0)
+					return IntegralLog2<UInt32>(static_cast<UInt32>(val)) + i * 8;
 			}
 
 			return 0;
@@ -360,6 +463,24 @@ namespace Nz
 		return count;
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Gets number of bits set in an array of integers
+	* \return The number of bits set to 1
+	*
+	* \param values Pointer to the integers
+	* \param count Number of integers
+	*
+	* \remark Large arrays are processed by the vectorized BitKernels::Count (Harley-Seal AVX2, AVX-512 or NEON, depending on the CPU)
+	*/
+	template<typename T>
+	[[nodiscard]] std::size_t CountBits(const T* values, std::size_t count) noexcept
+	{
+		static_assert(std::is_integral_v<T>);
+
+		return BitKernels::Count(values, count * sizeof(T));
+	}
+
 	template<typename T>
 	[[nodiscard]] NAZARA_CONSTEXPR20 unsigned int FindFirstBit(T number) noexcept
 	{
@@ -417,6 +538,171 @@ NAZARA_WARNING_POP()
 
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Find the first bit set to one in an array of integers
+	* \return Index of the first bit set to one, counting from the least significant bit of the first integer, plus one (or zero if no bit is set)
+	*
+	* \param values Pointer to the integers
+	* \param count Number of integers
+	*
+	* \remark The first non-zero integer is located using the vectorized BitKernels::FindFirstNonZero
+	*/
+	template<typename T>
+	[[nodiscard]] std::size_t FindFirstBit(const T* values, std::size_t count) noexcept
+	{
+		static_assert(std::is_integral_v<T>);
+
+		std::size_t byteOffset = BitKernels::FindFirstNonZero(values, count * sizeof(T));
+		if (byteOffset == count * sizeof(T))
+			return 0;
+
+		std::size_t index = byteOffset / sizeof(T);
+		return index * BitCount<T>() + FindFirstBit(values[index]);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Splits a 2D Morton (Z-order) code into its coordinates
+	* \return X and Y coordinates, each using BitCount<T>() / 2 bits
+	*
+	* \param code Morton code, as built by MortonEncode2D
+	*
+	* \remark This uses BMI2 pext when targeting it
+	*
+	* \see MortonEncode2D
+	*/
+	template<typename T>
+	[[nodiscard]] NAZARA_CONSTEXPR20 std::array<T, 2> MortonDecode2D(T code) noexcept
+	{
+		Detail::AssertMortonType<T>();
+
+		constexpr T mask = Detail::MortonMask2D<T>;
+
+		if NAZARA_IS_RUNTIME_EVAL()
+		{
+#if defined(NAZARA_MATHUTILS_BMI2)
+			if constexpr (sizeof(T) <= sizeof(UInt32))
+				return { T(_pext_u32(code, mask)), T(_pext_u32(code, UInt32(mask) << 1)) };
+#if defined(NAZARA_ARCH_x86_64)
+			else
+				return { T(_pext_u64(code, mask)), T(_pext_u64(code, UInt64(mask) << 1)) };
+#endif
+#endif
+		}
+
+		using Word = Detail::MortonWord<T>;
+		return { T(Detail::MortonCompact2D(Word(code & mask))), T(Detail::MortonCompact2D(Word((code >> 1) & mask))) };
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Splits a 3D Morton (Z-order) code into its coordinates
+	* \return X, Y and Z coordinates, each using BitCount<T>() / 3 bits
+	*
+	* \param code Morton code, as built by MortonEncode3D
+	*
+	* \remark This uses BMI2 pext when targeting it
+	*
+	* \see MortonEncode3D
+	*/
+	template<typename T>
+	[[nodiscard]] NAZARA_CONSTEXPR20 std::array<T, 3> MortonDecode3D(T code) noexcept
+	{
+		Detail::AssertMortonType<T>();
+
+		constexpr T mask = Detail::MortonMask3D<T>;
+
+		if NAZARA_IS_RUNTIME_EVAL()
+		{
+#if defined(NAZARA_MATHUTILS_BMI2)
+			if constexpr (sizeof(T) <= sizeof(UInt32))
+				return { T(_pext_u32(code, mask)), T(_pext_u32(code, UInt32(mask) << 1)), T(_pext_u32(code, UInt32(mask) << 2)) };
+#if defined(NAZARA_ARCH_x86_64)
+			else
+				return { T(_pext_u64(code, mask)), T(_pext_u64(code, UInt64(mask) << 1)), T(_pext_u64(code, UInt64(mask) << 2)) };
+#endif
+#endif
+		}
+
+		using Word = Detail::MortonWord<T>;
+		Word word = Word(code) & (Word(mask) | (Word(mask) << 1) | (Word(mask) << 2));
+		return { T(Detail::MortonCompact3D(word)), T(Detail::MortonCompact3D(Word(word >> 1))), T(Detail::MortonCompact3D(Word(word >> 2))) };
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Interleaves the bits of two coordinates into a Morton (Z-order) code
+	* \return Morton code, with bits of x at even positions and bits of y at odd positions
+	*
+	* \param x X coordinate, only its BitCount<T>() / 2 lower bits are used
+	* \param y Y coordinate, only its BitCount<T>() / 2 lower bits are used
+	*
+	* \remark This uses BMI2 pdep when targeting it
+	*
+	* \see MortonDecode2D
+	*/
+	template<typename T>
+	[[nodiscard]] NAZARA_CONSTEXPR20 T MortonEncode2D(T x, T y) noexcept
+	{
+		Detail::AssertMortonType<T>();
+
+		constexpr T mask = Detail::MortonMask2D<T>;
+
+		if NAZARA_IS_RUNTIME_EVAL()
+		{
+#if defined(NAZARA_MATHUTILS_BMI2)
+			if constexpr (sizeof(T) <= sizeof(UInt32))
+				return T(_pdep_u32(x, mask) | _pdep_u32(y, UInt32(mask) << 1));
+#if defined(NAZARA_ARCH_x86_64)
+			else
+				return T(_pdep_u64(x, mask) | _pdep_u64(y, UInt64(mask) << 1));
+#endif
+#endif
+		}
+
+		using Word = Detail::MortonWord<T>;
+		return T((Detail::MortonSpread2D(Word(x)) & mask) | ((Detail::MortonSpread2D(Word(y)) & mask) << 1));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Interleaves the bits of three coordinates into a Morton (Z-order) code
+	* \return Morton code, with bits of x, y and z at positions 3n, 3n+1 and 3n+2
+	*
+	* \param x X coordinate, only its BitCount<T>() / 3 lower bits are used
+	* \param y Y coordinate, only its BitCount<T>() / 3 lower bits are used
+	* \param z Z coordinate, only its BitCount<T>() / 3 lower bits are used
+	*
+	* \remark This uses BMI2 pdep when targeting it
+	* \remark The most significant bit(s) of the code are always zero, as BitCount<T>() is not a multiple of 3
+	*
+	* \see MortonDecode3D
+	*/
+	template<typename T>
+	[[nodiscard]] NAZARA_CONSTEXPR20 T MortonEncode3D(T x, T y, T z) noexcept
+	{
+		Detail::AssertMortonType<T>();
+
+		constexpr T mask = Detail::MortonMask3D<T>;
+
+		if NAZARA_IS_RUNTIME_EVAL()
+		{
+#if defined(NAZARA_MATHUTILS_BMI2)
+			if constexpr (sizeof(T) <= sizeof(UInt32))
+				return T(_pdep_u32(x, mask) | _pdep_u32(y, UInt32(mask) << 1) | _pdep_u32(z, UInt32(mask) << 2));
+#if defined(NAZARA_ARCH_x86_64)
+			else
+				return T(_pdep_u64(x, mask) | _pdep_u64(y, UInt64(mask) << 1) | _pdep_u64(z, UInt64(mask) << 2));
+#endif
+#endif
+		}
+
+		using Word = Detail::MortonWord<T>;
+		Word result = (Detail::MortonSpread3D(Word(x)) & mask) | ((Detail::MortonSpread3D(Word(y)) & mask) << 1) | ((Detail::MortonSpread3D(Word(z)) & mask) << 2);
+		return T(result);
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Reverse the bit order of the integer
@@ -434,6 +720,23 @@ NAZARA_WARNING_POP()
 		return reversed;
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Reverse the bit order of every integer of an array, in place
+	*
+	* \param values Pointer to the integers
+	* \param count Number of integers
+	*
+	* \remark Large arrays are processed by the vectorized BitKernels::ReverseBits
+	*/
+	template<typename T>
+	void ReverseBits(T* values, std::size_t count) noexcept
+	{
+		static_assert(std::is_integral_v<T>);
+
+		BitKernels::ReverseBits(values, values, count * sizeof(T), sizeof(T));
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Sets the nth bit of a number to 1
@@ -573,6 +876,30 @@ NAZARA_WARNING_POP()
 			return value;
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Approaches the objective for every value of an array, see Approach
+	*
+	* \param values Initial values
+	* \param objective Target value
+	* \param increment One step value
+	* \param output Pointer to the results, may be equal to values but must not partially overlap it
+	* \param count Number of values
+	*
+	* \remark float and double arrays are processed by the vectorized MathKernels::Approach, giving the same results as the scalar version
+	*/
+	template<typename T>
+	void Approach(const T* values, T objective, T increment, T* output, std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			MathKernels::Approach(values, objective, increment, output, count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Approach(values[i], objective, increment);
+		}
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Clamps value between min and max and returns the expected value
@@ -588,6 +915,30 @@ NAZARA_WARNING_POP()
 		return std::max(std::min(value, max), min);
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Clamps every value of an array between min and max, see Clamp
+	*
+	* \param values Values to clamp
+	* \param min Minimum of the interval
+	* \param max Maximum of the interval
+	* \param output Pointer to the results, may be equal to values but must not partially overlap it
+	* \param count Number of values
+	*
+	* \remark float and double arrays are processed by the vectorized MathKernels::Clamp, giving the same results as the scalar version
+	*/
+	template<typename T>
+	void Clamp(const T* values, T min, T max, T* output, std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			MathKernels::Clamp(values, min, max, output, count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Clamp(values[i], min, max);
+		}
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Converts degree to radian
@@ -601,6 +952,67 @@ NAZARA_WARNING_POP()
 		return degrees * (Pi<T> / T(180.0));
 	}
 
+	/*!
+	* \ingroup math
+	* \brief Converts a float to a half-precision (IEEE 754 binary16) float
+	* \return The bits of the half-precision float
+	*
+	* \param value Float to convert
+	*
+	* \remark Values are rounded to the nearest half (ties to even), values too large for a half become infinities and NaNs stay (quiet) NaNs, like F16C and NEON conversions
+	*
+	* \see HalfToFloat
+	*/
+	[[nodiscard]] inline NAZARA_CONSTEXPR_BITCAST UInt16 FloatToHalf(float value) noexcept
+	{
+		UInt32 bits = BitCast<UInt32>(value);
+		UInt16 sign = UInt16((bits >> 16) & 0x8000);
+		bits &= 0x7FFFFFFF;
+
+		if (bits >= 0x7F800000) //< infinity or NaN, NaNs keep the upper bits of their payload
+			return UInt16(sign | 0x7C00 | ((bits > 0x7F800000) ? (0x0200 | ((bits >> 13) & 0x03FF)) : 0));
+
+		if (bits >= 0x477FF000) //< 65520 and above round to infinity
+			return UInt16(sign | 0x7C00);
+
+		if (bits < 0x38800000) //< below the smallest normal half, shift the mantissa with its implicit bit into a subnormal
+		{
+			UInt32 exponent = bits >> 23;
+			if (exponent < 102) //< below half the smallest subnormal half
+				return sign;
+
+			UInt32 mantissa = (bits & 0x007FFFFF) | 0x00800000;
+			UInt32 shift = 126 - exponent;
+			UInt32 result = mantissa >> shift;
+			UInt32 remainder = mantissa & ((1U << shift) - 1);
+			UInt32 halfway = 1U << (shift - 1);
+			if (remainder > halfway || (remainder == halfway && (result & 1) != 0))
+				result++;
+
+			return UInt16(sign | result);
+		}
+
+		// Rebias exponent (from 127 to 15) and round mantissa to nearest even
+		bits = bits - 0x38000000;
+		bits += 0x0FFF + ((bits >> 13) & 1);
+		return UInt16(sign | (bits >> 13));
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Converts an array of floats to half-precision floats
+	*
+	* \param src Pointer to the floats to convert
+	* \param dst Pointer to the half-precision results
+	* \param count Number of values
+	*
+	* \remark Large arrays are converted by the vectorized MathKernels::FloatToHalf (F16C or NEON), giving the same results as the scalar version
+	*/
+	inline void FloatToHalf(const float* src, UInt16* dst, std::size_t count) noexcept
+	{
+		MathKernels::FloatToHalf(src, dst, count);
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Gets the nearest power of two for the number
@@ -618,6 +1030,61 @@ NAZARA_WARNING_POP()
 		return x;
 	}
 
+	/*!
+	* \ingroup math
+	* \brief Converts a half-precision (IEEE 754 binary16) float to a float
+	* \return The float value of the half, which is always exactly representable
+	*
+	* \param value Bits of the half-precision float
+	*
+	* \remark Signaling NaNs are converted to quiet NaNs, like F16C and NEON conversions
+	*
+	* \see FloatToHalf
+	*/
+	[[nodiscard]] inline NAZARA_CONSTEXPR_BITCAST float HalfToFloat(UInt16 value) noexcept
+	{
+		UInt32 sign = UInt32(value & 0x8000) << 16;
+		UInt32 exponent = (value >> 10) & 0x1F;
+		UInt32 mantissa = value & 0x03FF;
+
+		if (exponent == 0x1F) //< infinity or NaN
+			return BitCast<float>(sign | 0x7F800000 | ((mantissa != 0) ? (0x00400000 | (mantissa << 13)) : 0));
+
+		if (exponent == 0)
+		{
+			if (mantissa == 0)
+				return BitCast<float>(sign);
+
+			// Subnormal half, normalize it as floats have a larger exponent range
+			exponent = 113;
+			do
+			{
+				mantissa <<= 1;
+				exponent--;
+			}
+			while ((mantissa & 0x0400) == 0);
+
+			return BitCast<float>(sign | (exponent << 23) | ((mantissa & 0x03FF) << 13));
+		}
+
+		return BitCast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Converts an array of half-precision floats to floats
+	*
+	* \param src Pointer to the half-precision floats to convert
+	* \param dst Pointer to the float results
+	* \param count Number of values
+	*
+	* \remark Large arrays are converted by the vectorized MathKernels::HalfToFloat (F16C or NEON), giving the same results as the scalar version
+	*/
+	inline void HalfToFloat(const UInt16* src, float* dst, std::size_t count) noexcept
+	{
+		MathKernels::HalfToFloat(src, dst, count);
+	}
+
 	/*!
 	* \ingroup math
 	* \brief Gets the log in base 2 of integral number
@@ -701,6 +1168,54 @@ NAZARA_WARNING_POP()
 		return static_cast<T>(from + interpolation * (to - from));
 	}
 
+	/*!
+	* \ingroup math
+	* \brief Interpolates two arrays of values with the same factor of interpolation, see Lerp
+	*
+	* \param from Initial values
+	* \param to Target values
+	* \param interpolation Factor of interpolation
+	* \param output Pointer to the results, may be equal to from or to but must not partially overlap them
+	* \param count Number of values
+	*
+	* \remark float and double arrays are processed by the vectorized MathKernels::Lerp, giving the same results as the scalar version
+	*/
+	template<typename T>
+	void Lerp(const T* from, const T* to, T interpolation, T* output, std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			MathKernels::Lerp(from, to, interpolation, output, count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Lerp(from[i], to[i], interpolation);
+		}
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Interpolates two arrays of values with a factor of interpolation per value, see Lerp
+	*
+	* \param from Initial values
+	* \param to Target values
+	* \param interpolations Factors of interpolation
+	* \param output Pointer to the results, may be equal to from, to or interpolations but must not partially overlap them
+	* \param count Number of values
+	*
+	* \remark float and double arrays are processed by the vectorized MathKernels::Lerp, giving the same results as the scalar version
+	*/
+	template<typename T>
+	void Lerp(const T* from, const T* to, const T* interpolations, T* output, std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			MathKernels::Lerp(from, to, interpolations, output, count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = Lerp(from[i], to[i], interpolations[i]);
+		}
+	}
+
 	template<typename T>
 	[[nodiscard]] constexpr T Mod(T x, T y) noexcept
 	{
@@ -755,6 +1270,30 @@ NAZARA_WARNING_POP()
 		return std::fmal(x, y, z);
 	}
 #endif
+
+	/*!
+	* \ingroup math
+	* \brief Computes X * Y + Z for every value of three arrays, see MultiplyAdd
+	*
+	* \param x Pointer to the X values
+	* \param y Pointer to the Y values
+	* \param z Pointer to the Z values
+	* \param output Pointer to the results, may be equal to x, y or z but must not partially overlap them
+	* \param count Number of values
+	*
+	* \remark float and double arrays are processed by the vectorized MathKernels::MultiplyAdd, which only fuses the operations when the scalar version does
+	*/
+	template<typename T>
+	void MultiplyAdd(const T* x, const T* y, const T* z, T* output, std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			MathKernels::MultiplyAdd(x, y, z, output, count);
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				output[i] = MultiplyAdd(x[i], y[i], z[i]);
+		}
+	}
 	
 	/*!
 	* \ingroup math
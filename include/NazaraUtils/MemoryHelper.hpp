@@ -7,6 +7,9 @@
 #ifndef NAZARAUTILS_MEMORYHELPER_HPP
 #define NAZARAUTILS_MEMORYHELPER_HPP
 
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/TypeTraits.hpp>
+
 #if defined(NAZARA_COMPILER_MSVC) || defined(NAZARA_COMPILER_MINGW)
 
 #include <malloc.h>
@@ -30,14 +33,80 @@
 #endif
 
 #include <cstddef>
+#include <memory>
+#include <type_traits>
 
 namespace Nz
 {
+	// Assumed cache line size, used to keep data written by different threads apart (and avoid false sharing), see NAZARA_CACHELINE_SIZE
+	constexpr std::size_t CacheLineSize = NAZARA_CACHELINE_SIZE;
+
+	template<typename T, std::size_t Alignment>
+	class AlignedAllocator
+	{
+		static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+
+		public:
+			using value_type = T;
+			using is_always_equal = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = AlignedAllocator<U, Alignment>;
+			};
+
+			AlignedAllocator() = default;
+			template<typename U> constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+			[[nodiscard]] T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			static constexpr std::size_t EffectiveAlignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+	};
+
+	template<typename T, std::size_t Alignment>
+	struct AlignedDeleter
+	{
+		AlignedDeleter() = default;
+
+		void operator()(T* ptr) const noexcept;
+	};
+
+	template<typename T, std::size_t Alignment>
+	struct AlignedDeleter<T[], Alignment>
+	{
+		AlignedDeleter() = default;
+		explicit AlignedDeleter(std::size_t elementCount) : count(elementCount) {}
+
+		void operator()(T* ptr) const noexcept;
+
+		std::size_t count = 0;
+	};
+
+	template<typename T, std::size_t Alignment = CacheLineSize> using AlignedUniquePtr = std::unique_ptr<T, AlignedDeleter<T, Alignment>>;
+
+	[[nodiscard]] inline void* AllocateAligned(std::size_t size, std::size_t alignment);
+	inline void FreeAligned(void* ptr, std::size_t alignment) noexcept;
+
+	template<typename T, std::size_t Alignment = CacheLineSize, typename... Args>
+	std::enable_if_t<!std::is_array_v<T>, AlignedUniquePtr<T, Alignment>> MakeUniqueAligned(Args&&... args);
+
+	template<typename T, std::size_t Alignment = CacheLineSize>
+	std::enable_if_t<std::is_array_v<T> && std::extent_v<T> == 0, AlignedUniquePtr<T, Alignment>> MakeUniqueAligned(std::size_t count);
+
 	template<typename T, typename... Args>
 	constexpr T* PlacementNew(T* ptr, Args&&... args);
 
 	template<typename T>
 	constexpr void PlacementDestroy(T* ptr);
+
+	template<typename T>
+	T* RelocateRange(T* src, T* dst, std::size_t count) noexcept(IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>);
+
+	template<typename T1, std::size_t A1, typename T2, std::size_t A2> constexpr bool operator==(const AlignedAllocator<T1, A1>&, const AlignedAllocator<T2, A2>&) noexcept;
+	template<typename T1, std::size_t A1, typename T2, std::size_t A2> constexpr bool operator!=(const AlignedAllocator<T1, A1>&, const AlignedAllocator<T2, A2>&) noexcept;
 }
 
 #include <NazaraUtils/MemoryHelper.inl>
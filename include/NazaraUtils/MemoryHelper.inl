@@ -2,7 +2,10 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <NazaraUtils/CallOnExit.hpp>
 #include <cassert>
+#include <cstring>
+#include <functional>
 #include <new>
 #include <utility>
 
@@ -14,6 +17,129 @@ namespace Nz
 	* \brief Core functions that helps the handle of memory in the engine
 	*/
 
+	/*!
+	* \ingroup utils
+	* \class Nz::AlignedAllocator
+	* \brief Standard allocator returning storage aligned to at least Alignment bytes (e.g. for aligned SIMD loads)
+	*
+	* \remark Alignment may be lower than alignof(T), in which case alignof(T) is used
+	*/
+
+	/*!
+	* \brief Allocates uninitialized storage for count objects
+	* \return Pointer to the storage, aligned to EffectiveAlignment
+	*
+	* \param count Number of objects
+	*/
+	template<typename T, std::size_t Alignment>
+	T* AlignedAllocator<T, Alignment>::allocate(std::size_t count)
+	{
+		if (count > std::size_t(-1) / sizeof(T))
+			throw std::bad_array_new_length();
+
+		return static_cast<T*>(AllocateAligned(count * sizeof(T), EffectiveAlignment));
+	}
+
+	/*!
+	* \brief Frees storage previously returned by allocate
+	*
+	* \param ptr Pointer returned by allocate
+	* \param count Number of objects passed to allocate
+	*/
+	template<typename T, std::size_t Alignment>
+	void AlignedAllocator<T, Alignment>::deallocate(T* ptr, [[maybe_unused]] std::size_t count) noexcept
+	{
+		FreeAligned(ptr, EffectiveAlignment);
+	}
+
+	template<typename T, std::size_t Alignment>
+	void AlignedDeleter<T, Alignment>::operator()(T* ptr) const noexcept
+	{
+		constexpr std::size_t alignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+
+		PlacementDestroy(ptr);
+		FreeAligned(ptr, alignment);
+	}
+
+	template<typename T, std::size_t Alignment>
+	void AlignedDeleter<T[], Alignment>::operator()(T* ptr) const noexcept
+	{
+		constexpr std::size_t alignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+
+		if (ptr)
+		{
+			std::destroy_n(ptr, count);
+			FreeAligned(ptr, alignment);
+		}
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory with a specific alignment
+	* \return Pointer to the memory block, which must be freed using FreeAligned with the same alignment
+	*
+	* \param size Size of the memory block in bytes
+	* \param alignment Alignment of the memory block, must be a power of two
+	*
+	* \remark Throws std::bad_alloc on failure
+	*/
+	void* AllocateAligned(std::size_t size, std::size_t alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+		return ::operator new(size, std::align_val_t(alignment));
+	}
+
+	/*!
+	* \brief Frees memory allocated by AllocateAligned
+	*
+	* \param ptr Pointer returned by AllocateAligned (may be null)
+	* \param alignment Alignment given to AllocateAligned
+	*/
+	void FreeAligned(void* ptr, std::size_t alignment) noexcept
+	{
+		::operator delete(ptr, std::align_val_t(alignment));
+	}
+
+	/*!
+	* \brief Constructs an object in memory aligned to at least Alignment bytes
+	* \return Owning pointer to the object
+	*
+	* \param args Arguments for the constructor
+	*/
+	template<typename T, std::size_t Alignment, typename... Args>
+	std::enable_if_t<!std::is_array_v<T>, AlignedUniquePtr<T, Alignment>> MakeUniqueAligned(Args&&... args)
+	{
+		constexpr std::size_t alignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+
+		void* memory = AllocateAligned(sizeof(T), alignment);
+		CallOnExit freeMemory([&] { FreeAligned(memory, alignment); });
+
+		T* ptr = PlacementNew(static_cast<T*>(memory), std::forward<Args>(args)...);
+		freeMemory.Reset();
+
+		return AlignedUniquePtr<T, Alignment>(ptr);
+	}
+
+	/*!
+	* \brief Constructs an array of value-initialized objects in memory aligned to at least Alignment bytes
+	* \return Owning pointer to the array
+	*
+	* \param count Number of objects
+	*/
+	template<typename T, std::size_t Alignment>
+	std::enable_if_t<std::is_array_v<T> && std::extent_v<T> == 0, AlignedUniquePtr<T, Alignment>> MakeUniqueAligned(std::size_t count)
+	{
+		using U = std::remove_extent_t<T>;
+		constexpr std::size_t alignment = (Alignment > alignof(U)) ? Alignment : alignof(U);
+
+		U* memory = AlignedAllocator<U, alignment>().allocate(count);
+		CallOnExit freeMemory([&] { FreeAligned(memory, alignment); });
+
+		std::uninitialized_value_construct_n(memory, count);
+		freeMemory.Reset();
+
+		return AlignedUniquePtr<T, Alignment>(memory, AlignedDeleter<T, Alignment>(count));
+	}
+
 	/*!
 	* \brief Constructs the object inplace
 	* \return Pointer to the constructed object
@@ -40,4 +166,63 @@ namespace Nz
 		if (ptr)
 			ptr->~T();
 	}
+
+	/*!
+	* \brief Moves objects to another address, ending their lifetime at the source
+	* \return Pointer past the last relocated object (dst + count)
+	*
+	* \param src Pointer to the first object to relocate
+	* \param dst Pointer to raw memory receiving the objects
+	* \param count Number of objects to relocate
+	*
+	* Objects are copied with a memmove when IsTriviallyRelocatable<T> is true, and move-constructed then destroyed otherwise.
+	*
+	* \remark Ranges may overlap, in which case only the objects outside the destination range are left uninitialized
+	*/
+	template<typename T>
+	T* RelocateRange(T* src, T* dst, std::size_t count) noexcept(IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+	{
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			if (count > 0)
+				std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+		}
+		else
+		{
+			if (src == dst)
+				return dst + count;
+
+			if (std::less<T*>()(dst, src))
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					PlacementNew(dst + i, std::move(src[i]));
+					PlacementDestroy(src + i);
+				}
+			}
+			else
+			{
+				// Destination is after the source, relocate from the end so overlapping objects are moved before being overwritten
+				for (std::size_t i = count; i > 0; --i)
+				{
+					PlacementNew(dst + i - 1, std::move(src[i - 1]));
+					PlacementDestroy(src + i - 1);
+				}
+			}
+		}
+
+		return dst + count;
+	}
+
+	template<typename T1, std::size_t A1, typename T2, std::size_t A2>
+	constexpr bool operator==(const AlignedAllocator<T1, A1>&, const AlignedAllocator<T2, A2>&) noexcept
+	{
+		return A1 == A2;
+	}
+
+	template<typename T1, std::size_t A1, typename T2, std::size_t A2>
+	constexpr bool operator!=(const AlignedAllocator<T1, A1>& lhs, const AlignedAllocator<T2, A2>& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
 }
@@ -9,49 +9,104 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/FastDivider.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace Nz
 {
-	template<typename T, std::size_t Alignment, bool Const>
+	template<typename Pool, bool Const>
 	class MemoryPoolIterator;
 
-	template<typename T, std::size_t Alignment = alignof(T)>
+	struct MemoryPoolDefaultPolicy
+	{
+		static constexpr bool EnableStatistics = false;
+		static constexpr bool TrackGenerations = false;
+	};
+
+	struct MemoryPoolGenerationalPolicy : MemoryPoolDefaultPolicy
+	{
+		static constexpr bool TrackGenerations = true;
+	};
+
+	struct MemoryPoolStatisticsPolicy : MemoryPoolDefaultPolicy
+	{
+		static constexpr bool EnableStatistics = true;
+	};
+
+	template<typename T, std::size_t Alignment = alignof(T), typename Policy = MemoryPoolDefaultPolicy, typename Allocator = std::allocator<T>>
 	class MemoryPool
 	{
 		public:
-			using const_iterator = MemoryPoolIterator<T, Alignment, true>;
-			using iterator = MemoryPoolIterator<T, Alignment, false>;
+			using allocator_type = Allocator;
+			using const_iterator = MemoryPoolIterator<MemoryPool, true>;
+			using iterator = MemoryPoolIterator<MemoryPool, false>;
+			using value_type = T;
 			friend const_iterator;
 			friend iterator;
 
 			class DeferConstruct_t {};
 			class NoDestruction_t {};
+			struct Handle;
+			struct Statistics;
 
-			MemoryPool(std::size_t blockSize);
+			MemoryPool(std::size_t blockSize, const Allocator& allocator = Allocator());
 			MemoryPool(const MemoryPool&) = delete;
 			MemoryPool(MemoryPool&&) noexcept = default;
 			~MemoryPool();
 
 			T* Allocate(DeferConstruct_t, std::size_t& index);
 			template<typename... Args> T* Allocate(std::size_t& index, Args&&... args);
+			T* Allocate(DeferConstruct_t, Handle& handle);
+			template<typename... Args> T* Allocate(Handle& handle, Args&&... args);
+			void AllocateBulk(DeferConstruct_t, std::size_t count, std::size_t* indices);
+			template<typename... Args> void AllocateBulk(std::size_t count, std::size_t* indices, const Args&... args);
 
 			void Clear();
 
+			template<typename F> void Compact(F&& relocateCallback);
+
+			ByteStreamResult<void> Deserialize(ByteReader& reader);
+
 			void Free(std::size_t index);
 			void Free(std::size_t index, NoDestruction_t);
+			void Free(const Handle& handle);
+			void Free(const Handle& handle, NoDestruction_t);
+			void FreeBulk(const std::size_t* indices, std::size_t count);
+			void FreeBulk(const std::size_t* indices, std::size_t count, NoDestruction_t);
+
+			template<typename F> void ForEach(F&& callback);
+			template<typename F> void ForEach(F&& callback) const;
+			template<typename F> void ForEachRange(std::size_t beginBlock, std::size_t endBlock, F&& callback);
+			template<typename F> void ForEachRange(std::size_t beginBlock, std::size_t endBlock, F&& callback) const;
 
 			std::size_t GetAllocatedEntryCount() const;
+			Allocator GetAllocator() const;
 			std::size_t GetBlockCount() const;
 			std::size_t GetBlockSize() const;
 			std::size_t GetFreeEntryCount() const;
+			Handle GetHandle(std::size_t index) const;
+			std::size_t GetSerializedSize() const;
+			const Statistics& GetStatistics() const;
+
+			bool IsValid(const Handle& handle) const;
 
 			void Reset();
+			void ResetStatistics();
+
+			ByteStreamResult<void> Serialize(ByteWriter& writer) const;
+
+			void ShrinkToFit();
 
 			T* RetrieveFromIndex(std::size_t index);
 			const T* RetrieveFromIndex(std::size_t index) const;
-			std::size_t RetrieveEntryIndex(const T* data);
+			std::size_t RetrieveEntryIndex(const T* data) const;
+
+			T* TryRetrieve(const Handle& handle);
+			const T* TryRetrieve(const Handle& handle) const;
 
 			// std interface
 			iterator begin();
@@ -69,37 +124,124 @@ namespace Nz
 			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
 			static constexpr NoDestruction_t NoDestruction = {};
 
+			struct Handle
+			{
+				bool operator==(const Handle& handle) const;
+				bool operator!=(const Handle& handle) const;
+
+				std::size_t index = InvalidIndex;
+				UInt32 generation = 0; //< Odd while the entry is alive
+			};
+
+			struct Statistics
+			{
+				std::size_t allocationCount = 0;
+				std::size_t blockAllocationCount = 0;
+				std::size_t blockReleaseCount = 0;
+				std::size_t freeCount = 0;
+				std::size_t liveEntryCount = 0;
+				std::size_t peakBlockCount = 0;
+				std::size_t peakLiveEntryCount = 0;
+				std::size_t relocationCount = 0;
+				std::size_t scannedBlockCount = 0; //< Blocks searched for free entries
+				std::size_t scannedWordCount = 0;  //< Bitset words read to find free entries (block availability and entry occupancy)
+			};
+
 		private:
+			struct Block;
+
 			void AllocateBlock();
+			template<typename F> void AllocateEntries(std::size_t count, std::size_t* indices, F&& entryCallback);
+			std::size_t FindFreeEntry(std::size_t blockIndex) const;
+			std::size_t FindLastAllocatedEntry(std::size_t blockIndex) const;
+			template<typename F> void FreeEntries(const std::size_t* indices, std::size_t count, F&& entryCallback);
 			T* GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex);
 			const T* GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const;
 			std::pair<std::size_t, std::size_t> GetFirstAllocatedEntry() const;
 			std::pair<std::size_t, std::size_t> GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const;
+			UInt64 GetFreeEntryMask(std::size_t blockIndex, std::size_t bitBlockIndex) const;
 			std::pair<std::size_t, std::size_t> GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const;
 
-			using AlignedStorage = std::aligned_storage_t<sizeof(T), Alignment>;
+			void ReleaseBlocks(std::size_t firstBlockIndex);
+
+			template<typename F> static void ForEachAllocatedRange(const Block& block, F&& callback);
+			template<typename Pool, typename F> static void ForEachEntry(Pool& pool, std::size_t beginBlock, std::size_t endBlock, F&& callback);
+
+			void RecordAllocations(std::size_t entryCount, std::size_t scannedBlockCount, std::size_t scannedWordCount);
+			void RecordFrees(std::size_t entryCount);
+
+			static T* GetEntryPointer(const Block& block, std::size_t localIndex);
+			static void IncrementGeneration(Block& block, std::size_t localIndex);
+
+			static constexpr std::size_t EntryAlignment = (Alignment > alignof(T)) ? Alignment : alignof(T);
+			static constexpr std::size_t SerializedHeaderSize = 2 * sizeof(UInt8) + 2 * sizeof(UInt32) + 2 * sizeof(UInt64);
+
+			struct alignas(EntryAlignment) AlignedStorage
+			{
+				std::byte data[sizeof(T)];
+			};
+
+			using AllocatorTraits = std::allocator_traits<Allocator>;
+			using BitsetAllocator = typename AllocatorTraits::template rebind_alloc<UInt64>;
+			using OccupancyBitset = Bitset<UInt64, BitsetAllocator>;
+
+			struct GenerationalEntry
+			{
+				UInt32 generation = 0; //< Incremented on allocation and on free
+				AlignedStorage storage;
+			};
+
+			using Entry = std::conditional_t<Policy::TrackGenerations, GenerationalEntry, AlignedStorage>;
+			// Over-aligned entries get their storage from AlignedAllocator, unless a custom allocator was provided
+			static constexpr bool UseAlignedAllocator = alignof(Entry) > alignof(std::max_align_t) && std::is_same_v<Allocator, std::allocator<T>>;
+
+			using EntryAllocator = std::conditional_t<UseAlignedAllocator, AlignedAllocator<Entry, alignof(Entry)>, typename AllocatorTraits::template rebind_alloc<Entry>>;
+			using EntryAllocatorTraits = std::allocator_traits<EntryAllocator>;
+
+			struct BlockDeleter
+			{
+				void operator()(Entry* memory);
+
+				EntryAllocator allocator;
+				std::size_t entryCount;
+			};
 
 			struct Block
 			{
 				std::size_t occupiedEntryCount = 0;
-				std::unique_ptr<AlignedStorage[]> memory;
-				Bitset<UInt64> freeEntries;
-				Bitset<UInt64> occupiedEntries; //< Opposite of freeEntries
+				std::unique_ptr<Entry[], BlockDeleter> memory;
+				OccupancyBitset occupiedEntries; //< Free entries are the unset bits
 			};
 
+			struct DisabledStatistics {};
+
+			struct BlockAddress
+			{
+				const T* startPtr;
+				std::size_t blockIndex;
+			};
+
+			using BlockAllocator = typename AllocatorTraits::template rebind_alloc<Block>;
+			using BlockAddressAllocator = typename AllocatorTraits::template rebind_alloc<BlockAddress>;
+
 			std::size_t m_blockSize;
-			std::vector<Block> m_blocks;
+			FastDivider<std::size_t> m_blockSizeDivider; //< avoids hardware divisions when splitting indices into block/local indices
+			std::vector<Block, BlockAllocator> m_blocks;
+			std::vector<BlockAddress, BlockAddressAllocator> m_blockAddresses; //< Sorted by address
+			OccupancyBitset m_availableBlocks; //< Blocks having at least one free entry
+			Allocator m_allocator;
+			std::conditional_t<Policy::EnableStatistics, Statistics, DisabledStatistics> m_statistics;
+			UInt32 m_generationBase; //< Starting generation of new blocks, greater than any generation of released blocks
 	};
 
-	template<typename T, std::size_t Alignment, bool Const>
+	template<typename Pool, bool Const>
 	class MemoryPoolIterator
 	{
-		using Pool = MemoryPool<T, Alignment>;
 		friend Pool;
 
 		public:
 			using iterator_category = std::input_iterator_tag;
-			using value_type = std::conditional_t<Const, const T, T>;
+			using value_type = std::conditional_t<Const, const typename Pool::value_type, typename Pool::value_type>;
 			using difference_type = std::ptrdiff_t;
 			using pointer = value_type*;
 			using reference = value_type&;
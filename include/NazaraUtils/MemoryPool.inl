@@ -3,7 +3,12 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <NazaraUtils/Algorithm.hpp>
-#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <NazaraUtils/Profiler.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
 #include <stdexcept>
 #include <utility>
 
@@ -20,9 +25,16 @@ namespace Nz
 	*
 	* \param blockSize Size of blocks that will be allocated
 	*/
-	template<typename T, std::size_t Alignment>
-	MemoryPool<T, Alignment>::MemoryPool(std::size_t blockSize) :
-	m_blockSize(blockSize)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	MemoryPool<T, Alignment, Policy, Allocator>::MemoryPool(std::size_t blockSize, const Allocator& allocator) :
+	m_blockSize(blockSize),
+	m_blockSizeDivider(blockSize),
+	m_blocks(BlockAllocator(allocator)),
+	m_blockAddresses(BlockAddressAllocator(allocator)),
+	m_availableBlocks(BitsetAllocator(allocator)),
+	m_allocator(allocator),
+	m_statistics(),
+	m_generationBase(0)
 	{
 		// Allocate one block by default
 		AllocateBlock();
@@ -31,8 +43,8 @@ namespace Nz
 	/*!
 	* \brief Destroy the memory pool, calling the destructor for every allocated object and desallocating blocks
 	*/
-	template<typename T, std::size_t Alignment>
-	MemoryPool<T, Alignment>::~MemoryPool()
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	MemoryPool<T, Alignment, Policy, Allocator>::~MemoryPool()
 	{
 		Reset();
 	}
@@ -42,25 +54,28 @@ namespace Nz
 	* \return A pointer to memory allocated
 	*
 	* \param index Output entry index (which can be used for deallocation)
+	*
+	* \remark This doesn't depend on the number of full blocks, as blocks with free entries are tracked separately
 	*/
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::Allocate(DeferConstruct_t, std::size_t& index)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::Allocate(DeferConstruct_t, std::size_t& index)
 	{
-		std::size_t blockIndex = 0;
-		std::size_t localIndex = InvalidIndex;
-		for (; blockIndex < m_blocks.size(); ++blockIndex)
+		// Blocks with free room are tracked by m_availableBlocks, we don't have to scan full blocks
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		std::size_t blockIndex = m_availableBlocks.FindFirst();
+		std::size_t localIndex;
+		if (blockIndex != m_availableBlocks.npos)
 		{
-			auto& block = m_blocks[blockIndex];
-			if (block.occupiedEntryCount == m_blockSize)
-				continue;
+			localIndex = FindFreeEntry(blockIndex);
+			assert(localIndex != InvalidIndex);
 
-			localIndex = block.freeEntries.FindFirst();
-			assert(localIndex != block.freeEntries.npos);
-			break;
+			RecordAllocations(1, 1, blockIndex / bitsPerBlock + 1 + localIndex / bitsPerBlock + 1);
 		}
-
-		if (blockIndex >= m_blocks.size())
+		else
 		{
+			RecordAllocations(1, 0, m_availableBlocks.GetBlockCount());
+
 			// No more room, allocate a new block
 			blockIndex = m_blocks.size();
 			localIndex = 0;
@@ -68,18 +83,16 @@ namespace Nz
 			AllocateBlock();
 		}
 
-		assert(localIndex != InvalidIndex);
-
 		auto& block = m_blocks[blockIndex];
-		block.freeEntries.Reset(localIndex);
 		block.occupiedEntries.Set(localIndex);
-		block.occupiedEntryCount++;
+		if (++block.occupiedEntryCount == m_blockSize)
+			m_availableBlocks.Reset(blockIndex);
 
-		T* entry = std::launder(reinterpret_cast<T*>(&block.memory[localIndex]));
+		IncrementGeneration(block, localIndex);
 
 		index = blockIndex * m_blockSize + localIndex;
 
-		return entry;
+		return GetEntryPointer(block, localIndex);
 	}
 
 	/*!
@@ -88,9 +101,9 @@ namespace Nz
 	*
 	* \param index Output entry index (which can be used for deallocation)
 	*/
-	template<typename T, std::size_t Alignment>
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
 	template<typename... Args>
-	T* MemoryPool<T, Alignment>::Allocate(std::size_t& index, Args&&... args)
+	T* MemoryPool<T, Alignment, Policy, Allocator>::Allocate(std::size_t& index, Args&&... args)
 	{
 		T* entry = Allocate(DeferConstruct, index);
 		PlacementNew(entry, std::forward<Args>(args)...);
@@ -98,6 +111,77 @@ namespace Nz
 		return entry;
 	}
 
+	/*!
+	* \brief Allocates enough memory for the size and returns a pointer to it
+	* \return A pointer to memory allocated
+	*
+	* \param handle Output entry handle, which can be checked for validity later
+	*
+	* \remark This requires a policy with TrackGenerations enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::Allocate(DeferConstruct_t, Handle& handle)
+	{
+		static_assert(Policy::TrackGenerations, "handles require a policy with TrackGenerations enabled");
+
+		T* entry = Allocate(DeferConstruct, handle.index);
+		handle = GetHandle(handle.index);
+
+		return entry;
+	}
+
+	/*!
+	* \brief Allocates enough memory for the size and returns a pointer to it
+	* \return A pointer to memory allocated
+	*
+	* \param handle Output entry handle, which can be checked for validity later
+	*
+	* \remark This requires a policy with TrackGenerations enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename... Args>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::Allocate(Handle& handle, Args&&... args)
+	{
+		T* entry = Allocate(DeferConstruct, handle);
+		PlacementNew(entry, std::forward<Args>(args)...);
+
+		return entry;
+	}
+
+	/*!
+	* \brief Allocates multiple entries at once without constructing them
+	*
+	* \param count Number of entries to allocate
+	* \param indices Output array (of at least count elements) receiving entry indices
+	*
+	* \remark Free entries are claimed by whole bitset words, making this much cheaper than count calls to Allocate
+	* \remark Entries are allocated in increasing index order inside each block
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::AllocateBulk(DeferConstruct_t, std::size_t count, std::size_t* indices)
+	{
+		AllocateEntries(count, indices, [](T* /*entry*/) {});
+	}
+
+	/*!
+	* \brief Allocates and constructs multiple entries at once
+	*
+	* \param count Number of entries to allocate
+	* \param indices Output array (of at least count elements) receiving entry indices
+	* \param args Arguments used to construct every entry (they are copied, not forwarded)
+	*
+	* \remark Free entries are claimed by whole bitset words, making this much cheaper than count calls to Allocate
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename... Args>
+	void MemoryPool<T, Alignment, Policy, Allocator>::AllocateBulk(std::size_t count, std::size_t* indices, const Args&... args)
+	{
+		AllocateEntries(count, indices, [&](T* entry)
+		{
+			PlacementNew(entry, args...);
+		});
+	}
+
 	/*!
 	* \brief Clears the memory pool
 	*
@@ -105,12 +189,184 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Clear()
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Clear()
 	{
 		Reset();
+		ReleaseBlocks(0);
+	}
+
+	/*!
+	* \brief Moves allocated entries from the last blocks to free entries of the first blocks
+	*
+	* Entries are moved (using their move constructor) to the lowest free entries, as long as a free entry exists in a block before them.
+	* This reduces fragmentation and improves iteration locality, ShrinkToFit can then be called to release the emptied blocks.
+	*
+	* \param relocateCallback Callback called as relocateCallback(oldIndex, newIndex) after every moved entry
+	*
+	* \remark Pointers, indices and handles to moved entries are invalidated, relocateCallback must be used to update them
+	*
+	* \see ShrinkToFit
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Compact(F&& relocateCallback)
+	{
+		static_assert(std::is_move_constructible_v<T>, "T must be move constructible to be relocated");
+
+		NazaraProfileScope("MemoryPool::Compact");
+
+		for (std::size_t srcBlockIndex = m_blocks.size(); srcBlockIndex-- > 0;)
+		{
+			auto& srcBlock = m_blocks[srcBlockIndex];
+			while (srcBlock.occupiedEntryCount > 0)
+			{
+				std::size_t dstBlockIndex = m_availableBlocks.FindFirst();
+				if (dstBlockIndex == m_availableBlocks.npos || dstBlockIndex >= srcBlockIndex)
+					return; //< No free entry before this block
+
+				std::size_t srcLocalIndex = FindLastAllocatedEntry(srcBlockIndex);
+				std::size_t dstLocalIndex = FindFreeEntry(dstBlockIndex);
+				assert(srcLocalIndex != InvalidIndex);
+				assert(dstLocalIndex != InvalidIndex);
+
+				auto& dstBlock = m_blocks[dstBlockIndex];
+
+				RelocateRange(GetEntryPointer(srcBlock, srcLocalIndex), GetEntryPointer(dstBlock, dstLocalIndex), 1);
+
+				dstBlock.occupiedEntries.Set(dstLocalIndex);
+				if (++dstBlock.occupiedEntryCount == m_blockSize)
+					m_availableBlocks.Reset(dstBlockIndex);
+
+				IncrementGeneration(dstBlock, dstLocalIndex);
 
-		m_blocks.clear();
+				if (srcBlock.occupiedEntryCount-- == m_blockSize)
+					m_availableBlocks.Set(srcBlockIndex);
+
+				srcBlock.occupiedEntries.Reset(srcLocalIndex);
+				IncrementGeneration(srcBlock, srcLocalIndex);
+
+				if constexpr (Policy::EnableStatistics)
+					m_statistics.relocationCount++;
+
+				relocateCallback(srcBlockIndex * m_blockSize + srcLocalIndex, dstBlockIndex * m_blockSize + dstLocalIndex);
+			}
+		}
+	}
+
+	/*!
+	* \brief Replaces the content of the pool by a snapshot written by Serialize
+	* \return Nothing, or an error if the snapshot is truncated, corrupted or was written for another entry type or platform
+	*
+	* Entries are restored at the same indices (with the same generations), the block size of the pool is replaced by the one of the snapshot.
+	* Entries are copied in bulk from the reader buffer, which can come straight from a memory-mapped file (see MappedFile).
+	*
+	* \param reader Reader to read the snapshot from (with the same endianness as the writer used to serialize it)
+	*
+	* \remark This requires a trivially copyable T, existing entries are freed without calling their destructor
+	* \remark On failure, the pool is left empty (without any block)
+	*
+	* \see Serialize
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	ByteStreamResult<void> MemoryPool<T, Alignment, Policy, Allocator>::Deserialize(ByteReader& reader)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "serialization requires a trivially copyable type");
+
+		NazaraProfileScope("MemoryPool::Deserialize");
+
+		Clear();
+
+		NAZARA_TRY_VALUE(UInt8 endianness, reader.Read<UInt8>());
+		NAZARA_TRY_VALUE(UInt8 trackGenerations, reader.Read<UInt8>());
+		NAZARA_TRY_VALUE(UInt32 entrySize, reader.Read<UInt32>());
+		NAZARA_TRY_VALUE(UInt32 generationBase, reader.Read<UInt32>());
+		NAZARA_TRY_VALUE(UInt64 blockSize, reader.Read<UInt64>());
+		NAZARA_TRY_VALUE(UInt64 blockCount, reader.Read<UInt64>());
+
+		// Entries are stored as raw memory, they can only be read back with the same layout
+		if NAZARA_UNLIKELY(endianness != UInt8(PlatformEndianness) || trackGenerations != UInt8(Policy::TrackGenerations) || entrySize != sizeof(Entry))
+			return Err(ByteStreamError::InvalidData);
+
+		if NAZARA_UNLIKELY(blockSize == 0 || blockSize > std::numeric_limits<std::size_t>::max() / sizeof(Entry))
+			return Err(ByteStreamError::InvalidData);
+
+		// Each block stores at least its occupancy bits, don't allocate blocks for a truncated snapshot
+		constexpr std::size_t bitsPerBlock = OccupancyBitset::bitsPerBlock;
+		std::size_t occupancyWordCount = static_cast<std::size_t>((blockSize + bitsPerBlock - 1) / bitsPerBlock);
+		if NAZARA_UNLIKELY(blockCount > reader.GetRemainingSize() / (occupancyWordCount * sizeof(UInt64)))
+			return Err(ByteStreamError::EndOfBuffer);
+
+		m_blockSize = static_cast<std::size_t>(blockSize);
+		m_blockSizeDivider = FastDivider<std::size_t>(m_blockSize);
+		m_generationBase = generationBase;
+
+		CallOnExit clearOnFailure([&] { Clear(); });
+
+		std::size_t entryCount = 0;
+		for (std::size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+		{
+			AllocateBlock();
+			auto& block = m_blocks[blockIndex];
+
+			std::size_t lastWordBitCount = m_blockSize % bitsPerBlock;
+			for (std::size_t i = 0; i < occupancyWordCount; ++i)
+			{
+				NAZARA_TRY_VALUE(UInt64 occupancyWord, reader.Read<UInt64>());
+
+				// Bits past the block size would reference entries outside of the block
+				if NAZARA_UNLIKELY(i == occupancyWordCount - 1 && lastWordBitCount != 0 && (occupancyWord >> lastWordBitCount) != 0)
+					return Err(ByteStreamError::InvalidData);
+
+				block.occupiedEntries.SetBlock(i, occupancyWord);
+			}
+
+			block.occupiedEntryCount = block.occupiedEntries.Count();
+			if (block.occupiedEntryCount == m_blockSize)
+				m_availableBlocks.Reset(blockIndex);
+
+			entryCount += block.occupiedEntryCount;
+
+			ByteStreamResult<void> result = Ok();
+			ForEachAllocatedRange(block, [&](std::size_t firstIndex, std::size_t count)
+			{
+				if (!result.IsOk())
+					return;
+
+				ByteStreamResult<const UInt8*> entries = reader.ReadBytes(count * sizeof(Entry));
+				if NAZARA_UNLIKELY(!entries.IsOk())
+				{
+					result = Err(entries.GetError());
+					return;
+				}
+
+				std::memcpy(static_cast<void*>(&block.memory[firstIndex]), entries.GetValue(), count * sizeof(Entry));
+			});
+			NAZARA_TRY(std::move(result));
+
+			if constexpr (Policy::TrackGenerations)
+			{
+				// Generations of allocated entries were read with them, only the ones of free entries follow.
+				// Generations are odd while the entry is alive, don't let a corrupted snapshot validate handles to free entries
+				for (std::size_t localIndex = 0; localIndex < m_blockSize; ++localIndex)
+				{
+					bool isAllocated = block.occupiedEntries.Test(localIndex);
+					if (!isAllocated)
+					{
+						NAZARA_TRY_VALUE(UInt32 generation, reader.Read<UInt32>());
+						block.memory[localIndex].generation = generation;
+					}
+
+					if NAZARA_UNLIKELY(((block.memory[localIndex].generation & 1) != 0) != isAllocated)
+						return Err(ByteStreamError::InvalidData);
+				}
+			}
+		}
+
+		RecordAllocations(entryCount, 0, 0);
+
+		clearOnFailure.Reset();
+		return Ok();
 	}
 
 	/*!
@@ -122,21 +378,23 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Free(std::size_t index)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Free(std::size_t index)
 	{
-		std::size_t blockIndex = index / m_blockSize;
-		std::size_t localIndex = index % m_blockSize;
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(index);
 
 		T* entry = GetAllocatedPointer(blockIndex, localIndex);
 		PlacementDestroy(entry);
 
 		auto& block = m_blocks[blockIndex];
 		assert(block.occupiedEntryCount > 0);
-		block.occupiedEntryCount--;
+		if (block.occupiedEntryCount-- == m_blockSize)
+			m_availableBlocks.Set(blockIndex);
 
-		block.freeEntries.Set(localIndex);
 		block.occupiedEntries.Reset(localIndex);
+		IncrementGeneration(block, localIndex);
+
+		RecordFrees(1);
 	}
 	
 	/*!
@@ -148,26 +406,161 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Free(std::size_t index, NoDestruction_t)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Free(std::size_t index, NoDestruction_t)
 	{
-		std::size_t blockIndex = index / m_blockSize;
-		std::size_t localIndex = index % m_blockSize;
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(index);
 
 		auto& block = m_blocks[blockIndex];
 		assert(block.occupiedEntryCount > 0);
-		block.occupiedEntryCount--;
+		if (block.occupiedEntryCount-- == m_blockSize)
+			m_availableBlocks.Set(blockIndex);
 
-		block.freeEntries.Set(localIndex);
 		block.occupiedEntries.Reset(localIndex);
+		IncrementGeneration(block, localIndex);
+
+		RecordFrees(1);
+	}
+
+	/*!
+	* \brief Returns an object memory to the memory pool
+	*
+	* Calls the destructor of the target object and returns its memory to the pool, every handle to this entry becomes invalid
+	*
+	* \param handle Valid handle of the allocated object
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Free(const Handle& handle)
+	{
+		assert(IsValid(handle));
+		Free(handle.index);
+	}
+
+	/*!
+	* \brief Returns an object memory to the memory pool without calling its destructor
+	*
+	* \param handle Valid handle of the allocated object
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Free(const Handle& handle, NoDestruction_t)
+	{
+		assert(IsValid(handle));
+		Free(handle.index, NoDestruction);
+	}
+
+	/*!
+	* \brief Returns multiple object memory to the memory pool
+	*
+	* Calls the destructor of the target objects and returns their memory to the pool
+	*
+	* \param indices Indices of the allocated objects
+	* \param count Number of indices
+	*
+	* \remark Consecutive indices sharing a bitset word are released with a single word update, sorted indices are the fastest to free
+	*
+	* \see Free
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::FreeBulk(const std::size_t* indices, std::size_t count)
+	{
+		FreeEntries(indices, count, [](T* entry)
+		{
+			PlacementDestroy(entry);
+		});
+	}
+
+	/*!
+	* \brief Returns multiple object memory to the memory pool
+	*
+	* Returns the target objects memory to the pool without calling their destructor
+	*
+	* \param indices Indices of the allocated objects
+	* \param count Number of indices
+	*
+	* \see Free
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::FreeBulk(const std::size_t* indices, std::size_t count, NoDestruction_t)
+	{
+		FreeEntries(indices, count, [](T* /*entry*/) {});
+	}
+
+	/*!
+	* \brief Calls a callback for every allocated entry
+	*
+	* This is faster than iterating using iterators as occupancy is read one 64-bit word at a time and empty blocks are skipped.
+	*
+	* \param callback Callback called as callback(entry) or callback(index, entry) for every allocated entry, in increasing index order
+	*
+	* \remark The callback may free the entry it's called with but must not allocate or free other entries
+	*
+	* \see ForEachRange
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEach(F&& callback)
+	{
+		ForEachEntry(*this, 0, m_blocks.size(), std::forward<F>(callback));
+	}
+
+	/*!
+	* \brief Calls a callback for every allocated entry
+	*
+	* \param callback Callback called as callback(entry) or callback(index, entry) for every allocated entry, in increasing index order
+	*
+	* \see ForEachRange
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEach(F&& callback) const
+	{
+		ForEachEntry(*this, 0, m_blocks.size(), std::forward<F>(callback));
+	}
+
+	/*!
+	* \brief Calls a callback for every allocated entry of a range of blocks
+	*
+	* Splitting the pool in disjoint block ranges allows multiple threads to process entries in parallel without overlap.
+	*
+	* \param beginBlock Index of the first block to process
+	* \param endBlock Index of the block following the last block to process (will be clamped to the block count)
+	* \param callback Callback called as callback(entry) or callback(index, entry) for every allocated entry, in increasing index order
+	*
+	* \remark The callback may free the entry it's called with but must not allocate or free other entries
+	*
+	* \see ForEach
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEachRange(std::size_t beginBlock, std::size_t endBlock, F&& callback)
+	{
+		ForEachEntry(*this, beginBlock, endBlock, std::forward<F>(callback));
+	}
+
+	/*!
+	* \brief Calls a callback for every allocated entry of a range of blocks
+	*
+	* \param beginBlock Index of the first block to process
+	* \param endBlock Index of the block following the last block to process (will be clamped to the block count)
+	* \param callback Callback called as callback(entry) or callback(index, entry) for every allocated entry, in increasing index order
+	*
+	* \remark Multiple threads can call this on disjoint ranges of the same pool at the same time
+	*
+	* \see ForEach
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEachRange(std::size_t beginBlock, std::size_t endBlock, F&& callback) const
+	{
+		ForEachEntry(*this, beginBlock, endBlock, std::forward<F>(callback));
 	}
 
 	/*!
 	* \brief Returns the number of allocated entries
 	* \return How many entries are currently allocated
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetAllocatedEntryCount() const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::GetAllocatedEntryCount() const
 	{
 		std::size_t count = 0;
 		for (auto& block : m_blocks)
@@ -176,12 +569,22 @@ namespace Nz
 		return count;
 	}
 
+	/*!
+	* \brief Gets the allocator used for blocks and their metadata
+	* \return A copy of the allocator
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	Allocator MemoryPool<T, Alignment, Policy, Allocator>::GetAllocator() const
+	{
+		return m_allocator;
+	}
+
 	/*!
 	* \brief Gets the block count
 	* \return How many block are currently allocated for this memory pool
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetBlockCount() const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::GetBlockCount() const
 	{
 		return m_blocks.size();
 	}
@@ -190,8 +593,8 @@ namespace Nz
 	* \brief Gets the block size
 	* \return Size of each block (i.e. how many items can fit in a block)
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetBlockSize() const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::GetBlockSize() const
 	{
 		return m_blockSize;
 	}
@@ -200,13 +603,86 @@ namespace Nz
 	* \brief Returns the number of free entries
 	* \return How many entries are currently freed
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetFreeEntryCount() const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::GetFreeEntryCount() const
 	{
 		std::size_t count = m_blocks.size() * m_blockSize;
 		return count - GetAllocatedEntryCount();
 	}
 
+	/*!
+	* \brief Builds a handle for an allocated entry
+	* \return Handle referencing the entry with its current generation
+	*
+	* \param index Index of an allocated entry
+	*
+	* \remark This requires a policy with TrackGenerations enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::GetHandle(std::size_t index) const -> Handle
+	{
+		static_assert(Policy::TrackGenerations, "handles require a policy with TrackGenerations enabled");
+
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(index);
+		assert(blockIndex < m_blocks.size());
+		assert(m_blocks[blockIndex].occupiedEntries.Test(localIndex));
+
+		Handle handle;
+		handle.index = index;
+		handle.generation = m_blocks[blockIndex].memory[localIndex].generation;
+
+		return handle;
+	}
+
+	/*!
+	* \brief Computes the number of bytes written by Serialize
+	* \return Size of the snapshot of the pool
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::GetSerializedSize() const
+	{
+		std::size_t size = SerializedHeaderSize;
+		for (auto& block : m_blocks)
+		{
+			size += block.occupiedEntries.GetBlockCount() * sizeof(UInt64);
+			size += block.occupiedEntryCount * sizeof(Entry);
+			if constexpr (Policy::TrackGenerations)
+				size += (m_blockSize - block.occupiedEntryCount) * sizeof(UInt32); //< generations of free entries
+		}
+
+		return size;
+	}
+
+	/*!
+	* \brief Gets the pool statistics
+	* \return Statistics accumulated since the pool creation or the last call to ResetStatistics
+	*
+	* \remark This requires a policy with EnableStatistics enabled
+	*
+	* \see ResetStatistics
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::GetStatistics() const -> const Statistics&
+	{
+		static_assert(Policy::EnableStatistics, "statistics require a policy with EnableStatistics enabled");
+
+		return m_statistics;
+	}
+
+	/*!
+	* \brief Checks if a handle still references an allocated entry
+	* \return True if the entry referenced by handle wasn't freed since the handle was made
+	*
+	* \param handle Handle to check
+	*
+	* \remark Generations are stored next to the entry, validating a handle only reads the entry header
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	bool MemoryPool<T, Alignment, Policy, Allocator>::IsValid(const Handle& handle) const
+	{
+		return TryRetrieve(handle) != nullptr;
+	}
+
 	/*!
 	* \brief Resets the memory pool
 	*
@@ -215,8 +691,8 @@ namespace Nz
 	*
 	* \see Clear
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Reset()
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::Reset()
 	{
 		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
 		{
@@ -226,14 +702,109 @@ namespace Nz
 
 			for (std::size_t localIndex = block.occupiedEntries.FindFirst(); localIndex != block.occupiedEntries.npos; localIndex = block.occupiedEntries.FindNext(localIndex))
 			{
-				T* entry = std::launder(reinterpret_cast<T*>(&m_blocks[blockIndex].memory[localIndex]));
-				PlacementDestroy(entry);
+				PlacementDestroy(GetEntryPointer(block, localIndex));
+				IncrementGeneration(block, localIndex);
 			}
 
-			block.freeEntries.Reset(true);
-			block.occupiedEntries.Reset(false);
+			RecordFrees(block.occupiedEntryCount);
+
+			block.occupiedEntries.Reset();
 			block.occupiedEntryCount = 0;
 		}
+
+		m_availableBlocks.Set(true);
+	}
+
+	/*!
+	* \brief Resets the pool statistics counters
+	*
+	* Live entry count is kept and peak values are reset to the current values
+	*
+	* \remark This requires a policy with EnableStatistics enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ResetStatistics()
+	{
+		static_assert(Policy::EnableStatistics, "statistics require a policy with EnableStatistics enabled");
+
+		std::size_t liveEntryCount = m_statistics.liveEntryCount;
+
+		m_statistics = Statistics{};
+		m_statistics.liveEntryCount = liveEntryCount;
+		m_statistics.peakBlockCount = m_blocks.size();
+		m_statistics.peakLiveEntryCount = liveEntryCount;
+	}
+
+	/*!
+	* \brief Writes a snapshot of the pool, to be restored with Deserialize
+	* \return Nothing, or ByteStreamError::EndOfBuffer if the writer is too small (see GetSerializedSize)
+	*
+	* For each block, the occupancy bits are written followed by the raw memory of consecutive allocated entries (as big contiguous writes),
+	* and, if the policy tracks generations, by the generations of free entries (allocated entries are written along with theirs).
+	* Free entries are otherwise skipped.
+	*
+	* \param writer Writer to write the snapshot to
+	*
+	* \remark This requires a trivially copyable T, entries are written as raw memory: the snapshot can only be read on a platform with the same endianness and type layout
+	*
+	* \see Deserialize
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	ByteStreamResult<void> MemoryPool<T, Alignment, Policy, Allocator>::Serialize(ByteWriter& writer) const
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "serialization requires a trivially copyable type");
+
+		NazaraProfileScope("MemoryPool::Serialize");
+
+		NAZARA_TRY(writer.Write(UInt8(PlatformEndianness)));
+		NAZARA_TRY(writer.Write(UInt8(Policy::TrackGenerations)));
+		NAZARA_TRY(writer.Write(UInt32(sizeof(Entry))));
+		NAZARA_TRY(writer.Write(UInt32(m_generationBase)));
+		NAZARA_TRY(writer.Write(UInt64(m_blockSize)));
+		NAZARA_TRY(writer.Write(UInt64(m_blocks.size())));
+
+		for (auto& block : m_blocks)
+		{
+			for (std::size_t i = 0; i < block.occupiedEntries.GetBlockCount(); ++i)
+				NAZARA_TRY(writer.Write(block.occupiedEntries.GetBlock(i)));
+
+			ByteStreamResult<void> result = Ok();
+			ForEachAllocatedRange(block, [&](std::size_t firstIndex, std::size_t count)
+			{
+				if (result.IsOk())
+					result = writer.WriteBytes(&block.memory[firstIndex], count * sizeof(Entry));
+			});
+			NAZARA_TRY(std::move(result));
+
+			// Allocated entries were written along with their generation, only the generations of free entries are left
+			if constexpr (Policy::TrackGenerations)
+			{
+				for (std::size_t localIndex = 0; localIndex < m_blockSize; ++localIndex)
+				{
+					if (!block.occupiedEntries.Test(localIndex))
+						NAZARA_TRY(writer.Write(block.memory[localIndex].generation));
+				}
+			}
+		}
+
+		return Ok();
+	}
+
+	/*!
+	* \brief Frees every empty block at the end of the pool
+	*
+	* Blocks are only released from the end to keep entry indices stable, use Compact beforehand to move entries out of the last blocks.
+	*
+	* \see Compact
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ShrinkToFit()
+	{
+		std::size_t blockCount = m_blocks.size();
+		while (blockCount > 0 && m_blocks[blockCount - 1].occupiedEntryCount == 0)
+			blockCount--;
+
+		ReleaseBlocks(blockCount);
 	}
 
 	/*!
@@ -245,11 +816,10 @@ namespace Nz
 	*
 	* \remark index must be valid
 	*/
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::RetrieveFromIndex(std::size_t index)
 	{
-		std::size_t blockIndex = index / m_blockSize;
-		std::size_t localIndex = index % m_blockSize;
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(index);
 
 		return GetAllocatedPointer(blockIndex, localIndex);
 	}
@@ -263,11 +833,10 @@ namespace Nz
 	*
 	* \remark index must be valid
 	*/
-	template<typename T, std::size_t Alignment>
-	const T* MemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index) const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	const T* MemoryPool<T, Alignment, Policy, Allocator>::RetrieveFromIndex(std::size_t index) const
 	{
-		std::size_t blockIndex = index / m_blockSize;
-		std::size_t localIndex = index % m_blockSize;
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(index);
 
 		return GetAllocatedPointer(blockIndex, localIndex);
 	}
@@ -278,115 +847,477 @@ namespace Nz
 	* \param data Allocated entry pointed
 	* 
 	* \return Corresponding index, or InvalidIndex if it's not part of this pool
+	*
+	* \remark Blocks are looked up by their address using a binary search, making this O(log(blockCount))
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::RetrieveEntryIndex(const T* data)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::RetrieveEntryIndex(const T* data) const
 	{
-		std::size_t blockIndex = 0;
-		std::size_t localIndex = InvalidIndex;
-		for (; blockIndex < m_blocks.size(); ++blockIndex)
+		// Find the first block starting after data, the block containing data (if any) is the one before
+		auto it = std::upper_bound(m_blockAddresses.begin(), m_blockAddresses.end(), data, [](const T* ptr, const BlockAddress& blockAddress)
 		{
-			auto& block = m_blocks[blockIndex];
-			const T* startPtr = reinterpret_cast<const T*>(&block.memory[0]);
-			if (data >= startPtr && data < startPtr + m_blockSize)
-			{
-				// Part of block
-				localIndex = SafeCast<std::size_t>(data - startPtr);
-				assert(data == reinterpret_cast<const T*>(&block.memory[localIndex]));
+			return std::less<const T*>{}(ptr, blockAddress.startPtr);
+		});
 
-				break;
-			}
-		}
+		if (it == m_blockAddresses.begin())
+			return InvalidIndex;
+
+		--it;
 
-		if (blockIndex == m_blocks.size())
+		// Entries may be larger than T (because of alignment or generation), work with byte offsets
+		std::ptrdiff_t offset = reinterpret_cast<const UInt8*>(data) - reinterpret_cast<const UInt8*>(it->startPtr);
+		if (offset < 0 || SafeCast<std::size_t>(offset) >= m_blockSize * sizeof(Entry))
 			return InvalidIndex;
 
-		assert(localIndex != InvalidIndex);
+		std::size_t localIndex = SafeCast<std::size_t>(offset) / sizeof(Entry);
+		assert(data == GetEntryPointer(m_blocks[it->blockIndex], localIndex));
 
-		return blockIndex * m_blockSize + localIndex;
+		return it->blockIndex * m_blockSize + localIndex;
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::begin() -> iterator
+	/*!
+	* \brief Retrieve an allocated pointer based on a handle, if it's still valid
+	* \return Pointer to the allocated entry, or nullptr if the entry was freed since the handle was made
+	*
+	* \param handle Entry handle
+	*
+	* \remark This requires a policy with TrackGenerations enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::TryRetrieve(const Handle& handle)
+	{
+		return const_cast<T*>(static_cast<const MemoryPool*>(this)->TryRetrieve(handle));
+	}
+
+	/*!
+	* \brief Retrieve an allocated pointer based on a handle, if it's still valid
+	* \return Pointer to the allocated entry, or nullptr if the entry was freed since the handle was made
+	*
+	* \param handle Entry handle
+	*
+	* \remark This requires a policy with TrackGenerations enabled
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	const T* MemoryPool<T, Alignment, Policy, Allocator>::TryRetrieve(const Handle& handle) const
+	{
+		static_assert(Policy::TrackGenerations, "handles require a policy with TrackGenerations enabled");
+
+		auto [blockIndex, localIndex] = m_blockSizeDivider.DivMod(handle.index);
+		if NAZARA_UNLIKELY(blockIndex >= m_blocks.size())
+			return nullptr;
+
+		// Generations are odd while alive and incremented on free, a single compare is enough
+		const auto& entry = m_blocks[blockIndex].memory[localIndex];
+		if (entry.generation != handle.generation)
+			return nullptr;
+
+		assert(m_blocks[blockIndex].occupiedEntries.Test(localIndex));
+		return std::launder(reinterpret_cast<const T*>(&entry.storage));
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::begin() -> iterator
 	{
 		auto [blockIndex, localIndex] = GetFirstAllocatedEntry();
 		return iterator(this, blockIndex, localIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::begin() const -> const_iterator
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::begin() const -> const_iterator
 	{
 		return cbegin();
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::cbegin() const -> const_iterator
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::cbegin() const -> const_iterator
 	{
 		auto [blockIndex, localIndex] = GetFirstAllocatedEntry();
 		return const_iterator(this, blockIndex, localIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::end() -> iterator
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::end() -> iterator
 	{
 		return iterator(this, InvalidIndex, InvalidIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::end() const -> const_iterator
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::end() const -> const_iterator
 	{
 		return cend();
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::cend() const -> const_iterator
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	auto MemoryPool<T, Alignment, Policy, Allocator>::cend() const -> const_iterator
 	{
 		return const_iterator(this, InvalidIndex, InvalidIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::size()
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::size()
 	{
 		return GetAllocatedEntryCount();
 	}
 
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::AllocateBlock()
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::AllocateBlock()
+	{
+		NazaraProfileScope("MemoryPool::AllocateBlock");
+
+		EntryAllocator entryAllocator = [&]
+		{
+			if constexpr (UseAlignedAllocator)
+				return EntryAllocator();
+			else
+				return EntryAllocator(m_allocator);
+		}();
+
+		Entry* memory = EntryAllocatorTraits::allocate(entryAllocator, m_blockSize);
+		assert(reinterpret_cast<std::uintptr_t>(memory) % alignof(Entry) == 0);
+		std::uninitialized_default_construct_n(memory, m_blockSize);
+
+		auto& block = m_blocks.emplace_back(Block{
+			0,
+			std::unique_ptr<Entry[], BlockDeleter>(memory, BlockDeleter{ std::move(entryAllocator), m_blockSize }),
+			OccupancyBitset(m_blockSize, false, BitsetAllocator(m_allocator))
+		});
+
+		if constexpr (Policy::TrackGenerations)
+		{
+			// Don't reuse generations of released blocks, this would make their stale handles valid again
+			for (std::size_t i = 0; i < m_blockSize; ++i)
+				block.memory[i].generation = m_generationBase;
+		}
+
+		m_availableBlocks.Resize(m_blocks.size(), true);
+
+		if constexpr (Policy::EnableStatistics)
+		{
+			m_statistics.blockAllocationCount++;
+			m_statistics.peakBlockCount = std::max(m_statistics.peakBlockCount, m_blocks.size());
+		}
+
+		// Keep block addresses sorted for RetrieveEntryIndex
+		BlockAddress blockAddress;
+		blockAddress.blockIndex = m_blocks.size() - 1;
+		blockAddress.startPtr = GetEntryPointer(block, 0);
+
+		auto it = std::upper_bound(m_blockAddresses.begin(), m_blockAddresses.end(), blockAddress.startPtr, [](const T* ptr, const BlockAddress& other)
+		{
+			return std::less<const T*>{}(ptr, other.startPtr);
+		});
+		m_blockAddresses.insert(it, blockAddress);
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::AllocateEntries(std::size_t count, std::size_t* indices, F&& entryCallback)
+	{
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		while (count > 0)
+		{
+			std::size_t blockIndex = m_availableBlocks.FindFirst();
+			std::size_t scannedWordCount;
+			if (blockIndex != m_availableBlocks.npos)
+				scannedWordCount = blockIndex / bitsPerBlock + 1;
+			else
+			{
+				scannedWordCount = m_availableBlocks.GetBlockCount();
+
+				// No more room, allocate a new block
+				blockIndex = m_blocks.size();
+				AllocateBlock();
+			}
+
+			auto& block = m_blocks[blockIndex];
+			std::size_t claimedTotal = 0;
+
+			std::size_t bitBlockCount = block.occupiedEntries.GetBlockCount();
+			for (std::size_t i = 0; i < bitBlockCount && count > 0; ++i)
+			{
+				scannedWordCount++;
+
+				UInt64 freeMask = GetFreeEntryMask(blockIndex, i);
+				if (freeMask == 0)
+					continue;
+
+				// Claim every free entry of this word, or only the lowest ones if we need less
+				UInt64 claimedMask = freeMask;
+				std::size_t claimedCount = CountBits(freeMask);
+				if (claimedCount > count)
+				{
+					UInt64 remainingMask = freeMask;
+					for (std::size_t j = 0; j < count; ++j)
+						remainingMask &= remainingMask - 1; //< clear lowest bit
+
+					claimedMask ^= remainingMask;
+					claimedCount = count;
+				}
+
+				block.occupiedEntries.SetBlock(i, block.occupiedEntries.GetBlock(i) | claimedMask);
+				block.occupiedEntryCount += claimedCount;
+				claimedTotal += claimedCount;
+				count -= claimedCount;
+
+				for (; claimedMask != 0; claimedMask &= claimedMask - 1)
+				{
+					std::size_t localIndex = i * bitsPerBlock + FindFirstBit(claimedMask) - 1;
+					IncrementGeneration(block, localIndex);
+					entryCallback(GetEntryPointer(block, localIndex));
+
+					*indices++ = blockIndex * m_blockSize + localIndex;
+				}
+			}
+
+			if (block.occupiedEntryCount == m_blockSize)
+				m_availableBlocks.Reset(blockIndex);
+
+			RecordAllocations(claimedTotal, 1, scannedWordCount);
+		}
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::FindFreeEntry(std::size_t blockIndex) const
+	{
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		// Free entries are the unset bits of the occupancy bitset, look for the first word having one
+		std::size_t bitBlockCount = m_blocks[blockIndex].occupiedEntries.GetBlockCount();
+		for (std::size_t i = 0; i < bitBlockCount; ++i)
+		{
+			UInt64 freeMask = GetFreeEntryMask(blockIndex, i);
+			if (freeMask != 0)
+				return i * bitsPerBlock + FindFirstBit(freeMask) - 1;
+		}
+
+		return InvalidIndex;
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::size_t MemoryPool<T, Alignment, Policy, Allocator>::FindLastAllocatedEntry(std::size_t blockIndex) const
 	{
-		auto& block = m_blocks.emplace_back();
-		block.freeEntries.Resize(m_blockSize, true);
-		block.occupiedEntries.Resize(m_blockSize, false);
-		block.memory = std::make_unique<AlignedStorage[]>(m_blockSize);
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		const OccupancyBitset& occupiedEntries = m_blocks[blockIndex].occupiedEntries;
+		for (std::size_t i = occupiedEntries.GetBlockCount(); i-- > 0;)
+		{
+			UInt64 occupiedMask = occupiedEntries.GetBlock(i);
+			if (occupiedMask != 0)
+				return i * bitsPerBlock + IntegralLog2(occupiedMask);
+		}
+
+		return InvalidIndex;
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::FreeEntries(const std::size_t* indices, std::size_t count, F&& entryCallback)
+	{
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			auto [blockIndex, firstLocalIndex] = m_blockSizeDivider.DivMod(indices[i]);
+			std::size_t bitBlockIndex = firstLocalIndex / bitsPerBlock;
+
+			// Gather every following index sharing the same bitset word to release them at once
+			UInt64 releasedMask = 0;
+			std::size_t releasedCount = 0;
+			for (; i < count; ++i)
+			{
+				auto [entryBlockIndex, localIndex] = m_blockSizeDivider.DivMod(indices[i]);
+				if (entryBlockIndex != blockIndex || localIndex / bitsPerBlock != bitBlockIndex)
+					break;
+
+				entryCallback(GetAllocatedPointer(blockIndex, localIndex));
+				IncrementGeneration(m_blocks[blockIndex], localIndex);
+
+				UInt64 bit = UInt64(1) << (localIndex % bitsPerBlock);
+				assert((releasedMask & bit) == 0 && "index was freed twice");
+				releasedMask |= bit;
+				releasedCount++;
+			}
+
+			auto& block = m_blocks[blockIndex];
+			assert(block.occupiedEntryCount >= releasedCount);
+			if (block.occupiedEntryCount == m_blockSize)
+				m_availableBlocks.Set(blockIndex);
+
+			block.occupiedEntryCount -= releasedCount;
+			block.occupiedEntries.SetBlock(bitBlockIndex, block.occupiedEntries.GetBlock(bitBlockIndex) & ~releasedMask);
+
+			RecordFrees(releasedCount);
+		}
 	}
 
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex)
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex)
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
 		assert(block.occupiedEntries.Test(localIndex));
 
-		return std::launder(reinterpret_cast<T*>(&block.memory[localIndex]));
+		return GetEntryPointer(block, localIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	const T* MemoryPool<T, Alignment>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	const T* MemoryPool<T, Alignment, Policy, Allocator>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
 		assert(block.occupiedEntries.Test(localIndex));
 
-		return std::launder(reinterpret_cast<const T*>(&block.memory[localIndex]));
+		return GetEntryPointer(block, localIndex);
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::RecordAllocations([[maybe_unused]] std::size_t entryCount, [[maybe_unused]] std::size_t scannedBlockCount, [[maybe_unused]] std::size_t scannedWordCount)
+	{
+		if constexpr (Policy::EnableStatistics)
+		{
+			m_statistics.allocationCount += entryCount;
+			m_statistics.liveEntryCount += entryCount;
+			m_statistics.peakLiveEntryCount = std::max(m_statistics.peakLiveEntryCount, m_statistics.liveEntryCount);
+			m_statistics.scannedBlockCount += scannedBlockCount;
+			m_statistics.scannedWordCount += scannedWordCount;
+		}
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetFirstAllocatedEntry() const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::RecordFrees([[maybe_unused]] std::size_t entryCount)
+	{
+		if constexpr (Policy::EnableStatistics)
+		{
+			assert(m_statistics.liveEntryCount >= entryCount);
+			m_statistics.freeCount += entryCount;
+			m_statistics.liveEntryCount -= entryCount;
+		}
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ReleaseBlocks(std::size_t firstBlockIndex)
+	{
+		if (firstBlockIndex >= m_blocks.size())
+			return;
+
+		if constexpr (Policy::TrackGenerations)
+		{
+			// Released entries are free so their generations are even, new blocks will start after them
+			for (std::size_t blockIndex = firstBlockIndex; blockIndex < m_blocks.size(); ++blockIndex)
+			{
+				auto& block = m_blocks[blockIndex];
+				assert(block.occupiedEntryCount == 0);
+				for (std::size_t i = 0; i < m_blockSize; ++i)
+					m_generationBase = std::max(m_generationBase, block.memory[i].generation);
+			}
+		}
+
+		m_blockAddresses.erase(std::remove_if(m_blockAddresses.begin(), m_blockAddresses.end(), [&](const BlockAddress& blockAddress)
+		{
+			return blockAddress.blockIndex >= firstBlockIndex;
+		}), m_blockAddresses.end());
+
+		if constexpr (Policy::EnableStatistics)
+			m_statistics.blockReleaseCount += m_blocks.size() - firstBlockIndex;
+
+		m_availableBlocks.Resize(firstBlockIndex);
+		m_blocks.erase(m_blocks.begin() + firstBlockIndex, m_blocks.end());
+	}
+
+	// Calls callback(firstIndex, count) for every range of consecutive allocated entries of a block
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEachAllocatedRange(const Block& block, F&& callback)
+	{
+		constexpr std::size_t bitsPerBlock = OccupancyBitset::bitsPerBlock;
+
+		std::size_t rangeFirst = 0;
+		std::size_t rangeCount = 0;
+		for (std::size_t i = 0; i < block.occupiedEntries.GetBlockCount(); ++i)
+		{
+			UInt64 bits = block.occupiedEntries.GetBlock(i);
+			while (bits != 0)
+			{
+				unsigned int firstBit = FindFirstBit(bits) - 1;
+				UInt64 freeBits = ~(bits >> firstBit);
+				unsigned int bitCount = (freeBits != 0) ? FindFirstBit(freeBits) - 1 : unsigned(bitsPerBlock - firstBit);
+
+				std::size_t firstIndex = i * bitsPerBlock + firstBit;
+				if (rangeCount > 0 && rangeFirst + rangeCount == firstIndex)
+					rangeCount += bitCount; //< range continues from the previous word
+				else
+				{
+					if (rangeCount > 0)
+						callback(rangeFirst, rangeCount);
+
+					rangeFirst = firstIndex;
+					rangeCount = bitCount;
+				}
+
+				if (firstBit + bitCount < bitsPerBlock)
+					bits &= ~((UInt64(1) << (firstBit + bitCount)) - 1);
+				else
+					bits = 0;
+			}
+		}
+
+		if (rangeCount > 0)
+			callback(rangeFirst, rangeCount);
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	template<typename Pool, typename F>
+	void MemoryPool<T, Alignment, Policy, Allocator>::ForEachEntry(Pool& pool, std::size_t beginBlock, std::size_t endBlock, F&& callback)
+	{
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		using Ref = std::conditional_t<std::is_const_v<Pool>, const T&, T&>;
+
+		endBlock = std::min(endBlock, pool.m_blocks.size());
+		for (std::size_t blockIndex = beginBlock; blockIndex < endBlock; ++blockIndex)
+		{
+			auto& block = pool.m_blocks[blockIndex];
+			if (block.occupiedEntryCount == 0)
+				continue;
+
+			std::size_t firstIndex = blockIndex * pool.m_blockSize;
+			std::size_t bitBlockCount = block.occupiedEntries.GetBlockCount();
+			for (std::size_t i = 0; i < bitBlockCount; ++i)
+			{
+				// Work on a copy of the word, so the callback can free the current entry
+				for (UInt64 occupiedMask = block.occupiedEntries.GetBlock(i); occupiedMask != 0; occupiedMask &= occupiedMask - 1)
+				{
+					std::size_t localIndex = i * bitsPerBlock + FindFirstBit(occupiedMask) - 1;
+					Ref entry = *GetEntryPointer(block, localIndex);
+
+					if constexpr (std::is_invocable_v<F&, std::size_t, Ref>)
+						callback(firstIndex + localIndex, entry);
+					else
+						callback(entry);
+				}
+			}
+		}
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	T* MemoryPool<T, Alignment, Policy, Allocator>::GetEntryPointer(const Block& block, std::size_t localIndex)
+	{
+		if constexpr (Policy::TrackGenerations)
+			return std::launder(reinterpret_cast<T*>(&block.memory[localIndex].storage));
+		else
+			return std::launder(reinterpret_cast<T*>(&block.memory[localIndex]));
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, Policy, Allocator>::GetFirstAllocatedEntry() const
 	{
 		return GetFirstAllocatedEntryFromBlock(0);
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, Policy, Allocator>::GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const
 	{
 		// Search in next block
 		std::size_t localIndex = InvalidIndex;
@@ -407,8 +1338,27 @@ namespace Nz
 		return { blockIndex, localIndex };
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	UInt64 MemoryPool<T, Alignment, Policy, Allocator>::GetFreeEntryMask(std::size_t blockIndex, std::size_t bitBlockIndex) const
+	{
+		constexpr std::size_t bitsPerBlock = Bitset<UInt64>::bitsPerBlock;
+
+		const OccupancyBitset& occupiedEntries = m_blocks[blockIndex].occupiedEntries;
+
+		UInt64 freeMask = ~occupiedEntries.GetBlock(bitBlockIndex);
+		if (bitBlockIndex == occupiedEntries.GetBlockCount() - 1)
+		{
+			// Ignore extra bits of the last bitset block
+			std::size_t extraBitIndex = m_blockSize % bitsPerBlock;
+			if (extraBitIndex != 0)
+				freeMask &= (UInt64(1) << extraBitIndex) - 1;
+		}
+
+		return freeMask;
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, Policy, Allocator>::GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
@@ -420,33 +1370,59 @@ namespace Nz
 		return GetFirstAllocatedEntryFromBlock(blockIndex + 1);
 	}
 
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::IncrementGeneration([[maybe_unused]] Block& block, [[maybe_unused]] std::size_t localIndex)
+	{
+		if constexpr (Policy::TrackGenerations)
+			block.memory[localIndex].generation++;
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	void MemoryPool<T, Alignment, Policy, Allocator>::BlockDeleter::operator()(Entry* memory)
+	{
+		std::destroy_n(memory, entryCount);
+		EntryAllocatorTraits::deallocate(allocator, memory, entryCount);
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	bool MemoryPool<T, Alignment, Policy, Allocator>::Handle::operator==(const Handle& handle) const
+	{
+		return index == handle.index && generation == handle.generation;
+	}
+
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator>
+	bool MemoryPool<T, Alignment, Policy, Allocator>::Handle::operator!=(const Handle& handle) const
+	{
+		return !operator==(handle);
+	}
+
 
-	template<typename T, std::size_t Alignment, bool Const>
-	MemoryPoolIterator<T, Alignment, Const>::MemoryPoolIterator(std::conditional_t<Const, const Pool, Pool>* owner, std::size_t blockIndex, std::size_t localIndex) :
+	template<typename Pool, bool Const>
+	MemoryPoolIterator<Pool, Const>::MemoryPoolIterator(std::conditional_t<Const, const Pool, Pool>* owner, std::size_t blockIndex, std::size_t localIndex) :
 	m_blockIndex(blockIndex),
 	m_localIndex(localIndex),
 	m_owner(owner)
 	{
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	std::size_t MemoryPoolIterator<T, Alignment, Const>::GetIndex() const
+	template<typename Pool, bool Const>
+	std::size_t MemoryPoolIterator<Pool, Const>::GetIndex() const
 	{
 		assert(m_blockIndex != Pool::InvalidIndex);
 		assert(m_localIndex != Pool::InvalidIndex);
 		return m_blockIndex * m_owner->GetBlockSize() + m_localIndex;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator++(int) -> MemoryPoolIterator
+	template<typename Pool, bool Const>
+	auto MemoryPoolIterator<Pool, Const>::operator++(int) -> MemoryPoolIterator
 	{
 		MemoryPoolIterator copy(*this);
 		operator++();
 		return copy;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator++() -> MemoryPoolIterator&
+	template<typename Pool, bool Const>
+	auto MemoryPoolIterator<Pool, Const>::operator++() -> MemoryPoolIterator&
 	{
 		auto [blockIndex, localIndex] = m_owner->GetNextAllocatedEntry(m_blockIndex, m_localIndex);
 		m_blockIndex = blockIndex;
@@ -455,21 +1431,21 @@ namespace Nz
 		return *this;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	bool MemoryPoolIterator<T, Alignment, Const>::operator==(const MemoryPoolIterator& rhs) const
+	template<typename Pool, bool Const>
+	bool MemoryPoolIterator<Pool, Const>::operator==(const MemoryPoolIterator& rhs) const
 	{
 		assert(m_owner == rhs.m_owner);
 		return m_blockIndex == rhs.m_blockIndex && m_localIndex == rhs.m_localIndex;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	bool MemoryPoolIterator<T, Alignment, Const>::operator!=(const MemoryPoolIterator& rhs) const
+	template<typename Pool, bool Const>
+	bool MemoryPoolIterator<Pool, Const>::operator!=(const MemoryPoolIterator& rhs) const
 	{
 		return !operator==(rhs);
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator*() const -> reference
+	template<typename Pool, bool Const>
+	auto MemoryPoolIterator<Pool, Const>::operator*() const -> reference
 	{
 		return *m_owner->GetAllocatedPointer(m_blockIndex, m_localIndex);
 	}
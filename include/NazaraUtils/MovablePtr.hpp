@@ -7,6 +7,8 @@
 #ifndef NAZARAUTILS_MOVABLEPTR_HPP
 #define NAZARAUTILS_MOVABLEPTR_HPP
 
+#include <NazaraUtils/TypeTraits.hpp>
+
 namespace Nz
 {
 	template<typename T>
@@ -31,6 +33,9 @@ namespace Nz
 		private:
 			T* m_value;
 	};
+
+	template<typename T>
+	struct IsTriviallyRelocatable<MovablePtr<T>> : std::true_type {};
 }
 
 #include <NazaraUtils/MovablePtr.inl>
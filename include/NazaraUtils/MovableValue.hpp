@@ -7,6 +7,7 @@
 #ifndef NAZARAUTILS_MOVABLEVALUE_HPP
 #define NAZARAUTILS_MOVABLEVALUE_HPP
 
+#include <NazaraUtils/TypeTraits.hpp>
 #include <type_traits>
 
 namespace Nz
@@ -62,6 +63,12 @@ namespace Nz
 		private:
 			T m_value;
 	};
+
+	template<typename T, T DefaultValue>
+	struct IsTriviallyRelocatable<MovableLiteral<T, DefaultValue>> : IsTriviallyRelocatable<T> {};
+
+	template<typename T>
+	struct IsTriviallyRelocatable<MovableValue<T>> : IsTriviallyRelocatable<T> {};
 }
 
 #include <NazaraUtils/MovableValue.inl>
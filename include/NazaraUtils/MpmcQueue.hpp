@@ -0,0 +1,74 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_MPMCQUEUE_HPP
+#define NAZARAUTILS_MPMCQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Nz
+{
+NAZARA_WARNING_PUSH()
+NAZARA_WARNING_MSVC_DISABLE(4324) // structure was padded due to alignment specifier
+
+	template<typename T, std::size_t Capacity>
+	class MpmcQueue
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+		public:
+			MpmcQueue();
+			MpmcQueue(const MpmcQueue&) = delete;
+			MpmcQueue(MpmcQueue&&) = delete;
+			~MpmcQueue();
+
+			std::size_t GetSize() const;
+
+			bool IsEmpty() const;
+
+			bool TryPop(T& value);
+			template<typename OutputIt> std::size_t TryPopN(OutputIt output, std::size_t count);
+
+			template<typename... Args> bool TryEmplace(Args&&... args);
+			bool TryPush(const T& value);
+			bool TryPush(T&& value);
+			template<typename InputIt> std::size_t TryPushN(InputIt first, std::size_t count);
+
+			MpmcQueue& operator=(const MpmcQueue&) = delete;
+			MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+			static constexpr std::size_t GetCapacity();
+
+		private:
+			struct Slot;
+
+			std::size_t ClaimPopSlots(std::size_t& head, std::size_t count);
+			std::size_t ClaimPushSlots(std::size_t& tail, std::size_t count);
+			static T* GetElement(Slot& slot);
+
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			struct Slot
+			{
+				std::atomic<std::size_t> sequence; //< index of the next push (if equal to the slot position) or pop (if equal to position + 1) allowed in this slot
+				alignas(T) std::array<std::byte, sizeof(T)> storage;
+			};
+
+			alignas(CacheLineSize) std::atomic<std::size_t> m_head;
+			alignas(CacheLineSize) std::atomic<std::size_t> m_tail;
+			alignas(CacheLineSize) std::array<Slot, Capacity> m_slots;
+	};
+
+NAZARA_WARNING_POP()
+}
+
+#include <NazaraUtils/MpmcQueue.inl>
+
+#endif // NAZARAUTILS_MPMCQUEUE_HPP
@@ -0,0 +1,291 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::MpmcQueue
+	* \brief Lock-free bounded queue for any number of producer and consumer threads
+	*
+	* Elements are stored inplace in a power-of-two circular array, the queue never allocates.
+	* Each slot holds a sequence number telling whether it's ready to be pushed into or popped from for the current lap,
+	* producers and consumers claim slots by advancing the tail/head indices (which live on separate cache lines) with a CAS.
+	*
+	* \remark If T construction can throw, elements are first constructed outside of the queue and then moved in, which requires T to be nothrow move constructible
+	*/
+
+	template<typename T, std::size_t Capacity>
+	MpmcQueue<T, Capacity>::MpmcQueue() :
+	m_head(0),
+	m_tail(0)
+	{
+		for (std::size_t i = 0; i < Capacity; ++i)
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Destroys the queue and every element still in it
+	*
+	* \remark No thread must be using the queue at this point
+	*/
+	template<typename T, std::size_t Capacity>
+	MpmcQueue<T, Capacity>::~MpmcQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::size_t tail = m_tail.load(std::memory_order_acquire);
+			for (std::size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+				PlacementDestroy(GetElement(m_slots[head & Mask]));
+		}
+	}
+
+	/*!
+	* \brief Returns the number of elements in the queue
+	*
+	* \remark When called concurrently with pushes or pops, the result may already be outdated when returned
+	*/
+	template<typename T, std::size_t Capacity>
+	std::size_t MpmcQueue<T, Capacity>::GetSize() const
+	{
+		std::size_t head = m_head.load(std::memory_order_acquire);
+		std::size_t tail = m_tail.load(std::memory_order_acquire);
+		return (tail > head) ? std::min(tail - head, Capacity) : 0;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MpmcQueue<T, Capacity>::IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+
+	/*!
+	* \brief Moves the front element into value and removes it from the queue
+	* \return True if an element was popped, false if the queue was empty
+	*
+	* \param value Object receiving the popped element by move-assignment
+	*/
+	template<typename T, std::size_t Capacity>
+	bool MpmcQueue<T, Capacity>::TryPop(T& value)
+	{
+		return TryPopN(&value, 1) == 1;
+	}
+
+	/*!
+	* \brief Pops up to count consecutive elements in a single operation
+	* \return Number of popped elements
+	*
+	* \param output Output iterator receiving the popped elements by move-assignment
+	* \param count Maximum number of elements to pop
+	*
+	* \remark The whole batch is claimed with a single CAS on the head index
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename OutputIt>
+	std::size_t MpmcQueue<T, Capacity>::TryPopN(OutputIt output, std::size_t count)
+	{
+		std::size_t head;
+		count = ClaimPopSlots(head, count);
+
+		// claimed slots must be released even if a move-assignment throws
+		std::size_t i = 0;
+		CallOnExit releaseSlots([&]
+		{
+			for (; i < count; ++i)
+			{
+				Slot& slot = m_slots[(head + i) & Mask];
+				PlacementDestroy(GetElement(slot));
+				slot.sequence.store(head + i + Capacity, std::memory_order_release);
+			}
+		});
+
+		for (; i < count; ++i)
+		{
+			Slot& slot = m_slots[(head + i) & Mask];
+
+			T* element = GetElement(slot);
+			*output = std::move(*element);
+			++output;
+
+			PlacementDestroy(element);
+			slot.sequence.store(head + i + Capacity, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/*!
+	* \brief Constructs an element at the back of the queue
+	* \return True if the element was pushed, false if the queue was full
+	*
+	* \param args Arguments used to construct the element
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	bool MpmcQueue<T, Capacity>::TryEmplace(Args&&... args)
+	{
+		if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+		{
+			std::size_t tail;
+			if (ClaimPushSlots(tail, 1) == 0)
+				return false;
+
+			Slot& slot = m_slots[tail & Mask];
+			PlacementNew(GetElement(slot), std::forward<Args>(args)...);
+			slot.sequence.store(tail + 1, std::memory_order_release);
+
+			return true;
+		}
+		else
+		{
+			// a throwing construction would leave a claimed slot which could never be popped
+			static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow move constructible or nothrow constructible from args");
+
+			T value(std::forward<Args>(args)...);
+			return TryEmplace(std::move(value));
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MpmcQueue<T, Capacity>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MpmcQueue<T, Capacity>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	/*!
+	* \brief Pushes up to count consecutive elements in a single operation
+	* \return Number of pushed elements, elements are read in order from first so the pushed elements are always the first ones
+	*
+	* \param first Iterator to the first element to push (use std::make_move_iterator to move them)
+	* \param count Maximum number of elements to push
+	*
+	* \remark The whole batch is claimed with a single CAS on the tail index, unless T construction from *first can throw (in which case elements are pushed one by one)
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	std::size_t MpmcQueue<T, Capacity>::TryPushN(InputIt first, std::size_t count)
+	{
+		if constexpr (std::is_nothrow_constructible_v<T, decltype(*first)>)
+		{
+			std::size_t tail;
+			count = ClaimPushSlots(tail, count);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Slot& slot = m_slots[(tail + i) & Mask];
+				PlacementNew(GetElement(slot), *first);
+				++first;
+
+				slot.sequence.store(tail + i + 1, std::memory_order_release);
+			}
+
+			return count;
+		}
+		else
+		{
+			std::size_t pushed = 0;
+			for (; pushed < count; ++pushed)
+			{
+				if (!TryEmplace(*first))
+					break;
+
+				++first;
+			}
+
+			return pushed;
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr std::size_t MpmcQueue<T, Capacity>::GetCapacity()
+	{
+		return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	std::size_t MpmcQueue<T, Capacity>::ClaimPopSlots(std::size_t& head, std::size_t count)
+	{
+		head = m_head.load(std::memory_order_relaxed);
+		if (count == 0)
+			return 0;
+
+		for (;;)
+		{
+			// count how many consecutive slots contain an element for this lap
+			std::size_t readyCount = 0;
+			for (; readyCount < count; ++readyCount)
+			{
+				std::size_t sequence = m_slots[(head + readyCount) & Mask].sequence.load(std::memory_order_acquire);
+				if (sequence != head + readyCount + 1)
+					break;
+			}
+
+			if (readyCount == 0)
+			{
+				std::size_t sequence = m_slots[head & Mask].sequence.load(std::memory_order_acquire);
+				if (static_cast<std::ptrdiff_t>(sequence - (head + 1)) < 0)
+					return 0; //< queue is empty
+
+				// another consumer claimed this slot, retry with the current head
+				head = m_head.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			if (m_head.compare_exchange_weak(head, head + readyCount, std::memory_order_relaxed))
+				return readyCount;
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	std::size_t MpmcQueue<T, Capacity>::ClaimPushSlots(std::size_t& tail, std::size_t count)
+	{
+		tail = m_tail.load(std::memory_order_relaxed);
+		if (count == 0)
+			return 0;
+
+		for (;;)
+		{
+			// count how many consecutive slots are free for this lap
+			std::size_t freeCount = 0;
+			for (; freeCount < count; ++freeCount)
+			{
+				std::size_t sequence = m_slots[(tail + freeCount) & Mask].sequence.load(std::memory_order_acquire);
+				if (sequence != tail + freeCount)
+					break;
+			}
+
+			if (freeCount == 0)
+			{
+				std::size_t sequence = m_slots[tail & Mask].sequence.load(std::memory_order_acquire);
+				if (static_cast<std::ptrdiff_t>(sequence - tail) < 0)
+					return 0; //< queue is full
+
+				// another producer claimed this slot, retry with the current tail
+				tail = m_tail.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			if (m_tail.compare_exchange_weak(tail, tail + freeCount, std::memory_order_relaxed))
+				return freeCount;
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	T* MpmcQueue<T, Capacity>::GetElement(Slot& slot)
+	{
+		return std::launder(reinterpret_cast<T*>(&slot.storage[0]));
+	}
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_PACKEDTUPLE_HPP
+#define NAZARAUTILS_PACKEDTUPLE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/TypeList.hpp>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename A, typename B>
+		struct PackedTupleCompare : std::bool_constant<(alignof(A) > alignof(B))> {};
+
+		// Members in storage order, each level holding one member followed by the next levels (Order::Indices gives the argument index of each member)
+		template<std::size_t StorageIndex, typename... Ts>
+		struct PackedTupleStorage
+		{
+		};
+
+		template<std::size_t StorageIndex, typename T>
+		struct PackedTupleStorage<StorageIndex, T>
+		{
+			constexpr PackedTupleStorage() : value() {}
+			template<typename ArgTuple, typename Order> constexpr PackedTupleStorage(ArgTuple&& args, Order order);
+
+			template<std::size_t I> constexpr T& Get() noexcept { return value; }
+			template<std::size_t I> constexpr const T& Get() const noexcept { return value; }
+
+			T value;
+		};
+
+		template<std::size_t StorageIndex, typename T, typename... Rest>
+		struct PackedTupleStorage<StorageIndex, T, Rest...>
+		{
+			using Next = PackedTupleStorage<StorageIndex + 1, Rest...>;
+
+			constexpr PackedTupleStorage() : value(), next() {}
+			template<typename ArgTuple, typename Order> constexpr PackedTupleStorage(ArgTuple&& args, Order order);
+
+			template<std::size_t I> constexpr decltype(auto) Get() noexcept;
+			template<std::size_t I> constexpr decltype(auto) Get() const noexcept;
+
+			T value;
+			Next next;
+		};
+
+		template<std::size_t StorageIndex, typename List> struct PackedTupleStorageFromList;
+
+		template<std::size_t StorageIndex, typename... Ts>
+		struct PackedTupleStorageFromList<StorageIndex, TypeList<Ts...>>
+		{
+			using Type = PackedTupleStorage<StorageIndex, Ts...>;
+		};
+	}
+
+	template<typename... Ts>
+	class PackedTuple
+	{
+		public:
+			template<std::size_t I> using ElementType = TypeListAt<TypeList<Ts...>, I>;
+			using StorageTypes = TypeListSort<TypeList<Ts...>, Detail::PackedTupleCompare>;
+
+			constexpr PackedTuple() = default;
+			template<typename... Args, typename = std::enable_if_t<sizeof...(Args) == sizeof...(Ts) && (sizeof...(Ts) > 0) && (std::is_constructible_v<Ts, Args&&> && ...)>> constexpr PackedTuple(Args&&... args);
+			constexpr PackedTuple(const PackedTuple&) = default;
+			constexpr PackedTuple(PackedTuple&&) = default;
+			~PackedTuple() = default;
+
+			template<std::size_t I> constexpr ElementType<I>& Get() & noexcept;
+			template<std::size_t I> constexpr const ElementType<I>& Get() const & noexcept;
+			template<std::size_t I> constexpr ElementType<I>&& Get() && noexcept;
+
+			constexpr PackedTuple& operator=(const PackedTuple&) = default;
+			constexpr PackedTuple& operator=(PackedTuple&&) = default;
+
+			template<std::size_t I> static constexpr std::size_t GetStorageIndex();
+
+			static constexpr std::size_t Size = sizeof...(Ts);
+
+		private:
+			using Order = Detail::ListSort<TypeList<Ts...>, Detail::PackedTupleCompare>;
+
+			typename Detail::PackedTupleStorageFromList<0, StorageTypes>::Type m_storage;
+	};
+
+	template<std::size_t I, typename... Ts> constexpr TypeListAt<TypeList<Ts...>, I>& get(PackedTuple<Ts...>& tuple) noexcept;
+	template<std::size_t I, typename... Ts> constexpr const TypeListAt<TypeList<Ts...>, I>& get(const PackedTuple<Ts...>& tuple) noexcept;
+	template<std::size_t I, typename... Ts> constexpr TypeListAt<TypeList<Ts...>, I>&& get(PackedTuple<Ts...>&& tuple) noexcept;
+}
+
+namespace std
+{
+	template<typename... Ts>
+	struct tuple_size<Nz::PackedTuple<Ts...>> : integral_constant<size_t, sizeof...(Ts)> {};
+
+	template<size_t I, typename... Ts>
+	struct tuple_element<I, Nz::PackedTuple<Ts...>>
+	{
+		using type = Nz::TypeListAt<Nz::TypeList<Ts...>, I>;
+	};
+}
+
+#include <NazaraUtils/PackedTuple.inl>
+
+#endif // NAZARAUTILS_PACKEDTUPLE_HPP
@@ -0,0 +1,126 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<std::size_t StorageIndex, typename T>
+		template<typename ArgTuple, typename Order>
+		constexpr PackedTupleStorage<StorageIndex, T>::PackedTupleStorage(ArgTuple&& args, Order /*order*/) :
+		value(std::get<Order::Indices[StorageIndex]>(std::move(args)))
+		{
+		}
+
+		template<std::size_t StorageIndex, typename T, typename... Rest>
+		template<typename ArgTuple, typename Order>
+		constexpr PackedTupleStorage<StorageIndex, T, Rest...>::PackedTupleStorage(ArgTuple&& args, Order order) :
+		value(std::get<Order::Indices[StorageIndex]>(std::move(args))),
+		next(std::move(args), order)
+		{
+		}
+
+		template<std::size_t StorageIndex, typename T, typename... Rest>
+		template<std::size_t I>
+		constexpr decltype(auto) PackedTupleStorage<StorageIndex, T, Rest...>::Get() noexcept
+		{
+			if constexpr (I == StorageIndex)
+				return (value);
+			else
+				return next.template Get<I>();
+		}
+
+		template<std::size_t StorageIndex, typename T, typename... Rest>
+		template<std::size_t I>
+		constexpr decltype(auto) PackedTupleStorage<StorageIndex, T, Rest...>::Get() const noexcept
+		{
+			if constexpr (I == StorageIndex)
+				return (value);
+			else
+				return next.template Get<I>();
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::PackedTuple
+	* \brief Tuple storing its members by decreasing alignment, to avoid the padding an unlucky declaration order would add
+	*
+	* Members are still accessed (and constructed) using their declaration index, PackedTuple<char, double, char> is 16 bytes
+	* where the equivalent struct is 24 bytes. Members having the same alignment keep their relative order.
+	*
+	* \remark Supports structured bindings
+	*/
+
+	/*!
+	* \brief Constructs the members from arguments given in declaration order
+	*
+	* \param args Arguments, one per member
+	*/
+	template<typename... Ts>
+	template<typename... Args, typename>
+	constexpr PackedTuple<Ts...>::PackedTuple(Args&&... args) :
+	m_storage(std::forward_as_tuple(std::forward<Args>(args)...), Order{})
+	{
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	constexpr auto PackedTuple<Ts...>::Get() & noexcept -> ElementType<I>&
+	{
+		return m_storage.template Get<GetStorageIndex<I>()>();
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	constexpr auto PackedTuple<Ts...>::Get() const & noexcept -> const ElementType<I>&
+	{
+		return m_storage.template Get<GetStorageIndex<I>()>();
+	}
+
+	template<typename... Ts>
+	template<std::size_t I>
+	constexpr auto PackedTuple<Ts...>::Get() && noexcept -> ElementType<I>&&
+	{
+		return std::move(m_storage.template Get<GetStorageIndex<I>()>());
+	}
+
+	/*!
+	* \brief Returns the position in memory of a member, amongst the other members
+	* \return Storage index of the I-th declared member
+	*/
+	template<typename... Ts>
+	template<std::size_t I>
+	constexpr std::size_t PackedTuple<Ts...>::GetStorageIndex()
+	{
+		static_assert(I < sizeof...(Ts), "index out of range");
+
+		for (std::size_t storageIndex = 0; storageIndex < sizeof...(Ts); ++storageIndex)
+		{
+			if (Order::Indices[storageIndex] == I)
+				return storageIndex;
+		}
+
+		return sizeof...(Ts);
+	}
+
+
+	template<std::size_t I, typename... Ts>
+	constexpr TypeListAt<TypeList<Ts...>, I>& get(PackedTuple<Ts...>& tuple) noexcept
+	{
+		return tuple.template Get<I>();
+	}
+
+	template<std::size_t I, typename... Ts>
+	constexpr const TypeListAt<TypeList<Ts...>, I>& get(const PackedTuple<Ts...>& tuple) noexcept
+	{
+		return tuple.template Get<I>();
+	}
+
+	template<std::size_t I, typename... Ts>
+	constexpr TypeListAt<TypeList<Ts...>, I>&& get(PackedTuple<Ts...>&& tuple) noexcept
+	{
+		return std::move(tuple).template Get<I>();
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_PARALLELALGORITHM_HPP
+#define NAZARAUTILS_PARALLELALGORITHM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		struct BitsetParallelAccess
+		{
+			template<typename T, typename Allocator, std::size_t InlineBlockCount> static T* GetBlocks(Bitset<T, Allocator, InlineBlockCount>& bitset);
+			template<typename T, typename Allocator, std::size_t InlineBlockCount> static const T* GetBlocks(const Bitset<T, Allocator, InlineBlockCount>& bitset);
+			template<typename T, typename Allocator, std::size_t InlineBlockCount> static void ResetExtraBits(Bitset<T, Allocator, InlineBlockCount>& bitset);
+			template<typename T, typename Allocator, std::size_t InlineBlockCount> static void Resize(Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t blockCount, std::size_t bitCount);
+		};
+
+		// Splits a block array in chunks starting on cache line boundaries (except for the first one), so that no two chunks write to the same cache line
+		struct ParallelBlockChunks
+		{
+			inline std::pair<std::size_t, std::size_t> GetChunk(std::size_t chunkIndex) const;
+
+			std::size_t blockCount;
+			std::size_t chunkBlockCount;
+			std::size_t chunkCount;
+			std::size_t misalignment; //< Number of blocks between the start of the cache line and the first block
+		};
+
+		template<typename Body>
+		struct ParallelForContext
+		{
+			TaskScheduler& scheduler;
+			std::size_t grainSize;
+			Body& body;
+		};
+
+		template<typename V, typename Body, typename Combine>
+		struct ParallelReduceContext
+		{
+			TaskScheduler& scheduler;
+			std::size_t grainSize;
+			const V& init;
+			Body& body;
+			Combine& combine;
+		};
+
+		template<typename T> T ParallelAdvance(const T& position, std::size_t offset);
+		template<typename T> ParallelBlockChunks ParallelChunkBlocks(const TaskScheduler& scheduler, const T* blocks, std::size_t blockCount, std::size_t grainSize);
+		template<typename T> decltype(auto) ParallelDereference(const T& position);
+		inline std::size_t ParallelGrainSize(const TaskScheduler& scheduler, std::size_t count, std::size_t grainSize, std::size_t minGrainSize);
+		template<typename T, typename Allocator, std::size_t InlineBlockCount, typename F> void ParallelPerformsBlocks(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, std::size_t grainSize, F&& func);
+		template<typename Body> void ParallelSplit(ParallelForContext<Body>& context, std::size_t first, std::size_t last);
+		template<typename V, typename Body, typename Combine> V ParallelSplitReduce(ParallelReduceContext<V, Body, Combine>& context, std::size_t first, std::size_t last);
+	}
+
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> [[nodiscard]] std::size_t ParallelCount(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount, typename OutputIt> OutputIt ParallelExtractSetBits(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, OutputIt output, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> [[nodiscard]] std::size_t ParallelFindFirst(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize);
+	template<typename T, typename F> void ParallelFor(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, F&& func);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount, typename F> void ParallelForEachSetBit(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize, F&& func);
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator, typename F> void ParallelForEachEntry(TaskScheduler& scheduler, MemoryPool<T, Alignment, Policy, Allocator>& pool, std::size_t grainSize, F&& func);
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator, typename F> void ParallelForEachEntry(TaskScheduler& scheduler, const MemoryPool<T, Alignment, Policy, Allocator>& pool, std::size_t grainSize, F&& func);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> void ParallelPerformsAND(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> void ParallelPerformsANDNOT(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> void ParallelPerformsNOT(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> void ParallelPerformsOR(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize);
+	template<typename T, typename Allocator, std::size_t InlineBlockCount> void ParallelPerformsXOR(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize);
+	template<typename T, typename V, typename Op> [[nodiscard]] V ParallelReduce(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, V init, Op&& op);
+	template<typename T, typename V, typename Op, typename Combine> [[nodiscard]] V ParallelReduce(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, V init, Op&& op, Combine&& combine);
+
+	constexpr std::size_t ParallelMinBitsetGrainSize = 256 * 1024; //< in bits, whole-bitset operations on smaller bitsets run inline
+	constexpr std::size_t ParallelMinGrainSize = 64;
+}
+
+#include <NazaraUtils/ParallelAlgorithm.inl>
+
+#endif // NAZARAUTILS_PARALLELALGORITHM_HPP
@@ -0,0 +1,657 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, typename Allocator, std::size_t InlineBlockCount>
+		T* BitsetParallelAccess::GetBlocks(Bitset<T, Allocator, InlineBlockCount>& bitset)
+		{
+			return bitset.m_blocks.data();
+		}
+
+		template<typename T, typename Allocator, std::size_t InlineBlockCount>
+		const T* BitsetParallelAccess::GetBlocks(const Bitset<T, Allocator, InlineBlockCount>& bitset)
+		{
+			return bitset.m_blocks.data();
+		}
+
+		template<typename T, typename Allocator, std::size_t InlineBlockCount>
+		void BitsetParallelAccess::ResetExtraBits(Bitset<T, Allocator, InlineBlockCount>& bitset)
+		{
+			bitset.ResetExtraBits();
+		}
+
+		template<typename T, typename Allocator, std::size_t InlineBlockCount>
+		void BitsetParallelAccess::Resize(Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t blockCount, std::size_t bitCount)
+		{
+			bitset.m_blocks.resize(blockCount);
+			bitset.m_bitCount = bitCount;
+		}
+
+		std::pair<std::size_t, std::size_t> ParallelBlockChunks::GetChunk(std::size_t chunkIndex) const
+		{
+			// Chunks are laid out as if the array started on a cache line boundary, the first one is shortened by the misalignment
+			std::size_t first = chunkIndex * chunkBlockCount;
+			std::size_t last = first + chunkBlockCount - misalignment;
+			first = (first > misalignment) ? first - misalignment : 0;
+
+			return { first, std::min(last, blockCount) };
+		}
+
+		template<typename T>
+		ParallelBlockChunks ParallelChunkBlocks(const TaskScheduler& scheduler, const T* blocks, std::size_t blockCount, std::size_t grainSize)
+		{
+			constexpr std::size_t BitsPerBlock = BitCount<T>();
+			constexpr std::size_t BlocksPerCacheLine = std::max<std::size_t>(CacheLineSize / sizeof(T), 1);
+
+			std::size_t grainBlockCount = (grainSize + BitsPerBlock - 1) / BitsPerBlock;
+			std::size_t minGrainBlockCount = ParallelMinBitsetGrainSize / BitsPerBlock;
+
+			std::size_t chunkBlockCount = ParallelGrainSize(scheduler, blockCount, grainBlockCount, minGrainBlockCount);
+			chunkBlockCount = (chunkBlockCount + BlocksPerCacheLine - 1) / BlocksPerCacheLine * BlocksPerCacheLine;
+
+			std::size_t misalignment = (reinterpret_cast<std::uintptr_t>(blocks) % (BlocksPerCacheLine * sizeof(T))) / sizeof(T);
+
+			ParallelBlockChunks chunks;
+			chunks.blockCount = blockCount;
+			chunks.chunkBlockCount = chunkBlockCount;
+			chunks.chunkCount = (blockCount + misalignment + chunkBlockCount - 1) / chunkBlockCount;
+			chunks.misalignment = misalignment;
+
+			return chunks;
+		}
+
+		template<typename T, typename Allocator, std::size_t InlineBlockCount, typename F>
+		void ParallelPerformsBlocks(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, std::size_t grainSize, F&& func)
+		{
+			// Chunks are aligned on the blocks of the result, as they're the ones being written
+			T* blocks = BitsetParallelAccess::GetBlocks(result);
+			std::size_t blockCount = result.GetBlockCount();
+			if (blockCount != 0)
+			{
+				ParallelBlockChunks chunks = ParallelChunkBlocks(scheduler, blocks, blockCount, grainSize);
+				ParallelFor(scheduler, std::size_t(0), chunks.chunkCount, 1, [&](std::size_t chunkIndex)
+				{
+					auto [firstBlock, lastBlock] = chunks.GetChunk(chunkIndex);
+					func(blocks, firstBlock, lastBlock);
+				});
+			}
+
+			BitsetParallelAccess::ResetExtraBits(result);
+		}
+
+		template<typename T>
+		decltype(auto) ParallelDereference(const T& position)
+		{
+			if constexpr (std::is_integral_v<T>)
+				return position;
+			else
+				return *position;
+		}
+
+		template<typename T>
+		T ParallelAdvance(const T& position, std::size_t offset)
+		{
+			if constexpr (std::is_integral_v<T>)
+				return static_cast<T>(position + static_cast<T>(offset));
+			else
+				return position + static_cast<std::ptrdiff_t>(offset);
+		}
+
+		inline std::size_t ParallelGrainSize(const TaskScheduler& scheduler, std::size_t count, std::size_t grainSize, std::size_t minGrainSize)
+		{
+			if (grainSize != 0)
+				return grainSize;
+
+			// Aim for a few chunks per thread (the submitting thread helps while waiting) so that stealing can balance uneven work
+			constexpr std::size_t ChunksPerThread = 8;
+			return std::max(count / (ChunksPerThread * (scheduler.GetWorkerCount() + 1)), minGrainSize);
+		}
+
+		template<typename Body>
+		void ParallelSplit(ParallelForContext<Body>& context, std::size_t first, std::size_t last)
+		{
+			if (last - first <= context.grainSize)
+				return context.body(first, last);
+
+			// Split on a multiple of the grain size from the first index, so that every chunk starts on a grain boundary
+			std::size_t chunkCount = (last - first + context.grainSize - 1) / context.grainSize;
+			std::size_t middle = first + (chunkCount / 2) * context.grainSize;
+
+			TaskScheduler::TaskHandle upperHalf = context.scheduler.Submit([&context, middle, last] { ParallelSplit(context, middle, last); });
+			ParallelSplit(context, first, middle);
+			context.scheduler.Wait(upperHalf);
+		}
+
+		template<typename V, typename Body, typename Combine>
+		V ParallelSplitReduce(ParallelReduceContext<V, Body, Combine>& context, std::size_t first, std::size_t last)
+		{
+			if (last - first <= context.grainSize)
+				return context.body(first, last, V(context.init));
+
+			std::size_t chunkCount = (last - first + context.grainSize - 1) / context.grainSize;
+			std::size_t middle = first + (chunkCount / 2) * context.grainSize;
+
+			V upperResult = context.init;
+			TaskScheduler::TaskHandle upperHalf = context.scheduler.Submit([&context, &upperResult, middle, last] { upperResult = ParallelSplitReduce(context, middle, last); });
+			V lowerResult = ParallelSplitReduce(context, first, middle);
+			context.scheduler.Wait(upperHalf);
+
+			return context.combine(std::move(lowerResult), std::move(upperResult));
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Counts the bits set of a bitset, splitting the bitset in chunks counted by a task scheduler
+	* \return Number of bits set, same as Bitset::Count
+	*
+	* Chunks cover whole cache lines of blocks and are counted using BitKernels, a bitset of a single chunk is counted inline.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param bitset Bitset to count, must not be modified until the function returns
+	* \param grainSize Maximum number of bits counted by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	std::size_t ParallelCount(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize)
+	{
+		std::size_t blockCount = bitset.GetBlockCount();
+		if (blockCount == 0)
+			return 0;
+
+		const T* blocks = Detail::BitsetParallelAccess::GetBlocks(bitset);
+		Detail::ParallelBlockChunks chunks = Detail::ParallelChunkBlocks(scheduler, blocks, blockCount, grainSize);
+
+		return ParallelReduce(scheduler, std::size_t(0), chunks.chunkCount, 1, std::size_t(0), [&](std::size_t count, std::size_t chunkIndex)
+		{
+			auto [firstBlock, lastBlock] = chunks.GetChunk(chunkIndex);
+			return count + BitKernels::Count(blocks + firstBlock, (lastBlock - firstBlock) * sizeof(T));
+		}, std::plus<std::size_t>());
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Writes the index of every bit set of a bitset to an output, splitting the bitset in chunks processed by a task scheduler
+	* \return Output iterator past the last index written
+	*
+	* Bits of each chunk are counted first, a prefix sum of the counts then gives each chunk the offset where it writes its indices:
+	* the output is the same as Bitset::ExtractSetBits (indices are sorted).
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param bitset Bitset to scan, must not be modified until the function returns
+	* \param output Random-access output receiving the indices (as std::size_t), with room for bitset.Count() indices
+	* \param grainSize Maximum number of bits scanned by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \see ParallelCount
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount, typename OutputIt>
+	OutputIt ParallelExtractSetBits(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, OutputIt output, std::size_t grainSize)
+	{
+		using BitsetType = Bitset<T, Allocator, InlineBlockCount>;
+		constexpr std::size_t BitsPerBlock = BitsetType::bitsPerBlock;
+
+		std::size_t blockCount = bitset.GetBlockCount();
+		if (blockCount == 0)
+			return output;
+
+		const T* blocks = Detail::BitsetParallelAccess::GetBlocks(bitset);
+		Detail::ParallelBlockChunks chunks = Detail::ParallelChunkBlocks(scheduler, blocks, blockCount, grainSize);
+		if (chunks.chunkCount == 1)
+			return bitset.ExtractSetBits(output);
+
+		// offsets[i + 1] receives the bit count of chunk i, turned into the output offset of chunk i + 1 by the prefix sum
+		std::vector<std::size_t> offsets(chunks.chunkCount + 1, 0);
+		ParallelFor(scheduler, std::size_t(0), chunks.chunkCount, 1, [&](std::size_t chunkIndex)
+		{
+			auto [firstBlock, lastBlock] = chunks.GetChunk(chunkIndex);
+			offsets[chunkIndex + 1] = BitKernels::Count(blocks + firstBlock, (lastBlock - firstBlock) * sizeof(T));
+		});
+
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		ParallelFor(scheduler, std::size_t(0), chunks.chunkCount, 1, [&](std::size_t chunkIndex)
+		{
+			auto [firstBlock, lastBlock] = chunks.GetChunk(chunkIndex);
+
+			OutputIt chunkOutput = output + static_cast<std::ptrdiff_t>(offsets[chunkIndex]);
+			for (std::size_t blockIndex = firstBlock; blockIndex < lastBlock; ++blockIndex)
+			{
+				std::size_t firstBit = blockIndex * BitsPerBlock;
+				for (T block = blocks[blockIndex]; block != 0; block &= T(block - 1U))
+					*chunkOutput++ = firstBit + FindFirstBit(block) - 1;
+			}
+		});
+
+		return output + static_cast<std::ptrdiff_t>(offsets.back());
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Finds the first bit set of a bitset, splitting the bitset in chunks scanned by a task scheduler
+	* \return Index of the first bit set, or Bitset::npos if no bit is set
+	*
+	* Chunks race to publish the lowest bit found: a chunk stops scanning as soon as a bit before its current position was found,
+	* and chunks starting past it are skipped. Since the lowest chunks are processed first, a bit set near the beginning is found quickly.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param bitset Bitset to scan, must not be modified until the function returns
+	* \param grainSize Maximum number of bits scanned by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	std::size_t ParallelFindFirst(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize)
+	{
+		using BitsetType = Bitset<T, Allocator, InlineBlockCount>;
+		constexpr std::size_t BitsPerBlock = BitsetType::bitsPerBlock;
+		// Number of blocks scanned between two checks of the current result
+		constexpr std::size_t ScanBlockCount = 4096 / sizeof(T);
+
+		std::size_t blockCount = bitset.GetBlockCount();
+		if (blockCount == 0)
+			return BitsetType::npos;
+
+		const T* blocks = Detail::BitsetParallelAccess::GetBlocks(bitset);
+		Detail::ParallelBlockChunks chunks = Detail::ParallelChunkBlocks(scheduler, blocks, blockCount, grainSize);
+		if (chunks.chunkCount == 1)
+			return bitset.FindFirst();
+
+		std::atomic<std::size_t> firstBit(BitsetType::npos);
+		ParallelFor(scheduler, std::size_t(0), chunks.chunkCount, 1, [&](std::size_t chunkIndex)
+		{
+			auto [firstBlock, lastBlock] = chunks.GetChunk(chunkIndex);
+			for (std::size_t blockIndex = firstBlock; blockIndex < lastBlock; blockIndex += ScanBlockCount)
+			{
+				if (firstBit.load(std::memory_order_relaxed) < blockIndex * BitsPerBlock)
+					return;
+
+				std::size_t scanBlockCount = std::min(ScanBlockCount, lastBlock - blockIndex);
+				std::size_t byteOffset = BitKernels::FindFirstNonZero(blocks + blockIndex, scanBlockCount * sizeof(T));
+				if (byteOffset < scanBlockCount * sizeof(T))
+				{
+					std::size_t foundBlock = blockIndex + byteOffset / sizeof(T);
+					std::size_t bit = foundBlock * BitsPerBlock + FindFirstBit(blocks[foundBlock]) - 1;
+
+					std::size_t currentBit = firstBit.load(std::memory_order_relaxed);
+					while (bit < currentBit && !firstBit.compare_exchange_weak(currentBit, bit, std::memory_order_relaxed))
+						;
+
+					return;
+				}
+			}
+		});
+
+		// Waiting for the tasks synchronizes with them, relaxed accesses are enough
+		return firstBit.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every element of a range, splitting the range in chunks processed by a task scheduler
+	*
+	* The range is recursively split in two halves (on grain boundaries) until each part is at most grainSize long, idle workers steal the halves.
+	* The calling thread processes its own half and runs other tasks while waiting, it returns once the whole range was processed.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param begin First position of the range, either an integer or a random-access position such as an iterator, a pointer or a SparsePtr
+	* \param end Position following the last element of the range
+	* \param grainSize Maximum number of elements processed by a single task, zero computes a grain size from the range size and the worker count
+	* \param func Function called with each index (for integer ranges) or each element (for other positions), must be safe to call concurrently and must not throw
+	*
+	* \remark Ranges no bigger than one grain are processed inline, without involving the scheduler
+	*/
+	template<typename T, typename F>
+	void ParallelFor(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, F&& func)
+	{
+		std::size_t count = static_cast<std::size_t>(end - begin);
+		if (count == 0)
+			return;
+
+		auto body = [&](std::size_t first, std::size_t last)
+		{
+			T position = Detail::ParallelAdvance(begin, first);
+			for (std::size_t i = first; i < last; ++i)
+			{
+				func(Detail::ParallelDereference(position));
+				++position;
+			}
+		};
+
+		Detail::ParallelForContext<decltype(body)> context{ scheduler, Detail::ParallelGrainSize(scheduler, count, grainSize, ParallelMinGrainSize), body };
+		Detail::ParallelSplit(context, 0, count);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function with the index of every bit set of a bitset, splitting the bitset in chunks processed by a task scheduler
+	*
+	* Chunks always cover whole blocks, the bitset is scanned a block at a time.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param bitset Bitset to scan, must not be modified until the function returns
+	* \param grainSize Maximum number of bits scanned by a single task (rounded up to whole blocks), zero computes a grain size from the bitset size and the worker count
+	* \param func Function called with the index of each bit set (as std::size_t), must be safe to call concurrently and must not throw
+	*
+	* \see ParallelFor
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount, typename F>
+	void ParallelForEachSetBit(TaskScheduler& scheduler, const Bitset<T, Allocator, InlineBlockCount>& bitset, std::size_t grainSize, F&& func)
+	{
+		using BitsetType = Bitset<T, Allocator, InlineBlockCount>;
+		constexpr std::size_t BitsPerBlock = BitsetType::bitsPerBlock;
+
+		std::size_t blockCount = bitset.GetBlockCount();
+		if (blockCount == 0)
+			return;
+
+		auto body = [&](std::size_t firstBlock, std::size_t lastBlock)
+		{
+			for (std::size_t blockIndex = firstBlock; blockIndex < lastBlock; ++blockIndex)
+			{
+				std::size_t firstBit = blockIndex * BitsPerBlock;
+				for (T block = bitset.GetBlock(blockIndex); block != 0; block &= T(block - 1U))
+					func(firstBit + FindFirstBit(block) - 1);
+			}
+		};
+
+		std::size_t grainBlockCount = (grainSize + BitsPerBlock - 1) / BitsPerBlock;
+		std::size_t minGrainBlockCount = std::max<std::size_t>(ParallelMinGrainSize / BitsPerBlock, 1);
+
+		Detail::ParallelForContext<decltype(body)> context{ scheduler, Detail::ParallelGrainSize(scheduler, blockCount, grainBlockCount, minGrainBlockCount), body };
+		Detail::ParallelSplit(context, 0, blockCount);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every allocated entry of a memory pool, splitting the pool in block ranges processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the block ranges
+	* \param pool Memory pool whose entries are processed, entries must not be allocated or freed until the function returns
+	* \param grainSize Maximum number of blocks processed by a single task, zero computes a grain size from the block count and the worker count
+	* \param func Function called as func(entry) or func(index, entry) for every allocated entry, must be safe to call concurrently and must not throw
+	*
+	* \see MemoryPool::ForEachRange
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator, typename F>
+	void ParallelForEachEntry(TaskScheduler& scheduler, MemoryPool<T, Alignment, Policy, Allocator>& pool, std::size_t grainSize, F&& func)
+	{
+		std::size_t blockCount = pool.GetBlockCount();
+		if (blockCount == 0)
+			return;
+
+		auto body = [&](std::size_t firstBlock, std::size_t lastBlock)
+		{
+			pool.ForEachRange(firstBlock, lastBlock, func);
+		};
+
+		Detail::ParallelForContext<decltype(body)> context{ scheduler, Detail::ParallelGrainSize(scheduler, blockCount, grainSize, 1), body };
+		Detail::ParallelSplit(context, 0, blockCount);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every allocated entry of a memory pool, splitting the pool in block ranges processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the block ranges
+	* \param pool Memory pool whose entries are processed, entries must not be allocated or freed until the function returns
+	* \param grainSize Maximum number of blocks processed by a single task, zero computes a grain size from the block count and the worker count
+	* \param func Function called as func(entry) or func(index, entry) for every allocated entry, must be safe to call concurrently and must not throw
+	*
+	* \see MemoryPool::ForEachRange
+	*/
+	template<typename T, std::size_t Alignment, typename Policy, typename Allocator, typename F>
+	void ParallelForEachEntry(TaskScheduler& scheduler, const MemoryPool<T, Alignment, Policy, Allocator>& pool, std::size_t grainSize, F&& func)
+	{
+		std::size_t blockCount = pool.GetBlockCount();
+		if (blockCount == 0)
+			return;
+
+		auto body = [&](std::size_t firstBlock, std::size_t lastBlock)
+		{
+			pool.ForEachRange(firstBlock, lastBlock, func);
+		};
+
+		Detail::ParallelForContext<decltype(body)> context{ scheduler, Detail::ParallelGrainSize(scheduler, blockCount, grainSize, 1), body };
+		Detail::ParallelSplit(context, 0, blockCount);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Performs the "AND" operator between two bitsets, splitting the blocks in chunks processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param result Bitset receiving the result, can be one of the operands
+	* \param a First bitset
+	* \param b Second bitset
+	* \param grainSize Maximum number of bits processed by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \remark The result is the same as Bitset::PerformsAND, chunks start on cache line boundaries of the result to avoid false sharing
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	void ParallelPerformsAND(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize)
+	{
+		std::pair<std::size_t, std::size_t> minmax = std::minmax(a.GetBlockCount(), b.GetBlockCount());
+		Detail::BitsetParallelAccess::Resize(result, minmax.second, std::max(a.GetSize(), b.GetSize()));
+
+		// Operand blocks are retrieved after resizing, in case one of them is the result
+		const T* aBlocks = Detail::BitsetParallelAccess::GetBlocks(a);
+		const T* bBlocks = Detail::BitsetParallelAccess::GetBlocks(b);
+
+		Detail::ParallelPerformsBlocks(scheduler, result, grainSize, [&](T* blocks, std::size_t firstBlock, std::size_t lastBlock)
+		{
+			std::size_t kernelLastBlock = std::min(lastBlock, minmax.first);
+			if (firstBlock < kernelLastBlock)
+				BitKernels::And(blocks + firstBlock, aBlocks + firstBlock, bBlocks + firstBlock, (kernelLastBlock - firstBlock) * sizeof(T));
+
+			// x & 0 = 0
+			std::fill(blocks + std::max(firstBlock, kernelLastBlock), blocks + lastBlock, T(0U));
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Performs the "AND NOT" operator between two bitsets (a & ~b), splitting the blocks in chunks processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param result Bitset receiving the result, can be one of the operands
+	* \param a First bitset
+	* \param b Second bitset, which is negated
+	* \param grainSize Maximum number of bits processed by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \remark The result is the same as Bitset::PerformsANDNOT, chunks start on cache line boundaries of the result to avoid false sharing
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	void ParallelPerformsANDNOT(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize)
+	{
+		std::size_t aBlockCount = a.GetBlockCount();
+		std::size_t minBlockCount = std::min(aBlockCount, b.GetBlockCount());
+		bool copyA = (&a != &result);
+
+		Detail::BitsetParallelAccess::Resize(result, std::max(aBlockCount, b.GetBlockCount()), std::max(a.GetSize(), b.GetSize()));
+
+		const T* aBlocks = Detail::BitsetParallelAccess::GetBlocks(a);
+		const T* bBlocks = Detail::BitsetParallelAccess::GetBlocks(b);
+
+		Detail::ParallelPerformsBlocks(scheduler, result, grainSize, [&](T* blocks, std::size_t firstBlock, std::size_t lastBlock)
+		{
+			std::size_t kernelLastBlock = std::min(lastBlock, minBlockCount);
+			if (firstBlock < kernelLastBlock)
+				BitKernels::AndNot(blocks + firstBlock, aBlocks + firstBlock, bBlocks + firstBlock, (kernelLastBlock - firstBlock) * sizeof(T));
+
+			// Past the end of b, we're computing x & ~0 = x, and past the end of a, 0 & ~x = 0
+			std::size_t copyFirstBlock = std::max(firstBlock, kernelLastBlock);
+			std::size_t copyLastBlock = std::max(copyFirstBlock, std::min(lastBlock, aBlockCount));
+			if (copyA)
+				std::copy(aBlocks + copyFirstBlock, aBlocks + copyLastBlock, blocks + copyFirstBlock);
+
+			std::fill(blocks + copyLastBlock, blocks + lastBlock, T(0U));
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Performs the "NOT" operator of a bitset, splitting the blocks in chunks processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param result Bitset receiving the result, can be the operand
+	* \param a Bitset to negate
+	* \param grainSize Maximum number of bits processed by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \remark The result is the same as Bitset::PerformsNOT, chunks start on cache line boundaries of the result to avoid false sharing
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	void ParallelPerformsNOT(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, std::size_t grainSize)
+	{
+		Detail::BitsetParallelAccess::Resize(result, a.GetBlockCount(), a.GetSize());
+
+		const T* aBlocks = Detail::BitsetParallelAccess::GetBlocks(a);
+
+		Detail::ParallelPerformsBlocks(scheduler, result, grainSize, [&](T* blocks, std::size_t firstBlock, std::size_t lastBlock)
+		{
+			BitKernels::Not(blocks + firstBlock, aBlocks + firstBlock, (lastBlock - firstBlock) * sizeof(T));
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Performs the "OR" operator between two bitsets, splitting the blocks in chunks processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param result Bitset receiving the result, can be one of the operands
+	* \param a First bitset
+	* \param b Second bitset
+	* \param grainSize Maximum number of bits processed by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \remark The result is the same as Bitset::PerformsOR, chunks start on cache line boundaries of the result to avoid false sharing
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	void ParallelPerformsOR(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize)
+	{
+		bool aIsGreater = (a.GetSize() > b.GetSize());
+		std::size_t minBlockCount = std::min(a.GetBlockCount(), b.GetBlockCount());
+		bool copyGreater = (&((aIsGreater) ? a : b) != &result);
+
+		Detail::BitsetParallelAccess::Resize(result, std::max(a.GetBlockCount(), b.GetBlockCount()), std::max(a.GetSize(), b.GetSize()));
+
+		const T* aBlocks = Detail::BitsetParallelAccess::GetBlocks(a);
+		const T* bBlocks = Detail::BitsetParallelAccess::GetBlocks(b);
+		const T* greaterBlocks = (aIsGreater) ? aBlocks : bBlocks;
+
+		Detail::ParallelPerformsBlocks(scheduler, result, grainSize, [&](T* blocks, std::size_t firstBlock, std::size_t lastBlock)
+		{
+			std::size_t kernelLastBlock = std::min(lastBlock, minBlockCount);
+			if (firstBlock < kernelLastBlock)
+				BitKernels::Or(blocks + firstBlock, aBlocks + firstBlock, bBlocks + firstBlock, (kernelLastBlock - firstBlock) * sizeof(T));
+
+			// x | 0 = x
+			if (copyGreater)
+				std::copy(greaterBlocks + std::max(firstBlock, kernelLastBlock), greaterBlocks + lastBlock, blocks + std::max(firstBlock, kernelLastBlock));
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Performs the "XOR" operator between two bitsets, splitting the blocks in chunks processed by a task scheduler
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param result Bitset receiving the result, can be one of the operands
+	* \param a First bitset
+	* \param b Second bitset
+	* \param grainSize Maximum number of bits processed by a single task (rounded up to whole cache lines), zero computes a grain size from the bitset size and the worker count (never below ParallelMinBitsetGrainSize)
+	*
+	* \remark The result is the same as Bitset::PerformsXOR, chunks start on cache line boundaries of the result to avoid false sharing
+	*/
+	template<typename T, typename Allocator, std::size_t InlineBlockCount>
+	void ParallelPerformsXOR(TaskScheduler& scheduler, Bitset<T, Allocator, InlineBlockCount>& result, const Bitset<T, Allocator, InlineBlockCount>& a, const Bitset<T, Allocator, InlineBlockCount>& b, std::size_t grainSize)
+	{
+		bool aIsGreater = (a.GetSize() > b.GetSize());
+		std::size_t minBlockCount = std::min(a.GetBlockCount(), b.GetBlockCount());
+		bool copyGreater = (&((aIsGreater) ? a : b) != &result);
+
+		Detail::BitsetParallelAccess::Resize(result, std::max(a.GetBlockCount(), b.GetBlockCount()), std::max(a.GetSize(), b.GetSize()));
+
+		const T* aBlocks = Detail::BitsetParallelAccess::GetBlocks(a);
+		const T* bBlocks = Detail::BitsetParallelAccess::GetBlocks(b);
+		const T* greaterBlocks = (aIsGreater) ? aBlocks : bBlocks;
+
+		Detail::ParallelPerformsBlocks(scheduler, result, grainSize, [&](T* blocks, std::size_t firstBlock, std::size_t lastBlock)
+		{
+			std::size_t kernelLastBlock = std::min(lastBlock, minBlockCount);
+			if (firstBlock < kernelLastBlock)
+				BitKernels::Xor(blocks + firstBlock, aBlocks + firstBlock, bBlocks + firstBlock, (kernelLastBlock - firstBlock) * sizeof(T));
+
+			// x ^ 0 = x
+			if (copyGreater)
+				std::copy(greaterBlocks + std::max(firstBlock, kernelLastBlock), greaterBlocks + lastBlock, blocks + std::max(firstBlock, kernelLastBlock));
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Folds a range in parallel, using the same operation to accumulate elements and to combine partial results
+	* \return Result of the reduction
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param begin First position of the range, either an integer or a random-access position such as an iterator, a pointer or a SparsePtr
+	* \param end Position following the last element of the range
+	* \param grainSize Maximum number of elements folded by a single task, zero computes a grain size from the range size and the worker count
+	* \param init Initial value of every chunk accumulator, must be an identity of op (0 for a sum, 1 for a product, ...)
+	* \param op Associative operation called as op(accumulator, value) where value is an index or an element, and as op(result, result) to combine chunks
+	*
+	* \remark Chunks are combined in range order, op does not need to be commutative
+	*/
+	template<typename T, typename V, typename Op>
+	V ParallelReduce(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, V init, Op&& op)
+	{
+		return ParallelReduce(scheduler, begin, end, grainSize, std::move(init), op, op);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Folds a range in parallel
+	* \return Result of the reduction
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param begin First position of the range, either an integer or a random-access position such as an iterator, a pointer or a SparsePtr
+	* \param end Position following the last element of the range
+	* \param grainSize Maximum number of elements folded by a single task, zero computes a grain size from the range size and the worker count
+	* \param init Initial value of every chunk accumulator, must be an identity of combine
+	* \param op Operation called as op(accumulator, value) -> V, where value is an index (for integer ranges) or an element (for other positions)
+	* \param combine Associative operation called as combine(lowerResult, upperResult) -> V to merge the results of two adjacent chunks
+	*
+	* \remark op and combine must be safe to call concurrently and must not throw
+	*/
+	template<typename T, typename V, typename Op, typename Combine>
+	V ParallelReduce(TaskScheduler& scheduler, T begin, T end, std::size_t grainSize, V init, Op&& op, Combine&& combine)
+	{
+		std::size_t count = static_cast<std::size_t>(end - begin);
+		if (count == 0)
+			return init;
+
+		auto body = [&](std::size_t first, std::size_t last, V accumulator) -> V
+		{
+			T position = Detail::ParallelAdvance(begin, first);
+			for (std::size_t i = first; i < last; ++i)
+			{
+				accumulator = op(std::move(accumulator), Detail::ParallelDereference(position));
+				++position;
+			}
+
+			return accumulator;
+		};
+
+		Detail::ParallelReduceContext<V, decltype(body), std::remove_reference_t<Combine>> context{ scheduler, Detail::ParallelGrainSize(scheduler, count, grainSize, ParallelMinGrainSize), init, body, combine };
+		return Detail::ParallelSplitReduce(context, 0, count);
+	}
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_PERTHREADARRAY_HPP
+#define NAZARAUTILS_PERTHREADARRAY_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/CacheAligned.hpp>
+#include <NazaraUtils/SparsePtr.hpp>
+#include <cstddef>
+#include <memory>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		inline std::size_t GetThreadIndex();
+	}
+
+	template<typename T>
+	class PerThreadArray
+	{
+		public:
+			explicit PerThreadArray(std::size_t size);
+			PerThreadArray(const PerThreadArray&) = delete;
+			PerThreadArray(PerThreadArray&&) noexcept = default;
+			~PerThreadArray() = default;
+
+			T& Get(std::size_t index);
+			const T& Get(std::size_t index) const;
+			T& GetLocal();
+			const T& GetLocal() const;
+			std::size_t GetLocalIndex() const;
+			std::size_t GetSize() const;
+
+			SparsePtr<T> begin();
+			SparsePtr<const T> begin() const;
+			SparsePtr<T> end();
+			SparsePtr<const T> end() const;
+
+			T& operator[](std::size_t index);
+			const T& operator[](std::size_t index) const;
+
+			PerThreadArray& operator=(const PerThreadArray&) = delete;
+			PerThreadArray& operator=(PerThreadArray&&) noexcept = default;
+
+		private:
+			std::unique_ptr<CacheAligned<T>[]> m_elements;
+			std::size_t m_size;
+	};
+}
+
+#include <NazaraUtils/PerThreadArray.inl>
+
+#endif // NAZARAUTILS_PERTHREADARRAY_HPP
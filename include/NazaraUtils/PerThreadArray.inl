@@ -0,0 +1,127 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <atomic>
+#include <cassert>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Process-wide index of the calling thread, given the first time a thread calls this function (0 for the first thread, 1 for the second, ...)
+		inline std::size_t GetThreadIndex()
+		{
+			static std::atomic<std::size_t> s_threadCounter = 0;
+			thread_local std::size_t threadIndex = s_threadCounter.fetch_add(1, std::memory_order_relaxed);
+			return threadIndex;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::PerThreadArray
+	* \brief Fixed-size array whose elements each live on their own cache line(s), to be written by different threads without false sharing
+	*
+	* Elements are typically indexed by worker index, or picked with GetLocal which maps each thread to a slot (threads are numbered in order
+	* of first use and share slots once there are more threads than elements, elements must then be safe to use concurrently, like atomic counters).
+	* Iterating yields the elements themselves (using a SparsePtr striding over the padding), for example to sum per-thread counters.
+	*
+	* \see CacheAligned
+	*/
+
+	/*!
+	* \brief Constructs the array with value-initialized elements
+	*
+	* \param size Number of elements, must not be zero
+	*/
+	template<typename T>
+	PerThreadArray<T>::PerThreadArray(std::size_t size) :
+	m_elements(std::make_unique<CacheAligned<T>[]>(size)),
+	m_size(size)
+	{
+		assert(size > 0);
+	}
+
+	template<typename T>
+	T& PerThreadArray<T>::Get(std::size_t index)
+	{
+		assert(index < m_size);
+		return m_elements[index].Get();
+	}
+
+	template<typename T>
+	const T& PerThreadArray<T>::Get(std::size_t index) const
+	{
+		assert(index < m_size);
+		return m_elements[index].Get();
+	}
+
+	/*!
+	* \brief Returns the element associated with the calling thread
+	* \return Element at index GetLocalIndex()
+	*/
+	template<typename T>
+	T& PerThreadArray<T>::GetLocal()
+	{
+		return m_elements[GetLocalIndex()].Get();
+	}
+
+	template<typename T>
+	const T& PerThreadArray<T>::GetLocal() const
+	{
+		return m_elements[GetLocalIndex()].Get();
+	}
+
+	/*!
+	* \brief Returns the index of the element associated with the calling thread
+	* \return Index of the thread (in order of first use of any PerThreadArray) modulo the array size
+	*/
+	template<typename T>
+	std::size_t PerThreadArray<T>::GetLocalIndex() const
+	{
+		return Detail::GetThreadIndex() % m_size;
+	}
+
+	template<typename T>
+	std::size_t PerThreadArray<T>::GetSize() const
+	{
+		return m_size;
+	}
+
+	template<typename T>
+	SparsePtr<T> PerThreadArray<T>::begin()
+	{
+		return SparsePtr<T>(&m_elements[0].Get(), sizeof(CacheAligned<T>));
+	}
+
+	template<typename T>
+	SparsePtr<const T> PerThreadArray<T>::begin() const
+	{
+		return SparsePtr<const T>(&m_elements[0].Get(), sizeof(CacheAligned<T>));
+	}
+
+	template<typename T>
+	SparsePtr<T> PerThreadArray<T>::end()
+	{
+		return begin() + m_size;
+	}
+
+	template<typename T>
+	SparsePtr<const T> PerThreadArray<T>::end() const
+	{
+		return begin() + m_size;
+	}
+
+	template<typename T>
+	T& PerThreadArray<T>::operator[](std::size_t index)
+	{
+		return Get(index);
+	}
+
+	template<typename T>
+	const T& PerThreadArray<T>::operator[](std::size_t index) const
+	{
+		return Get(index);
+	}
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_POOLMEMORYRESOURCE_HPP
+#define NAZARAUTILS_POOLMEMORYRESOURCE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+// Polymorphic memory resources support (this header is empty if the standard library doesn't provide <memory_resource>)
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L
+	#define NAZARA_HAS_MEMORY_RESOURCE
+#endif
+
+#ifdef NAZARA_HAS_MEMORY_RESOURCE
+
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/SyncPrimitives.hpp>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	class PoolMemoryResource : public std::pmr::memory_resource
+	{
+		public:
+			inline explicit PoolMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource(), bool enableThreadCache = false);
+			PoolMemoryResource(const PoolMemoryResource&) = delete;
+			PoolMemoryResource(PoolMemoryResource&&) = delete;
+			inline ~PoolMemoryResource();
+
+			inline std::pmr::memory_resource* GetUpstreamResource() const;
+
+			inline bool IsThreadCacheEnabled() const;
+
+			PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+			PoolMemoryResource& operator=(PoolMemoryResource&&) = delete;
+
+			static constexpr std::size_t MaxPooledSize = 4096;
+			static constexpr std::size_t MinPooledSize = 8;
+			static constexpr std::size_t SizeClassCount = 10; //< log2(MaxPooledSize / MinPooledSize) + 1
+
+		protected:
+			inline void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+			inline void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+			inline bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		private:
+			template<std::size_t... SizeClassIndex> PoolMemoryResource(std::pmr::memory_resource* upstream, bool enableThreadCache, std::index_sequence<SizeClassIndex...>);
+
+			template<std::size_t Size>
+			struct alignas(CacheLineSize) SizeClass
+			{
+				// Entries are aligned to their size, so that any alignment up to the size class is respected
+				struct alignas(Size) Entry
+				{
+					std::byte data[Size];
+				};
+
+				using Allocator = std::pmr::polymorphic_allocator<Entry>;
+				using Pool = MemoryPool<Entry, Size, MemoryPoolDefaultPolicy, Allocator>;
+
+				inline explicit SizeClass(std::pmr::memory_resource* upstream);
+
+				FutexMutex mutex;
+				Pool pool;
+			};
+
+			template<typename Sequence> struct SizeClassTuple;
+
+			template<std::size_t... SizeClassIndex>
+			struct SizeClassTuple<std::index_sequence<SizeClassIndex...>>
+			{
+				using Type = std::tuple<SizeClass<(MinPooledSize << SizeClassIndex)>...>;
+			};
+
+			struct FreeEntry
+			{
+				FreeEntry* next;
+			};
+
+			struct ThreadCache
+			{
+				inline ~ThreadCache();
+
+				inline void Clear();
+
+				UInt64 resourceId = 0; //< Resource the cached entries belong to, zero if none
+				std::array<FreeEntry*, SizeClassCount> freeEntries = {};
+				std::array<std::size_t, SizeClassCount> freeEntryCounts = {};
+			};
+
+			// Maps identifiers of live resources with a thread cache to the resources, identifiers are never reused
+			struct Registry
+			{
+				FutexMutex mutex;
+				std::vector<std::pair<UInt64, PoolMemoryResource*>> resources;
+				UInt64 nextResourceId = 1;
+			};
+
+			template<std::size_t SizeClassIndex> FreeEntry* AllocateFromSizeClass(std::size_t count);
+			template<std::size_t... SizeClassIndex> FreeEntry* AllocateFromSizeClass(std::size_t sizeClassIndex, std::size_t count, std::index_sequence<SizeClassIndex...>);
+			template<std::size_t SizeClassIndex> void FreeToSizeClass(FreeEntry* entries);
+			template<std::size_t... SizeClassIndex> void FreeToSizeClass(std::size_t sizeClassIndex, FreeEntry* entries, std::index_sequence<SizeClassIndex...>);
+			inline void ReleaseThreadCache(ThreadCache& cache);
+
+			static inline void FlushThreadCache(ThreadCache& cache);
+			static inline Registry& GetRegistry();
+			static inline std::size_t GetSizeClassIndex(std::size_t bytes, std::size_t alignment);
+			static inline ThreadCache& GetThreadCache();
+
+			static constexpr std::size_t MaxCachedEntryCount = 64; //< per size class and thread
+			static constexpr std::size_t CacheTransferCount = MaxCachedEntryCount / 2; //< entries moved between a thread cache and a pool at once
+			static constexpr std::size_t PoolBlockByteSize = 64 * 1024;
+
+			static_assert(MinPooledSize >= sizeof(FreeEntry), "entries must be able to hold a free list link");
+			static_assert((MinPooledSize << (SizeClassCount - 1)) == MaxPooledSize);
+
+			using SizeClasses = typename SizeClassTuple<std::make_index_sequence<SizeClassCount>>::Type;
+
+			SizeClasses m_sizeClasses;
+			std::pmr::memory_resource* m_upstream;
+			UInt64 m_resourceId; //< Zero if the thread cache is disabled
+	};
+}
+
+#include <NazaraUtils/PoolMemoryResource.inl>
+
+#endif // NAZARA_HAS_MEMORY_RESOURCE
+
+#endif // NAZARAUTILS_POOLMEMORYRESOURCE_HPP
@@ -0,0 +1,320 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::PoolMemoryResource
+	* \brief Memory resource (std::pmr) serving small allocations from pools, to give pooled memory to allocator-aware containers
+	*
+	* Requests are rounded up to a power of two size class (from MinPooledSize to MaxPooledSize bytes), each size class being a MemoryPool of raw entries
+	* protected by a mutex: allocating an entry doesn't search more than a few bitset words, and the pool blocks are allocated from the upstream resource.
+	* Larger requests are forwarded to the upstream resource.
+	*
+	* An optional thread cache keeps a few free entries of each size class per thread (in a free list stored in the entries themselves),
+	* which are used by the allocations of the thread without locking, entries being moved between the cache and the pools by batches. A thread caches entries of a single resource at a time,
+	* they are given back to their pools when the thread uses another resource with a thread cache, or exits.
+	*
+	* std::pmr containers (std::pmr::vector, std::pmr::unordered_map, ...) and containers taking an allocator (like Bitset, with std::pmr::polymorphic_allocator)
+	* can use this resource.
+	*
+	* \remark Every allocation must be deallocated before the resource is destroyed, from any thread
+	* \see MemoryPool, ArenaAllocator
+	*/
+
+	/*!
+	* \brief Constructs a resource
+	*
+	* \param upstream Resource used to allocate the pool blocks and the requests larger than MaxPooledSize, must outlive this resource
+	* \param enableThreadCache Enables the thread cache, which helps when multiple threads allocate and free frequently
+	*/
+	PoolMemoryResource::PoolMemoryResource(std::pmr::memory_resource* upstream, bool enableThreadCache) :
+	PoolMemoryResource(upstream, enableThreadCache, std::make_index_sequence<SizeClassCount>())
+	{
+	}
+
+	template<std::size_t... SizeClassIndex>
+	PoolMemoryResource::PoolMemoryResource(std::pmr::memory_resource* upstream, bool enableThreadCache, std::index_sequence<SizeClassIndex...>) :
+	m_sizeClasses(((void) SizeClassIndex, upstream)...),
+	m_upstream(upstream),
+	m_resourceId(0)
+	{
+		assert(upstream);
+
+		if (enableThreadCache)
+		{
+			Registry& registry = GetRegistry();
+
+			std::lock_guard lock(registry.mutex);
+			m_resourceId = registry.nextResourceId++;
+			registry.resources.emplace_back(m_resourceId, this);
+		}
+	}
+
+	PoolMemoryResource::~PoolMemoryResource()
+	{
+		if (m_resourceId == 0)
+			return;
+
+		// Entries cached by other threads are dropped (without being read) once they notice this resource is gone, the pools owning them being released here
+		{
+			Registry& registry = GetRegistry();
+
+			std::lock_guard lock(registry.mutex);
+			auto it = std::find_if(registry.resources.begin(), registry.resources.end(), [&](const auto& pair) { return pair.first == m_resourceId; });
+			assert(it != registry.resources.end());
+			registry.resources.erase(it);
+		}
+
+		ThreadCache& cache = GetThreadCache();
+		if (cache.resourceId == m_resourceId)
+			cache.Clear();
+	}
+
+	/*!
+	* \brief Returns the resource used to allocate the pool blocks and the large requests
+	*/
+	std::pmr::memory_resource* PoolMemoryResource::GetUpstreamResource() const
+	{
+		return m_upstream;
+	}
+
+	/*!
+	* \brief Checks if the thread cache is enabled
+	*/
+	bool PoolMemoryResource::IsThreadCacheEnabled() const
+	{
+		return m_resourceId != 0;
+	}
+
+	void* PoolMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		std::size_t sizeClassIndex = GetSizeClassIndex(bytes, alignment);
+		if NAZARA_UNLIKELY(sizeClassIndex >= SizeClassCount)
+			return m_upstream->allocate(bytes, alignment);
+
+		if (m_resourceId == 0)
+		{
+			FreeEntry* entry = AllocateFromSizeClass(sizeClassIndex, 1, std::make_index_sequence<SizeClassCount>());
+			entry->~FreeEntry();
+			return entry;
+		}
+
+		ThreadCache& cache = GetThreadCache();
+		if NAZARA_UNLIKELY(cache.resourceId != m_resourceId)
+		{
+			FlushThreadCache(cache);
+			cache.resourceId = m_resourceId;
+		}
+
+		FreeEntry* entry = cache.freeEntries[sizeClassIndex];
+		if NAZARA_LIKELY(entry)
+			cache.freeEntryCounts[sizeClassIndex]--;
+		else
+		{
+			// Refill the cache with a few entries at once, to lock the size class once for all of them
+			entry = AllocateFromSizeClass(sizeClassIndex, CacheTransferCount, std::make_index_sequence<SizeClassCount>());
+			cache.freeEntryCounts[sizeClassIndex] = CacheTransferCount - 1;
+		}
+
+		cache.freeEntries[sizeClassIndex] = entry->next;
+
+		entry->~FreeEntry();
+		return entry;
+	}
+
+	void PoolMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+	{
+		std::size_t sizeClassIndex = GetSizeClassIndex(bytes, alignment);
+		if NAZARA_UNLIKELY(sizeClassIndex >= SizeClassCount)
+			return m_upstream->deallocate(ptr, bytes, alignment);
+
+		if (m_resourceId == 0)
+		{
+			FreeToSizeClass(sizeClassIndex, ::new (ptr) FreeEntry{ nullptr }, std::make_index_sequence<SizeClassCount>());
+			return;
+		}
+
+		ThreadCache& cache = GetThreadCache();
+		if NAZARA_UNLIKELY(cache.resourceId != m_resourceId)
+		{
+			FlushThreadCache(cache);
+			cache.resourceId = m_resourceId;
+		}
+
+		if NAZARA_UNLIKELY(cache.freeEntryCounts[sizeClassIndex] == MaxCachedEntryCount)
+		{
+			// Give the most recently freed entries back to the pool at once, keeping the others for the next allocations
+			FreeEntry* entries = cache.freeEntries[sizeClassIndex];
+
+			FreeEntry* lastEntry = entries;
+			for (std::size_t i = 1; i < CacheTransferCount; ++i)
+				lastEntry = lastEntry->next;
+
+			cache.freeEntries[sizeClassIndex] = lastEntry->next;
+			cache.freeEntryCounts[sizeClassIndex] -= CacheTransferCount;
+
+			lastEntry->next = nullptr;
+			FreeToSizeClass(sizeClassIndex, entries, std::make_index_sequence<SizeClassCount>());
+		}
+
+		cache.freeEntries[sizeClassIndex] = ::new (ptr) FreeEntry{ cache.freeEntries[sizeClassIndex] };
+		cache.freeEntryCounts[sizeClassIndex]++;
+	}
+
+	bool PoolMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	template<std::size_t SizeClassIndex>
+	auto PoolMemoryResource::AllocateFromSizeClass(std::size_t count) -> FreeEntry*
+	{
+		auto& sizeClass = std::get<SizeClassIndex>(m_sizeClasses);
+		using SizeClassType = std::decay_t<decltype(sizeClass)>;
+		using Pool = typename SizeClassType::Pool;
+
+		std::lock_guard lock(sizeClass.mutex);
+
+		// Entries are returned linked together, as a free list
+		FreeEntry* entries = nullptr;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			std::size_t index;
+			typename SizeClassType::Entry* entry;
+			try
+			{
+				entry = sizeClass.pool.Allocate(Pool::DeferConstruct, index);
+			}
+			catch (...)
+			{
+				// Don't lose the entries allocated before the upstream resource failed
+				while (entries)
+				{
+					FreeEntry* next = entries->next;
+					entries->~FreeEntry();
+
+					sizeClass.pool.Free(sizeClass.pool.RetrieveEntryIndex(reinterpret_cast<typename SizeClassType::Entry*>(entries)), Pool::NoDestruction);
+					entries = next;
+				}
+
+				throw;
+			}
+
+			entries = ::new (entry) FreeEntry{ entries };
+		}
+
+		return entries;
+	}
+
+	template<std::size_t... SizeClassIndex>
+	auto PoolMemoryResource::AllocateFromSizeClass(std::size_t sizeClassIndex, std::size_t count, std::index_sequence<SizeClassIndex...>) -> FreeEntry*
+	{
+		using AllocateFunc = FreeEntry*(PoolMemoryResource::*)(std::size_t);
+		static constexpr AllocateFunc allocateFuncs[] = { &PoolMemoryResource::AllocateFromSizeClass<SizeClassIndex>... };
+
+		return (this->*allocateFuncs[sizeClassIndex])(count);
+	}
+
+	template<std::size_t SizeClassIndex>
+	void PoolMemoryResource::FreeToSizeClass(FreeEntry* entries)
+	{
+		auto& sizeClass = std::get<SizeClassIndex>(m_sizeClasses);
+		using SizeClassType = std::decay_t<decltype(sizeClass)>;
+		using Pool = typename SizeClassType::Pool;
+
+		std::lock_guard lock(sizeClass.mutex);
+
+		while (entries)
+		{
+			FreeEntry* next = entries->next;
+			entries->~FreeEntry();
+
+			std::size_t index = sizeClass.pool.RetrieveEntryIndex(reinterpret_cast<typename SizeClassType::Entry*>(entries));
+			assert(index != Pool::InvalidIndex);
+			sizeClass.pool.Free(index, Pool::NoDestruction);
+
+			entries = next;
+		}
+	}
+
+	template<std::size_t... SizeClassIndex>
+	void PoolMemoryResource::FreeToSizeClass(std::size_t sizeClassIndex, FreeEntry* entries, std::index_sequence<SizeClassIndex...>)
+	{
+		using FreeFunc = void(PoolMemoryResource::*)(FreeEntry*);
+		static constexpr FreeFunc freeFuncs[] = { &PoolMemoryResource::FreeToSizeClass<SizeClassIndex>... };
+
+		(this->*freeFuncs[sizeClassIndex])(entries);
+	}
+
+	void PoolMemoryResource::ReleaseThreadCache(ThreadCache& cache)
+	{
+		for (std::size_t sizeClassIndex = 0; sizeClassIndex < SizeClassCount; ++sizeClassIndex)
+		{
+			if (cache.freeEntries[sizeClassIndex])
+				FreeToSizeClass(sizeClassIndex, cache.freeEntries[sizeClassIndex], std::make_index_sequence<SizeClassCount>());
+		}
+	}
+
+	void PoolMemoryResource::FlushThreadCache(ThreadCache& cache)
+	{
+		if (cache.resourceId != 0)
+		{
+			// The registry lock prevents the resource from being destroyed while its entries are given back
+			Registry& registry = GetRegistry();
+
+			std::lock_guard lock(registry.mutex);
+			auto it = std::find_if(registry.resources.begin(), registry.resources.end(), [&](const auto& pair) { return pair.first == cache.resourceId; });
+			if (it != registry.resources.end())
+				it->second->ReleaseThreadCache(cache);
+		}
+
+		cache.Clear();
+	}
+
+	auto PoolMemoryResource::GetRegistry() -> Registry&
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	std::size_t PoolMemoryResource::GetSizeClassIndex(std::size_t bytes, std::size_t alignment)
+	{
+		std::size_t size = std::max({ bytes, alignment, MinPooledSize });
+		if (size > MaxPooledSize)
+			return SizeClassCount;
+
+		return IntegralLog2Pot(RoundToPow2(size)) - IntegralLog2Pot(MinPooledSize);
+	}
+
+	auto PoolMemoryResource::GetThreadCache() -> ThreadCache&
+	{
+		thread_local ThreadCache cache;
+		return cache;
+	}
+
+	template<std::size_t Size>
+	PoolMemoryResource::SizeClass<Size>::SizeClass(std::pmr::memory_resource* upstream) :
+	pool(std::max<std::size_t>(PoolBlockByteSize / Size, 1), Allocator(upstream))
+	{
+	}
+
+	PoolMemoryResource::ThreadCache::~ThreadCache()
+	{
+		FlushThreadCache(*this);
+	}
+
+	void PoolMemoryResource::ThreadCache::Clear()
+	{
+		resourceId = 0;
+		freeEntries.fill(nullptr);
+		freeEntryCounts.fill(0);
+	}
+}
@@ -436,6 +436,24 @@
 
 #endif // NAZARA_NO_ARCH_DETECTION
 
+// Destructive interference size: data written by different threads should be this far apart to avoid false sharing (can be overridden)
+#ifndef NAZARA_CACHELINE_SIZE
+	#if defined(NAZARA_ARCH_aarch64) && (defined(NAZARA_PLATFORM_MACOS) || defined(NAZARA_PLATFORM_IOS))
+		// Apple ARM64 cores use 128 bytes cache lines
+		#define NAZARA_CACHELINE_SIZE 128
+	#elif defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64) || defined(NAZARA_ARCH_arm) || defined(NAZARA_ARCH_aarch64) || defined(NAZARA_ARCH_wasm32) || defined(NAZARA_ARCH_wasm64)
+		#define NAZARA_CACHELINE_SIZE 64
+	#else
+		// Unknown architecture, std::hardware_destructive_interference_size isn't preferred as its value isn't ABI-stable (see GCC -Winterference-size)
+		#include <new>
+		#if defined(__cpp_lib_hardware_interference_size)
+			#define NAZARA_CACHELINE_SIZE std::hardware_destructive_interference_size
+		#else
+			#define NAZARA_CACHELINE_SIZE 64
+		#endif
+	#endif
+#endif
+
 
 #ifdef NAZARA_UNITY_ID
 	#define NAZARA_ANONYMOUS_NAMESPACE NAZARA_UNITY_ID
@@ -0,0 +1,113 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_PROFILER_HPP
+#define NAZARAUTILS_PROFILER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Profiling macros compile to nothing unless NAZARA_PROFILING is defined (it must be defined the same way in every translation unit)
+#ifdef NAZARA_PROFILING
+	#define NazaraProfileCounter(name, value) Nz::Profiler::RecordCounter(name, static_cast<Nz::Int64>(value))
+	#define NazaraProfileScope(name) Nz::ProfileScope NazaraSuffixMacro(profileScope_, __LINE__)(name)
+	#define NazaraProfileThreadName(name) Nz::Profiler::SetCurrentThreadName(name)
+#else
+	#define NazaraProfileCounter(name, value) static_cast<void>(0)
+	#define NazaraProfileScope(name) static_cast<void>(0)
+	#define NazaraProfileThreadName(name) static_cast<void>(0)
+#endif
+
+// Number of events kept by each thread, older events are overwritten
+#ifndef NAZARA_PROFILER_EVENTS_PER_THREAD
+	#define NAZARA_PROFILER_EVENTS_PER_THREAD 8192
+#endif
+
+namespace Nz
+{
+	class Profiler
+	{
+		public:
+			Profiler() = delete;
+			~Profiler() = delete;
+
+			static inline void Clear();
+
+			static inline void ExportChromeTrace(std::ostream& stream);
+
+			static inline UInt64 ReadTimestamp() noexcept;
+			static inline void RecordCounter(const char* name, Int64 value) noexcept;
+			static inline void RecordZone(const char* name, UInt64 beginTimestamp, UInt64 endTimestamp) noexcept;
+
+			static inline void SetCurrentThreadName(std::string name);
+
+			static constexpr std::size_t EventsPerThread = NAZARA_PROFILER_EVENTS_PER_THREAD;
+
+		private:
+			static_assert((EventsPerThread & (EventsPerThread - 1)) == 0, "NAZARA_PROFILER_EVENTS_PER_THREAD must be a power of two");
+
+			// Every field is written with relaxed atomics, sequence acts as a per-event seqlock allowing to export while threads are recording
+			struct Event
+			{
+				std::atomic<UInt64> sequence;  //< (event index + 1) << 1 | counter flag, zero while being written
+				std::atomic<const char*> name; //< Must have static storage duration
+				std::atomic<UInt64> timestamp; //< Begin of zones, time of counters
+				std::atomic<UInt64> data;      //< End of zones, value of counters
+			};
+
+			struct ThreadBuffer
+			{
+				std::unique_ptr<Event[]> events = std::make_unique<Event[]>(EventsPerThread);
+				std::atomic<UInt64> head = 0;       //< Number of events ever recorded by the thread (only written by it)
+				std::atomic<UInt64> firstIndex = 0; //< Events before this index were cleared
+				std::string threadName;
+				UInt32 threadId;
+			};
+
+			struct State
+			{
+				std::mutex mutex;
+				std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+				UInt64 startTimestamp = ReadTimestamp();
+				UInt64 startTime = ReadClockNanoseconds();
+			};
+
+			static inline void AppendJsonString(std::string& output, std::string_view str);
+			static inline void AppendMicroseconds(std::string& output, Int64 nanoseconds);
+			static inline ThreadBuffer& GetThreadBuffer();
+			static inline State& GetState();
+			static inline UInt64 ReadClockNanoseconds();
+			static inline ThreadBuffer& RegisterThread();
+			static inline void Write(const char* name, UInt64 timestamp, UInt64 data, bool isCounter) noexcept;
+	};
+
+	class ProfileScope
+	{
+		public:
+			explicit ProfileScope(const char* name) noexcept : m_name(name), m_beginTimestamp(Profiler::ReadTimestamp()) {}
+			ProfileScope(const ProfileScope&) = delete;
+			ProfileScope(ProfileScope&&) = delete;
+			~ProfileScope() { Profiler::RecordZone(m_name, m_beginTimestamp, Profiler::ReadTimestamp()); }
+
+			ProfileScope& operator=(const ProfileScope&) = delete;
+			ProfileScope& operator=(ProfileScope&&) = delete;
+
+		private:
+			const char* m_name;
+			UInt64 m_beginTimestamp;
+	};
+}
+
+#include <NazaraUtils/Profiler.inl>
+
+#endif // NAZARAUTILS_PROFILER_HPP
@@ -0,0 +1,304 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <ostream>
+#include <thread>
+
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#endif
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::Profiler
+	* \brief Records profiling zones and counters of every thread in per-thread ring buffers, and exports them as a Chrome trace
+	*
+	* Each thread writes to its own buffer without any lock (the buffer is registered on the first event of the thread),
+	* keeping the last NAZARA_PROFILER_EVENTS_PER_THREAD events. Recording a zone costs two timestamp reads and a few stores.
+	*
+	* Events are usually recorded through the NazaraProfileScope and NazaraProfileCounter macros, which compile to nothing unless NAZARA_PROFILING is defined.
+	*
+	* \remark Zone and counter names are stored as pointers, they must have static storage duration (e.g. string literals)
+	* \remark Timestamps come from the CPU timestamp counter when available, which is expected to be invariant across cores
+	* \remark Thread buffers are never freed, as exporting must still be possible after a thread exited
+	*/
+
+	/*!
+	* \brief Discards every event recorded so far
+	*/
+	inline void Profiler::Clear()
+	{
+		State& state = GetState();
+
+		std::lock_guard lock(state.mutex);
+		for (auto& threadBuffer : state.threadBuffers)
+			threadBuffer->firstIndex.store(threadBuffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Writes every recorded event in the Chrome trace JSON format, which can be opened by Perfetto or chrome://tracing
+	*
+	* \param stream Output stream
+	*
+	* \remark Threads can keep recording events while this is running
+	*/
+	inline void Profiler::ExportChromeTrace(std::ostream& stream)
+	{
+		State& state = GetState();
+
+		std::lock_guard lock(state.mutex);
+
+		// Calibrate timestamps against the steady clock, over at least 10ms
+		constexpr UInt64 MinCalibrationDuration = 10'000'000;
+
+		UInt64 endTime;
+		while ((endTime = ReadClockNanoseconds()) - state.startTime < MinCalibrationDuration)
+			std::this_thread::yield();
+
+		UInt64 endTimestamp = ReadTimestamp();
+		double nanosecondsPerTick = double(endTime - state.startTime) / double(std::max<UInt64>(endTimestamp - state.startTimestamp, 1));
+
+		std::string output = R"({"displayTimeUnit":"ns","traceEvents":[)";
+		bool first = true;
+		auto BeginEvent = [&]
+		{
+			if (!first)
+				output += ',';
+
+			output += '\n';
+			first = false;
+		};
+
+		auto AppendTimestamp = [&](UInt64 timestamp)
+		{
+			AppendMicroseconds(output, static_cast<Int64>(double(static_cast<Int64>(timestamp - state.startTimestamp)) * nanosecondsPerTick));
+		};
+
+		for (auto& threadBuffer : state.threadBuffers)
+		{
+			std::string threadId = std::to_string(threadBuffer->threadId);
+
+			if (!threadBuffer->threadName.empty())
+			{
+				BeginEvent();
+				output += R"({"name":"thread_name","ph":"M","pid":0,"tid":)";
+				output += threadId;
+				output += R"(,"args":{"name":)";
+				AppendJsonString(output, threadBuffer->threadName);
+				output += "}}";
+			}
+
+			UInt64 head = threadBuffer->head.load(std::memory_order_acquire);
+			UInt64 firstIndex = threadBuffer->firstIndex.load(std::memory_order_relaxed);
+			if (head > EventsPerThread)
+				firstIndex = std::max(firstIndex, head - EventsPerThread);
+
+			for (UInt64 index = firstIndex; index < head; ++index)
+			{
+				Event& event = threadBuffer->events[index & (EventsPerThread - 1)];
+
+				UInt64 sequence = event.sequence.load(std::memory_order_acquire);
+				if ((sequence >> 1) != index + 1)
+					continue; //< overwritten (or being overwritten) by the thread
+
+				const char* name = event.name.load(std::memory_order_relaxed);
+				UInt64 timestamp = event.timestamp.load(std::memory_order_relaxed);
+				UInt64 data = event.data.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (event.sequence.load(std::memory_order_relaxed) != sequence)
+					continue;
+
+				BeginEvent();
+				output += R"({"name":)";
+				AppendJsonString(output, name);
+
+				if (sequence & 1)
+				{
+					output += R"(,"ph":"C","pid":0,"tid":)";
+					output += threadId;
+					output += R"(,"ts":)";
+					AppendTimestamp(timestamp);
+					output += R"(,"args":{"value":)";
+					output += std::to_string(static_cast<Int64>(data));
+					output += "}}";
+				}
+				else
+				{
+					output += R"(,"ph":"X","pid":0,"tid":)";
+					output += threadId;
+					output += R"(,"ts":)";
+					AppendTimestamp(timestamp);
+					output += R"(,"dur":)";
+					AppendMicroseconds(output, static_cast<Int64>(double(data - timestamp) * nanosecondsPerTick));
+					output += '}';
+				}
+			}
+		}
+
+		output += "\n]}\n";
+		stream.write(output.data(), static_cast<std::streamsize>(output.size()));
+	}
+
+	/*!
+	* \brief Reads the timestamp used by events (CPU ticks or nanoseconds, depending on the platform)
+	* \return Current timestamp
+	*/
+	inline UInt64 Profiler::ReadTimestamp() noexcept
+	{
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+		return __rdtsc();
+#elif defined(NAZARA_ARCH_aarch64) && !defined(NAZARA_COMPILER_MSVC)
+		UInt64 value;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+		return value;
+#else
+		return ReadClockNanoseconds();
+#endif
+	}
+
+	/*!
+	* \brief Records the value of a counter, displayed as a graph over time
+	*
+	* \param name Name of the counter, must have static storage duration
+	* \param value Value of the counter
+	*/
+	inline void Profiler::RecordCounter(const char* name, Int64 value) noexcept
+	{
+		Write(name, ReadTimestamp(), static_cast<UInt64>(value), true);
+	}
+
+	/*!
+	* \brief Records a zone (a named time range) of the current thread
+	*
+	* \param name Name of the zone, must have static storage duration
+	* \param beginTimestamp Timestamp at the beginning of the zone, as returned by ReadTimestamp
+	* \param endTimestamp Timestamp at the end of the zone, as returned by ReadTimestamp
+	*
+	* \see ProfileScope
+	*/
+	inline void Profiler::RecordZone(const char* name, UInt64 beginTimestamp, UInt64 endTimestamp) noexcept
+	{
+		Write(name, beginTimestamp, endTimestamp, false);
+	}
+
+	/*!
+	* \brief Names the current thread in exported traces
+	*
+	* \param name Name of the thread
+	*/
+	inline void Profiler::SetCurrentThreadName(std::string name)
+	{
+		ThreadBuffer& threadBuffer = GetThreadBuffer();
+
+		State& state = GetState();
+		std::lock_guard lock(state.mutex);
+		threadBuffer.threadName = std::move(name);
+	}
+
+	inline void Profiler::AppendJsonString(std::string& output, std::string_view str)
+	{
+		constexpr char HexDigits[] = "0123456789abcdef";
+
+		output += '"';
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\')
+			{
+				output += '\\';
+				output += c;
+			}
+			else if (static_cast<unsigned char>(c) < 0x20)
+			{
+				output += "\\u00";
+				output += HexDigits[(c >> 4) & 0xF];
+				output += HexDigits[c & 0xF];
+			}
+			else
+				output += c;
+		}
+		output += '"';
+	}
+
+	inline void Profiler::AppendMicroseconds(std::string& output, Int64 nanoseconds)
+	{
+		// Format manually instead of relying on locale-dependent floating-point formatting
+		if (nanoseconds < 0)
+		{
+			output += '-';
+			nanoseconds = -nanoseconds;
+		}
+
+		char buffer[24];
+		auto result = std::to_chars(buffer, buffer + sizeof(buffer), nanoseconds / 1000);
+		output.append(buffer, result.ptr);
+
+		Int64 fraction = nanoseconds % 1000;
+		output += '.';
+		output += static_cast<char>('0' + fraction / 100);
+		output += static_cast<char>('0' + (fraction / 10) % 10);
+		output += static_cast<char>('0' + fraction % 10);
+	}
+
+	inline auto Profiler::GetThreadBuffer() -> ThreadBuffer&
+	{
+		thread_local ThreadBuffer* threadBuffer = nullptr;
+		if NAZARA_UNLIKELY(!threadBuffer)
+			threadBuffer = &RegisterThread();
+
+		return *threadBuffer;
+	}
+
+	inline auto Profiler::GetState() -> State&
+	{
+		// Never destroyed, threads may still record events during static destruction
+		static State* state = new State;
+		return *state;
+	}
+
+	inline UInt64 Profiler::ReadClockNanoseconds()
+	{
+		return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	inline auto Profiler::RegisterThread() -> ThreadBuffer&
+	{
+		State& state = GetState();
+
+		std::lock_guard lock(state.mutex);
+
+		auto& threadBuffer = state.threadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+		threadBuffer->threadId = static_cast<UInt32>(state.threadBuffers.size());
+
+		return *threadBuffer;
+	}
+
+	inline void Profiler::Write(const char* name, UInt64 timestamp, UInt64 data, bool isCounter) noexcept
+	{
+		ThreadBuffer& threadBuffer = GetThreadBuffer();
+
+		UInt64 index = threadBuffer.head.load(std::memory_order_relaxed);
+		Event& event = threadBuffer.events[index & (EventsPerThread - 1)];
+
+		// Invalidate the event before overwriting it, so a concurrent export can detect a partially written event
+		event.sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		event.name.store(name, std::memory_order_relaxed);
+		event.timestamp.store(timestamp, std::memory_order_relaxed);
+		event.data.store(data, std::memory_order_relaxed);
+		event.sequence.store(((index + 1) << 1) | ((isCounter) ? 1 : 0), std::memory_order_release);
+
+		threadBuffer.head.store(index + 1, std::memory_order_release);
+	}
+}
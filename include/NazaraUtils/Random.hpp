@@ -0,0 +1,139 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_RANDOM_HPP
+#define NAZARAUTILS_RANDOM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/ConstantEvaluated.hpp>
+#include <array>
+#include <limits>
+
+namespace Nz
+{
+	// All engines satisfy UniformRandomBitGenerator and can be used with <random> distributions
+	class Pcg32
+	{
+		public:
+			using result_type = UInt32;
+
+			constexpr explicit Pcg32(UInt64 seed = DefaultSeed, UInt64 stream = DefaultStream) noexcept;
+			constexpr Pcg32(const Pcg32&) = default;
+			constexpr Pcg32(Pcg32&&) noexcept = default;
+			~Pcg32() = default;
+
+			constexpr void Advance(UInt64 delta) noexcept;
+
+			constexpr result_type Bounded(result_type bound) noexcept;
+
+			constexpr void Jump() noexcept;
+
+			constexpr void Seed(UInt64 seed, UInt64 stream = DefaultStream) noexcept;
+
+			constexpr result_type operator()() noexcept;
+
+			constexpr Pcg32& operator=(const Pcg32&) = default;
+			constexpr Pcg32& operator=(Pcg32&&) noexcept = default;
+
+			constexpr bool operator==(const Pcg32& rng) const noexcept;
+			constexpr bool operator!=(const Pcg32& rng) const noexcept;
+
+			static constexpr result_type max() noexcept;
+			static constexpr result_type min() noexcept;
+
+			static constexpr UInt64 DefaultSeed = 0x853C49E6748FEA9BULL;
+			static constexpr UInt64 DefaultStream = 0xDA3E39CB94B95BDBULL;
+
+		private:
+			static constexpr UInt64 Multiplier = 6364136223846793005ULL;
+
+			UInt64 m_state;
+			UInt64 m_increment;
+	};
+
+	class WyRand
+	{
+		public:
+			using result_type = UInt64;
+
+			constexpr explicit WyRand(UInt64 seed = DefaultSeed) noexcept;
+			constexpr WyRand(const WyRand&) = default;
+			constexpr WyRand(WyRand&&) noexcept = default;
+			~WyRand() = default;
+
+			constexpr void Advance(UInt64 delta) noexcept;
+
+			constexpr result_type Bounded(result_type bound) noexcept;
+
+			constexpr void Jump() noexcept;
+
+			constexpr void Seed(UInt64 seed) noexcept;
+
+			constexpr result_type operator()() noexcept;
+
+			constexpr WyRand& operator=(const WyRand&) = default;
+			constexpr WyRand& operator=(WyRand&&) noexcept = default;
+
+			constexpr bool operator==(const WyRand& rng) const noexcept;
+			constexpr bool operator!=(const WyRand& rng) const noexcept;
+
+			static constexpr result_type max() noexcept;
+			static constexpr result_type min() noexcept;
+
+			static constexpr UInt64 DefaultSeed = 0;
+
+		private:
+			static constexpr UInt64 Increment = 0xA0761D6478BD642FULL;
+
+			UInt64 m_state;
+	};
+
+	class Xoshiro256StarStar
+	{
+		public:
+			using result_type = UInt64;
+			using State = std::array<UInt64, 4>;
+
+			constexpr explicit Xoshiro256StarStar(UInt64 seed = DefaultSeed) noexcept;
+			constexpr explicit Xoshiro256StarStar(const State& state) noexcept;
+			constexpr Xoshiro256StarStar(const Xoshiro256StarStar&) = default;
+			constexpr Xoshiro256StarStar(Xoshiro256StarStar&&) noexcept = default;
+			~Xoshiro256StarStar() = default;
+
+			constexpr result_type Bounded(result_type bound) noexcept;
+
+			constexpr const State& GetState() const noexcept;
+
+			constexpr void Jump() noexcept;
+			constexpr void LongJump() noexcept;
+
+			constexpr void Seed(UInt64 seed) noexcept;
+
+			constexpr result_type operator()() noexcept;
+
+			constexpr Xoshiro256StarStar& operator=(const Xoshiro256StarStar&) = default;
+			constexpr Xoshiro256StarStar& operator=(Xoshiro256StarStar&&) noexcept = default;
+
+			constexpr bool operator==(const Xoshiro256StarStar& rng) const noexcept;
+			constexpr bool operator!=(const Xoshiro256StarStar& rng) const noexcept;
+
+			static constexpr result_type max() noexcept;
+			static constexpr result_type min() noexcept;
+
+			static constexpr UInt64 DefaultSeed = 0;
+
+		private:
+			constexpr void Jump(const State& polynomial) noexcept;
+
+			State m_state;
+	};
+
+	constexpr UInt64 SplitMix64(UInt64& state) noexcept;
+}
+
+#include <NazaraUtils/Random.inl>
+
+#endif // NAZARAUTILS_RANDOM_HPP
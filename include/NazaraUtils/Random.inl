@@ -0,0 +1,438 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <utility>
+
+#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_ARCH_x86_64)
+#include <intrin.h>
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Returns the low and high halves of the 128-bit product
+		constexpr std::pair<UInt64, UInt64> RandomMultiply(UInt64 x, UInt64 y) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			// __extension__ keeps -Wpedantic from warning about __int128
+			__extension__ unsigned __int128 product = static_cast<unsigned __int128>(x) * y;
+			return { static_cast<UInt64>(product), static_cast<UInt64>(product >> 64) };
+#else
+	#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_ARCH_x86_64)
+			if NAZARA_IS_RUNTIME_EVAL()
+				return { x * y, __umulh(x, y) };
+	#endif
+
+			UInt64 xLow = x & 0xFFFFFFFF;
+			UInt64 xHigh = x >> 32;
+			UInt64 yLow = y & 0xFFFFFFFF;
+			UInt64 yHigh = y >> 32;
+
+			UInt64 lowLow = xLow * yLow;
+			UInt64 lowHigh = xLow * yHigh;
+			UInt64 highLow = xHigh * yLow;
+			UInt64 highHigh = xHigh * yHigh;
+
+			UInt64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+			return { x * y, highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32) };
+#endif
+		}
+
+		constexpr UInt64 RandomRotateLeft(UInt64 value, unsigned int shift) noexcept
+		{
+			return (value << shift) | (value >> (64 - shift));
+		}
+
+		// https://lemire.me/blog/2016/06/30/fast-random-shuffling/
+		template<typename Rng>
+		constexpr typename Rng::result_type RandomBounded(Rng& rng, typename Rng::result_type bound) noexcept
+		{
+			using T = typename Rng::result_type;
+			static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+
+			assert(bound != 0);
+
+			// Multiplying by the bound maps the random value to [0, bound) (high part of the product), the low part
+			// tells whether this value belongs to one of the over-represented ranges, which requires a modulo only in this rare case
+			auto Multiply = [&](T value) -> std::pair<T, T>
+			{
+				if constexpr (sizeof(T) == 4)
+				{
+					UInt64 product = UInt64(value) * bound;
+					return { T(product), T(product >> 32) };
+				}
+				else
+					return RandomMultiply(value, bound);
+			};
+
+			std::pair<T, T> product = Multiply(rng());
+			if (product.first < bound)
+			{
+				T threshold = T(-bound) % bound;
+				while (product.first < threshold)
+					product = Multiply(rng());
+			}
+
+			return product.second;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::Pcg32
+	* \brief PCG32 (XSH-RR) random number generator, 16 bytes of state and 32 bits outputs
+	*
+	* Each of the 2^63 streams (selected at seeding time) is an independent sequence of period 2^64.
+	*
+	* \see https://www.pcg-random.org
+	*/
+
+	/*!
+	* \brief Seeds the generator, with the same results as the reference pcg32_srandom_r
+	*
+	* \param seed Initial state
+	* \param stream Sequence to use, generators with different streams produce different sequences even when using the same seed
+	*/
+	constexpr Pcg32::Pcg32(UInt64 seed, UInt64 stream) noexcept :
+	m_state(0),
+	m_increment(0)
+	{
+		Seed(seed, stream);
+	}
+
+	/*!
+	* \brief Advances the generator as if it generated delta values, in O(log(delta))
+	*
+	* \param delta Number of steps
+	*/
+	constexpr void Pcg32::Advance(UInt64 delta) noexcept
+	{
+		// Brown, "Random Number Generation with Arbitrary Stride"
+		UInt64 currentMultiplier = Multiplier;
+		UInt64 currentIncrement = m_increment;
+		UInt64 accumulatedMultiplier = 1;
+		UInt64 accumulatedIncrement = 0;
+		while (delta > 0)
+		{
+			if (delta & 1)
+			{
+				accumulatedMultiplier *= currentMultiplier;
+				accumulatedIncrement = accumulatedIncrement * currentMultiplier + currentIncrement;
+			}
+
+			currentIncrement = (currentMultiplier + 1) * currentIncrement;
+			currentMultiplier *= currentMultiplier;
+			delta >>= 1;
+		}
+
+		m_state = accumulatedMultiplier * m_state + accumulatedIncrement;
+	}
+
+	/*!
+	* \brief Generates a uniformly distributed integer in [0, bound)
+	* \return Random integer
+	*
+	* \param bound Exclusive upper bound, must not be zero
+	*
+	* \remark This uses Lemire's nearly divisionless method, which is unbiased and much faster than a modulo
+	*/
+	constexpr auto Pcg32::Bounded(result_type bound) noexcept -> result_type
+	{
+		return Detail::RandomBounded(*this, bound);
+	}
+
+	/*!
+	* \brief Advances the generator by 2^48 steps
+	*
+	* Calling Jump n times on copies of a generator gives 65536 non-overlapping sequences of 2^48 values, one per thread.
+	*/
+	constexpr void Pcg32::Jump() noexcept
+	{
+		Advance(UInt64(1) << 48);
+	}
+
+	constexpr void Pcg32::Seed(UInt64 seed, UInt64 stream) noexcept
+	{
+		m_state = 0;
+		m_increment = (stream << 1) | 1;
+		operator()();
+		m_state += seed;
+		operator()();
+	}
+
+	constexpr auto Pcg32::operator()() noexcept -> result_type
+	{
+		UInt64 oldState = m_state;
+		m_state = oldState * Multiplier + m_increment;
+
+		UInt32 xorShifted = static_cast<UInt32>(((oldState >> 18) ^ oldState) >> 27);
+		UInt32 rotation = static_cast<UInt32>(oldState >> 59);
+		return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+	}
+
+	constexpr bool Pcg32::operator==(const Pcg32& rng) const noexcept
+	{
+		return m_state == rng.m_state && m_increment == rng.m_increment;
+	}
+
+	constexpr bool Pcg32::operator!=(const Pcg32& rng) const noexcept
+	{
+		return !operator==(rng);
+	}
+
+	constexpr auto Pcg32::max() noexcept -> result_type
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	constexpr auto Pcg32::min() noexcept -> result_type
+	{
+		return 0;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::WyRand
+	* \brief wyrand random number generator, 8 bytes of state and 64 bits outputs
+	*
+	* wyrand is a Weyl sequence (a counter) mixed by a 128-bit multiplication, making it the fastest of the engines
+	* on 64-bit platforms with a period of 2^64.
+	*
+	* \see https://github.com/wangyi-fudan/wyhash
+	*/
+
+	constexpr WyRand::WyRand(UInt64 seed) noexcept :
+	m_state(seed)
+	{
+	}
+
+	/*!
+	* \brief Advances the generator as if it generated delta values, in O(1)
+	*
+	* \param delta Number of steps
+	*/
+	constexpr void WyRand::Advance(UInt64 delta) noexcept
+	{
+		m_state += delta * Increment;
+	}
+
+	/*!
+	* \brief Generates a uniformly distributed integer in [0, bound)
+	* \return Random integer
+	*
+	* \param bound Exclusive upper bound, must not be zero
+	*
+	* \remark This uses Lemire's nearly divisionless method, which is unbiased and much faster than a modulo
+	*/
+	constexpr auto WyRand::Bounded(result_type bound) noexcept -> result_type
+	{
+		return Detail::RandomBounded(*this, bound);
+	}
+
+	/*!
+	* \brief Advances the generator by 2^48 steps
+	*
+	* Calling Jump n times on copies of a generator gives 65536 non-overlapping sequences of 2^48 values, one per thread.
+	*/
+	constexpr void WyRand::Jump() noexcept
+	{
+		Advance(UInt64(1) << 48);
+	}
+
+	constexpr void WyRand::Seed(UInt64 seed) noexcept
+	{
+		m_state = seed;
+	}
+
+	constexpr auto WyRand::operator()() noexcept -> result_type
+	{
+		m_state += Increment;
+
+		auto [low, high] = Detail::RandomMultiply(m_state, m_state ^ 0xE7037ED1A0B428DBULL);
+		return low ^ high;
+	}
+
+	constexpr bool WyRand::operator==(const WyRand& rng) const noexcept
+	{
+		return m_state == rng.m_state;
+	}
+
+	constexpr bool WyRand::operator!=(const WyRand& rng) const noexcept
+	{
+		return !operator==(rng);
+	}
+
+	constexpr auto WyRand::max() noexcept -> result_type
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	constexpr auto WyRand::min() noexcept -> result_type
+	{
+		return 0;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::Xoshiro256StarStar
+	* \brief xoshiro256** random number generator, 32 bytes of state and 64 bits outputs
+	*
+	* This is a good general-purpose generator, with a period of 2^256 - 1 and jump functions to split it into
+	* non-overlapping sequences.
+	*
+	* \see https://prng.di.unimi.it
+	*/
+
+	/*!
+	* \brief Seeds the generator by expanding a 64-bit seed with SplitMix64, as recommended by the authors
+	*
+	* \param seed Seed
+	*/
+	constexpr Xoshiro256StarStar::Xoshiro256StarStar(UInt64 seed) noexcept :
+	m_state{}
+	{
+		Seed(seed);
+	}
+
+	/*!
+	* \brief Initializes the generator with a full state
+	*
+	* \param state Generator state, must not be all zeros
+	*/
+	constexpr Xoshiro256StarStar::Xoshiro256StarStar(const State& state) noexcept :
+	m_state(state)
+	{
+		assert(state[0] != 0 || state[1] != 0 || state[2] != 0 || state[3] != 0);
+	}
+
+	/*!
+	* \brief Generates a uniformly distributed integer in [0, bound)
+	* \return Random integer
+	*
+	* \param bound Exclusive upper bound, must not be zero
+	*
+	* \remark This uses Lemire's nearly divisionless method, which is unbiased and much faster than a modulo
+	*/
+	constexpr auto Xoshiro256StarStar::Bounded(result_type bound) noexcept -> result_type
+	{
+		return Detail::RandomBounded(*this, bound);
+	}
+
+	constexpr auto Xoshiro256StarStar::GetState() const noexcept -> const State&
+	{
+		return m_state;
+	}
+
+	/*!
+	* \brief Advances the generator by 2^128 steps
+	*
+	* Calling Jump n times on copies of a generator gives 2^128 non-overlapping sequences of 2^128 values, one per thread.
+	*
+	* \see LongJump
+	*/
+	constexpr void Xoshiro256StarStar::Jump() noexcept
+	{
+		Jump({ 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL });
+	}
+
+	/*!
+	* \brief Advances the generator by 2^192 steps
+	*
+	* This allows to give each machine (or process) a sequence of 2^192 values, which can be split further using Jump.
+	*
+	* \see Jump
+	*/
+	constexpr void Xoshiro256StarStar::LongJump() noexcept
+	{
+		Jump({ 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL });
+	}
+
+	constexpr void Xoshiro256StarStar::Seed(UInt64 seed) noexcept
+	{
+		for (UInt64& value : m_state)
+			value = SplitMix64(seed);
+	}
+
+	constexpr auto Xoshiro256StarStar::operator()() noexcept -> result_type
+	{
+		UInt64 result = Detail::RandomRotateLeft(m_state[1] * 5, 7) * 9;
+		UInt64 t = m_state[1] << 17;
+
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+
+		m_state[2] ^= t;
+		m_state[3] = Detail::RandomRotateLeft(m_state[3], 45);
+
+		return result;
+	}
+
+	constexpr bool Xoshiro256StarStar::operator==(const Xoshiro256StarStar& rng) const noexcept
+	{
+		for (std::size_t i = 0; i < m_state.size(); ++i)
+		{
+			if (m_state[i] != rng.m_state[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	constexpr bool Xoshiro256StarStar::operator!=(const Xoshiro256StarStar& rng) const noexcept
+	{
+		return !operator==(rng);
+	}
+
+	constexpr auto Xoshiro256StarStar::max() noexcept -> result_type
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	constexpr auto Xoshiro256StarStar::min() noexcept -> result_type
+	{
+		return 0;
+	}
+
+	constexpr void Xoshiro256StarStar::Jump(const State& polynomial) noexcept
+	{
+		State state = {};
+		for (UInt64 word : polynomial)
+		{
+			for (unsigned int bit = 0; bit < 64; ++bit)
+			{
+				if (word & (UInt64(1) << bit))
+				{
+					for (std::size_t i = 0; i < state.size(); ++i)
+						state[i] ^= m_state[i];
+				}
+
+				operator()();
+			}
+		}
+
+		m_state = state;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \brief SplitMix64 generator step, mostly useful to expand a seed into a bigger state
+	* \return Next random value
+	*
+	* \param state Generator state, incremented by the function
+	*/
+	constexpr UInt64 SplitMix64(UInt64& state) noexcept
+	{
+		UInt64 z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+}
@@ -8,10 +8,10 @@
 #define NAZARAUTILS_RESULT_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
-#include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
-#include <variant>
+#include <utility>
 
 #define NAZARA_TRY(expr) \
 	do \
@@ -30,6 +30,165 @@
 
 namespace Nz
 {
+	template<typename T> class MovablePtr;
+
+	// Types having an invalid "niche" value, which Result can use to tell errors apart instead of storing a tag
+	template<typename T>
+	struct ResultNiche
+	{
+		static constexpr bool Enabled = false;
+	};
+
+	template<typename T>
+	struct ResultNiche<T*>
+	{
+		static constexpr bool Enabled = true;
+
+		static constexpr T* GetValue() noexcept { return nullptr; }
+		static constexpr bool IsNiche(T* value) noexcept { return value == nullptr; }
+	};
+
+	template<typename T>
+	struct ResultNiche<MovablePtr<T>>
+	{
+		static constexpr bool Enabled = true;
+
+		static MovablePtr<T> GetValue() noexcept { return MovablePtr<T>(nullptr); }
+		static bool IsNiche(const MovablePtr<T>& value) noexcept { return value.Get() == nullptr; }
+	};
+
+	namespace Detail
+	{
+		struct ResultInPlaceError {};
+		struct ResultInPlaceValue {};
+		struct ResultVoidValue {};
+
+		// Tagged union of V and E, trivially copyable (and thus returned in registers by most ABIs) when both are
+		template<typename V, typename E, bool Trivial = std::is_trivially_copyable_v<V> && std::is_trivially_copyable_v<E>>
+		class ResultUnionStorage
+		{
+			public:
+				template<typename... Args> constexpr ResultUnionStorage(ResultInPlaceValue, Args&&... args) : m_value(std::forward<Args>(args)...), m_hasValue(true) {}
+				template<typename... Args> constexpr ResultUnionStorage(ResultInPlaceError, Args&&... args) : m_error(std::forward<Args>(args)...), m_hasValue(false) {}
+
+				constexpr E& GetError() & noexcept { return m_error; }
+				constexpr const E& GetError() const & noexcept { return m_error; }
+				constexpr E&& GetError() && noexcept { return std::move(m_error); }
+
+				constexpr V& GetValue() & noexcept { return m_value; }
+				constexpr const V& GetValue() const & noexcept { return m_value; }
+				constexpr V&& GetValue() && noexcept { return std::move(m_value); }
+
+				constexpr bool HasValue() const noexcept { return m_hasValue; }
+
+			private:
+				union
+				{
+					V m_value;
+					E m_error;
+				};
+				bool m_hasValue;
+		};
+
+		template<typename V, typename E>
+		class ResultUnionStorage<V, E, false>
+		{
+			public:
+				template<typename... Args> constexpr ResultUnionStorage(ResultInPlaceValue, Args&&... args) : m_value(std::forward<Args>(args)...), m_hasValue(true) {}
+				template<typename... Args> constexpr ResultUnionStorage(ResultInPlaceError, Args&&... args) : m_error(std::forward<Args>(args)...), m_hasValue(false) {}
+				ResultUnionStorage(const ResultUnionStorage& storage);
+				ResultUnionStorage(ResultUnionStorage&& storage) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_constructible_v<E>);
+				~ResultUnionStorage();
+
+				constexpr E& GetError() & noexcept { return m_error; }
+				constexpr const E& GetError() const & noexcept { return m_error; }
+				constexpr E&& GetError() && noexcept { return std::move(m_error); }
+
+				constexpr V& GetValue() & noexcept { return m_value; }
+				constexpr const V& GetValue() const & noexcept { return m_value; }
+				constexpr V&& GetValue() && noexcept { return std::move(m_value); }
+
+				constexpr bool HasValue() const noexcept { return m_hasValue; }
+
+				ResultUnionStorage& operator=(const ResultUnionStorage& storage);
+				ResultUnionStorage& operator=(ResultUnionStorage&& storage) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_assignable_v<V> && std::is_nothrow_move_constructible_v<E> && std::is_nothrow_move_assignable_v<E>);
+
+			private:
+				void Destroy() noexcept;
+
+				union
+				{
+					V m_value;
+					E m_error;
+				};
+				bool m_hasValue;
+		};
+
+		// V has a niche value and E is an empty type: the niche value of V marks an error and E takes no space
+		template<typename V, typename E>
+		class ResultNicheStorage : private E
+		{
+			public:
+				template<typename... Args> constexpr ResultNicheStorage(ResultInPlaceValue, Args&&... args);
+				template<typename... Args> constexpr ResultNicheStorage(ResultInPlaceError, Args&&... args) : E(std::forward<Args>(args)...), m_value(ResultNiche<V>::GetValue()) {}
+
+				constexpr E& GetError() & noexcept { return *this; }
+				constexpr const E& GetError() const & noexcept { return *this; }
+				constexpr E&& GetError() && noexcept { return std::move(*this); }
+
+				constexpr V& GetValue() & noexcept { return m_value; }
+				constexpr const V& GetValue() const & noexcept { return m_value; }
+				constexpr V&& GetValue() && noexcept { return std::move(m_value); }
+
+				constexpr bool HasValue() const noexcept { return !ResultNiche<V>::IsNiche(m_value); }
+
+			private:
+				V m_value;
+		};
+
+		template<typename V, typename E>
+		struct ResultStorageSelector
+		{
+			using Type = std::conditional_t<ResultNiche<V>::Enabled && std::is_empty_v<E> && !std::is_final_v<E> && std::is_trivially_default_constructible_v<E>, ResultNicheStorage<V, E>, ResultUnionStorage<V, E>>;
+		};
+
+		template<typename E>
+		struct ResultStorageSelector<void, E>
+		{
+			// No niche is used for the error: a null pointer is a valid error value, which must not be mistaken for a success
+			using Type = ResultUnionStorage<ResultVoidValue, E>;
+		};
+
+		template<typename V, typename E> using ResultStorage = typename ResultStorageSelector<V, E>::Type;
+
+		// Deletes copy and move operations of Result when its storage doesn't support them
+		template<bool Copy, bool Move> struct ResultEnableCopyMove {};
+
+		template<>
+		struct ResultEnableCopyMove<false, true>
+		{
+			ResultEnableCopyMove() = default;
+			ResultEnableCopyMove(const ResultEnableCopyMove&) = delete;
+			ResultEnableCopyMove(ResultEnableCopyMove&&) = default;
+
+			ResultEnableCopyMove& operator=(const ResultEnableCopyMove&) = delete;
+			ResultEnableCopyMove& operator=(ResultEnableCopyMove&&) = default;
+		};
+
+		template<>
+		struct ResultEnableCopyMove<false, false>
+		{
+			ResultEnableCopyMove() = default;
+			ResultEnableCopyMove(const ResultEnableCopyMove&) = delete;
+			ResultEnableCopyMove(ResultEnableCopyMove&&) = delete;
+
+			ResultEnableCopyMove& operator=(const ResultEnableCopyMove&) = delete;
+			ResultEnableCopyMove& operator=(ResultEnableCopyMove&&) = delete;
+		};
+
+		template<typename... T> using ResultCopyMoveBase = ResultEnableCopyMove<(std::is_copy_constructible_v<T> && ...), (std::is_move_constructible_v<T> && ...)>;
+	}
+
 	template<typename V>
 	struct ResultValue
 	{
@@ -54,7 +213,7 @@ namespace Nz
 	template<typename E> constexpr auto Err(E&& err);
 
 	template<typename V, typename E>
-	class Result
+	class Result : Detail::ResultCopyMoveBase<V, E>
 	{
 		static_assert(!std::is_void_v<E>, "error type cannot be void");
 
@@ -102,14 +261,13 @@ namespace Nz
 			constexpr void EnsureError() const;
 			constexpr void EnsureValue() const;
 
-			static constexpr std::size_t ValueIndex = 0;
-			static constexpr std::size_t ErrorIndex = 1;
+			template<typename R> static constexpr Detail::ResultStorage<V, E> ConvertStorage(R&& result);
 
-			std::variant<V, E> m_value;
+			Detail::ResultStorage<V, E> m_storage;
 	};
 
 	template<typename E>
-	class Result<void, E>
+	class Result<void, E> : Detail::ResultCopyMoveBase<E>
 	{
 		static_assert(!std::is_void_v<E>, "error type cannot be void");
 
@@ -148,7 +306,9 @@ namespace Nz
 		private:
 			constexpr void EnsureError() const;
 			
-			std::optional<E> m_error;
+			template<typename R> static constexpr Detail::ResultStorage<void, E> ConvertStorage(R&& result);
+
+			Detail::ResultStorage<void, E> m_storage;
 	};
 }
 
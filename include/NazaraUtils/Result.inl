@@ -2,11 +2,120 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cassert>
 #include <functional>
 #include <stdexcept>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename V, typename E>
+		ResultUnionStorage<V, E, false>::ResultUnionStorage(const ResultUnionStorage& storage) :
+		m_hasValue(storage.m_hasValue)
+		{
+			if (m_hasValue)
+				PlacementNew(&m_value, storage.m_value);
+			else
+				PlacementNew(&m_error, storage.m_error);
+		}
+
+		template<typename V, typename E>
+		ResultUnionStorage<V, E, false>::ResultUnionStorage(ResultUnionStorage&& storage) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_constructible_v<E>) :
+		m_hasValue(storage.m_hasValue)
+		{
+			if (m_hasValue)
+				PlacementNew(&m_value, std::move(storage.m_value));
+			else
+				PlacementNew(&m_error, std::move(storage.m_error));
+		}
+
+		template<typename V, typename E>
+		ResultUnionStorage<V, E, false>::~ResultUnionStorage()
+		{
+			Destroy();
+		}
+
+		template<typename V, typename E>
+		auto ResultUnionStorage<V, E, false>::operator=(const ResultUnionStorage& storage) -> ResultUnionStorage&
+		{
+			if (this == &storage)
+				return *this;
+
+			if (m_hasValue == storage.m_hasValue)
+			{
+				if (m_hasValue)
+					m_value = storage.m_value;
+				else
+					m_error = storage.m_error;
+			}
+			else
+			{
+				// Copy first so an exception leaves this storage untouched
+				ResultUnionStorage copy(storage);
+				*this = std::move(copy);
+			}
+
+			return *this;
+		}
+
+		template<typename V, typename E>
+		auto ResultUnionStorage<V, E, false>::operator=(ResultUnionStorage&& storage) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_assignable_v<V> && std::is_nothrow_move_constructible_v<E> && std::is_nothrow_move_assignable_v<E>) -> ResultUnionStorage&
+		{
+			if (this == &storage)
+				return *this;
+
+			if (m_hasValue == storage.m_hasValue)
+			{
+				if (m_hasValue)
+					m_value = std::move(storage.m_value);
+				else
+					m_error = std::move(storage.m_error);
+			}
+			else
+			{
+				Destroy();
+
+				m_hasValue = storage.m_hasValue;
+				if (m_hasValue)
+					PlacementNew(&m_value, std::move(storage.m_value));
+				else
+					PlacementNew(&m_error, std::move(storage.m_error));
+			}
+
+			return *this;
+		}
+
+		template<typename V, typename E>
+		void ResultUnionStorage<V, E, false>::Destroy() noexcept
+		{
+			if (m_hasValue)
+				PlacementDestroy(&m_value);
+			else
+				PlacementDestroy(&m_error);
+		}
+
+		template<typename V, typename E>
+		template<typename... Args>
+		constexpr ResultNicheStorage<V, E>::ResultNicheStorage(ResultInPlaceValue, Args&&... args) :
+		m_value(std::forward<Args>(args)...)
+		{
+			assert(!ResultNiche<V>::IsNiche(m_value) && "value cannot be the niche value of its type (such as a null pointer) when the error type is empty");
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ResultNiche
+	* \brief Customization point describing an invalid value of a type, which Result can use instead of storing whether it holds a value or an error
+	*
+	* It is used by Result<V, E> when E is an empty type, the niche value of V then means an error.
+	* Specializations must define Enabled to true, and provide static GetValue() and IsNiche(value) functions.
+	*
+	* \remark Specialized for pointers and MovablePtr, with nullptr as the niche value
+	*/
+
 	constexpr ResultValue<void> Ok()
 	{
 		return {};
@@ -32,59 +141,63 @@ namespace Nz
 
 	/************************************************************************/
 
+	/*!
+	* \ingroup utils
+	* \class Nz::Result
+	* \brief Holds either a value or an error
+	*
+	* Both are stored in a tagged union, which is trivially copyable and destructible when V and E are
+	* (a Result<UInt32, ErrorEnum> is as cheap to return as a UInt64). No tag is stored at all when V
+	* has a niche value (see ResultNiche) and E is an empty type.
+	*/
+
 	template<typename V, typename E>
 	template<typename T, typename>
 	constexpr Result<V, E>::Result(T&& value) :
-	m_value(std::in_place_index_t<ValueIndex>{}, std::forward<T>(value))
+	m_storage(Detail::ResultInPlaceValue{}, std::forward<T>(value))
 	{
 	}
 	
 	template<typename V, typename E>
 	template<typename T>
 	constexpr Result<V, E>::Result(ResultValue<T> value) :
-	m_value(std::in_place_index_t<ValueIndex>{}, std::forward<T>(value.value))
+	m_storage(Detail::ResultInPlaceValue{}, std::forward<T>(value.value))
 	{
 	}
 
 	template<typename V, typename E>
 	template<typename T>
 	constexpr Result<V, E>::Result(ResultError<T> error) :
-	m_value(std::in_place_index_t<ErrorIndex>{}, std::forward<T>(error.value))
+	m_storage(Detail::ResultInPlaceError{}, std::forward<T>(error.value))
 	{
 	}
 
 	template<typename V, typename E>
 	template<typename... Args>
 	constexpr Result<V, E>::Result(ValueTag, Args&&... args) :
-	m_value(std::in_place_index_t<ValueIndex>{}, std::forward<Args>(args)...)
+	m_storage(Detail::ResultInPlaceValue{}, std::forward<Args>(args)...)
 	{
 	}
 
 	template<typename V, typename E>
 	template<typename... Args>
 	constexpr Result<V, E>::Result(ErrorTag, Args&&... args) :
-	m_value(std::in_place_index_t<ErrorIndex>{}, std::forward<Args>(args)...)
+	m_storage(Detail::ResultInPlaceError{}, std::forward<Args>(args)...)
 	{
 	}
 
 	template<typename V, typename E>
 	template<typename V2, typename E2, typename>
-	constexpr Result<V, E>::Result(const Result<V2, E2>& result)
+	constexpr Result<V, E>::Result(const Result<V2, E2>& result) :
+	m_storage(ConvertStorage(result))
 	{
-		if (result.IsOk())
-			m_value.template emplace<ValueIndex>(result.GetValue());
-		else
-			m_value.template emplace<ErrorIndex>(result.GetError());
 	}
 
 	template<typename V, typename E>
 	template<typename V2, typename E2, typename>
-	constexpr Result<V, E>::Result(Result<V2, E2>&& result)
+	constexpr Result<V, E>::Result(Result<V2, E2>&& result) :
+	m_storage(ConvertStorage(std::move(result)))
 	{
-		if (result.IsOk())
-			m_value.template emplace<ValueIndex>(std::move(result).GetValue());
-		else
-			m_value.template emplace<ErrorIndex>(std::move(result).GetError());
 	}
 
 	template<typename V, typename E>
@@ -105,47 +218,47 @@ namespace Nz
 	constexpr E& Result<V, E>::GetError() &
 	{
 		EnsureError();
-		return std::get<ErrorIndex>(m_value);
+		return m_storage.GetError();
 	}
 
 	template<typename V, typename E>
 	constexpr const E& Result<V, E>::GetError() const &
 	{
 		EnsureError();
-		return std::get<ErrorIndex>(m_value);
+		return m_storage.GetError();
 	}
 
 	template<typename V, typename E>
 	constexpr E&& Result<V, E>::GetError() &&
 	{
 		EnsureError();
-		return std::get<ErrorIndex>(std::move(m_value));
+		return std::move(m_storage).GetError();
 	}
 
 	template<typename V, typename E>
 	constexpr bool Result<V, E>::IsErr() const noexcept
 	{
-		return m_value.index() == ErrorIndex;
+		return !m_storage.HasValue();
 	}
 
 	template<typename V, typename E>
 	constexpr bool Result<V, E>::IsOk() const noexcept
 	{
-		return m_value.index() == ValueIndex;
+		return m_storage.HasValue();
 	}
 
 	template<typename V, typename E>
 	constexpr V& Result<V, E>::GetValue() &
 	{
 		EnsureValue();
-		return std::get<ValueIndex>(m_value);
+		return m_storage.GetValue();
 	}
 
 	template<typename V, typename E>
 	constexpr const V& Result<V, E>::GetValue() const&
 	{
 		EnsureValue();
-		return std::get<ValueIndex>(m_value);
+		return m_storage.GetValue();
 	}
 	
 	/************************************************************************/
@@ -155,7 +268,7 @@ namespace Nz
 	constexpr V Result<V, E>::GetValueOr(T&& defaultValue) const &
 	{
 		if (IsOk())
-			return std::get<ValueIndex>(m_value);
+			return m_storage.GetValue();
 		else
 			return std::forward<T>(defaultValue);
 	}
@@ -165,7 +278,7 @@ namespace Nz
 	constexpr V Result<V, E>::GetValueOr(T&& defaultValue) &&
 	{
 		if (IsOk())
-			return std::get<ValueIndex>(std::move(m_value));
+			return std::move(m_storage).GetValue();
 		else
 			return std::forward<T>(defaultValue);
 	}
@@ -174,7 +287,7 @@ namespace Nz
 	constexpr V&& Result<V, E>::GetValue() &&
 	{
 		EnsureValue();
-		return std::get<ValueIndex>(std::move(m_value));
+		return std::move(m_storage).GetValue();
 	}
 
 	template<typename V, typename E>
@@ -225,80 +338,90 @@ namespace Nz
 		return IsOk();
 	}
 
+	template<typename V, typename E>
+	template<typename R>
+	constexpr Detail::ResultStorage<V, E> Result<V, E>::ConvertStorage(R&& result)
+	{
+		if (result.IsOk())
+			return Detail::ResultStorage<V, E>(Detail::ResultInPlaceValue{}, std::forward<R>(result).GetValue());
+		else
+			return Detail::ResultStorage<V, E>(Detail::ResultInPlaceError{}, std::forward<R>(result).GetError());
+	}
+
 	template<typename V, typename E>
 	constexpr void Result<V, E>::EnsureError() const
 	{
-		if (!IsErr())
+		if NAZARA_UNLIKELY(!IsErr())
 			throw std::runtime_error("Result is not an error");
 	}
 
 	template<typename V, typename E>
 	constexpr void Result<V, E>::EnsureValue() const
 	{
-		if (!IsOk())
+		if NAZARA_UNLIKELY(!IsOk())
 			throw std::runtime_error("Result is not a value");
 	}
 
 
 	template<typename E> 
-	constexpr Result<void, E>::Result(ResultValue<void>)
+	constexpr Result<void, E>::Result(ResultValue<void>) :
+	m_storage(Detail::ResultInPlaceValue{})
 	{
 	}
 
 	template<typename E>
 	template<typename T>
 	constexpr Result<void, E>::Result(ResultError<T> error) :
-	m_error(std::move(error.value))
+	m_storage(Detail::ResultInPlaceError{}, std::forward<T>(error.value))
 	{
 	}
 
 	template<typename E>
-	constexpr Result<void, E>::Result(ValueTag)
+	constexpr Result<void, E>::Result(ValueTag) :
+	m_storage(Detail::ResultInPlaceValue{})
 	{
 	}
 
 	template<typename E>
 	template<typename... Args>
 	constexpr Result<void, E>::Result(ErrorTag, Args&&... args) :
-	m_error(std::forward<Args>(args)...)
+	m_storage(Detail::ResultInPlaceError{}, std::forward<Args>(args)...)
 	{
 	}
 
 	template<typename E>
 	template<typename E2, typename>
-	constexpr Result<void, E>::Result(const Result<void, E2>& result)
+	constexpr Result<void, E>::Result(const Result<void, E2>& result) :
+	m_storage(ConvertStorage(result))
 	{
-		if (!result.IsOk())
-			m_error.emplace(result.GetError());
 	}
 	
 	template<typename E>
 	template<typename E2, typename>
-	constexpr Result<void, E>::Result(Result<void, E2>&& result)
+	constexpr Result<void, E>::Result(Result<void, E2>&& result) :
+	m_storage(ConvertStorage(std::move(result)))
 	{
-		if (!result.IsOk())
-			m_error.emplace(std::move(result).GetError());
 	}
 	
 	template<typename E>
 	constexpr E& Result<void, E>::GetError() &
 	{
 		EnsureError();
-		return *m_error;
+		return m_storage.GetError();
 	}
 
 	template<typename E>
 	constexpr const E& Result<void, E>::GetError() const &
 	{
 		EnsureError();
-		return *m_error;
+		return m_storage.GetError();
 	}
 
 	template<typename E>
 	constexpr E&& Result<void, E>::GetError() &&
 	{
 		EnsureError();
-		return *std::move(m_error);
+		return std::move(m_storage).GetError();
 	}
 
 	template<typename E>
@@ -318,7 +441,7 @@ namespace Nz
 	template<typename E>
 	constexpr bool Result<void, E>::IsErr() const noexcept
 	{
-		return m_error.has_value();
+		return !m_storage.HasValue();
 	}
 
 	template<typename E>
@@ -375,10 +498,20 @@ namespace Nz
 		return IsOk();
 	}
 
+	template<typename E>
+	template<typename R>
+	constexpr Detail::ResultStorage<void, E> Result<void, E>::ConvertStorage(R&& result)
+	{
+		if (result.IsOk())
+			return Detail::ResultStorage<void, E>(Detail::ResultInPlaceValue{});
+		else
+			return Detail::ResultStorage<void, E>(Detail::ResultInPlaceError{}, std::forward<R>(result).GetError());
+	}
+
 	template<typename E>
 	constexpr void Result<void, E>::EnsureError() const
 	{
-		if (!IsErr())
+		if NAZARA_UNLIKELY(!IsErr())
 			throw std::runtime_error("Result is not an error");
 	}
 
@@ -0,0 +1,178 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_RINGBUFFER_HPP
+#define NAZARAUTILS_RINGBUFFER_HPP
+
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity>
+	class RingBuffer
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+		public:
+			template<bool Const> class Iterator;
+
+			using value_type = T;
+			using const_iterator = Iterator<true>;
+			using const_pointer = const value_type*;
+			using const_reference = const value_type&;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+			using difference_type = std::ptrdiff_t;
+			using iterator = Iterator<false>;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using size_type = std::size_t;
+
+			constexpr RingBuffer();
+			constexpr RingBuffer(const RingBuffer& buffer);
+			constexpr RingBuffer(RingBuffer&& buffer) noexcept;
+			~RingBuffer();
+
+			template<typename InputIt>
+			constexpr void append(InputIt first, InputIt last);
+
+			constexpr std::pair<pointer, size_type> array_one() noexcept;
+			constexpr std::pair<const_pointer, size_type> array_one() const noexcept;
+			constexpr std::pair<pointer, size_type> array_two() noexcept;
+			constexpr std::pair<const_pointer, size_type> array_two() const noexcept;
+
+			constexpr reference back();
+			constexpr const_reference back() const;
+
+			constexpr iterator begin() noexcept;
+			constexpr const_iterator begin() const noexcept;
+
+			constexpr void clear() noexcept;
+
+			constexpr const_iterator cbegin() const noexcept;
+			constexpr const_iterator cend() const noexcept;
+			constexpr const_reverse_iterator crbegin() const noexcept;
+			constexpr const_reverse_iterator crend() const noexcept;
+
+			template<typename... Args>
+			constexpr reference emplace_back(Args&&... args);
+			template<typename... Args>
+			constexpr reference emplace_front(Args&&... args);
+
+			constexpr bool empty() const noexcept;
+
+			constexpr iterator end() noexcept;
+			constexpr const_iterator end() const noexcept;
+
+			constexpr reference front();
+			constexpr const_reference front() const;
+
+			constexpr bool full() const noexcept;
+
+			constexpr size_type max_size() const noexcept;
+
+			constexpr void pop_back();
+			constexpr void pop_front();
+			constexpr void pop_front(size_type count);
+
+			constexpr reference push_back(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value);
+			constexpr reference push_back(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value);
+			constexpr reference push_front(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value);
+			constexpr reference push_front(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+			constexpr reverse_iterator rbegin() noexcept;
+			constexpr const_reverse_iterator rbegin() const noexcept;
+
+			constexpr reverse_iterator rend() noexcept;
+			constexpr const_reverse_iterator rend() const noexcept;
+
+			constexpr size_type size() const noexcept;
+
+			constexpr reference operator[](size_type pos);
+			constexpr const_reference operator[](size_type pos) const;
+
+			constexpr RingBuffer& operator=(const RingBuffer& buffer);
+			constexpr RingBuffer& operator=(RingBuffer&& buffer) noexcept;
+
+			static constexpr size_type capacity() noexcept;
+
+		private:
+			constexpr T* GetSlot(size_type slot) noexcept;
+			constexpr const T* GetSlot(size_type slot) const noexcept;
+
+			static constexpr size_type Wrap(size_type index) noexcept;
+
+			static constexpr size_type Mask = Capacity - 1;
+
+			alignas(T) std::array<std::byte, sizeof(T) * Capacity> m_data;
+			size_type m_head;
+			size_type m_size;
+	};
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	class RingBuffer<T, Capacity>::Iterator
+	{
+		friend RingBuffer;
+		template<bool> friend class Iterator;
+
+		public:
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+			using pointer = std::conditional_t<Const, const T*, T*>;
+			using reference = std::conditional_t<Const, const T&, T&>;
+			using value_type = T;
+
+			constexpr Iterator() = default;
+			template<bool C = Const, typename = std::enable_if_t<C>> constexpr Iterator(const Iterator<false>& it) noexcept;
+			constexpr Iterator(const Iterator&) = default;
+			constexpr Iterator(Iterator&&) noexcept = default;
+
+			constexpr std::size_t GetIndex() const noexcept;
+
+			constexpr Iterator& operator=(const Iterator&) = default;
+			constexpr Iterator& operator=(Iterator&&) noexcept = default;
+
+			constexpr reference operator*() const;
+			constexpr pointer operator->() const;
+			constexpr reference operator[](difference_type n) const;
+
+			constexpr Iterator& operator++();
+			constexpr Iterator operator++(int);
+			constexpr Iterator& operator--();
+			constexpr Iterator operator--(int);
+
+			constexpr Iterator& operator+=(difference_type n);
+			constexpr Iterator& operator-=(difference_type n);
+			constexpr Iterator operator+(difference_type n) const;
+			constexpr Iterator operator-(difference_type n) const;
+			constexpr difference_type operator-(const Iterator& it) const;
+
+			constexpr bool operator==(const Iterator& it) const;
+			constexpr bool operator!=(const Iterator& it) const;
+			constexpr bool operator<(const Iterator& it) const;
+			constexpr bool operator<=(const Iterator& it) const;
+			constexpr bool operator>(const Iterator& it) const;
+			constexpr bool operator>=(const Iterator& it) const;
+
+		private:
+			using BufferPtr = std::conditional_t<Const, const RingBuffer*, RingBuffer*>;
+
+			constexpr Iterator(BufferPtr buffer, std::size_t index) noexcept;
+
+			BufferPtr m_buffer = nullptr;
+			std::size_t m_index = 0;
+	};
+}
+
+#include <NazaraUtils/RingBuffer.inl>
+
+#endif // NAZARAUTILS_RINGBUFFER_HPP
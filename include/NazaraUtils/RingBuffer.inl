@@ -0,0 +1,592 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class RingBuffer
+	* \brief Core class that represents an inplace double-ended queue with a compile-time power-of-two capacity
+	*
+	* Elements are stored in a circular array, pushing and popping at both ends is O(1) and never moves other elements.
+	* The stored elements span at most two contiguous arrays (see array_one and array_two), which can be used for bulk I/O.
+	*/
+
+	template<typename T, std::size_t Capacity>
+	constexpr RingBuffer<T, Capacity>::RingBuffer() :
+	m_head(0),
+	m_size(0)
+	{
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr RingBuffer<T, Capacity>::RingBuffer(const RingBuffer& buffer) :
+	RingBuffer()
+	{
+		operator=(buffer);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr RingBuffer<T, Capacity>::RingBuffer(RingBuffer&& buffer) noexcept :
+	RingBuffer()
+	{
+		operator=(std::move(buffer));
+	}
+
+	template<typename T, std::size_t Capacity>
+	RingBuffer<T, Capacity>::~RingBuffer()
+	{
+		clear();
+	}
+
+	/*!
+	* \brief Appends a range of elements at the back of the buffer
+	*
+	* \param first Iterator to the first element to append
+	* \param last Iterator past the last element to append
+	*
+	* \remark With forward iterators, this checks capacity once and copies the range in at most two bulk copies
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	constexpr void RingBuffer<T, Capacity>::append(InputIt first, InputIt last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			size_type count = std::distance(first, last);
+			assert(m_size + count <= Capacity);
+
+			size_type tail = Wrap(m_head + m_size);
+			size_type firstCount = std::min(count, Capacity - tail);
+
+			InputIt mid = std::next(first, firstCount);
+			std::uninitialized_copy(first, mid, GetSlot(tail));
+			m_size += firstCount;
+
+			std::uninitialized_copy(mid, last, GetSlot(0));
+			m_size += count - firstCount;
+		}
+		else
+		{
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+	}
+
+	/*!
+	* \brief Returns the first contiguous array of elements, starting with the front element
+	* \return Pointer to the front element and number of contiguous elements following it
+	*
+	* \see array_two
+	*/
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::array_one() noexcept -> std::pair<pointer, size_type>
+	{
+		return { GetSlot(m_head), std::min(m_size, Capacity - m_head) };
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::array_one() const noexcept -> std::pair<const_pointer, size_type>
+	{
+		return { GetSlot(m_head), std::min(m_size, Capacity - m_head) };
+	}
+
+	/*!
+	* \brief Returns the second contiguous array of elements, holding the elements which wrapped around the end of the storage
+	* \return Pointer to the first wrapped element and number of wrapped elements (may be zero)
+	*
+	* \see array_one
+	*/
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::array_two() noexcept -> std::pair<pointer, size_type>
+	{
+		return { GetSlot(0), m_size - std::min(m_size, Capacity - m_head) };
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::array_two() const noexcept -> std::pair<const_pointer, size_type>
+	{
+		return { GetSlot(0), m_size - std::min(m_size, Capacity - m_head) };
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::back() -> reference
+	{
+		assert(!empty());
+		return *GetSlot(Wrap(m_head + m_size - 1));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::back() const -> const_reference
+	{
+		assert(!empty());
+		return *GetSlot(Wrap(m_head + m_size - 1));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::begin() noexcept -> iterator
+	{
+		return iterator(this, 0);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::begin() const noexcept -> const_iterator
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr void RingBuffer<T, Capacity>::clear() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_type i = 0; i < m_size; ++i)
+				PlacementDestroy(GetSlot(Wrap(m_head + i)));
+		}
+
+		m_head = 0;
+		m_size = 0;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::cbegin() const noexcept -> const_iterator
+	{
+		return begin();
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::cend() const noexcept -> const_iterator
+	{
+		return end();
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::crbegin() const noexcept -> const_reverse_iterator
+	{
+		return rbegin();
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::crend() const noexcept -> const_reverse_iterator
+	{
+		return rend();
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	constexpr auto RingBuffer<T, Capacity>::emplace_back(Args&&... args) -> reference
+	{
+		assert(!full());
+		T* element = PlacementNew(GetSlot(Wrap(m_head + m_size)), std::forward<Args>(args)...);
+		m_size++;
+
+		return *element;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	constexpr auto RingBuffer<T, Capacity>::emplace_front(Args&&... args) -> reference
+	{
+		assert(!full());
+		size_type head = Wrap(m_head - 1);
+		T* element = PlacementNew(GetSlot(head), std::forward<Args>(args)...);
+		m_head = head;
+		m_size++;
+
+		return *element;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr bool RingBuffer<T, Capacity>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::end() noexcept -> iterator
+	{
+		return iterator(this, m_size);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::end() const noexcept -> const_iterator
+	{
+		return const_iterator(this, m_size);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::front() -> reference
+	{
+		assert(!empty());
+		return *GetSlot(m_head);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::front() const -> const_reference
+	{
+		assert(!empty());
+		return *GetSlot(m_head);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr bool RingBuffer<T, Capacity>::full() const noexcept
+	{
+		return m_size == Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::max_size() const noexcept -> size_type
+	{
+		return capacity();
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr void RingBuffer<T, Capacity>::pop_back()
+	{
+		assert(!empty());
+		PlacementDestroy(GetSlot(Wrap(m_head + --m_size)));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr void RingBuffer<T, Capacity>::pop_front()
+	{
+		assert(!empty());
+		PlacementDestroy(GetSlot(m_head));
+		m_head = Wrap(m_head + 1);
+		m_size--;
+	}
+
+	/*!
+	* \brief Removes multiple elements from the front of the buffer
+	*
+	* \param count Number of elements to remove, must be less or equal to the buffer size
+	*
+	* \remark Useful to release elements consumed through array_one/array_two
+	*/
+	template<typename T, std::size_t Capacity>
+	constexpr void RingBuffer<T, Capacity>::pop_front(size_type count)
+	{
+		assert(count <= m_size);
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_type i = 0; i < count; ++i)
+				PlacementDestroy(GetSlot(Wrap(m_head + i)));
+		}
+
+		m_head = Wrap(m_head + count);
+		m_size -= count;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::push_back(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value) -> reference
+	{
+		return emplace_back(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::push_back(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value) -> reference
+	{
+		return emplace_back(std::move(value));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::push_front(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value) -> reference
+	{
+		return emplace_front(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::push_front(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value) -> reference
+	{
+		return emplace_front(std::move(value));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::rbegin() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::rbegin() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::rend() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::rend() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::operator[](size_type pos) -> reference
+	{
+		assert(pos < m_size);
+		return *GetSlot(Wrap(m_head + pos));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::operator[](size_type pos) const -> const_reference
+	{
+		assert(pos < m_size);
+		return *GetSlot(Wrap(m_head + pos));
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::operator=(const RingBuffer& buffer) -> RingBuffer&
+	{
+		if (this == &buffer)
+			return *this;
+
+		clear();
+
+		// keep the same layout so both contiguous arrays are preserved
+		m_head = buffer.m_head;
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			auto [firstPtr, firstCount] = buffer.array_one();
+			auto [secondPtr, secondCount] = buffer.array_two();
+			std::memcpy(GetSlot(m_head), firstPtr, firstCount * sizeof(T));
+			std::memcpy(GetSlot(0), secondPtr, secondCount * sizeof(T));
+			m_size = buffer.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < buffer.m_size; ++i)
+				emplace_back(buffer[i]);
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::operator=(RingBuffer&& buffer) noexcept -> RingBuffer&
+	{
+		if (this == &buffer)
+			return *this;
+
+		clear();
+
+		m_head = buffer.m_head;
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			auto [firstPtr, firstCount] = buffer.array_one();
+			auto [secondPtr, secondCount] = buffer.array_two();
+			std::memcpy(GetSlot(m_head), firstPtr, firstCount * sizeof(T));
+			std::memcpy(GetSlot(0), secondPtr, secondCount * sizeof(T));
+			m_size = buffer.m_size;
+		}
+		else
+		{
+			for (size_type i = 0; i < buffer.m_size; ++i)
+				emplace_back(std::move(buffer[i]));
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::capacity() noexcept -> size_type
+	{
+		return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr T* RingBuffer<T, Capacity>::GetSlot(size_type slot) noexcept
+	{
+		return std::launder(reinterpret_cast<T*>(&m_data[0]) + slot);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr const T* RingBuffer<T, Capacity>::GetSlot(size_type slot) const noexcept
+	{
+		return std::launder(reinterpret_cast<const T*>(&m_data[0]) + slot);
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr auto RingBuffer<T, Capacity>::Wrap(size_type index) noexcept -> size_type
+	{
+		return index & Mask;
+	}
+
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr RingBuffer<T, Capacity>::Iterator<Const>::Iterator(BufferPtr buffer, std::size_t index) noexcept :
+	m_buffer(buffer),
+	m_index(index)
+	{
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	template<bool C, typename>
+	constexpr RingBuffer<T, Capacity>::Iterator<Const>::Iterator(const Iterator<false>& it) noexcept :
+	m_buffer(it.m_buffer),
+	m_index(it.m_index)
+	{
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr std::size_t RingBuffer<T, Capacity>::Iterator<Const>::GetIndex() const noexcept
+	{
+		return m_index;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator*() const -> reference
+	{
+		return (*m_buffer)[m_index];
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator->() const -> pointer
+	{
+		return &(*m_buffer)[m_index];
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator[](difference_type n) const -> reference
+	{
+		return (*m_buffer)[m_index + n];
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator++() -> Iterator&
+	{
+		++m_index;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator++(int) -> Iterator
+	{
+		Iterator it = *this;
+		++m_index;
+		return it;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator--() -> Iterator&
+	{
+		--m_index;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator--(int) -> Iterator
+	{
+		Iterator it = *this;
+		--m_index;
+		return it;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator+=(difference_type n) -> Iterator&
+	{
+		m_index += n;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator-=(difference_type n) -> Iterator&
+	{
+		m_index -= n;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator+(difference_type n) const -> Iterator
+	{
+		return Iterator(m_buffer, m_index + n);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator-(difference_type n) const -> Iterator
+	{
+		return Iterator(m_buffer, m_index - n);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr auto RingBuffer<T, Capacity>::Iterator<Const>::operator-(const Iterator& it) const -> difference_type
+	{
+		return static_cast<difference_type>(m_index) - static_cast<difference_type>(it.m_index);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator==(const Iterator& it) const
+	{
+		assert(m_buffer == it.m_buffer);
+		return m_index == it.m_index;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator!=(const Iterator& it) const
+	{
+		return !operator==(it);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator<(const Iterator& it) const
+	{
+		assert(m_buffer == it.m_buffer);
+		return m_index < it.m_index;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator<=(const Iterator& it) const
+	{
+		return !it.operator<(*this);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator>(const Iterator& it) const
+	{
+		return it.operator<(*this);
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<bool Const>
+	constexpr bool RingBuffer<T, Capacity>::Iterator<Const>::operator>=(const Iterator& it) const
+	{
+		return !operator<(it);
+	}
+}
@@ -0,0 +1,187 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_ROARINGBITSET_HPP
+#define NAZARAUTILS_ROARINGBITSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/BitKernels.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	template<class Allocator = std::allocator<UInt32>>
+	class RoaringBitset
+	{
+		public:
+			class BitIterator;
+			struct bits_const_iter_tag;
+
+			RoaringBitset();
+			explicit RoaringBitset(const Allocator& allocator);
+			RoaringBitset(const RoaringBitset& bitset) = default;
+			RoaringBitset(RoaringBitset&& bitset) noexcept = default;
+			~RoaringBitset() = default;
+
+			void Clear() noexcept;
+			std::size_t Count() const;
+
+			std::size_t FindFirst() const;
+			std::size_t FindNext(std::size_t bit) const;
+
+			std::size_t GetContainerCount() const;
+			std::size_t GetMemoryUsage() const;
+
+			constexpr bits_const_iter_tag IterBits() const noexcept;
+
+			void Optimize();
+
+			void PerformsAND(const RoaringBitset& a, const RoaringBitset& b);
+			void PerformsOR(const RoaringBitset& a, const RoaringBitset& b);
+			void PerformsXOR(const RoaringBitset& a, const RoaringBitset& b);
+
+			void Reset(UInt32 bit);
+			void Set(UInt32 bit, bool val = true);
+
+			bool Test(UInt32 bit) const;
+			bool TestAny() const;
+			bool TestNone() const;
+
+			template<typename Block = UInt32, class BitsetAllocator = std::allocator<Block>> Bitset<Block, BitsetAllocator> ToBitset() const;
+
+			RoaringBitset& operator=(const RoaringBitset& bitset) = default;
+			RoaringBitset& operator=(RoaringBitset&& bitset) noexcept = default;
+
+			RoaringBitset& operator&=(const RoaringBitset& bitset);
+			RoaringBitset& operator|=(const RoaringBitset& bitset);
+			RoaringBitset& operator^=(const RoaringBitset& bitset);
+
+			template<typename Block, class BitsetAllocator, std::size_t InlineBlockCount> static RoaringBitset FromBitset(const Bitset<Block, BitsetAllocator, InlineBlockCount>& bitset, const Allocator& allocator = Allocator());
+
+			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+			struct bits_const_iter_tag
+			{
+				constexpr BitIterator begin() const noexcept;
+				constexpr BitIterator end() const noexcept;
+
+				const RoaringBitset& bitsetRef;
+			};
+
+			template<class A> friend bool operator==(const RoaringBitset<A>& lhs, const RoaringBitset<A>& rhs);
+
+		private:
+			enum class ContainerType : UInt8
+			{
+				Array,  //< Sorted values, for sparse containers
+				Bitmap, //< One bit per value, for dense containers
+				Run     //< Sorted [start, length - 1] pairs, for clustered containers
+			};
+
+			struct Container;
+
+			using AllocatorTraits = std::allocator_traits<Allocator>;
+			using ArrayAllocator = typename AllocatorTraits::template rebind_alloc<UInt16>;
+			using BitmapAllocator = typename AllocatorTraits::template rebind_alloc<UInt64>;
+			using ContainerAllocator = typename AllocatorTraits::template rebind_alloc<Container>;
+
+			static constexpr std::size_t ArrayMaxCardinality = 4096;
+			static constexpr std::size_t BitmapWordCount = 1024;
+			static constexpr UInt32 ContainerBitCount = 65536;
+
+			using BitmapWords = std::array<UInt64, BitmapWordCount>;
+
+			std::size_t FindContainer(UInt16 key) const;
+			std::size_t FindFrom(std::size_t bit) const;
+			template<typename F> void PerformsOp(const RoaringBitset& a, const RoaringBitset& b, bool keepA, bool keepB, F&& op);
+
+			static bool ContainerAdd(Container& container, UInt16 value);
+			static void ContainerAnd(const Container& a, const Container& b, Container& result);
+			static std::size_t ContainerCountRuns(const Container& container);
+			static bool ContainerEquals(const Container& a, const Container& b);
+			static UInt32 ContainerFindFrom(const Container& container, UInt32 value);
+			static void ContainerFromBitmap(const UInt64* words, Container& result);
+			static void ContainerOptimize(Container& container);
+			static void ContainerOr(const Container& a, const Container& b, Container& result);
+			static bool ContainerRemove(Container& container, UInt16 value);
+			static bool ContainerTest(const Container& container, UInt16 value);
+			static void ContainerToBitmap(const Container& container, UInt64* words);
+			static void ContainerXor(const Container& a, const Container& b, Container& result);
+			static std::size_t FindRunUpperBound(const Container& container, UInt16 value);
+			static const UInt64* GetBitmapWords(const Container& container, BitmapWords& scratch);
+			static UInt32 NextClearBit(const UInt64* words, UInt32 bit);
+			static UInt32 NextSetBit(const UInt64* words, UInt32 bit);
+			static void SetBitRange(UInt64* words, UInt32 first, UInt32 last);
+
+			std::vector<Container, ContainerAllocator> m_containers; //< Sorted by key (upper 16 bits of values)
+	};
+
+	template<class Allocator>
+	struct RoaringBitset<Allocator>::Container
+	{
+		Container(UInt16 containerKey, const ContainerAllocator& allocator);
+
+		std::vector<UInt16, ArrayAllocator> values; //< Array and run storage
+		std::vector<UInt64, BitmapAllocator> bitmap; //< Bitmap storage
+		UInt32 cardinality;
+		UInt16 key;
+		ContainerType type;
+	};
+
+	template<class Allocator>
+	class RoaringBitset<Allocator>::BitIterator
+	{
+		friend RoaringBitset;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::size_t;
+
+			constexpr BitIterator(const BitIterator&) = default;
+			constexpr BitIterator(BitIterator&&) noexcept = default;
+
+			constexpr BitIterator& operator=(const BitIterator&) = default;
+			constexpr BitIterator& operator=(BitIterator&&) noexcept = default;
+
+			BitIterator operator++(int);
+			BitIterator& operator++();
+
+			constexpr bool operator==(const BitIterator& rhs) const;
+			constexpr bool operator!=(const BitIterator& rhs) const;
+			constexpr value_type operator*() const;
+
+		private:
+			constexpr BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex);
+
+			std::size_t m_bitIndex;
+			const RoaringBitset* m_owner;
+	};
+
+	template<class Allocator>
+	bool operator==(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs);
+
+	template<class Allocator>
+	bool operator!=(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs);
+
+	template<class Allocator>
+	RoaringBitset<Allocator> operator&(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs);
+
+	template<class Allocator>
+	RoaringBitset<Allocator> operator|(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs);
+
+	template<class Allocator>
+	RoaringBitset<Allocator> operator^(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs);
+}
+
+#include <NazaraUtils/RoaringBitset.inl>
+
+#endif // NAZARAUTILS_ROARINGBITSET_HPP
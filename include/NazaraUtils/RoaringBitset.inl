@@ -0,0 +1,1155 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::RoaringBitset
+	* \brief Core class that represents a compressed set of 32-bit values
+	*
+	* Values are split in containers of 65536 values sharing the same upper 16 bits, only non-empty containers are stored.
+	* Each container picks the cheapest representation for its content:
+	* - a sorted array of 16-bit values when it holds at most 4096 values
+	* - a bitmap of 65536 bits (8 KiB) when it holds more values
+	* - sorted runs of consecutive values, only chosen by Optimize when smaller than both other representations
+	*
+	* This uses a fraction of the memory of a Bitset for sparse or clustered sets of values, but testing and setting values is slower.
+	*
+	* \see Bitset
+	*/
+
+	/*!
+	* \brief Constructs an empty RoaringBitset object
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator>::RoaringBitset() :
+	RoaringBitset(Allocator())
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty RoaringBitset object using an allocator
+	*
+	* \param allocator Allocator used for the containers storage
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator>::RoaringBitset(const Allocator& allocator) :
+	m_containers(ContainerAllocator(allocator))
+	{
+	}
+
+	/*!
+	* \brief Removes every value of the bitset
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::Clear() noexcept
+	{
+		m_containers.clear();
+	}
+
+	/*!
+	* \brief Counts the number of values in the bitset
+	* \return Number of bits set to 1
+	*/
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::Count() const
+	{
+		std::size_t count = 0;
+		for (const Container& container : m_containers)
+			count += container.cardinality;
+
+		return count;
+	}
+
+	/*!
+	* \brief Finds the first bit set to one in the bitset
+	* \return The first value of the bitset, or npos if it is empty
+	*/
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::FindFirst() const
+	{
+		return FindFrom(0);
+	}
+
+	/*!
+	* \brief Finds the next enabled in the bitset
+	* \return Next value of the bitset or npos if all the following bits are disabled
+	*
+	* \param bit Index of the last bit found, which will not be treated by this function
+	*/
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::FindNext(std::size_t bit) const
+	{
+		return FindFrom(bit + 1);
+	}
+
+	/*!
+	* \brief Gets the number of containers
+	* \return Number of non-empty ranges of 65536 values
+	*/
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::GetContainerCount() const
+	{
+		return m_containers.size();
+	}
+
+	/*!
+	* \brief Gets the memory used by the bitset
+	* \return Number of bytes used by the object and its allocated storage
+	*/
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::GetMemoryUsage() const
+	{
+		std::size_t memoryUsage = sizeof(RoaringBitset) + m_containers.capacity() * sizeof(Container);
+		for (const Container& container : m_containers)
+			memoryUsage += container.values.capacity() * sizeof(UInt16) + container.bitmap.capacity() * sizeof(UInt64);
+
+		return memoryUsage;
+	}
+
+	template<class Allocator>
+	constexpr auto RoaringBitset<Allocator>::IterBits() const noexcept -> bits_const_iter_tag
+	{
+		return bits_const_iter_tag{ *this };
+	}
+
+	/*!
+	* \brief Converts each container to its smallest representation and releases unused memory
+	*
+	* This is the only way to get run containers, it is worth calling after building a bitset of clustered values.
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::Optimize()
+	{
+		for (Container& container : m_containers)
+			ContainerOptimize(container);
+
+		m_containers.shrink_to_fit();
+	}
+
+	/*!
+	* \brief Performs the "AND" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*
+	* \remark Both bitsets are allowed to be this one
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::PerformsAND(const RoaringBitset& a, const RoaringBitset& b)
+	{
+		PerformsOp(a, b, false, false, &ContainerAnd);
+	}
+
+	/*!
+	* \brief Performs the "OR" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*
+	* \remark Both bitsets are allowed to be this one
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::PerformsOR(const RoaringBitset& a, const RoaringBitset& b)
+	{
+		PerformsOp(a, b, true, true, &ContainerOr);
+	}
+
+	/*!
+	* \brief Performs the "XOR" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*
+	* \remark Both bitsets are allowed to be this one
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::PerformsXOR(const RoaringBitset& a, const RoaringBitset& b)
+	{
+		PerformsOp(a, b, true, true, &ContainerXor);
+	}
+
+	/*!
+	* \brief Removes a value from the bitset
+	*
+	* \param bit Value to remove
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::Reset(UInt32 bit)
+	{
+		Set(bit, false);
+	}
+
+	/*!
+	* \brief Adds or removes a value from the bitset
+	*
+	* \param bit Value to add or remove
+	* \param val True to add the value, false to remove it
+	*/
+	template<class Allocator>
+	void RoaringBitset<Allocator>::Set(UInt32 bit, bool val)
+	{
+		UInt16 key = static_cast<UInt16>(bit >> 16);
+		UInt16 value = static_cast<UInt16>(bit & 0xFFFF);
+
+		std::size_t containerIndex = FindContainer(key);
+		bool found = (containerIndex < m_containers.size() && m_containers[containerIndex].key == key);
+		if (val)
+		{
+			if (!found)
+				m_containers.emplace(m_containers.begin() + containerIndex, key, m_containers.get_allocator());
+
+			ContainerAdd(m_containers[containerIndex], value);
+		}
+		else if (found)
+		{
+			Container& container = m_containers[containerIndex];
+			if (ContainerRemove(container, value) && container.cardinality == 0)
+				m_containers.erase(m_containers.begin() + containerIndex);
+		}
+	}
+
+	/*!
+	* \brief Tests if a value is in the bitset
+	* \return true if bit is set
+	*
+	* \param bit Value to test
+	*/
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::Test(UInt32 bit) const
+	{
+		UInt16 key = static_cast<UInt16>(bit >> 16);
+
+		std::size_t containerIndex = FindContainer(key);
+		if (containerIndex >= m_containers.size() || m_containers[containerIndex].key != key)
+			return false;
+
+		return ContainerTest(m_containers[containerIndex], static_cast<UInt16>(bit & 0xFFFF));
+	}
+
+	/*!
+	* \brief Tests if one bit is set
+	* \return true if the bitset is not empty
+	*/
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::TestAny() const
+	{
+		return !m_containers.empty();
+	}
+
+	/*!
+	* \brief Tests if no bit is set
+	* \return true if the bitset is empty
+	*/
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::TestNone() const
+	{
+		return m_containers.empty();
+	}
+
+	/*!
+	* \brief Converts the bitset to an uncompressed Bitset
+	* \return Bitset with the same bits set, its size being the greatest value + 1
+	*/
+	template<class Allocator>
+	template<typename Block, class BitsetAllocator>
+	Bitset<Block, BitsetAllocator> RoaringBitset<Allocator>::ToBitset() const
+	{
+		static_assert(BitCount<UInt64>() % BitCount<Block>() == 0, "Block must not be larger than 64 bits");
+		constexpr std::size_t bitsPerBlock = BitCount<Block>();
+		constexpr std::size_t blocksPerWord = BitCount<UInt64>() / bitsPerBlock;
+
+		Bitset<Block, BitsetAllocator> bitset;
+		if (m_containers.empty())
+			return bitset;
+
+		// Find the last value to size the bitset
+		const Container& lastContainer = m_containers.back();
+		BitmapWords scratch;
+		const UInt64* lastWords = GetBitmapWords(lastContainer, scratch);
+
+		std::size_t lastWordIndex = BitmapWordCount - 1;
+		while (lastWords[lastWordIndex] == 0)
+			lastWordIndex--;
+
+		std::size_t lastBit = lastWordIndex * BitCount<UInt64>() + IntegralLog2(lastWords[lastWordIndex]);
+		bitset.Resize((std::size_t(lastContainer.key) << 16) + lastBit + 1, false);
+
+		std::size_t blockCount = bitset.GetBlockCount();
+		for (const Container& container : m_containers)
+		{
+			const UInt64* words = GetBitmapWords(container, scratch);
+
+			std::size_t firstBlock = (std::size_t(container.key) << 16) / bitsPerBlock;
+			for (std::size_t i = 0; i < BitmapWordCount; ++i)
+			{
+				if (words[i] == 0)
+					continue;
+
+				for (std::size_t j = 0; j < blocksPerWord; ++j)
+				{
+					std::size_t blockIndex = firstBlock + i * blocksPerWord + j;
+					if (blockIndex >= blockCount)
+						break;
+
+					bitset.SetBlock(blockIndex, static_cast<Block>(words[i] >> (j * bitsPerBlock)));
+				}
+			}
+		}
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs an "AND" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator>& RoaringBitset<Allocator>::operator&=(const RoaringBitset& bitset)
+	{
+		PerformsAND(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs an "OR" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator>& RoaringBitset<Allocator>::operator|=(const RoaringBitset& bitset)
+	{
+		PerformsOR(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs an "XOR" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator>& RoaringBitset<Allocator>::operator^=(const RoaringBitset& bitset)
+	{
+		PerformsXOR(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Builds a compressed bitset from an uncompressed one
+	* \return Optimized RoaringBitset with the same bits set
+	*
+	* \param bitset Bitset to compress, its size must fit in 32 bits
+	* \param allocator Allocator used for the containers storage
+	*/
+	template<class Allocator>
+	template<typename Block, class BitsetAllocator, std::size_t InlineBlockCount>
+	auto RoaringBitset<Allocator>::FromBitset(const Bitset<Block, BitsetAllocator, InlineBlockCount>& bitset, const Allocator& allocator) -> RoaringBitset
+	{
+		static_assert(BitCount<UInt64>() % BitCount<Block>() == 0, "Block must not be larger than 64 bits");
+		constexpr std::size_t bitsPerBlock = BitCount<Block>();
+		constexpr std::size_t blocksPerContainer = ContainerBitCount / bitsPerBlock;
+
+		assert(bitset.GetSize() <= std::size_t(std::numeric_limits<UInt32>::max()) + 1 && "Bitset is too large");
+
+		RoaringBitset roaringBitset(allocator);
+
+		std::size_t blockCount = bitset.GetBlockCount();
+		for (std::size_t firstBlock = 0; firstBlock < blockCount; firstBlock += blocksPerContainer)
+		{
+			BitmapWords words = {};
+
+			bool empty = true;
+			std::size_t lastBlock = std::min(firstBlock + blocksPerContainer, blockCount);
+			for (std::size_t i = firstBlock; i < lastBlock; ++i)
+			{
+				if (Block block = bitset.GetBlock(i))
+				{
+					std::size_t bitIndex = (i - firstBlock) * bitsPerBlock;
+					words[bitIndex / BitCount<UInt64>()] |= UInt64(block) << (bitIndex % BitCount<UInt64>());
+					empty = false;
+				}
+			}
+
+			if (empty)
+				continue;
+
+			Container& container = roaringBitset.m_containers.emplace_back(static_cast<UInt16>(firstBlock / blocksPerContainer), roaringBitset.m_containers.get_allocator());
+			ContainerFromBitmap(words.data(), container);
+			ContainerOptimize(container);
+		}
+
+		return roaringBitset;
+	}
+
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::FindContainer(UInt16 key) const
+	{
+		auto it = std::lower_bound(m_containers.begin(), m_containers.end(), key, [](const Container& container, UInt16 k) { return container.key < k; });
+		return static_cast<std::size_t>(it - m_containers.begin());
+	}
+
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::FindFrom(std::size_t bit) const
+	{
+		if (bit > std::numeric_limits<UInt32>::max())
+			return npos;
+
+		UInt16 key = static_cast<UInt16>(bit >> 16);
+		for (std::size_t i = FindContainer(key); i < m_containers.size(); ++i)
+		{
+			const Container& container = m_containers[i];
+
+			UInt32 value = ContainerFindFrom(container, (container.key == key) ? UInt32(bit & 0xFFFF) : 0);
+			if (value < ContainerBitCount)
+				return (std::size_t(container.key) << 16) | value;
+		}
+
+		return npos;
+	}
+
+	template<class Allocator>
+	template<typename F>
+	void RoaringBitset<Allocator>::PerformsOp(const RoaringBitset& a, const RoaringBitset& b, bool keepA, bool keepB, F&& op)
+	{
+		// Build in a separate vector as a and b may be this bitset
+		std::vector<Container, ContainerAllocator> containers(m_containers.get_allocator());
+
+		std::size_t i = 0;
+		std::size_t j = 0;
+		while (i < a.m_containers.size() && j < b.m_containers.size())
+		{
+			const Container& aContainer = a.m_containers[i];
+			const Container& bContainer = b.m_containers[j];
+			if (aContainer.key < bContainer.key)
+			{
+				if (keepA)
+					containers.push_back(aContainer);
+
+				i++;
+			}
+			else if (bContainer.key < aContainer.key)
+			{
+				if (keepB)
+					containers.push_back(bContainer);
+
+				j++;
+			}
+			else
+			{
+				Container result(aContainer.key, m_containers.get_allocator());
+				op(aContainer, bContainer, result);
+				if (result.cardinality > 0)
+					containers.push_back(std::move(result));
+
+				i++;
+				j++;
+			}
+		}
+
+		if (keepA)
+			containers.insert(containers.end(), a.m_containers.begin() + i, a.m_containers.end());
+
+		if (keepB)
+			containers.insert(containers.end(), b.m_containers.begin() + j, b.m_containers.end());
+
+		m_containers = std::move(containers);
+	}
+
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::ContainerAdd(Container& container, UInt16 value)
+	{
+		switch (container.type)
+		{
+			case ContainerType::Array:
+			{
+				auto it = std::lower_bound(container.values.begin(), container.values.end(), value);
+				if (it != container.values.end() && *it == value)
+					return false;
+
+				if (container.values.size() < ArrayMaxCardinality)
+				{
+					container.values.insert(it, value);
+					container.cardinality++;
+					return true;
+				}
+
+				// Array is full, switch to a bitmap
+				container.bitmap.resize(BitmapWordCount);
+				ContainerToBitmap(container, container.bitmap.data());
+				container.type = ContainerType::Bitmap;
+				container.values.clear();
+				container.values.shrink_to_fit();
+				[[fallthrough]];
+			}
+
+			case ContainerType::Bitmap:
+			{
+				UInt64& word = container.bitmap[value / 64];
+				UInt64 mask = UInt64(1) << (value % 64);
+				if (word & mask)
+					return false;
+
+				word |= mask;
+				container.cardinality++;
+				return true;
+			}
+
+			case ContainerType::Run:
+			{
+				std::size_t runCount = container.values.size() / 2;
+				std::size_t nextRun = FindRunUpperBound(container, value);
+				if (nextRun > 0)
+				{
+					std::size_t previousRun = nextRun - 1;
+					UInt32 previousEnd = UInt32(container.values[previousRun * 2]) + container.values[previousRun * 2 + 1];
+					if (value <= previousEnd)
+						return false;
+
+					if (value == previousEnd + 1)
+					{
+						container.values[previousRun * 2 + 1]++;
+
+						// Merge with next run if we filled the gap
+						if (nextRun < runCount && UInt32(container.values[nextRun * 2]) == UInt32(value) + 1)
+						{
+							container.values[previousRun * 2 + 1] += container.values[nextRun * 2 + 1] + 1;
+							container.values.erase(container.values.begin() + nextRun * 2, container.values.begin() + nextRun * 2 + 2);
+						}
+
+						container.cardinality++;
+						return true;
+					}
+				}
+
+				if (nextRun < runCount && UInt32(container.values[nextRun * 2]) == UInt32(value) + 1)
+				{
+					container.values[nextRun * 2] = value;
+					container.values[nextRun * 2 + 1]++;
+				}
+				else
+				{
+					UInt16 run[] = { value, 0 };
+					container.values.insert(container.values.begin() + nextRun * 2, std::begin(run), std::end(run));
+				}
+
+				container.cardinality++;
+				return true;
+			}
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerAnd(const Container& a, const Container& b, Container& result)
+	{
+		if (a.type == ContainerType::Array || b.type == ContainerType::Array)
+		{
+			result.type = ContainerType::Array;
+			if (a.type == ContainerType::Array && b.type == ContainerType::Array)
+				std::set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(result.values));
+			else
+			{
+				const Container& arrayContainer = (a.type == ContainerType::Array) ? a : b;
+				const Container& otherContainer = (a.type == ContainerType::Array) ? b : a;
+				for (UInt16 value : arrayContainer.values)
+				{
+					if (ContainerTest(otherContainer, value))
+						result.values.push_back(value);
+				}
+			}
+
+			result.cardinality = static_cast<UInt32>(result.values.size());
+			return;
+		}
+
+		BitmapWords aScratch;
+		BitmapWords bScratch;
+		const UInt64* aWords = GetBitmapWords(a, aScratch);
+		const UInt64* bWords = GetBitmapWords(b, bScratch);
+
+		BitmapWords words;
+		BitKernels::And(words.data(), aWords, bWords, sizeof(words));
+
+		ContainerFromBitmap(words.data(), result);
+	}
+
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::ContainerCountRuns(const Container& container)
+	{
+		switch (container.type)
+		{
+			case ContainerType::Array:
+			{
+				std::size_t runCount = 0;
+				for (std::size_t i = 0; i < container.values.size(); ++i)
+				{
+					if (i == 0 || container.values[i] != container.values[i - 1] + 1)
+						runCount++;
+				}
+
+				return runCount;
+			}
+
+			case ContainerType::Bitmap:
+			{
+				// Count bits set whose previous bit is not set (beginning of a run)
+				std::size_t runCount = 0;
+				UInt64 carry = 0;
+				for (UInt64 word : container.bitmap)
+				{
+					runCount += CountBits(word & ~((word << 1) | carry));
+					carry = word >> 63;
+				}
+
+				return runCount;
+			}
+
+			case ContainerType::Run:
+				return container.values.size() / 2;
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::ContainerEquals(const Container& a, const Container& b)
+	{
+		if (a.cardinality != b.cardinality)
+			return false;
+
+		if (a.type == b.type)
+		{
+			if (a.type == ContainerType::Bitmap)
+				return a.bitmap == b.bitmap;
+			else
+				return a.values == b.values;
+		}
+
+		BitmapWords aScratch;
+		BitmapWords bScratch;
+		const UInt64* aWords = GetBitmapWords(a, aScratch);
+		const UInt64* bWords = GetBitmapWords(b, bScratch);
+
+		return std::memcmp(aWords, bWords, sizeof(BitmapWords)) == 0;
+	}
+
+	template<class Allocator>
+	UInt32 RoaringBitset<Allocator>::ContainerFindFrom(const Container& container, UInt32 value)
+	{
+		assert(value < ContainerBitCount);
+
+		switch (container.type)
+		{
+			case ContainerType::Array:
+			{
+				auto it = std::lower_bound(container.values.begin(), container.values.end(), static_cast<UInt16>(value));
+				return (it != container.values.end()) ? *it : ContainerBitCount;
+			}
+
+			case ContainerType::Bitmap:
+				return NextSetBit(container.bitmap.data(), value);
+
+			case ContainerType::Run:
+			{
+				std::size_t nextRun = FindRunUpperBound(container, static_cast<UInt16>(value));
+				if (nextRun > 0 && value <= UInt32(container.values[nextRun * 2 - 2]) + container.values[nextRun * 2 - 1])
+					return value;
+
+				return (nextRun < container.values.size() / 2) ? container.values[nextRun * 2] : ContainerBitCount;
+			}
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerFromBitmap(const UInt64* words, Container& result)
+	{
+		result.cardinality = static_cast<UInt32>(BitKernels::Count(words, sizeof(BitmapWords)));
+		result.values.clear();
+
+		if (result.cardinality <= ArrayMaxCardinality)
+		{
+			result.type = ContainerType::Array;
+			result.values.reserve(result.cardinality);
+			for (std::size_t i = 0; i < BitmapWordCount; ++i)
+			{
+				UInt64 word = words[i];
+				while (word != 0)
+				{
+					result.values.push_back(static_cast<UInt16>(i * 64 + FindFirstBit(word) - 1));
+					word &= word - 1;
+				}
+			}
+
+			result.bitmap.clear();
+			result.bitmap.shrink_to_fit();
+		}
+		else
+		{
+			result.type = ContainerType::Bitmap;
+			result.bitmap.assign(words, words + BitmapWordCount);
+		}
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerOptimize(Container& container)
+	{
+		std::size_t runSize = ContainerCountRuns(container) * 2 * sizeof(UInt16);
+		std::size_t arraySize = (container.cardinality <= ArrayMaxCardinality) ? container.cardinality * sizeof(UInt16) : std::numeric_limits<std::size_t>::max();
+		std::size_t bitmapSize = BitmapWordCount * sizeof(UInt64);
+
+		if (runSize < std::min(arraySize, bitmapSize))
+		{
+			if (container.type != ContainerType::Run)
+			{
+				BitmapWords scratch;
+				const UInt64* words = GetBitmapWords(container, scratch);
+
+				std::vector<UInt16, ArrayAllocator> runs(container.values.get_allocator());
+				runs.reserve(runSize / sizeof(UInt16));
+
+				UInt32 bit = NextSetBit(words, 0);
+				while (bit < ContainerBitCount)
+				{
+					UInt32 runEnd = NextClearBit(words, bit);
+					runs.push_back(static_cast<UInt16>(bit));
+					runs.push_back(static_cast<UInt16>(runEnd - bit - 1));
+
+					bit = (runEnd < ContainerBitCount) ? NextSetBit(words, runEnd) : ContainerBitCount;
+				}
+
+				container.values = std::move(runs);
+				container.bitmap.clear();
+				container.type = ContainerType::Run;
+			}
+		}
+		else if (container.type == ContainerType::Run)
+		{
+			BitmapWords words;
+			ContainerToBitmap(container, words.data());
+			ContainerFromBitmap(words.data(), container);
+		}
+
+		container.values.shrink_to_fit();
+		container.bitmap.shrink_to_fit();
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerOr(const Container& a, const Container& b, Container& result)
+	{
+		if (a.type == ContainerType::Array && b.type == ContainerType::Array && a.cardinality + b.cardinality <= ArrayMaxCardinality)
+		{
+			result.type = ContainerType::Array;
+			std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(result.values));
+			result.cardinality = static_cast<UInt32>(result.values.size());
+			return;
+		}
+
+		BitmapWords aScratch;
+		BitmapWords bScratch;
+		const UInt64* aWords = GetBitmapWords(a, aScratch);
+		const UInt64* bWords = GetBitmapWords(b, bScratch);
+
+		BitmapWords words;
+		BitKernels::Or(words.data(), aWords, bWords, sizeof(words));
+
+		ContainerFromBitmap(words.data(), result);
+	}
+
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::ContainerRemove(Container& container, UInt16 value)
+	{
+		switch (container.type)
+		{
+			case ContainerType::Array:
+			{
+				auto it = std::lower_bound(container.values.begin(), container.values.end(), value);
+				if (it == container.values.end() || *it != value)
+					return false;
+
+				container.values.erase(it);
+				container.cardinality--;
+				return true;
+			}
+
+			case ContainerType::Bitmap:
+			{
+				UInt64& word = container.bitmap[value / 64];
+				UInt64 mask = UInt64(1) << (value % 64);
+				if ((word & mask) == 0)
+					return false;
+
+				word &= ~mask;
+				container.cardinality--;
+
+				// Switch back to an array once it's small enough
+				if (container.cardinality <= ArrayMaxCardinality)
+				{
+					BitmapWords words;
+					std::copy(container.bitmap.begin(), container.bitmap.end(), words.begin());
+					ContainerFromBitmap(words.data(), container);
+				}
+
+				return true;
+			}
+
+			case ContainerType::Run:
+			{
+				std::size_t nextRun = FindRunUpperBound(container, value);
+				if (nextRun == 0)
+					return false;
+
+				std::size_t run = nextRun - 1;
+				UInt16 runStart = container.values[run * 2];
+				UInt16 runLength = container.values[run * 2 + 1];
+				UInt32 runEnd = UInt32(runStart) + runLength;
+				if (value > runEnd)
+					return false;
+
+				if (runLength == 0)
+					container.values.erase(container.values.begin() + run * 2, container.values.begin() + run * 2 + 2);
+				else if (value == runStart)
+				{
+					container.values[run * 2]++;
+					container.values[run * 2 + 1]--;
+				}
+				else if (value == runEnd)
+					container.values[run * 2 + 1]--;
+				else
+				{
+					// Split the run in two
+					container.values[run * 2 + 1] = static_cast<UInt16>(value - runStart - 1);
+
+					UInt16 nextRunValues[] = { static_cast<UInt16>(value + 1), static_cast<UInt16>(runEnd - value - 1) };
+					container.values.insert(container.values.begin() + run * 2 + 2, std::begin(nextRunValues), std::end(nextRunValues));
+				}
+
+				container.cardinality--;
+				return true;
+			}
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	template<class Allocator>
+	bool RoaringBitset<Allocator>::ContainerTest(const Container& container, UInt16 value)
+	{
+		switch (container.type)
+		{
+			case ContainerType::Array:
+				return std::binary_search(container.values.begin(), container.values.end(), value);
+
+			case ContainerType::Bitmap:
+				return (container.bitmap[value / 64] & (UInt64(1) << (value % 64))) != 0;
+
+			case ContainerType::Run:
+			{
+				std::size_t nextRun = FindRunUpperBound(container, value);
+				return nextRun > 0 && value <= UInt32(container.values[nextRun * 2 - 2]) + container.values[nextRun * 2 - 1];
+			}
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerToBitmap(const Container& container, UInt64* words)
+	{
+		switch (container.type)
+		{
+			case ContainerType::Array:
+			{
+				std::fill(words, words + BitmapWordCount, UInt64(0));
+				for (UInt16 value : container.values)
+					words[value / 64] |= UInt64(1) << (value % 64);
+
+				break;
+			}
+
+			case ContainerType::Bitmap:
+				std::copy(container.bitmap.begin(), container.bitmap.end(), words);
+				break;
+
+			case ContainerType::Run:
+			{
+				std::fill(words, words + BitmapWordCount, UInt64(0));
+				for (std::size_t i = 0; i < container.values.size(); i += 2)
+					SetBitRange(words, container.values[i], UInt32(container.values[i]) + container.values[i + 1]);
+
+				break;
+			}
+		}
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::ContainerXor(const Container& a, const Container& b, Container& result)
+	{
+		if (a.type == ContainerType::Array && b.type == ContainerType::Array && a.cardinality + b.cardinality <= ArrayMaxCardinality)
+		{
+			result.type = ContainerType::Array;
+			std::set_symmetric_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(result.values));
+			result.cardinality = static_cast<UInt32>(result.values.size());
+			return;
+		}
+
+		BitmapWords aScratch;
+		BitmapWords bScratch;
+		const UInt64* aWords = GetBitmapWords(a, aScratch);
+		const UInt64* bWords = GetBitmapWords(b, bScratch);
+
+		BitmapWords words;
+		BitKernels::Xor(words.data(), aWords, bWords, sizeof(words));
+
+		ContainerFromBitmap(words.data(), result);
+	}
+
+	template<class Allocator>
+	std::size_t RoaringBitset<Allocator>::FindRunUpperBound(const Container& container, UInt16 value)
+	{
+		// Returns the index of the first run starting after value
+		std::size_t first = 0;
+		std::size_t last = container.values.size() / 2;
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			if (container.values[mid * 2] <= value)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+
+		return first;
+	}
+
+	template<class Allocator>
+	const UInt64* RoaringBitset<Allocator>::GetBitmapWords(const Container& container, BitmapWords& scratch)
+	{
+		if (container.type == ContainerType::Bitmap)
+			return container.bitmap.data();
+
+		ContainerToBitmap(container, scratch.data());
+		return scratch.data();
+	}
+
+	template<class Allocator>
+	UInt32 RoaringBitset<Allocator>::NextClearBit(const UInt64* words, UInt32 bit)
+	{
+		std::size_t wordIndex = bit / 64;
+		UInt64 word = ~words[wordIndex] & (~UInt64(0) << (bit % 64));
+		while (word == 0)
+		{
+			if (++wordIndex >= BitmapWordCount)
+				return ContainerBitCount;
+
+			word = ~words[wordIndex];
+		}
+
+		return static_cast<UInt32>(wordIndex * 64 + FindFirstBit(word) - 1);
+	}
+
+	template<class Allocator>
+	UInt32 RoaringBitset<Allocator>::NextSetBit(const UInt64* words, UInt32 bit)
+	{
+		std::size_t wordIndex = bit / 64;
+		UInt64 word = words[wordIndex] & (~UInt64(0) << (bit % 64));
+		while (word == 0)
+		{
+			if (++wordIndex >= BitmapWordCount)
+				return ContainerBitCount;
+
+			word = words[wordIndex];
+		}
+
+		return static_cast<UInt32>(wordIndex * 64 + FindFirstBit(word) - 1);
+	}
+
+	template<class Allocator>
+	void RoaringBitset<Allocator>::SetBitRange(UInt64* words, UInt32 first, UInt32 last)
+	{
+		std::size_t firstWord = first / 64;
+		std::size_t lastWord = last / 64;
+		UInt64 firstMask = ~UInt64(0) << (first % 64);
+		UInt64 lastMask = ~UInt64(0) >> (63 - last % 64);
+
+		if (firstWord == lastWord)
+			words[firstWord] |= firstMask & lastMask;
+		else
+		{
+			words[firstWord] |= firstMask;
+			for (std::size_t i = firstWord + 1; i < lastWord; ++i)
+				words[i] = ~UInt64(0);
+
+			words[lastWord] |= lastMask;
+		}
+	}
+
+
+	template<class Allocator>
+	RoaringBitset<Allocator>::Container::Container(UInt16 containerKey, const ContainerAllocator& allocator) :
+	values(ArrayAllocator(allocator)),
+	bitmap(BitmapAllocator(allocator)),
+	cardinality(0),
+	key(containerKey),
+	type(ContainerType::Array)
+	{
+	}
+
+
+	template<class Allocator>
+	constexpr auto RoaringBitset<Allocator>::bits_const_iter_tag::begin() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, bitsetRef.FindFirst());
+	}
+
+	template<class Allocator>
+	constexpr auto RoaringBitset<Allocator>::bits_const_iter_tag::end() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, bitsetRef.npos);
+	}
+
+
+	template<class Allocator>
+	constexpr RoaringBitset<Allocator>::BitIterator::BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex) :
+	m_bitIndex(bitIndex),
+	m_owner(&bitsetTag.bitsetRef)
+	{
+	}
+
+	template<class Allocator>
+	auto RoaringBitset<Allocator>::BitIterator::operator++(int) -> BitIterator
+	{
+		BitIterator copy(*this);
+		++copy;
+		return copy;
+	}
+
+	template<class Allocator>
+	auto RoaringBitset<Allocator>::BitIterator::operator++() -> BitIterator&
+	{
+		m_bitIndex = m_owner->FindNext(m_bitIndex);
+		return *this;
+	}
+
+	template<class Allocator>
+	constexpr bool RoaringBitset<Allocator>::BitIterator::operator==(const BitIterator& rhs) const
+	{
+		return m_bitIndex == rhs.m_bitIndex;
+	}
+
+	template<class Allocator>
+	constexpr bool RoaringBitset<Allocator>::BitIterator::operator!=(const BitIterator& rhs) const
+	{
+		return m_bitIndex != rhs.m_bitIndex;
+	}
+
+	template<class Allocator>
+	constexpr auto RoaringBitset<Allocator>::BitIterator::operator*() const -> value_type
+	{
+		return m_bitIndex;
+	}
+
+
+	/*!
+	* \brief Compares two bitsets
+	* \return true if the two bitsets hold the same values, regardless of their containers representation
+	*
+	* \param lhs First bitset to compare with
+	* \param rhs Other bitset to compare with
+	*/
+	template<class Allocator>
+	bool operator==(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs)
+	{
+		if (lhs.m_containers.size() != rhs.m_containers.size())
+			return false;
+
+		for (std::size_t i = 0; i < lhs.m_containers.size(); ++i)
+		{
+			if (lhs.m_containers[i].key != rhs.m_containers[i].key)
+				return false;
+
+			if (!RoaringBitset<Allocator>::ContainerEquals(lhs.m_containers[i], rhs.m_containers[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Compares two bitsets
+	* \return false if the two bitsets hold the same values
+	*
+	* \param lhs First bitset to compare with
+	* \param rhs Other bitset to compare with
+	*/
+	template<class Allocator>
+	bool operator!=(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	/*!
+	* \brief Performs the operator "AND" between two bitsets
+	* \return The result of operator "AND"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator> operator&(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs)
+	{
+		RoaringBitset<Allocator> bitset;
+		bitset.PerformsAND(lhs, rhs);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs the operator "OR" between two bitsets
+	* \return The result of operator "OR"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator> operator|(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs)
+	{
+		RoaringBitset<Allocator> bitset;
+		bitset.PerformsOR(lhs, rhs);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs the operator "XOR" between two bitsets
+	* \return The result of operator "XOR"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<class Allocator>
+	RoaringBitset<Allocator> operator^(const RoaringBitset<Allocator>& lhs, const RoaringBitset<Allocator>& rhs)
+	{
+		RoaringBitset<Allocator> bitset;
+		bitset.PerformsXOR(lhs, rhs);
+
+		return bitset;
+	}
+}
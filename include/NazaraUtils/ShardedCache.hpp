@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SHARDEDCACHE_HPP
+#define NAZARAUTILS_SHARDEDCACHE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/CacheAligned.hpp>
+#include <NazaraUtils/SyncPrimitives.hpp>
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace Nz
+{
+	template<typename Cache, std::size_t ShardCount = 16, typename Mutex = FutexMutex>
+	class ShardedCache
+	{
+		static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "shard count must be a power of two");
+
+		public:
+			using hasher = typename Cache::hasher;
+			using key_type = typename Cache::key_type;
+			using mapped_type = typename Cache::mapped_type;
+
+			explicit ShardedCache(std::size_t capacity);
+			ShardedCache(const ShardedCache&) = delete;
+			ShardedCache(ShardedCache&&) = delete;
+			~ShardedCache() = default;
+
+			void Clear();
+			bool Contains(const key_type& key) const;
+
+			bool Erase(const key_type& key);
+
+			std::optional<mapped_type> Get(const key_type& key);
+			template<typename F> bool Get(const key_type& key, F&& func);
+			std::size_t GetCapacity() const;
+			std::size_t GetCost() const;
+			std::size_t GetSize() const;
+
+			void Put(const key_type& key, mapped_type value, std::size_t cost = 1);
+
+			void SetCapacity(std::size_t capacity);
+
+			ShardedCache& operator=(const ShardedCache&) = delete;
+			ShardedCache& operator=(ShardedCache&&) = delete;
+
+		private:
+			struct Shard
+			{
+				mutable Mutex mutex;
+				Cache cache{ 0 };
+			};
+
+			Shard& GetShard(const key_type& key);
+			const Shard& GetShard(const key_type& key) const;
+
+			std::array<CacheAligned<Shard>, ShardCount> m_shards;
+	};
+}
+
+#include <NazaraUtils/ShardedCache.inl>
+
+#endif // NAZARAUTILS_SHARDEDCACHE_HPP
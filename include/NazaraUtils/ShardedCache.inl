@@ -0,0 +1,213 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <mutex>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ShardedCache
+	* \brief Thread-safe cache made of ShardCount caches (LruCache or ClockCache), each protected by its own mutex
+	*
+	* Keys are spread over the shards by hash, threads accessing different shards never contend.
+	* The capacity is split evenly between the shards and each shard evicts its own entries: a shard receiving more keys than the others evicts earlier.
+	*
+	* \remark Values are returned by copy (or accessed through a callback called under the shard lock), as another thread may evict them at any time
+	* \see ClockCache, LruCache
+	*/
+
+	/*!
+	* \brief Constructs an empty cache
+	*
+	* \param capacity Maximum total cost of the entries, split between the shards
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	ShardedCache<Cache, ShardCount, Mutex>::ShardedCache(std::size_t capacity)
+	{
+		SetCapacity(capacity);
+	}
+
+	/*!
+	* \brief Removes every entry from every shard
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	void ShardedCache<Cache, ShardCount, Mutex>::Clear()
+	{
+		for (CacheAligned<Shard>& shard : m_shards)
+		{
+			std::lock_guard lock(shard->mutex);
+			shard->cache.Clear();
+		}
+	}
+
+	/*!
+	* \brief Checks if the cache has an entry for a key, without marking it as used
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	bool ShardedCache<Cache, ShardCount, Mutex>::Contains(const key_type& key) const
+	{
+		const Shard& shard = GetShard(key);
+
+		std::lock_guard lock(shard.mutex);
+		return shard.cache.Contains(key);
+	}
+
+	/*!
+	* \brief Removes the entry of a key
+	* \return True if the key had an entry
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	bool ShardedCache<Cache, ShardCount, Mutex>::Erase(const key_type& key)
+	{
+		Shard& shard = GetShard(key);
+
+		std::lock_guard lock(shard.mutex);
+		return shard.cache.Erase(key);
+	}
+
+	/*!
+	* \brief Gets a copy of the value of a key, marking it as used
+	* \return Copy of the value, or std::nullopt if the key has no entry
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	auto ShardedCache<Cache, ShardCount, Mutex>::Get(const key_type& key) -> std::optional<mapped_type>
+	{
+		Shard& shard = GetShard(key);
+
+		std::lock_guard lock(shard.mutex);
+		if (mapped_type* value = shard.cache.Get(key))
+			return *value;
+
+		return std::nullopt;
+	}
+
+	/*!
+	* \brief Calls a function with the value of a key, marking it as used
+	* \return True if the key had an entry (and the function was called)
+	*
+	* \param key Key of the entry
+	* \param func Function called as func(mapped_type&) while the shard is locked, it must not access the cache
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	template<typename F>
+	bool ShardedCache<Cache, ShardCount, Mutex>::Get(const key_type& key, F&& func)
+	{
+		Shard& shard = GetShard(key);
+
+		std::lock_guard lock(shard.mutex);
+		mapped_type* value = shard.cache.Get(key);
+		if (!value)
+			return false;
+
+		func(*value);
+		return true;
+	}
+
+	/*!
+	* \brief Returns the maximum total cost of the entries (of every shard)
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	std::size_t ShardedCache<Cache, ShardCount, Mutex>::GetCapacity() const
+	{
+		std::size_t capacity = 0;
+		for (const CacheAligned<Shard>& shard : m_shards)
+		{
+			std::lock_guard lock(shard->mutex);
+			capacity += shard->cache.GetCapacity();
+		}
+
+		return capacity;
+	}
+
+	/*!
+	* \brief Returns the total cost of the entries (of every shard)
+	*
+	* \remark Shards are locked one after the other, the result may be outdated if other threads are modifying the cache
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	std::size_t ShardedCache<Cache, ShardCount, Mutex>::GetCost() const
+	{
+		std::size_t cost = 0;
+		for (const CacheAligned<Shard>& shard : m_shards)
+		{
+			std::lock_guard lock(shard->mutex);
+			cost += shard->cache.GetCost();
+		}
+
+		return cost;
+	}
+
+	/*!
+	* \brief Returns the number of entries (of every shard)
+	*
+	* \remark Shards are locked one after the other, the result may be outdated if other threads are modifying the cache
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	std::size_t ShardedCache<Cache, ShardCount, Mutex>::GetSize() const
+	{
+		std::size_t size = 0;
+		for (const CacheAligned<Shard>& shard : m_shards)
+		{
+			std::lock_guard lock(shard->mutex);
+			size += shard->cache.GetSize();
+		}
+
+		return size;
+	}
+
+	/*!
+	* \brief Inserts or replaces the entry of a key, evicting entries of its shard exceeding the shard capacity
+	*
+	* \param key Key of the entry
+	* \param value Value of the entry
+	* \param cost Cost of the entry, counted against the capacity
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	void ShardedCache<Cache, ShardCount, Mutex>::Put(const key_type& key, mapped_type value, std::size_t cost)
+	{
+		Shard& shard = GetShard(key);
+
+		std::lock_guard lock(shard.mutex);
+		shard.cache.Put(key, std::move(value), cost);
+	}
+
+	/*!
+	* \brief Changes the capacity of the cache, split between the shards (rounded up)
+	*
+	* \param capacity Maximum total cost of the entries
+	*/
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	void ShardedCache<Cache, ShardCount, Mutex>::SetCapacity(std::size_t capacity)
+	{
+		std::size_t shardCapacity = (capacity + ShardCount - 1) / ShardCount;
+		for (CacheAligned<Shard>& shard : m_shards)
+		{
+			std::lock_guard lock(shard->mutex);
+			shard->cache.SetCapacity(shardCapacity);
+		}
+	}
+
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	auto ShardedCache<Cache, ShardCount, Mutex>::GetShard(const key_type& key) -> Shard&
+	{
+		return const_cast<Shard&>(std::as_const(*this).GetShard(key));
+	}
+
+	template<typename Cache, std::size_t ShardCount, typename Mutex>
+	auto ShardedCache<Cache, ShardCount, Mutex>::GetShard(const key_type& key) const -> const Shard&
+	{
+		if constexpr (ShardCount == 1)
+			return *m_shards[0];
+		else
+		{
+			// Use the upper bits of a differently mixed hash, so that keys of a shard don't share the lower bits used by the hash map of the shard
+			UInt64 hash = Detail::WyMix(static_cast<UInt64>(hasher{}(key)), 0xE7037ED1A0B428DBull);
+			return *m_shards[static_cast<std::size_t>(hash >> (64 - IntegralLog2Pot(ShardCount)))];
+		}
+	}
+}
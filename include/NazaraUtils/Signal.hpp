@@ -7,7 +7,9 @@
 #ifndef NAZARAUTILS_SIGNAL_HPP
 #define NAZARAUTILS_SIGNAL_HPP
 
-#include <functional>
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -27,7 +29,7 @@ namespace Nz
 	class Signal
 	{
 		public:
-			using Callback = std::function<void(Args...)>;
+			using Callback = InplaceFunction<void(Args...)>;
 			class Connection;
 			class ConnectionGuard;
 
@@ -51,28 +53,36 @@ namespace Nz
 			Signal& operator=(Signal&& signal) noexcept;
 
 		private:
-			struct Slot;
-
-			using SlotPtr = std::shared_ptr<Slot>;
-			using SlotList = std::vector<SlotPtr>;
-			using SlotListIndex = typename SlotList::size_type;
-
 			struct Slot
 			{
-				Slot(Signal* me) :
-				signal(me)
-				{
-				}
-
 				Callback callback;
-				Signal* signal;
-				SlotListIndex index;
+				UInt32 handleIndex; //< InvalidHandle once disconnected during an emission
+			};
+
+			struct SlotHandle
+			{
+				UInt32 generation; //< Incremented on disconnection, invalidating connections
+				UInt32 index; //< Index of the slot while connected, next free handle otherwise
 			};
 
-			void Disconnect(const SlotPtr& slot) noexcept;
+			using SignalRef = std::shared_ptr<Signal*>;
+
+			void Disconnect(UInt32 handleIndex, UInt32 generation) noexcept;
+			void FlushPendingChanges() const;
+			bool IsConnected(UInt32 handleIndex, UInt32 generation) const;
+			void ReleaseHandle(UInt32 handleIndex) noexcept;
+			void RemoveSlot(std::size_t slotIndex) const noexcept;
+
+			static constexpr UInt32 InvalidHandle = std::numeric_limits<UInt32>::max();
 
-			SlotList m_slots;
-			mutable SlotListIndex m_slotIterator;
+			// Slots are stored contiguously, and are only ever moved outside of emissions
+			mutable std::vector<Slot> m_slots;
+			mutable std::vector<Slot> m_pendingSlots; //< Slots connected during an emission, following m_slots
+			mutable std::vector<SlotHandle> m_handles;
+			SignalRef m_ref; //< Shared with connections to know if the signal is still alive
+			mutable std::size_t m_deadSlotCount;
+			mutable std::size_t m_emissionDepth;
+			UInt32 m_freeHandle;
 	};
 
 	template<typename... Args>
@@ -97,9 +107,11 @@ namespace Nz
 			Connection& operator=(Connection&& connection) noexcept;
 
 		private:
-			Connection(const SlotPtr& slot);
+			Connection(const SignalRef& signal, UInt32 handleIndex, UInt32 generation);
 
-			std::weak_ptr<Slot> m_ptr;
+			std::weak_ptr<Signal*> m_signal;
+			UInt32 m_generation = 0;
+			UInt32 m_handleIndex = InvalidHandle;
 	};
 
 	template<typename... Args>
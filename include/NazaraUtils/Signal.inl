@@ -2,6 +2,8 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <NazaraUtils/CallOnExit.hpp>
+#include <NazaraUtils/Profiler.hpp>
 #include <cassert>
 #include <utility>
 
@@ -11,6 +13,12 @@ namespace Nz
 	* \ingroup utils
 	* \class Nz::Signal
 	* \brief Core class that represents a signal, a list of objects waiting for its message
+	*
+	* Slots are stored contiguously and referenced by connections through an index and a generation,
+	* connecting and disconnecting slots doesn't allocate memory once the internal storage is big enough.
+	*
+	* \remark Slots connected during an emission will only be called by the next emissions
+	* \remark Slots disconnected during an emission won't be called anymore, even by the current emission
 	*/
 
 	/*!
@@ -18,7 +26,9 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Signal() :
-	m_slotIterator(0)
+	m_deadSlotCount(0),
+	m_emissionDepth(0),
+	m_freeHandle(InvalidHandle)
 	{
 	}
 
@@ -40,7 +50,8 @@ namespace Nz
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Signal(Signal&& signal) noexcept
+	Signal<Args...>::Signal(Signal&& signal) noexcept :
+	Signal()
 	{
 		operator=(std::move(signal));
 	}
@@ -52,8 +63,28 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::Clear()
 	{
-		m_slots.clear();
-		m_slotIterator = 0;
+		for (std::vector<Slot>* slots : { &m_slots, &m_pendingSlots })
+		{
+			for (Slot& slot : *slots)
+			{
+				if (slot.handleIndex == InvalidHandle)
+					continue;
+
+				ReleaseHandle(slot.handleIndex);
+				if (m_emissionDepth > 0)
+				{
+					slot.handleIndex = InvalidHandle;
+					m_deadSlotCount++;
+				}
+			}
+		}
+
+		if (m_emissionDepth == 0)
+		{
+			m_slots.clear();
+			m_pendingSlots.clear();
+			m_deadSlotCount = 0;
+		}
 	}
 
 	/*!
@@ -81,20 +112,35 @@ namespace Nz
 	{
 		assert((func) &&  "Invalid function");
 
-		// Since we're incrementing the slot vector size, we need to replace our iterator at the end
-		// (Except when we are iterating on the signal)
-		bool resetIt = (m_slotIterator >= m_slots.size());
+		if (!m_ref)
+			m_ref = std::make_shared<Signal*>(this);
 
-		auto tempPtr = std::make_shared<Slot>(this);
-		tempPtr->callback = std::move(func);
-		tempPtr->index = m_slots.size();
-
-		m_slots.emplace_back(std::move(tempPtr));
+		UInt32 handleIndex;
+		if (m_freeHandle != InvalidHandle)
+		{
+			handleIndex = m_freeHandle;
+			m_freeHandle = m_handles[handleIndex].index;
+		}
+		else
+		{
+			handleIndex = static_cast<UInt32>(m_handles.size());
+			m_handles.push_back(SlotHandle{ 0, 0 });
+		}
 
-		if (resetIt)
-			m_slotIterator = m_slots.size(); //< Replace the iterator to the end
+		SlotHandle& handle = m_handles[handleIndex];
+		if (m_emissionDepth > 0)
+		{
+			// Slots can't be moved while they are being called, store it apart until the emission ends
+			handle.index = static_cast<UInt32>(m_slots.size() + m_pendingSlots.size());
+			m_pendingSlots.push_back(Slot{ std::move(func), handleIndex });
+		}
+		else
+		{
+			handle.index = static_cast<UInt32>(m_slots.size());
+			m_slots.push_back(Slot{ std::move(func), handleIndex });
+		}
 
-		return Connection(m_slots.back());
+		return Connection(m_ref, handleIndex, handle.generation);
 	}
 
 	/*!
@@ -109,10 +155,13 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O& object, void (O::*method) (Args...))
 	{
-		return Connect([&object, method] (Args&&... args)
+		auto callback = [&object, method] (Args&&... args)
 		{
 			return (object .* method) (std::forward<Args>(args)...);
-		});
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
 	}
 
 	/*!
@@ -127,10 +176,13 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O* object, void (O::*method)(Args...))
 	{
-		return Connect([object, method] (Args&&... args)
+		auto callback = [object, method] (Args&&... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
-		});
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
 	}
 
 	/*!
@@ -145,10 +197,13 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O& object, void (O::*method) (Args...) const)
 	{
-		return Connect([&object, method] (Args&&... args)
+		auto callback = [&object, method] (Args&&... args)
 		{
 			return (object .* method) (std::forward<Args>(args)...);
-		});
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
 	}
 
 	/*!
@@ -163,10 +218,13 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O* object, void (O::*method)(Args...) const)
 	{
-		return Connect([object, method] (Args&&... args)
+		auto callback = [object, method] (Args&&... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
-		});
+		};
+		static_assert(Callback::template IsStoredInline<decltype(callback)>(), "member function slots should not allocate");
+
+		return Connect(std::move(callback));
 	}
 
 	/*!
@@ -178,8 +236,23 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::operator()(Args... args) const
 	{
-		for (m_slotIterator = 0; m_slotIterator < m_slots.size(); ++m_slotIterator)
-			m_slots[m_slotIterator]->callback(args...);
+		NazaraProfileScope("Signal emission");
+
+		m_emissionDepth++;
+		NAZARA_DEFER(
+		{
+			if (--m_emissionDepth == 0 && (!m_pendingSlots.empty() || m_deadSlotCount > 0))
+				FlushPendingChanges();
+		});
+
+		// m_slots doesn't change during the emission (slots connected are pending and disconnected slots are only flagged)
+		std::size_t slotCount = m_slots.size();
+		for (std::size_t i = 0; i < slotCount; ++i)
+		{
+			const Slot& slot = m_slots[i];
+			if (slot.handleIndex != InvalidHandle)
+				slot.callback(args...);
+		}
 	}
 
 	/*!
@@ -199,16 +272,30 @@ namespace Nz
 	* \return A reference to this
 	*
 	* \param signal Signal to move in this
+	*
+	* \remark Connections to this signal are disconnected, while connections to the moved signal now refer to this one
 	*/
 	template<typename... Args>
 	Signal<Args...>& Signal<Args...>::operator=(Signal&& signal) noexcept
 	{
 		m_slots = std::move(signal.m_slots);
-		m_slotIterator = signal.m_slotIterator;
-
-		// We need to update the signal pointer inside of each slot
-		for (SlotPtr& slot : m_slots)
-			slot->signal = this;
+		m_pendingSlots = std::move(signal.m_pendingSlots);
+		m_handles = std::move(signal.m_handles);
+		m_ref = std::move(signal.m_ref);
+		m_deadSlotCount = signal.m_deadSlotCount;
+		m_emissionDepth = signal.m_emissionDepth;
+		m_freeHandle = signal.m_freeHandle;
+
+		// Connections reach the signal through this pointer
+		if (m_ref)
+			*m_ref = this;
+
+		signal.m_slots.clear();
+		signal.m_pendingSlots.clear();
+		signal.m_handles.clear();
+		signal.m_deadSlotCount = 0;
+		signal.m_emissionDepth = 0;
+		signal.m_freeHandle = InvalidHandle;
 
 		return *this;
 	}
@@ -216,47 +303,89 @@ namespace Nz
 	/*!
 	* \brief Disconnects a listener from this signal
 	*
-	* \param slot Pointer to the ith listener of the signal
+	* \param handleIndex Index of the listener handle
+	* \param generation Generation of the handle when the listener was connected
 	*
-	* \remark Produces a NazaraAssert if slot is invalid (nullptr)
-	* \remark Produces a NazaraAssert if index of slot is invalid
-	* \remark Produces a NazaraAssert if slot is not attached to this signal
+	* \remark Does nothing if the listener was already disconnected
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Disconnect(const SlotPtr& slot) noexcept
+	void Signal<Args...>::Disconnect(UInt32 handleIndex, UInt32 generation) noexcept
 	{
-		assert((slot) &&  "Invalid slot pointer");
-		assert((slot->index < m_slots.size()) &&  "Invalid slot index");
-		assert((slot->signal == this) &&  "Slot is not attached to this signal");
+		if (!IsConnected(handleIndex, generation))
+			return;
 
-		// "Swap this slot with the last one and pop" idiom
-		// This will preserve slot indexes
+		std::size_t slotIndex = m_handles[handleIndex].index;
+		ReleaseHandle(handleIndex);
 
-		// Can we safely "remove" this slot?
-		if (m_slotIterator >= (m_slots.size() - 1) || slot->index > m_slotIterator)
+		if (m_emissionDepth > 0)
 		{
-			// Yes we can
-			SlotPtr& newSlot = m_slots[slot->index];
-			newSlot = std::move(m_slots.back());
-			newSlot->index = slot->index; //< Update the moved slot index before resizing (in case it's the last one)
+			// The slot may be running (or be the next one to run), flag it and remove it when the emission ends
+			Slot& slot = (slotIndex < m_slots.size()) ? m_slots[slotIndex] : m_pendingSlots[slotIndex - m_slots.size()];
+			slot.handleIndex = InvalidHandle;
+			m_deadSlotCount++;
 		}
 		else
+			RemoveSlot(slotIndex);
+	}
+
+	/*!
+	* \brief Connects the slots connected during emissions and removes the slots disconnected during emissions
+	*/
+
+	template<typename... Args>
+	void Signal<Args...>::FlushPendingChanges() const
+	{
+		// Pending slots indices follow m_slots, appending them keeps their indices
+		for (Slot& slot : m_pendingSlots)
+			m_slots.push_back(std::move(slot));
+
+		m_pendingSlots.clear();
+
+		if (m_deadSlotCount > 0)
 		{
-			// Nope, let's be tricky
-			SlotPtr& current = m_slots[m_slotIterator];
-			SlotPtr& newSlot = m_slots[slot->index];
+			for (std::size_t i = 0; i < m_slots.size();)
+			{
+				if (m_slots[i].handleIndex == InvalidHandle)
+					RemoveSlot(i); //< Replaces the slot by the last one, which must be checked too
+				else
+					++i;
+			}
+
+			m_deadSlotCount = 0;
+		}
+	}
 
-			newSlot = std::move(current);
-			newSlot->index = slot->index; //< Update the moved slot index
+	template<typename... Args>
+	bool Signal<Args...>::IsConnected(UInt32 handleIndex, UInt32 generation) const
+	{
+		return handleIndex < m_handles.size() && m_handles[handleIndex].generation == generation;
+	}
 
-			current = std::move(m_slots.back());
-			current->index = m_slotIterator; //< Update the moved slot index
+	template<typename... Args>
+	void Signal<Args...>::ReleaseHandle(UInt32 handleIndex) noexcept
+	{
+		SlotHandle& handle = m_handles[handleIndex];
+		handle.generation++;
+		handle.index = m_freeHandle;
 
-			--m_slotIterator;
+		m_freeHandle = handleIndex;
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::RemoveSlot(std::size_t slotIndex) const noexcept
+	{
+		assert((slotIndex < m_slots.size()) && "Invalid slot index");
+
+		// "Swap this slot with the last one and pop" idiom
+		if (slotIndex != m_slots.size() - 1)
+		{
+			Slot& slot = m_slots[slotIndex];
+			slot = std::move(m_slots.back());
+			if (slot.handleIndex != InvalidHandle)
+				m_handles[slot.handleIndex].index = static_cast<UInt32>(slotIndex);
 		}
 
-		// Pop the last entry (from where we moved our slot)
 		m_slots.pop_back();
 	}
 
@@ -272,20 +401,26 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Connection::Connection(Connection&& connection) noexcept :
-	m_ptr(std::move(connection.m_ptr))
+	m_signal(std::move(connection.m_signal)),
+	m_generation(connection.m_generation),
+	m_handleIndex(connection.m_handleIndex)
 	{
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		connection.m_signal.reset();
 	}
 	
 	/*!
 	* \brief Constructs a Signal::Connection object with a slot
 	*
-	* \param slot Slot of the listener
+	* \param signal Reference to the signal
+	* \param handleIndex Index of the listener handle
+	* \param generation Generation of the listener handle
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Connection::Connection(const SlotPtr& slot) :
-	m_ptr(slot)
+	Signal<Args...>::Connection::Connection(const SignalRef& signal, UInt32 handleIndex, UInt32 generation) :
+	m_signal(signal),
+	m_generation(generation),
+	m_handleIndex(handleIndex)
 	{
 	}
 
@@ -310,8 +445,8 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::Connection::Disconnect() noexcept
 	{
-		if (SlotPtr ptr = m_ptr.lock())
-			ptr->signal->Disconnect(ptr);
+		if (SignalRef signal = m_signal.lock())
+			(*signal)->Disconnect(m_handleIndex, m_generation);
 	}
 
 	/*!
@@ -322,7 +457,8 @@ namespace Nz
 	template<typename... Args>
 	bool Signal<Args...>::Connection::IsConnected() const
 	{
-		return !m_ptr.expired();
+		SignalRef signal = m_signal.lock();
+		return signal && (*signal)->IsConnected(m_handleIndex, m_generation);
 	}
 
 	/*!
@@ -333,8 +469,10 @@ namespace Nz
 	template<typename... Args>
 	typename Signal<Args...>::Connection& Signal<Args...>::Connection::operator=(Connection&& connection) noexcept
 	{
-		m_ptr = std::move(connection.m_ptr);
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		m_signal = std::move(connection.m_signal);
+		m_generation = connection.m_generation;
+		m_handleIndex = connection.m_handleIndex;
+		connection.m_signal.reset();
 
 		return *this;
 	}
@@ -451,7 +589,7 @@ namespace Nz
 	template<typename... Args>
 	typename Signal<Args...>::ConnectionGuard& Signal<Args...>::ConnectionGuard::operator=(Connection&& connection)
 	{
-		if (&connection != this)
+		if (&connection != &m_connection)
 		{
 			m_connection.Disconnect();
 			m_connection = std::move(connection);
@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SIGNALQUEUE_HPP
+#define NAZARAUTILS_SIGNALQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	template<typename... Args>
+	class SignalQueue
+	{
+		public:
+			using Connection = typename Signal<Args...>::Connection;
+			using ConnectionGuard = typename Signal<Args...>::ConnectionGuard;
+			using KeyFunction = InplaceFunction<std::size_t(const std::decay_t<Args>&...)>;
+
+			explicit SignalQueue(std::size_t capacity = 0);
+			explicit SignalQueue(KeyFunction keyFunction, std::size_t capacity = 0);
+			SignalQueue(const SignalQueue&) = default;
+			SignalQueue(SignalQueue&&) = default;
+			~SignalQueue() = default;
+
+			void Clear();
+
+			template<typename... ConnectArgs> Connection Connect(ConnectArgs&&... args);
+
+			void Flush();
+
+			std::size_t GetPendingCount() const;
+			Signal<Args...>& GetSignal();
+			const Signal<Args...>& GetSignal() const;
+
+			bool IsCoalescing() const;
+
+			void Reserve(std::size_t capacity);
+
+			void operator()(Args... args);
+
+			SignalQueue& operator=(const SignalQueue&) = default;
+			SignalQueue& operator=(SignalQueue&&) = default;
+
+		private:
+			using Emission = std::tuple<std::decay_t<Args>...>;
+
+			std::unordered_map<std::size_t, std::size_t> m_pendingKeys; //< Key => index of the emission in m_pendingEmissions
+			std::vector<Emission> m_flushedEmissions; //< Kept to reuse its memory
+			std::vector<Emission> m_pendingEmissions;
+			KeyFunction m_keyFunction;
+			Signal<Args...> m_signal;
+			bool m_isFlushing;
+	};
+}
+
+#include <NazaraUtils/SignalQueue.inl>
+
+#endif // NAZARAUTILS_SIGNALQUEUE_HPP
@@ -0,0 +1,175 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SignalQueue
+	* \brief Signal whose emissions are recorded and delivered to its slots in one batch when flushed
+	*
+	* Emission arguments are stored by value until the next Flush.
+	* A coalescing queue is constructed with a key function, only the last emission of each key is kept
+	* (at the position of the first emission of that key since the last flush), slots are then called once per key and per flush.
+	*
+	* \remark Emissions queued while flushing are delivered by the next flush
+	*/
+
+	/*!
+	* \brief Constructs a SignalQueue object
+	*
+	* \param capacity Number of emissions to allocate memory for
+	*/
+	template<typename... Args>
+	SignalQueue<Args...>::SignalQueue(std::size_t capacity) :
+	m_isFlushing(false)
+	{
+		Reserve(capacity);
+	}
+
+	/*!
+	* \brief Constructs a coalescing SignalQueue object
+	*
+	* \param keyFunction Function returning the key of an emission from its arguments, emissions sharing a key replace each other
+	* \param capacity Number of emissions to allocate memory for
+	*/
+	template<typename... Args>
+	SignalQueue<Args...>::SignalQueue(KeyFunction keyFunction, std::size_t capacity) :
+	m_keyFunction(std::move(keyFunction)),
+	m_isFlushing(false)
+	{
+		Reserve(capacity);
+	}
+
+	/*!
+	* \brief Drops pending emissions without calling the slots
+	*/
+	template<typename... Args>
+	void SignalQueue<Args...>::Clear()
+	{
+		m_pendingEmissions.clear();
+		m_pendingKeys.clear();
+	}
+
+	/*!
+	* \brief Connects a slot to the underlying signal
+	* \return Connection attached to the signal
+	*
+	* \param args Arguments forwarded to Signal::Connect
+	*/
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	auto SignalQueue<Args...>::Connect(ConnectArgs&&... args) -> Connection
+	{
+		return m_signal.Connect(std::forward<ConnectArgs>(args)...);
+	}
+
+	/*!
+	* \brief Emits every pending emission, in the order they were queued
+	*
+	* \remark Calling Flush from a slot during a flush does nothing
+	*/
+	template<typename... Args>
+	void SignalQueue<Args...>::Flush()
+	{
+		if (m_isFlushing || m_pendingEmissions.empty())
+			return;
+
+		assert(m_flushedEmissions.empty());
+		std::swap(m_flushedEmissions, m_pendingEmissions);
+		m_pendingKeys.clear();
+
+		m_isFlushing = true;
+		NAZARA_DEFER(
+		{
+			m_flushedEmissions.clear();
+			m_isFlushing = false;
+		});
+
+		for (Emission& emission : m_flushedEmissions)
+			std::apply(m_signal, emission);
+	}
+
+	/*!
+	* \brief Gets the number of emissions waiting for the next flush
+	* \return Pending emission count
+	*/
+	template<typename... Args>
+	std::size_t SignalQueue<Args...>::GetPendingCount() const
+	{
+		return m_pendingEmissions.size();
+	}
+
+	/*!
+	* \brief Gets the underlying signal
+	* \return Signal called on flush
+	*/
+	template<typename... Args>
+	Signal<Args...>& SignalQueue<Args...>::GetSignal()
+	{
+		return m_signal;
+	}
+
+	/*!
+	* \brief Gets the underlying signal
+	* \return Signal called on flush
+	*/
+	template<typename... Args>
+	const Signal<Args...>& SignalQueue<Args...>::GetSignal() const
+	{
+		return m_signal;
+	}
+
+	/*!
+	* \brief Checks if the queue only keeps the last emission per key
+	* \return True if the queue has a key function
+	*/
+	template<typename... Args>
+	bool SignalQueue<Args...>::IsCoalescing() const
+	{
+		return static_cast<bool>(m_keyFunction);
+	}
+
+	/*!
+	* \brief Allocates memory for a number of emissions, queuing them won't allocate memory afterwards
+	*
+	* \param capacity Number of emissions to allocate memory for
+	*/
+	template<typename... Args>
+	void SignalQueue<Args...>::Reserve(std::size_t capacity)
+	{
+		m_pendingEmissions.reserve(capacity);
+		m_flushedEmissions.reserve(capacity);
+		if (m_keyFunction)
+			m_pendingKeys.reserve(capacity);
+	}
+
+	/*!
+	* \brief Queues an emission
+	*
+	* \param args Arguments to send to the slots when flushing
+	*/
+	template<typename... Args>
+	void SignalQueue<Args...>::operator()(Args... args)
+	{
+		if (m_keyFunction)
+		{
+			std::size_t key = m_keyFunction(std::as_const(args)...);
+			if (auto it = m_pendingKeys.find(key); it != m_pendingKeys.end())
+			{
+				m_pendingEmissions[it->second] = Emission(std::forward<Args>(args)...);
+				return;
+			}
+
+			m_pendingEmissions.emplace_back(std::forward<Args>(args)...);
+			m_pendingKeys.emplace(key, m_pendingEmissions.size() - 1);
+		}
+		else
+			m_pendingEmissions.emplace_back(std::forward<Args>(args)...);
+	}
+}
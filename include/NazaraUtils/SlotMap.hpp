@@ -0,0 +1,112 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SLOTMAP_HPP
+#define NAZARAUTILS_SLOTMAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	// Densely packed values addressed through generational keys: O(1) insertion, swap-and-pop erasure and lookup, linear iteration over contiguous memory
+	template<typename T, typename Allocator = std::allocator<T>>
+	class SlotMap
+	{
+		public:
+			using allocator_type = Allocator;
+			using const_iterator = const T*;
+			using iterator = T*;
+			using size_type = std::size_t;
+			using value_type = T;
+
+			struct Key;
+
+			explicit SlotMap(const Allocator& allocator = Allocator());
+			SlotMap(const SlotMap&) = default;
+			SlotMap(SlotMap&&) noexcept = default;
+			~SlotMap() = default;
+
+			void Clear();
+
+			bool Contains(const Key& key) const;
+
+			template<typename... Args> Key Emplace(Args&&... args);
+
+			bool Erase(const Key& key);
+
+			T& Get(const Key& key);
+			const T& Get(const Key& key) const;
+			Allocator GetAllocator() const;
+			std::size_t GetCapacity() const;
+			T* GetData();
+			const T* GetData() const;
+			Key GetKey(std::size_t denseIndex) const;
+			std::size_t GetSize() const;
+
+			Key Insert(const T& value);
+			Key Insert(T&& value);
+
+			bool IsEmpty() const;
+
+			void Reserve(std::size_t capacity);
+
+			void ShrinkToFit();
+
+			T* TryGet(const Key& key);
+			const T* TryGet(const Key& key) const;
+
+			// std interface
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+			bool empty() const noexcept;
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+			size_type size() const noexcept;
+
+			T& operator[](const Key& key);
+			const T& operator[](const Key& key) const;
+
+			SlotMap& operator=(const SlotMap&) = default;
+			SlotMap& operator=(SlotMap&&) noexcept = default;
+
+			static constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+
+			struct Key
+			{
+				bool operator==(const Key& key) const;
+				bool operator!=(const Key& key) const;
+
+				UInt32 index = InvalidIndex;
+				UInt32 generation = 0; //< Odd while the value is alive
+			};
+
+		private:
+			struct Slot
+			{
+				UInt32 index;      //< Dense index while the slot is alive, next free slot otherwise
+				UInt32 generation; //< Incremented on insertion and on erasure
+			};
+
+			using AllocatorTraits = std::allocator_traits<Allocator>;
+			using IndexAllocator = typename AllocatorTraits::template rebind_alloc<UInt32>;
+			using SlotAllocator = typename AllocatorTraits::template rebind_alloc<Slot>;
+
+			std::vector<T, Allocator> m_values;
+			std::vector<UInt32, IndexAllocator> m_denseToSlot; //< Slot of each value, to fix the moved value slot on erasure
+			std::vector<Slot, SlotAllocator> m_slots;
+			UInt32 m_freeSlotHead;
+	};
+}
+
+#include <NazaraUtils/SlotMap.inl>
+
+#endif // NAZARAUTILS_SLOTMAP_HPP
@@ -0,0 +1,374 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SlotMap
+	* \brief Container keeping its values packed in a contiguous array, addressed through stable generational keys
+	*
+	* Erasing a value moves the last value in its place, keys stay valid as they go through an indirection table.
+	* This is the opposite trade-off of MemoryPool: values are not stable in memory but iterating them is a linear sweep without holes.
+	*
+	* \remark Keys of erased values are never valid again (until their slot generation wraps around, after 2^31 reuses)
+	*/
+
+	/*!
+	* \brief Constructs an empty SlotMap
+	*
+	* \param allocator Allocator used for the values and the internal tables
+	*/
+	template<typename T, typename Allocator>
+	SlotMap<T, Allocator>::SlotMap(const Allocator& allocator) :
+	m_values(allocator),
+	m_denseToSlot(IndexAllocator(allocator)),
+	m_slots(SlotAllocator(allocator)),
+	m_freeSlotHead(InvalidIndex)
+	{
+	}
+
+	/*!
+	* \brief Destroys every value and invalidates every key
+	*
+	* \remark Slots are kept for reuse
+	*/
+	template<typename T, typename Allocator>
+	void SlotMap<T, Allocator>::Clear()
+	{
+		for (UInt32 slotIndex : m_denseToSlot)
+		{
+			Slot& slot = m_slots[slotIndex];
+			slot.generation++;
+			slot.index = m_freeSlotHead;
+			m_freeSlotHead = slotIndex;
+		}
+
+		m_denseToSlot.clear();
+		m_values.clear();
+	}
+
+	/*!
+	* \brief Checks if a key references a live value
+	* \return True if the value of the key has not been erased
+	*
+	* \param key Key to check
+	*/
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::Contains(const Key& key) const
+	{
+		return key.index < m_slots.size() && m_slots[key.index].generation == key.generation && (key.generation & 1) != 0;
+	}
+
+	/*!
+	* \brief Constructs a new value at the end of the dense array
+	* \return Key of the new value
+	*
+	* \param args Arguments for the value constructor
+	*/
+	template<typename T, typename Allocator>
+	template<typename... Args>
+	auto SlotMap<T, Allocator>::Emplace(Args&&... args) -> Key
+	{
+		assert(m_values.size() < InvalidIndex);
+
+		if (m_freeSlotHead == InvalidIndex)
+		{
+			m_slots.push_back(Slot{ InvalidIndex, 0 });
+			m_freeSlotHead = static_cast<UInt32>(m_slots.size() - 1);
+		}
+
+		UInt32 slotIndex = m_freeSlotHead;
+
+		// Only take the slot from the free list once the value is constructed
+		m_denseToSlot.push_back(slotIndex);
+		CallOnExit rollback([&] { m_denseToSlot.pop_back(); });
+
+		m_values.emplace_back(std::forward<Args>(args)...);
+		rollback.Reset();
+
+		Slot& slot = m_slots[slotIndex];
+		m_freeSlotHead = slot.index;
+		slot.index = static_cast<UInt32>(m_values.size() - 1);
+		slot.generation++;
+
+		return Key{ slotIndex, slot.generation };
+	}
+
+	/*!
+	* \brief Erases the value referenced by a key, moving the last value in its place
+	* \return True if the key was valid
+	*
+	* \param key Key of the value to erase
+	*
+	* \remark This invalidates pointers and iterators to the last value (and to the erased one)
+	*/
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::Erase(const Key& key)
+	{
+		if (!Contains(key))
+			return false;
+
+		Slot& slot = m_slots[key.index];
+
+		UInt32 lastIndex = static_cast<UInt32>(m_values.size() - 1);
+		if (slot.index != lastIndex)
+		{
+			m_values[slot.index] = std::move(m_values[lastIndex]);
+
+			UInt32 movedSlotIndex = m_denseToSlot[lastIndex];
+			m_denseToSlot[slot.index] = movedSlotIndex;
+			m_slots[movedSlotIndex].index = slot.index;
+		}
+
+		m_values.pop_back();
+		m_denseToSlot.pop_back();
+
+		slot.generation++;
+		slot.index = m_freeSlotHead;
+		m_freeSlotHead = key.index;
+
+		return true;
+	}
+
+	/*!
+	* \brief Retrieves the value referenced by a valid key
+	* \return Reference to the value
+	*
+	* \param key Valid key
+	*/
+	template<typename T, typename Allocator>
+	T& SlotMap<T, Allocator>::Get(const Key& key)
+	{
+		assert(Contains(key));
+		return m_values[m_slots[key.index].index];
+	}
+
+	/*!
+	* \brief Retrieves the value referenced by a valid key
+	* \return Reference to the value
+	*
+	* \param key Valid key
+	*/
+	template<typename T, typename Allocator>
+	const T& SlotMap<T, Allocator>::Get(const Key& key) const
+	{
+		assert(Contains(key));
+		return m_values[m_slots[key.index].index];
+	}
+
+	template<typename T, typename Allocator>
+	Allocator SlotMap<T, Allocator>::GetAllocator() const
+	{
+		return m_values.get_allocator();
+	}
+
+	template<typename T, typename Allocator>
+	std::size_t SlotMap<T, Allocator>::GetCapacity() const
+	{
+		return m_values.capacity();
+	}
+
+	/*!
+	* \brief Returns a pointer to the packed values
+	* \return Pointer to the first of GetSize() contiguous values
+	*/
+	template<typename T, typename Allocator>
+	T* SlotMap<T, Allocator>::GetData()
+	{
+		return m_values.data();
+	}
+
+	/*!
+	* \brief Returns a pointer to the packed values
+	* \return Pointer to the first of GetSize() contiguous values
+	*/
+	template<typename T, typename Allocator>
+	const T* SlotMap<T, Allocator>::GetData() const
+	{
+		return m_values.data();
+	}
+
+	/*!
+	* \brief Builds the key of a value from its position in the dense array
+	* \return Key of the value
+	*
+	* \param denseIndex Position of the value, lower than GetSize()
+	*/
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::GetKey(std::size_t denseIndex) const -> Key
+	{
+		assert(denseIndex < m_values.size());
+
+		UInt32 slotIndex = m_denseToSlot[denseIndex];
+		return Key{ slotIndex, m_slots[slotIndex].generation };
+	}
+
+	template<typename T, typename Allocator>
+	std::size_t SlotMap<T, Allocator>::GetSize() const
+	{
+		return m_values.size();
+	}
+
+	/*!
+	* \brief Inserts a copy of a value
+	* \return Key of the new value
+	*
+	* \param value Value to copy
+	*/
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::Insert(const T& value) -> Key
+	{
+		return Emplace(value);
+	}
+
+	/*!
+	* \brief Inserts a value by moving it
+	* \return Key of the new value
+	*
+	* \param value Value to move
+	*/
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::Insert(T&& value) -> Key
+	{
+		return Emplace(std::move(value));
+	}
+
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::IsEmpty() const
+	{
+		return m_values.empty();
+	}
+
+	/*!
+	* \brief Reserves memory for a number of values, avoiding reallocations until that size is reached
+	*
+	* \param capacity Number of values
+	*/
+	template<typename T, typename Allocator>
+	void SlotMap<T, Allocator>::Reserve(std::size_t capacity)
+	{
+		m_values.reserve(capacity);
+		m_denseToSlot.reserve(capacity);
+		m_slots.reserve(capacity);
+	}
+
+	/*!
+	* \brief Releases the unused memory of the dense arrays
+	*
+	* \remark The slot table never shrinks, as keys of erased values must stay invalid
+	*/
+	template<typename T, typename Allocator>
+	void SlotMap<T, Allocator>::ShrinkToFit()
+	{
+		m_values.shrink_to_fit();
+		m_denseToSlot.shrink_to_fit();
+	}
+
+	/*!
+	* \brief Retrieves the value referenced by a key, if it's still valid
+	* \return Pointer to the value, or nullptr if the value was erased
+	*
+	* \param key Key of the value
+	*/
+	template<typename T, typename Allocator>
+	T* SlotMap<T, Allocator>::TryGet(const Key& key)
+	{
+		if (!Contains(key))
+			return nullptr;
+
+		return &m_values[m_slots[key.index].index];
+	}
+
+	/*!
+	* \brief Retrieves the value referenced by a key, if it's still valid
+	* \return Pointer to the value, or nullptr if the value was erased
+	*
+	* \param key Key of the value
+	*/
+	template<typename T, typename Allocator>
+	const T* SlotMap<T, Allocator>::TryGet(const Key& key) const
+	{
+		if (!Contains(key))
+			return nullptr;
+
+		return &m_values[m_slots[key.index].index];
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::begin() noexcept -> iterator
+	{
+		return m_values.data();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::begin() const noexcept -> const_iterator
+	{
+		return m_values.data();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::cbegin() const noexcept -> const_iterator
+	{
+		return m_values.data();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::cend() const noexcept -> const_iterator
+	{
+		return m_values.data() + m_values.size();
+	}
+
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::empty() const noexcept
+	{
+		return m_values.empty();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::end() noexcept -> iterator
+	{
+		return m_values.data() + m_values.size();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::end() const noexcept -> const_iterator
+	{
+		return m_values.data() + m_values.size();
+	}
+
+	template<typename T, typename Allocator>
+	auto SlotMap<T, Allocator>::size() const noexcept -> size_type
+	{
+		return m_values.size();
+	}
+
+	template<typename T, typename Allocator>
+	T& SlotMap<T, Allocator>::operator[](const Key& key)
+	{
+		return Get(key);
+	}
+
+	template<typename T, typename Allocator>
+	const T& SlotMap<T, Allocator>::operator[](const Key& key) const
+	{
+		return Get(key);
+	}
+
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::Key::operator==(const Key& key) const
+	{
+		return index == key.index && generation == key.generation;
+	}
+
+	template<typename T, typename Allocator>
+	bool SlotMap<T, Allocator>::Key::operator!=(const Key& key) const
+	{
+		return !operator==(key);
+	}
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SMALLVECTOR_HPP
+#define NAZARAUTILS_SMALLVECTOR_HPP
+
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/TypeTraits.hpp>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+	class SmallVector
+	{
+		public:
+			using allocator_type = Allocator;
+			using value_type = T;
+			using const_iterator = const value_type*;
+			using const_pointer = const value_type*;
+			using const_reference = const value_type&;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+			using difference_type = std::ptrdiff_t;
+			using iterator = value_type*;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using size_type = std::size_t;
+
+			SmallVector() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+			explicit SmallVector(const Allocator& allocator) noexcept;
+			explicit SmallVector(std::size_t size, const T& value = T{}, const Allocator& allocator = Allocator());
+			SmallVector(std::initializer_list<T> values, const Allocator& allocator = Allocator());
+			SmallVector(const SmallVector& vec);
+			SmallVector(SmallVector&& vec) noexcept(IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>);
+			~SmallVector();
+
+			template<typename InputIt>
+			iterator append(InputIt first, InputIt last);
+
+			reference back();
+			const_reference back() const;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			size_type capacity() const noexcept;
+
+			void clear() noexcept;
+
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+			const_reverse_iterator crbegin() const noexcept;
+			const_reverse_iterator crend() const noexcept;
+
+			T* data() noexcept;
+			T* data(size_type n) noexcept;
+			const T* data() const noexcept;
+			const T* data(size_type n) const noexcept;
+
+			template<typename... Args>
+			iterator emplace(const_iterator pos, Args&&... args);
+
+			template<typename... Args>
+			reference emplace_back(Args&&... args);
+
+			bool empty() const noexcept;
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			iterator erase(const_iterator pos);
+			iterator erase(const_iterator first, const_iterator last);
+
+			reference front() noexcept;
+			const_reference front() const noexcept;
+
+			allocator_type get_allocator() const noexcept;
+
+			iterator insert(const_iterator pos, const T& value);
+			iterator insert(const_iterator pos, T&& value);
+			template<typename InputIt>
+			iterator insert(const_iterator pos, InputIt first, InputIt last);
+
+			bool is_inline() const noexcept;
+
+			size_type max_size() const noexcept;
+
+			reference push_back(const T& value);
+			reference push_back(T&& value);
+
+			void pop_back();
+
+			reverse_iterator rbegin() noexcept;
+			const_reverse_iterator rbegin() const noexcept;
+
+			reverse_iterator rend() noexcept;
+			const_reverse_iterator rend() const noexcept;
+
+			void reserve(size_type capacity);
+
+			void resize(size_type count);
+			void resize(size_type count, const value_type& value);
+			void resize_default_init(size_type count);
+			void resize_uninitialized(size_type count);
+
+			void shrink_to_fit();
+
+			size_type size() const noexcept;
+
+			reference operator[](size_type pos);
+			const_reference operator[](size_type pos) const;
+
+			SmallVector& operator=(const SmallVector& vec);
+			SmallVector& operator=(SmallVector&& vec) noexcept((std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || std::allocator_traits<Allocator>::is_always_equal::value) && (IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>));
+
+			static constexpr size_type inline_capacity() noexcept;
+
+		private:
+			using AllocatorTraits = std::allocator_traits<Allocator>;
+
+			T* GetInlineData() noexcept;
+			size_type GetGrowthCapacity(size_type minCapacity) const noexcept;
+			template<typename F> void Reallocate(size_type capacity, size_type gapIndex, size_type gapSize, F&& gapConstructor);
+			void Release() noexcept;
+
+			alignas(T) std::array<std::byte, sizeof(T) * N> m_inlineData;
+			Allocator m_allocator;
+			T* m_data;
+			size_type m_capacity;
+			size_type m_size;
+	};
+}
+
+#include <NazaraUtils/SmallVector.inl>
+
+#endif // NAZARAUTILS_SMALLVECTOR_HPP
@@ -0,0 +1,724 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class SmallVector
+	* \brief Core class that represents a vector storing up to N elements inplace (without allocation), spilling to the heap past that
+	*
+	* Elements are relocated with RelocateRange: with a memcpy when IsTriviallyRelocatable<T> is true (which can be specialized for your own types), and with a move followed by a destruction otherwise.
+	*
+	* \remark Unlike std::vector, moving an inline SmallVector moves its elements (and thus invalidates iterators)
+	*/
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector() noexcept(std::is_nothrow_default_constructible_v<Allocator>) :
+	SmallVector(Allocator())
+	{
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector(const Allocator& allocator) noexcept :
+	m_allocator(allocator),
+	m_data(GetInlineData()),
+	m_capacity(N),
+	m_size(0)
+	{
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector(std::size_t size, const T& value, const Allocator& allocator) :
+	SmallVector(allocator)
+	{
+		resize(size, value);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector(std::initializer_list<T> values, const Allocator& allocator) :
+	SmallVector(allocator)
+	{
+		reserve(values.size());
+		std::uninitialized_copy(values.begin(), values.end(), m_data);
+		m_size = values.size();
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector(const SmallVector& vec) :
+	SmallVector(AllocatorTraits::select_on_container_copy_construction(vec.m_allocator))
+	{
+		reserve(vec.m_size);
+		std::uninitialized_copy(vec.begin(), vec.end(), m_data);
+		m_size = vec.m_size;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::SmallVector(SmallVector&& vec) noexcept(IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>) :
+	m_allocator(std::move(vec.m_allocator)),
+	m_data(GetInlineData()),
+	m_capacity(N),
+	m_size(vec.m_size)
+	{
+		if (vec.is_inline())
+			RelocateRange(vec.data(), m_data, vec.m_size);
+		else
+		{
+			m_data = vec.m_data;
+			m_capacity = vec.m_capacity;
+
+			vec.m_data = vec.GetInlineData();
+			vec.m_capacity = N;
+		}
+
+		vec.m_size = 0;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	SmallVector<T, N, Allocator>::~SmallVector()
+	{
+		clear();
+		Release();
+	}
+
+	/*!
+	* \brief Appends a range of elements at the end of the vector
+	* \return Iterator to the first appended element
+	*
+	* \param first Iterator to the first element to append
+	* \param last Iterator past the last element to append
+	*
+	* \remark With forward iterators, this grows the vector at most once and copies the range in bulk
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	template<typename InputIt>
+	auto SmallVector<T, N, Allocator>::append(InputIt first, InputIt last) -> iterator
+	{
+		std::size_t index = m_size;
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			if (m_size + count > m_capacity)
+				Reallocate(GetGrowthCapacity(m_size + count), m_size, count, [&](T* ptr) { std::uninitialized_copy(first, last, ptr); });
+			else
+			{
+				std::uninitialized_copy(first, last, data(m_size));
+				m_size += count;
+			}
+		}
+		else
+		{
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+
+		return iterator(data(index));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::back() -> reference
+	{
+		assert(!empty());
+		return *data(m_size - 1);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::back() const -> const_reference
+	{
+		assert(!empty());
+		return *data(m_size - 1);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::begin() noexcept -> iterator
+	{
+		return iterator(data());
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::begin() const noexcept -> const_iterator
+	{
+		return const_iterator(data());
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::capacity() const noexcept -> size_type
+	{
+		return m_capacity;
+	}
+
+	/*!
+	* \brief Destroys every element of the vector
+	*
+	* \remark This doesn't free the heap memory, call shrink_to_fit afterwards to go back to the inline storage
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::clear() noexcept
+	{
+		std::destroy(data(), data(m_size));
+		m_size = 0;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::cbegin() const noexcept -> const_iterator
+	{
+		return const_iterator(data());
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::cend() const noexcept -> const_iterator
+	{
+		return const_iterator(data(m_size));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::crbegin() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(data(m_size));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::crend() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(data());
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	T* SmallVector<T, N, Allocator>::data() noexcept
+	{
+		return m_data;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	T* SmallVector<T, N, Allocator>::data(size_type n) noexcept
+	{
+		return m_data + n;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	const T* SmallVector<T, N, Allocator>::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	const T* SmallVector<T, N, Allocator>::data(size_type n) const noexcept
+	{
+		return m_data + n;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	template<typename... Args>
+	auto SmallVector<T, N, Allocator>::emplace(const_iterator pos, Args&& ...args) -> iterator
+	{
+		assert(pos >= cbegin() && pos <= cend());
+
+		std::size_t index = std::distance(cbegin(), pos);
+		if (m_size == m_capacity)
+		{
+			// Construct the new element in the new storage, existing elements are relocated around it
+			Reallocate(GetGrowthCapacity(m_size + 1), index, 1, [&](T* ptr) { PlacementNew(ptr, std::forward<Args>(args)...); });
+			return iterator(data(index));
+		}
+
+		if (index == m_size)
+		{
+			PlacementNew(data(m_size), std::forward<Args>(args)...);
+			m_size++;
+
+			return iterator(data(index));
+		}
+
+		// args may reference an element we're about to relocate
+		T value(std::forward<Args>(args)...);
+
+		RelocateRange(data(index), data(index + 1), m_size - index);
+		PlacementNew(data(index), std::move(value));
+		m_size++;
+
+		return iterator(data(index));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	template<typename... Args>
+	auto SmallVector<T, N, Allocator>::emplace_back(Args&&... args) -> reference
+	{
+		if NAZARA_LIKELY(m_size < m_capacity)
+			return *PlacementNew(data(m_size++), std::forward<Args>(args)...);
+
+		Reallocate(GetGrowthCapacity(m_size + 1), m_size, 1, [&](T* ptr) { PlacementNew(ptr, std::forward<Args>(args)...); });
+		return back();
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	bool SmallVector<T, N, Allocator>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::end() noexcept -> iterator
+	{
+		return iterator(data(m_size));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::end() const noexcept -> const_iterator
+	{
+		return const_iterator(data(m_size));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::erase(const_iterator pos) -> iterator
+	{
+		assert(pos >= cbegin() && pos < cend());
+
+		std::size_t index = std::distance(cbegin(), pos);
+		PlacementDestroy(data(index));
+		RelocateRange(data(index + 1), data(index), m_size - index - 1);
+		m_size--;
+
+		return iterator(data(index));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::erase(const_iterator first, const_iterator last) -> iterator
+	{
+		std::size_t index = std::distance(cbegin(), first);
+
+		if (first == last)
+			return begin() + index;
+
+		assert(first < last);
+		assert(first >= begin() && last <= end());
+
+		std::size_t count = std::distance(first, last);
+
+		std::destroy(data(index), data(index + count));
+		RelocateRange(data(index + count), data(index), m_size - index - count);
+		m_size -= count;
+
+		return iterator(data(index));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::front() noexcept -> reference
+	{
+		assert(!empty());
+		return *data();
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::front() const noexcept -> const_reference
+	{
+		assert(!empty());
+		return *data();
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::get_allocator() const noexcept -> allocator_type
+	{
+		return m_allocator;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::insert(const_iterator pos, const T& value) -> iterator
+	{
+		return emplace(pos, value);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::insert(const_iterator pos, T&& value) -> iterator
+	{
+		return emplace(pos, std::move(value));
+	}
+
+	/*!
+	* \brief Inserts a range of elements before pos
+	* \return Iterator to the first inserted element
+	*
+	* \param pos Iterator before which the elements are inserted
+	* \param first Iterator to the first element to insert
+	* \param last Iterator past the last element to insert
+	*
+	* \remark The range must not be part of the vector
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	template<typename InputIt>
+	auto SmallVector<T, N, Allocator>::insert(const_iterator pos, InputIt first, InputIt last) -> iterator
+	{
+		assert(pos >= cbegin() && pos <= cend());
+
+		std::size_t index = std::distance(cbegin(), pos);
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			if (m_size + count > m_capacity)
+				Reallocate(GetGrowthCapacity(m_size + count), index, count, [&](T* ptr) { std::uninitialized_copy(first, last, ptr); });
+			else
+			{
+				RelocateRange(data(index), data(index + count), m_size - index);
+				std::uninitialized_copy(first, last, data(index));
+				m_size += count;
+			}
+		}
+		else
+		{
+			std::size_t oldSize = m_size;
+			append(first, last);
+			std::rotate(begin() + index, begin() + oldSize, end());
+		}
+
+		return iterator(data(index));
+	}
+
+	/*!
+	* \brief Checks if the elements are stored inplace (and not on the heap)
+	* \return True if elements are stored in the vector itself
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	bool SmallVector<T, N, Allocator>::is_inline() const noexcept
+	{
+		return m_data == reinterpret_cast<const T*>(m_inlineData.data());
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::max_size() const noexcept -> size_type
+	{
+		return AllocatorTraits::max_size(m_allocator);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::push_back(const T& value) -> reference
+	{
+		return emplace_back(value);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::push_back(T&& value) -> reference
+	{
+		return emplace_back(std::move(value));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::pop_back()
+	{
+		assert(!empty());
+		PlacementDestroy(data(--m_size));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::rbegin() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(iterator(data(m_size)));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::rbegin() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(const_iterator(data(m_size)));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::rend() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(iterator(data()));
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::rend() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(const_iterator(data()));
+	}
+
+	/*!
+	* \brief Ensures the vector can hold at least capacity elements without reallocating
+	*
+	* \param capacity Minimum capacity
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::reserve(size_type capacity)
+	{
+		if (capacity > m_capacity)
+			Reallocate(capacity, m_size, 0, [](T*) {});
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::resize(size_type count)
+	{
+		if (count > m_size)
+		{
+			std::size_t newElementCount = count - m_size;
+			auto ConstructElements = [&](T* ptr)
+			{
+				for (std::size_t i = 0; i < newElementCount; ++i)
+					PlacementNew(ptr + i);
+			};
+
+			if (count > m_capacity)
+				Reallocate(GetGrowthCapacity(count), m_size, newElementCount, ConstructElements);
+			else
+			{
+				ConstructElements(data(m_size));
+				m_size = count;
+			}
+		}
+		else if (count < m_size)
+		{
+			std::destroy(data(count), data(m_size));
+			m_size = count;
+		}
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::resize(size_type count, const value_type& value)
+	{
+		if (count > m_size)
+		{
+			std::size_t newElementCount = count - m_size;
+			auto ConstructElements = [&](T* ptr)
+			{
+				for (std::size_t i = 0; i < newElementCount; ++i)
+					PlacementNew(ptr + i, value);
+			};
+
+			if (count > m_capacity)
+				Reallocate(GetGrowthCapacity(count), m_size, newElementCount, ConstructElements);
+			else
+			{
+				ConstructElements(data(m_size));
+				m_size = count;
+			}
+		}
+		else if (count < m_size)
+		{
+			std::destroy(data(count), data(m_size));
+			m_size = count;
+		}
+	}
+
+	/*!
+	* \brief Resizes the vector, default-initializing new elements
+	*
+	* \param count New size of the vector
+	*
+	* \remark Unlike resize, this leaves new elements of trivial types uninitialized (useful for buffers which are about to be filled)
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::resize_default_init(size_type count)
+	{
+		if (count > m_size)
+		{
+			if (count > m_capacity)
+				reserve(GetGrowthCapacity(count));
+
+			if constexpr (!std::is_trivially_default_constructible_v<T>)
+			{
+				for (std::size_t i = m_size; i < count; ++i)
+					::new (static_cast<void*>(data(i))) T;
+			}
+
+			m_size = count;
+		}
+		else if (count < m_size)
+		{
+			std::destroy(data(count), data(m_size));
+			m_size = count;
+		}
+	}
+
+	/*!
+	* \brief Resizes the vector without initializing new elements, which must be written before being read
+	*
+	* \param count New size of the vector
+	*
+	* \remark T must be a trivial type
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::resize_uninitialized(size_type count)
+	{
+		static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>, "resize_uninitialized requires a trivial type");
+
+		if (count > m_capacity)
+			reserve(GetGrowthCapacity(count));
+
+		m_size = count;
+	}
+
+	/*!
+	* \brief Reduces the capacity to fit the size, moving elements back inplace if they fit
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::shrink_to_fit()
+	{
+		if (is_inline())
+			return;
+
+		if (m_size <= N)
+		{
+			T* inlineData = GetInlineData();
+			RelocateRange(data(), inlineData, m_size);
+			Release();
+
+			m_data = inlineData;
+			m_capacity = N;
+		}
+		else if (m_size < m_capacity)
+			Reallocate(m_size, m_size, 0, [](T*) {});
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::operator[](size_type pos) -> reference
+	{
+		assert(pos < m_size);
+		return *data(pos);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::operator[](size_type pos) const -> const_reference
+	{
+		assert(pos < m_size);
+		return *data(pos);
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::operator=(const SmallVector& vec) -> SmallVector&
+	{
+		if (this == &vec)
+			return *this;
+
+		clear();
+
+		if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+		{
+			if (m_allocator != vec.m_allocator)
+			{
+				Release();
+				m_data = GetInlineData();
+				m_capacity = N;
+			}
+
+			m_allocator = vec.m_allocator;
+		}
+
+		reserve(vec.m_size);
+		std::uninitialized_copy(vec.begin(), vec.end(), m_data);
+		m_size = vec.m_size;
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::operator=(SmallVector&& vec) noexcept((std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || std::allocator_traits<Allocator>::is_always_equal::value) && (IsTriviallyRelocatable_v<T> || std::is_nothrow_move_constructible_v<T>)) -> SmallVector&
+	{
+		if (this == &vec)
+			return *this;
+
+		clear();
+
+		bool canSteal = !vec.is_inline();
+		if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value)
+			canSteal = canSteal && m_allocator == vec.m_allocator;
+
+		if (!canSteal)
+		{
+			// Inline elements (or elements we can't take ownership of) have to be relocated
+			reserve(vec.m_size);
+			RelocateRange(vec.data(), m_data, vec.m_size);
+			m_size = vec.m_size;
+			vec.m_size = 0;
+
+			return *this;
+		}
+
+		Release();
+
+		if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+			m_allocator = std::move(vec.m_allocator);
+
+		m_data = vec.m_data;
+		m_capacity = vec.m_capacity;
+		m_size = vec.m_size;
+
+		vec.m_data = vec.GetInlineData();
+		vec.m_capacity = N;
+		vec.m_size = 0;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Returns the number of elements which can be stored without allocating
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	constexpr auto SmallVector<T, N, Allocator>::inline_capacity() noexcept -> size_type
+	{
+		return N;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	T* SmallVector<T, N, Allocator>::GetInlineData() noexcept
+	{
+		if constexpr (N > 0)
+			return std::launder(reinterpret_cast<T*>(m_inlineData.data()));
+		else
+			return nullptr;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	auto SmallVector<T, N, Allocator>::GetGrowthCapacity(size_type minCapacity) const noexcept -> size_type
+	{
+		return std::max(minCapacity, m_capacity * 2);
+	}
+
+	/*!
+	* \brief Moves the elements to a new heap storage, leaving room for gapSize elements at gapIndex
+	*
+	* \param capacity Capacity of the new storage
+	* \param gapIndex Index where the gap starts
+	* \param gapSize Number of elements constructed by gapConstructor
+	* \param gapConstructor Functor constructing the gap elements at the pointer it receives, called before existing elements are relocated (so they can be used as arguments)
+	*/
+	template<typename T, std::size_t N, typename Allocator>
+	template<typename F>
+	void SmallVector<T, N, Allocator>::Reallocate(size_type capacity, size_type gapIndex, size_type gapSize, F&& gapConstructor)
+	{
+		assert(capacity >= m_size + gapSize);
+		assert(gapIndex <= m_size);
+
+		T* newData = AllocatorTraits::allocate(m_allocator, capacity);
+		{
+			CallOnExit freeOnFailure([&] { AllocatorTraits::deallocate(m_allocator, newData, capacity); });
+			gapConstructor(newData + gapIndex);
+			freeOnFailure.Reset();
+		}
+
+		RelocateRange(data(), newData, gapIndex);
+		RelocateRange(data(gapIndex), newData + gapIndex + gapSize, m_size - gapIndex);
+		Release();
+
+		m_data = newData;
+		m_capacity = capacity;
+		m_size += gapSize;
+	}
+
+	template<typename T, std::size_t N, typename Allocator>
+	void SmallVector<T, N, Allocator>::Release() noexcept
+	{
+		if (!is_inline())
+			AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+	}
+}
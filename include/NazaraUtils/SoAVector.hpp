@@ -0,0 +1,230 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SOAVECTOR_HPP
+#define NAZARAUTILS_SOAVECTOR_HPP
+
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/TypeList.hpp>
+#include <NazaraUtils/TypeTraits.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	// Non-owning view of a SoAVector column
+	template<typename T>
+	class SoAColumn
+	{
+		public:
+			using const_iterator = const T*;
+			using iterator = T*;
+			using size_type = std::size_t;
+			using value_type = std::remove_cv_t<T>;
+
+			constexpr SoAColumn(T* data, std::size_t size) noexcept;
+			constexpr SoAColumn(const SoAColumn&) noexcept = default;
+			constexpr SoAColumn(SoAColumn&&) noexcept = default;
+
+			constexpr T& back() const;
+
+			constexpr iterator begin() const noexcept;
+
+			constexpr T* data() const noexcept;
+
+			constexpr bool empty() const noexcept;
+
+			constexpr iterator end() const noexcept;
+
+			constexpr T& front() const;
+
+			constexpr size_type size() const noexcept;
+
+			constexpr T& operator[](size_type pos) const;
+
+			constexpr SoAColumn& operator=(const SoAColumn&) noexcept = default;
+			constexpr SoAColumn& operator=(SoAColumn&&) noexcept = default;
+
+		private:
+			T* m_data;
+			std::size_t m_size;
+	};
+
+	namespace Detail
+	{
+		template<typename... Types>
+		struct SoAColumnLayout
+		{
+			static constexpr std::size_t Alignments[] = { alignof(Types)... };
+			static constexpr std::size_t MaxAlignment = std::max({ alignof(Types)... });
+			static constexpr std::size_t Sizes[] = { sizeof(Types)... };
+		};
+	}
+
+	// Vector storing each type of the TypeList in its own contiguous array (aligned on Alignment bytes), elements are accessed as tuples of references
+	template<typename List, std::size_t Alignment = 64>
+	class SoAVector
+	{
+		static_assert(!TypeListEmpty<List>, "SoAVector requires at least one column");
+		static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+
+		public:
+			template<bool Const> class Iterator;
+
+			template<std::size_t I> using column_type = TypeListAt<List, I>;
+			using const_iterator = Iterator<true>;
+			using const_reference = TypeListInstantiate<TypeListTransform<TypeListTransform<List, std::add_const>, std::add_lvalue_reference>, std::tuple>;
+			using difference_type = std::ptrdiff_t;
+			using iterator = Iterator<false>;
+			using reference = TypeListInstantiate<TypeListTransform<List, std::add_lvalue_reference>, std::tuple>;
+			using size_type = std::size_t;
+			using value_type = TypeListInstantiate<List, std::tuple>;
+
+			SoAVector() noexcept;
+			SoAVector(const SoAVector& vec);
+			SoAVector(SoAVector&& vec) noexcept;
+			~SoAVector();
+
+			reference back();
+			const_reference back() const;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			size_type capacity() const noexcept;
+
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			void clear() noexcept;
+
+			template<std::size_t I> SoAColumn<column_type<I>> column() noexcept;
+			template<std::size_t I> SoAColumn<const column_type<I>> column() const noexcept;
+
+			template<std::size_t I> column_type<I>* data() noexcept;
+			template<std::size_t I> const column_type<I>* data() const noexcept;
+
+			template<typename... Args>
+			reference emplace_back(Args&&... args);
+
+			bool empty() const noexcept;
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			iterator erase(const_iterator pos);
+
+			reference front();
+			const_reference front() const;
+
+			void pop_back();
+
+			reference push_back(const value_type& value);
+			reference push_back(value_type&& value);
+
+			void reserve(size_type capacity);
+
+			void resize(size_type count);
+
+			void shrink_to_fit();
+
+			size_type size() const noexcept;
+
+			reference operator[](size_type pos);
+			const_reference operator[](size_type pos) const;
+
+			SoAVector& operator=(const SoAVector& vec);
+			SoAVector& operator=(SoAVector&& vec) noexcept;
+
+			static constexpr size_type ColumnCount = TypeListSize<List>;
+
+		private:
+			using ColumnPointers = TypeListInstantiate<TypeListTransform<List, std::add_pointer>, std::tuple>;
+			using Layout = TypeListInstantiate<List, Detail::SoAColumnLayout>;
+
+			template<std::size_t... I, typename... Args> static void Construct(ColumnPointers& columns, size_type pos, std::index_sequence<I...>, Args&&... args);
+			template<typename F> static void ForEachColumn(F&& functor);
+			template<typename F, std::size_t... I> static void ForEachColumn(F&& functor, std::index_sequence<I...>);
+			template<std::size_t... I> reference Get(size_type pos, std::index_sequence<I...>);
+			template<std::size_t... I> const_reference Get(size_type pos, std::index_sequence<I...>) const;
+			template<typename F> void Reallocate(size_type capacity, F&& backConstructor);
+			void Release() noexcept;
+
+			static constexpr std::size_t GetColumnAlignment(std::size_t columnIndex);
+			static constexpr std::array<std::size_t, ColumnCount + 1> ComputeOffsets(size_type capacity);
+
+			static constexpr std::size_t StorageAlignment = std::max({ Alignment, alignof(std::max_align_t), Layout::MaxAlignment });
+
+			ColumnPointers m_columns;
+			std::byte* m_memory;
+			size_type m_capacity;
+			size_type m_size;
+	};
+
+	// Random-access iterator zipping every column, dereferencing to a tuple of references
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	class SoAVector<List, Alignment>::Iterator
+	{
+		friend SoAVector;
+		template<bool> friend class Iterator;
+
+		public:
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+			using pointer = void;
+			using reference = std::conditional_t<Const, typename SoAVector::const_reference, typename SoAVector::reference>;
+			using value_type = typename SoAVector::value_type;
+
+			Iterator() = default;
+			template<bool C = Const, typename = std::enable_if_t<C>> Iterator(const Iterator<false>& it) noexcept;
+			Iterator(const Iterator&) = default;
+			Iterator(Iterator&&) noexcept = default;
+
+			std::size_t GetIndex() const noexcept;
+
+			Iterator& operator=(const Iterator&) = default;
+			Iterator& operator=(Iterator&&) noexcept = default;
+
+			reference operator*() const;
+			reference operator[](difference_type n) const;
+
+			Iterator& operator++();
+			Iterator operator++(int);
+			Iterator& operator--();
+			Iterator operator--(int);
+
+			Iterator& operator+=(difference_type n);
+			Iterator& operator-=(difference_type n);
+			Iterator operator+(difference_type n) const;
+			Iterator operator-(difference_type n) const;
+			difference_type operator-(const Iterator& it) const;
+
+			bool operator==(const Iterator& it) const;
+			bool operator!=(const Iterator& it) const;
+			bool operator<(const Iterator& it) const;
+			bool operator<=(const Iterator& it) const;
+			bool operator>(const Iterator& it) const;
+			bool operator>=(const Iterator& it) const;
+
+		private:
+			using VectorPtr = std::conditional_t<Const, const SoAVector*, SoAVector*>;
+
+			Iterator(VectorPtr vec, std::size_t index) noexcept;
+
+			VectorPtr m_vec = nullptr;
+			std::size_t m_index = 0;
+	};
+}
+
+#include <NazaraUtils/SoAVector.inl>
+
+#endif // NAZARAUTILS_SOAVECTOR_HPP
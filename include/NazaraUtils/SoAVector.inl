@@ -0,0 +1,699 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class SoAColumn
+	* \brief Core class that represents a view of a SoAVector column (equivalent to a std::span)
+	*
+	* \remark The view is invalidated when the vector reallocates
+	*/
+
+	template<typename T>
+	constexpr SoAColumn<T>::SoAColumn(T* data, std::size_t size) noexcept :
+	m_data(data),
+	m_size(size)
+	{
+	}
+
+	template<typename T>
+	constexpr T& SoAColumn<T>::back() const
+	{
+		assert(!empty());
+		return m_data[m_size - 1];
+	}
+
+	template<typename T>
+	constexpr auto SoAColumn<T>::begin() const noexcept -> iterator
+	{
+		return m_data;
+	}
+
+	template<typename T>
+	constexpr T* SoAColumn<T>::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template<typename T>
+	constexpr bool SoAColumn<T>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename T>
+	constexpr auto SoAColumn<T>::end() const noexcept -> iterator
+	{
+		return m_data + m_size;
+	}
+
+	template<typename T>
+	constexpr T& SoAColumn<T>::front() const
+	{
+		assert(!empty());
+		return m_data[0];
+	}
+
+	template<typename T>
+	constexpr auto SoAColumn<T>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	template<typename T>
+	constexpr T& SoAColumn<T>::operator[](size_type pos) const
+	{
+		assert(pos < m_size);
+		return m_data[pos];
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class SoAVector
+	* \brief Core class that represents a structure-of-arrays vector, storing each type of a TypeList in its own contiguous column
+	*
+	* Columns live in a single allocation and each one starts on an Alignment-bytes boundary (64 by default, suitable for SIMD loads).
+	* Hot loops should iterate on the columns they need (using column<I>() or data<I>()) rather than on the zip iterator.
+	*
+	* \remark Elements are accessed as tuples of references, which can be unpacked with structured bindings
+	*/
+
+	template<typename List, std::size_t Alignment>
+	SoAVector<List, Alignment>::SoAVector() noexcept :
+	m_columns(),
+	m_memory(nullptr),
+	m_capacity(0),
+	m_size(0)
+	{
+	}
+
+	template<typename List, std::size_t Alignment>
+	SoAVector<List, Alignment>::SoAVector(const SoAVector& vec) :
+	SoAVector()
+	{
+		*this = vec;
+	}
+
+	template<typename List, std::size_t Alignment>
+	SoAVector<List, Alignment>::SoAVector(SoAVector&& vec) noexcept :
+	m_columns(std::exchange(vec.m_columns, ColumnPointers())),
+	m_memory(std::exchange(vec.m_memory, nullptr)),
+	m_capacity(std::exchange(vec.m_capacity, 0)),
+	m_size(std::exchange(vec.m_size, 0))
+	{
+	}
+
+	template<typename List, std::size_t Alignment>
+	SoAVector<List, Alignment>::~SoAVector()
+	{
+		clear();
+		Release();
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::back() -> reference
+	{
+		assert(!empty());
+		return operator[](m_size - 1);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::back() const -> const_reference
+	{
+		assert(!empty());
+		return operator[](m_size - 1);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::begin() noexcept -> iterator
+	{
+		return iterator(this, 0);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::begin() const noexcept -> const_iterator
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::capacity() const noexcept -> size_type
+	{
+		return m_capacity;
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::cbegin() const noexcept -> const_iterator
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::cend() const noexcept -> const_iterator
+	{
+		return const_iterator(this, m_size);
+	}
+
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::clear() noexcept
+	{
+		ForEachColumn([&](auto columnIndex)
+		{
+			auto* column = std::get<decltype(columnIndex)::value>(m_columns);
+			std::destroy(column, column + m_size);
+		});
+
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Returns a view of a column
+	* \return View of the I-th column, with one entry per element
+	*/
+	template<typename List, std::size_t Alignment>
+	template<std::size_t I>
+	auto SoAVector<List, Alignment>::column() noexcept -> SoAColumn<column_type<I>>
+	{
+		return SoAColumn<column_type<I>>(std::get<I>(m_columns), m_size);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<std::size_t I>
+	auto SoAVector<List, Alignment>::column() const noexcept -> SoAColumn<const column_type<I>>
+	{
+		return SoAColumn<const column_type<I>>(std::get<I>(m_columns), m_size);
+	}
+
+	/*!
+	* \brief Returns a pointer to the beginning of a column
+	* \return Pointer to the first entry of the I-th column, aligned on Alignment bytes
+	*/
+	template<typename List, std::size_t Alignment>
+	template<std::size_t I>
+	auto SoAVector<List, Alignment>::data() noexcept -> column_type<I>*
+	{
+		return std::get<I>(m_columns);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<std::size_t I>
+	auto SoAVector<List, Alignment>::data() const noexcept -> const column_type<I>*
+	{
+		return std::get<I>(m_columns);
+	}
+
+	/*!
+	* \brief Constructs an element at the end of the vector
+	* \return Tuple of references to the new element fields
+	*
+	* \param args One argument per column, used to construct the field of that column
+	*/
+	template<typename List, std::size_t Alignment>
+	template<typename... Args>
+	auto SoAVector<List, Alignment>::emplace_back(Args&&... args) -> reference
+	{
+		static_assert(sizeof...(Args) == ColumnCount, "emplace_back expects one argument per column");
+
+		if (m_size == m_capacity)
+		{
+			// Construct the new element in the new storage, as args may reference an element of the vector
+			Reallocate(std::max<size_type>(m_capacity * 2, 16), [&](ColumnPointers& columns)
+			{
+				Construct(columns, m_size, std::make_index_sequence<ColumnCount>(), std::forward<Args>(args)...);
+			});
+		}
+		else
+			Construct(m_columns, m_size, std::make_index_sequence<ColumnCount>(), std::forward<Args>(args)...);
+
+		m_size++;
+		return back();
+	}
+
+	template<typename List, std::size_t Alignment>
+	bool SoAVector<List, Alignment>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::end() noexcept -> iterator
+	{
+		return iterator(this, m_size);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::end() const noexcept -> const_iterator
+	{
+		return const_iterator(this, m_size);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::erase(const_iterator pos) -> iterator
+	{
+		std::size_t index = pos.GetIndex();
+		assert(index < m_size);
+
+		ForEachColumn([&](auto columnIndex)
+		{
+			auto* column = std::get<decltype(columnIndex)::value>(m_columns);
+			std::move(column + index + 1, column + m_size, column + index);
+			PlacementDestroy(column + m_size - 1);
+		});
+		m_size--;
+
+		return iterator(this, index);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::front() -> reference
+	{
+		assert(!empty());
+		return operator[](0);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::front() const -> const_reference
+	{
+		assert(!empty());
+		return operator[](0);
+	}
+
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::pop_back()
+	{
+		assert(!empty());
+
+		m_size--;
+		ForEachColumn([&](auto columnIndex)
+		{
+			PlacementDestroy(std::get<decltype(columnIndex)::value>(m_columns) + m_size);
+		});
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::push_back(const value_type& value) -> reference
+	{
+		return std::apply([this](const auto&... fields) -> reference { return emplace_back(fields...); }, value);
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::push_back(value_type&& value) -> reference
+	{
+		return std::apply([this](auto&&... fields) -> reference { return emplace_back(std::move(fields)...); }, std::move(value));
+	}
+
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::reserve(size_type capacity)
+	{
+		if (capacity > m_capacity)
+			Reallocate(capacity, [](ColumnPointers&) {});
+	}
+
+	/*!
+	* \brief Resizes the vector, value-initializing new elements
+	*
+	* \param count New size of the vector
+	*/
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::resize(size_type count)
+	{
+		if (count > m_size)
+		{
+			if (count > m_capacity)
+				Reallocate(std::max(count, m_capacity * 2), [](ColumnPointers&) {});
+
+			ForEachColumn([&](auto columnIndex)
+			{
+				auto* column = std::get<decltype(columnIndex)::value>(m_columns);
+				for (std::size_t i = m_size; i < count; ++i)
+					PlacementNew(column + i);
+			});
+		}
+		else if (count < m_size)
+		{
+			ForEachColumn([&](auto columnIndex)
+			{
+				auto* column = std::get<decltype(columnIndex)::value>(m_columns);
+				std::destroy(column + count, column + m_size);
+			});
+		}
+
+		m_size = count;
+	}
+
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::shrink_to_fit()
+	{
+		if (m_size < m_capacity)
+			Reallocate(m_size, [](ColumnPointers&) {});
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::operator[](size_type pos) -> reference
+	{
+		assert(pos < m_size);
+		return Get(pos, std::make_index_sequence<ColumnCount>());
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::operator[](size_type pos) const -> const_reference
+	{
+		assert(pos < m_size);
+		return Get(pos, std::make_index_sequence<ColumnCount>());
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::operator=(const SoAVector& vec) -> SoAVector&
+	{
+		if (this == &vec)
+			return *this;
+
+		clear();
+		if (vec.m_size > m_capacity)
+			Reallocate(vec.m_size, [](ColumnPointers&) {});
+
+		ForEachColumn([&](auto columnIndex)
+		{
+			constexpr std::size_t I = decltype(columnIndex)::value;
+
+			const auto* source = std::get<I>(vec.m_columns);
+			std::uninitialized_copy(source, source + vec.m_size, std::get<I>(m_columns));
+		});
+		m_size = vec.m_size;
+
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	auto SoAVector<List, Alignment>::operator=(SoAVector&& vec) noexcept -> SoAVector&
+	{
+		if (this == &vec)
+			return *this;
+
+		clear();
+		Release();
+
+		m_columns = std::exchange(vec.m_columns, ColumnPointers());
+		m_memory = std::exchange(vec.m_memory, nullptr);
+		m_capacity = std::exchange(vec.m_capacity, 0);
+		m_size = std::exchange(vec.m_size, 0);
+
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<std::size_t... I, typename... Args>
+	void SoAVector<List, Alignment>::Construct(ColumnPointers& columns, size_type pos, std::index_sequence<I...>, Args&&... args)
+	{
+		(PlacementNew(std::get<I>(columns) + pos, std::forward<Args>(args)), ...);
+	}
+
+	// Calls functor with a std::integral_constant holding the index of each column
+	template<typename List, std::size_t Alignment>
+	template<typename F>
+	void SoAVector<List, Alignment>::ForEachColumn(F&& functor)
+	{
+		ForEachColumn(std::forward<F>(functor), std::make_index_sequence<ColumnCount>());
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<typename F, std::size_t... I>
+	void SoAVector<List, Alignment>::ForEachColumn(F&& functor, std::index_sequence<I...>)
+	{
+		(functor(std::integral_constant<std::size_t, I>()), ...);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<std::size_t... I>
+	auto SoAVector<List, Alignment>::Get(size_type pos, std::index_sequence<I...>) -> reference
+	{
+		return reference(std::get<I>(m_columns)[pos]...);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<std::size_t... I>
+	auto SoAVector<List, Alignment>::Get(size_type pos, std::index_sequence<I...>) const -> const_reference
+	{
+		return const_reference(std::get<I>(m_columns)[pos]...);
+	}
+
+	/*!
+	* \brief Moves the elements to a new storage
+	*
+	* \param capacity Capacity of the new storage
+	* \param backConstructor Functor receiving the new columns, which can construct an element at index m_size (before existing elements are relocated)
+	*/
+	template<typename List, std::size_t Alignment>
+	template<typename F>
+	void SoAVector<List, Alignment>::Reallocate(size_type capacity, F&& backConstructor)
+	{
+		assert(capacity >= m_size);
+
+		std::byte* newMemory = nullptr;
+		ColumnPointers newColumns;
+		if (capacity > 0)
+		{
+			std::array<std::size_t, ColumnCount + 1> offsets = ComputeOffsets(capacity);
+			newMemory = static_cast<std::byte*>(::operator new(offsets[ColumnCount], std::align_val_t(StorageAlignment)));
+
+			ForEachColumn([&](auto columnIndex)
+			{
+				constexpr std::size_t I = decltype(columnIndex)::value;
+				std::get<I>(newColumns) = reinterpret_cast<column_type<I>*>(newMemory + offsets[I]);
+			});
+		}
+
+		{
+			CallOnExit freeOnFailure([&] { ::operator delete(newMemory, std::align_val_t(StorageAlignment)); });
+			backConstructor(newColumns);
+			freeOnFailure.Reset();
+		}
+
+		ForEachColumn([&](auto columnIndex)
+		{
+			constexpr std::size_t I = decltype(columnIndex)::value;
+			using T = column_type<I>;
+
+			T* source = std::get<I>(m_columns);
+			T* destination = std::get<I>(newColumns);
+			if constexpr (IsTriviallyRelocatable_v<T>)
+			{
+				if (m_size > 0)
+					std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), m_size * sizeof(T));
+			}
+			else
+			{
+				std::uninitialized_move(source, source + m_size, destination);
+				std::destroy(source, source + m_size);
+			}
+		});
+
+		Release();
+
+		m_columns = newColumns;
+		m_memory = newMemory;
+		m_capacity = capacity;
+	}
+
+	template<typename List, std::size_t Alignment>
+	void SoAVector<List, Alignment>::Release() noexcept
+	{
+		if (m_memory)
+			::operator delete(m_memory, std::align_val_t(StorageAlignment));
+	}
+
+	template<typename List, std::size_t Alignment>
+	constexpr std::size_t SoAVector<List, Alignment>::GetColumnAlignment(std::size_t columnIndex)
+	{
+		return std::max(Alignment, Layout::Alignments[columnIndex]);
+	}
+
+	// Returns the offset of each column in the storage, followed by the storage size
+	template<typename List, std::size_t Alignment>
+	constexpr auto SoAVector<List, Alignment>::ComputeOffsets(size_type capacity) -> std::array<std::size_t, ColumnCount + 1>
+	{
+		std::array<std::size_t, ColumnCount + 1> offsets = {};
+
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < ColumnCount; ++i)
+		{
+			offset = Align(offset, GetColumnAlignment(i));
+			offsets[i] = offset;
+			offset += capacity * Layout::Sizes[i];
+		}
+		offsets[ColumnCount] = offset;
+
+		return offsets;
+	}
+
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	SoAVector<List, Alignment>::Iterator<Const>::Iterator(VectorPtr vec, std::size_t index) noexcept :
+	m_vec(vec),
+	m_index(index)
+	{
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	template<bool C, typename>
+	SoAVector<List, Alignment>::Iterator<Const>::Iterator(const Iterator<false>& it) noexcept :
+	m_vec(it.m_vec),
+	m_index(it.m_index)
+	{
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	std::size_t SoAVector<List, Alignment>::Iterator<Const>::GetIndex() const noexcept
+	{
+		return m_index;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator*() const -> reference
+	{
+		return (*m_vec)[m_index];
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator[](difference_type n) const -> reference
+	{
+		return (*m_vec)[m_index + n];
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator++() -> Iterator&
+	{
+		++m_index;
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator++(int) -> Iterator
+	{
+		Iterator it = *this;
+		++m_index;
+		return it;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator--() -> Iterator&
+	{
+		--m_index;
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator--(int) -> Iterator
+	{
+		Iterator it = *this;
+		--m_index;
+		return it;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator+=(difference_type n) -> Iterator&
+	{
+		m_index += n;
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator-=(difference_type n) -> Iterator&
+	{
+		m_index -= n;
+		return *this;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator+(difference_type n) const -> Iterator
+	{
+		return Iterator(m_vec, m_index + n);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator-(difference_type n) const -> Iterator
+	{
+		return Iterator(m_vec, m_index - n);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	auto SoAVector<List, Alignment>::Iterator<Const>::operator-(const Iterator& it) const -> difference_type
+	{
+		return static_cast<difference_type>(m_index) - static_cast<difference_type>(it.m_index);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator==(const Iterator& it) const
+	{
+		assert(m_vec == it.m_vec);
+		return m_index == it.m_index;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator!=(const Iterator& it) const
+	{
+		return !operator==(it);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator<(const Iterator& it) const
+	{
+		assert(m_vec == it.m_vec);
+		return m_index < it.m_index;
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator<=(const Iterator& it) const
+	{
+		return !it.operator<(*this);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator>(const Iterator& it) const
+	{
+		return it.operator<(*this);
+	}
+
+	template<typename List, std::size_t Alignment>
+	template<bool Const>
+	bool SoAVector<List, Alignment>::Iterator<Const>::operator>=(const Iterator& it) const
+	{
+		return !operator<(it);
+	}
+}
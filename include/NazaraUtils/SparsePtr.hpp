@@ -84,6 +84,10 @@ namespace Nz
 
 	template<typename T>
 	SparsePtr(T*, std::size_t) -> SparsePtr<T>;
+
+	template<typename T> void CopyFrom(const std::remove_const_t<T>* src, SparsePtr<T> dst, std::size_t count);
+	template<typename T> void CopyTo(SparsePtr<T> src, std::remove_const_t<T>* dst, std::size_t count);
+	template<typename T, typename U, typename F> void Transform(SparsePtr<T> src, U* dst, std::size_t count, F&& func);
 }
 
 #include <NazaraUtils/SparsePtr.inl>
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <cassert>
+#include <cstring>
 #include <iterator>
 #include <limits>
 
@@ -463,6 +464,130 @@ namespace Nz
 	{
 		return m_ptr >= ptr.m_ptr;
 	}
+
+	namespace Detail
+	{
+		// Calls func(index, elementPtr) for each element, unrolled four times to avoid a multiplication and a loop branch per element
+		template<typename BytePtr, typename Stride, typename F>
+		void ForEachSparseElement(BytePtr ptr, Stride stride, std::size_t count, F&& func)
+		{
+			std::size_t unrolledCount = count - count % 4;
+			for (std::size_t i = 0; i < unrolledCount; i += 4)
+			{
+				func(i + 0, ptr);
+				func(i + 1, ptr + stride);
+				func(i + 2, ptr + 2 * stride);
+				func(i + 3, ptr + 3 * stride);
+				ptr += 4 * stride;
+			}
+
+			for (std::size_t i = unrolledCount; i < count; ++i)
+			{
+				func(i, ptr);
+				ptr += stride;
+			}
+		}
+
+		// Common strides (e.g. deinterleaving one attribute out of a vertex of 2, 3 or 4 attributes of the same size) are made compile-time constants
+		// which lets the compiler vectorize the loop using shuffles
+		template<typename T, typename BytePtr, typename F>
+		void DispatchSparseStride(BytePtr ptr, int stride, std::size_t count, F&& func)
+		{
+			constexpr int ElementSize = int(sizeof(T));
+
+			switch (stride)
+			{
+				case 2 * ElementSize: return ForEachSparseElement(ptr, std::integral_constant<int, 2 * ElementSize>{}, count, func);
+				case 3 * ElementSize: return ForEachSparseElement(ptr, std::integral_constant<int, 3 * ElementSize>{}, count, func);
+				case 4 * ElementSize: return ForEachSparseElement(ptr, std::integral_constant<int, 4 * ElementSize>{}, count, func);
+				default:              return ForEachSparseElement(ptr, std::ptrdiff_t(stride), count, func);
+			}
+		}
+	}
+
+	/*!
+	* \brief Copies contiguous elements to the memory pointed by a sparse pointer (scatter)
+	*
+	* \param src Pointer to the first element to copy
+	* \param dst Sparse pointer to the first element to write
+	* \param count Number of elements to copy
+	*
+	* \remark If dst stride is equal to the element size, trivially copyable elements are copied using memcpy
+	*
+	* \see CopyTo
+	*/
+	template<typename T>
+	void CopyFrom(const std::remove_const_t<T>* src, SparsePtr<T> dst, std::size_t count)
+	{
+		static_assert(!std::is_const_v<T>, "destination must not be const");
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (dst.GetStride() == int(sizeof(T)))
+			{
+				if (count > 0)
+					std::memcpy(dst.GetPtr(), src, count * sizeof(T));
+
+				return;
+			}
+		}
+
+		Detail::DispatchSparseStride<T>(static_cast<UInt8*>(dst.GetPtr()), dst.GetStride(), count, [&](std::size_t i, UInt8* ptr)
+		{
+			*reinterpret_cast<T*>(ptr) = src[i];
+		});
+	}
+
+	/*!
+	* \brief Copies elements pointed by a sparse pointer to contiguous memory (gather)
+	*
+	* \param src Sparse pointer to the first element to copy
+	* \param dst Pointer to the memory receiving the elements
+	* \param count Number of elements to copy
+	*
+	* \remark If src stride is equal to the element size, trivially copyable elements are copied using memcpy
+	*
+	* \see CopyFrom
+	* \see Transform
+	*/
+	template<typename T>
+	void CopyTo(SparsePtr<T> src, std::remove_const_t<T>* dst, std::size_t count)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (src.GetStride() == int(sizeof(T)))
+			{
+				if (count > 0)
+					std::memcpy(dst, src.GetPtr(), count * sizeof(T));
+
+				return;
+			}
+		}
+
+		Detail::DispatchSparseStride<T>(static_cast<const UInt8*>(src.GetPtr()), src.GetStride(), count, [&](std::size_t i, const UInt8* ptr)
+		{
+			dst[i] = *reinterpret_cast<const T*>(ptr);
+		});
+	}
+
+	/*!
+	* \brief Applies a function to elements pointed by a sparse pointer, storing the results in contiguous memory
+	*
+	* \param src Sparse pointer to the first element to transform
+	* \param dst Pointer to the memory receiving the results
+	* \param count Number of elements to transform
+	* \param func Function called as dst[i] = func(src[i])
+	*
+	* \see CopyTo
+	*/
+	template<typename T, typename U, typename F>
+	void Transform(SparsePtr<T> src, U* dst, std::size_t count, F&& func)
+	{
+		Detail::DispatchSparseStride<T>(static_cast<const UInt8*>(src.GetPtr()), src.GetStride(), count, [&](std::size_t i, const UInt8* ptr)
+		{
+			dst[i] = func(*reinterpret_cast<const T*>(ptr));
+		});
+	}
 }
 
 namespace std
@@ -0,0 +1,77 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SPARSESPAN_HPP
+#define NAZARAUTILS_SPARSESPAN_HPP
+
+#include <NazaraUtils/SparsePtr.hpp>
+#include <NazaraUtils/StaticSparsePtr.hpp>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace Nz
+{
+	constexpr int DynamicSparseStride = std::numeric_limits<int>::min();
+
+	template<typename T, int Stride = DynamicSparseStride>
+	class SparseSpan
+	{
+		public:
+			using element_type = T;
+			using iterator = std::conditional_t<Stride == DynamicSparseStride, SparsePtr<T>, StaticSparsePtr<T, Stride>>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = iterator;
+			using reference = T&;
+			using size_type = std::size_t;
+			using value_type = std::remove_cv_t<T>;
+
+			constexpr SparseSpan() noexcept;
+			SparseSpan(iterator ptr, size_type size) noexcept;
+			template<typename U, int S, typename = std::enable_if_t<(Stride == DynamicSparseStride || S == Stride) && std::is_convertible_v<U*, T*>>> SparseSpan(const SparseSpan<U, S>& span) noexcept;
+			SparseSpan(const SparseSpan&) noexcept = default;
+			~SparseSpan() = default;
+
+			T& back() const;
+
+			iterator begin() const noexcept;
+
+			iterator data() const noexcept;
+
+			constexpr bool empty() const noexcept;
+
+			iterator end() const noexcept;
+
+			SparseSpan first(size_type count) const;
+
+			T& front() const;
+
+			SparseSpan last(size_type count) const;
+
+			constexpr size_type size() const noexcept;
+
+			SparseSpan subspan(size_type offset, size_type count) const;
+
+			T& operator[](size_type index) const;
+
+			SparseSpan& operator=(const SparseSpan&) noexcept = default;
+
+		private:
+			iterator m_ptr;
+			size_type m_size;
+	};
+
+	// Deduction guides
+	template<typename T>
+	SparseSpan(SparsePtr<T>, std::size_t) -> SparseSpan<T>;
+
+	template<typename T, int Stride>
+	SparseSpan(StaticSparsePtr<T, Stride>, std::size_t) -> SparseSpan<T, Stride>;
+}
+
+#include <NazaraUtils/SparseSpan.inl>
+
+#endif // NAZARAUTILS_SPARSESPAN_HPP
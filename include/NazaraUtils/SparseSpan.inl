@@ -0,0 +1,148 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SparseSpan
+	* \brief Core class that represents a view over a known number of strided elements
+	*
+	* The stride is either a runtime one (iterating using SparsePtr) or a compile-time one (iterating using StaticSparsePtr) when Stride is given.
+	*/
+
+	/*!
+	* \brief Constructs an empty SparseSpan object
+	*/
+
+	template<typename T, int Stride>
+	constexpr SparseSpan<T, Stride>::SparseSpan() noexcept :
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a SparseSpan object from a sparse pointer and an element count
+	*
+	* \param ptr Sparse pointer to the first element
+	* \param size Number of elements
+	*/
+
+	template<typename T, int Stride>
+	SparseSpan<T, Stride>::SparseSpan(iterator ptr, size_type size) noexcept :
+	m_ptr(ptr),
+	m_size(size)
+	{
+	}
+
+	/*!
+	* \brief Constructs a SparseSpan object from another SparseSpan
+	*
+	* \param span Span to convert (a compile-time stride span can be converted to a runtime stride one)
+	*/
+
+	template<typename T, int Stride>
+	template<typename U, int S, typename>
+	SparseSpan<T, Stride>::SparseSpan(const SparseSpan<U, S>& span) noexcept :
+	m_ptr(span.data()),
+	m_size(span.size())
+	{
+	}
+
+	template<typename T, int Stride>
+	T& SparseSpan<T, Stride>::back() const
+	{
+		assert(!empty());
+		return m_ptr[m_size - 1];
+	}
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::begin() const noexcept -> iterator
+	{
+		return m_ptr;
+	}
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::data() const noexcept -> iterator
+	{
+		return m_ptr;
+	}
+
+	template<typename T, int Stride>
+	constexpr bool SparseSpan<T, Stride>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::end() const noexcept -> iterator
+	{
+		return m_ptr + m_size;
+	}
+
+	/*!
+	* \brief Gets a span over the first elements
+	* \return Span over the count first elements
+	*
+	* \param count Number of elements, must be less or equal to the span size
+	*/
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::first(size_type count) const -> SparseSpan
+	{
+		assert(count <= m_size);
+		return SparseSpan(m_ptr, count);
+	}
+
+	template<typename T, int Stride>
+	T& SparseSpan<T, Stride>::front() const
+	{
+		assert(!empty());
+		return *m_ptr;
+	}
+
+	/*!
+	* \brief Gets a span over the last elements
+	* \return Span over the count last elements
+	*
+	* \param count Number of elements, must be less or equal to the span size
+	*/
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::last(size_type count) const -> SparseSpan
+	{
+		assert(count <= m_size);
+		return SparseSpan(m_ptr + (m_size - count), count);
+	}
+
+	template<typename T, int Stride>
+	constexpr auto SparseSpan<T, Stride>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Gets a span over a part of this span
+	* \return Span over count elements starting at offset
+	*
+	* \param offset Index of the first element
+	* \param count Number of elements
+	*/
+
+	template<typename T, int Stride>
+	auto SparseSpan<T, Stride>::subspan(size_type offset, size_type count) const -> SparseSpan
+	{
+		assert(offset <= m_size && count <= m_size - offset);
+		return SparseSpan(m_ptr + offset, count);
+	}
+
+	template<typename T, int Stride>
+	T& SparseSpan<T, Stride>::operator[](size_type index) const
+	{
+		assert(index < m_size);
+		return m_ptr[index];
+	}
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SPSCQUEUE_HPP
+#define NAZARAUTILS_SPSCQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Nz
+{
+NAZARA_WARNING_PUSH()
+NAZARA_WARNING_MSVC_DISABLE(4324) // structure was padded due to alignment specifier
+
+	template<typename T, std::size_t Capacity>
+	class SpscQueue
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+		public:
+			SpscQueue();
+			SpscQueue(const SpscQueue&) = delete;
+			SpscQueue(SpscQueue&&) = delete;
+			~SpscQueue();
+
+			std::size_t GetSize() const;
+
+			bool IsEmpty() const;
+
+			bool TryPop(T& value);
+			template<typename OutputIt> std::size_t TryPopN(OutputIt output, std::size_t count);
+
+			template<typename... Args> bool TryEmplace(Args&&... args);
+			bool TryPush(const T& value);
+			bool TryPush(T&& value);
+			template<typename InputIt> std::size_t TryPushN(InputIt first, std::size_t count);
+
+			SpscQueue& operator=(const SpscQueue&) = delete;
+			SpscQueue& operator=(SpscQueue&&) = delete;
+
+			static constexpr std::size_t GetCapacity();
+
+		private:
+			T* GetSlot(std::size_t index);
+
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			// consumer-owned cache line
+			alignas(CacheLineSize) std::atomic<std::size_t> m_head;
+			std::size_t m_cachedTail; //< last tail value seen by the consumer
+
+			// producer-owned cache line
+			alignas(CacheLineSize) std::atomic<std::size_t> m_tail;
+			std::size_t m_cachedHead; //< last head value seen by the producer
+
+			alignas(CacheLineSize) alignas(T) std::array<std::byte, sizeof(T) * Capacity> m_data;
+	};
+
+NAZARA_WARNING_POP()
+}
+
+#include <NazaraUtils/SpscQueue.inl>
+
+#endif // NAZARAUTILS_SPSCQUEUE_HPP
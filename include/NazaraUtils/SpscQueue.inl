@@ -0,0 +1,198 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SpscQueue
+	* \brief Lock-free bounded queue for exactly one producer thread and one consumer thread
+	*
+	* Elements are stored inplace in a power-of-two circular array, the queue never allocates.
+	* Head and tail indices live on separate cache lines, and each side keeps a cached copy of the other side index to avoid touching its cache line
+	* unless the queue looks full (for the producer) or empty (for the consumer).
+	*
+	* \remark Push functions must only be called from the producer thread, and pop functions from the consumer thread
+	*/
+
+	template<typename T, std::size_t Capacity>
+	SpscQueue<T, Capacity>::SpscQueue() :
+	m_head(0),
+	m_cachedTail(0),
+	m_tail(0),
+	m_cachedHead(0)
+	{
+	}
+
+	/*!
+	* \brief Destroys the queue and every element still in it
+	*
+	* \remark Neither the producer nor the consumer must be using the queue at this point
+	*/
+	template<typename T, std::size_t Capacity>
+	SpscQueue<T, Capacity>::~SpscQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::size_t tail = m_tail.load(std::memory_order_acquire);
+			for (std::size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+				PlacementDestroy(GetSlot(head));
+		}
+	}
+
+	/*!
+	* \brief Returns the number of elements in the queue
+	*
+	* \remark When called concurrently with pushes or pops, the result may already be outdated when returned
+	*/
+	template<typename T, std::size_t Capacity>
+	std::size_t SpscQueue<T, Capacity>::GetSize() const
+	{
+		std::size_t head = m_head.load(std::memory_order_acquire);
+		std::size_t tail = m_tail.load(std::memory_order_acquire);
+		return std::min(tail - head, Capacity); //< head may have been loaded before a pop on a previous lap
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SpscQueue<T, Capacity>::IsEmpty() const
+	{
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Moves the front element into value and removes it from the queue
+	* \return True if an element was popped, false if the queue was empty
+	*
+	* \param value Object receiving the popped element by move-assignment
+	*/
+	template<typename T, std::size_t Capacity>
+	bool SpscQueue<T, Capacity>::TryPop(T& value)
+	{
+		return TryPopN(&value, 1) == 1;
+	}
+
+	/*!
+	* \brief Pops up to count elements in a single operation
+	* \return Number of popped elements
+	*
+	* \param output Output iterator receiving the popped elements by move-assignment
+	* \param count Maximum number of elements to pop
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename OutputIt>
+	std::size_t SpscQueue<T, Capacity>::TryPopN(OutputIt output, std::size_t count)
+	{
+		std::size_t head = m_head.load(std::memory_order_relaxed);
+		if (m_cachedTail - head < count)
+		{
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			count = std::min(count, m_cachedTail - head);
+			if (count == 0)
+				return 0;
+		}
+
+		// release the popped slots even if a move-assignment throws
+		std::size_t i = 0;
+		CallOnExit publish([&] { m_head.store(head + i, std::memory_order_release); });
+
+		for (; i < count; ++i)
+		{
+			T* element = GetSlot(head + i);
+			*output = std::move(*element);
+			++output;
+
+			PlacementDestroy(element);
+		}
+
+		return count;
+	}
+
+	/*!
+	* \brief Constructs an element at the back of the queue
+	* \return True if the element was pushed, false if the queue was full
+	*
+	* \param args Arguments used to construct the element
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	bool SpscQueue<T, Capacity>::TryEmplace(Args&&... args)
+	{
+		std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead == Capacity)
+		{
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead == Capacity)
+				return false;
+		}
+
+		PlacementNew(GetSlot(tail), std::forward<Args>(args)...);
+		m_tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SpscQueue<T, Capacity>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SpscQueue<T, Capacity>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	/*!
+	* \brief Pushes up to count elements in a single operation
+	* \return Number of pushed elements, elements are read in order from first so the pushed elements are always the first ones
+	*
+	* \param first Iterator to the first element to push (use std::make_move_iterator to move them)
+	* \param count Maximum number of elements to push
+	*
+	* \remark The tail index is only published once for the whole batch
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	std::size_t SpscQueue<T, Capacity>::TryPushN(InputIt first, std::size_t count)
+	{
+		std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (Capacity - (tail - m_cachedHead) < count)
+		{
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			count = std::min(count, Capacity - (tail - m_cachedHead));
+			if (count == 0)
+				return 0;
+		}
+
+		// publish the constructed elements even if a construction throws
+		std::size_t i = 0;
+		CallOnExit publish([&] { m_tail.store(tail + i, std::memory_order_release); });
+
+		for (; i < count; ++i)
+		{
+			PlacementNew(GetSlot(tail + i), *first);
+			++first;
+		}
+
+		return count;
+	}
+
+	template<typename T, std::size_t Capacity>
+	constexpr std::size_t SpscQueue<T, Capacity>::GetCapacity()
+	{
+		return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	T* SpscQueue<T, Capacity>::GetSlot(std::size_t index)
+	{
+		return std::launder(reinterpret_cast<T*>(&m_data[0]) + (index & Mask));
+	}
+}
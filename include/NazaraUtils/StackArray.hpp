@@ -7,15 +7,20 @@
 #ifndef NAZARAUTILS_STACKARRAY_HPP
 #define NAZARAUTILS_STACKARRAY_HPP
 
+#include <NazaraUtils/ArenaAllocator.hpp>
 #include <NazaraUtils/MemoryHelper.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
 
+// Allocates from the thread-local arena instead of the stack (for big arrays which could overflow the stack)
+#define NazaraArenaStackArray(T, size) Nz::StackArray<T>(Nz::ArenaAllocator::GetThreadLocal(), size)
+#define NazaraArenaStackArrayNoInit(T, size) Nz::StackArray<T>(Nz::ArenaAllocator::GetThreadLocal(), size, typename Nz::StackArray<T>::NoInitTag())
+
 #ifdef NAZARA_ALLOCA_SUPPORT
 	#define NazaraStackArray(T, size) Nz::StackArray<T>(static_cast<T*>(NAZARA_ALLOCA((size) * sizeof(T))), size)
 	#define NazaraStackArrayNoInit(T, size) Nz::StackArray<T>(static_cast<T*>(NAZARA_ALLOCA((size) * sizeof(T))), size, typename Nz::StackArray<T>::NoInitTag())
 #else
-	#define NazaraStackArray(T, size) Nz::StackArray<T>(static_cast<T*>(Nz::OperatorNew((size) * sizeof(T))), size)
-	#define NazaraStackArrayNoInit(T, size) Nz::StackArray<T>(static_cast<T*>(Nz::OperatorNew((size) * sizeof(T))), size, typename Nz::StackArray<T>::NoInitTag())
+	#define NazaraStackArray(T, size) NazaraArenaStackArray(T, size)
+	#define NazaraStackArrayNoInit(T, size) NazaraArenaStackArrayNoInit(T, size)
 #endif
 
 #include <cstddef>
@@ -44,6 +49,8 @@ namespace Nz
 			StackArray();
 			StackArray(T* stackMemory, std::size_t size);
 			StackArray(T* stackMemory, std::size_t size, NoInitTag);
+			StackArray(ArenaAllocator& arena, std::size_t size);
+			StackArray(ArenaAllocator& arena, std::size_t size, NoInitTag);
 			StackArray(const StackArray&) = delete;
 			StackArray(StackArray&&) = default;
 			~StackArray();
@@ -90,6 +97,7 @@ namespace Nz
 
 		private:
 			std::size_t m_size;
+			MovablePtr<ArenaAllocator> m_arena;
 			MovablePtr<T> m_ptr;
 	};
 
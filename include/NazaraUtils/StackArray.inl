@@ -13,11 +13,14 @@ namespace Nz
 	* \ingroup utils
 	* \class Nz::StackArray
 	* \brief Core class that represents a stack-allocated (if alloca is present) array
+	*
+	* \remark Without alloca support, arrays are allocated from the thread-local ArenaAllocator (NazaraArenaStackArray does it explicitly)
 	*/
 
 	template<typename T>
 	StackArray<T>::StackArray() :
 	m_size(0),
+	m_arena(nullptr),
 	m_ptr(nullptr)
 	{
 	}
@@ -25,6 +28,7 @@ namespace Nz
 	template<typename T>
 	StackArray<T>::StackArray(T* stackMemory, std::size_t size) :
 	m_size(size),
+	m_arena(nullptr),
 	m_ptr(stackMemory)
 	{
 		for (std::size_t i = 0; i < m_size; ++i)
@@ -34,19 +38,35 @@ namespace Nz
 	template<typename T>
 	StackArray<T>::StackArray(T* stackMemory, std::size_t size, NoInitTag) :
 	m_size(size),
+	m_arena(nullptr),
 	m_ptr(stackMemory)
 	{
 	}
 
+	template<typename T>
+	StackArray<T>::StackArray(ArenaAllocator& arena, std::size_t size) :
+	StackArray(arena, size, NoInitTag{})
+	{
+		for (std::size_t i = 0; i < m_size; ++i)
+			PlacementNew(&m_ptr[i]);
+	}
+
+	template<typename T>
+	StackArray<T>::StackArray(ArenaAllocator& arena, std::size_t size, NoInitTag) :
+	m_size(size),
+	m_arena(&arena),
+	m_ptr(arena.Allocate<T>(size))
+	{
+	}
+
 	template<typename T>
 	StackArray<T>::~StackArray()
 	{
 		for (std::size_t i = 0; i < m_size; ++i)
 			PlacementDestroy(&m_ptr[i]);
 
-		#ifndef NAZARA_ALLOCA_SUPPORT
-		OperatorDelete(m_ptr);
-		#endif
+		if (m_arena)
+			m_arena->Deallocate(m_ptr, m_size * sizeof(T));
 	}
 
 	template<typename T>
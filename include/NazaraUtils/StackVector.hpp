@@ -7,13 +7,17 @@
 #ifndef NAZARAUTILS_STACKVECTOR_HPP
 #define NAZARAUTILS_STACKVECTOR_HPP
 
+#include <NazaraUtils/ArenaAllocator.hpp>
 #include <NazaraUtils/MemoryHelper.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
 
+// Allocates from the thread-local arena instead of the stack (for big vectors which could overflow the stack)
+#define NazaraArenaStackVector(T, capacity) Nz::StackVector<T>(Nz::ArenaAllocator::GetThreadLocal(), capacity)
+
 #ifdef NAZARA_ALLOCA_SUPPORT
 	#define NazaraStackVector(T, capacity) Nz::StackVector<T>(static_cast<T*>(NAZARA_ALLOCA((capacity) * sizeof(T))), capacity)
 #else
-	#define NazaraStackVector(T, capacity) Nz::StackVector<T>(static_cast<T*>(operator new((capacity) * sizeof(T))), capacity)
+	#define NazaraStackVector(T, capacity) NazaraArenaStackVector(T, capacity)
 #endif
 
 #include <cstddef>
@@ -40,10 +44,14 @@ namespace Nz
 
 			StackVector();
 			StackVector(T* stackMemory, std::size_t capacity);
+			StackVector(ArenaAllocator& arena, std::size_t capacity);
 			StackVector(const StackVector&) = delete;
 			StackVector(StackVector&&) noexcept = default;
 			~StackVector();
 
+			template<typename InputIt>
+			iterator append(InputIt first, InputIt last);
+
 			reference back();
 			const_reference back() const;
 
@@ -81,6 +89,8 @@ namespace Nz
 
 			iterator insert(const_iterator pos, const T& value);
 			iterator insert(const_iterator pos, T&& value);
+			template<typename InputIt>
+			iterator insert(const_iterator pos, InputIt first, InputIt last);
 
 			size_type max_size() const noexcept;
 
@@ -91,6 +101,8 @@ namespace Nz
 
 			void resize(size_type count);
 			void resize(size_type count, const value_type& value);
+			void resize_default_init(size_type count);
+			void resize_uninitialized(size_type count);
 
 			reverse_iterator rbegin() noexcept;
 			const_reverse_iterator rbegin() const noexcept;
@@ -109,6 +121,7 @@ namespace Nz
 		private:
 			std::size_t m_capacity;
 			std::size_t m_size;
+			MovablePtr<ArenaAllocator> m_arena;
 			MovablePtr<T> m_ptr;
 	};
 
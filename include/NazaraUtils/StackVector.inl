@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <new>
 #include <utility>
 
@@ -13,12 +14,16 @@ namespace Nz
 	* \ingroup utils
 	* \class StackVector
 	* \brief Core class that represents a stack-allocated (if alloca is present) vector, that is with a capacity different from its size
+	*
+	* \remark Without alloca support, vectors are allocated from the thread-local ArenaAllocator (NazaraArenaStackVector does it explicitly)
+	* \remark Trivially relocatable types (see IsTriviallyRelocatable) are inserted and erased using memmove
 	*/
 
 	template<typename T>
 	StackVector<T>::StackVector() :
 	m_capacity(0),
 	m_size(0),
+	m_arena(nullptr),
 	m_ptr(nullptr)
 	{
 	}
@@ -27,18 +32,58 @@ namespace Nz
 	StackVector<T>::StackVector(T* stackMemory, std::size_t capacity) :
 	m_capacity(capacity),
 	m_size(0),
+	m_arena(nullptr),
 	m_ptr(stackMemory)
 	{
 	}
 
+	template<typename T>
+	StackVector<T>::StackVector(ArenaAllocator& arena, std::size_t capacity) :
+	m_capacity(capacity),
+	m_size(0),
+	m_arena(&arena),
+	m_ptr(arena.Allocate<T>(capacity))
+	{
+	}
+
 	template<typename T>
 	StackVector<T>::~StackVector()
 	{
 		clear();
 
-		#ifndef NAZARA_ALLOCA_SUPPORT
-		operator delete(m_ptr);
-		#endif
+		if (m_arena)
+			m_arena->Deallocate(m_ptr, m_capacity * sizeof(T));
+	}
+
+	/*!
+	* \brief Appends a range of elements at the end of the vector
+	* \return Iterator to the first appended element
+	*
+	* \param first Iterator to the first element to append
+	* \param last Iterator past the last element to append
+	*
+	* \remark With forward iterators, this checks capacity once and copies the range in bulk
+	*/
+	template<typename T>
+	template<typename InputIt>
+	typename StackVector<T>::iterator StackVector<T>::append(InputIt first, InputIt last)
+	{
+		std::size_t index = m_size;
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			assert(m_size + count <= m_capacity);
+
+			std::uninitialized_copy(first, last, &m_ptr[m_size]);
+			m_size += count;
+		}
+		else
+		{
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+
+		return iterator(&m_ptr[index]);
 	}
 
 	template<typename T>
@@ -123,7 +168,20 @@ namespace Nz
 		assert(pos >= begin() && pos <= end());
 
 		std::size_t index = std::distance(cbegin(), pos);
-		if (pos < end())
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			if (index < m_size)
+			{
+				// args may reference an element we're about to relocate
+				T value(std::forward<Args>(args)...);
+
+				RelocateRange(&m_ptr[index], &m_ptr[index + 1], m_size - index);
+				m_size++;
+
+				return PlacementNew(&m_ptr[index], std::move(value));
+			}
+		}
+		else if (pos < end())
 		{
 			iterator lastElement = end() - 1;
 			PlacementNew(&m_ptr[m_size], std::move(*lastElement));
@@ -169,8 +227,17 @@ namespace Nz
 	{
 		assert(pos < end());
 		std::size_t index = std::distance(cbegin(), pos);
-		std::move(begin() + index + 1, end(), begin() + index);
-		pop_back();
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			PlacementDestroy(&m_ptr[index]);
+			RelocateRange(&m_ptr[index + 1], &m_ptr[index], m_size - index - 1);
+			m_size--;
+		}
+		else
+		{
+			std::move(begin() + index + 1, end(), begin() + index);
+			pop_back();
+		}
 
 		return iterator(&m_ptr[index]);
 	}
@@ -188,8 +255,17 @@ namespace Nz
 
 		std::size_t count = std::distance(first, last);
 
-		std::move(begin() + index + count, end(), begin() + index);
-		resize(size() - count);
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			std::destroy(&m_ptr[index], &m_ptr[index + count]);
+			RelocateRange(&m_ptr[index + count], &m_ptr[index], m_size - index - count);
+			m_size -= count;
+		}
+		else
+		{
+			std::move(begin() + index + count, end(), begin() + index);
+			resize(size() - count);
+		}
 
 		return iterator(&m_ptr[index]);
 	}
@@ -220,6 +296,43 @@ namespace Nz
 		return emplace(pos, std::move(value));
 	}
 
+	/*!
+	* \brief Inserts a range of elements before pos
+	* \return Iterator to the first inserted element
+	*
+	* \param pos Iterator before which the elements are inserted
+	* \param first Iterator to the first element to insert
+	* \param last Iterator past the last element to insert
+	*
+	* \remark The range must not be part of the vector
+	*/
+	template<typename T>
+	template<typename InputIt>
+	typename StackVector<T>::iterator StackVector<T>::insert(const_iterator pos, InputIt first, InputIt last)
+	{
+		assert(pos >= begin() && pos <= end());
+
+		std::size_t index = std::distance(cbegin(), pos);
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			std::size_t count = std::distance(first, last);
+			assert(m_size + count <= m_capacity);
+
+			RelocateRange(&m_ptr[index], &m_ptr[index + count], m_size - index);
+
+			std::uninitialized_copy(first, last, &m_ptr[index]);
+			m_size += count;
+		}
+		else
+		{
+			std::size_t oldSize = m_size;
+			append(first, last);
+			std::rotate(begin() + index, begin() + oldSize, end());
+		}
+
+		return iterator(&m_ptr[index]);
+	}
+
 	template<typename T>
 	typename StackVector<T>::size_type StackVector<T>::max_size() const noexcept
 	{
@@ -260,8 +373,11 @@ namespace Nz
 		}
 		else if (count < m_size)
 		{
-			for (std::size_t i = count; i < m_size; ++i)
-				PlacementDestroy(&m_ptr[i]);
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(&m_ptr[i]);
+			}
 
 			m_size = count;
 		}
@@ -280,13 +396,65 @@ namespace Nz
 		}
 		else if (count < m_size)
 		{
-			for (std::size_t i = count; i < m_size; ++i)
-				PlacementDestroy(&m_ptr[i]);
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(&m_ptr[i]);
+			}
 
 			m_size = count;
 		}
 	}
 
+	/*!
+	* \brief Resizes the vector, default-initializing new elements
+	*
+	* \param count New size of the vector
+	*
+	* \remark Unlike resize, this leaves new elements of trivial types uninitialized (useful for buffers which are about to be filled)
+	*/
+	template<typename T>
+	void StackVector<T>::resize_default_init(size_type count)
+	{
+		assert(count <= m_capacity);
+		if (count > m_size)
+		{
+			if constexpr (!std::is_trivially_default_constructible_v<T>)
+			{
+				for (std::size_t i = m_size; i < count; ++i)
+					::new (static_cast<void*>(&m_ptr[i])) T;
+			}
+
+			m_size = count;
+		}
+		else if (count < m_size)
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (std::size_t i = count; i < m_size; ++i)
+					PlacementDestroy(&m_ptr[i]);
+			}
+
+			m_size = count;
+		}
+	}
+
+	/*!
+	* \brief Resizes the vector without initializing new elements, which must be written before being read
+	*
+	* \param count New size of the vector
+	*
+	* \remark T must be a trivial type
+	*/
+	template<typename T>
+	void StackVector<T>::resize_uninitialized(size_type count)
+	{
+		static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>, "resize_uninitialized requires a trivial type");
+
+		assert(count <= m_capacity);
+		m_size = count;
+	}
+
 	template<typename T>
 	typename StackVector<T>::reverse_iterator StackVector<T>::rbegin() noexcept
 	{
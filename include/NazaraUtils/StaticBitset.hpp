@@ -0,0 +1,156 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_STATICBITSET_HPP
+#define NAZARAUTILS_STATICBITSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Nz
+{
+	template<std::size_t N, typename Block = UInt32>
+	class StaticBitset
+	{
+		static_assert(std::is_integral<Block>::value && std::is_unsigned<Block>::value, "Block must be a unsigned integral type");
+
+		public:
+			class BitIterator;
+			struct bits_const_iter_tag;
+
+			constexpr StaticBitset() noexcept;
+			constexpr explicit StaticBitset(std::string_view bits);
+			template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>> constexpr explicit StaticBitset(T value) noexcept;
+			constexpr StaticBitset(const StaticBitset& bitset) = default;
+			constexpr StaticBitset(StaticBitset&& bitset) noexcept = default;
+			~StaticBitset() = default;
+
+			NAZARA_CONSTEXPR20 std::size_t Count() const noexcept;
+			NAZARA_CONSTEXPR20 std::size_t CountAnd(const StaticBitset& bitset) const noexcept;
+			NAZARA_CONSTEXPR20 std::size_t CountAndNot(const StaticBitset& bitset) const noexcept;
+			constexpr void Flip() noexcept;
+
+			NAZARA_CONSTEXPR20 std::size_t FindFirst() const noexcept;
+			NAZARA_CONSTEXPR20 std::size_t FindNext(std::size_t bit) const noexcept;
+
+			constexpr Block GetBlock(std::size_t i) const noexcept;
+
+			constexpr void PerformsAND(const StaticBitset& a, const StaticBitset& b) noexcept;
+			constexpr void PerformsANDNOT(const StaticBitset& a, const StaticBitset& b) noexcept;
+			constexpr void PerformsNOT(const StaticBitset& a) noexcept;
+			constexpr void PerformsOR(const StaticBitset& a, const StaticBitset& b) noexcept;
+			constexpr void PerformsXOR(const StaticBitset& a, const StaticBitset& b) noexcept;
+
+			constexpr bool Intersects(const StaticBitset& bitset) const noexcept;
+			constexpr bool IntersectsAndNot(const StaticBitset& bitset) const noexcept;
+			constexpr bool IsSubsetOf(const StaticBitset& bitset) const noexcept;
+
+			constexpr bits_const_iter_tag IterBits() const noexcept;
+
+			constexpr void Reset() noexcept;
+			constexpr void Reset(std::size_t bit) noexcept;
+
+			constexpr void Set(bool val = true) noexcept;
+			constexpr void Set(std::size_t bit, bool val = true) noexcept;
+			constexpr void SetBlock(std::size_t i, Block block) noexcept;
+
+			constexpr bool Test(std::size_t bit) const noexcept;
+			constexpr bool TestAll() const noexcept;
+			constexpr bool TestAny() const noexcept;
+			constexpr bool TestNone() const noexcept;
+
+			template<typename T> constexpr T To() const noexcept;
+			std::string ToString() const;
+
+			constexpr bool operator[](std::size_t index) const noexcept;
+
+			constexpr StaticBitset operator~() const noexcept;
+
+			constexpr StaticBitset& operator=(const StaticBitset& bitset) = default;
+			constexpr StaticBitset& operator=(StaticBitset&& bitset) noexcept = default;
+
+			constexpr StaticBitset& operator&=(const StaticBitset& bitset) noexcept;
+			constexpr StaticBitset& operator|=(const StaticBitset& bitset) noexcept;
+			constexpr StaticBitset& operator^=(const StaticBitset& bitset) noexcept;
+
+			static constexpr std::size_t GetBlockCount() noexcept;
+			static constexpr std::size_t GetSize() noexcept;
+
+			static constexpr std::size_t bitsPerBlock = BitCount<Block>();
+			static constexpr std::size_t blockCount = (N + bitsPerBlock - 1) / bitsPerBlock;
+			static constexpr Block fullBitMask = std::numeric_limits<Block>::max();
+			static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+			struct bits_const_iter_tag
+			{
+				constexpr BitIterator begin() const noexcept;
+				constexpr BitIterator end() const noexcept;
+
+				const StaticBitset& bitsetRef;
+			};
+
+		private:
+			constexpr void ResetExtraBits() noexcept;
+
+			static constexpr Block lastBlockMask = (N % bitsPerBlock != 0) ? Block((Block(1U) << (N % bitsPerBlock)) - 1U) : fullBitMask;
+
+			std::array<Block, blockCount> m_blocks;
+	};
+
+	template<std::size_t N, typename Block>
+	class StaticBitset<N, Block>::BitIterator
+	{
+		friend StaticBitset;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::size_t;
+
+			constexpr BitIterator(const BitIterator&) = default;
+			constexpr BitIterator(BitIterator&&) noexcept = default;
+
+			constexpr BitIterator& operator=(const BitIterator&) = default;
+			constexpr BitIterator& operator=(BitIterator&&) noexcept = default;
+
+			NAZARA_CONSTEXPR20 BitIterator operator++(int);
+			NAZARA_CONSTEXPR20 BitIterator& operator++();
+
+			constexpr bool operator==(const BitIterator& rhs) const;
+			constexpr bool operator!=(const BitIterator& rhs) const;
+			constexpr value_type operator*() const;
+
+		private:
+			constexpr BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex);
+
+			std::size_t m_bitIndex;
+			const StaticBitset* m_owner;
+	};
+
+	template<std::size_t N, typename Block>
+	constexpr bool operator==(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept;
+
+	template<std::size_t N, typename Block>
+	constexpr bool operator!=(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept;
+
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator&(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept;
+
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator|(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept;
+
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator^(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept;
+}
+
+#include <NazaraUtils/StaticBitset.inl>
+
+#endif // NAZARAUTILS_STATICBITSET_HPP
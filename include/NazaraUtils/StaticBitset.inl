@@ -0,0 +1,704 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+
+// Bits tricks require us to disable some warnings under VS
+NAZARA_WARNING_PUSH()
+NAZARA_WARNING_MSVC_DISABLE(4146 4804)
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::StaticBitset
+	* \brief Core class that represents a set of N bits, with N known at compile-time
+	*
+	* Unlike Bitset, the storage is a std::array of blocks and the size is a compile-time constant, allowing the whole class to be used in constant expressions
+	* (as long as CountBits and FindFirstBit are, see NAZARA_CONSTEXPR20 for the functions relying on them) and loops to be unrolled.
+	*
+	* \see Bitset
+	*/
+
+	/*!
+	* \brief Constructs a StaticBitset object with every bit set to zero
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>::StaticBitset() noexcept :
+	m_blocks{}
+	{
+	}
+
+	/*!
+	* \brief Constructs a StaticBitset object from a string containing only '0' and '1'
+	*
+	* \param bits String of at most N characters, the last character being the first bit
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>::StaticBitset(std::string_view bits) :
+	m_blocks{}
+	{
+		assert(bits.size() <= N && "Too many bits");
+
+		for (std::size_t i = 0; i < bits.size(); ++i)
+		{
+			switch (bits[i])
+			{
+				case '1':
+					// We adapt the index (inversion in comparison to the string)
+					Set(bits.size() - i - 1, true);
+					break;
+
+				case '0':
+					// Each block is zero-initialised, nothing to do
+					break;
+
+				default:
+					assert((false) &&  "Unexpected char (neither 1 nor 0)");
+					break;
+			}
+		}
+	}
+
+	/*!
+	* \brief Constructs a StaticBitset object copying the first N bits of an integral number
+	*
+	* \param value Number to be used as a base
+	*/
+	template<std::size_t N, typename Block>
+	template<typename T, typename>
+	constexpr StaticBitset<N, Block>::StaticBitset(T value) noexcept :
+	m_blocks{}
+	{
+		using UnsignedT = std::make_unsigned_t<T>;
+		UnsignedT bits = static_cast<UnsignedT>(value);
+
+		for (std::size_t i = 0; i < blockCount && i * bitsPerBlock < BitCount<T>(); ++i)
+			m_blocks[i] = static_cast<Block>(bits >> (i * bitsPerBlock));
+
+		ResetExtraBits();
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1
+	* \return Number of bits set to 1
+	*/
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 std::size_t StaticBitset<N, Block>::Count() const noexcept
+	{
+		if constexpr (blockCount * sizeof(Block) >= Detail::BitKernelScalarThreshold)
+		{
+			if NAZARA_IS_RUNTIME_EVAL()
+				return BitKernels::Count(m_blocks.data(), blockCount * sizeof(Block));
+		}
+
+		return Detail::CountBlockBits(m_blocks.data(), blockCount);
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1 in both bitsets
+	* \return Number of bits set to 1 in (*this & bitset)
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 std::size_t StaticBitset<N, Block>::CountAnd(const StaticBitset& bitset) const noexcept
+	{
+		if constexpr (blockCount * sizeof(Block) >= Detail::BitKernelScalarThreshold)
+		{
+			if NAZARA_IS_RUNTIME_EVAL()
+				return BitKernels::CountAnd(m_blocks.data(), bitset.m_blocks.data(), blockCount * sizeof(Block));
+		}
+
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < blockCount; ++i)
+			count += CountBits(Block(m_blocks[i] & bitset.m_blocks[i]));
+
+		return count;
+	}
+
+	/*!
+	* \brief Counts the number of bits set to 1 in this bitset but not in the other one
+	* \return Number of bits set to 1 in (*this & ~bitset)
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 std::size_t StaticBitset<N, Block>::CountAndNot(const StaticBitset& bitset) const noexcept
+	{
+		if constexpr (blockCount * sizeof(Block) >= Detail::BitKernelScalarThreshold)
+		{
+			if NAZARA_IS_RUNTIME_EVAL()
+				return BitKernels::CountAndNot(m_blocks.data(), bitset.m_blocks.data(), blockCount * sizeof(Block));
+		}
+
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < blockCount; ++i)
+			count += CountBits(Block(m_blocks[i] & ~bitset.m_blocks[i]));
+
+		return count;
+	}
+
+	/*!
+	* \brief Flips each bit of the bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::Flip() noexcept
+	{
+		for (Block& block : m_blocks)
+			block ^= fullBitMask;
+
+		ResetExtraBits();
+	}
+
+	/*!
+	* \brief Finds the first bit set to one in the bitset
+	* \return The 0-based index of the first bit enabled, or npos if none is
+	*/
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 std::size_t StaticBitset<N, Block>::FindFirst() const noexcept
+	{
+		return Detail::FindFirstBlockBit(m_blocks.data(), blockCount, 0);
+	}
+
+	/*!
+	* \brief Finds the next enabled in the bitset
+	*
+	* \param bit Index of the last bit found, which will not be treated by this function
+	*
+	* \return Index of the next enabled bit or npos if all the following bits are disabled
+	*/
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 std::size_t StaticBitset<N, Block>::FindNext(std::size_t bit) const noexcept
+	{
+		assert(bit < N && "Bit index out of range");
+
+		return Detail::FindNextBlockBit(m_blocks.data(), blockCount, N, bit);
+	}
+
+	/*!
+	* \brief Gets the ith block
+	* \return Block in the bitset
+	*
+	* \param i Index of the block
+	*/
+	template<std::size_t N, typename Block>
+	constexpr Block StaticBitset<N, Block>::GetBlock(std::size_t i) const noexcept
+	{
+		assert(i < blockCount && "Block index out of range");
+
+		return m_blocks[i];
+	}
+
+	/*!
+	* \brief Performs the "AND" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::PerformsAND(const StaticBitset& a, const StaticBitset& b) noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_blocks[i] = a.m_blocks[i] & b.m_blocks[i];
+	}
+
+	/*!
+	* \brief Performs the "AND NOT" operator between two bitsets (a & ~b)
+	*
+	* \param a First bitset
+	* \param b Second bitset, which is negated
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::PerformsANDNOT(const StaticBitset& a, const StaticBitset& b) noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_blocks[i] = a.m_blocks[i] & ~b.m_blocks[i];
+	}
+
+	/*!
+	* \brief Performs the "NOT" operator of the bitset
+	*
+	* \param a Bitset to negate
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::PerformsNOT(const StaticBitset& a) noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_blocks[i] = ~a.m_blocks[i];
+
+		ResetExtraBits();
+	}
+
+	/*!
+	* \brief Performs the "OR" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::PerformsOR(const StaticBitset& a, const StaticBitset& b) noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_blocks[i] = a.m_blocks[i] | b.m_blocks[i];
+	}
+
+	/*!
+	* \brief Performs the "XOR" operator between two bitsets
+	*
+	* \param a First bitset
+	* \param b Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::PerformsXOR(const StaticBitset& a, const StaticBitset& b) noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_blocks[i] = a.m_blocks[i] ^ b.m_blocks[i];
+	}
+
+	/*!
+	* \brief Checks if bitsets have one bit set in common
+	*
+	* \param bitset Bitset to test
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::Intersects(const StaticBitset& bitset) const noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+		{
+			if (m_blocks[i] & bitset.m_blocks[i])
+				return true;
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Checks if this bitset has at least one bit set which isn't set in the other one
+	* \return True if (*this & ~bitset) has any bit set
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::IntersectsAndNot(const StaticBitset& bitset) const noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+		{
+			if (m_blocks[i] & ~bitset.m_blocks[i])
+				return true;
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Checks if every bit set in this bitset is also set in the other one
+	* \return True if this bitset is a subset of the other one
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::IsSubsetOf(const StaticBitset& bitset) const noexcept
+	{
+		return !IntersectsAndNot(bitset);
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr auto StaticBitset<N, Block>::IterBits() const noexcept -> bits_const_iter_tag
+	{
+		return bits_const_iter_tag{ *this };
+	}
+
+	/*!
+	* \brief Sets every bit to zero
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::Reset() noexcept
+	{
+		Set(false);
+	}
+
+	/*!
+	* \brief Sets the bit to zero
+	*
+	* \param bit Index of the bit
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::Reset(std::size_t bit) noexcept
+	{
+		Set(bit, false);
+	}
+
+	/*!
+	* \brief Sets every bit to a value
+	*
+	* \param val Value of the bits
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::Set(bool val) noexcept
+	{
+		for (Block& block : m_blocks)
+			block = (val) ? fullBitMask : Block(0U);
+
+		if (val)
+			ResetExtraBits();
+	}
+
+	/*!
+	* \brief Sets the bit to a value
+	*
+	* \param bit Index of the bit
+	* \param val Value of the bit
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::Set(std::size_t bit, bool val) noexcept
+	{
+		assert(bit < N && "Bit index out of range");
+
+		Block& block = m_blocks[bit / bitsPerBlock];
+		Block mask = Block(1U) << (bit % bitsPerBlock);
+
+		// https://graphics.stanford.edu/~seander/bithacks.html#ConditionalSetOrClearBitsWithoutBranching
+		block = (block & ~mask) | (-Block(val) & mask);
+	}
+
+	/*!
+	* \brief Sets the ith block
+	*
+	* \param i Index of the block
+	* \param block Block to set
+	*/
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::SetBlock(std::size_t i, Block block) noexcept
+	{
+		assert(i < blockCount && "Block index out of range");
+
+		m_blocks[i] = block;
+		if (i == blockCount - 1)
+			ResetExtraBits();
+	}
+
+	/*!
+	* \brief Tests the ith bit
+	* \return true if bit is set
+	*
+	* \param bit Index of the bit
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::Test(std::size_t bit) const noexcept
+	{
+		assert(bit < N && "Bit index out of range");
+
+		return (m_blocks[bit / bitsPerBlock] & (Block(1U) << (bit % bitsPerBlock))) != 0;
+	}
+
+	/*!
+	* \brief Tests each block
+	* \return true if each block is set
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::TestAll() const noexcept
+	{
+		for (std::size_t i = 0; i < blockCount; ++i)
+		{
+			Block mask = (i == blockCount - 1) ? lastBlockMask : fullBitMask;
+			if (m_blocks[i] != mask)
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Tests if one bit is set
+	* \return true if one bit is set
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::TestAny() const noexcept
+	{
+		for (Block block : m_blocks)
+		{
+			if (block)
+				return true;
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Tests if one bit is not set
+	* \return true if one bit is not set
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::TestNone() const noexcept
+	{
+		return !TestAny();
+	}
+
+	/*!
+	* \brief Converts the bitset to an unsigned integral number
+	* \return Number representing the bitset
+	*/
+	template<std::size_t N, typename Block>
+	template<typename T>
+	constexpr T StaticBitset<N, Block>::To() const noexcept
+	{
+		static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "T must be a unsigned integral type");
+		static_assert(N <= BitCount<T>(), "Bit count cannot be greater than T bit count");
+
+		T value = 0;
+		for (std::size_t i = 0; i < blockCount; ++i)
+			value |= static_cast<T>(m_blocks[i]) << i * bitsPerBlock;
+
+		return value;
+	}
+
+	/*!
+	* \brief Gives a string representation of the bitset
+	* \return A string representation of the object with only '0' and '1', the last character being the first bit
+	*/
+	template<std::size_t N, typename Block>
+	std::string StaticBitset<N, Block>::ToString() const
+	{
+		std::string str(N, '0');
+
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			if (Test(i))
+				str[N - i - 1] = '1';
+		}
+
+		return str;
+	}
+
+	/*!
+	* \brief Gets the ith bit
+	* \return bit in ith position
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::operator[](std::size_t index) const noexcept
+	{
+		return Test(index);
+	}
+
+	/*!
+	* \brief Negates the bitset
+	* \return A new bitset which is the "NOT" of this bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> StaticBitset<N, Block>::operator~() const noexcept
+	{
+		StaticBitset bitset;
+		bitset.PerformsNOT(*this);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs an "AND" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>& StaticBitset<N, Block>::operator&=(const StaticBitset& bitset) noexcept
+	{
+		PerformsAND(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs an "OR" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>& StaticBitset<N, Block>::operator|=(const StaticBitset& bitset) noexcept
+	{
+		PerformsOR(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Performs an "XOR" with another bitset
+	* \return A reference to this
+	*
+	* \param bitset Other bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>& StaticBitset<N, Block>::operator^=(const StaticBitset& bitset) noexcept
+	{
+		PerformsXOR(*this, bitset);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Gets the number of blocks
+	* \return Number of blocks
+	*/
+	template<std::size_t N, typename Block>
+	constexpr std::size_t StaticBitset<N, Block>::GetBlockCount() noexcept
+	{
+		return blockCount;
+	}
+
+	/*!
+	* \brief Gets the number of bits
+	* \return Number of bits
+	*/
+	template<std::size_t N, typename Block>
+	constexpr std::size_t StaticBitset<N, Block>::GetSize() noexcept
+	{
+		return N;
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr void StaticBitset<N, Block>::ResetExtraBits() noexcept
+	{
+		// The mask is known at compile-time, this is a no-op when N is a multiple of the block size
+		if constexpr (N % bitsPerBlock != 0)
+			m_blocks[blockCount - 1] &= lastBlockMask;
+	}
+
+
+	template<std::size_t N, typename Block>
+	constexpr auto StaticBitset<N, Block>::bits_const_iter_tag::begin() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, bitsetRef.FindFirst());
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr auto StaticBitset<N, Block>::bits_const_iter_tag::end() const noexcept -> BitIterator
+	{
+		return BitIterator(*this, npos);
+	}
+
+
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block>::BitIterator::BitIterator(bits_const_iter_tag bitsetTag, std::size_t bitIndex) :
+	m_bitIndex(bitIndex),
+	m_owner(&bitsetTag.bitsetRef)
+	{
+	}
+
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 auto StaticBitset<N, Block>::BitIterator::operator++(int) -> BitIterator
+	{
+		BitIterator copy(*this);
+		++copy;
+		return copy;
+	}
+
+	template<std::size_t N, typename Block>
+	NAZARA_CONSTEXPR20 auto StaticBitset<N, Block>::BitIterator::operator++() -> BitIterator&
+	{
+		m_bitIndex = m_owner->FindNext(m_bitIndex);
+		return *this;
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::BitIterator::operator==(const BitIterator& rhs) const
+	{
+		return m_bitIndex == rhs.m_bitIndex;
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr bool StaticBitset<N, Block>::BitIterator::operator!=(const BitIterator& rhs) const
+	{
+		return m_bitIndex != rhs.m_bitIndex;
+	}
+
+	template<std::size_t N, typename Block>
+	constexpr auto StaticBitset<N, Block>::BitIterator::operator*() const -> value_type
+	{
+		return m_bitIndex;
+	}
+
+
+	/*!
+	* \brief Compares two bitsets
+	* \return true if the two bitsets are the same
+	*
+	* \param lhs First bitset to compare with
+	* \param rhs Other bitset to compare with
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool operator==(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept
+	{
+		for (std::size_t i = 0; i < StaticBitset<N, Block>::blockCount; ++i)
+		{
+			if (lhs.GetBlock(i) != rhs.GetBlock(i))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Compares two bitsets
+	* \return false if the two bitsets are the same
+	*
+	* \param lhs First bitset to compare with
+	* \param rhs Other bitset to compare with
+	*/
+	template<std::size_t N, typename Block>
+	constexpr bool operator!=(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	/*!
+	* \brief Performs the operator "AND" between two bitsets
+	* \return The result of operator "AND"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator&(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept
+	{
+		StaticBitset<N, Block> bitset;
+		bitset.PerformsAND(lhs, rhs);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs the operator "OR" between two bitsets
+	* \return The result of operator "OR"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator|(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept
+	{
+		StaticBitset<N, Block> bitset;
+		bitset.PerformsOR(lhs, rhs);
+
+		return bitset;
+	}
+
+	/*!
+	* \brief Performs the operator "XOR" between two bitsets
+	* \return The result of operator "XOR"
+	*
+	* \param lhs First bitset
+	* \param rhs Second bitset
+	*/
+	template<std::size_t N, typename Block>
+	constexpr StaticBitset<N, Block> operator^(const StaticBitset<N, Block>& lhs, const StaticBitset<N, Block>& rhs) noexcept
+	{
+		StaticBitset<N, Block> bitset;
+		bitset.PerformsXOR(lhs, rhs);
+
+		return bitset;
+	}
+}
+
+NAZARA_WARNING_POP()
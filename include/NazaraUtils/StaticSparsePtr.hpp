@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_STATICSPARSEPTR_HPP
+#define NAZARAUTILS_STATICSPARSEPTR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/SparsePtr.hpp>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T, int Stride>
+	class StaticSparsePtr
+	{
+		static_assert(Stride != 0, "stride must not be zero");
+
+		public:
+			using BytePtr = std::conditional_t<std::is_const<T>::value, const UInt8*, UInt8*>;
+			using VoidPtr = std::conditional_t<std::is_const<T>::value, const void*, void*>;
+
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+			using pointer = T*;
+			using reference = T&;
+			using value_type = std::remove_cv_t<T>;
+
+			constexpr StaticSparsePtr() noexcept;
+			explicit StaticSparsePtr(VoidPtr ptr) noexcept;
+			explicit StaticSparsePtr(const SparsePtr<T>& ptr);
+			template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>> constexpr StaticSparsePtr(const StaticSparsePtr<U, Stride>& ptr) noexcept;
+			constexpr StaticSparsePtr(const StaticSparsePtr& ptr) noexcept = default;
+			~StaticSparsePtr() = default;
+
+			constexpr VoidPtr GetPtr() const noexcept;
+
+			void Reset(VoidPtr ptr = nullptr) noexcept;
+
+			explicit constexpr operator bool() const noexcept;
+			explicit operator T*() const noexcept;
+			template<typename U, typename = std::enable_if_t<std::is_convertible_v<T*, U*>>> operator SparsePtr<U>() const;
+			T& operator*() const;
+			T* operator->() const;
+			T& operator[](difference_type index) const;
+
+			constexpr StaticSparsePtr& operator=(const StaticSparsePtr& ptr) noexcept = default;
+
+			StaticSparsePtr operator+(difference_type count) const noexcept;
+			StaticSparsePtr operator-(difference_type count) const noexcept;
+			constexpr difference_type operator-(const StaticSparsePtr& ptr) const noexcept;
+
+			constexpr StaticSparsePtr& operator+=(difference_type count) noexcept;
+			constexpr StaticSparsePtr& operator-=(difference_type count) noexcept;
+
+			constexpr StaticSparsePtr& operator++() noexcept;
+			constexpr StaticSparsePtr operator++(int) noexcept;
+
+			constexpr StaticSparsePtr& operator--() noexcept;
+			constexpr StaticSparsePtr operator--(int) noexcept;
+
+			constexpr bool operator==(const StaticSparsePtr& ptr) const noexcept;
+			constexpr bool operator!=(const StaticSparsePtr& ptr) const noexcept;
+			constexpr bool operator<(const StaticSparsePtr& ptr) const noexcept;
+			constexpr bool operator>(const StaticSparsePtr& ptr) const noexcept;
+			constexpr bool operator<=(const StaticSparsePtr& ptr) const noexcept;
+			constexpr bool operator>=(const StaticSparsePtr& ptr) const noexcept;
+
+			static constexpr int GetStride() noexcept;
+
+		private:
+			template<typename, int> friend class StaticSparsePtr;
+
+			BytePtr m_ptr;
+	};
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride> operator+(std::ptrdiff_t count, const StaticSparsePtr<T, Stride>& ptr) noexcept;
+}
+
+#include <NazaraUtils/StaticSparsePtr.inl>
+
+#endif // NAZARAUTILS_STATICSPARSEPTR_HPP
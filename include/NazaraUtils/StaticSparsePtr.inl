@@ -0,0 +1,382 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::StaticSparsePtr
+	* \brief Core class that represents a pointer and a compile-time step between two elements
+	*
+	* This is the compile-time counterpart of SparsePtr: as the stride is known by the compiler, it can strength-reduce and vectorize loops iterating over it.
+	* It's also a proper random-access iterator, which allows it to be used with standard algorithms.
+	*/
+
+	/*!
+	* \brief Constructs a StaticSparsePtr object by default
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>::StaticSparsePtr() noexcept :
+	m_ptr(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StaticSparsePtr object with a pointer
+	*
+	* \param ptr Pointer to the first element
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride>::StaticSparsePtr(VoidPtr ptr) noexcept :
+	m_ptr(static_cast<BytePtr>(ptr))
+	{
+	}
+
+	/*!
+	* \brief Constructs a StaticSparsePtr object from a SparsePtr
+	*
+	* \param ptr SparsePtr to convert, its stride must be equal to Stride
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride>::StaticSparsePtr(const SparsePtr<T>& ptr) :
+	m_ptr(static_cast<BytePtr>(ptr.GetPtr()))
+	{
+		assert(ptr.GetStride() == Stride);
+	}
+
+	/*!
+	* \brief Constructs a StaticSparsePtr object from another type of StaticSparsePtr
+	*
+	* \param ptr Pointer to data of type U to convert to type T
+	*/
+
+	template<typename T, int Stride>
+	template<typename U, typename>
+	constexpr StaticSparsePtr<T, Stride>::StaticSparsePtr(const StaticSparsePtr<U, Stride>& ptr) noexcept :
+	m_ptr(ptr.m_ptr)
+	{
+	}
+
+	/*!
+	* \brief Gets the original pointer
+	* \return Pointer to the first data
+	*/
+
+	template<typename T, int Stride>
+	constexpr auto StaticSparsePtr<T, Stride>::GetPtr() const noexcept -> VoidPtr
+	{
+		return m_ptr;
+	}
+
+	/*!
+	* \brief Resets the StaticSparsePtr with a pointer
+	*
+	* \param ptr Pointer to the first element
+	*/
+
+	template<typename T, int Stride>
+	void StaticSparsePtr<T, Stride>::Reset(VoidPtr ptr) noexcept
+	{
+		m_ptr = static_cast<BytePtr>(ptr);
+	}
+
+	/*!
+	* \brief Checks whether the StaticSparsePtr is pointing to something
+	* \return true if pointer is not nullptr
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>::operator bool() const noexcept
+	{
+		return m_ptr != nullptr;
+	}
+
+	/*!
+	* \brief Converts the pointer to a pointer to the value
+	* \return The value of the pointer
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride>::operator T*() const noexcept
+	{
+		return reinterpret_cast<T*>(m_ptr);
+	}
+
+	/*!
+	* \brief Converts the StaticSparsePtr to a SparsePtr with a runtime stride
+	* \return SparsePtr pointing to the same element with the same stride
+	*/
+
+	template<typename T, int Stride>
+	template<typename U, typename>
+	StaticSparsePtr<T, Stride>::operator SparsePtr<U>() const
+	{
+		return SparsePtr<U>(m_ptr, Stride);
+	}
+
+	/*!
+	* \brief Dereferences the pointer
+	* \return The dereferencing of the pointer
+	*/
+
+	template<typename T, int Stride>
+	T& StaticSparsePtr<T, Stride>::operator*() const
+	{
+		return *reinterpret_cast<T*>(m_ptr);
+	}
+
+	/*!
+	* \brief Dereferences the pointer
+	* \return The dereferencing of the pointer
+	*/
+
+	template<typename T, int Stride>
+	T* StaticSparsePtr<T, Stride>::operator->() const
+	{
+		return reinterpret_cast<T*>(m_ptr);
+	}
+
+	/*!
+	* \brief Gets the ith element of the stride pointer
+	* \return A reference to the ith value
+	*
+	* \param index Number of stride to do
+	*/
+
+	template<typename T, int Stride>
+	T& StaticSparsePtr<T, Stride>::operator[](difference_type index) const
+	{
+		return *reinterpret_cast<T*>(m_ptr + index * Stride);
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with an offset
+	* \return A StaticSparsePtr pointing count elements further
+	*
+	* \param count Number of stride to do
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride> StaticSparsePtr<T, Stride>::operator+(difference_type count) const noexcept
+	{
+		return StaticSparsePtr(m_ptr + count * Stride);
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with an offset
+	* \return A StaticSparsePtr pointing count elements before
+	*
+	* \param count Number of stride to do
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride> StaticSparsePtr<T, Stride>::operator-(difference_type count) const noexcept
+	{
+		return StaticSparsePtr(m_ptr - count * Stride);
+	}
+
+	/*!
+	* \brief Gets the difference between the two StaticSparsePtr
+	* \return The difference of elements: ptr - this->ptr
+	*
+	* \param ptr Other ptr
+	*/
+
+	template<typename T, int Stride>
+	constexpr auto StaticSparsePtr<T, Stride>::operator-(const StaticSparsePtr& ptr) const noexcept -> difference_type
+	{
+		return (m_ptr - ptr.m_ptr) / Stride;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with an offset
+	* \return A reference to this pointer with the new offset
+	*
+	* \param count Number of stride to do
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>& StaticSparsePtr<T, Stride>::operator+=(difference_type count) noexcept
+	{
+		m_ptr += count * Stride;
+		return *this;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with an offset
+	* \return A reference to this pointer with the new offset
+	*
+	* \param count Number of stride to do
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>& StaticSparsePtr<T, Stride>::operator-=(difference_type count) noexcept
+	{
+		m_ptr -= count * Stride;
+		return *this;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with the next element
+	* \return A reference to this pointer updated
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>& StaticSparsePtr<T, Stride>::operator++() noexcept
+	{
+		m_ptr += Stride;
+		return *this;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with the next element
+	* \return A StaticSparsePtr not updated
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride> StaticSparsePtr<T, Stride>::operator++(int) noexcept
+	{
+		StaticSparsePtr tmp(*this);
+		operator++();
+
+		return tmp;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with the previous element
+	* \return A reference to this pointer updated
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride>& StaticSparsePtr<T, Stride>::operator--() noexcept
+	{
+		m_ptr -= Stride;
+		return *this;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with the previous element
+	* \return A StaticSparsePtr not updated
+	*/
+
+	template<typename T, int Stride>
+	constexpr StaticSparsePtr<T, Stride> StaticSparsePtr<T, Stride>::operator--(int) noexcept
+	{
+		StaticSparsePtr tmp(*this);
+		operator--();
+
+		return tmp;
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return true if the two StaticSparsePtr are pointing to the same memory
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator==(const StaticSparsePtr& ptr) const noexcept
+	{
+		return m_ptr == ptr.m_ptr;
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return false if the two StaticSparsePtr are pointing to the same memory
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator!=(const StaticSparsePtr& ptr) const noexcept
+	{
+		return m_ptr != ptr.m_ptr;
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return true if the first StaticSparsePtr is before the second one (in iteration order)
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator<(const StaticSparsePtr& ptr) const noexcept
+	{
+		if constexpr (Stride > 0)
+			return m_ptr < ptr.m_ptr;
+		else
+			return m_ptr > ptr.m_ptr;
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return true if the first StaticSparsePtr is after the second one (in iteration order)
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator>(const StaticSparsePtr& ptr) const noexcept
+	{
+		return ptr < *this;
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return true if the first StaticSparsePtr is before or equal to the second one (in iteration order)
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator<=(const StaticSparsePtr& ptr) const noexcept
+	{
+		return !(ptr < *this);
+	}
+
+	/*!
+	* \brief Compares the StaticSparsePtr to another one
+	* \return true if the first StaticSparsePtr is after or equal to the second one (in iteration order)
+	*
+	* \param ptr Other StaticSparsePtr to compare with
+	*/
+
+	template<typename T, int Stride>
+	constexpr bool StaticSparsePtr<T, Stride>::operator>=(const StaticSparsePtr& ptr) const noexcept
+	{
+		return !(*this < ptr);
+	}
+
+	/*!
+	* \brief Gets the stride
+	* \return Step between two elements
+	*/
+
+	template<typename T, int Stride>
+	constexpr int StaticSparsePtr<T, Stride>::GetStride() noexcept
+	{
+		return Stride;
+	}
+
+	/*!
+	* \brief Gets the StaticSparsePtr with an offset
+	* \return A StaticSparsePtr pointing count elements further
+	*
+	* \param count Number of stride to do
+	* \param ptr Pointer to offset
+	*/
+
+	template<typename T, int Stride>
+	StaticSparsePtr<T, Stride> operator+(std::ptrdiff_t count, const StaticSparsePtr<T, Stride>& ptr) noexcept
+	{
+		return ptr + count;
+	}
+}
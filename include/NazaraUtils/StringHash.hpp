@@ -13,15 +13,20 @@
 
 namespace Nz
 {
-	template<typename T = char>
+	template<typename T, typename H> class BasicHashedStringView;
+	template<typename T, typename H, typename Allocator> class BasicHashedString;
+
+	template<typename T = char, typename H = std::hash<std::basic_string_view<T>>>
 	struct StringHash
 	{
-		using hash_type = std::hash<std::basic_string_view<T>>;
+		using hash_type = H;
 		using is_transparent = void;
 
 		std::size_t operator()(const T* str) const;
 		std::size_t operator()(std::basic_string_view<T> str) const;
 		template<typename Allocator> std::size_t operator()(const std::basic_string<T, std::char_traits<T>, Allocator>& str) const;
+		std::size_t operator()(const BasicHashedStringView<T, H>& str) const;
+		template<typename Allocator> std::size_t operator()(const BasicHashedString<T, H, Allocator>& str) const;
 	};
 }
 
@@ -6,23 +6,54 @@
 
 namespace Nz
 {
-	template<typename T>
-	std::size_t StringHash<T>::operator()(const T* str) const
+	/*!
+	* \ingroup utils
+	* \class Nz::StringHash
+	* \brief Transparent string hasher, allowing heterogeneous lookup in unordered containers
+	*
+	* \tparam T Character type
+	* \tparam H Hasher called with a string view (for example WyHash64Hash, to use a faster hash than std::hash)
+	*/
+
+	template<typename T, typename H>
+	std::size_t StringHash<T, H>::operator()(const T* str) const
 	{
-		return hash_type{}(str);
+		return static_cast<std::size_t>(hash_type{}(str));
 	}
 
-	template<typename T>
-	std::size_t StringHash<T>::operator()(std::basic_string_view<T> str) const
+	template<typename T, typename H>
+	std::size_t StringHash<T, H>::operator()(std::basic_string_view<T> str) const
 	{
-		return hash_type{}(str);
+		return static_cast<std::size_t>(hash_type{}(str));
 	}
 	
-	template<typename T>
+	template<typename T, typename H>
 	template<typename Allocator>
-	std::size_t StringHash<T>::operator()(const std::basic_string<T, std::char_traits<T>, Allocator>& str) const
+	std::size_t StringHash<T, H>::operator()(const std::basic_string<T, std::char_traits<T>, Allocator>& str) const
 	{
-		return hash_type{}(str);
+		return static_cast<std::size_t>(hash_type{}(str));
+	}
+
+	/*!
+	* \brief Returns the hash stored in the view, without hashing the string
+	*
+	* \remark Requires NazaraUtils/HashedString.hpp
+	*/
+	template<typename T, typename H>
+	std::size_t StringHash<T, H>::operator()(const BasicHashedStringView<T, H>& str) const
+	{
+		return str.GetHash();
 	}
-}
 
+	/*!
+	* \brief Returns the hash stored in the string, without hashing it
+	*
+	* \remark Requires NazaraUtils/HashedString.hpp
+	*/
+	template<typename T, typename H>
+	template<typename Allocator>
+	std::size_t StringHash<T, H>::operator()(const BasicHashedString<T, H, Allocator>& str) const
+	{
+		return str.GetHash();
+	}
+}
@@ -0,0 +1,160 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_STRINGPOOL_HPP
+#define NAZARAUTILS_STRINGPOOL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/ArenaAllocator.hpp>
+#include <NazaraUtils/CacheAligned.hpp>
+#include <NazaraUtils/FlatHashSet.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/HashedString.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <array>
+#include <functional>
+#include <shared_mutex>
+#include <string_view>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Header of an interned string, directly followed by its null-terminated characters
+		struct InternedStringEntry
+		{
+			std::size_t hash;
+			std::size_t size;
+		};
+
+		struct EmptyInternedStringEntry
+		{
+			InternedStringEntry header;
+			char str[1];
+		};
+
+		inline constexpr EmptyInternedStringEntry EmptyInternedString = { { static_cast<std::size_t>(WyHash64Hash{}(std::string_view{})), 0 }, "" };
+	}
+
+	class InternedString
+	{
+		friend class StringPool;
+
+		public:
+			constexpr InternedString();
+			constexpr InternedString(const InternedString&) = default;
+			constexpr InternedString(InternedString&&) noexcept = default;
+			~InternedString() = default;
+
+			inline const char* GetData() const;
+			constexpr std::size_t GetHash() const;
+			constexpr std::size_t GetSize() const;
+			inline std::string_view GetString() const;
+
+			constexpr bool IsEmpty() const;
+
+			inline operator HashedStringView() const;
+			inline operator std::string_view() const;
+
+			constexpr InternedString& operator=(const InternedString&) = default;
+			constexpr InternedString& operator=(InternedString&&) noexcept = default;
+
+			friend constexpr bool operator==(const InternedString& lhs, const InternedString& rhs) { return lhs.m_entry == rhs.m_entry; }
+			friend constexpr bool operator!=(const InternedString& lhs, const InternedString& rhs) { return lhs.m_entry != rhs.m_entry; }
+			friend constexpr bool operator<(const InternedString& lhs, const InternedString& rhs) { return std::less<const Detail::InternedStringEntry*>{}(lhs.m_entry, rhs.m_entry); }
+
+		private:
+			constexpr explicit InternedString(const Detail::InternedStringEntry* entry);
+
+			const Detail::InternedStringEntry* m_entry;
+	};
+
+	class StringPool
+	{
+		public:
+			inline explicit StringPool(std::size_t chunkSize = DefaultChunkSize);
+			StringPool(const StringPool&) = delete;
+			StringPool(StringPool&&) noexcept = default;
+			~StringPool() = default;
+
+			inline void Clear();
+
+			inline InternedString Find(std::string_view str) const;
+			inline InternedString Find(HashedStringView str) const;
+
+			inline std::size_t GetAllocatedSize() const;
+			inline std::size_t GetStringCount() const;
+
+			inline InternedString Intern(std::string_view str);
+			inline InternedString Intern(HashedStringView str);
+
+			StringPool& operator=(const StringPool&) = delete;
+			StringPool& operator=(StringPool&&) noexcept = default;
+
+			static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+		private:
+			ArenaAllocator m_arena;
+			FlatHashSet<HashedStringView, StringHash<char, WyHash64Hash>> m_strings;
+	};
+
+	class ConcurrentStringPool
+	{
+		public:
+			inline explicit ConcurrentStringPool(std::size_t chunkSize = StringPool::DefaultChunkSize);
+			ConcurrentStringPool(const ConcurrentStringPool&) = delete;
+			ConcurrentStringPool(ConcurrentStringPool&&) = delete;
+			~ConcurrentStringPool() = default;
+
+			inline void Clear();
+
+			inline InternedString Find(std::string_view str) const;
+			inline InternedString Find(HashedStringView str) const;
+
+			inline std::size_t GetAllocatedSize() const;
+			inline std::size_t GetStringCount() const;
+
+			inline InternedString Intern(std::string_view str);
+			inline InternedString Intern(HashedStringView str);
+
+			ConcurrentStringPool& operator=(const ConcurrentStringPool&) = delete;
+			ConcurrentStringPool& operator=(ConcurrentStringPool&&) = delete;
+
+			static constexpr std::size_t ShardCount = 16;
+
+		private:
+			static constexpr std::size_t GetShardIndex(std::size_t hash);
+
+			struct Shard
+			{
+				mutable std::shared_mutex mutex;
+				StringPool pool;
+			};
+
+			std::array<CacheAligned<Shard>, ShardCount> m_shards;
+	};
+
+	template<> struct FastHash<InternedString>
+	{
+		std::size_t operator()(const InternedString& str) const { return str.GetHash(); }
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::InternedString>
+	{
+		std::size_t operator()(const Nz::InternedString& str) const
+		{
+			return str.GetHash();
+		}
+	};
+}
+
+#include <NazaraUtils/StringPool.inl>
+
+#endif // NAZARAUTILS_STRINGPOOL_HPP
@@ -0,0 +1,288 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+
+namespace Nz
+{
+	static_assert(offsetof(Detail::EmptyInternedStringEntry, str) == sizeof(Detail::InternedStringEntry));
+
+	/*!
+	* \ingroup utils
+	* \class Nz::InternedString
+	* \brief Handle to a string interned by a StringPool (or a ConcurrentStringPool), the size of a pointer
+	*
+	* Two handles coming from the same pool are equal if and only if their strings are equal, which makes comparison a pointer comparison.
+	* The hash of the string is computed once when interning it (using WyHash64Hash, as HashedStringView does) and stored alongside the characters.
+	*
+	* \remark The string is null-terminated and stays valid until the pool is cleared or destroyed
+	* \remark Handles from different pools must not be compared together, as they will always be different (except for the empty string)
+	*/
+
+	/*!
+	* \brief Constructs a handle to the empty string
+	*/
+	constexpr InternedString::InternedString() :
+	m_entry(&Detail::EmptyInternedString.header)
+	{
+	}
+
+	constexpr InternedString::InternedString(const Detail::InternedStringEntry* entry) :
+	m_entry(entry)
+	{
+	}
+
+	/*!
+	* \brief Returns the null-terminated characters of the string
+	*/
+	inline const char* InternedString::GetData() const
+	{
+		return reinterpret_cast<const char*>(m_entry + 1);
+	}
+
+	constexpr std::size_t InternedString::GetHash() const
+	{
+		return m_entry->hash;
+	}
+
+	constexpr std::size_t InternedString::GetSize() const
+	{
+		return m_entry->size;
+	}
+
+	inline std::string_view InternedString::GetString() const
+	{
+		return std::string_view(GetData(), m_entry->size);
+	}
+
+	constexpr bool InternedString::IsEmpty() const
+	{
+		return m_entry->size == 0;
+	}
+
+	inline InternedString::operator HashedStringView() const
+	{
+		return HashedStringView(GetString(), m_entry->hash);
+	}
+
+	inline InternedString::operator std::string_view() const
+	{
+		return GetString();
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::StringPool
+	* \brief Deduplicates strings, storing them in big chunks of memory and returning InternedString handles to them
+	*
+	* Strings are never moved nor freed until the pool is cleared, handles and views to them are stable (even when the pool is moved).
+	*
+	* \remark This class is not thread-safe, see ConcurrentStringPool
+	*/
+
+	/*!
+	* \brief Constructs an empty pool without allocating memory
+	*
+	* \param chunkSize Size of the first chunk of memory used to store strings (following chunks double in size)
+	*/
+	inline StringPool::StringPool(std::size_t chunkSize) :
+	m_arena(chunkSize)
+	{
+	}
+
+	/*!
+	* \brief Frees every string of the pool
+	*
+	* \remark Every handle returned by this pool is invalidated
+	*/
+	inline void StringPool::Clear()
+	{
+		m_strings.clear();
+		m_arena.Release();
+	}
+
+	/*!
+	* \brief Looks for a string in the pool without interning it
+	* \return Handle to the string if it was interned, or an empty handle otherwise
+	*
+	* \param str String to look for
+	*/
+	inline InternedString StringPool::Find(std::string_view str) const
+	{
+		return Find(HashedStringView(str));
+	}
+
+	/*!
+	* \brief Looks for a string in the pool without interning it, reusing its hash
+	* \return Handle to the string if it was interned, or an empty handle otherwise
+	*
+	* \param str String to look for
+	*/
+	inline InternedString StringPool::Find(HashedStringView str) const
+	{
+		auto it = m_strings.find(str);
+		if (it == m_strings.end())
+			return InternedString{};
+
+		return InternedString(reinterpret_cast<const Detail::InternedStringEntry*>(it->GetString().data()) - 1);
+	}
+
+	/*!
+	* \brief Returns the size of the memory chunks used to store the strings (not including the hash set)
+	*/
+	inline std::size_t StringPool::GetAllocatedSize() const
+	{
+		return m_arena.GetAllocatedSize();
+	}
+
+	/*!
+	* \brief Returns the number of distinct non-empty strings interned in the pool
+	*/
+	inline std::size_t StringPool::GetStringCount() const
+	{
+		return m_strings.size();
+	}
+
+	/*!
+	* \brief Interns a string, copying it in the pool if it's not already there
+	* \return Handle to the interned string
+	*
+	* \param str String to intern
+	*/
+	inline InternedString StringPool::Intern(std::string_view str)
+	{
+		return Intern(HashedStringView(str));
+	}
+
+	/*!
+	* \brief Interns a string, copying it in the pool if it's not already there, reusing its hash
+	* \return Handle to the interned string
+	*
+	* \param str String to intern
+	*/
+	inline InternedString StringPool::Intern(HashedStringView str)
+	{
+		if (str.GetString().empty())
+			return InternedString{};
+
+		if (InternedString interned = Find(str); !interned.IsEmpty())
+			return interned;
+
+		std::string_view chars = str.GetString();
+
+		void* memory = m_arena.Allocate(sizeof(Detail::InternedStringEntry) + chars.size() + 1, alignof(Detail::InternedStringEntry));
+		Detail::InternedStringEntry* entry = PlacementNew(static_cast<Detail::InternedStringEntry*>(memory), Detail::InternedStringEntry{ str.GetHash(), chars.size() });
+
+		char* data = reinterpret_cast<char*>(entry + 1);
+		std::memcpy(data, chars.data(), chars.size());
+		data[chars.size()] = '\0';
+
+		m_strings.insert(HashedStringView(std::string_view(data, chars.size()), str.GetHash()));
+
+		return InternedString(entry);
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::ConcurrentStringPool
+	* \brief Thread-safe version of StringPool, which can be used by multiple threads at once
+	*
+	* Strings are distributed across ShardCount pools depending on their hash, each one protected by a reader-writer lock,
+	* which means threads rarely contend and looking up an already interned string only takes a shared lock.
+	*/
+
+	/*!
+	* \brief Constructs an empty pool without allocating memory
+	*
+	* \param chunkSize Size of the first chunk of memory used by each shard to store strings
+	*/
+	inline ConcurrentStringPool::ConcurrentStringPool(std::size_t chunkSize)
+	{
+		for (CacheAligned<Shard>& shard : m_shards)
+			shard->pool = StringPool(chunkSize);
+	}
+
+	/*!
+	* \brief Frees every string of the pool
+	*
+	* \remark Every handle returned by this pool is invalidated, and no other thread may use the pool meanwhile
+	*/
+	inline void ConcurrentStringPool::Clear()
+	{
+		for (CacheAligned<Shard>& shard : m_shards)
+		{
+			std::unique_lock lock(shard->mutex);
+			shard->pool.Clear();
+		}
+	}
+
+	inline InternedString ConcurrentStringPool::Find(std::string_view str) const
+	{
+		return Find(HashedStringView(str));
+	}
+
+	inline InternedString ConcurrentStringPool::Find(HashedStringView str) const
+	{
+		const Shard& shard = *m_shards[GetShardIndex(str.GetHash())];
+
+		std::shared_lock lock(shard.mutex);
+		return shard.pool.Find(str);
+	}
+
+	inline std::size_t ConcurrentStringPool::GetAllocatedSize() const
+	{
+		std::size_t allocatedSize = 0;
+		for (const CacheAligned<Shard>& shard : m_shards)
+		{
+			std::shared_lock lock(shard->mutex);
+			allocatedSize += shard->pool.GetAllocatedSize();
+		}
+
+		return allocatedSize;
+	}
+
+	inline std::size_t ConcurrentStringPool::GetStringCount() const
+	{
+		std::size_t stringCount = 0;
+		for (const CacheAligned<Shard>& shard : m_shards)
+		{
+			std::shared_lock lock(shard->mutex);
+			stringCount += shard->pool.GetStringCount();
+		}
+
+		return stringCount;
+	}
+
+	inline InternedString ConcurrentStringPool::Intern(std::string_view str)
+	{
+		return Intern(HashedStringView(str));
+	}
+
+	inline InternedString ConcurrentStringPool::Intern(HashedStringView str)
+	{
+		if (str.GetString().empty())
+			return InternedString{};
+
+		Shard& shard = *m_shards[GetShardIndex(str.GetHash())];
+		{
+			std::shared_lock lock(shard.mutex);
+			if (InternedString interned = shard.pool.Find(str); !interned.IsEmpty())
+				return interned;
+		}
+
+		std::unique_lock lock(shard.mutex);
+		return shard.pool.Intern(str);
+	}
+
+	constexpr std::size_t ConcurrentStringPool::GetShardIndex(std::size_t hash)
+	{
+		// Use the upper bits of the hash, as the lower ones are used by the hash set of each shard
+		return (hash >> (sizeof(std::size_t) * CHAR_BIT - 8)) % ShardCount;
+	}
+}
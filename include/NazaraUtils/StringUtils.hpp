@@ -8,12 +8,56 @@
 #define NAZARAUTILS_STRING_UTILS_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Result.hpp>
+#include <charconv>
+#include <iterator>
+#include <optional>
 #include <string>
 #include <string_view>
 
+#if !defined(NAZARA_STRINGUTILS_NO_SIMD)
+	#if (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)) && (defined(NAZARA_COMPILER_MSVC) || NAZARA_CHECK_CLANG_VER(500) || NAZARA_CHECK_GCC_VER(600))
+		#define NAZARA_STRINGUTILS_X86
+	#elif defined(NAZARA_ARCH_aarch64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+		#define NAZARA_STRINGUTILS_NEON
+	#endif
+#endif
+
+// Floating-point std::from_chars/std::to_chars are missing from older standard libraries (GCC < 11, libc++)
+#if defined(__cpp_lib_to_chars)
+	#define NAZARA_STRINGUTILS_FLOAT_CHARCONV
+#endif
+
 namespace Nz
 {
+	class SplitRange;
+
+	enum class NumberError
+	{
+		BufferTooSmall, //< output buffer cannot hold the formatted number
+		InvalidFormat,  //< string isn't a number, or has trailing characters
+		OutOfRange      //< number doesn't fit in the requested type
+	};
+
 	// String utils
+	constexpr bool EndsWith(std::string_view str, std::string_view suffix) noexcept;
+	constexpr bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept;
+	template<typename F> bool SplitString(std::string_view str, char delimiter, F&& callback);
+	template<typename F> bool SplitString(std::string_view str, std::string_view delimiter, F&& callback);
+	inline SplitRange SplitStringRange(std::string_view str, char delimiter);
+	inline SplitRange SplitStringRange(std::string_view str, std::string_view delimiter);
+	constexpr bool StartsWith(std::string_view str, std::string_view prefix) noexcept;
+	constexpr std::string_view Trim(std::string_view str) noexcept;
+	constexpr std::string_view TrimLeft(std::string_view str) noexcept;
+	constexpr std::string_view TrimRight(std::string_view str) noexcept;
+
+	// Number conversions
+	template<typename T> void AppendNumber(std::string& str, T value);
+	template<typename T> constexpr std::size_t MaxNumberLength();
+	template<typename T> Result<std::string_view, NumberError> NumberToString(T value, char* buffer, std::size_t bufferSize);
+	template<typename T> Result<T, NumberError> StringToNumber(std::string_view str);
+
+	// UTF-8 helpers
 #if NAZARA_CHECK_CPP_VER(NAZARA_CPP20)
 	inline std::string_view FromUtf8String(const char8_t* str);
 	inline std::string FromUtf8String(const std::u8string& str);
@@ -33,6 +77,69 @@ namespace Nz
 	inline std::string ToUtf8String(std::string str);
 	inline std::string_view ToUtf8String(std::string_view str);
 #endif
+
+	// Unicode validation and transcoding
+	inline bool IsValidUtf8(std::string_view str);
+
+	inline std::size_t Utf16LengthFromUtf8(std::string_view str);
+	inline std::size_t Utf32LengthFromUtf8(std::string_view str);
+	inline std::size_t Utf8LengthFromUtf16(std::u16string_view str);
+
+	inline std::optional<std::size_t> Utf8ToUtf16(std::string_view str, char16_t* output);
+	inline std::optional<std::size_t> Utf8ToUtf32(std::string_view str, char32_t* output);
+	inline std::optional<std::size_t> Utf16ToUtf8(std::u16string_view str, char* output);
+
+	class SplitIterator
+	{
+		public:
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+			using pointer = const std::string_view*;
+			using reference = const std::string_view&;
+			using value_type = std::string_view;
+
+			inline SplitIterator();
+			inline SplitIterator(std::string_view str, char delimiter);
+			inline SplitIterator(std::string_view str, std::string_view delimiter);
+			SplitIterator(const SplitIterator&) = default;
+			SplitIterator(SplitIterator&&) noexcept = default;
+			~SplitIterator() = default;
+
+			SplitIterator& operator=(const SplitIterator&) = default;
+			SplitIterator& operator=(SplitIterator&&) noexcept = default;
+
+			inline SplitIterator operator++(int);
+			inline SplitIterator& operator++();
+
+			inline bool operator==(const SplitIterator& rhs) const;
+			inline bool operator!=(const SplitIterator& rhs) const;
+			inline reference operator*() const;
+			inline pointer operator->() const;
+
+		private:
+			inline void Advance();
+
+			std::string_view m_delimiter;
+			std::string_view m_remaining;
+			std::string_view m_token;
+			char m_delimiterChar;
+			bool m_isLastToken;
+			bool m_isEnd;
+			bool m_isSingleChar;
+	};
+
+	class SplitRange
+	{
+		public:
+			inline SplitRange(std::string_view str, char delimiter);
+			inline SplitRange(std::string_view str, std::string_view delimiter);
+
+			inline SplitIterator begin() const;
+			inline SplitIterator end() const;
+
+		private:
+			SplitIterator m_begin;
+	};
 }
 
 #include <NazaraUtils/StringUtils.inl>
@@ -3,9 +3,1095 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <NazaraUtils/StringUtils.hpp>
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <array>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(NAZARA_STRINGUTILS_X86)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+#elif defined(NAZARA_STRINGUTILS_NEON)
+	#include <arm_neon.h>
+#endif
+
+#if defined(NAZARA_STRINGUTILS_X86) && !defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_STRINGUTILS_TARGET(features) __attribute__((target(features)))
+#else
+	#define NAZARA_STRINGUTILS_TARGET(features)
+#endif
 
 namespace Nz
 {
+	namespace Detail
+	{
+		constexpr char AsciiToLower(char c) noexcept
+		{
+			return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+		}
+
+		constexpr bool IsAsciiSpace(char c) noexcept
+		{
+			return c == ' ' || (c >= '\t' && c <= '\r'); //< \t, \n, \v, \f and \r
+		}
+
+		template<typename T>
+		T StringToFloat(const char* str, char** end)
+		{
+			if constexpr (std::is_same_v<T, float>)
+				return std::strtof(str, end);
+			else if constexpr (std::is_same_v<T, double>)
+				return std::strtod(str, end);
+			else
+				return std::strtold(str, end);
+		}
+
+		// Fallback for std::from_chars on floating-point types, strtod is only used once the format has been checked (it would also accept
+		// whitespaces, '+' and hexadecimal) and the decimal point has been replaced with the one of the current C locale
+		template<typename T>
+		Result<T, NumberError> StringToFloatFallback(std::string_view str)
+		{
+			std::size_t i = 0;
+			bool negative = (!str.empty() && str[0] == '-');
+			if (negative)
+				i++;
+
+			std::string_view unsignedStr = str.substr(i);
+			if (EqualsIgnoreCase(unsignedStr, "inf") || EqualsIgnoreCase(unsignedStr, "infinity"))
+				return (negative) ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+
+			if (EqualsIgnoreCase(unsignedStr, "nan"))
+				return (negative) ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+
+			auto IsDigit = [&](std::size_t index) { return index < str.size() && str[index] >= '0' && str[index] <= '9'; };
+
+			std::size_t digitCount = 0;
+			for (; IsDigit(i); ++i)
+				digitCount++;
+
+			if (i < str.size() && str[i] == '.')
+			{
+				for (++i; IsDigit(i); ++i)
+					digitCount++;
+			}
+
+			if (digitCount == 0)
+				return Err(NumberError::InvalidFormat);
+
+			if (i < str.size() && (str[i] == 'e' || str[i] == 'E'))
+			{
+				i++;
+				if (i < str.size() && (str[i] == '+' || str[i] == '-'))
+					i++;
+
+				if (!IsDigit(i))
+					return Err(NumberError::InvalidFormat);
+
+				while (IsDigit(i))
+					i++;
+			}
+
+			if (i != str.size())
+				return Err(NumberError::InvalidFormat);
+
+			// strtod requires a null-terminated string
+			std::array<char, 128> stackBuffer;
+			std::string heapBuffer;
+			char* buffer = stackBuffer.data();
+			if (str.size() < stackBuffer.size())
+			{
+				std::memcpy(buffer, str.data(), str.size());
+				buffer[str.size()] = '\0';
+			}
+			else
+			{
+				heapBuffer.assign(str);
+				buffer = heapBuffer.data();
+			}
+
+			char decimalPoint = *std::localeconv()->decimal_point;
+			if (char* point = std::strchr(buffer, '.'))
+				*point = decimalPoint;
+
+			errno = 0;
+			T value = StringToFloat<T>(buffer, nullptr);
+
+			// Subnormal results may also set ERANGE
+			if (errno == ERANGE && (value == T(0) || std::isinf(value)))
+				return Err(NumberError::OutOfRange);
+
+			return value;
+		}
+
+		// Fallback for std::to_chars on floating-point types, prints the shortest decimal representation (with up to max_digits10 digits) which
+		// reads back as the same value
+		template<typename T>
+		std::size_t FloatToStringFallback(T value, char* buffer, std::size_t bufferSize)
+		{
+			std::array<char, 64> str;
+			int length;
+			if (std::isnan(value))
+				length = std::snprintf(str.data(), str.size(), "%s", (std::signbit(value)) ? "-nan" : "nan");
+			else if (std::isinf(value))
+				length = std::snprintf(str.data(), str.size(), "%s", (value < T(0)) ? "-inf" : "inf");
+			else
+			{
+				for (int precision = std::numeric_limits<T>::digits10; ; ++precision)
+				{
+					if constexpr (std::is_same_v<T, long double>)
+						length = std::snprintf(str.data(), str.size(), "%.*Lg", precision, value);
+					else
+						length = std::snprintf(str.data(), str.size(), "%.*g", precision, static_cast<double>(value));
+
+					if (precision >= std::numeric_limits<T>::max_digits10 || StringToFloat<T>(str.data(), nullptr) == value)
+						break;
+				}
+
+				char decimalPoint = *std::localeconv()->decimal_point;
+				if (char* point = std::strchr(str.data(), decimalPoint))
+					*point = '.';
+			}
+
+			std::size_t size = static_cast<std::size_t>(length);
+			if (length < 0 || size > bufferSize)
+				return 0;
+
+			std::memcpy(buffer, str.data(), size);
+			return size;
+		}
+
+		// Returned by the transcoding kernels when the input isn't valid
+		constexpr std::size_t InvalidUnicodeLength = std::numeric_limits<std::size_t>::max();
+
+		// Below this size, the cost of the dispatch outweighs the gains of the vectorized kernels
+		constexpr std::size_t UnicodeKernelScalarThreshold = 32;
+
+		// Decodes the UTF-8 sequence starting at data, returns its length or 0 if it's invalid (truncated, overlong, surrogate or out of range)
+		inline std::size_t DecodeUtf8(const UInt8* data, std::size_t size, char32_t& codepoint)
+		{
+			UInt8 lead = data[0];
+			if (lead < 0x80)
+			{
+				codepoint = lead;
+				return 1;
+			}
+
+			// Continuation bytes and C0/C1 (which can only start overlong sequences) cannot lead a sequence
+			if (lead < 0xC2)
+				return 0;
+
+			if (lead < 0xE0)
+			{
+				if (size < 2 || (data[1] & 0xC0) != 0x80)
+					return 0;
+
+				codepoint = (char32_t(lead & 0x1F) << 6) | (data[1] & 0x3F);
+				return 2;
+			}
+
+			if (lead < 0xF0)
+			{
+				if (size < 3 || (data[1] & 0xC0) != 0x80 || (data[2] & 0xC0) != 0x80)
+					return 0;
+
+				codepoint = (char32_t(lead & 0x0F) << 12) | (char32_t(data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+				if (codepoint < 0x800 || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+					return 0;
+
+				return 3;
+			}
+
+			if (lead < 0xF5)
+			{
+				if (size < 4 || (data[1] & 0xC0) != 0x80 || (data[2] & 0xC0) != 0x80 || (data[3] & 0xC0) != 0x80)
+					return 0;
+
+				codepoint = (char32_t(lead & 0x07) << 18) | (char32_t(data[1] & 0x3F) << 12) | (char32_t(data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+				if (codepoint < 0x10000 || codepoint > 0x10FFFF)
+					return 0;
+
+				return 4;
+			}
+
+			return 0;
+		}
+
+		// Decodes code points from data[i] until i reaches end (the last one may end past it), returns false on invalid input
+		inline bool TranscodeUtf8ToUtf16(const UInt8* data, std::size_t size, std::size_t& i, std::size_t end, char16_t*& output)
+		{
+			while (i < end)
+			{
+				char32_t codepoint;
+				std::size_t length = DecodeUtf8(data + i, size - i, codepoint);
+				if (length == 0)
+					return false;
+
+				if (codepoint < 0x10000)
+					*output++ = static_cast<char16_t>(codepoint);
+				else
+				{
+					codepoint -= 0x10000;
+					*output++ = static_cast<char16_t>(0xD800 + (codepoint >> 10));
+					*output++ = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+				}
+
+				i += length;
+			}
+
+			return true;
+		}
+
+		inline bool TranscodeUtf8ToUtf32(const UInt8* data, std::size_t size, std::size_t& i, std::size_t end, char32_t*& output)
+		{
+			while (i < end)
+			{
+				std::size_t length = DecodeUtf8(data + i, size - i, *output);
+				if (length == 0)
+					return false;
+
+				output++;
+				i += length;
+			}
+
+			return true;
+		}
+
+		inline bool TranscodeUtf16ToUtf8(const char16_t* data, std::size_t size, std::size_t& i, std::size_t end, char*& output)
+		{
+			while (i < end)
+			{
+				char32_t codepoint = data[i++];
+				if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+				{
+					// A high surrogate followed by a low surrogate, anything else is invalid
+					if (codepoint >= 0xDC00 || i >= size || data[i] < 0xDC00 || data[i] > 0xDFFF)
+						return false;
+
+					codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (data[i++] - 0xDC00);
+				}
+
+				if (codepoint < 0x80)
+					*output++ = static_cast<char>(codepoint);
+				else if (codepoint < 0x800)
+				{
+					*output++ = static_cast<char>(0xC0 | (codepoint >> 6));
+					*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else if (codepoint < 0x10000)
+				{
+					*output++ = static_cast<char>(0xE0 | (codepoint >> 12));
+					*output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else
+				{
+					*output++ = static_cast<char>(0xF0 | (codepoint >> 18));
+					*output++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+					*output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+			}
+
+			return true;
+		}
+
+		inline bool ScalarValidateUtf8(const UInt8* data, std::size_t size)
+		{
+			std::size_t i = 0;
+			while (i < size)
+			{
+				// Skip ASCII runs eight bytes at a time
+				if (i + sizeof(UInt64) <= size)
+				{
+					UInt64 word;
+					std::memcpy(&word, data + i, sizeof(UInt64));
+					if ((word & 0x8080808080808080ull) == 0)
+					{
+						i += sizeof(UInt64);
+						continue;
+					}
+				}
+
+				char32_t codepoint;
+				std::size_t length = DecodeUtf8(data + i, size - i, codepoint);
+				if (length == 0)
+					return false;
+
+				i += length;
+			}
+
+			return true;
+		}
+
+		struct ScalarUtf8Vector
+		{
+			using Type = std::array<UInt8, 8>;
+			static constexpr std::size_t Size = 8;
+
+			static bool IsAscii(const Type& value)
+			{
+				UInt64 word;
+				std::memcpy(&word, value.data(), sizeof(UInt64));
+				return (word & 0x8080808080808080ull) == 0;
+			}
+
+			static Type Load(const UInt8* ptr)
+			{
+				Type value;
+				std::memcpy(value.data(), ptr, Size);
+				return value;
+			}
+
+			static bool LoadAsciiUtf16(const char16_t* ptr, Type& value)
+			{
+				char16_t bits = 0;
+				for (std::size_t i = 0; i < Size; ++i)
+					bits |= ptr[i];
+
+				if (bits >= 0x80)
+					return false;
+
+				for (std::size_t i = 0; i < Size; ++i)
+					value[i] = static_cast<UInt8>(ptr[i]);
+
+				return true;
+			}
+
+			static void Store(char* ptr, const Type& value)
+			{
+				std::memcpy(ptr, value.data(), Size);
+			}
+
+			static void StoreUtf16(char16_t* ptr, const Type& value)
+			{
+				for (std::size_t i = 0; i < Size; ++i)
+					ptr[i] = value[i];
+			}
+
+			static void StoreUtf32(char32_t* ptr, const Type& value)
+			{
+				for (std::size_t i = 0; i < Size; ++i)
+					ptr[i] = value[i];
+			}
+		};
+
+#if defined(NAZARA_STRINGUTILS_X86)
+		struct SSSE3Utf8Vector
+		{
+			using Type = __m128i;
+			static constexpr std::size_t Size = 16;
+
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type And(Type a, Type b) { return _mm_and_si128(a, b); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static bool IsAscii(Type value) { return _mm_movemask_epi8(value) == 0; }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static bool IsZero(Type value) { return _mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) == 0xFFFF; }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Load(const UInt8* ptr) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type LoadTable(const UInt8* table) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Lookup(Type table, Type indices) { return _mm_shuffle_epi8(table, indices); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Or(Type a, Type b) { return _mm_or_si128(a, b); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type SaturatingSub(Type a, Type b) { return _mm_subs_epu8(a, b); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type ShiftRight4(Type value) { return _mm_and_si128(_mm_srli_epi16(value, 4), _mm_set1_epi8(0x0F)); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Splat(UInt8 value) { return _mm_set1_epi8(static_cast<char>(value)); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static void Store(char* ptr, Type value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), value); }
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Xor(Type a, Type b) { return _mm_xor_si128(a, b); }
+
+			// Last bytes of current, preceded by the first ones of previous
+			template<int N>
+			NAZARA_STRINGUTILS_TARGET("ssse3") static Type Prev(Type current, Type previous)
+			{
+				return _mm_alignr_epi8(current, previous, 16 - N);
+			}
+
+			NAZARA_STRINGUTILS_TARGET("ssse3") static bool LoadAsciiUtf16(const char16_t* ptr, Type& value)
+			{
+				__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+				__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 8));
+				__m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<short>(0xFF80)));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+					return false;
+
+				value = _mm_packus_epi16(low, high);
+				return true;
+			}
+
+			NAZARA_STRINGUTILS_TARGET("ssse3") static void StoreUtf16(char16_t* ptr, Type value)
+			{
+				__m128i zero = _mm_setzero_si128();
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm_unpacklo_epi8(value, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 8), _mm_unpackhi_epi8(value, zero));
+			}
+
+			NAZARA_STRINGUTILS_TARGET("ssse3") static void StoreUtf32(char32_t* ptr, Type value)
+			{
+				__m128i zero = _mm_setzero_si128();
+				__m128i low = _mm_unpacklo_epi8(value, zero);
+				__m128i high = _mm_unpackhi_epi8(value, zero);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm_unpacklo_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 4), _mm_unpackhi_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 8), _mm_unpacklo_epi16(high, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 12), _mm_unpackhi_epi16(high, zero));
+			}
+		};
+
+		struct AVX2Utf8Vector
+		{
+			using Type = __m256i;
+			static constexpr std::size_t Size = 32;
+
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type And(Type a, Type b) { return _mm256_and_si256(a, b); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static bool IsAscii(Type value) { return _mm256_movemask_epi8(value) == 0; }
+			NAZARA_STRINGUTILS_TARGET("avx2") static bool IsZero(Type value) { return _mm256_testz_si256(value, value) != 0; }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Load(const UInt8* ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type LoadTable(const UInt8* table) { return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table))); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Lookup(Type table, Type indices) { return _mm256_shuffle_epi8(table, indices); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Or(Type a, Type b) { return _mm256_or_si256(a, b); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type SaturatingSub(Type a, Type b) { return _mm256_subs_epu8(a, b); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type ShiftRight4(Type value) { return _mm256_and_si256(_mm256_srli_epi16(value, 4), _mm256_set1_epi8(0x0F)); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Splat(UInt8 value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static void Store(char* ptr, Type value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), value); }
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Xor(Type a, Type b) { return _mm256_xor_si256(a, b); }
+
+			// alignr works on 128-bit lanes, the upper lane of previous and the lower lane of current have to be brought together first
+			template<int N>
+			NAZARA_STRINGUTILS_TARGET("avx2") static Type Prev(Type current, Type previous)
+			{
+				return _mm256_alignr_epi8(current, _mm256_permute2x128_si256(previous, current, 0x21), 16 - N);
+			}
+
+			NAZARA_STRINGUTILS_TARGET("avx2") static bool LoadAsciiUtf16(const char16_t* ptr, Type& value)
+			{
+				__m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+				__m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 16));
+				if (!_mm256_testz_si256(_mm256_or_si256(low, high), _mm256_set1_epi16(static_cast<short>(0xFF80))))
+					return false;
+
+				// packus interleaves the lanes of its operands
+				value = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+				return true;
+			}
+
+			NAZARA_STRINGUTILS_TARGET("avx2") static void StoreUtf16(char16_t* ptr, Type value)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(value)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(value, 1)));
+			}
+
+			NAZARA_STRINGUTILS_TARGET("avx2") static void StoreUtf32(char32_t* ptr, Type value)
+			{
+				__m128i low = _mm256_castsi256_si128(value);
+				__m128i high = _mm256_extracti128_si256(value, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm256_cvtepu8_epi32(low));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 16), _mm256_cvtepu8_epi32(high));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+			}
+		};
+#elif defined(NAZARA_STRINGUTILS_NEON)
+		struct NEONUtf8Vector
+		{
+			using Type = uint8x16_t;
+			static constexpr std::size_t Size = 16;
+
+			static Type And(Type a, Type b) { return vandq_u8(a, b); }
+			static bool IsAscii(Type value) { return vmaxvq_u8(value) < 0x80; }
+			static bool IsZero(Type value) { return vmaxvq_u8(value) == 0; }
+			static Type Load(const UInt8* ptr) { return vld1q_u8(ptr); }
+			static Type LoadTable(const UInt8* table) { return vld1q_u8(table); }
+			static Type Lookup(Type table, Type indices) { return vqtbl1q_u8(table, indices); }
+			static Type Or(Type a, Type b) { return vorrq_u8(a, b); }
+			static Type SaturatingSub(Type a, Type b) { return vqsubq_u8(a, b); }
+			static Type ShiftRight4(Type value) { return vshrq_n_u8(value, 4); }
+			static Type Splat(UInt8 value) { return vdupq_n_u8(value); }
+			static void Store(char* ptr, Type value) { vst1q_u8(reinterpret_cast<UInt8*>(ptr), value); }
+			static Type Xor(Type a, Type b) { return veorq_u8(a, b); }
+
+			template<int N>
+			static Type Prev(Type current, Type previous)
+			{
+				return vextq_u8(previous, current, 16 - N);
+			}
+
+			static bool LoadAsciiUtf16(const char16_t* ptr, Type& value)
+			{
+				uint16x8_t low = vld1q_u16(reinterpret_cast<const UInt16*>(ptr));
+				uint16x8_t high = vld1q_u16(reinterpret_cast<const UInt16*>(ptr + 8));
+				if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+					return false;
+
+				value = vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+				return true;
+			}
+
+			static void StoreUtf16(char16_t* ptr, Type value)
+			{
+				vst1q_u16(reinterpret_cast<UInt16*>(ptr), vmovl_u8(vget_low_u8(value)));
+				vst1q_u16(reinterpret_cast<UInt16*>(ptr + 8), vmovl_high_u8(value));
+			}
+
+			static void StoreUtf32(char32_t* ptr, Type value)
+			{
+				uint16x8_t low = vmovl_u8(vget_low_u8(value));
+				uint16x8_t high = vmovl_high_u8(value);
+				vst1q_u32(reinterpret_cast<UInt32*>(ptr), vmovl_u16(vget_low_u16(low)));
+				vst1q_u32(reinterpret_cast<UInt32*>(ptr + 4), vmovl_high_u16(low));
+				vst1q_u32(reinterpret_cast<UInt32*>(ptr + 8), vmovl_u16(vget_low_u16(high)));
+				vst1q_u32(reinterpret_cast<UInt32*>(ptr + 12), vmovl_high_u16(high));
+			}
+		};
+#endif
+
+		// Lookup tables of the UTF-8 validation algorithm from "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire),
+		// each table flags the errors a nibble can take part in, an error is detected when the three nibbles around a byte boundary agree on it
+		constexpr UInt8 Utf8TooShort = 1 << 0;     //< 11______ 0_______ or 11______ 11______
+		constexpr UInt8 Utf8TooLong = 1 << 1;      //< 0_______ 10______
+		constexpr UInt8 Utf8Overlong3 = 1 << 2;    //< 11100000 100_____
+		constexpr UInt8 Utf8TooLarge = 1 << 3;     //< 11110100 1001____ and above
+		constexpr UInt8 Utf8Surrogate = 1 << 4;    //< 11101101 101_____
+		constexpr UInt8 Utf8Overlong2 = 1 << 5;    //< 1100000_ 10______
+		constexpr UInt8 Utf8TooLarge1000 = 1 << 6; //< 11110101 1000____ and above
+		constexpr UInt8 Utf8Overlong4 = 1 << 6;    //< 11110000 1000____
+		constexpr UInt8 Utf8TwoConts = 1 << 7;     //< 10______ 10______ (only valid as the third or fourth byte of a sequence)
+		constexpr UInt8 Utf8Carry = Utf8TooShort | Utf8TooLong | Utf8TwoConts;
+
+		alignas(16) constexpr UInt8 Utf8Byte1HighTable[16] = {
+			// 0_______ ________
+			Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong,
+			// 10______ ________
+			Utf8TwoConts, Utf8TwoConts, Utf8TwoConts, Utf8TwoConts,
+			// 1100____ ________
+			Utf8TooShort | Utf8Overlong2,
+			// 1101____ ________
+			Utf8TooShort,
+			// 1110____ ________
+			Utf8TooShort | Utf8Overlong3 | Utf8Surrogate,
+			// 1111____ ________
+			Utf8TooShort | Utf8TooLarge | Utf8TooLarge1000 | Utf8Overlong4
+		};
+
+		alignas(16) constexpr UInt8 Utf8Byte1LowTable[16] = {
+			// ____0000 ________
+			Utf8Carry | Utf8Overlong3 | Utf8Overlong2 | Utf8Overlong4,
+			// ____0001 ________
+			Utf8Carry | Utf8Overlong2,
+			// ____001_ ________
+			Utf8Carry, Utf8Carry,
+			// ____0100 ________
+			Utf8Carry | Utf8TooLarge,
+			// ____0101 ________ to ____1100 ________
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000, Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000, Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000, Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000, Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+			// ____1101 ________
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000 | Utf8Surrogate,
+			// ____111_ ________
+			Utf8Carry | Utf8TooLarge | Utf8TooLarge1000, Utf8Carry | Utf8TooLarge | Utf8TooLarge1000
+		};
+
+		alignas(16) constexpr UInt8 Utf8Byte2HighTable[16] = {
+			// ________ 0_______
+			Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort,
+			// ________ 1000____
+			Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Overlong3 | Utf8TooLarge1000 | Utf8Overlong4,
+			// ________ 1001____
+			Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Overlong3 | Utf8TooLarge,
+			// ________ 101_____
+			Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Surrogate | Utf8TooLarge,
+			Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Surrogate | Utf8TooLarge,
+			// ________ 11______
+			Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort
+		};
+
+		// Greatest value each of the last bytes of a chunk can take without starting a sequence which continues in the next chunk
+		alignas(32) constexpr UInt8 Utf8IncompleteMax[32] = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+		};
+
+		// Kernels are written once per instruction set (sharing the vector wrappers above), as target attributes cannot depend on a template parameter.
+		// Transcoders copy whole ASCII chunks at once and decode the other chunks code point by code point (the last one may spill over the next chunk).
+#define NAZARA_STRINGUTILS_DEFINE_TRANSCODERS(Prefix, Target) \
+		Target inline std::size_t Prefix##Utf8ToUtf16(const UInt8* data, std::size_t size, char16_t* output) \
+		{ \
+			using V = Prefix##Utf8Vector; \
+			char16_t* outputStart = output; \
+			std::size_t i = 0; \
+			while (i + V::Size <= size) \
+			{ \
+				V::Type chunk = V::Load(data + i); \
+				if (V::IsAscii(chunk)) \
+				{ \
+					V::StoreUtf16(output, chunk); \
+					output += V::Size; \
+					i += V::Size; \
+				} \
+				else if (!TranscodeUtf8ToUtf16(data, size, i, i + V::Size, output)) \
+					return InvalidUnicodeLength; \
+			} \
+			if (!TranscodeUtf8ToUtf16(data, size, i, size, output)) \
+				return InvalidUnicodeLength; \
+			return static_cast<std::size_t>(output - outputStart); \
+		} \
+		\
+		Target inline std::size_t Prefix##Utf8ToUtf32(const UInt8* data, std::size_t size, char32_t* output) \
+		{ \
+			using V = Prefix##Utf8Vector; \
+			char32_t* outputStart = output; \
+			std::size_t i = 0; \
+			while (i + V::Size <= size) \
+			{ \
+				V::Type chunk = V::Load(data + i); \
+				if (V::IsAscii(chunk)) \
+				{ \
+					V::StoreUtf32(output, chunk); \
+					output += V::Size; \
+					i += V::Size; \
+				} \
+				else if (!TranscodeUtf8ToUtf32(data, size, i, i + V::Size, output)) \
+					return InvalidUnicodeLength; \
+			} \
+			if (!TranscodeUtf8ToUtf32(data, size, i, size, output)) \
+				return InvalidUnicodeLength; \
+			return static_cast<std::size_t>(output - outputStart); \
+		} \
+		\
+		Target inline std::size_t Prefix##Utf16ToUtf8(const char16_t* data, std::size_t size, char* output) \
+		{ \
+			using V = Prefix##Utf8Vector; \
+			char* outputStart = output; \
+			std::size_t i = 0; \
+			while (i + V::Size <= size) \
+			{ \
+				V::Type chunk; \
+				if (V::LoadAsciiUtf16(data + i, chunk)) \
+				{ \
+					V::Store(output, chunk); \
+					output += V::Size; \
+					i += V::Size; \
+				} \
+				else if (!TranscodeUtf16ToUtf8(data, size, i, i + V::Size, output)) \
+					return InvalidUnicodeLength; \
+			} \
+			if (!TranscodeUtf16ToUtf8(data, size, i, size, output)) \
+				return InvalidUnicodeLength; \
+			return static_cast<std::size_t>(output - outputStart); \
+		}
+
+		// Chunks are checked against the previous one (sequences can cross chunk boundaries), errors are accumulated and only tested at the end.
+		// ASCII chunks only have to check that the previous chunk didn't end in the middle of a sequence.
+#define NAZARA_STRINGUTILS_DEFINE_VALIDATE(Prefix, Features) \
+		NAZARA_STRINGUTILS_TARGET(Features) inline Prefix##Utf8Vector::Type Prefix##CheckUtf8Chunk(Prefix##Utf8Vector::Type input, Prefix##Utf8Vector::Type previous) \
+		{ \
+			using V = Prefix##Utf8Vector; \
+			V::Type prev1 = V::Prev<1>(input, previous); \
+			V::Type byte1High = V::Lookup(V::LoadTable(Utf8Byte1HighTable), V::ShiftRight4(prev1)); \
+			V::Type byte1Low = V::Lookup(V::LoadTable(Utf8Byte1LowTable), V::And(prev1, V::Splat(0x0F))); \
+			V::Type byte2High = V::Lookup(V::LoadTable(Utf8Byte2HighTable), V::ShiftRight4(input)); \
+			V::Type specialCases = V::And(V::And(byte1High, byte1Low), byte2High); \
+			V::Type isThirdByte = V::SaturatingSub(V::Prev<2>(input, previous), V::Splat(0xE0 - 0x80)); \
+			V::Type isFourthByte = V::SaturatingSub(V::Prev<3>(input, previous), V::Splat(0xF0 - 0x80)); \
+			V::Type mustBeContinuation = V::And(V::Or(isThirdByte, isFourthByte), V::Splat(0x80)); \
+			return V::Xor(mustBeContinuation, specialCases); \
+		} \
+		\
+		NAZARA_STRINGUTILS_TARGET(Features) inline bool Prefix##ValidateUtf8(const UInt8* data, std::size_t size) \
+		{ \
+			using V = Prefix##Utf8Vector; \
+			const V::Type incompleteMax = V::Load(Utf8IncompleteMax + sizeof(Utf8IncompleteMax) - V::Size); \
+			V::Type error = V::Splat(0); \
+			V::Type previous = V::Splat(0); \
+			V::Type previousIncomplete = V::Splat(0); \
+			for (std::size_t i = 0; i < size; i += V::Size) \
+			{ \
+				V::Type input; \
+				if (i + V::Size <= size) \
+					input = V::Load(data + i); \
+				else \
+				{ \
+					/* Pad the last chunk with zeros (ASCII), which makes truncated sequences invalid */ \
+					alignas(32) UInt8 tail[V::Size] = {}; \
+					std::memcpy(tail, data + i, size - i); \
+					input = V::Load(tail); \
+				} \
+				if (V::IsAscii(input)) \
+					error = V::Or(error, previousIncomplete); \
+				else \
+					error = V::Or(error, Prefix##CheckUtf8Chunk(input, previous)); \
+				previousIncomplete = V::SaturatingSub(input, incompleteMax); \
+				previous = input; \
+			} \
+			error = V::Or(error, previousIncomplete); \
+			return V::IsZero(error); \
+		}
+
+		NAZARA_STRINGUTILS_DEFINE_TRANSCODERS(Scalar, )
+
+#if defined(NAZARA_STRINGUTILS_X86)
+		NAZARA_STRINGUTILS_DEFINE_TRANSCODERS(SSSE3, NAZARA_STRINGUTILS_TARGET("ssse3"))
+		NAZARA_STRINGUTILS_DEFINE_TRANSCODERS(AVX2, NAZARA_STRINGUTILS_TARGET("avx2"))
+		NAZARA_STRINGUTILS_DEFINE_VALIDATE(SSSE3, "ssse3")
+		NAZARA_STRINGUTILS_DEFINE_VALIDATE(AVX2, "avx2")
+#elif defined(NAZARA_STRINGUTILS_NEON)
+		NAZARA_STRINGUTILS_DEFINE_TRANSCODERS(NEON, )
+		NAZARA_STRINGUTILS_DEFINE_VALIDATE(NEON, "")
+#endif
+
+#undef NAZARA_STRINGUTILS_DEFINE_VALIDATE
+#undef NAZARA_STRINGUTILS_DEFINE_TRANSCODERS
+
+		struct UnicodeKernelTable
+		{
+			using ValidateUtf8Func = bool(*)(const UInt8* data, std::size_t size);
+			using Utf8ToUtf16Func = std::size_t(*)(const UInt8* data, std::size_t size, char16_t* output);
+			using Utf8ToUtf32Func = std::size_t(*)(const UInt8* data, std::size_t size, char32_t* output);
+			using Utf16ToUtf8Func = std::size_t(*)(const char16_t* data, std::size_t size, char* output);
+
+			ValidateUtf8Func validateUtf8Func;
+			Utf8ToUtf16Func utf8ToUtf16Func;
+			Utf8ToUtf32Func utf8ToUtf32Func;
+			Utf16ToUtf8Func utf16ToUtf8Func;
+		};
+
+		inline UnicodeKernelTable BuildUnicodeKernelTable()
+		{
+#define NAZARA_STRINGUTILS_TABLE(Prefix) { \
+			&Prefix##ValidateUtf8, \
+			&Prefix##Utf8ToUtf16, \
+			&Prefix##Utf8ToUtf32, \
+			&Prefix##Utf16ToUtf8 \
+		}
+
+#if defined(NAZARA_STRINGUTILS_X86)
+			const CpuFeatures& features = GetCpuFeatures();
+			if (features.avx2)
+				return NAZARA_STRINGUTILS_TABLE(AVX2);
+
+			if (features.ssse3)
+				return NAZARA_STRINGUTILS_TABLE(SSSE3);
+#elif defined(NAZARA_STRINGUTILS_NEON)
+			return NAZARA_STRINGUTILS_TABLE(NEON);
+#endif
+
+			return NAZARA_STRINGUTILS_TABLE(Scalar);
+
+#undef NAZARA_STRINGUTILS_TABLE
+		}
+
+		inline const UnicodeKernelTable& GetUnicodeKernelTable()
+		{
+			static const UnicodeKernelTable table = BuildUnicodeKernelTable();
+			return table;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Checks if a string ends with another
+	*
+	* \param str String to check
+	* \param suffix Expected end of str
+	*
+	* \see StartsWith
+	*/
+	constexpr bool EndsWith(std::string_view str, std::string_view suffix) noexcept
+	{
+		return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Compares two strings, ignoring the case of ASCII letters
+	*
+	* \param lhs First string
+	* \param rhs Second string
+	*
+	* \remark Only ASCII letters are folded, other bytes (including UTF-8 sequences) have to match exactly
+	*/
+	constexpr bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept
+	{
+		if (lhs.size() != rhs.size())
+			return false;
+
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			if (Detail::AsciiToLower(lhs[i]) != Detail::AsciiToLower(rhs[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every token of a string, without allocating
+	* \return False if the callback interrupted the split, true otherwise
+	*
+	* \param str String to split
+	* \param delimiter Character separating tokens
+	* \param callback Function called with each token (as a view into str), may return false to stop splitting
+	*
+	* Tokens are yielded the same way as SplitStringRange does.
+	*
+	* \see SplitStringRange
+	*/
+	template<typename F>
+	bool SplitString(std::string_view str, char delimiter, F&& callback)
+	{
+		for (std::string_view token : SplitStringRange(str, delimiter))
+		{
+			if constexpr (std::is_same_v<std::invoke_result_t<F&, std::string_view>, bool>)
+			{
+				if (!callback(token))
+					return false;
+			}
+			else
+				callback(token);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every token of a string, without allocating
+	* \return False if the callback interrupted the split, true otherwise
+	*
+	* \param str String to split
+	* \param delimiter String separating tokens
+	* \param callback Function called with each token (as a view into str), may return false to stop splitting
+	*
+	* Tokens are yielded the same way as SplitStringRange does.
+	*
+	* \see SplitStringRange
+	*/
+	template<typename F>
+	bool SplitString(std::string_view str, std::string_view delimiter, F&& callback)
+	{
+		for (std::string_view token : SplitStringRange(str, delimiter))
+		{
+			if constexpr (std::is_same_v<std::invoke_result_t<F&, std::string_view>, bool>)
+			{
+				if (!callback(token))
+					return false;
+			}
+			else
+				callback(token);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns a lazy range over the tokens of a string
+	*
+	* \param str String to split, must outlive the range
+	* \param delimiter Character separating tokens
+	*
+	* Tokens are views into str, empty tokens are kept ("a,,b" yields "a", "" and "b") but an empty string yields no token.
+	*
+	* \remark Delimiters are searched with std::memchr, which C libraries vectorize
+	*
+	* \see SplitString
+	*/
+	inline SplitRange SplitStringRange(std::string_view str, char delimiter)
+	{
+		return SplitRange(str, delimiter);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns a lazy range over the tokens of a string
+	*
+	* \param str String to split, must outlive the range
+	* \param delimiter String separating tokens, must outlive the range, an empty delimiter yields str as a single token
+	*
+	* Tokens are views into str, empty tokens are kept ("a, , b" split by ", " yields "a", "" and "b") but an empty string yields no token.
+	*
+	* \see SplitString
+	*/
+	inline SplitRange SplitStringRange(std::string_view str, std::string_view delimiter)
+	{
+		return SplitRange(str, delimiter);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Checks if a string starts with another
+	*
+	* \param str String to check
+	* \param prefix Expected start of str
+	*
+	* \see EndsWith
+	*/
+	constexpr bool StartsWith(std::string_view str, std::string_view prefix) noexcept
+	{
+		return str.size() >= prefix.size() && str.compare(0, prefix.size(), prefix) == 0;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Removes ASCII whitespaces (spaces, tabulations, line feeds, ...) at both ends of a string
+	* \return A view into str
+	*
+	* \param str String to trim
+	*/
+	constexpr std::string_view Trim(std::string_view str) noexcept
+	{
+		return TrimRight(TrimLeft(str));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Removes ASCII whitespaces at the beginning of a string
+	* \return A view into str
+	*
+	* \param str String to trim
+	*/
+	constexpr std::string_view TrimLeft(std::string_view str) noexcept
+	{
+		std::size_t first = 0;
+		while (first < str.size() && Detail::IsAsciiSpace(str[first]))
+			first++;
+
+		return str.substr(first);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Removes ASCII whitespaces at the end of a string
+	* \return A view into str
+	*
+	* \param str String to trim
+	*/
+	constexpr std::string_view TrimRight(std::string_view str) noexcept
+	{
+		std::size_t size = str.size();
+		while (size > 0 && Detail::IsAsciiSpace(str[size - 1]))
+			size--;
+
+		return str.substr(0, size);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Appends the decimal representation of a number to a string
+	*
+	* \param str String to append the number to, doesn't allocate if its capacity is large enough
+	* \param value Integer or floating-point number
+	*
+	* \see NumberToString
+	*/
+	template<typename T>
+	void AppendNumber(std::string& str, T value)
+	{
+		char buffer[MaxNumberLength<T>()];
+		str.append(NumberToString(value, buffer, sizeof(buffer)).GetValue());
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns the maximum length of a number formatted by NumberToString
+	*
+	* Buffers of this size can hold any value of type T.
+	*/
+	template<typename T>
+	constexpr std::size_t MaxNumberLength()
+	{
+		static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Type must be an integer or a floating-point type");
+
+		if constexpr (std::is_integral_v<T>)
+			return std::numeric_limits<T>::digits10 + 2; //< sign and the last (partial) digit
+		else
+			return std::numeric_limits<T>::max_digits10 + 8; //< sign, decimal point and exponent (e, sign and up to four digits)
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Formats a number in a caller-provided buffer
+	* \return A view of the number in buffer (not null-terminated), or NumberError::BufferTooSmall
+	*
+	* \param value Integer or floating-point number
+	* \param buffer Buffer receiving the number
+	* \param bufferSize Size of the buffer, MaxNumberLength<T>() is always enough
+	*
+	* Integers are written in base 10, floating-point numbers are written with the shortest representation which reads back as the same value.
+	* The output doesn't depend on the locale and can be read back by StringToNumber.
+	*
+	* \remark When the standard library doesn't support floating-point std::to_chars, snprintf is used (with up to max_digits10 digits)
+	*
+	* \see AppendNumber
+	* \see StringToNumber
+	*/
+	template<typename T>
+	Result<std::string_view, NumberError> NumberToString(T value, char* buffer, std::size_t bufferSize)
+	{
+		static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Type must be an integer or a floating-point type");
+
+#ifndef NAZARA_STRINGUTILS_FLOAT_CHARCONV
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			std::size_t length = Detail::FloatToStringFallback(value, buffer, bufferSize);
+			if (length == 0)
+				return Err(NumberError::BufferTooSmall);
+
+			return Ok(std::string_view(buffer, length));
+		}
+		else
+#endif
+		{
+			std::to_chars_result result = std::to_chars(buffer, buffer + bufferSize, value);
+			if (result.ec != std::errc())
+				return Err(NumberError::BufferTooSmall);
+
+			return Ok(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)));
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Parses a number from a string
+	* \return The number, NumberError::InvalidFormat if str isn't entirely a number or NumberError::OutOfRange if it doesn't fit in T
+	*
+	* \param str String containing only the number
+	*
+	* Integers are read in base 10, floating-point numbers in fixed or scientific notation (and inf/nan), independently of the locale.
+	* Leading whitespaces and '+' are rejected.
+	*
+	* \remark When the standard library doesn't support floating-point std::from_chars, strtod is used after checking the format
+	*
+	* \see NumberToString
+	*/
+	template<typename T>
+	Result<T, NumberError> StringToNumber(std::string_view str)
+	{
+		static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Type must be an integer or a floating-point type");
+
+#ifndef NAZARA_STRINGUTILS_FLOAT_CHARCONV
+		if constexpr (std::is_floating_point_v<T>)
+			return Detail::StringToFloatFallback<T>(str);
+		else
+#endif
+		{
+			T value;
+			std::from_chars_result result = std::from_chars(str.data(), str.data() + str.size(), value);
+			if (result.ec == std::errc::result_out_of_range)
+				return Err(NumberError::OutOfRange);
+
+			if (result.ec != std::errc() || result.ptr != str.data() + str.size())
+				return Err(NumberError::InvalidFormat);
+
+			return value;
+		}
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Converts a std::u8string to a std::string
@@ -83,5 +1169,298 @@ namespace Nz
 		return str; // dummy
 	}
 #endif
+
+	/*!
+	* \ingroup utils
+	* \brief Checks if a string is valid UTF-8
+	* \return True if str only contains well-formed UTF-8 sequences
+	*
+	* \param str String to check, may come from an untrusted source
+	*
+	* Truncated sequences, overlong encodings, surrogates and code points above U+10FFFF are rejected.
+	*
+	* \remark Uses AVX2, SSSE3 or NEON (if supported by the CPU) to check 16 to 32 bytes per iteration without branching on the content
+	*/
+	inline bool IsValidUtf8(std::string_view str)
+	{
+		const UInt8* data = reinterpret_cast<const UInt8*>(str.data());
+		if (str.size() < Detail::UnicodeKernelScalarThreshold)
+			return Detail::ScalarValidateUtf8(data, str.size());
+
+		return Detail::GetUnicodeKernelTable().validateUtf8Func(data, str.size());
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of UTF-16 code units needed to transcode a UTF-8 string
+	* \return Exact number of code units if str is valid, an upper bound of what Utf8ToUtf16 can write otherwise
+	*
+	* \param str UTF-8 string
+	*
+	* \see Utf8ToUtf16
+	*/
+	inline std::size_t Utf16LengthFromUtf8(std::string_view str)
+	{
+		// Every byte which isn't a continuation byte starts a code point, four-byte sequences need a surrogate pair
+		std::size_t length = 0;
+		for (char c : str)
+		{
+			UInt8 byte = static_cast<UInt8>(c);
+			length += ((byte & 0xC0) != 0x80) + (byte >= 0xF0);
+		}
+
+		return length;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of UTF-32 code units needed to transcode a UTF-8 string
+	* \return Exact number of code units if str is valid, an upper bound of what Utf8ToUtf32 can write otherwise
+	*
+	* \param str UTF-8 string
+	*
+	* \see Utf8ToUtf32
+	*/
+	inline std::size_t Utf32LengthFromUtf8(std::string_view str)
+	{
+		std::size_t length = 0;
+		for (char c : str)
+			length += ((static_cast<UInt8>(c) & 0xC0) != 0x80);
+
+		return length;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Computes the number of bytes needed to transcode a UTF-16 string to UTF-8
+	* \return Exact number of bytes if str is valid, an upper bound of what Utf16ToUtf8 can write otherwise
+	*
+	* \param str UTF-16 string
+	*
+	* \see Utf16ToUtf8
+	*/
+	inline std::size_t Utf8LengthFromUtf16(std::u16string_view str)
+	{
+		// Each half of a surrogate pair accounts for two of the four bytes of the sequence
+		std::size_t length = 0;
+		for (char16_t c : str)
+			length += 1 + (c >= 0x80) + (c >= 0x800 && (c & 0xF800) != 0xD800);
+
+		return length;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Transcodes a UTF-8 string to UTF-16 (in native endianness)
+	* \return Number of code units written, or std::nullopt if str isn't valid UTF-8
+	*
+	* \param str UTF-8 string, may come from an untrusted source
+	* \param output Buffer receiving the UTF-16 string (not null-terminated), must have room for Utf16LengthFromUtf8(str) code units (str.size() is always enough)
+	*
+	* \remark If str is invalid, output may have been partially written
+	* \remark ASCII runs are widened 16 to 32 bytes at a time with AVX2, SSSE3 or NEON (if supported by the CPU)
+	*
+	* \see Utf16LengthFromUtf8
+	*/
+	inline std::optional<std::size_t> Utf8ToUtf16(std::string_view str, char16_t* output)
+	{
+		const UInt8* data = reinterpret_cast<const UInt8*>(str.data());
+
+		std::size_t length;
+		if (str.size() < Detail::UnicodeKernelScalarThreshold)
+			length = Detail::ScalarUtf8ToUtf16(data, str.size(), output);
+		else
+			length = Detail::GetUnicodeKernelTable().utf8ToUtf16Func(data, str.size(), output);
+
+		if (length == Detail::InvalidUnicodeLength)
+			return std::nullopt;
+
+		return length;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Transcodes a UTF-8 string to UTF-32 (in native endianness)
+	* \return Number of code points written, or std::nullopt if str isn't valid UTF-8
+	*
+	* \param str UTF-8 string, may come from an untrusted source
+	* \param output Buffer receiving the UTF-32 string (not null-terminated), must have room for Utf32LengthFromUtf8(str) code points (str.size() is always enough)
+	*
+	* \remark If str is invalid, output may have been partially written
+	* \remark ASCII runs are widened 16 to 32 bytes at a time with AVX2, SSSE3 or NEON (if supported by the CPU)
+	*
+	* \see Utf32LengthFromUtf8
+	*/
+	inline std::optional<std::size_t> Utf8ToUtf32(std::string_view str, char32_t* output)
+	{
+		const UInt8* data = reinterpret_cast<const UInt8*>(str.data());
+
+		std::size_t length;
+		if (str.size() < Detail::UnicodeKernelScalarThreshold)
+			length = Detail::ScalarUtf8ToUtf32(data, str.size(), output);
+		else
+			length = Detail::GetUnicodeKernelTable().utf8ToUtf32Func(data, str.size(), output);
+
+		if (length == Detail::InvalidUnicodeLength)
+			return std::nullopt;
+
+		return length;
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Transcodes a UTF-16 string (in native endianness) to UTF-8
+	* \return Number of bytes written, or std::nullopt if str contains unpaired surrogates
+	*
+	* \param str UTF-16 string
+	* \param output Buffer receiving the UTF-8 string (not null-terminated), must have room for Utf8LengthFromUtf16(str) bytes (str.size() * 3 is always enough)
+	*
+	* \remark If str is invalid, output may have been partially written
+	* \remark ASCII runs are narrowed 16 to 32 code units at a time with AVX2, SSSE3 or NEON (if supported by the CPU)
+	*
+	* \see Utf8LengthFromUtf16
+	*/
+	inline std::optional<std::size_t> Utf16ToUtf8(std::u16string_view str, char* output)
+	{
+		std::size_t length;
+		if (str.size() < Detail::UnicodeKernelScalarThreshold)
+			length = Detail::ScalarUtf16ToUtf8(str.data(), str.size(), output);
+		else
+			length = Detail::GetUnicodeKernelTable().utf16ToUtf8Func(str.data(), str.size(), output);
+
+		if (length == Detail::InvalidUnicodeLength)
+			return std::nullopt;
+
+		return length;
+	}
+
+
+	inline SplitIterator::SplitIterator() :
+	m_delimiterChar(0),
+	m_isLastToken(true),
+	m_isEnd(true),
+	m_isSingleChar(true)
+	{
+	}
+
+	inline SplitIterator::SplitIterator(std::string_view str, char delimiter) :
+	m_remaining(str),
+	m_delimiterChar(delimiter),
+	m_isLastToken(false),
+	m_isEnd(str.empty()),
+	m_isSingleChar(true)
+	{
+		if (!m_isEnd)
+			Advance();
+	}
+
+	inline SplitIterator::SplitIterator(std::string_view str, std::string_view delimiter) :
+	m_delimiter(delimiter),
+	m_remaining(str),
+	m_delimiterChar((delimiter.size() == 1) ? delimiter[0] : 0),
+	m_isLastToken(false),
+	m_isEnd(str.empty()),
+	m_isSingleChar(delimiter.size() == 1)
+	{
+		if (!m_isEnd)
+			Advance();
+	}
+
+	inline SplitIterator SplitIterator::operator++(int)
+	{
+		SplitIterator copy(*this);
+		operator++();
+		return copy;
+	}
+
+	inline SplitIterator& SplitIterator::operator++()
+	{
+		if (m_isLastToken)
+		{
+			m_isEnd = true;
+			m_token = {};
+		}
+		else
+			Advance();
+
+		return *this;
+	}
+
+	inline bool SplitIterator::operator==(const SplitIterator& rhs) const
+	{
+		// Every token starts at a different position of the string
+		if (m_isEnd || rhs.m_isEnd)
+			return m_isEnd == rhs.m_isEnd;
+
+		return m_token.data() == rhs.m_token.data();
+	}
+
+	inline bool SplitIterator::operator!=(const SplitIterator& rhs) const
+	{
+		return !operator==(rhs);
+	}
+
+	inline auto SplitIterator::operator*() const -> reference
+	{
+		return m_token;
+	}
+
+	inline auto SplitIterator::operator->() const -> pointer
+	{
+		return &m_token;
+	}
+
+	inline void SplitIterator::Advance()
+	{
+		std::size_t pos = std::string_view::npos;
+		std::size_t delimiterSize = 1;
+		if (m_isSingleChar)
+		{
+			if (!m_remaining.empty())
+			{
+				if (const void* ptr = std::memchr(m_remaining.data(), m_delimiterChar, m_remaining.size()))
+					pos = static_cast<std::size_t>(static_cast<const char*>(ptr) - m_remaining.data());
+			}
+		}
+		else if (!m_delimiter.empty())
+		{
+			pos = m_remaining.find(m_delimiter);
+			delimiterSize = m_delimiter.size();
+		}
+
+		if (pos == std::string_view::npos)
+		{
+			m_token = m_remaining;
+			m_remaining = {};
+			m_isLastToken = true;
+		}
+		else
+		{
+			m_token = m_remaining.substr(0, pos);
+			m_remaining.remove_prefix(pos + delimiterSize);
+		}
+	}
+
+
+	inline SplitRange::SplitRange(std::string_view str, char delimiter) :
+	m_begin(str, delimiter)
+	{
+	}
+
+	inline SplitRange::SplitRange(std::string_view str, std::string_view delimiter) :
+	m_begin(str, delimiter)
+	{
+	}
+
+	inline SplitIterator SplitRange::begin() const
+	{
+		return m_begin;
+	}
+
+	inline SplitIterator SplitRange::end() const
+	{
+		return SplitIterator();
+	}
 }
 
+#undef NAZARA_STRINGUTILS_TARGET
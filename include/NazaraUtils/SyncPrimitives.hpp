@@ -0,0 +1,164 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SYNCPRIMITIVES_HPP
+#define NAZARAUTILS_SYNCPRIMITIVES_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Exponential backoff: a growing number of pause instructions, then yielding the thread
+		class SpinBackoff
+		{
+			public:
+				SpinBackoff() = default;
+
+				inline void Pause();
+				inline void Reset();
+
+				inline bool ShouldBlock() const;
+
+				static constexpr UInt32 MaxPauseShift = 6;
+				static constexpr UInt32 YieldCount = 4;
+
+			private:
+				UInt32 m_iteration = 0;
+		};
+
+		inline void CpuRelax();
+
+		// Futex-like wait on a 32 bits word: blocks while the word is equal to expected value (may wake up spuriously)
+		inline void WaitOnAtomic(std::atomic<UInt32>& value, UInt32 expectedValue);
+		inline void WakeAllOnAtomic(std::atomic<UInt32>& value);
+		inline void WakeOneOnAtomic(std::atomic<UInt32>& value);
+	}
+
+	class SpinLock
+	{
+		public:
+			SpinLock() = default;
+			SpinLock(const SpinLock&) = delete;
+			SpinLock(SpinLock&&) = delete;
+			~SpinLock() = default;
+
+			inline bool IsLocked() const;
+
+			inline void lock();
+			inline bool try_lock();
+			inline void unlock();
+
+			SpinLock& operator=(const SpinLock&) = delete;
+			SpinLock& operator=(SpinLock&&) = delete;
+
+		private:
+			std::atomic<UInt32> m_locked = 0;
+	};
+
+	class FutexMutex
+	{
+		public:
+			FutexMutex() = default;
+			FutexMutex(const FutexMutex&) = delete;
+			FutexMutex(FutexMutex&&) = delete;
+			~FutexMutex() = default;
+
+			inline bool IsLocked() const;
+
+			inline void lock();
+			inline bool try_lock();
+			inline void unlock();
+
+			FutexMutex& operator=(const FutexMutex&) = delete;
+			FutexMutex& operator=(FutexMutex&&) = delete;
+
+		private:
+			inline void LockContended();
+
+			static constexpr UInt32 Unlocked = 0;
+			static constexpr UInt32 Locked = 1;
+			static constexpr UInt32 LockedWithWaiters = 2;
+
+			std::atomic<UInt32> m_state = Unlocked;
+	};
+
+	class RWLock
+	{
+		public:
+			RWLock() = default;
+			RWLock(const RWLock&) = delete;
+			RWLock(RWLock&&) = delete;
+			~RWLock() = default;
+
+			inline void lock();
+			inline void lock_shared();
+			inline bool try_lock();
+			inline bool try_lock_shared();
+			inline void unlock();
+			inline void unlock_shared();
+
+			RWLock& operator=(const RWLock&) = delete;
+			RWLock& operator=(RWLock&&) = delete;
+
+			static constexpr UInt32 MaxReaderCount = (1u << 15) - 1;
+			static constexpr UInt32 MaxWaitingWriterCount = (1u << 15) - 1;
+
+		private:
+			inline void Sleep(UInt32 state);
+
+			static constexpr UInt32 ReaderMask = MaxReaderCount;
+			static constexpr UInt32 WaitingWriterOne = 1u << 15;
+			static constexpr UInt32 WaitingWriterMask = MaxWaitingWriterCount << 15;
+			static constexpr UInt32 SleepersBit = 1u << 30;
+			static constexpr UInt32 WriterBit = 1u << 31;
+
+			std::atomic<UInt32> m_state = 0; //< readers (bits 0-14), waiting writers (bits 15-29), sleeping threads flag (bit 30), writer flag (bit 31)
+	};
+
+	template<typename T>
+	class SeqLock
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SeqLock only supports trivially copyable types");
+
+		public:
+			SeqLock();
+			explicit SeqLock(const T& value);
+			SeqLock(const SeqLock&) = delete;
+			SeqLock(SeqLock&&) = delete;
+			~SeqLock() = default;
+
+			T Load() const;
+
+			void Store(const T& value);
+
+			template<typename F> void Update(F&& func);
+
+			SeqLock& operator=(const SeqLock&) = delete;
+			SeqLock& operator=(SeqLock&&) = delete;
+
+		private:
+			using Word = std::conditional_t<(alignof(T) >= alignof(UInt64) && sizeof(T) % sizeof(UInt64) == 0), UInt64, UInt32>;
+			static constexpr std::size_t WordCount = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+			UInt32 BeginWrite();
+			void EndWrite(UInt32 sequence);
+			T ReadValue() const;
+			void WriteValue(const T& value);
+
+			std::atomic<UInt32> m_sequence; //< odd while a writer is updating the value
+			std::array<std::atomic<Word>, WordCount> m_words;
+	};
+}
+
+#include <NazaraUtils/SyncPrimitives.inl>
+
+#endif // NAZARAUTILS_SYNCPRIMITIVES_HPP
@@ -0,0 +1,475 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <thread>
+#include <utility>
+
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+	#ifdef NAZARA_COMPILER_MSVC
+		#include <intrin.h>
+	#else
+		#include <immintrin.h>
+	#endif
+#elif defined(NAZARA_ARCH_aarch64) && defined(NAZARA_COMPILER_MSVC)
+	#include <intrin.h>
+#endif
+
+#if defined(NAZARA_PLATFORM_LINUX) || defined(NAZARA_PLATFORM_ANDROID)
+	#define NAZARA_SYNCPRIMITIVES_FUTEX
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elif defined(NAZARA_PLATFORM_WINDOWS) && defined(NAZARA_COMPILER_MSVC)
+	#define NAZARA_SYNCPRIMITIVES_WAITONADDRESS
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+		#define NAZARA_SYNCPRIMITIVES_UNDEF_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+		#define NAZARA_SYNCPRIMITIVES_UNDEF_NOMINMAX
+	#endif
+	#include <windows.h>
+	#ifdef NAZARA_SYNCPRIMITIVES_UNDEF_LEAN_AND_MEAN
+		#undef WIN32_LEAN_AND_MEAN
+		#undef NAZARA_SYNCPRIMITIVES_UNDEF_LEAN_AND_MEAN
+	#endif
+	#ifdef NAZARA_SYNCPRIMITIVES_UNDEF_NOMINMAX
+		#undef NOMINMAX
+		#undef NAZARA_SYNCPRIMITIVES_UNDEF_NOMINMAX
+	#endif
+	#pragma comment(lib, "Synchronization.lib")
+#elif defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201907L
+	#define NAZARA_SYNCPRIMITIVES_ATOMICWAIT
+#endif
+
+namespace Nz
+{
+	namespace Detail
+	{
+		inline void SpinBackoff::Pause()
+		{
+			if (m_iteration < MaxPauseShift)
+			{
+				for (UInt32 i = 0; i < (1u << m_iteration); ++i)
+					CpuRelax();
+			}
+			else
+				std::this_thread::yield();
+
+			if (m_iteration < MaxPauseShift + YieldCount)
+				m_iteration++;
+		}
+
+		inline void SpinBackoff::Reset()
+		{
+			m_iteration = 0;
+		}
+
+		inline bool SpinBackoff::ShouldBlock() const
+		{
+			return m_iteration >= MaxPauseShift + YieldCount;
+		}
+
+		/*!
+		* \brief Hints the CPU that the thread is spinning (pause on x86, yield on ARM64), reducing power usage and the cost of leaving the spin loop
+		*/
+		inline void CpuRelax()
+		{
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+			_mm_pause();
+#elif defined(NAZARA_ARCH_aarch64) && defined(NAZARA_COMPILER_MSVC)
+			__yield();
+#elif defined(NAZARA_ARCH_aarch64) || defined(NAZARA_ARCH_arm)
+			__asm__ __volatile__("yield");
+#endif
+		}
+
+		inline void WaitOnAtomic([[maybe_unused]] std::atomic<UInt32>& value, [[maybe_unused]] UInt32 expectedValue)
+		{
+#if defined(NAZARA_SYNCPRIMITIVES_FUTEX)
+			static_assert(sizeof(std::atomic<UInt32>) == sizeof(UInt32));
+			syscall(SYS_futex, reinterpret_cast<UInt32*>(&value), FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+#elif defined(NAZARA_SYNCPRIMITIVES_WAITONADDRESS)
+			WaitOnAddress(&value, &expectedValue, sizeof(UInt32), INFINITE);
+#elif defined(NAZARA_SYNCPRIMITIVES_ATOMICWAIT)
+			value.wait(expectedValue, std::memory_order_relaxed);
+#else
+			// No wait primitive, callers check the value again and will come back here (spurious wakeups are allowed)
+			std::this_thread::yield();
+#endif
+		}
+
+		inline void WakeAllOnAtomic([[maybe_unused]] std::atomic<UInt32>& value)
+		{
+#if defined(NAZARA_SYNCPRIMITIVES_FUTEX)
+			syscall(SYS_futex, reinterpret_cast<UInt32*>(&value), FUTEX_WAKE_PRIVATE, std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+#elif defined(NAZARA_SYNCPRIMITIVES_WAITONADDRESS)
+			WakeByAddressAll(&value);
+#elif defined(NAZARA_SYNCPRIMITIVES_ATOMICWAIT)
+			value.notify_all();
+#else
+#endif
+		}
+
+		inline void WakeOneOnAtomic([[maybe_unused]] std::atomic<UInt32>& value)
+		{
+#if defined(NAZARA_SYNCPRIMITIVES_FUTEX)
+			syscall(SYS_futex, reinterpret_cast<UInt32*>(&value), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(NAZARA_SYNCPRIMITIVES_WAITONADDRESS)
+			WakeByAddressSingle(&value);
+#elif defined(NAZARA_SYNCPRIMITIVES_ATOMICWAIT)
+			value.notify_one();
+#else
+#endif
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::SpinLock
+	* \brief 4 bytes test-and-test-and-set spinlock with exponential backoff
+	*
+	* Waiting threads spin on a plain load (keeping the cache line shared) with an increasing number of pause instructions, then yield.
+	* This is meant for very short critical sections with low contention, prefer FutexMutex when the lock can be held for longer.
+	*
+	* \remark Satisfies the Lockable named requirement (usable with std::lock_guard and std::unique_lock)
+	*/
+
+	inline bool SpinLock::IsLocked() const
+	{
+		return m_locked.load(std::memory_order_relaxed) != 0;
+	}
+
+	inline void SpinLock::lock()
+	{
+		Detail::SpinBackoff backoff;
+		for (;;)
+		{
+			if (m_locked.exchange(1, std::memory_order_acquire) == 0)
+				return;
+
+			while (m_locked.load(std::memory_order_relaxed) != 0)
+				backoff.Pause();
+		}
+	}
+
+	inline bool SpinLock::try_lock()
+	{
+		return m_locked.load(std::memory_order_relaxed) == 0 && m_locked.exchange(1, std::memory_order_acquire) == 0;
+	}
+
+	inline void SpinLock::unlock()
+	{
+		m_locked.store(0, std::memory_order_release);
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::FutexMutex
+	* \brief 4 bytes adaptive mutex, spinning for a short time before sleeping on a futex (Linux), WaitOnAddress (Windows) or std::atomic::wait
+	*
+	* Locking and unlocking an uncontended mutex is a single atomic operation, unlocking only issues a system call when another thread is sleeping.
+	*
+	* \remark Satisfies the Lockable named requirement (usable with std::lock_guard and std::unique_lock)
+	*/
+
+	inline bool FutexMutex::IsLocked() const
+	{
+		return m_state.load(std::memory_order_relaxed) != Unlocked;
+	}
+
+	inline void FutexMutex::lock()
+	{
+		UInt32 state = Unlocked;
+		if NAZARA_LIKELY(m_state.compare_exchange_strong(state, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+			return;
+
+		LockContended();
+	}
+
+	inline bool FutexMutex::try_lock()
+	{
+		UInt32 state = Unlocked;
+		return m_state.compare_exchange_strong(state, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+	}
+
+	inline void FutexMutex::unlock()
+	{
+		if NAZARA_UNLIKELY(m_state.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+			Detail::WakeOneOnAtomic(m_state);
+	}
+
+	inline void FutexMutex::LockContended()
+	{
+		// Spin while the owner is not contended, it is likely to release the mutex soon
+		Detail::SpinBackoff backoff;
+		while (!backoff.ShouldBlock())
+		{
+			UInt32 state = m_state.load(std::memory_order_relaxed);
+			if (state == Unlocked && m_state.compare_exchange_weak(state, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+				return;
+
+			if (state == LockedWithWaiters)
+				break;
+
+			backoff.Pause();
+		}
+
+		// Mark the mutex as contended so the owner wakes us up, we may then take it with the contended state (possibly waking a thread for nothing)
+		while (m_state.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+			Detail::WaitOnAtomic(m_state, LockedWithWaiters);
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::RWLock
+	* \brief 4 bytes writer-preferring reader-writer lock
+	*
+	* Readers share the lock as long as no writer holds it or waits for it, a waiting writer blocks new readers so it cannot starve.
+	* Threads spin for a short time before sleeping on the lock state (see FutexMutex), unlocking only issues a system call if a thread is sleeping.
+	*
+	* \remark Satisfies the Lockable and SharedLockable named requirements (usable with std::unique_lock and std::shared_lock)
+	* \remark At most MaxReaderCount threads can share the lock at the same time
+	*/
+
+	inline void RWLock::lock()
+	{
+		if NAZARA_LIKELY(try_lock())
+			return;
+
+		m_state.fetch_add(WaitingWriterOne, std::memory_order_relaxed);
+
+		Detail::SpinBackoff backoff;
+		for (;;)
+		{
+			UInt32 state = m_state.load(std::memory_order_relaxed);
+			if ((state & (WriterBit | ReaderMask)) == 0)
+			{
+				if (m_state.compare_exchange_weak(state, (state - WaitingWriterOne) | WriterBit, std::memory_order_acquire, std::memory_order_relaxed))
+					return;
+
+				continue;
+			}
+
+			if (backoff.ShouldBlock())
+				Sleep(state);
+			else
+				backoff.Pause();
+		}
+	}
+
+	inline void RWLock::lock_shared()
+	{
+		Detail::SpinBackoff backoff;
+		for (;;)
+		{
+			UInt32 state = m_state.load(std::memory_order_relaxed);
+			if ((state & (WriterBit | WaitingWriterMask)) == 0 && (state & ReaderMask) < MaxReaderCount)
+			{
+				if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed))
+					return;
+
+				continue;
+			}
+
+			if (backoff.ShouldBlock())
+				Sleep(state);
+			else
+				backoff.Pause();
+		}
+	}
+
+	inline bool RWLock::try_lock()
+	{
+		UInt32 state = m_state.load(std::memory_order_relaxed);
+		if ((state & (WriterBit | ReaderMask)) != 0)
+			return false;
+
+		return m_state.compare_exchange_strong(state, state | WriterBit, std::memory_order_acquire, std::memory_order_relaxed);
+	}
+
+	inline bool RWLock::try_lock_shared()
+	{
+		UInt32 state = m_state.load(std::memory_order_relaxed);
+		if ((state & (WriterBit | WaitingWriterMask)) != 0 || (state & ReaderMask) >= MaxReaderCount)
+			return false;
+
+		return m_state.compare_exchange_strong(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed);
+	}
+
+	inline void RWLock::unlock()
+	{
+		UInt32 previousState = m_state.fetch_and(~(WriterBit | SleepersBit), std::memory_order_release);
+		if NAZARA_UNLIKELY(previousState & SleepersBit)
+			Detail::WakeAllOnAtomic(m_state);
+	}
+
+	inline void RWLock::unlock_shared()
+	{
+		// The last reader clears the sleepers flag and wakes everyone up (waiting writers as well as readers blocked by them)
+		UInt32 state = m_state.load(std::memory_order_relaxed);
+		UInt32 newState;
+		do
+		{
+			newState = state - 1;
+			if ((state & ReaderMask) == 1)
+				newState &= ~SleepersBit;
+		}
+		while (!m_state.compare_exchange_weak(state, newState, std::memory_order_release, std::memory_order_relaxed));
+
+		if NAZARA_UNLIKELY((state & ReaderMask) == 1 && (state & SleepersBit))
+			Detail::WakeAllOnAtomic(m_state);
+	}
+
+	inline void RWLock::Sleep(UInt32 state)
+	{
+		if ((state & SleepersBit) == 0)
+		{
+			if (!m_state.compare_exchange_strong(state, state | SleepersBit, std::memory_order_relaxed))
+				return; //< state changed, try again
+
+			state |= SleepersBit;
+		}
+
+		Detail::WaitOnAtomic(m_state, state);
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::SeqLock
+	* \brief Sequence lock protecting a trivially copyable value, for data read much more often than written
+	*
+	* Readers never write to shared memory: they copy the value and retry if a writer updated it in the meantime.
+	* Writers increment a 4 bytes sequence counter to an odd value while updating, concurrent writers are serialized on that counter.
+	* The value is stored as an array of relaxed atomic words, so torn reads (which are discarded) are not data races.
+	*
+	* \remark Readers may spin while a writer is updating the value, writers should keep updates short
+	*/
+
+	template<typename T>
+	SeqLock<T>::SeqLock() :
+	SeqLock(T{})
+	{
+	}
+
+	template<typename T>
+	SeqLock<T>::SeqLock(const T& value) :
+	m_sequence(0)
+	{
+		WriteValue(value);
+	}
+
+	/*!
+	* \brief Returns a consistent copy of the value
+	*
+	* \remark Can be called concurrently with writers, from any thread
+	*/
+	template<typename T>
+	T SeqLock<T>::Load() const
+	{
+		Detail::SpinBackoff backoff;
+		for (;;)
+		{
+			UInt32 sequence = m_sequence.load(std::memory_order_acquire);
+			if ((sequence & 1) == 0)
+			{
+				T value = ReadValue();
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (m_sequence.load(std::memory_order_relaxed) == sequence)
+					return value;
+			}
+
+			backoff.Pause();
+		}
+	}
+
+	/*!
+	* \brief Replaces the value
+	*
+	* \param value New value
+	*/
+	template<typename T>
+	void SeqLock<T>::Store(const T& value)
+	{
+		UInt32 sequence = BeginWrite();
+		WriteValue(value);
+		EndWrite(sequence);
+	}
+
+	/*!
+	* \brief Modifies the value in place, writers being excluded meanwhile
+	*
+	* \param func Function called with a reference to a copy of the current value, which is then stored
+	*
+	* \remark Readers spin while func runs, it should be short and must not throw
+	*/
+	template<typename T>
+	template<typename F>
+	void SeqLock<T>::Update(F&& func)
+	{
+		UInt32 sequence = BeginWrite();
+		T value = ReadValue();
+		func(value);
+		WriteValue(value);
+		EndWrite(sequence);
+	}
+
+	template<typename T>
+	UInt32 SeqLock<T>::BeginWrite()
+	{
+		Detail::SpinBackoff backoff;
+		for (;;)
+		{
+			UInt32 sequence = m_sequence.load(std::memory_order_relaxed);
+			if ((sequence & 1) == 0 && m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				// Prevent the value stores from being reordered before the odd sequence
+				std::atomic_thread_fence(std::memory_order_release);
+				return sequence + 1;
+			}
+
+			backoff.Pause();
+		}
+	}
+
+	template<typename T>
+	void SeqLock<T>::EndWrite(UInt32 sequence)
+	{
+		m_sequence.store(sequence + 1, std::memory_order_release);
+	}
+
+	template<typename T>
+	T SeqLock<T>::ReadValue() const
+	{
+		std::array<Word, WordCount> words;
+		for (std::size_t i = 0; i < WordCount; ++i)
+			words[i] = m_words[i].load(std::memory_order_relaxed);
+
+		alignas(T) unsigned char storage[sizeof(T)];
+		std::memcpy(storage, words.data(), sizeof(T));
+		return *std::launder(reinterpret_cast<T*>(storage));
+	}
+
+	template<typename T>
+	void SeqLock<T>::WriteValue(const T& value)
+	{
+		std::array<Word, WordCount> words{};
+		std::memcpy(words.data(), &value, sizeof(T));
+
+		for (std::size_t i = 0; i < WordCount; ++i)
+			m_words[i].store(words[i], std::memory_order_relaxed);
+	}
+}
+
+#if defined(NAZARA_SYNCPRIMITIVES_FUTEX)
+	#undef NAZARA_SYNCPRIMITIVES_FUTEX
+#elif defined(NAZARA_SYNCPRIMITIVES_WAITONADDRESS)
+	#undef NAZARA_SYNCPRIMITIVES_WAITONADDRESS
+#elif defined(NAZARA_SYNCPRIMITIVES_ATOMICWAIT)
+	#undef NAZARA_SYNCPRIMITIVES_ATOMICWAIT
+#endif
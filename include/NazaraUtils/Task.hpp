@@ -0,0 +1,241 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TASK_HPP
+#define NAZARAUTILS_TASK_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+// Coroutines support (the library itself targets C++17, this header is empty without C++20 coroutines)
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L
+	#define NAZARA_HAS_COROUTINES
+#endif
+
+#ifdef NAZARA_HAS_COROUTINES
+
+#include <NazaraUtils/Result.hpp>
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <array>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+// Coroutine counterparts of NAZARA_TRY and NAZARA_TRY_VALUE, propagating the error through co_return
+#define NAZARA_CO_TRY(expr) \
+	do \
+	{  \
+		auto NazaraSuffixMacro(result_, __LINE__) = (expr); \
+		if NAZARA_UNLIKELY(!NazaraSuffixMacro(result_, __LINE__).IsOk()) \
+			co_return Nz::Err(std::move(NazaraSuffixMacro(result_, __LINE__)).GetError()); \
+	} \
+	while (false)
+
+#define NAZARA_CO_TRY_VALUE(var, expr) \
+	auto NazaraSuffixMacro(result_, __LINE__) = (expr); \
+	if NAZARA_UNLIKELY(!NazaraSuffixMacro(result_, __LINE__).IsOk()) \
+		co_return Nz::Err(std::move(NazaraSuffixMacro(result_, __LINE__)).GetError()); \
+	var = std::move(NazaraSuffixMacro(result_, __LINE__)).GetValue()
+
+namespace Nz
+{
+	template<typename T> class Task;
+
+	namespace Detail
+	{
+		// Thread-local free lists of coroutine frames, by power-of-two size classes
+		class CoroutineFrameAllocator
+		{
+			public:
+				static inline void* Allocate(std::size_t size);
+				static inline void Free(void* frame, std::size_t size) noexcept;
+
+				static constexpr std::size_t MinFrameSize = 64;
+				static constexpr std::size_t SizeClassCount = 7; //< 64 to 4096 bytes, bigger frames use the global allocator
+				static constexpr std::size_t MaxCachedFramesPerClass = 64;
+
+			private:
+				struct FreeFrame
+				{
+					FreeFrame* next;
+				};
+
+				struct Cache
+				{
+					Cache() = default;
+					Cache(const Cache&) = delete;
+					Cache(Cache&&) = delete;
+					inline ~Cache();
+
+					Cache& operator=(const Cache&) = delete;
+					Cache& operator=(Cache&&) = delete;
+
+					std::array<FreeFrame*, SizeClassCount> freeFrames = {};
+					std::array<std::size_t, SizeClassCount> freeFrameCounts = {};
+				};
+
+				static inline Cache& GetCache();
+				static constexpr std::size_t GetSizeClass(std::size_t size);
+		};
+
+		class TaskPromiseBase
+		{
+			public:
+				struct FinalAwaiter
+				{
+					bool await_ready() const noexcept { return false; }
+					template<typename Promise> std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> coroutine) noexcept;
+					void await_resume() const noexcept {}
+				};
+
+				std::suspend_always initial_suspend() const noexcept { return {}; }
+				FinalAwaiter final_suspend() const noexcept { return {}; }
+
+				inline void unhandled_exception() noexcept;
+
+				inline void SetContinuation(std::coroutine_handle<> continuation) noexcept;
+
+				static inline void* operator new(std::size_t size);
+				static inline void operator delete(void* frame, std::size_t size) noexcept;
+
+			protected:
+				inline void RethrowIfFailed() const;
+
+			private:
+				std::coroutine_handle<> m_continuation;
+				std::exception_ptr m_exception;
+		};
+
+		template<typename T>
+		class TaskPromise : public TaskPromiseBase
+		{
+			public:
+				Task<T> get_return_object() noexcept;
+
+				template<typename U = T> void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>);
+
+				T& GetResult() &;
+				T&& GetResult() &&;
+
+			private:
+				std::optional<T> m_result;
+		};
+
+		template<>
+		class TaskPromise<void> : public TaskPromiseBase
+		{
+			public:
+				inline Task<void> get_return_object() noexcept;
+
+				void return_void() noexcept {}
+
+				inline void GetResult() const;
+		};
+
+		class SyncWaitEvent
+		{
+			public:
+				SyncWaitEvent() = default;
+
+				inline void Set();
+				inline void Wait();
+
+			private:
+				std::condition_variable m_condition;
+				std::mutex m_mutex;
+				bool m_isSet = false;
+		};
+
+		// Eagerly started coroutine destroying itself when done, used to bridge tasks to blocking code
+		struct DetachedCoroutine
+		{
+			struct promise_type
+			{
+				DetachedCoroutine get_return_object() noexcept { return {}; }
+				std::suspend_never initial_suspend() const noexcept { return {}; }
+				std::suspend_never final_suspend() const noexcept { return {}; }
+				void return_void() noexcept {}
+				void unhandled_exception() noexcept { std::terminate(); }
+
+				static void* operator new(std::size_t size) { return CoroutineFrameAllocator::Allocate(size); }
+				static void operator delete(void* frame, std::size_t size) noexcept { CoroutineFrameAllocator::Free(frame, size); }
+			};
+		};
+	}
+
+	template<typename T = void>
+	class [[nodiscard]] Task
+	{
+		public:
+			using promise_type = Detail::TaskPromise<T>;
+
+			class Awaiter;
+
+			Task() = default;
+			Task(const Task&) = delete;
+			Task(Task&& task) noexcept;
+			~Task();
+
+			bool IsDone() const;
+			bool IsValid() const;
+
+			Task& operator=(const Task&) = delete;
+			Task& operator=(Task&& task) noexcept;
+
+			Awaiter operator co_await() & noexcept;
+			Awaiter operator co_await() && noexcept;
+
+		private:
+			friend promise_type;
+
+			explicit Task(std::coroutine_handle<promise_type> coroutine) noexcept;
+
+			std::coroutine_handle<promise_type> m_coroutine;
+	};
+
+	template<typename T>
+	class Task<T>::Awaiter
+	{
+		public:
+			explicit Awaiter(std::coroutine_handle<promise_type> coroutine) noexcept;
+
+			bool await_ready() const noexcept;
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept;
+			T await_resume();
+
+		private:
+			std::coroutine_handle<promise_type> m_coroutine;
+	};
+
+	class ScheduleAwaiter
+	{
+		public:
+			explicit ScheduleAwaiter(TaskScheduler& scheduler) noexcept : m_scheduler(scheduler) {}
+
+			bool await_ready() const noexcept { return false; }
+			inline void await_suspend(std::coroutine_handle<> coroutine);
+			void await_resume() const noexcept {}
+
+		private:
+			TaskScheduler& m_scheduler;
+	};
+
+	inline ScheduleAwaiter ScheduleOn(TaskScheduler& scheduler) noexcept;
+	template<typename T> T SyncWait(Task<T> task);
+}
+
+#include <NazaraUtils/Task.inl>
+
+#endif // NAZARA_HAS_COROUTINES
+
+#endif // NAZARAUTILS_TASK_HPP
@@ -0,0 +1,345 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		inline void* CoroutineFrameAllocator::Allocate(std::size_t size)
+		{
+			std::size_t sizeClass = GetSizeClass(size);
+			if NAZARA_UNLIKELY(sizeClass >= SizeClassCount)
+				return ::operator new(size);
+
+			Cache& cache = GetCache();
+			if (FreeFrame* frame = cache.freeFrames[sizeClass])
+			{
+				cache.freeFrames[sizeClass] = frame->next;
+				cache.freeFrameCounts[sizeClass]--;
+				return frame;
+			}
+
+			return ::operator new(MinFrameSize << sizeClass);
+		}
+
+		inline void CoroutineFrameAllocator::Free(void* frame, std::size_t size) noexcept
+		{
+			std::size_t sizeClass = GetSizeClass(size);
+			if NAZARA_UNLIKELY(sizeClass >= SizeClassCount)
+				return ::operator delete(frame);
+
+			// Frames are cached by the thread freeing them, which may not be the one which allocated them (tasks can resume on another thread)
+			Cache& cache = GetCache();
+			if (cache.freeFrameCounts[sizeClass] >= MaxCachedFramesPerClass)
+				return ::operator delete(frame);
+
+			FreeFrame* freeFrame = ::new (frame) FreeFrame;
+			freeFrame->next = cache.freeFrames[sizeClass];
+			cache.freeFrames[sizeClass] = freeFrame;
+			cache.freeFrameCounts[sizeClass]++;
+		}
+
+		inline CoroutineFrameAllocator::Cache::~Cache()
+		{
+			for (FreeFrame* frame : freeFrames)
+			{
+				while (frame)
+				{
+					FreeFrame* next = frame->next;
+					::operator delete(frame);
+					frame = next;
+				}
+			}
+		}
+
+		inline auto CoroutineFrameAllocator::GetCache() -> Cache&
+		{
+			thread_local Cache cache;
+			return cache;
+		}
+
+		constexpr std::size_t CoroutineFrameAllocator::GetSizeClass(std::size_t size)
+		{
+			std::size_t sizeClass = 0;
+			while (sizeClass < SizeClassCount && (MinFrameSize << sizeClass) < size)
+				sizeClass++;
+
+			return sizeClass;
+		}
+
+		template<typename Promise>
+		std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<Promise> coroutine) noexcept
+		{
+			// Symmetric transfer to the awaiting coroutine, which doesn't grow the stack when tasks complete synchronously
+			std::coroutine_handle<> continuation = coroutine.promise().m_continuation;
+			return (continuation) ? continuation : std::noop_coroutine();
+		}
+
+		inline void TaskPromiseBase::unhandled_exception() noexcept
+		{
+			m_exception = std::current_exception();
+		}
+
+		inline void TaskPromiseBase::SetContinuation(std::coroutine_handle<> continuation) noexcept
+		{
+			m_continuation = continuation;
+		}
+
+		inline void* TaskPromiseBase::operator new(std::size_t size)
+		{
+			return CoroutineFrameAllocator::Allocate(size);
+		}
+
+		inline void TaskPromiseBase::operator delete(void* frame, std::size_t size) noexcept
+		{
+			CoroutineFrameAllocator::Free(frame, size);
+		}
+
+		inline void TaskPromiseBase::RethrowIfFailed() const
+		{
+			if NAZARA_UNLIKELY(m_exception)
+				std::rethrow_exception(m_exception);
+		}
+
+		template<typename T>
+		Task<T> TaskPromise<T>::get_return_object() noexcept
+		{
+			return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+		}
+
+		template<typename T>
+		template<typename U>
+		void TaskPromise<T>::return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+		{
+			m_result.emplace(std::forward<U>(value));
+		}
+
+		template<typename T>
+		T& TaskPromise<T>::GetResult() &
+		{
+			RethrowIfFailed();
+			return *m_result;
+		}
+
+		template<typename T>
+		T&& TaskPromise<T>::GetResult() &&
+		{
+			RethrowIfFailed();
+			return std::move(*m_result);
+		}
+
+		inline Task<void> TaskPromise<void>::get_return_object() noexcept
+		{
+			return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+		}
+
+		inline void TaskPromise<void>::GetResult() const
+		{
+			RethrowIfFailed();
+		}
+
+		inline void SyncWaitEvent::Set()
+		{
+			// Notify under the lock, the waiting thread may destroy the event as soon as it can lock the mutex
+			std::unique_lock lock(m_mutex);
+			m_isSet = true;
+			m_condition.notify_one();
+		}
+
+		inline void SyncWaitEvent::Wait()
+		{
+			std::unique_lock lock(m_mutex);
+			m_condition.wait(lock, [&] { return m_isSet; });
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::Task
+	* \brief Lazily started coroutine producing a value of type T (typically a Result), which can be awaited by another coroutine
+	*
+	* A task starts when awaited, its awaiter is resumed directly when it completes (symmetric transfer) so chains of tasks don't grow the stack.
+	* Coroutine frames are taken from thread-local size-class free lists instead of the global allocator.
+	* Errors returned as Result can be propagated with NAZARA_CO_TRY and NAZARA_CO_TRY_VALUE, exceptions are rethrown to the awaiter.
+	*
+	* Use co_await ScheduleOn(scheduler) to continue a task on a TaskScheduler worker, and SyncWait to run a task from regular code.
+	*
+	* \remark Only available with C++20 coroutines (NAZARA_HAS_COROUTINES is defined)
+	*/
+
+	template<typename T>
+	Task<T>::Task(Task&& task) noexcept :
+	m_coroutine(std::exchange(task.m_coroutine, nullptr))
+	{
+	}
+
+	template<typename T>
+	Task<T>::Task(std::coroutine_handle<promise_type> coroutine) noexcept :
+	m_coroutine(coroutine)
+	{
+	}
+
+	template<typename T>
+	Task<T>::~Task()
+	{
+		if (m_coroutine)
+			m_coroutine.destroy();
+	}
+
+	template<typename T>
+	bool Task<T>::IsDone() const
+	{
+		return m_coroutine && m_coroutine.done();
+	}
+
+	template<typename T>
+	bool Task<T>::IsValid() const
+	{
+		return static_cast<bool>(m_coroutine);
+	}
+
+	template<typename T>
+	auto Task<T>::operator=(Task&& task) noexcept -> Task&
+	{
+		if (this != &task)
+		{
+			if (m_coroutine)
+				m_coroutine.destroy();
+
+			m_coroutine = std::exchange(task.m_coroutine, nullptr);
+		}
+
+		return *this;
+	}
+
+	template<typename T>
+	auto Task<T>::operator co_await() & noexcept -> Awaiter
+	{
+		return Awaiter(m_coroutine);
+	}
+
+	template<typename T>
+	auto Task<T>::operator co_await() && noexcept -> Awaiter
+	{
+		return Awaiter(m_coroutine);
+	}
+
+	template<typename T>
+	Task<T>::Awaiter::Awaiter(std::coroutine_handle<promise_type> coroutine) noexcept :
+	m_coroutine(coroutine)
+	{
+	}
+
+	template<typename T>
+	bool Task<T>::Awaiter::await_ready() const noexcept
+	{
+		return m_coroutine.done();
+	}
+
+	template<typename T>
+	std::coroutine_handle<> Task<T>::Awaiter::await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+	{
+		// Start the task right away, it will resume the awaiting coroutine when done
+		m_coroutine.promise().SetContinuation(awaitingCoroutine);
+		return m_coroutine;
+	}
+
+	/*!
+	* \brief Returns the task result, moving it out of the task
+	*
+	* \remark Rethrows the exception which escaped the task body, if any
+	*/
+	template<typename T>
+	T Task<T>::Awaiter::await_resume()
+	{
+		if constexpr (std::is_void_v<T>)
+			m_coroutine.promise().GetResult();
+		else
+			return std::move(m_coroutine.promise()).GetResult();
+	}
+
+	/*!
+	* \brief Suspends the awaiting coroutine and resumes it from a task of the scheduler
+	*
+	* \param coroutine Awaiting coroutine
+	*/
+	inline void ScheduleAwaiter::await_suspend(std::coroutine_handle<> coroutine)
+	{
+		m_scheduler.Submit([coroutine] { coroutine.resume(); });
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Returns an awaitable moving the awaiting coroutine to a worker of the scheduler
+	*
+	* \param scheduler Scheduler whose workers will run the rest of the coroutine
+	*/
+	inline ScheduleAwaiter ScheduleOn(TaskScheduler& scheduler) noexcept
+	{
+		return ScheduleAwaiter(scheduler);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Runs a task and blocks the calling thread until it completes
+	* \return Result of the task
+	*
+	* \param task Task to run, it may complete on another thread (if it awaits ScheduleOn for example)
+	*
+	* \remark Must not be called from a scheduler worker if the task needs a worker of the same scheduler to make progress
+	*/
+	template<typename T>
+	T SyncWait(Task<T> task)
+	{
+		Detail::SyncWaitEvent event;
+		std::exception_ptr exception;
+
+		if constexpr (std::is_void_v<T>)
+		{
+			[](Task<T>& task, Detail::SyncWaitEvent& event, std::exception_ptr& exception) -> Detail::DetachedCoroutine
+			{
+				try
+				{
+					co_await task;
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+
+				event.Set();
+			}(task, event, exception);
+
+			event.Wait();
+			if (exception)
+				std::rethrow_exception(exception);
+		}
+		else
+		{
+			std::optional<T> result;
+			[](Task<T>& task, Detail::SyncWaitEvent& event, std::optional<T>& result, std::exception_ptr& exception) -> Detail::DetachedCoroutine
+			{
+				try
+				{
+					result.emplace(co_await task);
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+
+				event.Set();
+			}(task, event, result, exception);
+
+			event.Wait();
+			if (exception)
+				std::rethrow_exception(exception);
+
+			return std::move(*result);
+		}
+	}
+}
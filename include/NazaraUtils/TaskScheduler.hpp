@@ -0,0 +1,179 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TASKSCHEDULER_HPP
+#define NAZARAUTILS_TASKSCHEDULER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/CacheAligned.hpp>
+#include <NazaraUtils/ConcurrentMemoryPool.hpp>
+#include <NazaraUtils/FixedFunction.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/MpmcQueue.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Nz
+{
+NAZARA_WARNING_PUSH()
+NAZARA_WARNING_MSVC_DISABLE(4324) // structure was padded due to alignment specifier
+
+	namespace Detail
+	{
+		// Fixed-capacity Chase-Lev deque: the owner pushes and pops at the bottom, other threads steal from the top
+		template<typename T, std::size_t Capacity>
+		class WorkStealingDeque
+		{
+			static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+			public:
+				WorkStealingDeque();
+				WorkStealingDeque(const WorkStealingDeque&) = delete;
+				WorkStealingDeque(WorkStealingDeque&&) = delete;
+				~WorkStealingDeque() = default;
+
+				bool Pop(T& value);
+				bool Push(T value);
+				bool Steal(T& value);
+
+				WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+				WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+			private:
+				static constexpr std::size_t Mask = Capacity - 1;
+
+				alignas(CacheLineSize) std::atomic<Int64> m_top;
+				alignas(CacheLineSize) std::atomic<Int64> m_bottom;
+				alignas(CacheLineSize) std::array<std::atomic<T>, Capacity> m_buffer;
+		};
+	}
+
+	class TaskScheduler
+	{
+		struct Task;
+
+		public:
+			class TaskHandle;
+			using TaskFunction = FixedFunction<void(), 6 * sizeof(void*)>;
+
+			inline explicit TaskScheduler(std::size_t workerCount = 0);
+			TaskScheduler(const TaskScheduler&) = delete;
+			TaskScheduler(TaskScheduler&&) = delete;
+			inline ~TaskScheduler();
+
+			inline std::size_t GetWorkerCount() const;
+
+			inline TaskHandle Submit(TaskFunction function);
+			inline TaskHandle Submit(TaskFunction function, std::initializer_list<std::reference_wrapper<const TaskHandle>> dependencies);
+			inline TaskHandle Submit(TaskFunction function, const TaskHandle* dependencies, std::size_t dependencyCount);
+
+			inline void Wait(const TaskHandle& handle);
+			inline void WaitAll();
+
+			TaskScheduler& operator=(const TaskScheduler&) = delete;
+			TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+			static constexpr std::size_t MaxQueuedTasksPerWorker = 1024;
+
+		private:
+			struct CurrentWorker
+			{
+				TaskScheduler* scheduler = nullptr;
+				std::size_t workerIndex = 0;
+				UInt32 randomState = 0;
+			};
+
+			struct Edge
+			{
+				UInt32 successorIndex;
+				UInt32 nextEdge;
+			};
+
+			struct Task
+			{
+				inline explicit Task(TaskFunction&& taskFunction);
+
+				TaskFunction function;
+				std::atomic<UInt32> pendingCount; //< unfinished dependencies + 1 until the task is fully submitted
+				std::atomic<UInt32> referenceCount; //< handles + 1 until the task is finished
+				std::atomic<UInt32> successorHead; //< first edge to a task depending on this one, or ClosedEdge once finished
+				std::atomic<bool> isFinished;
+			};
+
+			struct Worker
+			{
+				Detail::WorkStealingDeque<UInt32, MaxQueuedTasksPerWorker> deque;
+				std::thread thread;
+			};
+
+			inline bool AddSuccessor(Task& dependency, UInt32 successorIndex);
+			inline void Execute(UInt32 taskIndex);
+			inline std::size_t GetCurrentWorkerIndex() const;
+			inline void ReleasePending(UInt32 taskIndex);
+			inline void ReleaseReference(UInt32 taskIndex);
+			inline void Schedule(UInt32 taskIndex);
+			inline Task& RetrieveTask(UInt32 taskIndex);
+			inline bool TryRunTask(std::size_t workerIndex);
+			inline void WorkerLoop(std::size_t workerIndex);
+
+			static inline CurrentWorker& GetCurrentWorker();
+
+			static constexpr std::size_t NoWorker = std::numeric_limits<std::size_t>::max();
+			static constexpr UInt32 ClosedEdge = std::numeric_limits<UInt32>::max();
+			static constexpr UInt32 EmptyEdge = ClosedEdge - 1;
+
+			std::atomic<std::size_t> m_outstandingTaskCount;
+			std::atomic<std::size_t> m_queuedTaskCount;
+			std::atomic<std::size_t> m_sleepingWorkerCount;
+			std::atomic<bool> m_running;
+			std::condition_variable m_wakeCondition;
+			std::mutex m_wakeMutex;
+			std::size_t m_workerCount;
+			std::unique_ptr<CacheAligned<Worker>[]> m_workers;
+			std::unique_ptr<MpmcQueue<UInt32, MaxQueuedTasksPerWorker>> m_externalQueue;
+			ConcurrentMemoryPool<Edge> m_edgePool;
+			ConcurrentMemoryPool<Task> m_taskPool;
+	};
+
+	class TaskScheduler::TaskHandle
+	{
+		friend TaskScheduler;
+
+		public:
+			TaskHandle() = default;
+			inline TaskHandle(const TaskHandle& handle);
+			inline TaskHandle(TaskHandle&& handle) noexcept;
+			inline ~TaskHandle();
+
+			inline bool IsFinished() const;
+			inline bool IsValid() const;
+
+			inline void Reset();
+
+			inline TaskHandle& operator=(const TaskHandle& handle);
+			inline TaskHandle& operator=(TaskHandle&& handle) noexcept;
+
+		private:
+			inline TaskHandle(TaskScheduler* scheduler, UInt32 taskIndex);
+
+			TaskScheduler* m_scheduler = nullptr;
+			UInt32 m_taskIndex = 0;
+	};
+
+NAZARA_WARNING_POP()
+}
+
+#include <NazaraUtils/TaskScheduler.inl>
+
+#endif // NAZARAUTILS_TASKSCHEDULER_HPP
@@ -0,0 +1,553 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Profiler.hpp>
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, std::size_t Capacity>
+		WorkStealingDeque<T, Capacity>::WorkStealingDeque() :
+		m_top(0),
+		m_bottom(0)
+		{
+		}
+
+		/*!
+		* \brief Pops the most recently pushed element
+		* \return True if an element was popped
+		*
+		* \remark Must only be called from the owner thread
+		*/
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingDeque<T, Capacity>::Pop(T& value)
+		{
+			Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_seq_cst);
+			Int64 top = m_top.load(std::memory_order_seq_cst);
+			if (top > bottom)
+			{
+				// Deque was empty
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			value = m_buffer[static_cast<std::size_t>(bottom) & Mask].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last element, race against thieves for it
+				bool taken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return taken;
+			}
+
+			return true;
+		}
+
+		/*!
+		* \brief Pushes an element at the bottom of the deque
+		* \return True if the element was pushed, false if the deque is full
+		*
+		* \remark Must only be called from the owner thread
+		*/
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingDeque<T, Capacity>::Push(T value)
+		{
+			Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+			Int64 top = m_top.load(std::memory_order_acquire);
+			if (bottom - top >= static_cast<Int64>(Capacity))
+				return false;
+
+			m_buffer[static_cast<std::size_t>(bottom) & Mask].store(value, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+		* \brief Steals the oldest element of the deque
+		* \return True if an element was stolen, false if the deque was empty or another thread took the element first
+		*
+		* \remark Can be called from any thread
+		*/
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingDeque<T, Capacity>::Steal(T& value)
+		{
+			Int64 top = m_top.load(std::memory_order_seq_cst);
+			Int64 bottom = m_bottom.load(std::memory_order_seq_cst);
+			if (top >= bottom)
+				return false;
+
+			// The slot cannot be overwritten before top moves past it, so reading it before claiming is fine (the value is discarded if the claim fails)
+			T stolenValue = m_buffer[static_cast<std::size_t>(top) & Mask].load(std::memory_order_relaxed);
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return false;
+
+			value = stolenValue;
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::TaskScheduler
+	* \brief Work-stealing thread pool running tasks and task graphs
+	*
+	* Every worker owns a Chase-Lev deque: tasks submitted from a worker (including from a running task) are pushed to its own deque
+	* and popped in LIFO order, idle workers steal the oldest tasks of randomly picked workers.
+	* Tasks submitted from outside the pool go through a shared bounded injection queue.
+	*
+	* A task can depend on previously submitted tasks, it is only scheduled once all of them finished (each task keeps an atomic counter of
+	* unfinished dependencies and a lock-free list of its successors).
+	* Tasks and dependency edges are stored in concurrent memory pools and task functions never allocate (see FixedFunction), submitting a task
+	* does not touch the heap once the pools are warm.
+	*
+	* Waiting on a task from any thread runs other pending tasks until it finishes, instead of blocking the thread.
+	*
+	* \remark If a worker deque (or the injection queue) is full, the submitted task is executed inline
+	*/
+
+	/*!
+	* \brief Starts the worker threads
+	*
+	* \param workerCount Number of worker threads, zero picks the number of hardware threads minus one (to leave room to the submitting thread), with at least one worker
+	*/
+	inline TaskScheduler::TaskScheduler(std::size_t workerCount) :
+	m_outstandingTaskCount(0),
+	m_queuedTaskCount(0),
+	m_sleepingWorkerCount(0),
+	m_running(true),
+	m_workerCount(workerCount),
+	m_externalQueue(std::make_unique<MpmcQueue<UInt32, MaxQueuedTasksPerWorker>>()),
+	m_edgePool(1024),
+	m_taskPool(1024)
+	{
+		if (m_workerCount == 0)
+		{
+			unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+			m_workerCount = (hardwareThreadCount > 1) ? hardwareThreadCount - 1 : 1;
+		}
+
+		m_workers = std::make_unique<CacheAligned<Worker>[]>(m_workerCount);
+		for (std::size_t i = 0; i < m_workerCount; ++i)
+			m_workers[i]->thread = std::thread([this, i] { WorkerLoop(i); });
+	}
+
+	/*!
+	* \brief Waits for every submitted task to finish and stops the worker threads
+	*/
+	inline TaskScheduler::~TaskScheduler()
+	{
+		WaitAll();
+
+		{
+			std::unique_lock lock(m_wakeMutex);
+			m_running.store(false, std::memory_order_seq_cst);
+		}
+		m_wakeCondition.notify_all();
+
+		for (std::size_t i = 0; i < m_workerCount; ++i)
+			m_workers[i]->thread.join();
+	}
+
+	inline std::size_t TaskScheduler::GetWorkerCount() const
+	{
+		return m_workerCount;
+	}
+
+	/*!
+	* \brief Submits a task without dependencies
+	* \return A handle to the task, which can be waited on or used as a dependency
+	*
+	* \param function Function to run
+	*/
+	inline auto TaskScheduler::Submit(TaskFunction function) -> TaskHandle
+	{
+		return Submit(std::move(function), nullptr, 0);
+	}
+
+	/*!
+	* \brief Submits a task which will only run once all of its dependencies finished
+	* \return A handle to the task, which can be waited on or used as a dependency
+	*
+	* \param function Function to run
+	* \param dependencies Handles of tasks (from this scheduler) which must finish before this task runs, invalid handles are ignored
+	*/
+	inline auto TaskScheduler::Submit(TaskFunction function, std::initializer_list<std::reference_wrapper<const TaskHandle>> dependencies) -> TaskHandle
+	{
+		std::size_t taskIndex;
+		m_taskPool.Allocate(taskIndex, std::move(function));
+		m_outstandingTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+		UInt32 index = static_cast<UInt32>(taskIndex);
+		for (const TaskHandle& dependency : dependencies)
+		{
+			if (dependency.IsValid())
+			{
+				assert(dependency.m_scheduler == this);
+				AddSuccessor(RetrieveTask(dependency.m_taskIndex), index);
+			}
+		}
+
+		// The returned handle adopts the reference the task was created with, take it before the task can run and finish
+		TaskHandle handle(this, index);
+		ReleasePending(index);
+
+		return handle;
+	}
+
+	/*!
+	* \brief Submits a task which will only run once all of its dependencies finished
+	* \return A handle to the task, which can be waited on or used as a dependency
+	*
+	* \param function Function to run
+	* \param dependencies Pointer to an array of handles of tasks (from this scheduler) which must finish before this task runs, invalid handles are ignored
+	* \param dependencyCount Number of handles in the array
+	*/
+	inline auto TaskScheduler::Submit(TaskFunction function, const TaskHandle* dependencies, std::size_t dependencyCount) -> TaskHandle
+	{
+		std::size_t taskIndex;
+		m_taskPool.Allocate(taskIndex, std::move(function));
+		m_outstandingTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+		UInt32 index = static_cast<UInt32>(taskIndex);
+		for (std::size_t i = 0; i < dependencyCount; ++i)
+		{
+			const TaskHandle& dependency = dependencies[i];
+			if (dependency.IsValid())
+			{
+				assert(dependency.m_scheduler == this);
+				AddSuccessor(RetrieveTask(dependency.m_taskIndex), index);
+			}
+		}
+
+		TaskHandle handle(this, index);
+		ReleasePending(index);
+
+		return handle;
+	}
+
+	/*!
+	* \brief Waits until a task finished, running other tasks in the meantime
+	*
+	* \param handle Handle of the task to wait on, does nothing if the handle is invalid
+	*
+	* \remark Can be called from a task, as long as the waited task does not depend on it
+	*/
+	inline void TaskScheduler::Wait(const TaskHandle& handle)
+	{
+		if (!handle.IsValid())
+			return;
+
+		assert(handle.m_scheduler == this);
+
+		std::size_t workerIndex = GetCurrentWorkerIndex();
+		while (!handle.IsFinished())
+		{
+			if (!TryRunTask(workerIndex))
+				std::this_thread::yield();
+		}
+	}
+
+	/*!
+	* \brief Waits until every submitted task finished, running tasks in the meantime
+	*
+	* \remark Must not be called from a task
+	*/
+	inline void TaskScheduler::WaitAll()
+	{
+		std::size_t workerIndex = GetCurrentWorkerIndex();
+		while (m_outstandingTaskCount.load(std::memory_order_acquire) > 0)
+		{
+			if (!TryRunTask(workerIndex))
+				std::this_thread::yield();
+		}
+	}
+
+	/*!
+	* \brief Registers a task as a successor of a dependency
+	* \return True if the successor has to wait on the dependency, false if the dependency already finished
+	*/
+	inline bool TaskScheduler::AddSuccessor(Task& dependency, UInt32 successorIndex)
+	{
+		UInt32 head = dependency.successorHead.load(std::memory_order_acquire);
+		if (head == ClosedEdge)
+			return false;
+
+		// Account for the dependency before publishing the edge, as the dependency may finish right after
+		RetrieveTask(successorIndex).pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+		std::size_t edgeIndex;
+		Edge* edge = m_edgePool.Allocate(edgeIndex);
+		edge->successorIndex = successorIndex;
+
+		do
+		{
+			if (head == ClosedEdge)
+			{
+				m_edgePool.Free(edgeIndex);
+				RetrieveTask(successorIndex).pendingCount.fetch_sub(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			edge->nextEdge = head;
+		}
+		while (!dependency.successorHead.compare_exchange_weak(head, static_cast<UInt32>(edgeIndex), std::memory_order_release, std::memory_order_acquire));
+
+		return true;
+	}
+
+	inline void TaskScheduler::Execute(UInt32 taskIndex)
+	{
+		Task& task = RetrieveTask(taskIndex);
+		{
+			NazaraProfileScope("TaskScheduler task");
+			task.function();
+		}
+		task.function = nullptr;
+
+		// Close the successor list so no edge can be added anymore, and release every successor
+		UInt32 edgeIndex = task.successorHead.exchange(ClosedEdge, std::memory_order_acq_rel);
+		while (edgeIndex != EmptyEdge)
+		{
+			Edge& edge = *m_edgePool.RetrieveFromIndex(edgeIndex);
+			UInt32 successorIndex = edge.successorIndex;
+			UInt32 nextEdge = edge.nextEdge;
+			m_edgePool.Free(edgeIndex);
+
+			ReleasePending(successorIndex);
+			edgeIndex = nextEdge;
+		}
+
+		task.isFinished.store(true, std::memory_order_release);
+		ReleaseReference(taskIndex);
+
+		// Successors were counted when submitted, this can only reach zero once the whole graph ran
+		m_outstandingTaskCount.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	inline std::size_t TaskScheduler::GetCurrentWorkerIndex() const
+	{
+		const CurrentWorker& currentWorker = GetCurrentWorker();
+		return (currentWorker.scheduler == this) ? currentWorker.workerIndex : NoWorker;
+	}
+
+	inline void TaskScheduler::ReleasePending(UInt32 taskIndex)
+	{
+		if (RetrieveTask(taskIndex).pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			Schedule(taskIndex);
+	}
+
+	inline void TaskScheduler::ReleaseReference(UInt32 taskIndex)
+	{
+		if (RetrieveTask(taskIndex).referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			m_taskPool.Free(taskIndex);
+	}
+
+	inline auto TaskScheduler::RetrieveTask(UInt32 taskIndex) -> Task&
+	{
+		return *m_taskPool.RetrieveFromIndex(taskIndex);
+	}
+
+	inline void TaskScheduler::Schedule(UInt32 taskIndex)
+	{
+		// Count the task before making it visible, so that a worker taking it never sees a null counter
+		m_queuedTaskCount.fetch_add(1, std::memory_order_seq_cst);
+
+		std::size_t workerIndex = GetCurrentWorkerIndex();
+		bool queued = (workerIndex != NoWorker) ? m_workers[workerIndex]->deque.Push(taskIndex) : m_externalQueue->TryPush(taskIndex);
+		if NAZARA_UNLIKELY(!queued)
+		{
+			m_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+			Execute(taskIndex);
+			return;
+		}
+
+		if (m_sleepingWorkerCount.load(std::memory_order_seq_cst) > 0)
+		{
+			// Lock to make sure a worker about to sleep either sees the new task or is already waiting
+			{
+				std::unique_lock lock(m_wakeMutex);
+			}
+			m_wakeCondition.notify_one();
+		}
+	}
+
+	inline bool TaskScheduler::TryRunTask(std::size_t workerIndex)
+	{
+		UInt32 taskIndex;
+		bool found = (workerIndex != NoWorker && m_workers[workerIndex]->deque.Pop(taskIndex)) || m_externalQueue->TryPop(taskIndex);
+		if (!found)
+		{
+			// Steal from workers in random order
+			CurrentWorker& currentWorker = GetCurrentWorker();
+			UInt32& randomState = currentWorker.randomState;
+			if (randomState == 0)
+				randomState = static_cast<UInt32>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+
+			// xorshift32
+			randomState ^= randomState << 13;
+			randomState ^= randomState >> 17;
+			randomState ^= randomState << 5;
+
+			std::size_t victimIndex = randomState % m_workerCount;
+			for (std::size_t i = 0; i < m_workerCount; ++i)
+			{
+				if (victimIndex != workerIndex && m_workers[victimIndex]->deque.Steal(taskIndex))
+				{
+					found = true;
+					break;
+				}
+
+				if (++victimIndex == m_workerCount)
+					victimIndex = 0;
+			}
+
+			if (!found)
+				return false;
+		}
+
+		m_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+		Execute(taskIndex);
+		return true;
+	}
+
+	inline void TaskScheduler::WorkerLoop(std::size_t workerIndex)
+	{
+		CurrentWorker& currentWorker = GetCurrentWorker();
+		currentWorker.scheduler = this;
+		currentWorker.workerIndex = workerIndex;
+
+		NazaraProfileThreadName("TaskScheduler worker #" + std::to_string(workerIndex));
+
+		constexpr unsigned int SpinCount = 64;
+
+		for (;;)
+		{
+			bool ranTask = false;
+			for (unsigned int i = 0; i < SpinCount; ++i)
+			{
+				if (TryRunTask(workerIndex))
+				{
+					ranTask = true;
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+
+			if (ranTask)
+				continue;
+
+			std::unique_lock lock(m_wakeMutex);
+			m_sleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+			m_wakeCondition.wait(lock, [&] { return m_queuedTaskCount.load(std::memory_order_seq_cst) > 0 || !m_running.load(std::memory_order_seq_cst); });
+			m_sleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+
+			if (!m_running.load(std::memory_order_relaxed) && m_queuedTaskCount.load(std::memory_order_relaxed) == 0)
+				break;
+		}
+
+		currentWorker.scheduler = nullptr;
+	}
+
+	inline auto TaskScheduler::GetCurrentWorker() -> CurrentWorker&
+	{
+		thread_local CurrentWorker currentWorker;
+		return currentWorker;
+	}
+
+	inline TaskScheduler::Task::Task(TaskFunction&& taskFunction) :
+	function(std::move(taskFunction)),
+	pendingCount(1),
+	referenceCount(2),
+	successorHead(EmptyEdge),
+	isFinished(false)
+	{
+	}
+
+	/*!
+	* \ingroup utils
+	* \class Nz::TaskScheduler::TaskHandle
+	* \brief Reference-counted handle to a submitted task
+	*
+	* A task memory is only returned to the scheduler pool once it finished and all of its handles were released.
+	*/
+
+	inline TaskScheduler::TaskHandle::TaskHandle(const TaskHandle& handle) :
+	m_scheduler(handle.m_scheduler),
+	m_taskIndex(handle.m_taskIndex)
+	{
+		if (m_scheduler)
+			m_scheduler->RetrieveTask(m_taskIndex).referenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	inline TaskScheduler::TaskHandle::TaskHandle(TaskHandle&& handle) noexcept :
+	m_scheduler(std::exchange(handle.m_scheduler, nullptr)),
+	m_taskIndex(handle.m_taskIndex)
+	{
+	}
+
+	inline TaskScheduler::TaskHandle::TaskHandle(TaskScheduler* scheduler, UInt32 taskIndex) :
+	m_scheduler(scheduler),
+	m_taskIndex(taskIndex)
+	{
+	}
+
+	inline TaskScheduler::TaskHandle::~TaskHandle()
+	{
+		Reset();
+	}
+
+	inline bool TaskScheduler::TaskHandle::IsFinished() const
+	{
+		assert(m_scheduler);
+		return m_scheduler->RetrieveTask(m_taskIndex).isFinished.load(std::memory_order_acquire);
+	}
+
+	inline bool TaskScheduler::TaskHandle::IsValid() const
+	{
+		return m_scheduler != nullptr;
+	}
+
+	inline void TaskScheduler::TaskHandle::Reset()
+	{
+		if (m_scheduler)
+		{
+			m_scheduler->ReleaseReference(m_taskIndex);
+			m_scheduler = nullptr;
+		}
+	}
+
+	inline auto TaskScheduler::TaskHandle::operator=(const TaskHandle& handle) -> TaskHandle&
+	{
+		if (this != &handle)
+		{
+			Reset();
+
+			m_scheduler = handle.m_scheduler;
+			m_taskIndex = handle.m_taskIndex;
+			if (m_scheduler)
+				m_scheduler->RetrieveTask(m_taskIndex).referenceCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		return *this;
+	}
+
+	inline auto TaskScheduler::TaskHandle::operator=(TaskHandle&& handle) noexcept -> TaskHandle&
+	{
+		if (this != &handle)
+		{
+			Reset();
+
+			m_scheduler = std::exchange(handle.m_scheduler, nullptr);
+			m_taskIndex = handle.m_taskIndex;
+		}
+
+		return *this;
+	}
+}
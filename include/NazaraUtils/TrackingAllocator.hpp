@@ -0,0 +1,115 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TRACKINGALLOCATOR_HPP
+#define NAZARAUTILS_TRACKINGALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace Nz
+{
+	struct AllocationStats
+	{
+		std::chrono::steady_clock::time_point time;
+		UInt64 allocatedBytes; //< Total size of the allocations since the tracker creation
+		UInt64 allocationCount;
+		UInt64 deallocationCount;
+		std::size_t liveBytes;
+		std::size_t peakBytes;
+	};
+
+	class AllocationTracker
+	{
+		public:
+			inline explicit AllocationTracker(std::string tag);
+			AllocationTracker(const AllocationTracker&) = delete;
+			AllocationTracker(AllocationTracker&&) = delete;
+			inline ~AllocationTracker();
+
+			inline AllocationStats GetStats() const;
+			inline const std::string& GetTag() const;
+
+			inline void RecordAllocation(std::size_t size);
+			inline void RecordDeallocation(std::size_t size);
+
+			inline void ResetPeak();
+
+			AllocationTracker& operator=(const AllocationTracker&) = delete;
+			AllocationTracker& operator=(AllocationTracker&&) = delete;
+
+			static inline double ComputeAllocationRate(const AllocationStats& previous, const AllocationStats& current);
+			template<typename F> static void ForEach(F&& callback);
+			static inline AllocationTracker& GetDefault();
+
+		private:
+			struct Registry
+			{
+				std::mutex mutex;
+				AllocationTracker* head = nullptr;
+			};
+
+			static inline Registry& GetRegistry();
+
+			std::atomic<UInt64> m_allocatedBytes;
+			std::atomic<UInt64> m_allocationCount;
+			std::atomic<UInt64> m_deallocationCount;
+			std::atomic<std::size_t> m_liveBytes;
+			std::atomic<std::size_t> m_peakBytes;
+			std::string m_tag;
+			AllocationTracker* m_next;
+			AllocationTracker* m_previous;
+	};
+
+	template<typename T, typename Upstream = std::allocator<T>>
+	class TrackingAllocator
+	{
+		template<typename U, typename UpstreamU> friend class TrackingAllocator;
+
+		static_assert(std::is_same_v<typename std::allocator_traits<Upstream>::value_type, T>, "upstream allocator must allocate T");
+
+		public:
+			using value_type = T;
+			using upstream_type = Upstream;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+			using is_always_equal = std::false_type;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = TrackingAllocator<U, typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+			};
+
+			TrackingAllocator() noexcept(std::is_nothrow_default_constructible_v<Upstream>);
+			explicit TrackingAllocator(AllocationTracker& tracker, const Upstream& upstream = Upstream()) noexcept;
+			template<typename U, typename UpstreamU> TrackingAllocator(const TrackingAllocator<U, UpstreamU>& allocator) noexcept;
+
+			[[nodiscard]] T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			AllocationTracker& GetTracker() const noexcept;
+			const Upstream& GetUpstream() const noexcept;
+
+			template<typename U, typename UpstreamU> bool operator==(const TrackingAllocator<U, UpstreamU>& allocator) const noexcept;
+			template<typename U, typename UpstreamU> bool operator!=(const TrackingAllocator<U, UpstreamU>& allocator) const noexcept;
+
+		private:
+			AllocationTracker* m_tracker;
+			Upstream m_upstream;
+	};
+}
+
+#include <NazaraUtils/TrackingAllocator.inl>
+
+#endif // NAZARAUTILS_TRACKINGALLOCATOR_HPP
@@ -0,0 +1,227 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::AllocationTracker
+	* \brief Named set of heap counters (live bytes, peak, number of allocations) fed by TrackingAllocator
+	*
+	* Every tracker is registered in a global list (see ForEach) so allocation hot spots can be reported at runtime without a heap profiler.
+	* Counters are updated with relaxed atomics, a tracker can be shared by allocators used from multiple threads.
+	*
+	* \remark A tracker must outlive the memory allocated through it
+	*/
+
+	/*!
+	* \brief Constructs and registers a tracker
+	*
+	* \param tag Name of the tracker, used for reporting
+	*/
+	inline AllocationTracker::AllocationTracker(std::string tag) :
+	m_allocatedBytes(0),
+	m_allocationCount(0),
+	m_deallocationCount(0),
+	m_liveBytes(0),
+	m_peakBytes(0),
+	m_tag(std::move(tag)),
+	m_previous(nullptr)
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+
+		m_next = registry.head;
+		if (m_next)
+			m_next->m_previous = this;
+
+		registry.head = this;
+	}
+
+	inline AllocationTracker::~AllocationTracker()
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+
+		if (m_previous)
+			m_previous->m_next = m_next;
+		else
+			registry.head = m_next;
+
+		if (m_next)
+			m_next->m_previous = m_previous;
+	}
+
+	/*!
+	* \brief Returns a snapshot of the counters
+	*
+	* \remark Counters are read independently, a snapshot taken during allocations may be slightly inconsistent
+	*/
+	inline AllocationStats AllocationTracker::GetStats() const
+	{
+		AllocationStats stats;
+		stats.time = std::chrono::steady_clock::now();
+		stats.allocatedBytes = m_allocatedBytes.load(std::memory_order_relaxed);
+		stats.allocationCount = m_allocationCount.load(std::memory_order_relaxed);
+		stats.deallocationCount = m_deallocationCount.load(std::memory_order_relaxed);
+		stats.liveBytes = m_liveBytes.load(std::memory_order_relaxed);
+		stats.peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	inline const std::string& AllocationTracker::GetTag() const
+	{
+		return m_tag;
+	}
+
+	inline void AllocationTracker::RecordAllocation(std::size_t size)
+	{
+		m_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		std::size_t liveBytes = m_liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		std::size_t peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+		while (liveBytes > peakBytes && !m_peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed));
+	}
+
+	inline void AllocationTracker::RecordDeallocation(std::size_t size)
+	{
+		m_deallocationCount.fetch_add(1, std::memory_order_relaxed);
+		m_liveBytes.fetch_sub(size, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Resets the peak to the current live size, to measure the peak of a specific phase
+	*/
+	inline void AllocationTracker::ResetPeak()
+	{
+		m_peakBytes.store(m_liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Computes the number of allocations per second between two snapshots of the same tracker
+	* \return Allocations per second, or zero if both snapshots were taken at the same time
+	*
+	* \param previous Oldest snapshot
+	* \param current Newest snapshot
+	*/
+	inline double AllocationTracker::ComputeAllocationRate(const AllocationStats& previous, const AllocationStats& current)
+	{
+		double elapsedSeconds = std::chrono::duration<double>(current.time - previous.time).count();
+		if (elapsedSeconds <= 0.0)
+			return 0.0;
+
+		return double(current.allocationCount - previous.allocationCount) / elapsedSeconds;
+	}
+
+	/*!
+	* \brief Calls a function for every living tracker
+	*
+	* \param callback Function called with a const AllocationTracker&
+	*
+	* \remark Trackers cannot be created nor destroyed from the callback (the registry is locked)
+	*/
+	template<typename F>
+	void AllocationTracker::ForEach(F&& callback)
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+
+		for (const AllocationTracker* tracker = registry.head; tracker; tracker = tracker->m_next)
+			callback(*tracker);
+	}
+
+	/*!
+	* \brief Returns the tracker used by default-constructed tracking allocators
+	*/
+	inline AllocationTracker& AllocationTracker::GetDefault()
+	{
+		// Leaked on purpose: memory allocated by static containers may be freed after static destructors ran
+		static AllocationTracker* defaultTracker = new AllocationTracker("default");
+		return *defaultTracker;
+	}
+
+	inline auto AllocationTracker::GetRegistry() -> Registry&
+	{
+		static Registry* registry = new Registry;
+		return *registry;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::TrackingAllocator
+	* \brief Standard allocator forwarding to an upstream allocator while recording allocations in an AllocationTracker
+	*
+	* Can be used with standard containers and allocator-aware library types (Bitset, MemoryPool, SlotMap, ...), rebound allocators share the same tracker.
+	*
+	* \remark Default-constructed allocators use AllocationTracker::GetDefault()
+	*/
+
+	template<typename T, typename Upstream>
+	TrackingAllocator<T, Upstream>::TrackingAllocator() noexcept(std::is_nothrow_default_constructible_v<Upstream>) :
+	m_tracker(&AllocationTracker::GetDefault())
+	{
+	}
+
+	template<typename T, typename Upstream>
+	TrackingAllocator<T, Upstream>::TrackingAllocator(AllocationTracker& tracker, const Upstream& upstream) noexcept :
+	m_tracker(&tracker),
+	m_upstream(upstream)
+	{
+	}
+
+	template<typename T, typename Upstream>
+	template<typename U, typename UpstreamU>
+	TrackingAllocator<T, Upstream>::TrackingAllocator(const TrackingAllocator<U, UpstreamU>& allocator) noexcept :
+	m_tracker(allocator.m_tracker),
+	m_upstream(allocator.m_upstream)
+	{
+	}
+
+	template<typename T, typename Upstream>
+	T* TrackingAllocator<T, Upstream>::allocate(std::size_t count)
+	{
+		T* ptr = std::allocator_traits<Upstream>::allocate(m_upstream, count);
+		m_tracker->RecordAllocation(count * sizeof(T));
+
+		return ptr;
+	}
+
+	template<typename T, typename Upstream>
+	void TrackingAllocator<T, Upstream>::deallocate(T* ptr, std::size_t count) noexcept
+	{
+		m_tracker->RecordDeallocation(count * sizeof(T));
+		std::allocator_traits<Upstream>::deallocate(m_upstream, ptr, count);
+	}
+
+	template<typename T, typename Upstream>
+	AllocationTracker& TrackingAllocator<T, Upstream>::GetTracker() const noexcept
+	{
+		return *m_tracker;
+	}
+
+	template<typename T, typename Upstream>
+	const Upstream& TrackingAllocator<T, Upstream>::GetUpstream() const noexcept
+	{
+		return m_upstream;
+	}
+
+	template<typename T, typename Upstream>
+	template<typename U, typename UpstreamU>
+	bool TrackingAllocator<T, Upstream>::operator==(const TrackingAllocator<U, UpstreamU>& allocator) const noexcept
+	{
+		return m_tracker == allocator.m_tracker && m_upstream == allocator.m_upstream;
+	}
+
+	template<typename T, typename Upstream>
+	template<typename U, typename UpstreamU>
+	bool TrackingAllocator<T, Upstream>::operator!=(const TrackingAllocator<U, UpstreamU>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
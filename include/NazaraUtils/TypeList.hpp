@@ -7,6 +7,7 @@
 #ifndef NAZARAUTILS_TYPELIST_HPP
 #define NAZARAUTILS_TYPELIST_HPP
 
+#include <array>
 #include <cstddef>
 #include <limits>
 
@@ -40,6 +41,12 @@ namespace Nz
 		template<typename>
 		struct ListSize;
 
+		template<typename, template<typename, typename> typename>
+		struct ListSort;
+
+		template<typename, template<typename> typename>
+		struct ListStablePartition;
+
 		template<typename, template<typename...> typename>
 		struct ListTransform;
 
@@ -77,6 +84,15 @@ namespace Nz
 	template<typename List>
 	constexpr std::size_t TypeListSize = Detail::ListSize<List>::Size;
 
+	template<typename List, template<typename, typename> typename Compare>
+	using TypeListSort = typename Detail::ListSort<List, Compare>::Result;
+
+	template<typename List, template<typename, typename> typename Compare>
+	constexpr std::array<std::size_t, TypeListSize<List>> TypeListSortIndices = Detail::ListSort<List, Compare>::Indices;
+
+	template<typename List, template<typename> typename Predicate>
+	using TypeListStablePartition = typename Detail::ListStablePartition<List, Predicate>::Result;
+
 	template<typename List, template<typename> typename Transformer>
 	using TypeListTransform = typename Detail::ListTransform<List, Transformer>::Result;
 
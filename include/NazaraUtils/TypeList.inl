@@ -96,6 +96,77 @@ namespace Nz
 			static constexpr std::size_t Size = sizeof...(ListTypes);
 		};
 
+
+		// Stable insertion sort of the type indices, using a precomputed table of Compare results
+		template<template<typename, typename> typename Compare, typename... ListTypes>
+		struct ListSortHelper
+		{
+			static constexpr std::size_t Count = sizeof...(ListTypes);
+
+			template<std::size_t... Pairs>
+			static constexpr std::array<bool, Count * Count> BuildCompareTable(std::index_sequence<Pairs...>)
+			{
+				return { { Compare<TypeListAt<TypeList<ListTypes...>, Pairs / Count>, TypeListAt<TypeList<ListTypes...>, Pairs % Count>>::value... } };
+			}
+
+			static constexpr std::array<std::size_t, Count> SortIndices()
+			{
+				constexpr std::array<bool, Count * Count> compareTable = BuildCompareTable(std::make_index_sequence<Count * Count>());
+
+				std::array<std::size_t, Count> indices = {};
+				for (std::size_t i = 0; i < Count; ++i)
+				{
+					std::size_t j = i;
+					for (; j > 0 && compareTable[i * Count + indices[j - 1]]; --j)
+						indices[j] = indices[j - 1];
+
+					indices[j] = i;
+				}
+
+				return indices;
+			}
+		};
+
+		template<typename... ListTypes, template<typename, typename> typename Compare>
+		struct ListSort<TypeList<ListTypes...>, Compare>
+		{
+			static constexpr std::array<std::size_t, sizeof...(ListTypes)> Indices = ListSortHelper<Compare, ListTypes...>::SortIndices();
+
+			template<std::size_t... Is>
+			static auto BuildResult(std::index_sequence<Is...>) -> TypeList<TypeListAt<TypeList<ListTypes...>, Indices[Is]>...>;
+
+			using Result = decltype(BuildResult(std::make_index_sequence<sizeof...(ListTypes)>()));
+		};
+
+
+		template<typename Matching, typename Others, typename Rest, template<typename> typename Predicate>
+		struct ListStablePartitionHelper;
+
+		template<typename... Matching, typename... Others, typename T, typename... Rest, template<typename> typename Predicate>
+		struct ListStablePartitionHelper<TypeList<Matching...>, TypeList<Others...>, TypeList<T, Rest...>, Predicate>
+		{
+			static constexpr bool IsMatching = Predicate<T>::value;
+
+			using Result = typename ListStablePartitionHelper<
+				std::conditional_t<IsMatching, TypeList<Matching..., T>, TypeList<Matching...>>,
+				std::conditional_t<IsMatching, TypeList<Others...>, TypeList<Others..., T>>,
+				TypeList<Rest...>,
+				Predicate
+			>::Result;
+		};
+
+		template<typename... Matching, typename... Others, template<typename> typename Predicate>
+		struct ListStablePartitionHelper<TypeList<Matching...>, TypeList<Others...>, TypeList<>, Predicate>
+		{
+			using Result = TypeList<Matching..., Others...>;
+		};
+
+		template<typename... ListTypes, template<typename> typename Predicate>
+		struct ListStablePartition<TypeList<ListTypes...>, Predicate>
+		{
+			using Result = typename ListStablePartitionHelper<TypeList<>, TypeList<>, TypeList<ListTypes...>, Predicate>::Result;
+		};
+
 		template<typename L1, typename L2, template<typename> typename Transformer>
 		struct ListTransformHelper;
 
@@ -0,0 +1,84 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TYPEMAP_HPP
+#define NAZARAUTILS_TYPEMAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/TypeName.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Type identifiers are already hashes, only fold them to the size of std::size_t
+		struct TypeIdHash
+		{
+			std::size_t operator()(UInt64 typeId) const noexcept { return static_cast<std::size_t>(typeId ^ (typeId >> 32)); }
+		};
+	}
+
+	template<typename V>
+	class TypeMap
+	{
+		using Map = FlatHashMap<UInt64, V, Detail::TypeIdHash>;
+
+		public:
+			using const_iterator = typename Map::const_iterator;
+			using iterator = typename Map::iterator;
+
+			TypeMap() = default;
+			TypeMap(const TypeMap&) = default;
+			TypeMap(TypeMap&&) noexcept = default;
+			~TypeMap() = default;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			void Clear() noexcept;
+
+			template<typename T> bool Contains() const;
+			bool Contains(UInt64 typeId) const;
+
+			template<typename T, typename... Args> std::pair<V&, bool> Emplace(Args&&... args);
+			template<typename... Args> std::pair<V&, bool> Emplace(UInt64 typeId, Args&&... args);
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			template<typename T> bool Erase();
+			bool Erase(UInt64 typeId);
+
+			template<typename T> V* Find();
+			template<typename T> const V* Find() const;
+			V* Find(UInt64 typeId);
+			const V* Find(UInt64 typeId) const;
+
+			template<typename T> V& Get();
+			template<typename T> const V& Get() const;
+
+			std::size_t GetSize() const noexcept;
+
+			bool IsEmpty() const noexcept;
+
+			void Reserve(std::size_t count);
+
+			template<typename T, typename U> V& Set(U&& value);
+
+			TypeMap& operator=(const TypeMap&) = default;
+			TypeMap& operator=(TypeMap&&) noexcept = default;
+
+		private:
+			Map m_values;
+	};
+}
+
+#include <NazaraUtils/TypeMap.inl>
+
+#endif // NAZARAUTILS_TYPEMAP_HPP
@@ -0,0 +1,180 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::TypeMap
+	* \brief Associative container keyed by type, using TypeId<T>() as a key in a FlatHashMap
+	*
+	* Type identifiers are compile-time constants and are used as hashes, looking up a type is a single probe
+	* without any hashing, RTTI or string comparison involved.
+	*
+	* \remark Values are moved when the map grows, pointers and references to them are invalidated by insertions
+	*/
+
+	template<typename V>
+	auto TypeMap<V>::begin() noexcept -> iterator
+	{
+		return m_values.begin();
+	}
+
+	template<typename V>
+	auto TypeMap<V>::begin() const noexcept -> const_iterator
+	{
+		return m_values.begin();
+	}
+
+	template<typename V>
+	void TypeMap<V>::Clear() noexcept
+	{
+		m_values.clear();
+	}
+
+	template<typename V>
+	template<typename T>
+	bool TypeMap<V>::Contains() const
+	{
+		return Contains(TypeId<T>());
+	}
+
+	template<typename V>
+	bool TypeMap<V>::Contains(UInt64 typeId) const
+	{
+		return m_values.contains(typeId);
+	}
+
+	/*!
+	* \brief Constructs a value associated with T, if there's none yet
+	* \return Value associated with T and true if it was constructed, or the existing value and false
+	*
+	* \param args Arguments used to construct the value
+	*/
+	template<typename V>
+	template<typename T, typename... Args>
+	std::pair<V&, bool> TypeMap<V>::Emplace(Args&&... args)
+	{
+		return Emplace(TypeId<T>(), std::forward<Args>(args)...);
+	}
+
+	template<typename V>
+	template<typename... Args>
+	std::pair<V&, bool> TypeMap<V>::Emplace(UInt64 typeId, Args&&... args)
+	{
+		auto [it, inserted] = m_values.try_emplace(typeId, std::forward<Args>(args)...);
+		return { it->second, inserted };
+	}
+
+	template<typename V>
+	auto TypeMap<V>::end() noexcept -> iterator
+	{
+		return m_values.end();
+	}
+
+	template<typename V>
+	auto TypeMap<V>::end() const noexcept -> const_iterator
+	{
+		return m_values.end();
+	}
+
+	template<typename V>
+	template<typename T>
+	bool TypeMap<V>::Erase()
+	{
+		return Erase(TypeId<T>());
+	}
+
+	template<typename V>
+	bool TypeMap<V>::Erase(UInt64 typeId)
+	{
+		return m_values.erase(typeId) != 0;
+	}
+
+	/*!
+	* \brief Looks for the value associated with T
+	* \return Pointer to the value, or nullptr if T has no value
+	*/
+	template<typename V>
+	template<typename T>
+	V* TypeMap<V>::Find()
+	{
+		return Find(TypeId<T>());
+	}
+
+	template<typename V>
+	template<typename T>
+	const V* TypeMap<V>::Find() const
+	{
+		return Find(TypeId<T>());
+	}
+
+	template<typename V>
+	V* TypeMap<V>::Find(UInt64 typeId)
+	{
+		auto it = m_values.find(typeId);
+		return (it != m_values.end()) ? &it->second : nullptr;
+	}
+
+	template<typename V>
+	const V* TypeMap<V>::Find(UInt64 typeId) const
+	{
+		auto it = m_values.find(typeId);
+		return (it != m_values.end()) ? &it->second : nullptr;
+	}
+
+	/*!
+	* \brief Returns the value associated with T
+	*
+	* \remark T must have a value
+	*/
+	template<typename V>
+	template<typename T>
+	V& TypeMap<V>::Get()
+	{
+		V* value = Find<T>();
+		assert(value && "type has no value");
+		return *value;
+	}
+
+	template<typename V>
+	template<typename T>
+	const V& TypeMap<V>::Get() const
+	{
+		const V* value = Find<T>();
+		assert(value && "type has no value");
+		return *value;
+	}
+
+	template<typename V>
+	std::size_t TypeMap<V>::GetSize() const noexcept
+	{
+		return m_values.size();
+	}
+
+	template<typename V>
+	bool TypeMap<V>::IsEmpty() const noexcept
+	{
+		return m_values.empty();
+	}
+
+	template<typename V>
+	void TypeMap<V>::Reserve(std::size_t count)
+	{
+		m_values.reserve(count);
+	}
+
+	/*!
+	* \brief Associates a value with T, replacing the existing one
+	* \return Value associated with T
+	*/
+	template<typename V>
+	template<typename T, typename U>
+	V& TypeMap<V>::Set(U&& value)
+	{
+		return m_values.insert_or_assign(TypeId<T>(), std::forward<U>(value)).first->second;
+	}
+}
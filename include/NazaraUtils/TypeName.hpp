@@ -8,10 +8,12 @@
 #define NAZARAUTILS_TYPENAME_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Hash.hpp>
 #include <string_view>
 
 namespace Nz
 {
+	template<typename T> constexpr UInt64 TypeId();
 	template<typename T> constexpr std::string_view TypeName();
 }
 
@@ -4,6 +4,23 @@
 
 namespace Nz
 {
+	/*!
+	* \ingroup utils
+	* \brief Returns a 64-bit identifier of a type, computed at compile-time
+	* \return FNV1a64 hash of TypeName<T>()
+	*
+	* Unlike std::type_index, this doesn't require RTTI and gives the same value in every module (executable or shared library)
+	* built by the same compiler, which makes it suitable to key maps by type (see TypeMap).
+	*
+	* \remark Type names (and thus identifiers) differ between compilers
+	*/
+	template<typename T>
+	constexpr UInt64 TypeId()
+	{
+		constexpr UInt64 typeId = FNV1a64(TypeName<T>());
+		return typeId;
+	}
+
 	template<typename T>
 	constexpr std::string_view TypeName()
 	{
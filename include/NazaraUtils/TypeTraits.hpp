@@ -94,6 +94,14 @@ namespace Nz
 
 	/************************************************************************/
 
+	// Types which can be moved to another address with a memcpy (without calling their move constructor and destructor), specialize it for your own types
+	template<typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	template<typename T> constexpr bool IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
+
+	/************************************************************************/
+
 	template<typename T>
 	using Pointer = T*;
 }
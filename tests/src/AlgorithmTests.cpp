@@ -1,11 +1,49 @@
 #include <NazaraUtils/Algorithm.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <random>
+#include <vector>
 
 struct A {};
 struct B : A {};
 
+namespace
+{
+	enum class SortLayer : Nz::Int16
+	{
+		Background = -5,
+		Opaque = 0,
+		Transparent = 3,
+		Overlay = 100
+	};
+
+	struct DrawCall
+	{
+		Nz::UInt64 sortKey;
+		Nz::UInt32 id;
+	};
+
+	template<typename K, typename Gen>
+	void CheckRadixSort(std::size_t count, Gen&& generator)
+	{
+		std::vector<K> keys(count);
+		for (K& key : keys)
+			key = generator();
+
+		std::vector<K> expected = keys;
+		std::sort(expected.begin(), expected.end());
+
+		auto scratch = NazaraStackArrayNoInit(K, count);
+		Nz::RadixSort(keys.data(), count, scratch.data());
+
+		CHECK(keys == expected);
+	}
+}
+
 SCENARIO("Algorithm", "[Algorithm]")
 {
 	WHEN("Testing IntegerToPointer and PointerToInteger")
@@ -57,4 +95,76 @@ SCENARIO("Algorithm", "[Algorithm]")
 		CHECK(Nz::SafeCast<B*>(nullptr) == nullptr);
 
 	}
+
+	WHEN("Testing RadixSort")
+	{
+		std::mt19937_64 rand(42);
+
+		for (std::size_t count : { 0, 1, 2, 5, 15, 16, 17, 100, 5000 })
+		{
+			CheckRadixSort<Nz::UInt8>(count, [&] { return Nz::UInt8(rand()); });
+			CheckRadixSort<Nz::UInt16>(count, [&] { return Nz::UInt16(rand()); });
+			CheckRadixSort<Nz::UInt32>(count, [&] { return Nz::UInt32(rand()); });
+			CheckRadixSort<Nz::UInt64>(count, [&] { return Nz::UInt64(rand()); });
+			CheckRadixSort<Nz::Int32>(count, [&] { return Nz::Int32(rand()); });
+			CheckRadixSort<Nz::Int64>(count, [&] { return Nz::Int64(rand()); });
+			CheckRadixSort<Nz::UInt32>(count, [&] { return Nz::UInt32(rand() % 4) << 20; }); //< skipped passes
+			CheckRadixSort<float>(count, [&] { return std::uniform_real_distribution<float>(-1000.f, 1000.f)(rand); });
+			CheckRadixSort<double>(count, [&] { return std::uniform_real_distribution<double>(-1e10, 1e10)(rand); });
+			CheckRadixSort<SortLayer>(count, [&] { constexpr SortLayer layers[] = { SortLayer::Background, SortLayer::Opaque, SortLayer::Transparent, SortLayer::Overlay }; return layers[rand() % 4]; });
+		}
+
+		// Special floating-point values
+		std::vector<float> floats = { 0.f, -std::numeric_limits<float>::infinity(), -1.f, std::numeric_limits<float>::infinity(), -0.f, std::numeric_limits<float>::denorm_min(), -std::numeric_limits<float>::max() };
+		for (int i = 0; i < 30; ++i)
+			floats.push_back(float(i) - 15.f);
+
+		std::vector<float> scratch(floats.size());
+		Nz::RadixSort(floats.data(), floats.size(), scratch.data());
+		CHECK(std::is_sorted(floats.begin(), floats.end()));
+		CHECK(floats.front() == -std::numeric_limits<float>::infinity());
+		CHECK(floats.back() == std::numeric_limits<float>::infinity());
+
+		for (std::size_t count : { 10, 1000 })
+		{
+			// Keys and values, checking stability
+			std::vector<Nz::UInt16> keys(count);
+			std::vector<Nz::UInt32> values(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				keys[i] = Nz::UInt16(rand() % 8);
+				values[i] = Nz::UInt32(i);
+			}
+
+			std::vector<Nz::UInt16> originalKeys = keys;
+
+			auto scratchKeys = NazaraStackArrayNoInit(Nz::UInt16, count);
+			auto scratchValues = NazaraStackArrayNoInit(Nz::UInt32, count);
+			Nz::RadixSort(keys.data(), values.data(), count, scratchKeys.data(), scratchValues.data());
+
+			bool valid = true;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (originalKeys[values[i]] != keys[i])
+					valid = false;
+
+				if (i > 0 && (keys[i - 1] > keys[i] || (keys[i - 1] == keys[i] && values[i - 1] >= values[i])))
+					valid = false;
+			}
+			CHECK(valid);
+
+			// Key extraction
+			std::vector<DrawCall> drawCalls(count);
+			for (std::size_t i = 0; i < count; ++i)
+				drawCalls[i] = DrawCall{ rand() % 16, Nz::UInt32(i) };
+
+			std::vector<DrawCall> expected = drawCalls;
+			std::stable_sort(expected.begin(), expected.end(), [](const DrawCall& lhs, const DrawCall& rhs) { return lhs.sortKey < rhs.sortKey; });
+
+			auto scratchDrawCalls = NazaraArenaStackArrayNoInit(DrawCall, count);
+			Nz::RadixSort(drawCalls.data(), count, scratchDrawCalls.data(), [](const DrawCall& drawCall) { return drawCall.sortKey; });
+
+			CHECK(std::equal(drawCalls.begin(), drawCalls.end(), expected.begin(), [](const DrawCall& lhs, const DrawCall& rhs) { return lhs.sortKey == rhs.sortKey && lhs.id == rhs.id; }));
+		}
+	}
 }
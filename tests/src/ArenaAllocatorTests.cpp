@@ -0,0 +1,150 @@
+#include <NazaraUtils/ArenaAllocator.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <NazaraUtils/StackVector.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+SCENARIO("ArenaAllocator", "[CORE][ARENAALLOCATOR]")
+{
+	GIVEN("An arena")
+	{
+		Nz::ArenaAllocator arena(1024);
+		CHECK(arena.GetAllocatedSize() == 0);
+
+		WHEN("We allocate memory")
+		{
+			void* a = arena.Allocate(100);
+			void* b = arena.Allocate(3, 1);
+			void* c = arena.Allocate(8, 64);
+
+			CHECK(arena.GetAllocatedSize() == 1024);
+			CHECK(arena.GetLiveAllocationCount() == 3);
+			CHECK(reinterpret_cast<std::uintptr_t>(a) % alignof(std::max_align_t) == 0);
+			CHECK(reinterpret_cast<std::uintptr_t>(c) % 64 == 0);
+			CHECK(static_cast<Nz::UInt8*>(b) >= static_cast<Nz::UInt8*>(a) + 100);
+
+			THEN("Deallocating the last allocation gives its memory back")
+			{
+				arena.Deallocate(c, 8);
+				void* d = arena.Allocate(8, 1);
+				CHECK(d == c);
+			}
+
+			THEN("Deallocating every allocation rewinds the arena")
+			{
+				arena.Deallocate(a, 100);
+				arena.Deallocate(c, 8);
+				arena.Deallocate(b, 3);
+				CHECK(arena.GetLiveAllocationCount() == 0);
+				CHECK(arena.Allocate(100) == a);
+			}
+		}
+
+		WHEN("We allocate more than a chunk")
+		{
+			std::vector<Nz::UInt8*> allocations;
+			for (std::size_t i = 0; i < 100; ++i)
+			{
+				Nz::UInt8* ptr = arena.Allocate<Nz::UInt8>(100);
+				std::iota(ptr, ptr + 100, Nz::UInt8(i));
+				allocations.push_back(ptr);
+			}
+
+			THEN("Allocations don't overlap")
+			{
+				bool valid = true;
+				for (std::size_t i = 0; i < allocations.size(); ++i)
+				{
+					for (std::size_t j = 0; j < 100; ++j)
+					{
+						if (allocations[i][j] != Nz::UInt8(i + j))
+							valid = false;
+					}
+				}
+				CHECK(valid);
+				CHECK(arena.GetAllocatedSize() >= 100 * 100);
+			}
+
+			THEN("A chunk bigger than the default one is allocated for big allocations")
+			{
+				void* ptr = arena.Allocate(1024 * 1024);
+				CHECK(ptr);
+				CHECK(arena.GetAllocatedSize() >= 1024 * 1024);
+			}
+
+			THEN("Releasing the arena frees everything")
+			{
+				arena.Release();
+				CHECK(arena.GetAllocatedSize() == 0);
+				CHECK(arena.GetLiveAllocationCount() == 0);
+			}
+		}
+
+		WHEN("We rewind it to a marker")
+		{
+			arena.Allocate(10);
+			Nz::ArenaAllocator::Marker marker = arena.Mark();
+			void* a = arena.Allocate(10);
+			for (std::size_t i = 0; i < 100; ++i)
+				arena.Allocate(100);
+
+			std::size_t allocatedSize = arena.GetAllocatedSize();
+
+			arena.Rewind(marker);
+			CHECK(arena.GetLiveAllocationCount() == 1);
+			CHECK(arena.Allocate(10) == a);
+
+			// chunks are kept and reused
+			for (std::size_t i = 0; i < 100; ++i)
+				arena.Allocate(100);
+
+			CHECK(arena.GetAllocatedSize() == allocatedSize);
+		}
+	}
+
+	GIVEN("Stack containers using the thread-local arena")
+	{
+		Nz::ArenaAllocator& arena = Nz::ArenaAllocator::GetThreadLocal();
+		std::size_t liveAllocationCount = arena.GetLiveAllocationCount();
+
+		{
+			Nz::StackArray<int> array = NazaraArenaStackArray(int, 100);
+			std::iota(array.begin(), array.end(), 0);
+			CHECK(array.size() == 100);
+			CHECK(array[99] == 99);
+
+			Nz::StackVector<int> vector = NazaraArenaStackVector(int, 50);
+			vector.push_back(42);
+			CHECK(vector.capacity() == 50);
+			CHECK(vector.front() == 42);
+
+			Nz::StackArray<int> movedArray = std::move(array);
+			CHECK(movedArray[42] == 42);
+
+			CHECK(arena.GetLiveAllocationCount() == liveAllocationCount + 2);
+		}
+
+		CHECK(arena.GetLiveAllocationCount() == liveAllocationCount);
+	}
+
+	GIVEN("A Bitset allocating from an arena")
+	{
+		Nz::ArenaAllocator arena;
+
+		Nz::Bitset<Nz::UInt64, Nz::ArenaStlAllocator<Nz::UInt64>> bitset{ Nz::ArenaStlAllocator<Nz::UInt64>(arena) };
+		bitset.Resize(10'000, false);
+		bitset.Set(42, true);
+		bitset.Set(9'999, true);
+
+		CHECK(bitset.Count() == 2);
+		CHECK(arena.GetLiveAllocationCount() > 0);
+
+		std::vector<int, Nz::ArenaStlAllocator<int>> vec;
+		vec.resize(100, 1);
+		CHECK(std::accumulate(vec.begin(), vec.end(), 0) == 100);
+		CHECK(vec.get_allocator() == Nz::ArenaStlAllocator<int>(Nz::ArenaAllocator::GetThreadLocal()));
+	}
+}
@@ -0,0 +1,131 @@
+#include <NazaraUtils/AtomicBitset.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("AtomicBitset", "[CORE][ATOMICBITSET]")
+{
+	GIVEN("An AtomicBitset of 100 bits")
+	{
+		Nz::AtomicBitset<Nz::UInt32> bitset(100);
+		CHECK(bitset.GetSize() == 100);
+		CHECK(bitset.GetBlockCount() == 4);
+		CHECK(bitset.Count() == 0);
+		CHECK(bitset.FindFirst() == bitset.npos);
+
+		WHEN("We set and reset bits")
+		{
+			CHECK_FALSE(bitset.TestAndSet(3));
+			CHECK(bitset.TestAndSet(3));
+			bitset.Set(64);
+			bitset.Set(99);
+
+			CHECK(bitset.Test(3));
+			CHECK(bitset.Count() == 3);
+			CHECK(bitset.FindFirst() == 3);
+			CHECK(bitset.FindNext(3) == 64);
+			CHECK(bitset.FindNext(64) == 99);
+			CHECK(bitset.FindNext(99) == bitset.npos);
+
+			CHECK(bitset.TestAndReset(64));
+			CHECK_FALSE(bitset.TestAndReset(64));
+			bitset.Reset(99);
+			CHECK(bitset.Count() == 1);
+
+			Nz::Bitset<Nz::UInt32> copy = bitset.ToBitset();
+			CHECK(copy.GetSize() == 100);
+			CHECK(copy.ToString() == std::string(96, '0') + "1000");
+
+			bitset.Reset();
+			CHECK(bitset.Count() == 0);
+		}
+
+		WHEN("We use block operations")
+		{
+			CHECK(bitset.FetchOr(1, 0xF0) == 0);
+			CHECK(bitset.FetchOr(3, 0xFFFFFFFF) == 0);
+			CHECK(bitset.GetBlock(3) == 0xF); //< Bits past the end are ignored
+			CHECK(bitset.FetchAnd(1, 0x30) == 0xF0);
+			CHECK(bitset.GetBlock(1) == 0x30);
+			CHECK(bitset.ExchangeBlock(1, 0) == 0x30);
+			CHECK(bitset.Count() == 4);
+		}
+
+		WHEN("We claim bits")
+		{
+			bitset.Set(0);
+			bitset.Set(1);
+			CHECK(bitset.ClaimFirstClear() == 2);
+			CHECK(bitset.ClaimFirstClear() == 3);
+			CHECK(bitset.ClaimFirstClear(50) == 50);
+			CHECK(bitset.ClaimFirstClear(98) == 98);
+			CHECK(bitset.ClaimFirstClear(98) == 99);
+			CHECK(bitset.ClaimFirstClear(98) == bitset.npos);
+
+			while (bitset.ClaimFirstClear() != bitset.npos);
+			CHECK(bitset.Count() == 100);
+		}
+
+		WHEN("We move it")
+		{
+			bitset.Set(42);
+			Nz::AtomicBitset<Nz::UInt32> other(std::move(bitset));
+			CHECK(other.GetSize() == 100);
+			CHECK(other.Test(42));
+
+			bitset = std::move(other);
+			CHECK(bitset.FindFirst() == 42);
+		}
+	}
+
+	GIVEN("A full AtomicBitset")
+	{
+		Nz::AtomicBitset<Nz::UInt8> bitset(13, true);
+		CHECK(bitset.Count() == 13);
+		CHECK(bitset.GetBlock(1) == 0x1F);
+		CHECK(bitset.ClaimFirstClear() == bitset.npos);
+	}
+
+	GIVEN("Multiple threads claiming bits")
+	{
+		constexpr std::size_t BitCount = 10'000;
+		constexpr std::size_t ThreadCount = 4;
+
+		Nz::AtomicBitset<Nz::UInt64> bitset(BitCount);
+
+		std::vector<std::vector<std::size_t>> claimedBits(ThreadCount);
+		std::atomic_bool start = false;
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < ThreadCount; ++i)
+		{
+			threads.emplace_back([&, i]
+			{
+				while (!start)
+					std::this_thread::yield();
+
+				std::size_t bit;
+				while ((bit = bitset.ClaimFirstClear()) != bitset.npos)
+					claimedBits[i].push_back(bit);
+			});
+		}
+
+		start = true;
+		for (std::thread& thread : threads)
+			thread.join();
+
+		THEN("Each bit has been claimed exactly once")
+		{
+			std::vector<std::size_t> allBits;
+			for (const auto& bits : claimedBits)
+				allBits.insert(allBits.end(), bits.begin(), bits.end());
+
+			std::sort(allBits.begin(), allBits.end());
+			CHECK(allBits.size() == BitCount);
+			CHECK(std::adjacent_find(allBits.begin(), allBits.end()) == allBits.end());
+			CHECK(bitset.Count() == BitCount);
+		}
+	}
+}
@@ -0,0 +1,142 @@
+#include <NazaraUtils/BitKernels.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+SCENARIO("BitKernels", "[CORE][BITKERNELS]")
+{
+	GIVEN("Random byte ranges")
+	{
+		std::minstd_rand gen(1337);
+		std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+		// Extra bytes allow us to test unaligned ranges
+		constexpr std::size_t MaxSize = 1031;
+		std::vector<Nz::UInt8> a(MaxSize + 1);
+		std::vector<Nz::UInt8> b(MaxSize + 1);
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			a[i] = static_cast<Nz::UInt8>(dis(gen));
+			b[i] = static_cast<Nz::UInt8>(dis(gen));
+		}
+
+		WHEN("Dispatched kernels are compared against the scalar ones")
+		{
+			INFO("Backend: " << static_cast<int>(Nz::BitKernels::GetBackend()));
+
+			bool matches = true;
+			for (std::size_t offset : { 0, 1 })
+			{
+				for (std::size_t size : { 0, 1, 7, 31, 63, 64, 65, 127, 128, 200, 511, 1024, 1030 })
+				{
+					const Nz::UInt8* aPtr = a.data() + offset;
+					const Nz::UInt8* bPtr = b.data() + offset;
+
+					std::vector<Nz::UInt8> expected(size);
+					std::vector<Nz::UInt8> result(size);
+
+					Nz::BitKernels::Scalar::And(expected.data(), aPtr, bPtr, size);
+					Nz::BitKernels::And(result.data(), aPtr, bPtr, size);
+					matches = matches && (result == expected);
+
+					Nz::BitKernels::Scalar::Or(expected.data(), aPtr, bPtr, size);
+					Nz::BitKernels::Or(result.data(), aPtr, bPtr, size);
+					matches = matches && (result == expected);
+
+					Nz::BitKernels::Scalar::Xor(expected.data(), aPtr, bPtr, size);
+					Nz::BitKernels::Xor(result.data(), aPtr, bPtr, size);
+					matches = matches && (result == expected);
+
+					Nz::BitKernels::Scalar::Not(expected.data(), aPtr, size);
+					Nz::BitKernels::Not(result.data(), aPtr, size);
+					matches = matches && (result == expected);
+
+					Nz::BitKernels::Scalar::AndNot(expected.data(), aPtr, bPtr, size);
+					Nz::BitKernels::AndNot(result.data(), aPtr, bPtr, size);
+					matches = matches && (result == expected);
+
+					matches = matches && (Nz::BitKernels::Count(aPtr, size) == Nz::BitKernels::Scalar::Count(aPtr, size));
+					matches = matches && (Nz::BitKernels::CountAnd(aPtr, bPtr, size) == Nz::BitKernels::Scalar::CountAnd(aPtr, bPtr, size));
+					matches = matches && (Nz::BitKernels::CountAndNot(aPtr, bPtr, size) == Nz::BitKernels::Scalar::CountAndNot(aPtr, bPtr, size));
+					matches = matches && (Nz::BitKernels::Intersects(aPtr, bPtr, size) == Nz::BitKernels::Scalar::Intersects(aPtr, bPtr, size));
+					matches = matches && (Nz::BitKernels::IntersectsAndNot(aPtr, bPtr, size) == Nz::BitKernels::Scalar::IntersectsAndNot(aPtr, bPtr, size));
+					matches = matches && (Nz::BitKernels::FindFirstNonZero(aPtr, size) == Nz::BitKernels::Scalar::FindFirstNonZero(aPtr, size));
+
+					for (std::size_t elementSize : { 1, 2, 4, 8 })
+					{
+						std::size_t byteCount = size - size % elementSize;
+						Nz::BitKernels::Scalar::ReverseBits(expected.data(), aPtr, byteCount, elementSize);
+						Nz::BitKernels::ReverseBits(result.data(), aPtr, byteCount, elementSize);
+						matches = matches && (result == expected);
+					}
+				}
+			}
+
+			CHECK(matches);
+		}
+
+		WHEN("We count bits")
+		{
+			std::vector<Nz::UInt8> ones(MaxSize, 0xFF);
+			CHECK(Nz::BitKernels::Count(ones.data(), ones.size()) == MaxSize * 8);
+			CHECK(Nz::BitKernels::Scalar::Count(ones.data(), ones.size()) == MaxSize * 8);
+
+			ones[MaxSize / 2] = 0x0F;
+			CHECK(Nz::BitKernels::Count(ones.data(), ones.size()) == MaxSize * 8 - 4);
+		}
+
+		WHEN("We search for the first non-zero byte")
+		{
+			std::vector<Nz::UInt8> zeroes(MaxSize, 0);
+			CHECK(Nz::BitKernels::FindFirstNonZero(zeroes.data(), zeroes.size()) == MaxSize);
+
+			bool matches = true;
+			for (std::size_t pos : { 0, 5, 31, 32, 63, 64, 100, 700, 1030 })
+			{
+				zeroes[pos] = 0x10;
+				matches = matches && (Nz::BitKernels::FindFirstNonZero(zeroes.data(), zeroes.size()) == pos);
+				matches = matches && (Nz::BitKernels::Scalar::FindFirstNonZero(zeroes.data(), zeroes.size()) == pos);
+				zeroes[pos] = 0;
+			}
+
+			CHECK(matches);
+		}
+
+		WHEN("We reverse bits")
+		{
+			std::vector<Nz::UInt8> bytes(MaxSize - 7, 0x01);
+			Nz::BitKernels::ReverseBits(bytes.data(), bytes.data(), bytes.size(), 8);
+			CHECK(std::all_of(bytes.begin(), bytes.end(), [](Nz::UInt8 byte) { return byte == 0x80; }));
+		}
+
+		WHEN("We check for intersections")
+		{
+			std::vector<Nz::UInt8> lhs(MaxSize, 0xAA);
+			std::vector<Nz::UInt8> rhs(MaxSize, 0x55);
+			CHECK_FALSE(Nz::BitKernels::Intersects(lhs.data(), rhs.data(), MaxSize));
+
+			rhs[MaxSize - 1] = 0x80;
+			CHECK(Nz::BitKernels::Intersects(lhs.data(), rhs.data(), MaxSize));
+			CHECK_FALSE(Nz::BitKernels::Intersects(lhs.data(), rhs.data(), MaxSize - 1));
+
+			CHECK_FALSE(Nz::BitKernels::IntersectsAndNot(lhs.data(), lhs.data(), MaxSize));
+			CHECK(Nz::BitKernels::IntersectsAndNot(lhs.data(), rhs.data(), MaxSize));
+			CHECK(Nz::BitKernels::CountAndNot(lhs.data(), lhs.data(), MaxSize) == 0);
+			CHECK(Nz::BitKernels::CountAnd(lhs.data(), rhs.data(), MaxSize) == 1);
+		}
+
+		WHEN("We operate in place")
+		{
+			std::vector<Nz::UInt8> expected(MaxSize);
+			Nz::BitKernels::Scalar::Xor(expected.data(), a.data(), b.data(), MaxSize);
+
+			Nz::BitKernels::Xor(a.data(), a.data(), b.data(), MaxSize);
+			CHECK(std::equal(expected.begin(), expected.end(), a.begin()));
+
+			Nz::BitKernels::Not(a.data(), a.data(), MaxSize);
+			Nz::BitKernels::Not(a.data(), a.data(), MaxSize);
+			CHECK(std::equal(expected.begin(), expected.end(), a.begin()));
+		}
+	}
+}
@@ -0,0 +1,148 @@
+#include <NazaraUtils/BitPacking.hpp>
+#include <NazaraUtils/Random.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+SCENARIO("BitPacking", "[CORE][BITPACKING]")
+{
+	Nz::UInt64 randomState = 42;
+	auto GenerateValues = [&](std::size_t count, Nz::UInt32 bitWidth)
+	{
+		Nz::UInt32 mask = (bitWidth < 32) ? (Nz::UInt32(1) << bitWidth) - 1 : ~Nz::UInt32(0);
+
+		std::vector<Nz::UInt32> values(count);
+		for (Nz::UInt32& value : values)
+			value = static_cast<Nz::UInt32>(Nz::SplitMix64(randomState)) & mask;
+
+		return values;
+	};
+
+	WHEN("Packing values with every bit width")
+	{
+		for (Nz::UInt32 bitWidth = 0; bitWidth <= 32; ++bitWidth)
+		{
+			for (std::size_t count : { 0, 1, 7, 128, 256, 300 })
+			{
+				std::vector<Nz::UInt32> values = GenerateValues(count, bitWidth);
+				CHECK(Nz::ComputeBitWidth(values.data(), values.size()) <= bitWidth);
+
+				std::vector<Nz::UInt8> packed(Nz::GetBitPackedSize(count, bitWidth));
+				CHECK(Nz::BitPack(values.data(), count, bitWidth, packed.data()) == packed.size());
+
+				std::vector<Nz::UInt32> unpacked(count, 0xDEADBEEF);
+				Nz::BitUnpack(packed.data(), count, bitWidth, unpacked.data());
+				CHECK(unpacked == values);
+			}
+		}
+	}
+
+	WHEN("Comparing the layout with the scalar implementation")
+	{
+		for (Nz::UInt32 bitWidth = 0; bitWidth <= 32; ++bitWidth)
+		{
+			std::vector<Nz::UInt32> values = GenerateValues(Nz::BitPackBlockSize, bitWidth);
+
+			std::vector<Nz::UInt8> packed(Nz::GetBitPackedSize(values.size(), bitWidth));
+			Nz::BitPack(values.data(), values.size(), bitWidth, packed.data());
+
+			std::vector<Nz::UInt8> scalarPacked(packed.size());
+			Nz::Detail::ScalarPackBlock(values.data(), scalarPacked.data(), bitWidth);
+			CHECK(packed == scalarPacked);
+
+			std::vector<Nz::UInt32> unpacked(values.size());
+			Nz::Detail::ScalarUnpackBlock(packed.data(), unpacked.data(), bitWidth);
+			CHECK(unpacked == values);
+		}
+
+		// Value i is stored in lane i % 4
+		std::vector<Nz::UInt32> values(Nz::BitPackBlockSize, 0);
+		values[1] = 1;
+		values[6] = 1;
+
+		std::vector<Nz::UInt8> packed(Nz::GetBitPackedSize(values.size(), 1));
+		Nz::BitPack(values.data(), values.size(), 1, packed.data());
+		CHECK(packed[4] == 0x01); //< lane 1, bit 0
+		CHECK(packed[8] == 0x02); //< lane 2, bit 1
+	}
+
+	WHEN("Packing values wider than the bit width")
+	{
+		std::vector<Nz::UInt32> values(200, 0xFFFFFFFF);
+
+		std::vector<Nz::UInt8> packed(Nz::GetBitPackedSize(values.size(), 5));
+		Nz::BitPack(values.data(), values.size(), 5, packed.data());
+
+		std::vector<Nz::UInt32> unpacked(values.size());
+		Nz::BitUnpack(packed.data(), unpacked.size(), 5, unpacked.data());
+		CHECK(unpacked == std::vector<Nz::UInt32>(values.size(), 0x1F));
+	}
+
+	WHEN("Encoding values with a transform")
+	{
+		auto CheckRoundTrip = [](const std::vector<Nz::UInt32>& values, Nz::BitPackTransform transform)
+		{
+			std::vector<Nz::UInt8> buffer(Nz::GetMaxEncodedBitPackedSize(values.size()));
+			Nz::ByteWriter writer(buffer.data(), buffer.size());
+			REQUIRE(Nz::EncodeBitPacked(writer, values.data(), values.size(), transform).IsOk());
+
+			std::vector<Nz::UInt32> decoded(values.size());
+			Nz::ByteReader reader(buffer.data(), writer.GetCursor());
+			REQUIRE(Nz::DecodeBitPacked(reader, decoded.data(), decoded.size(), transform).IsOk());
+			CHECK(reader.IsAtEnd());
+			CHECK(decoded == values);
+
+			return writer.GetCursor();
+		};
+
+		std::vector<Nz::UInt32> sortedValues(1000);
+		for (std::size_t i = 0; i < sortedValues.size(); ++i)
+			sortedValues[i] = Nz::UInt32(1'000'000 + i * 3 + (i % 2));
+
+		std::vector<Nz::UInt32> signedValues(1000);
+		for (std::size_t i = 0; i < signedValues.size(); ++i)
+			signedValues[i] = static_cast<Nz::UInt32>(static_cast<Nz::Int32>(i % 7) - 3);
+
+		std::vector<Nz::UInt32> randomValues = GenerateValues(1000, 32);
+
+		for (const auto* values : { &sortedValues, &signedValues, &randomValues })
+		{
+			for (Nz::BitPackTransform transform : { Nz::BitPackTransform::None, Nz::BitPackTransform::Delta, Nz::BitPackTransform::ZigZag, Nz::BitPackTransform::ZigZagDelta })
+				CheckRoundTrip(*values, transform);
+		}
+
+		// 7 blocks and 104 remaining values, the first delta is against zero (making the first block 20 bits wide, or 21 bits when zigzag-encoded),
+		// the others are 2 or 4 and take 3 bits (or 4 bits when zigzag-encoded)
+		CHECK(CheckRoundTrip(sortedValues, Nz::BitPackTransform::Delta) == (1 + 16 * 20) + 6 * (1 + 16 * 3) + 1 + (104 * 3 + 7) / 8);
+		CHECK(CheckRoundTrip(sortedValues, Nz::BitPackTransform::ZigZagDelta) == (1 + 16 * 21) + 6 * (1 + 16 * 4) + 1 + (104 * 4 + 7) / 8);
+		CHECK(CheckRoundTrip(signedValues, Nz::BitPackTransform::ZigZag) == 7 * (1 + 16 * 3) + 1 + (104 * 3 + 7) / 8);
+		CHECK(CheckRoundTrip(signedValues, Nz::BitPackTransform::None) == 7 * (1 + 16 * 32) + 1 + 104 * 4);
+		CHECK(CheckRoundTrip(randomValues, Nz::BitPackTransform::None) <= Nz::GetMaxEncodedBitPackedSize(randomValues.size()));
+	}
+
+	WHEN("Decoding truncated or corrupted data")
+	{
+		std::vector<Nz::UInt32> values = GenerateValues(300, 10);
+
+		std::vector<Nz::UInt8> buffer(Nz::GetMaxEncodedBitPackedSize(values.size()));
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+		REQUIRE(Nz::EncodeBitPacked(writer, values.data(), values.size()).IsOk());
+
+		std::vector<Nz::UInt32> decoded(values.size());
+
+		Nz::ByteReader truncatedReader(buffer.data(), writer.GetCursor() - 1);
+		auto truncatedResult = Nz::DecodeBitPacked(truncatedReader, decoded.data(), decoded.size());
+		REQUIRE(truncatedResult.IsErr());
+		CHECK(truncatedResult.GetError() == Nz::ByteStreamError::EndOfBuffer);
+
+		buffer[0] = 33; //< bit width of the first block
+		Nz::ByteReader corruptedReader(buffer.data(), writer.GetCursor());
+		auto corruptedResult = Nz::DecodeBitPacked(corruptedReader, decoded.data(), decoded.size());
+		REQUIRE(corruptedResult.IsErr());
+		CHECK(corruptedResult.GetError() == Nz::ByteStreamError::InvalidData);
+
+		Nz::ByteWriter smallWriter(buffer.data(), 100);
+		auto writeResult = Nz::EncodeBitPacked(smallWriter, values.data(), values.size());
+		REQUIRE(writeResult.IsErr());
+		CHECK(writeResult.GetError() == Nz::ByteStreamError::EndOfBuffer);
+	}
+}
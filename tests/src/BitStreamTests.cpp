@@ -0,0 +1,119 @@
+#include <NazaraUtils/BitStream.hpp>
+#include <NazaraUtils/Random.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <vector>
+
+SCENARIO("BitStream", "[CORE][BITSTREAM]")
+{
+	enum class Opcode : Nz::UInt8
+	{
+		Move = 3,
+		Shoot = 5
+	};
+
+	WHEN("Writing fields of various sizes")
+	{
+		std::array<Nz::UInt8, 32> buffer;
+		buffer.fill(0xCD);
+
+		Nz::BitWriter writer(buffer.data(), buffer.size());
+		CHECK(writer.Write(Nz::UInt8(5), 3).IsOk());
+		CHECK(writer.Write(Nz::UInt8(0x55), 7).IsOk());
+		CHECK(writer.Write(Nz::UInt16(0x7FF), 11).IsOk());
+		CHECK(writer.Write(true, 1).IsOk());
+		CHECK(writer.Write(Nz::Int32(-3), 4).IsOk());
+		CHECK(writer.Write(Opcode::Shoot, 3).IsOk());
+		CHECK(writer.Write(Nz::UInt64(0x0123456789ABCDEFull), 64).IsOk());
+		CHECK(writer.Write(Nz::UInt32(0xFFFFFFFF), 0).IsOk());
+		CHECK(writer.GetBitCursor() == 3 + 7 + 11 + 1 + 4 + 3 + 64);
+
+		writer.AlignToByte();
+		CHECK(writer.GetBitCursor() == 96);
+		CHECK(writer.Write(Nz::UInt8(0xAB), 8).IsOk());
+		CHECK(writer.Flush() == 13);
+
+		// First field in the least significant bits of the first byte, 0x55 << 3 in the others
+		CHECK(buffer[0] == Nz::UInt8(0x05 | (0x55 << 3)));
+		CHECK(buffer[12] == 0xAB);
+		CHECK(buffer[13] == 0xCD);
+
+		Nz::BitReader reader(buffer.data(), 13);
+		CHECK(reader.Read<Nz::UInt8>(3).GetValue() == 5);
+		CHECK(reader.Read<Nz::UInt8>(7).GetValue() == 0x55);
+		CHECK(reader.Read<Nz::UInt16>(11).GetValue() == 0x7FF);
+		CHECK(reader.Read<bool>(1).GetValue());
+		CHECK(reader.Read<Nz::Int32>(4).GetValue() == -3);
+		CHECK(reader.Read<Opcode>(3).GetValue() == Opcode::Shoot);
+		CHECK(reader.Read(64).GetValue() == 0x0123456789ABCDEFull);
+		CHECK(reader.Read(0).GetValue() == 0);
+
+		reader.AlignToByte();
+		CHECK(reader.GetBitCursor() == 96);
+		CHECK(reader.Read<Nz::UInt8>(8).GetValue() == 0xAB);
+		CHECK(reader.GetRemainingBits() == 0);
+
+		auto result = reader.Read(1);
+		REQUIRE(result.IsErr());
+		CHECK(result.GetError() == Nz::ByteStreamError::EndOfBuffer);
+	}
+
+	WHEN("Writing and reading many random fields")
+	{
+		Nz::UInt64 randomState = 1234;
+
+		std::vector<std::pair<Nz::UInt64, unsigned int>> fields(10'000);
+		std::size_t bitCount = 0;
+		for (auto& [value, fieldBitCount] : fields)
+		{
+			Nz::UInt64 random = Nz::SplitMix64(randomState);
+			fieldBitCount = static_cast<unsigned int>(random % 65);
+			value = Nz::SplitMix64(randomState);
+			if (fieldBitCount < 64)
+				value &= (Nz::UInt64(1) << fieldBitCount) - 1;
+
+			bitCount += fieldBitCount;
+		}
+
+		// Exact size, to check the bounds near the end of the buffer
+		std::vector<Nz::UInt8> buffer((bitCount + 7) / 8);
+		Nz::BitWriter writer(buffer.data(), buffer.size());
+		for (auto& [value, fieldBitCount] : fields)
+			REQUIRE(writer.Write(value, fieldBitCount).IsOk());
+
+		CHECK(writer.GetRemainingBits() == buffer.size() * 8 - bitCount);
+		CHECK(writer.Flush() == buffer.size());
+
+		Nz::BitReader reader(buffer.data(), buffer.size());
+		for (auto& [value, fieldBitCount] : fields)
+			REQUIRE(reader.Read(fieldBitCount).GetValue() == value);
+
+		CHECK(reader.GetBitCursor() == bitCount);
+
+		Nz::BitReader skipReader(buffer.data(), buffer.size());
+		CHECK(skipReader.Skip(fields[0].second + fields[1].second).IsOk());
+		CHECK(skipReader.Read(fields[2].second).GetValue() == fields[2].first);
+		CHECK(skipReader.Skip(skipReader.GetRemainingBits() + 1).IsErr());
+		CHECK(skipReader.Skip(skipReader.GetRemainingBits()).IsOk());
+		CHECK(skipReader.GetBitCursor() == buffer.size() * 8);
+	}
+
+	WHEN("Writing past the end of the buffer")
+	{
+		std::array<Nz::UInt8, 2> buffer;
+
+		Nz::BitWriter writer(buffer.data(), buffer.size());
+		CHECK(writer.Write(Nz::UInt16(0x1FF), 9).IsOk());
+
+		auto result = writer.Write(Nz::UInt8(0x7F), 8);
+		REQUIRE(result.IsErr());
+		CHECK(result.GetError() == Nz::ByteStreamError::EndOfBuffer);
+		CHECK(writer.GetBitCursor() == 9);
+
+		CHECK(writer.Write(Nz::UInt8(0x7F), 7).IsOk());
+		CHECK(writer.GetRemainingBits() == 0);
+		CHECK(writer.Flush() == 2);
+		CHECK(buffer[0] == 0xFF);
+		CHECK(buffer[1] == 0xFF);
+	}
+}
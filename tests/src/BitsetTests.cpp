@@ -1,17 +1,67 @@
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/Bitset.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <random>
 #include <string>
 #include <iostream>
+#include <vector>
+
+namespace
+{
+	std::size_t s_allocationCount = 0;
+
+	template<typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		CountingAllocator() = default;
+
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U>&)
+		{
+		}
+
+		T* allocate(std::size_t n)
+		{
+			s_allocationCount++;
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n)
+		{
+			s_allocationCount--;
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template<typename U>
+		bool operator==(const CountingAllocator<U>&) const
+		{
+			return true;
+		}
+
+		template<typename U>
+		bool operator!=(const CountingAllocator<U>&) const
+		{
+			return false;
+		}
+	};
+}
 
 template<typename Block> void Check(const char* title);
 template<typename Block> void CheckAppend(const char* title);
 template<typename Block> void CheckBitOps(const char* title);
 template<typename Block> void CheckBitOpsMultipleBlocks(const char* title);
+template<typename Block> void CheckBitOpsLargeBitsets(const char* title);
 template<typename Block> void CheckConstructor(const char* title);
 template<typename Block> void CheckCopyMoveSwap(const char* title);
+template<typename Block> void CheckDelta(const char* title);
+template<typename Block> void CheckInlineStorage(const char* title);
 template<typename Block> void CheckIter(const char* title);
+template<typename Block> void CheckRankIndex(const char* title);
 template<typename Block> void CheckRead(const char* title);
 template<typename Block> void CheckResize(const char* title);
 template<typename Block> void CheckReverse(const char* title);
@@ -34,12 +84,17 @@ void Check(const char* title)
 
 	CheckBitOps<Block>(title);
 	CheckBitOpsMultipleBlocks<Block>(title);
+	CheckBitOpsLargeBitsets<Block>(title);
 
 	CheckAppend<Block>(title);
 	CheckRead<Block>(title);
 	CheckReverse<Block>(title);
+	CheckDelta<Block>(title);
 
 	CheckIter<Block>(title);
+	CheckRankIndex<Block>(title);
+
+	CheckInlineStorage<Block>(title);
 }
 
 template<typename Block>
@@ -186,6 +241,130 @@ void CheckBitOpsMultipleBlocks(const char* title)
 	}
 }
 
+template<typename Block>
+void CheckBitOpsLargeBitsets(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("Two large bitsets of different sizes")
+		{
+			// Big enough to go through the vectorized kernels, with sizes which aren't a multiple of any vector width
+			constexpr std::size_t firstSize = 5003;
+			constexpr std::size_t secondSize = 3011;
+
+			std::minstd_rand gen(42);
+			std::bernoulli_distribution dis(0.5);
+
+			Nz::Bitset<Block> first(firstSize, false);
+			for (std::size_t i = 0; i < firstSize; ++i)
+				first.Set(i, dis(gen));
+
+			Nz::Bitset<Block> second(secondSize, false);
+			for (std::size_t i = 0; i < secondSize; ++i)
+				second.Set(i, dis(gen));
+
+			WHEN("We perform operators")
+			{
+				Nz::Bitset<Block> andBitset = first & second;
+				Nz::Bitset<Block> orBitset = first | second;
+				Nz::Bitset<Block> xorBitset = second ^ first;
+				Nz::Bitset<Block> notBitset = ~first;
+
+				THEN("They should match a bit by bit evaluation")
+				{
+					REQUIRE(andBitset.GetSize() == firstSize);
+					REQUIRE(orBitset.GetSize() == firstSize);
+					REQUIRE(xorBitset.GetSize() == firstSize);
+					REQUIRE(notBitset.GetSize() == firstSize);
+
+					std::size_t firstCount = 0;
+					bool intersects = false;
+					bool matches = true;
+					for (std::size_t i = 0; i < firstSize; ++i)
+					{
+						bool a = first.Test(i);
+						bool b = second.UnboundedTest(i);
+
+						firstCount += (a) ? 1 : 0;
+						intersects = intersects || (a && b);
+						if (andBitset.Test(i) != (a && b) || orBitset.Test(i) != (a || b) || xorBitset.Test(i) != (a != b) || notBitset.Test(i) == a)
+							matches = false;
+					}
+
+					CHECK(matches);
+					CHECK(first.Count() == firstCount);
+					CHECK(notBitset.Count() == firstSize - firstCount);
+					CHECK(first.Intersects(second) == intersects);
+					CHECK(!first.Intersects(notBitset));
+				}
+			}
+
+			WHEN("We perform operators in place")
+			{
+				Nz::Bitset<Block> copy = first;
+				copy &= second;
+				CHECK(copy == (first & second));
+
+				copy = first;
+				copy |= second;
+				CHECK(copy == (first | second));
+
+				copy = second;
+				copy ^= first;
+				CHECK(copy == (first ^ second));
+
+				copy ^= copy;
+				CHECK(copy.TestNone());
+				CHECK(copy.GetSize() == firstSize);
+			}
+
+			WHEN("We perform fused operations")
+			{
+				Nz::Bitset<Block> resizedSecond = second;
+				resizedSecond.Resize(firstSize);
+
+				CHECK(first.CountAnd(second) == (first & second).Count());
+				CHECK(second.CountAnd(first) == (first & second).Count());
+				CHECK(first.CountAndNot(second) == (first & ~resizedSecond).Count());
+				CHECK(second.CountAndNot(first) == (resizedSecond & ~first).Count());
+				CHECK(first.IntersectsAndNot(second) == (first & ~resizedSecond).TestAny());
+				CHECK(second.IntersectsAndNot(first) == (resizedSecond & ~first).TestAny());
+
+				Nz::Bitset<Block> andNot;
+				andNot.PerformsANDNOT(first, second);
+				CHECK(andNot == (first & ~resizedSecond));
+
+				andNot.PerformsANDNOT(second, first);
+				CHECK(andNot == (resizedSecond & ~first));
+
+				Nz::Bitset<Block> inPlace = first;
+				inPlace.PerformsANDNOT(inPlace, second);
+				CHECK(inPlace == (first & ~resizedSecond));
+
+				inPlace = second;
+				inPlace.PerformsANDNOT(first, inPlace);
+				CHECK(inPlace == (first & ~resizedSecond));
+
+				Nz::Bitset<Block> subset = first & second;
+				CHECK(subset.IsSubsetOf(first));
+				CHECK(subset.IsSubsetOf(second));
+				CHECK(first.IsSubsetOf(first | second));
+				CHECK(!first.IsSubsetOf(second));
+				CHECK(Nz::Bitset<Block>().IsSubsetOf(second));
+
+				// A bit set past the end of the other bitset prevents it from being a subset
+				Nz::Bitset<Block> larger = second;
+				larger.Resize(firstSize);
+				CHECK(second.IsSubsetOf(larger));
+				CHECK(larger.IsSubsetOf(second));
+				larger.Set(firstSize - 1);
+				CHECK(!larger.IsSubsetOf(second));
+				CHECK(larger.CountAndNot(second) == 1);
+			}
+		}
+	}
+}
+
 template<typename Block>
 void CheckConstructor(const char* title)
 {
@@ -290,6 +469,272 @@ void CheckCopyMoveSwap(const char* title)
 	}
 }
 
+template<typename Block>
+void CheckDelta(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("Two states of a large bitset")
+		{
+			std::mt19937 rand(42);
+
+			Nz::Bitset<Block> previous(100'000, false);
+			for (std::size_t i = 0; i < previous.GetSize(); ++i)
+				previous.Set(i, rand() % 2 == 0);
+
+			Nz::Bitset<Block> current = previous;
+			for (std::size_t i = 0; i < 200; ++i)
+				current.Set(std::size_t(rand() % current.GetSize()), rand() % 2 == 0);
+
+			// Dense changes
+			for (std::size_t i = 5000; i < 5100; ++i)
+				current.Set(i, rand() % 2 == 0);
+
+			std::vector<Nz::UInt8> buffer(previous.GetBlockCount() * sizeof(Block) * 2);
+
+			WHEN("We encode and apply a delta")
+			{
+				for (Nz::Endianness endianness : { Nz::Endianness::LittleEndian, Nz::Endianness::BigEndian })
+				{
+					Nz::ByteWriter writer(buffer.data(), buffer.size(), endianness);
+					REQUIRE(Nz::Bitset<Block>::EncodeDelta(previous, current, writer));
+
+					// Only the changed blocks are sent
+					CHECK(writer.GetCursor() < previous.GetBlockCount() * sizeof(Block) / 10);
+
+					Nz::Bitset<Block> received = previous;
+					Nz::ByteReader reader(buffer.data(), writer.GetCursor(), endianness);
+					REQUIRE(received.ApplyDelta(reader));
+					CHECK(reader.IsAtEnd());
+					CHECK(received == current);
+				}
+			}
+
+			WHEN("Both states are equal")
+			{
+				Nz::ByteWriter writer(buffer.data(), buffer.size());
+				REQUIRE(Nz::Bitset<Block>::EncodeDelta(current, current, writer));
+				CHECK(writer.GetCursor() <= 8);
+
+				Nz::Bitset<Block> received = current;
+				Nz::ByteReader reader(buffer.data(), writer.GetCursor());
+				REQUIRE(received.ApplyDelta(reader));
+				CHECK(received == current);
+			}
+
+			WHEN("We encode against an empty bitset")
+			{
+				Nz::ByteWriter writer(buffer.data(), buffer.size());
+				REQUIRE(Nz::Bitset<Block>::EncodeDelta(Nz::Bitset<Block>(), current, writer));
+
+				Nz::Bitset<Block> received;
+				Nz::ByteReader reader(buffer.data(), writer.GetCursor());
+				REQUIRE(received.ApplyDelta(reader));
+				CHECK(received == current);
+			}
+
+			WHEN("The size changes")
+			{
+				for (std::size_t newSize : { std::size_t(0), std::size_t(1), std::size_t(63), std::size_t(50'001), std::size_t(150'003) })
+				{
+					Nz::Bitset<Block> resized = current;
+					resized.Resize(newSize, true);
+
+					Nz::ByteWriter writer(buffer.data(), buffer.size());
+					REQUIRE(Nz::Bitset<Block>::EncodeDelta(previous, resized, writer));
+
+					Nz::Bitset<Block> received = previous;
+					Nz::ByteReader reader(buffer.data(), writer.GetCursor());
+					REQUIRE(received.ApplyDelta(reader));
+					CHECK(received == resized);
+
+					// and back
+					writer.SetCursor(0);
+					REQUIRE(Nz::Bitset<Block>::EncodeDelta(resized, previous, writer));
+
+					reader = Nz::ByteReader(buffer.data(), writer.GetCursor());
+					REQUIRE(received.ApplyDelta(reader));
+					CHECK(received == previous);
+				}
+			}
+
+			WHEN("The buffer is too small")
+			{
+				Nz::ByteWriter writer(buffer.data(), 16);
+				auto result = Nz::Bitset<Block>::EncodeDelta(previous, current, writer);
+				REQUIRE_FALSE(result);
+				CHECK(result.GetError() == Nz::ByteStreamError::EndOfBuffer);
+			}
+
+			WHEN("The delta is truncated or corrupted")
+			{
+				Nz::ByteWriter writer(buffer.data(), buffer.size());
+				REQUIRE(Nz::Bitset<Block>::EncodeDelta(previous, current, writer));
+
+				Nz::Bitset<Block> received = previous;
+				Nz::ByteReader truncatedReader(buffer.data(), writer.GetCursor() - 1);
+				auto truncatedResult = received.ApplyDelta(truncatedReader);
+				REQUIRE_FALSE(truncatedResult);
+				CHECK(truncatedResult.GetError() == Nz::ByteStreamError::EndOfBuffer);
+
+				// A run going past the end of the bitset
+				std::array<Nz::UInt8, 16> corruptedDelta;
+				Nz::ByteWriter corruptedWriter(corruptedDelta.data(), corruptedDelta.size());
+				REQUIRE(corruptedWriter.WriteVarInt(std::size_t(100)));
+				REQUIRE(corruptedWriter.WriteVarInt(std::size_t(1000)));
+				REQUIRE(corruptedWriter.WriteVarInt(std::size_t(0)));
+
+				Nz::ByteReader corruptedReader(corruptedDelta.data(), corruptedWriter.GetCursor());
+				auto corruptedResult = received.ApplyDelta(corruptedReader);
+				REQUIRE_FALSE(corruptedResult);
+				CHECK(corruptedResult.GetError() == Nz::ByteStreamError::InvalidData);
+
+				// A garbage size, which must not be allocated
+				std::array<Nz::UInt8, 8> garbageDelta = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F };
+				std::size_t receivedSize = received.GetSize();
+				Nz::ByteReader garbageReader(garbageDelta.data(), garbageDelta.size());
+				auto garbageResult = received.ApplyDelta(garbageReader);
+				REQUIRE_FALSE(garbageResult);
+				CHECK(garbageResult.GetError() == Nz::ByteStreamError::InvalidData);
+				CHECK(received.GetSize() == receivedSize);
+
+				// A valid delta larger than the caller-supplied limit
+				Nz::ByteReader limitedReader(buffer.data(), writer.GetCursor());
+				auto limitedResult = received.ApplyDelta(limitedReader, current.GetSize() - 1);
+				REQUIRE_FALSE(limitedResult);
+				CHECK(limitedResult.GetError() == Nz::ByteStreamError::InvalidData);
+
+				Nz::Bitset<Block> limited = previous;
+				Nz::ByteReader exactReader(buffer.data(), writer.GetCursor());
+				REQUIRE(limited.ApplyDelta(exactReader, current.GetSize()));
+				CHECK(limited == current);
+
+				// Random garbage must fail cleanly or produce some bitset, but never crash nor allocate past the limit
+				for (std::size_t i = 0; i < 1000; ++i)
+				{
+					std::array<Nz::UInt8, 32> randomDelta;
+					for (Nz::UInt8& byte : randomDelta)
+						byte = static_cast<Nz::UInt8>(rand());
+
+					Nz::Bitset<Block> garbage = previous;
+					Nz::ByteReader randomReader(randomDelta.data(), randomDelta.size());
+					if (garbage.ApplyDelta(randomReader, 4096))
+						CHECK(garbage.GetSize() <= 4096);
+				}
+			}
+		}
+	}
+}
+
+template<typename Block>
+void CheckInlineStorage(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("A bitset with inline storage for 256 bits")
+		{
+			using InlineBitset = Nz::SmallBitset<256, Block, CountingAllocator<Block>>;
+			constexpr std::size_t inlineBitCount = 256;
+
+			s_allocationCount = 0;
+
+			InlineBitset bitset(200, false);
+			CHECK(bitset.GetCapacity() == inlineBitCount);
+			CHECK(s_allocationCount == 0);
+
+			bitset.Set(3, true);
+			bitset.Set(150, true);
+			bitset.Set(199, true);
+
+			WHEN("We use it within its inline capacity")
+			{
+				InlineBitset other("1011");
+				other.Resize(inlineBitCount);
+				other.Set(150, false);
+
+				InlineBitset result = bitset & other;
+				result |= bitset;
+				result ^= other;
+				result.Set(255, true);
+
+				InlineBitset copy(result);
+				InlineBitset moved(std::move(copy));
+
+				CHECK(s_allocationCount == 0);
+				CHECK(bitset.Count() == 3);
+				CHECK(bitset.FindFirst() == 3);
+				CHECK(bitset.FindNext(3) == 150);
+				CHECK(moved == result);
+				CHECK(moved.Count() == 5);
+				CHECK(moved.Test(0));
+				CHECK(!moved.Test(3));
+				CHECK(moved.Test(255));
+			}
+
+			WHEN("We grow it past its inline capacity")
+			{
+				bitset.Resize(1000);
+				bitset.Set(999, true);
+				CHECK(s_allocationCount == 1);
+				CHECK(bitset.GetCapacity() >= 1000);
+				CHECK(bitset.Count() == 4);
+				CHECK(bitset.Test(150));
+
+				THEN("Copies and moves keep the bits")
+				{
+					InlineBitset copy(bitset);
+					CHECK(s_allocationCount == 2);
+					CHECK(copy == bitset);
+
+					InlineBitset moved(std::move(copy));
+					CHECK(s_allocationCount == 2);
+					CHECK(moved == bitset);
+
+					// Moving into an inline bitset takes ownership of the heap blocks
+					InlineBitset small(10, true);
+					small = std::move(moved);
+					CHECK(s_allocationCount == 2);
+					CHECK(small == bitset);
+
+					// Copying an inline bitset into a heap one reuses its blocks
+					InlineBitset other(10, true);
+					small = other;
+					CHECK(s_allocationCount == 2);
+					CHECK(small == other);
+
+					small.Swap(bitset);
+					CHECK(bitset == other);
+					CHECK(small.Count() == 4);
+					CHECK(small.Test(999));
+				}
+
+				AND_WHEN("We shrink it back")
+				{
+					bitset.Resize(10);
+					CHECK(bitset.Count() == 1);
+					CHECK(bitset.GetCapacity() >= 1000);
+				}
+			}
+
+			WHEN("We build it bit by bit")
+			{
+				InlineBitset built;
+				for (std::size_t i = 0; i < 300; ++i)
+					built.UnboundedSet(i, i % 3 == 0);
+
+				CHECK(s_allocationCount == 1);
+				CHECK(built.GetSize() == 298);
+				CHECK(built.Count() == 100);
+				CHECK(built.ToString().size() == 298);
+			}
+
+			bitset = InlineBitset();
+		}
+
+		CHECK(s_allocationCount == 0);
+	}
+}
+
 template<typename Block>
 void CheckIter(const char* title)
 {
@@ -309,6 +754,90 @@ void CheckIter(const char* title)
 
 			foundBlock ^= block;
 			CHECK(foundBlock.TestNone());
+
+			WHEN("We extract set bits in batch")
+			{
+				std::vector<std::size_t> expectedBits;
+				for (std::size_t bit : block.IterBits())
+					expectedBits.push_back(bit);
+
+				std::vector<std::size_t> bits;
+				block.ForEachSetBit([&](std::size_t bit) { bits.push_back(bit); });
+				CHECK(bits == expectedBits);
+
+				bits.clear();
+				block.ExtractSetBits(std::back_inserter(bits));
+				CHECK(bits == expectedBits);
+
+				for (std::size_t startBit : { std::size_t(1), std::size_t(9), std::size_t(63), block.GetSize() - 1, block.GetSize() })
+				{
+					std::vector<std::size_t> expectedTail;
+					std::copy_if(expectedBits.begin(), expectedBits.end(), std::back_inserter(expectedTail), [&](std::size_t bit) { return bit >= startBit; });
+
+					std::vector<std::size_t> tail(expectedTail.size() + 1, block.npos);
+					auto it = block.ExtractSetBits(tail.data(), startBit);
+					CHECK(it == tail.data() + expectedTail.size());
+					CHECK(tail.back() == block.npos);
+
+					tail.pop_back();
+					CHECK(tail == expectedTail);
+				}
+
+				Nz::Bitset<Block> empty;
+				std::size_t dummy;
+				CHECK(empty.ExtractSetBits(&dummy) == &dummy);
+			}
+		}
+	}
+}
+
+template<typename Block>
+void CheckRankIndex(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("Bitsets of various sizes and densities")
+		{
+			std::mt19937 rand(static_cast<unsigned int>(sizeof(Block)));
+
+			for (std::size_t bitCount : { 0, 1, 511, 512, 513, 1024, 5003, 65536, 200000 })
+			{
+				for (double density : { 0.0, 0.02, 0.5, 1.0 })
+				{
+					std::bernoulli_distribution dis(density);
+
+					Nz::Bitset<Block> bitset(bitCount, false);
+					for (std::size_t i = 0; i < bitCount; ++i)
+						bitset.Set(i, dis(rand));
+
+					auto rankIndex = bitset.BuildRankIndex();
+					CHECK(&rankIndex.GetBitset() == &bitset);
+					CHECK(rankIndex.Count() == bitset.Count());
+					if (bitCount >= 5000)
+						CHECK(rankIndex.GetMemoryUsage() * 20 < bitset.GetBlockCount() * sizeof(Block)); //< under 5%
+
+					// Compare against a linear count
+					bool rankOk = true;
+					bool selectOk = true;
+					std::size_t rank = 0;
+					for (std::size_t i = 0; i <= bitCount; ++i)
+					{
+						if (rankIndex.Rank(i) != rank)
+							rankOk = false;
+
+						if (i < bitCount && bitset.Test(i))
+						{
+							if (rankIndex.Select(rank) != i)
+								selectOk = false;
+
+							rank++;
+						}
+					}
+
+					CHECK(rankOk);
+					CHECK(selectOk);
+				}
+			}
 		}
 	}
 }
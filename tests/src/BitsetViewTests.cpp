@@ -0,0 +1,229 @@
+#include <NazaraUtils/BitsetView.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	bool TestBufferBit(const std::vector<Nz::UInt8>& buffer, std::size_t bit)
+	{
+		return (buffer[bit / 8] & (1U << (bit % 8))) != 0;
+	}
+
+	Nz::Bitset<Nz::UInt64> ToReference(const std::vector<Nz::UInt8>& buffer, std::size_t bitOffset, std::size_t bitCount)
+	{
+		Nz::Bitset<Nz::UInt64> bitset(bitCount, false);
+		for (std::size_t i = 0; i < bitCount; ++i)
+			bitset.Set(i, TestBufferBit(buffer, bitOffset + i));
+
+		return bitset;
+	}
+
+	std::vector<Nz::UInt8> GenerateBuffer(std::mt19937& rand, std::size_t byteCount, double density)
+	{
+		std::bernoulli_distribution dis(density);
+
+		std::vector<Nz::UInt8> buffer(byteCount);
+		for (std::size_t i = 0; i < byteCount * 8; ++i)
+		{
+			if (dis(rand))
+				buffer[i / 8] |= Nz::UInt8(1U << (i % 8));
+		}
+
+		return buffer;
+	}
+}
+
+SCENARIO("BitsetView", "[CORE][BITSETVIEW]")
+{
+	GIVEN("An empty view")
+	{
+		Nz::BitsetView view;
+		CHECK(view.GetSize() == 0);
+		CHECK(view.Count() == 0);
+		CHECK(view.FindFirst() == view.npos);
+		CHECK(view.TestAll());
+		CHECK(view.TestNone());
+		CHECK(view.ToString().empty());
+		CHECK(view.ToBitset().GetSize() == 0);
+	}
+
+	GIVEN("A view over a packet bitfield")
+	{
+		// Two bitfields packed after a 3-bit header: 0b101 | 10 bits | 6 bits
+		Nz::UInt8 packet[] = { 0b1010'1101, 0b1100'0011, 0b0000'0101 };
+
+		Nz::BitsetView header(packet, 3);
+		CHECK(header.ToString() == "101");
+
+		Nz::BitsetView first(header.GetEndSequence(), 10);
+		CHECK(first.GetPointer() == &packet[0]);
+		CHECK(first.GetBitOffset() == 3);
+		CHECK(first.ToString() == "0001110101");
+		CHECK(first.Count() == 5);
+		CHECK(first.FindFirst() == 0);
+		CHECK(first.FindNext(0) == 2);
+		CHECK(first.Test(4));
+		CHECK(first[6]);
+		CHECK_FALSE(first[9]);
+
+		Nz::BitsetView second(first.GetEndSequence(), 6);
+		CHECK(second.GetPointer() == &packet[1]);
+		CHECK(second.GetBitOffset() == 5);
+		CHECK(second.ToString() == "101110");
+
+		Nz::Bitset<Nz::UInt8> bitset = second.ToBitset<Nz::UInt8>();
+		CHECK(bitset.ToString() == "101110");
+
+		std::vector<std::size_t> bits;
+		for (std::size_t bit : second.IterBits())
+			bits.push_back(bit);
+
+		CHECK(bits == std::vector<std::size_t>{ 1, 2, 3, 5 });
+	}
+
+	GIVEN("Views over random memory")
+	{
+		std::mt19937 rand(42);
+
+		for (double density : { 0.01, 0.5, 0.99 })
+		{
+			std::vector<Nz::UInt8> bufferA = GenerateBuffer(rand, 200, density);
+			std::vector<Nz::UInt8> bufferB = GenerateBuffer(rand, 200, density);
+
+			for (std::size_t offsetA : { 0, 3, 8, 13 })
+			{
+				for (std::size_t offsetB : { 0, 3, 5 })
+				{
+					for (std::size_t bitCount : { 0, 1, 7, 8, 63, 64, 65, 500, 1500 })
+					{
+						Nz::BitsetView a(bufferA.data(), offsetA, bitCount);
+						Nz::BitsetView b(bufferB.data(), offsetB, bitCount - bitCount / 3);
+
+						Nz::Bitset<Nz::UInt64> refA = ToReference(bufferA, offsetA, a.GetSize());
+						Nz::Bitset<Nz::UInt64> refB = ToReference(bufferB, offsetB, b.GetSize());
+
+						CHECK(a.Count() == refA.Count());
+						CHECK(a.TestAny() == refA.TestAny());
+						CHECK(a.TestAll() == refA.TestAll());
+						CHECK(a.ToString() == refA.ToString());
+						CHECK(a.ToBitset<Nz::UInt64>() == refA);
+
+						std::vector<std::size_t> bits;
+						for (std::size_t bit : a.IterBits())
+							bits.push_back(bit);
+
+						std::vector<std::size_t> expectedBits;
+						for (std::size_t bit : refA.IterBits())
+							expectedBits.push_back(bit);
+
+						CHECK(bits == expectedBits);
+
+						CHECK(a.CountAnd(b) == refA.CountAnd(refB));
+						CHECK(a.CountAndNot(b) == refA.CountAndNot(refB));
+						CHECK(b.CountAndNot(a) == refB.CountAndNot(refA));
+						CHECK(a.Intersects(b) == refA.Intersects(refB));
+						CHECK(a.IntersectsAndNot(b) == refA.IntersectsAndNot(refB));
+						CHECK(b.IsSubsetOf(a) == refB.IsSubsetOf(refA));
+						CHECK(a.IsSubsetOf(a));
+					}
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("MutableBitsetView", "[CORE][BITSETVIEW]")
+{
+	GIVEN("A mutable view inside a buffer")
+	{
+		std::vector<Nz::UInt8> buffer(4, 0);
+		Nz::MutableBitsetView view(buffer.data(), 5, 14);
+
+		WHEN("We set and reset bits")
+		{
+			view.Set(0, true);
+			view.Set(13, true);
+			view.Set(7, true);
+			view.Reset(7);
+			CHECK(view.ToString() == "10000000000001");
+			CHECK(buffer == std::vector<Nz::UInt8>{ 0x20, 0x00, 0x04, 0x00 });
+
+			view.Set();
+			CHECK(view.TestAll());
+			CHECK(buffer == std::vector<Nz::UInt8>{ 0xE0, 0xFF, 0x07, 0x00 });
+
+			view.Flip();
+			CHECK(view.TestNone());
+			CHECK(buffer == std::vector<Nz::UInt8>{ 0x00, 0x00, 0x00, 0x00 });
+		}
+
+		WHEN("We modify a sub-view")
+		{
+			Nz::MutableBitsetView subView = view.GetSubView(3, 8);
+			CHECK(subView.GetPointer() == &buffer[1]);
+			subView.Set();
+			CHECK(view.ToString() == "00011111111000");
+			CHECK(view.Count() == 8);
+		}
+	}
+
+	GIVEN("Random memory")
+	{
+		std::mt19937 rand(1337);
+
+		std::vector<Nz::UInt8> bufferA = GenerateBuffer(rand, 200, 0.5);
+		std::vector<Nz::UInt8> bufferB = GenerateBuffer(rand, 200, 0.5);
+		std::vector<Nz::UInt8> bufferDst = GenerateBuffer(rand, 200, 0.5);
+
+		for (std::size_t offsetA : { 0, 3 })
+		{
+			for (std::size_t offsetB : { 0, 3, 6 })
+			{
+				for (std::size_t offsetDst : { 0, 3, 11 })
+				{
+					for (std::size_t bitCount : { 1, 9, 64, 130, 1000 })
+					{
+						Nz::BitsetView a(bufferA.data(), offsetA, bitCount);
+						Nz::BitsetView b(bufferB.data(), offsetB, bitCount / 2 + 1);
+						Nz::Bitset<Nz::UInt64> refA = ToReference(bufferA, offsetA, a.GetSize());
+						Nz::Bitset<Nz::UInt64> refB = ToReference(bufferB, offsetB, b.GetSize());
+						refB.Resize(bitCount, false);
+
+						auto CheckOp = [&](auto&& op, const Nz::Bitset<Nz::UInt64>& expected)
+						{
+							std::vector<Nz::UInt8> buffer = bufferDst;
+							Nz::MutableBitsetView dst(buffer.data(), offsetDst, bitCount);
+							op(dst);
+
+							CHECK(dst.ToBitset<Nz::UInt64>() == expected);
+
+							// Bits around the view must not be modified
+							bool unchanged = true;
+							for (std::size_t i = 0; i < buffer.size() * 8; ++i)
+							{
+								if ((i < offsetDst || i >= offsetDst + bitCount) && TestBufferBit(buffer, i) != TestBufferBit(bufferDst, i))
+									unchanged = false;
+							}
+
+							CHECK(unchanged);
+						};
+
+						CheckOp([&](Nz::MutableBitsetView& dst) { dst.PerformsAND(a, b); }, refA & refB);
+						CheckOp([&](Nz::MutableBitsetView& dst) { dst.PerformsOR(a, b); }, refA | refB);
+						CheckOp([&](Nz::MutableBitsetView& dst) { dst.PerformsXOR(a, b); }, refA ^ refB);
+						CheckOp([&](Nz::MutableBitsetView& dst) { dst.PerformsANDNOT(a, b); }, refA & ~refB);
+						CheckOp([&](Nz::MutableBitsetView& dst) { dst.PerformsNOT(a); }, ~refA);
+						CheckOp([&](Nz::MutableBitsetView& dst)
+						{
+							dst.PerformsNOT(a);
+							dst ^= b;
+							dst |= b;
+							dst &= a;
+						}, refA & ((~refA ^ refB) | refB));
+					}
+				}
+			}
+		}
+	}
+}
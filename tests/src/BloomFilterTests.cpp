@@ -0,0 +1,84 @@
+#include <NazaraUtils/BloomFilter.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+template<typename Filter>
+void CheckFilter(Filter& filter, std::size_t keyCount, double maxFalsePositiveRate)
+{
+	for (std::size_t i = 0; i < keyCount; ++i)
+		filter.Insert(i * 2);
+
+	bool noFalseNegative = true;
+	for (std::size_t i = 0; i < keyCount; ++i)
+		noFalseNegative &= filter.MayContain(i * 2);
+
+	CHECK(noFalseNegative);
+
+	std::size_t falsePositiveCount = 0;
+	for (std::size_t i = 0; i < keyCount; ++i)
+	{
+		if (filter.MayContain(i * 2 + 1))
+			falsePositiveCount++;
+	}
+
+	CHECK(double(falsePositiveCount) / double(keyCount) < maxFalsePositiveRate);
+}
+
+SCENARIO("BloomFilter", "[CORE][BLOOMFILTER]")
+{
+	constexpr std::size_t KeyCount = 10'000;
+
+	std::size_t bitCount = Nz::ComputeBloomFilterBitCount(KeyCount, 0.01);
+	std::size_t hashCount = Nz::ComputeBloomFilterHashCount(bitCount, KeyCount);
+	CHECK(bitCount == 95851);
+	CHECK(hashCount == 7);
+
+	WHEN("Using a Bloom filter")
+	{
+		Nz::BloomFilter<std::size_t> filter(bitCount, hashCount);
+		CHECK(filter.GetBitCount() == 131072);
+		CHECK(filter.GetHashCount() == 7);
+		CHECK_FALSE(filter.MayContain(42));
+
+		CheckFilter(filter, KeyCount, 0.01);
+
+		filter.Clear();
+		CHECK_FALSE(filter.MayContain(0));
+	}
+
+	WHEN("Using a blocked Bloom filter")
+	{
+		Nz::BlockedBloomFilter<std::size_t> filter(bitCount, hashCount);
+		CHECK(filter.GetBitCount() % Nz::BlockedBloomFilter<std::size_t>::BlockBitCount == 0);
+		CHECK_FALSE(filter.MayContain(42));
+
+		// Blocking costs a bit of accuracy
+		CheckFilter(filter, KeyCount, 0.02);
+
+		filter.Clear();
+		CHECK_FALSE(filter.MayContain(0));
+	}
+
+	WHEN("Merging filters")
+	{
+		Nz::BloomFilter<std::string> first(1024, 4);
+		Nz::BloomFilter<std::string> second(1024, 4);
+		first.Insert("sword");
+		second.Insert("shield");
+		CHECK_FALSE(first.MayContain("shield"));
+
+		first.Merge(second);
+		CHECK(first.MayContain("sword"));
+		CHECK(first.MayContain("shield"));
+
+		Nz::BlockedBloomFilter<std::string> firstBlocked(4096, 4);
+		Nz::BlockedBloomFilter<std::string> secondBlocked(4096, 4);
+		firstBlocked.Insert("sword");
+		secondBlocked.Insert("shield");
+		CHECK_FALSE(firstBlocked.MayContain("shield"));
+
+		firstBlocked.Merge(secondBlocked);
+		CHECK(firstBlocked.MayContain("sword"));
+		CHECK(firstBlocked.MayContain("shield"));
+	}
+}
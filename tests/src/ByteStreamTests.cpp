@@ -0,0 +1,161 @@
+#include <NazaraUtils/ByteStream.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+void CheckByteStreamRoundTrip(Nz::Endianness endianness)
+{
+	std::array<Nz::UInt8, 256> buffer{};
+	Nz::ByteWriter writer(buffer.data(), buffer.size(), endianness);
+
+	std::array<Nz::UInt16, 21> shorts;
+	for (std::size_t i = 0; i < shorts.size(); ++i)
+		shorts[i] = Nz::UInt16(0x1234 + i * 0x101);
+
+	CHECK(writer.Write<Nz::UInt8>(0xAB).IsOk());
+	CHECK(writer.Write<Nz::UInt32>(0xDEADBEEF).IsOk());
+	CHECK(writer.Write<Nz::Int16>(-2).IsOk());
+	CHECK(writer.Write(3.5f).IsOk());
+	CHECK(writer.Write(-1.25).IsOk());
+	CHECK(writer.WriteArray(shorts.data(), shorts.size()).IsOk());
+	CHECK(writer.WriteString("Hello world").IsOk());
+	CHECK(writer.WriteVarInt(Nz::UInt32(300)).IsOk());
+	CHECK(writer.WriteVarInt(Nz::Int64(-5)).IsOk());
+	CHECK(writer.GetCursor() == 1 + 4 + 2 + 4 + 8 + 42 + 12 + 2 + 1);
+
+	if (endianness == Nz::Endianness::BigEndian)
+		CHECK(std::memcmp(&buffer[1], "\xDE\xAD\xBE\xEF", 4) == 0);
+	else
+		CHECK(std::memcmp(&buffer[1], "\xEF\xBE\xAD\xDE", 4) == 0);
+
+	WHEN("We read it back")
+	{
+		Nz::ByteReader reader(buffer.data(), writer.GetCursor(), endianness);
+		CHECK(reader.Read<Nz::UInt8>().GetValue() == 0xAB);
+		CHECK(reader.Read<Nz::UInt32>().GetValue() == 0xDEADBEEF);
+		CHECK(reader.Read<Nz::Int16>().GetValue() == -2);
+		CHECK(reader.Read<float>().GetValue() == 3.5f);
+		CHECK(reader.Read<double>().GetValue() == -1.25);
+
+		std::array<Nz::UInt16, 21> readShorts;
+		CHECK(reader.ReadArray(readShorts.data(), readShorts.size()).IsOk());
+		CHECK(readShorts == shorts);
+
+		auto str = reader.ReadString();
+		REQUIRE(str.IsOk());
+		CHECK(str.GetValue() == "Hello world");
+		CHECK(reinterpret_cast<const Nz::UInt8*>(str.GetValue().data()) == &buffer[1 + 4 + 2 + 4 + 8 + 42 + 1]); //< no copy
+
+		CHECK(reader.ReadVarInt<Nz::UInt32>().GetValue() == 300);
+		CHECK(reader.ReadVarInt<Nz::Int64>().GetValue() == -5);
+		CHECK(reader.IsAtEnd());
+
+		CHECK(reader.Read<Nz::UInt8>().GetError() == Nz::ByteStreamError::EndOfBuffer);
+	}
+}
+
+SCENARIO("ByteStream", "[CORE][BYTESTREAM]")
+{
+	GIVEN("A big-endian buffer")
+	{
+		CheckByteStreamRoundTrip(Nz::Endianness::BigEndian);
+	}
+
+	GIVEN("A little-endian buffer")
+	{
+		CheckByteStreamRoundTrip(Nz::Endianness::LittleEndian);
+	}
+
+	GIVEN("Variable-length integers")
+	{
+		std::array<Nz::UInt8, 64> buffer{};
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+
+		WHEN("We encode small values")
+		{
+			CHECK(writer.WriteVarInt(0u).IsOk());
+			CHECK(writer.WriteVarInt(127u).IsOk());
+			CHECK(writer.WriteVarInt(128u).IsOk());
+			CHECK(writer.WriteVarInt(-1).IsOk());
+			CHECK(writer.WriteVarInt(1).IsOk());
+			CHECK(writer.GetCursor() == 6);
+
+			CHECK(buffer[0] == 0x00);
+			CHECK(buffer[1] == 0x7F);
+			CHECK(buffer[2] == 0x80);
+			CHECK(buffer[3] == 0x01);
+			CHECK(buffer[4] == 0x01); //< zigzag
+			CHECK(buffer[5] == 0x02);
+		}
+
+		WHEN("We encode extreme values")
+		{
+			CHECK(writer.WriteVarInt(std::numeric_limits<Nz::UInt64>::max()).IsOk());
+			CHECK(writer.WriteVarInt(std::numeric_limits<Nz::Int64>::min()).IsOk());
+			CHECK(writer.WriteVarInt(std::numeric_limits<Nz::Int8>::min()).IsOk());
+			CHECK(writer.WriteVarInt(std::numeric_limits<Nz::UInt16>::max()).IsOk());
+			CHECK(writer.GetCursor() == 10 + 10 + 2 + 3);
+
+			Nz::ByteReader reader(buffer.data(), writer.GetCursor());
+			CHECK(reader.ReadVarInt<Nz::UInt64>().GetValue() == std::numeric_limits<Nz::UInt64>::max());
+			CHECK(reader.ReadVarInt<Nz::Int64>().GetValue() == std::numeric_limits<Nz::Int64>::min());
+			CHECK(reader.ReadVarInt<Nz::Int8>().GetValue() == std::numeric_limits<Nz::Int8>::min());
+
+			std::size_t cursor = reader.GetCursor();
+			CHECK(reader.ReadVarInt<Nz::UInt8>().GetError() == Nz::ByteStreamError::VarIntOverflow);
+			CHECK(reader.GetCursor() == cursor);
+			CHECK(reader.ReadVarInt<Nz::UInt16>().GetValue() == std::numeric_limits<Nz::UInt16>::max());
+		}
+
+		WHEN("We decode a truncated or overlong value")
+		{
+			const Nz::UInt8 truncated[] = { 0x80, 0x80 };
+			Nz::ByteReader truncatedReader(truncated, sizeof(truncated));
+			CHECK(truncatedReader.ReadVarInt().GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(truncatedReader.GetCursor() == 0);
+
+			const Nz::UInt8 overlong[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F };
+			Nz::ByteReader overlongReader(overlong, sizeof(overlong));
+			CHECK(overlongReader.ReadVarInt<Nz::UInt32>().GetError() == Nz::ByteStreamError::VarIntOverflow);
+			CHECK(overlongReader.ReadVarInt<Nz::UInt64>().GetValue() == 0x1FFFFFFFFull);
+		}
+	}
+
+	GIVEN("A small buffer")
+	{
+		std::array<Nz::UInt8, 6> buffer{};
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+
+		WHEN("We write past its end")
+		{
+			CHECK(writer.Write<Nz::UInt32>(42).IsOk());
+			CHECK(writer.Write<Nz::UInt32>(42).GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(writer.WriteString("abc").GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(writer.GetCursor() == 4);
+
+			auto reserved = writer.Skip(2);
+			REQUIRE(reserved.IsOk());
+			reserved.GetValue()[0] = 0x12;
+			CHECK(writer.GetRemainingSize() == 0);
+			CHECK(buffer[4] == 0x12);
+		}
+
+		WHEN("We read past its end")
+		{
+			Nz::ByteReader reader(buffer.data(), buffer.size());
+
+			Nz::UInt16 values[4];
+			CHECK(reader.ReadArray(values, 4).GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(reader.GetCursor() == 0);
+			CHECK(reader.ReadBytes(7).GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(reader.Skip(5).IsOk());
+			CHECK(reader.ReadString(2).GetError() == Nz::ByteStreamError::EndOfBuffer);
+
+			buffer[5] = 10; //< string length larger than the remaining data
+			CHECK(reader.ReadString().GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(reader.GetCursor() == 5);
+		}
+	}
+}
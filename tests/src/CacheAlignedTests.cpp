@@ -0,0 +1,100 @@
+#include <NazaraUtils/CacheAligned.hpp>
+#include <NazaraUtils/PerThreadArray.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+static_assert(alignof(Nz::CacheAligned<char>) == Nz::CacheLineSize);
+static_assert(sizeof(Nz::CacheAligned<char>) == Nz::CacheLineSize);
+static_assert(sizeof(Nz::CacheAligned<char[Nz::CacheLineSize + 1]>) == 2 * Nz::CacheLineSize);
+static_assert(Nz::CacheLineSize == NAZARA_CACHELINE_SIZE);
+
+static_assert(Nz::AlignToCacheLine(0) == 0);
+static_assert(Nz::AlignToCacheLine(1) == Nz::CacheLineSize);
+static_assert(Nz::AlignToCacheLine(Nz::CacheLineSize) == Nz::CacheLineSize);
+static_assert(Nz::AlignToCacheLine(Nz::CacheLineSize + 1) == 2 * Nz::CacheLineSize);
+static_assert(Nz::GetCacheLinePadding(8) == Nz::CacheLineSize - 8);
+static_assert(Nz::GetCacheLinePadding(Nz::CacheLineSize) == 0);
+
+SCENARIO("CacheAligned", "[CORE][CACHEALIGNED]")
+{
+	WHEN("Wrapping values")
+	{
+		Nz::CacheAligned<int> defaultValue;
+		CHECK(*defaultValue == 0);
+
+		Nz::CacheAligned<int> value = 42;
+		CHECK(value.Get() == 42);
+		*value = 7;
+		CHECK(*value == 7);
+
+		Nz::CacheAligned<std::vector<int>> vec(std::in_place, 3, 5);
+		CHECK(vec->size() == 3);
+		CHECK(vec.Get()[2] == 5);
+
+		Nz::CacheAligned<std::atomic<int>> counter(std::in_place, 3);
+		counter->fetch_add(2);
+		CHECK(counter->load() == 5);
+
+		Nz::CacheAligned<int> values[2];
+		CHECK(reinterpret_cast<std::uintptr_t>(&values[0].Get()) % Nz::CacheLineSize == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(&values[1].Get()) - reinterpret_cast<std::uintptr_t>(&values[0].Get()) == Nz::CacheLineSize);
+	}
+}
+
+SCENARIO("PerThreadArray", "[CORE][PERTHREADARRAY]")
+{
+	WHEN("Using elements by index")
+	{
+		Nz::PerThreadArray<int> array(4);
+		CHECK(array.GetSize() == 4);
+
+		for (std::size_t i = 0; i < array.GetSize(); ++i)
+		{
+			CHECK(array[i] == 0);
+			array[i] = int(i) * 10;
+			CHECK(reinterpret_cast<std::uintptr_t>(&array[i]) % Nz::CacheLineSize == 0);
+		}
+
+		int sum = 0;
+		for (int value : array)
+			sum += value;
+
+		CHECK(sum == 60);
+
+		const auto& constArray = array;
+		CHECK(constArray.Get(3) == 30);
+		CHECK(constArray.end() - constArray.begin() == 4);
+	}
+
+	WHEN("Counting from multiple threads")
+	{
+		Nz::PerThreadArray<std::atomic<unsigned int>> counters(3);
+
+		std::atomic<bool> localMismatch = false;
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < 8; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				if (&counters.GetLocal() != &counters[counters.GetLocalIndex()])
+					localMismatch = true;
+
+				for (unsigned int j = 0; j < 1000; ++j)
+					counters.GetLocal().fetch_add(1, std::memory_order_relaxed);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		unsigned int total = 0;
+		for (const auto& counter : counters)
+			total += counter.load();
+
+		CHECK(total == 8000);
+		CHECK_FALSE(localMismatch);
+	}
+}
@@ -0,0 +1,139 @@
+#include <NazaraUtils/ClockCache.hpp>
+#include <AliveCounter.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+SCENARIO("ClockCache", "[CORE][CLOCKCACHE]")
+{
+	GIVEN("A cache of three entries")
+	{
+		Nz::ClockCache<std::string, int> cache(3);
+		cache.Put("a", 1);
+		cache.Put("b", 2);
+		cache.Put("c", 3);
+		CHECK(cache.GetSize() == 3);
+		CHECK(cache.GetCost() == 3);
+
+		WHEN("Inserting a fourth entry")
+		{
+			cache.Put("d", 4);
+			CHECK(cache.GetSize() == 3);
+			CHECK_FALSE(cache.Contains("a"));
+			CHECK(cache.Contains("b"));
+			CHECK(cache.Contains("d"));
+		}
+
+		WHEN("Using an entry before inserting")
+		{
+			REQUIRE(cache.Get("a"));
+			CHECK(*cache.Get("a") == 1);
+
+			// Peek doesn't change the order
+			REQUIRE(cache.Peek("b"));
+			CHECK(*cache.Peek("b") == 2);
+
+			cache.Put("d", 4);
+			CHECK(cache.Contains("a"));
+			CHECK_FALSE(cache.Contains("b"));
+
+			cache.Put("e", 5);
+			CHECK_FALSE(cache.Contains("c"));
+			CHECK(cache.Contains("a"));
+		}
+
+		WHEN("Referenced entries get a second chance")
+		{
+			cache.Get("a");
+			cache.Put("d", 4); //< clears the referenced bit of a, evicts b
+			cache.Put("e", 5); //< evicts c
+			CHECK(cache.Contains("a"));
+			CHECK_FALSE(cache.Contains("b"));
+			CHECK_FALSE(cache.Contains("c"));
+
+			// New entries are inserted right behind the hand, which is now on d
+			cache.Put("f", 6);
+			CHECK_FALSE(cache.Contains("d"));
+			CHECK(cache.Contains("a"));
+
+			// a lost its referenced bit and is next
+			cache.Put("g", 7);
+			CHECK_FALSE(cache.Contains("a"));
+			CHECK(cache.Contains("e"));
+			CHECK(cache.Contains("f"));
+			CHECK(cache.Contains("g"));
+		}
+
+		WHEN("Replacing an entry")
+		{
+			int& value = cache.Put("a", 10);
+			CHECK(value == 10);
+			CHECK(cache.GetSize() == 3);
+			CHECK(*cache.Get("a") == 10);
+
+			cache.Put("d", 4);
+			CHECK(cache.Contains("a"));
+			CHECK_FALSE(cache.Contains("b"));
+		}
+
+		WHEN("Erasing entries")
+		{
+			CHECK(cache.Erase("b"));
+			CHECK_FALSE(cache.Erase("b"));
+			CHECK(cache.GetSize() == 2);
+			CHECK(cache.Get("b") == nullptr);
+
+			cache.Put("d", 4);
+			cache.Put("e", 5);
+			CHECK_FALSE(cache.Contains("a"));
+			CHECK(cache.Contains("c"));
+
+			cache.Clear();
+			CHECK(cache.GetSize() == 0);
+			CHECK(cache.GetCost() == 0);
+
+			cache.Put("f", 6);
+			CHECK(*cache.Get("f") == 6);
+		}
+
+		WHEN("Reducing the capacity")
+		{
+			cache.SetCapacity(1);
+			CHECK(cache.GetSize() == 1);
+			CHECK(cache.Contains("c"));
+		}
+	}
+
+	GIVEN("A cache with a capacity in bytes")
+	{
+		Nz::ClockCache<int, std::string> cache(100);
+		cache.Put(1, std::string(40, 'a'), 40);
+		cache.Put(2, std::string(40, 'b'), 40);
+		CHECK(cache.GetCost() == 80);
+
+		cache.Put(3, std::string(30, 'c'), 30);
+		CHECK(cache.GetCost() == 70);
+		CHECK_FALSE(cache.Contains(1));
+
+		// An entry bigger than the capacity evicts everything else but is kept
+		cache.Put(4, std::string(200, 'd'), 200);
+		CHECK(cache.GetSize() == 1);
+		CHECK(cache.GetCost() == 200);
+		CHECK(cache.Get(4)->size() == 200);
+	}
+
+	GIVEN("Values tracking their lifetime")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::ClockCache<int, AliveCounter> cache(4);
+			for (int i = 0; i < 100; ++i)
+				cache.Put(i, AliveCounter(&counter, i));
+
+			CHECK(counter.aliveCount == 4);
+
+			cache.Erase(99);
+			CHECK(counter.aliveCount == 3);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+}
@@ -0,0 +1,202 @@
+#include <NazaraUtils/ConcurrentMemoryPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<std::size_t> liveCount = 0;
+
+	struct Entry
+	{
+		Entry(std::size_t Owner, std::size_t Value) :
+		owner(Owner),
+		value(Value)
+		{
+			liveCount++;
+		}
+
+		Entry(const Entry&) = delete;
+		Entry(Entry&&) = delete;
+
+		~Entry()
+		{
+			liveCount--;
+		}
+
+		std::size_t owner;
+		std::size_t value;
+	};
+}
+
+SCENARIO("ConcurrentMemoryPool", "[CORE][MEMORYPOOL]")
+{
+	GIVEN("A ConcurrentMemoryPool")
+	{
+		liveCount = 0;
+
+		Nz::ConcurrentMemoryPool<Entry> memoryPool(64, 256);
+		CHECK(memoryPool.GetAllocatedEntryCount() == 0);
+		CHECK(memoryPool.GetBlockCount() == 0);
+		CHECK(memoryPool.GetBlockSize() == 64);
+		CHECK(memoryPool.GetMaxBlockCount() == 256);
+
+		WHEN("We allocate entries directly from the pool")
+		{
+			std::size_t index1, index2;
+			Entry* entry1 = memoryPool.Allocate(index1, 0, 1);
+			Entry* entry2 = memoryPool.Allocate(index2, 0, 2);
+			CHECK(index1 != index2);
+			CHECK(liveCount == 2);
+			CHECK(memoryPool.GetAllocatedEntryCount() == 2);
+			CHECK(memoryPool.GetBlockCount() == 1);
+			CHECK(memoryPool.RetrieveFromIndex(index1) == entry1);
+			CHECK(memoryPool.RetrieveFromIndex(index2) == entry2);
+			CHECK(entry2->value == 2);
+
+			memoryPool.Free(index1);
+			CHECK(liveCount == 1);
+			CHECK(memoryPool.GetAllocatedEntryCount() == 1);
+
+			THEN("Freed entries are reused")
+			{
+				std::size_t index3;
+				memoryPool.Allocate(index3, 0, 3);
+				CHECK(index3 == index1);
+				CHECK(memoryPool.GetBlockCount() == 1);
+			}
+		}
+
+		WHEN("We allocate entries through a cache")
+		{
+			std::vector<std::size_t> indices;
+			{
+				Nz::ConcurrentMemoryPool<Entry>::Cache cache(memoryPool, 16);
+				for (std::size_t i = 0; i < 100; ++i)
+					cache.Allocate(indices.emplace_back(), 0, i);
+
+				CHECK(memoryPool.GetBlockCount() == 2);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 100);
+
+				for (std::size_t i = 0; i < 100; ++i)
+				{
+					CHECK(memoryPool.RetrieveFromIndex(indices[i])->value == i);
+					cache.Free(indices[i]);
+					CHECK(cache.GetCachedEntryCount() <= 16);
+				}
+
+				CHECK(liveCount == 0);
+			}
+
+			THEN("Cached entries are returned to the pool when the cache is destroyed")
+			{
+				std::vector<std::size_t> newIndices(128);
+				for (std::size_t& index : newIndices)
+					memoryPool.Allocate(index, 0, 0);
+
+				CHECK(memoryPool.GetBlockCount() == 2);
+			}
+		}
+
+		WHEN("Multiple threads allocate and free entries concurrently")
+		{
+			constexpr std::size_t threadCount = 4;
+			constexpr std::size_t entryPerThread = 2000;
+
+			std::vector<std::vector<std::size_t>> threadIndices(threadCount);
+			std::atomic_bool corrupted = false;
+
+			auto Allocate = [&](std::size_t threadIndex)
+			{
+				Nz::ConcurrentMemoryPool<Entry>::Cache cache(memoryPool);
+
+				auto& indices = threadIndices[threadIndex];
+				for (std::size_t i = 0; i < entryPerThread; ++i)
+				{
+					indices.push_back(0);
+					cache.Allocate(indices.back(), threadIndex, i);
+
+					// Free some entries right away to exercise the shared free list
+					if (i % 3 == 0)
+					{
+						cache.Free(indices.back());
+						indices.pop_back();
+					}
+				}
+
+				for (std::size_t i = 0; i < indices.size(); ++i)
+				{
+					const Entry* entry = memoryPool.RetrieveFromIndex(indices[i]);
+					if (entry->owner != threadIndex)
+						corrupted = true;
+				}
+			};
+
+			std::vector<std::thread> threads;
+			for (std::size_t i = 0; i < threadCount; ++i)
+				threads.emplace_back(Allocate, i);
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			CHECK_FALSE(corrupted);
+
+			std::size_t allocatedCount = 0;
+			for (auto& indices : threadIndices)
+				allocatedCount += indices.size();
+
+			CHECK(liveCount == allocatedCount);
+			CHECK(memoryPool.GetAllocatedEntryCount() == allocatedCount);
+
+			std::vector<std::size_t> allIndices;
+			for (auto& indices : threadIndices)
+				allIndices.insert(allIndices.end(), indices.begin(), indices.end());
+
+			std::sort(allIndices.begin(), allIndices.end());
+			CHECK(std::adjacent_find(allIndices.begin(), allIndices.end()) == allIndices.end());
+
+			AND_WHEN("Entries are freed by other threads")
+			{
+				threads.clear();
+				for (std::size_t i = 0; i < threadCount; ++i)
+				{
+					threads.emplace_back([&, i]
+					{
+						Nz::ConcurrentMemoryPool<Entry>::Cache cache(memoryPool);
+						for (std::size_t index : threadIndices[(i + 1) % threadCount])
+							cache.Free(index);
+					});
+				}
+
+				for (std::thread& thread : threads)
+					thread.join();
+
+				CHECK(liveCount == 0);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 0);
+			}
+		}
+	}
+
+	GIVEN("A ConcurrentMemoryPool with over-aligned entries")
+	{
+		Nz::ConcurrentMemoryPool<Nz::UInt32, 128> memoryPool(3);
+
+		std::vector<std::size_t> indices;
+		for (std::size_t i = 0; i < 10; ++i)
+		{
+			std::size_t index;
+			Nz::UInt32* entry = memoryPool.Allocate(index, Nz::UInt32(i));
+			CHECK(reinterpret_cast<std::uintptr_t>(entry) % 128 == 0);
+
+			indices.push_back(index);
+		}
+
+		for (std::size_t index : indices)
+			memoryPool.Free(index);
+	}
+
+	CHECK(liveCount == 0);
+}
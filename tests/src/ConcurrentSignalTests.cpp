@@ -0,0 +1,166 @@
+#include <NazaraUtils/ConcurrentSignal.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct Counter
+	{
+		void Increment(int value) { total += value; }
+
+		std::atomic_int total = 0;
+	};
+}
+
+SCENARIO("ConcurrentSignal", "[CORE][CONCURRENTSIGNAL]")
+{
+	GIVEN("A signal")
+	{
+		Nz::ConcurrentSignal<int> signal;
+		CHECK(signal.GetSlotCount() == 0);
+		signal(42); //< no slot
+
+		Counter counter;
+		int lambdaTotal = 0;
+
+		Nz::ConcurrentSignal<int>::Connection memberConnection = signal.Connect(counter, &Counter::Increment);
+		Nz::ConcurrentSignal<int>::Connection lambdaConnection = signal.Connect([&](int value) { lambdaTotal += value; });
+		CHECK(signal.GetSlotCount() == 2);
+		CHECK(memberConnection.IsConnected());
+		CHECK(lambdaConnection.IsConnected());
+
+		signal(2);
+		CHECK(counter.total == 2);
+		CHECK(lambdaTotal == 2);
+
+		WHEN("We disconnect a slot")
+		{
+			memberConnection.Disconnect();
+			CHECK_FALSE(memberConnection.IsConnected());
+			CHECK(signal.GetSlotCount() == 1);
+
+			memberConnection.Disconnect(); //< no-op
+
+			signal(3);
+			CHECK(counter.total == 2);
+			CHECK(lambdaTotal == 5);
+		}
+
+		WHEN("We clear the signal")
+		{
+			signal.Clear();
+			CHECK_FALSE(memberConnection.IsConnected());
+			CHECK_FALSE(lambdaConnection.IsConnected());
+			CHECK(signal.GetSlotCount() == 0);
+
+			signal(3);
+			CHECK(counter.total == 2);
+		}
+
+		WHEN("We move the signal")
+		{
+			Nz::ConcurrentSignal<int> movedSignal(std::move(signal));
+			CHECK(memberConnection.IsConnected());
+
+			movedSignal(1);
+			CHECK(counter.total == 3);
+
+			memberConnection.Disconnect();
+			CHECK(movedSignal.GetSlotCount() == 1);
+		}
+
+		WHEN("The signal is destroyed before its connections")
+		{
+			{
+				Nz::ConcurrentSignal<int> otherSignal;
+				memberConnection = otherSignal.Connect(counter, &Counter::Increment);
+				CHECK(memberConnection.IsConnected());
+			}
+
+			CHECK_FALSE(memberConnection.IsConnected());
+			memberConnection.Disconnect();
+		}
+
+		WHEN("We use a connection guard")
+		{
+			{
+				Nz::ConcurrentSignal<int>::ConnectionGuard guard = signal.Connect(counter, &Counter::Increment);
+				CHECK(signal.GetSlotCount() == 3);
+			}
+
+			CHECK(signal.GetSlotCount() == 2);
+		}
+
+		WHEN("Slots are modified during emission")
+		{
+			Nz::ConcurrentSignal<int>::Connection selfConnection;
+			Nz::ConcurrentSignal<int>::Connection newConnection;
+			int newSlotCallCount = 0;
+			int selfCallCount = 0;
+			selfConnection = signal.Connect([&](int)
+			{
+				selfCallCount++;
+				selfConnection.Disconnect();
+				lambdaConnection.Disconnect();
+				newConnection = signal.Connect([&](int) { newSlotCallCount++; });
+
+				// Recursive emission
+				signal(10);
+			});
+
+			signal(1);
+			CHECK(selfCallCount == 1);
+			CHECK(newSlotCallCount == 1); //< called by the recursive emission only
+			CHECK(lambdaTotal == 3); //< not called by the recursive emission
+			CHECK(counter.total == 13); //< called by both emissions
+
+			signal(1);
+			CHECK(selfCallCount == 1);
+			CHECK(newSlotCallCount == 2);
+			CHECK(counter.total == 14);
+		}
+	}
+
+	GIVEN("A signal used by multiple threads")
+	{
+		Nz::ConcurrentSignal<int> signal;
+
+		std::atomic_int total = 0;
+		Nz::ConcurrentSignal<int>::Connection permanentConnection = signal.Connect([&](int value) { total += value; });
+
+		constexpr int emitterCount = 4;
+		constexpr int emissionCount = 10'000;
+
+		std::atomic_bool running = true;
+		std::thread writer([&]
+		{
+			std::atomic_int churnTotal = 0;
+			while (running)
+			{
+				Nz::ConcurrentSignal<int>::ConnectionGuard guard = signal.Connect([&](int value) { churnTotal += value; });
+				signal.Connect([](int) {}).Disconnect();
+			}
+		});
+
+		std::vector<std::thread> emitters;
+		for (int i = 0; i < emitterCount; ++i)
+		{
+			emitters.emplace_back([&]
+			{
+				for (int j = 0; j < emissionCount; ++j)
+					signal(1);
+			});
+		}
+
+		for (std::thread& emitter : emitters)
+			emitter.join();
+
+		running = false;
+		writer.join();
+
+		CHECK(total == emitterCount * emissionCount);
+		CHECK(signal.GetSlotCount() == 1);
+	}
+}
@@ -0,0 +1,97 @@
+#include <NazaraUtils/CpuFeatures.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace
+{
+	std::atomic<int> selectedKernel = -1;
+
+	int SumScalar(const int* values, std::size_t count)
+	{
+		selectedKernel = 0;
+
+		int sum = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			sum += values[i];
+
+		return sum;
+	}
+
+	int SumFast(const int* values, std::size_t count)
+	{
+		selectedKernel = 1;
+
+		int sum = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			sum += values[i];
+
+		return sum;
+	}
+
+	constexpr auto SelectSum(const Nz::CpuFeatures& features)
+	{
+		return (features.avx2 || features.neon) ? &SumFast : &SumScalar;
+	}
+
+	constexpr auto SelectScalarSum(const Nz::CpuFeatures& /*features*/)
+	{
+		return &SumScalar;
+	}
+}
+
+SCENARIO("CpuFeatures", "[CORE][CPUFEATURES]")
+{
+	WHEN("Querying CPU features")
+	{
+		const Nz::CpuFeatures& features = Nz::GetCpuFeatures();
+		CHECK(&features == &Nz::GetCpuFeatures());
+
+		// Compile-time features are always reported
+		constexpr Nz::CpuFeatures compileTimeFeatures = Nz::GetCompileTimeCpuFeatures();
+		CHECK((!compileTimeFeatures.sse2 || features.sse2));
+		CHECK((!compileTimeFeatures.ssse3 || features.ssse3));
+		CHECK((!compileTimeFeatures.avx || features.avx));
+		CHECK((!compileTimeFeatures.avx2 || features.avx2));
+		CHECK((!compileTimeFeatures.neon || features.neon));
+		CHECK((!compileTimeFeatures.crc32 || features.crc32));
+
+		// Extensions imply the previous ones
+		CHECK((!features.avx2 || features.avx));
+		CHECK((!features.avx512bw || features.avx512f));
+		CHECK((!features.avx512f || features.avx));
+		CHECK((!features.sse42 || features.sse41));
+
+#if defined(NAZARA_ARCH_x86_64)
+		CHECK(features.sse2);
+#elif defined(NAZARA_ARCH_aarch64)
+		CHECK(features.neon);
+#endif
+	}
+
+	WHEN("Dispatching a function")
+	{
+		using SumDispatch = Nz::CpuDispatch<int(const int*, std::size_t), &SelectSum>;
+
+		int values[] = { 1, 2, 3, 4, 5 };
+		CHECK(SumDispatch::Call(values, 5) == 15);
+
+		int expectedKernel = (SelectSum(Nz::GetCpuFeatures()) == &SumFast) ? 1 : 0;
+		CHECK(selectedKernel == expectedKernel);
+		CHECK(SumDispatch::GetFunction() == SelectSum(Nz::GetCpuFeatures()));
+
+		selectedKernel = -1;
+		CHECK(SumDispatch::Call(values, 3) == 6);
+		CHECK(selectedKernel == expectedKernel);
+	}
+
+	WHEN("Dispatching a function whose best kernel is known at compile-time")
+	{
+		using ScalarSumDispatch = Nz::CpuDispatch<int(const int*, std::size_t), &SelectScalarSum>;
+		static_assert(ScalarSumDispatch::IsStatic());
+
+		int values[] = { 1, 2, 3 };
+		CHECK(ScalarSumDispatch::Call(values, 3) == 6);
+		CHECK(ScalarSumDispatch::GetFunction() == &SumScalar);
+	}
+}
@@ -0,0 +1,106 @@
+#include <NazaraUtils/CuckooFilter.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+SCENARIO("CuckooFilter", "[CORE][CUCKOOFILTER]")
+{
+	constexpr std::size_t KeyCount = 10'000;
+
+	Nz::CuckooFilter<std::size_t> filter(KeyCount);
+	CHECK(filter.GetCapacity() >= KeyCount);
+	CHECK(filter.GetSize() == 0);
+	CHECK_FALSE(filter.MayContain(42));
+
+	bool allInserted = true;
+	for (std::size_t i = 0; i < KeyCount; ++i)
+		allInserted &= filter.Insert(i * 2);
+
+	CHECK(allInserted);
+	CHECK(filter.GetSize() == KeyCount);
+
+	WHEN("Looking up keys")
+	{
+		bool noFalseNegative = true;
+		for (std::size_t i = 0; i < KeyCount; ++i)
+			noFalseNegative &= filter.MayContain(i * 2);
+
+		CHECK(noFalseNegative);
+
+		std::size_t falsePositiveCount = 0;
+		for (std::size_t i = 0; i < KeyCount; ++i)
+		{
+			if (filter.MayContain(i * 2 + 1))
+				falsePositiveCount++;
+		}
+
+		CHECK(falsePositiveCount < KeyCount / 1000);
+	}
+
+	WHEN("Removing keys")
+	{
+		bool allRemoved = true;
+		for (std::size_t i = 0; i < KeyCount; i += 2)
+			allRemoved &= filter.Remove(i * 2);
+
+		CHECK(allRemoved);
+		CHECK(filter.GetSize() == KeyCount / 2);
+
+		bool remainingFound = true;
+		std::size_t removedFound = 0;
+		for (std::size_t i = 0; i < KeyCount; ++i)
+		{
+			if (i % 2 == 1)
+				remainingFound &= filter.MayContain(i * 2);
+			else if (filter.MayContain(i * 2))
+				removedFound++;
+		}
+
+		CHECK(remainingFound);
+		CHECK(removedFound < KeyCount / 1000);
+
+		filter.Clear();
+		CHECK(filter.GetSize() == 0);
+		CHECK_FALSE(filter.MayContain(2));
+	}
+
+	WHEN("Filling the filter")
+	{
+		Nz::CuckooFilter<std::size_t> smallFilter(16);
+
+		std::size_t insertedCount = 0;
+		while (smallFilter.Insert(insertedCount))
+			insertedCount++;
+
+		CHECK(insertedCount >= smallFilter.GetCapacity() / 2);
+		CHECK(insertedCount <= smallFilter.GetCapacity() + 1);
+		CHECK(smallFilter.GetSize() == insertedCount);
+
+		// Every inserted key (including the one put aside) is still found
+		bool noFalseNegative = true;
+		for (std::size_t i = 0; i < insertedCount; ++i)
+			noFalseNegative &= smallFilter.MayContain(i);
+
+		CHECK(noFalseNegative);
+
+		CHECK(smallFilter.Remove(0));
+		CHECK(smallFilter.Insert(insertedCount));
+		CHECK(smallFilter.GetSize() == insertedCount);
+	}
+
+	WHEN("Merging filters")
+	{
+		Nz::CuckooFilter<std::string> first(64);
+		Nz::CuckooFilter<std::string> second(64);
+		first.Insert("sword");
+		second.Insert("shield");
+		CHECK_FALSE(first.MayContain("shield"));
+
+		CHECK(first.Merge(second));
+		CHECK(first.GetSize() == 2);
+		CHECK(first.MayContain("sword"));
+		CHECK(first.MayContain("shield"));
+
+		CHECK(first.Remove("shield"));
+		CHECK_FALSE(first.MayContain("shield"));
+	}
+}
@@ -0,0 +1,78 @@
+#include <NazaraUtils/EndianValue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+
+static_assert(std::is_trivially_copyable_v<Nz::BigEndian<Nz::UInt32>>);
+static_assert(std::is_trivially_copyable_v<Nz::UnalignedLittleEndian<Nz::UInt64>>);
+static_assert(sizeof(Nz::BigEndian<Nz::UInt32>) == 4 && alignof(Nz::BigEndian<Nz::UInt32>) == 4);
+static_assert(sizeof(Nz::UnalignedBigEndian<Nz::UInt64>) == 8 && alignof(Nz::UnalignedBigEndian<Nz::UInt64>) == 1);
+static_assert(Nz::BigEndian<Nz::UInt32>(0xDEADBEEF) == 0xDEADBEEF);
+static_assert(Nz::LittleEndian<Nz::Int16>(-42).Get() == -42);
+
+namespace
+{
+	struct FileHeader
+	{
+		std::array<char, 4> magic;
+		Nz::BigEndian<Nz::UInt32> version;
+		Nz::LittleEndian<Nz::UInt16> flags;
+		Nz::BigEndian<Nz::Int16> offset;
+	};
+
+	struct PackedRecord
+	{
+		Nz::UInt8 tag;
+		Nz::UnalignedBigEndian<Nz::UInt32> size;
+		Nz::UnalignedLittleEndian<double> scale;
+	};
+
+	static_assert(sizeof(FileHeader) == 12);
+	static_assert(sizeof(PackedRecord) == 13);
+}
+
+SCENARIO("EndianValue", "[CORE][ENDIANVALUE]")
+{
+	GIVEN("A memory-mapped file header")
+	{
+		alignas(FileHeader) const Nz::UInt8 data[] = {
+			'N', 'Z', 'F', 'H',
+			0x00, 0x01, 0x02, 0x03,
+			0x34, 0x12,
+			0xFF, 0xFE
+		};
+
+		const FileHeader* header = reinterpret_cast<const FileHeader*>(data);
+		CHECK(std::memcmp(header->magic.data(), "NZFH", 4) == 0);
+		CHECK(header->version == 0x00010203);
+		CHECK(header->flags == 0x1234);
+		CHECK(header->offset == -2);
+	}
+
+	GIVEN("A packed record")
+	{
+		PackedRecord record;
+		record.tag = 7;
+		record.size = 0x11223344;
+		record.scale = 0.75;
+
+		Nz::UInt8 bytes[sizeof(PackedRecord)];
+		std::memcpy(bytes, &record, sizeof(record));
+
+		CHECK(bytes[0] == 7);
+		CHECK(bytes[1] == 0x11);
+		CHECK(bytes[2] == 0x22);
+		CHECK(bytes[3] == 0x33);
+		CHECK(bytes[4] == 0x44);
+
+		double storedScale;
+		std::memcpy(&storedScale, &bytes[5], sizeof(double));
+		CHECK(Nz::LittleEndianToHost(storedScale) == 0.75);
+
+		CHECK(record.size.Get() == 0x11223344);
+		CHECK(record.scale == 0.75);
+
+		record.size = record.size + 1;
+		CHECK(record.size == 0x11223345);
+	}
+}
@@ -1,4 +1,9 @@
 #include <NazaraUtils/Endianness.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <vector>
 
 static_assert(Nz::PlatformEndianness == Nz::Endianness::BigEndian || Nz::PlatformEndianness == Nz::Endianness::LittleEndian);
 
@@ -28,4 +33,84 @@ static_assert(Nz::BigEndianToHost(std::uint64_t(0xABCDEF0102030405)) == std::uin
 static_assert(Nz::LittleEndianToHost(std::uint16_t(0xABCD)) == std::uint16_t(0xABCD));
 static_assert(Nz::LittleEndianToHost(std::uint32_t(0xABCDEF01)) == std::uint32_t(0xABCDEF01));
 static_assert(Nz::LittleEndianToHost(std::uint64_t(0xABCDEF0102030405)) == std::uint64_t(0xABCDEF0102030405));
-#endif
\ No newline at end of file
+#endif
+template<typename T>
+std::vector<T> GenerateValues(std::size_t count)
+{
+	std::vector<T> values(count);
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = static_cast<T>(0x0102030405060708ULL * (i + 1));
+
+	return values;
+}
+
+// Compares bit patterns (byte-swapped floats may be NaNs), memcmp can't be given the null data pointer of empty vectors
+template<typename T>
+bool HasSameBytes(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+	assert(lhs.size() == rhs.size());
+	return lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+}
+
+template<typename TestType>
+void CheckByteSwapArray()
+{
+	// sizes around SIMD block sizes and dispatch threshold
+	for (std::size_t count : { 0, 1, 3, 7, 8, 15, 16, 17, 33, 64, 100, 1000 })
+	{
+		std::vector<TestType> values = GenerateValues<TestType>(count);
+
+		std::vector<TestType> expected(count);
+		for (std::size_t i = 0; i < count; ++i)
+			expected[i] = Nz::ByteSwap(values[i]);
+
+		std::vector<TestType> swapped(count);
+		Nz::ByteSwapArray(values.data(), swapped.data(), count);
+		CHECK(HasSameBytes(swapped, expected));
+
+		Nz::ByteSwapArray(values.data(), count);
+		CHECK(HasSameBytes(values, expected));
+
+		std::vector<TestType> bigEndian(count);
+		Nz::HostToBigEndian(values.data(), bigEndian.data(), count);
+		std::vector<TestType> host(count);
+		Nz::BigEndianToHost(bigEndian.data(), host.data(), count);
+		CHECK(HasSameBytes(host, values));
+
+		std::vector<TestType> littleEndian(count);
+		Nz::HostToLittleEndian(values.data(), littleEndian.data(), count);
+		Nz::LittleEndianToHost(littleEndian.data(), littleEndian.data(), count);
+		CHECK(HasSameBytes(littleEndian, values));
+
+		for (std::size_t i = 0; i < count; ++i)
+			expected[i] = Nz::HostToBigEndian(values[i]);
+
+		CHECK(HasSameBytes(bigEndian, expected));
+	}
+}
+
+SCENARIO("ByteSwapArray", "[CORE][ENDIANNESS]")
+{
+	CheckByteSwapArray<Nz::UInt16>();
+	CheckByteSwapArray<Nz::UInt32>();
+	CheckByteSwapArray<Nz::UInt64>();
+	CheckByteSwapArray<Nz::Int32>();
+	CheckByteSwapArray<float>();
+	CheckByteSwapArray<double>();
+
+	struct RGB
+	{
+		Nz::UInt8 r, g, b;
+	};
+
+	std::array<RGB, 3> colors = { RGB{ 1, 2, 3 }, RGB{ 4, 5, 6 }, RGB{ 7, 8, 9 } };
+	Nz::ByteSwapArray(colors.data(), colors.size());
+	CHECK(colors[0].r == 3);
+	CHECK(colors[0].b == 1);
+	CHECK(colors[2].r == 9);
+
+	std::array<Nz::UInt8, 3> bytes = { 1, 2, 3 };
+	std::array<Nz::UInt8, 3> copy;
+	Nz::ByteSwapArray(bytes.data(), copy.data(), bytes.size());
+	CHECK(copy == bytes);
+}
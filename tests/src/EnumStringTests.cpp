@@ -0,0 +1,102 @@
+#include <NazaraUtils/EnumString.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+enum class Fruit
+{
+	Apple,
+	Banana,
+	Cherry,
+
+	Max = Cherry
+};
+
+enum class Keyword : Nz::UInt8
+{
+	Alignas, Alignof, And, Asm, Auto, Bool, Break, Case, Catch, Char, Class, Const, Constexpr, Continue,
+	Decltype, Default, Delete, Do, Double, Else, Enum, Explicit, Export, Extern, False, Float, For, Friend,
+	Goto, If, Inline, Int, Long, Mutable, Namespace, New, Noexcept, Nullptr, Operator, Private, Protected,
+	Public, Return, Short, Signed, Sizeof, Static, Struct, Switch, Template, This, Throw, True, Try, Typedef,
+	Typename, Union, Unsigned, Using, Virtual, Void, Volatile, While,
+
+	Max = While
+};
+
+template<>
+struct Nz::EnumNames<Fruit>
+{
+	static constexpr std::string_view names[] = { "Apple", "Banana", "Cherry" };
+};
+
+template<>
+struct Nz::EnumNames<Keyword>
+{
+	static constexpr std::string_view names[] = {
+		"alignas", "alignof", "and", "asm", "auto", "bool", "break", "case", "catch", "char", "class", "const", "constexpr", "continue",
+		"decltype", "default", "delete", "do", "double", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend",
+		"goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "nullptr", "operator", "private", "protected",
+		"public", "return", "short", "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "try", "typedef",
+		"typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while"
+	};
+};
+
+static_assert(Nz::EnumFromString<Fruit>("Banana") == Fruit::Banana);
+static_assert(!Nz::EnumFromString<Fruit>("banana"));
+static_assert(Nz::EnumToString(Fruit::Cherry) == "Cherry");
+static_assert(Nz::EnumFromString<Keyword>("constexpr") == Keyword::Constexpr);
+
+template<typename E>
+void TestEnumRoundTrip()
+{
+	constexpr std::size_t count = Nz::EnumValueCount_v<E>;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		E value = static_cast<E>(i);
+		std::string_view name = Nz::EnumToString(value);
+		CHECK(!name.empty());
+
+		std::optional<E> parsed = Nz::EnumFromString<E>(name);
+		REQUIRE(parsed);
+		CHECK(*parsed == value);
+
+		// Views which are not null-terminated nor part of the table must work the same
+		std::string copy(name);
+		CHECK(Nz::EnumFromString<E>(copy) == value);
+
+		CHECK_FALSE(Nz::EnumFromString<E>(name.substr(0, name.size() - 1)));
+		CHECK_FALSE(Nz::EnumFromString<E>(copy + "_"));
+	}
+}
+
+SCENARIO("EnumString", "[EnumString]")
+{
+	WHEN("Converting every value back and forth")
+	{
+		TestEnumRoundTrip<Fruit>();
+		TestEnumRoundTrip<Keyword>();
+	}
+
+	WHEN("Looking up unknown names")
+	{
+		CHECK_FALSE(Nz::EnumFromString<Fruit>(""));
+		CHECK_FALSE(Nz::EnumFromString<Fruit>("Durian"));
+		CHECK_FALSE(Nz::EnumFromString<Fruit>("APPLE"));
+		CHECK_FALSE(Nz::EnumFromString<Keyword>("Class"));
+		CHECK_FALSE(Nz::EnumFromString<Keyword>("char8_t"));
+		CHECK_FALSE(Nz::EnumFromString<Keyword>("whileApple"));
+
+		// Every one-letter string
+		for (int c = 0; c < 256; ++c)
+		{
+			char str = static_cast<char>(c);
+			CHECK_FALSE(Nz::EnumFromString<Keyword>(std::string_view(&str, 1)));
+		}
+	}
+
+	WHEN("Converting values out of range")
+	{
+		CHECK(Nz::EnumToString(static_cast<Fruit>(3)).empty());
+		CHECK(Nz::EnumToString(static_cast<Fruit>(-1)).empty());
+		CHECK(Nz::EnumToString(static_cast<Keyword>(200)).empty());
+	}
+}
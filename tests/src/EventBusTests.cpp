@@ -0,0 +1,141 @@
+#include <NazaraUtils/EventBus.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct DamageEvent
+	{
+		int amount;
+	};
+
+	struct MessageEvent
+	{
+		std::string message;
+	};
+
+	struct UnhandledEvent {};
+
+	struct Listener
+	{
+		void OnDamage(const DamageEvent& event)
+		{
+			totalDamage += event.amount;
+		}
+
+		int totalDamage = 0;
+	};
+
+	using Bus = Nz::EventBus<Nz::TypeList<DamageEvent, MessageEvent>>;
+}
+
+static_assert(Bus::Handles<DamageEvent>());
+static_assert(Bus::Handles<MessageEvent>());
+static_assert(!Bus::Handles<UnhandledEvent>());
+
+SCENARIO("EventBus", "[CORE][SIGNAL]")
+{
+	GIVEN("A bus with handlers")
+	{
+		Bus bus;
+
+		Listener listener;
+		Bus::ConnectionGuard<DamageEvent> damageGuard = bus.Connect<DamageEvent>(listener, &Listener::OnDamage);
+
+		std::vector<std::string> messages;
+		Bus::ConnectionGuard<MessageEvent> messageGuard = bus.Connect<MessageEvent>([&](const MessageEvent& event)
+		{
+			messages.push_back(event.message);
+		});
+
+		WHEN("Publishing events")
+		{
+			bus.Publish(DamageEvent{ 10 });
+			bus.Publish(DamageEvent{ 5 });
+			bus.Publish(MessageEvent{ "hello" });
+
+			CHECK(listener.totalDamage == 15);
+			CHECK(messages == std::vector<std::string>{ "hello" });
+			CHECK(bus.GetPendingCount() == 0);
+		}
+
+		WHEN("Disconnecting a handler")
+		{
+			damageGuard.Disconnect();
+			bus.Publish(DamageEvent{ 10 });
+			CHECK(listener.totalDamage == 0);
+
+			bus.GetSignal<DamageEvent>().Connect(listener, &Listener::OnDamage);
+			bus.Publish(DamageEvent{ 3 });
+			CHECK(listener.totalDamage == 3);
+		}
+
+		WHEN("Queuing events")
+		{
+			bus.Reserve<DamageEvent>(8);
+			bus.Enqueue<DamageEvent>(DamageEvent{ 10 });
+			bus.Enqueue<MessageEvent>(MessageEvent{ "a" });
+			bus.Enqueue<DamageEvent>(DamageEvent{ 20 });
+			bus.Enqueue<MessageEvent>(MessageEvent{ "b" });
+			CHECK(listener.totalDamage == 0);
+			CHECK(messages.empty());
+			CHECK(bus.GetPendingCount<DamageEvent>() == 2);
+			CHECK(bus.GetPendingCount() == 4);
+
+			AND_WHEN("Flushing one event type")
+			{
+				bus.Flush<MessageEvent>();
+				CHECK(messages == std::vector<std::string>{ "a", "b" });
+				CHECK(listener.totalDamage == 0);
+				CHECK(bus.GetPendingCount() == 2);
+			}
+
+			AND_WHEN("Flushing every event type")
+			{
+				bus.Flush();
+				CHECK(listener.totalDamage == 30);
+				CHECK(messages == std::vector<std::string>{ "a", "b" });
+				CHECK(bus.GetPendingCount() == 0);
+
+				bus.Flush();
+				CHECK(listener.totalDamage == 30);
+			}
+
+			AND_WHEN("Clearing queued events")
+			{
+				bus.Clear<DamageEvent>();
+				CHECK(bus.GetPendingCount() == 2);
+
+				bus.Clear();
+				bus.Flush();
+				CHECK(listener.totalDamage == 0);
+				CHECK(messages.empty());
+			}
+		}
+
+		WHEN("A handler queues events during a flush")
+		{
+			Bus::ConnectionGuard<DamageEvent> chainGuard = bus.Connect<DamageEvent>([&](const DamageEvent& event)
+			{
+				if (event.amount > 1)
+					bus.Enqueue<DamageEvent>(DamageEvent{ event.amount / 2 });
+
+				bus.Enqueue<MessageEvent>(MessageEvent{ std::to_string(event.amount) });
+				bus.Flush<DamageEvent>(); //< does nothing
+			});
+
+			bus.Enqueue<DamageEvent>(DamageEvent{ 4 });
+			bus.Flush();
+			CHECK(listener.totalDamage == 4);
+			CHECK(messages == std::vector<std::string>{ "4" }); //< MessageEvent comes after DamageEvent in the list
+			CHECK(bus.GetPendingCount() == 1);
+
+			bus.Flush();
+			bus.Flush();
+			CHECK(listener.totalDamage == 7);
+			CHECK(messages == std::vector<std::string>{ "4", "2", "1" });
+			CHECK(bus.GetPendingCount() == 0);
+		}
+	}
+}
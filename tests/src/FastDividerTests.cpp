@@ -0,0 +1,87 @@
+#include <NazaraUtils/FastDivider.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+static_assert(Nz::FastDivider<Nz::UInt32>(7).Divide(100) == 14);
+static_assert(Nz::FastDivider<Nz::UInt32>(7).Mod(100) == 2);
+static_assert(Nz::FastDivider<Nz::UInt64>(1000).Divide(123456789) == 123456);
+static_assert(Nz::FastDivider<Nz::UInt64>(64).DivMod(130).second == 2);
+
+template<typename T>
+bool CheckFastDivider(T divisor, std::minstd_rand& gen)
+{
+	std::uniform_int_distribution<T> dis(0, std::numeric_limits<T>::max());
+
+	Nz::FastDivider<T> divider(divisor);
+	if (divider.GetDivisor() != divisor)
+		return false;
+
+	auto check = [&](T value)
+	{
+		auto [quotient, remainder] = divider.DivMod(value);
+		return divider.Divide(value) == value / divisor && divider.Mod(value) == value % divisor && quotient == value / divisor && remainder == value % divisor;
+	};
+
+	for (T value : { T(0), T(1), T(divisor - 1), divisor, T(divisor + 1), T(divisor * 2), T(std::numeric_limits<T>::max() - 1), std::numeric_limits<T>::max() })
+	{
+		if (!check(value))
+			return false;
+	}
+
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		if (!check(dis(gen)))
+			return false;
+	}
+
+	return true;
+}
+
+template<typename T>
+void TestFastDivider()
+{
+	std::minstd_rand gen(1337);
+	std::uniform_int_distribution<T> dis(1, std::numeric_limits<T>::max());
+
+	std::vector<T> divisors = { 1, 2, 3, 5, 6, 7, 10, 11, 13, 25, 100, 641, 1000, 4096, 6700417, std::numeric_limits<T>::max(), T(std::numeric_limits<T>::max() - 1), T(std::numeric_limits<T>::max() / 2), T(std::numeric_limits<T>::max() / 3) };
+	for (std::size_t i = 1; i < Nz::BitCount<T>(); ++i)
+	{
+		divisors.push_back(T(T(1) << i));
+		divisors.push_back(T((T(1) << i) - 1));
+		divisors.push_back(T((T(1) << i) + 1));
+	}
+
+	for (std::size_t i = 0; i < 200; ++i)
+	{
+		divisors.push_back(dis(gen));
+		divisors.push_back(dis(gen) >> (i % Nz::BitCount<T>()) | 1);
+	}
+
+	bool valid = true;
+	for (T divisor : divisors)
+	{
+		if (!CheckFastDivider(divisor, gen))
+		{
+			INFO("divisor: " << divisor);
+			CHECK(false);
+			valid = false;
+		}
+	}
+
+	CHECK(valid);
+}
+
+SCENARIO("FastDivider", "[CORE][FASTDIVIDER]")
+{
+	WHEN("Dividing 32-bit integers")
+	{
+		TestFastDivider<Nz::UInt32>();
+	}
+
+	WHEN("Dividing 64-bit integers")
+	{
+		TestFastDivider<Nz::UInt64>();
+	}
+}
@@ -0,0 +1,130 @@
+#include <NazaraUtils/FixedFunction.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	struct Foo
+	{
+		int Bar() { return m_value; }
+
+		int m_value;
+	};
+
+	struct LifetimeCounter
+	{
+		LifetimeCounter(int& counter) :
+		m_counter(&counter)
+		{
+			++*m_counter;
+		}
+
+		LifetimeCounter(LifetimeCounter&& lifetimeCounter) noexcept :
+		m_counter(lifetimeCounter.m_counter)
+		{
+			++*m_counter;
+		}
+
+		~LifetimeCounter()
+		{
+			--*m_counter;
+		}
+
+		int operator()() const { return *m_counter; }
+
+		int* m_counter;
+	};
+
+	int FuncCall()
+	{
+		return 47;
+	}
+
+	using SmallFunction = Nz::FixedFunction<int(), sizeof(void*)>;
+
+	static_assert(!std::is_copy_constructible_v<Nz::FixedFunction<void()>>);
+	static_assert(std::is_nothrow_move_constructible_v<Nz::FixedFunction<void()>>);
+	static_assert(SmallFunction::CanStore<int(*)()>());
+	static_assert(!SmallFunction::CanStore<std::array<void*, 2>>());
+}
+
+SCENARIO("FixedFunction", "[FixedFunction]")
+{
+	GIVEN("Empty functions")
+	{
+		Nz::FixedFunction<int()> func;
+		CHECK_FALSE(func);
+
+		Nz::FixedFunction<int()> nullFunc(nullptr);
+		CHECK_FALSE(nullFunc);
+
+		int (*nullPtr)() = nullptr;
+		Nz::FixedFunction<int()> nullPtrFunc(nullPtr);
+		CHECK_FALSE(nullPtrFunc);
+
+		Nz::FixedFunction<int()> moved(std::move(func));
+		CHECK_FALSE(moved);
+	}
+
+	GIVEN("Various callables")
+	{
+		Nz::FixedFunction<int()> func = FuncCall;
+		CHECK(func);
+		CHECK(func() == 47);
+
+		func = [] { return 1337; };
+		CHECK(func() == 1337);
+
+		Foo foo{ 42 };
+		Nz::FixedFunction<int(Foo*)> method = &Foo::Bar;
+		CHECK(method(&foo) == 42);
+
+		int value = 0;
+		Nz::FixedFunction<void(int)> adder = [&value](int v) { value += v; };
+		adder(5);
+		adder(6);
+		CHECK(value == 11);
+
+		func = nullptr;
+		CHECK_FALSE(func);
+	}
+
+	GIVEN("A move-only callable")
+	{
+		Nz::FixedFunction<int(int)> func = [ptr = std::make_unique<int>(10)](int v) { return *ptr + v; };
+		CHECK(func(5) == 15);
+
+		Nz::FixedFunction<int(int)> moved = std::move(func);
+		CHECK_FALSE(func);
+		CHECK(moved(1) == 11);
+
+		Nz::FixedFunction<std::unique_ptr<int>(std::unique_ptr<int>)> passThrough = [](std::unique_ptr<int> ptr) { return ptr; };
+		CHECK(*passThrough(std::make_unique<int>(7)) == 7);
+	}
+
+	GIVEN("A callable with a lifetime")
+	{
+		int counter = 0;
+		{
+			Nz::FixedFunction<int()> func = LifetimeCounter(counter);
+			CHECK(counter == 1);
+			CHECK(func() == 1);
+
+			Nz::FixedFunction<int()> moved = std::move(func);
+			CHECK(counter == 1);
+			CHECK(moved() == 1);
+
+			std::vector<Nz::FixedFunction<int()>> functions;
+			for (int i = 0; i < 10; ++i)
+				functions.emplace_back(LifetimeCounter(counter));
+
+			CHECK(counter == 11);
+
+			moved = nullptr;
+			CHECK(counter == 10);
+		}
+		CHECK(counter == 0);
+	}
+}
@@ -1,13 +1,45 @@
 #include "AliveCounter.hpp"
+#include "CopyCounter.hpp"
 #include <NazaraUtils/FixedVector.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <NazaraUtils/MovableValue.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <array>
+#include <iterator>
+#include <list>
 #include <numeric>
+#include <sstream>
+#include <vector>
 
 // This is a quick way to check that checks are valid
 #define USE_STD_VECTOR 0
 
+namespace
+{
+	// Move-only type tracking moves, flagged as trivially relocatable (containers are expected to memmove it instead of moving it)
+	struct RelocatableCounter
+	{
+		RelocatableCounter(int v) : value(v) {}
+		RelocatableCounter(const RelocatableCounter&) = delete;
+		RelocatableCounter(RelocatableCounter&& counter) noexcept : value(counter.value) { moveCount++; }
+
+		RelocatableCounter& operator=(const RelocatableCounter&) = delete;
+		RelocatableCounter& operator=(RelocatableCounter&& counter) noexcept { value = counter.value; moveCount++; return *this; }
+
+		Nz::MovableValue<int> value;
+
+		static int moveCount;
+	};
+
+	int RelocatableCounter::moveCount = 0;
+}
+
+namespace Nz
+{
+	template<>
+	struct IsTriviallyRelocatable<RelocatableCounter> : std::true_type {};
+}
+
 SCENARIO("FixedVector", "[CORE][STACKVECTOR]")
 {
 	GIVEN("A FixedVector to contain multiple objects")
@@ -421,4 +453,205 @@ SCENARIO("FixedVector", "[CORE][STACKVECTOR]")
 
 		CHECK(counter == 0);
 	}
+
+	GIVEN("A FixedVector of trivially copyable types")
+	{
+		struct Vertex
+		{
+			float x, y, z;
+			Nz::UInt32 color;
+		};
+		static_assert(std::is_trivially_copyable_v<Vertex>);
+
+		auto GetColors = [](const auto& vec)
+		{
+			std::vector<Nz::UInt32> colors;
+			for (const Vertex& vertex : vec)
+				colors.push_back(vertex.color);
+
+			return colors;
+		};
+
+		Nz::FixedVector<Vertex, 16> vertices;
+		for (std::size_t i = 0; i < 8; ++i)
+			vertices.push_back(Vertex{ float(i), float(i) * 2.f, 0.f, Nz::UInt32(i) });
+
+		WHEN("Inserting and erasing elements")
+		{
+			vertices.insert(vertices.begin() + 2, Vertex{ 0.f, 0.f, 0.f, 42 });
+			vertices.emplace(vertices.begin(), Vertex{ 0.f, 0.f, 0.f, 43 });
+			vertices.insert(vertices.end(), Vertex{ 0.f, 0.f, 0.f, 44 });
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 43, 0, 1, 42, 2, 3, 4, 5, 6, 7, 44 });
+
+			vertices.erase(vertices.begin() + 3);
+			vertices.erase(vertices.begin(), vertices.begin() + 2);
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 1, 2, 3, 4, 5, 6, 7, 44 });
+			CHECK(vertices.front().y == 2.f);
+
+			vertices.erase(vertices.end() - 1);
+			vertices.resize(3);
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 1, 2, 3 });
+		}
+
+		WHEN("Copying and moving it")
+		{
+			decltype(vertices) copy(vertices);
+			CHECK(GetColors(copy) == GetColors(vertices));
+
+			decltype(vertices) moved(std::move(copy));
+			CHECK(GetColors(moved) == GetColors(vertices));
+
+			decltype(vertices) assigned;
+			assigned.push_back(Vertex{ 0.f, 0.f, 0.f, 42 });
+			assigned = vertices;
+			CHECK(GetColors(assigned) == GetColors(vertices));
+
+			const auto& self = assigned;
+			assigned = self;
+			CHECK(GetColors(assigned) == GetColors(vertices));
+
+			assigned.clear();
+			assigned = std::move(moved);
+			CHECK(GetColors(assigned) == GetColors(vertices));
+		}
+	}
+
+	GIVEN("A FixedVector of non-trivially copyable types")
+	{
+		Nz::FixedVector<CopyCounter, 8> counters(4);
+		CHECK(std::all_of(counters.begin(), counters.end(), [](const CopyCounter& counter) { return counter.GetCopyCount() == 1; }));
+
+		WHEN("Copying it")
+		{
+			decltype(counters) copy(counters);
+			CHECK(std::all_of(copy.begin(), copy.end(), [](const CopyCounter& counter) { return counter.GetCopyCount() == 2; }));
+		}
+
+		WHEN("Erasing an element, following elements are moved")
+		{
+			counters.erase(counters.begin());
+			CHECK(counters.size() == 3);
+			CHECK(std::all_of(counters.begin(), counters.end(), [](const CopyCounter& counter) { return counter.GetMoveCount() == 1; }));
+		}
+
+		WHEN("Inserting an element, following elements are moved")
+		{
+			counters.insert(counters.begin(), CopyCounter{});
+			CHECK(counters.size() == 5);
+			CHECK(counters[0].GetCopyCount() == 0);
+			CHECK(counters[0].GetMoveCount() == 1);
+			CHECK(std::all_of(counters.begin() + 1, counters.end(), [](const CopyCounter& counter) { return counter.GetCopyCount() == 1 && counter.GetMoveCount() == 1; }));
+		}
+	}
+
+	GIVEN("A FixedVector of trivially relocatable types")
+	{
+		Nz::FixedVector<RelocatableCounter, 8> counters;
+		for (int i = 0; i < 4; ++i)
+			counters.emplace_back(i);
+
+		RelocatableCounter::moveCount = 0;
+
+		auto GetValues = [](const auto& vec)
+		{
+			std::vector<int> values;
+			for (const RelocatableCounter& counter : vec)
+				values.push_back(counter.value);
+
+			return values;
+		};
+
+		WHEN("Inserting and erasing elements, following elements are relocated without being moved")
+		{
+			counters.emplace(counters.begin() + 1, 42);
+			CHECK(GetValues(counters) == std::vector<int>{ 0, 42, 1, 2, 3 });
+			CHECK(RelocatableCounter::moveCount == 1); //< only the temporary holding the new element
+
+			counters.erase(counters.begin());
+			counters.erase(counters.begin() + 1, counters.begin() + 3);
+			CHECK(GetValues(counters) == std::vector<int>{ 42, 3 });
+			CHECK(RelocatableCounter::moveCount == 1);
+		}
+
+		WHEN("Storing MovablePtr")
+		{
+			int values[3] = { 1, 2, 3 };
+
+			Nz::FixedVector<Nz::MovablePtr<int>, 4> ptrs;
+			ptrs.emplace_back(&values[0]);
+			ptrs.emplace_back(&values[2]);
+			ptrs.emplace(ptrs.begin() + 1, &values[1]);
+			CHECK(*ptrs[1] == 2);
+			CHECK(*ptrs[2] == 3);
+
+			ptrs.erase(ptrs.begin());
+			CHECK(*ptrs[0] == 2);
+			CHECK(ptrs.size() == 2);
+		}
+	}
+
+	GIVEN("A FixedVector filled in bulk")
+	{
+		Nz::FixedVector<Nz::UInt32, 16> vec;
+		std::array<Nz::UInt32, 5> values = { 1, 2, 3, 4, 5 };
+
+		WHEN("Appending and inserting ranges")
+		{
+			CHECK(*vec.append(values.begin(), values.end()) == 1);
+			CHECK(*vec.insert(vec.begin() + 2, values.begin(), values.begin() + 2) == 1);
+			vec.insert(vec.begin(), values.end() - 1, values.end());
+			vec.insert(vec.end(), values.begin(), values.begin());
+
+			std::array<Nz::UInt32, 8> expectedValues = { 5, 1, 2, 1, 2, 3, 4, 5 };
+			CHECK(std::equal(vec.begin(), vec.end(), expectedValues.begin(), expectedValues.end()));
+
+			AND_WHEN("Inserting from non-contiguous and input iterators")
+			{
+				std::list<Nz::UInt32> list = { 7, 8 };
+				vec.insert(vec.begin() + 1, list.begin(), list.end());
+
+				std::istringstream stream("9 10 11");
+				vec.insert(vec.begin(), std::istream_iterator<Nz::UInt32>(stream), std::istream_iterator<Nz::UInt32>());
+
+				std::array<Nz::UInt32, 13> expectedValues2 = { 9, 10, 11, 5, 7, 8, 1, 2, 1, 2, 3, 4, 5 };
+				CHECK(std::equal(vec.begin(), vec.end(), expectedValues2.begin(), expectedValues2.end()));
+			}
+		}
+
+		WHEN("Resizing it without initialization")
+		{
+			vec.resize_uninitialized(values.size());
+			std::copy(values.begin(), values.end(), vec.begin());
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.end()));
+
+			vec.resize_default_init(10);
+			CHECK(vec.size() == 10);
+			vec.resize_default_init(3);
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.begin() + 3));
+		}
+
+		WHEN("Inserting ranges of non-trivial types")
+		{
+			AliveCounter::Counter counter;
+			{
+				std::array<AliveCounter, 3> counters = { AliveCounter(&counter, 1), AliveCounter(&counter, 2), AliveCounter(&counter, 3) };
+
+				Nz::FixedVector<AliveCounter, 16> counterVec;
+				counterVec.emplace_back(&counter, 0);
+				counterVec.emplace_back(&counter, 4);
+				counterVec.insert(counterVec.begin() + 1, counters.begin(), counters.end());
+				counterVec.append(counters.begin(), counters.begin() + 1);
+				CHECK(counter.copyCount == 4);
+				CHECK(counter.aliveCount == 9);
+
+				std::array<int, 6> expectedValues = { 0, 1, 2, 3, 4, 1 };
+				CHECK(std::equal(counterVec.begin(), counterVec.end(), expectedValues.begin(), expectedValues.end()));
+
+				counterVec.resize_default_init(8);
+				CHECK(counterVec[7] == 0);
+				CHECK(counter.aliveCount == 9);
+			}
+			CHECK(counter.aliveCount == 0);
+		}
+	}
 }
@@ -1,6 +1,7 @@
 #include <NazaraUtils/Flags.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <memory>
+#include <vector>
 
 enum class Test
 {
@@ -82,3 +83,63 @@ SCENARIO("Flags", "[Flags]")
 		TestIteration(flags, { Test::A, Test::B, Test::C });
 	}
 }
+
+enum class WideTest
+{
+	First = 0,
+	Middle = 63,
+	Wide = 64,
+	Last = 99
+};
+
+template<>
+struct Nz::EnumAsFlags<WideTest>
+{
+	static constexpr WideTest max = WideTest::Last;
+};
+
+using WideTestFlags = Nz::Flags<WideTest>;
+
+static_assert(WideTestFlags::IsMultiWord);
+static_assert(!TestFlags::IsMultiWord);
+static_assert(std::is_same_v<TestFlags::BitField, Nz::UInt8>);
+static_assert((WideTest::First | WideTest::Last).Test(WideTest::Last));
+static_assert(!(WideTest::First | WideTest::Last).Test(WideTest::Wide));
+static_assert((~WideTestFlags(WideTest::Middle)).Test(WideTest::Last));
+
+SCENARIO("Flags with more than 64 values", "[Flags]")
+{
+	WideTestFlags flags = WideTest::First | WideTest::Wide | WideTest::Last;
+
+	WHEN("We test flags")
+	{
+		CHECK(flags);
+		CHECK(flags.Count() == 3);
+		CHECK(flags.Test(WideTest::Wide));
+		CHECK(flags.Test(WideTest::First | WideTest::Last));
+		CHECK_FALSE(flags.Test(WideTest::Middle));
+		CHECK_FALSE(WideTestFlags{});
+
+		std::vector<WideTest> values;
+		for (WideTest value : flags)
+			values.push_back(value);
+
+		CHECK(values == std::vector<WideTest>{ WideTest::First, WideTest::Wide, WideTest::Last });
+	}
+
+	WHEN("We combine flags")
+	{
+		flags.Clear(WideTest::Wide);
+		flags |= WideTest::Middle;
+		CHECK(flags == (WideTest::First | WideTest::Middle | WideTest::Last));
+
+		WideTestFlags inverted = ~flags;
+		CHECK(inverted.Count() == 97);
+		CHECK((inverted & flags) == WideTestFlags{});
+		CHECK((inverted ^ flags) == WideTestFlags::ValueMask);
+
+		flags.Clear();
+		CHECK(flags.Count() == 0);
+		CHECK(std::hash<WideTestFlags>{}(flags) != std::hash<WideTestFlags>{}(inverted));
+	}
+}
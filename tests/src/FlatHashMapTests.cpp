@@ -0,0 +1,227 @@
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/FlatHashSet.hpp>
+#include <NazaraUtils/HashedString.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <AliveCounter.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST_CASE("FlatHashMap", "[CORE][FLATHASHMAP]")
+{
+	SECTION("Basic operations")
+	{
+		Nz::FlatHashMap<int, std::string> map;
+		CHECK(map.empty());
+		CHECK(map.capacity() == 0);
+		CHECK(map.find(42) == map.end());
+		CHECK(map.begin() == map.end());
+
+		map[1] = "one";
+		map[2] = "two";
+		CHECK(map.insert({ 3, "three" }).second);
+		CHECK_FALSE(map.insert({ 3, "trois" }).second);
+		CHECK(map.try_emplace(4, "four").second);
+		CHECK_FALSE(map.try_emplace(4, "quatre").second);
+		CHECK_FALSE(map.insert_or_assign(4, "quatre").second);
+		CHECK(map.emplace(5, "five").second);
+
+		CHECK(map.size() == 5);
+		CHECK(map.at(3) == "three");
+		CHECK(map.at(4) == "quatre");
+		CHECK(map.contains(5));
+		CHECK(map.count(6) == 0);
+		CHECK_THROWS_AS(map.at(6), std::out_of_range);
+
+		CHECK(map.erase(2) == 1);
+		CHECK(map.erase(2) == 0);
+		CHECK(map.size() == 4);
+		CHECK_FALSE(map.contains(2));
+
+		std::size_t sum = 0;
+		for (auto&& [key, value] : map)
+			sum += key;
+		CHECK(sum == 1 + 3 + 4 + 5);
+
+		Nz::FlatHashMap<int, std::string> copy(map);
+		CHECK(copy.size() == map.size());
+		CHECK(copy.at(1) == "one");
+
+		Nz::FlatHashMap<int, std::string> moved(std::move(copy));
+		CHECK(moved.size() == map.size());
+		CHECK(copy.empty());
+
+		copy = moved;
+		CHECK(copy.at(5) == "five");
+
+		map.clear();
+		CHECK(map.empty());
+		CHECK(map.capacity() > 0);
+		CHECK(map.begin() == map.end());
+
+		map.rehash(0);
+		CHECK(map.capacity() == 0);
+	}
+
+	SECTION("Erasing with iterators keeps other elements valid")
+	{
+		Nz::FlatHashMap<int, int> map;
+		for (int i = 0; i < 1000; ++i)
+			map[i] = i * 2;
+
+		for (auto it = map.begin(); it != map.end();)
+		{
+			if (it->first % 3 == 0)
+				it = map.erase(it);
+			else
+				++it;
+		}
+
+		CHECK(map.size() == 666);
+
+		bool allValid = true;
+		for (int i = 0; i < 1000; ++i)
+		{
+			auto it = map.find(i);
+			if ((i % 3 == 0) != (it == map.end()) || (it != map.end() && it->second != i * 2))
+				allValid = false;
+		}
+		CHECK(allValid);
+	}
+
+	SECTION("Random operations match std::unordered_map")
+	{
+		std::mt19937 rand(42);
+		std::uniform_int_distribution<int> keyDis(0, 2000);
+		std::uniform_int_distribution<int> opDis(0, 9);
+
+		Nz::FlatHashMap<int, int> map;
+		std::unordered_map<int, int> reference;
+
+		bool allMatches = true;
+		for (int i = 0; i < 50'000; ++i)
+		{
+			int key = keyDis(rand);
+			switch (opDis(rand))
+			{
+				case 0:
+				case 1:
+				case 2:
+				case 3:
+					map[key] = i;
+					reference[key] = i;
+					break;
+
+				case 4:
+				case 5:
+				case 6:
+					if (map.erase(key) != reference.erase(key))
+						allMatches = false;
+					break;
+
+				default:
+				{
+					auto it = map.find(key);
+					auto refIt = reference.find(key);
+					if ((it == map.end()) != (refIt == reference.end()) || (it != map.end() && it->second != refIt->second))
+						allMatches = false;
+					break;
+				}
+			}
+
+			if (map.size() != reference.size())
+				allMatches = false;
+		}
+		CHECK(allMatches);
+
+		std::size_t count = 0;
+		for (auto&& [key, value] : map)
+		{
+			if (reference.at(key) != value)
+				allMatches = false;
+
+			count++;
+		}
+		CHECK(allMatches);
+		CHECK(count == reference.size());
+		CHECK(map.load_factor() <= map.max_load_factor());
+	}
+
+	SECTION("Heterogeneous lookup")
+	{
+		using namespace std::literals;
+
+		Nz::FlatHashMap<std::string, int> map;
+		map["Nazara"] = 1;
+		map["Engine"] = 2;
+
+		CHECK(map.find("Nazara"sv) != map.end());
+		CHECK(map.at("Engine") == 2);
+		CHECK(map.contains(Nz::HashedStringView("Nazara")));
+		CHECK(map.erase("Nazara"sv) == 1);
+		CHECK_FALSE(map.contains("Nazara"));
+	}
+
+	SECTION("Element lifetime")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::FlatHashMap<int, AliveCounter> map;
+			for (int i = 0; i < 100; ++i)
+				map.try_emplace(i, &counter, i);
+
+			CHECK(counter.aliveCount == 100);
+
+			for (int i = 0; i < 100; i += 2)
+				map.erase(i);
+
+			CHECK(counter.aliveCount == 50);
+
+			Nz::FlatHashMap<int, AliveCounter> copy = map;
+			CHECK(counter.aliveCount == 100);
+
+			copy.clear();
+			CHECK(counter.aliveCount == 50);
+		}
+		CHECK(counter.aliveCount == 0);
+
+		Nz::FlatHashMap<int, std::unique_ptr<int>> uniqueMap;
+		for (int i = 0; i < 100; ++i)
+			uniqueMap.emplace(i, std::make_unique<int>(i));
+
+		CHECK(*uniqueMap.at(42) == 42);
+	}
+}
+
+TEST_CASE("FlatHashSet", "[CORE][FLATHASHMAP]")
+{
+	Nz::FlatHashSet<std::string> set = { "Nazara", "Engine", "Utility", "Library" };
+	CHECK(set.size() == 4);
+	CHECK(set.contains("Nazara"));
+	CHECK_FALSE(set.contains("Nazara Engine"));
+	CHECK_FALSE(set.insert("Engine").second);
+	CHECK(set.insert("Unit tests").second);
+	CHECK(set.size() == 5);
+
+	std::unordered_set<std::string> values(set.begin(), set.end());
+	CHECK(values.size() == 5);
+
+	Nz::FlatHashSet<int> intSet;
+	intSet.reserve(1000);
+	std::size_t capacity = intSet.capacity();
+	for (int i = 0; i < 1000; ++i)
+		intSet.insert(i);
+
+	CHECK(intSet.capacity() == capacity);
+
+	// Repeated insertion and erasure must recycle tombstones instead of growing forever
+	for (int i = 0; i < 100'000; ++i)
+	{
+		intSet.erase(i);
+		intSet.insert(i + 1000);
+	}
+	CHECK(intSet.size() == 1000);
+	CHECK(intSet.capacity() == capacity);
+}
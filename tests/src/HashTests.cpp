@@ -1,7 +1,13 @@
 #include <NazaraUtils/Hash.hpp>
 #include <NazaraUtils/TypeName.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <cstring>
+#include <list>
+#include <random>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
 
 template<typename T, std::size_t N, typename H>
 void TestHash(const char (&str)[N], H expectedHash)
@@ -27,6 +33,54 @@ TEST_CASE("Hash", "[Hash]")
 	TestHash<Nz::CRC32Hash>("t.tv/SirLynixVanFriejtes", 0xcc2a0914);
 	TestHash<Nz::CRC32Hash>("The quick brown fox jumps over the lazy dog", 0x414fa339);
 
+	static_assert(Nz::CRC32("123456789") == 0xcbf43926);
+	static_assert(Nz::CRC32C("123456789") == 0xe3069283);
+	static_assert(Nz::CRC32C("The quick brown fox jumps over the lazy dog") == 0x22620404);
+
+	TestHash<Nz::CRC32Hash>("123456789", 0xcbf43926);
+	TestHash<Nz::CRC32CHash>("123456789", 0xe3069283);
+	TestHash<Nz::CRC32CHash>("The quick brown fox jumps over the lazy dog", 0x22620404);
+
+	SECTION("Runtime CRC32 matches the bytewise implementation")
+	{
+		std::mt19937 rand(42);
+		std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+		std::vector<Nz::UInt8> buffer(100'000);
+		for (Nz::UInt8& byte : buffer)
+			byte = static_cast<Nz::UInt8>(dis(rand));
+
+		auto ReferenceCRC = [&](const Nz::UInt8* data, std::size_t size, bool castagnoli)
+		{
+			const auto& table = (castagnoli) ? Nz::Detail::s_crc32cSlicingTables[0] : Nz::Detail::s_crc32Table;
+
+			Nz::UInt32 crc = 0xFFFFFFFFu;
+			for (std::size_t i = 0; i < size; ++i)
+				crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+			return ~crc;
+		};
+
+		bool allMatches = true;
+		for (std::size_t offset : { 0, 1, 3, 8 })
+		{
+			for (std::size_t size = 0; size < 300; ++size)
+			{
+				const Nz::UInt8* data = buffer.data() + offset;
+				if (Nz::CRC32(data, size) != ReferenceCRC(data, size, false) || Nz::CRC32C(data, size) != ReferenceCRC(data, size, true))
+					allMatches = false;
+			}
+		}
+		CHECK(allMatches);
+
+		CHECK(Nz::CRC32(buffer.data() + 5, buffer.size() - 5) == ReferenceCRC(buffer.data() + 5, buffer.size() - 5, false));
+		CHECK(Nz::CRC32C(buffer.data() + 5, buffer.size() - 5) == ReferenceCRC(buffer.data() + 5, buffer.size() - 5, true));
+
+		// Slicing-by-8 fallback, which may not be the implementation selected for this CPU
+		CHECK(Nz::Detail::CRC32UpdateScalar(0xFFFFFFFFu, buffer.data(), buffer.size()) == ~ReferenceCRC(buffer.data(), buffer.size(), false));
+		CHECK(Nz::Detail::CRC32CUpdateScalar(0xFFFFFFFFu, buffer.data(), buffer.size()) == ~ReferenceCRC(buffer.data(), buffer.size(), true));
+	}
+
 	static_assert(Nz::FNV1a32("Nazara Engine") == 0x5ba735a6);
 	static_assert(Nz::FNV1a32("t.tv/SirLynixVanFriejtes") == 0x3ef9d843);
 	static_assert(Nz::FNV1a32("The quick brown fox jumps over the lazy dog") == 0x048fff90);
@@ -42,4 +96,131 @@ TEST_CASE("Hash", "[Hash]")
 	TestHash<Nz::FNV1a64Hash>("Nazara Engine", 0xa00fb3557d90f6e6);
 	TestHash<Nz::FNV1a64Hash>("t.tv/SirLynixVanFriejtes", 0x4d2631a6429ff643);
 	TestHash<Nz::FNV1a64Hash>("The quick brown fox jumps over the lazy dog", 0xf3f9b7f5e7e47110);
+
+	// Test vectors from the reference implementation (seed is the index of the vector)
+	static_assert(Nz::WyHash64("", 0) == 0x93228a4de0eec5a2);
+	static_assert(Nz::WyHash64("a", 1) == 0xc5bac3db178713c4);
+	static_assert(Nz::WyHash64("abc", 2) == 0xa97f2f7b1d9b3314);
+	static_assert(Nz::WyHash64("message digest", 3) == 0x786d1f1df3801df4);
+	static_assert(Nz::WyHash64("abcdefghijklmnopqrstuvwxyz", 4) == 0xdca5a8138ad37c87);
+	static_assert(Nz::WyHash64("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5) == 0xb9e734f117cfaf70);
+	static_assert(Nz::WyHash64("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6) == 0x6cc5eab49a92d617);
+
+	CHECK(Nz::WyHash64(std::string_view("message digest"), 3) == 0x786d1f1df3801df4);
+	CHECK(Nz::WyHash64(reinterpret_cast<const Nz::UInt8*>("12345678901234567890123456789012345678901234567890123456789012345678901234567890"), 80, 6) == 0x6cc5eab49a92d617);
+
+	TestHash<Nz::WyHash64Hash>("Nazara Engine", Nz::WyHash64("Nazara Engine"));
+	TestHash<Nz::WyHash64Hash>("The quick brown fox jumps over the lazy dog", Nz::WyHash64("The quick brown fox jumps over the lazy dog"));
+
+	SECTION("Incremental hashers")
+	{
+		std::mt19937 rand(1337);
+		std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+		std::vector<Nz::UInt8> buffer(5000);
+		for (Nz::UInt8& byte : buffer)
+			byte = static_cast<Nz::UInt8>(byteDis(rand));
+
+		bool allMatches = true;
+		for (std::size_t size : { 0, 1, 3, 15, 16, 17, 47, 48, 49, 63, 64, 95, 96, 100, 1000, 5000 })
+		{
+			for (std::size_t maxChunkSize : { 1, 7, 48, 100 })
+			{
+				Nz::CRC32Hasher crc32;
+				Nz::CRC32CHasher crc32c;
+				Nz::FNV1a64Hasher fnv1a64;
+				Nz::WyHash64Hasher wyhash(42);
+
+				std::uniform_int_distribution<std::size_t> chunkDis(0, maxChunkSize);
+				for (std::size_t offset = 0; offset < size;)
+				{
+					std::size_t chunkSize = std::min(chunkDis(rand), size - offset);
+					crc32.Update(&buffer[offset], chunkSize);
+					crc32c.Update(&buffer[offset], chunkSize);
+					fnv1a64.Update(&buffer[offset], chunkSize);
+					wyhash.Update(&buffer[offset], chunkSize);
+					offset += chunkSize;
+				}
+
+				if (crc32.Finalize() != Nz::CRC32(buffer.data(), size) ||
+				    crc32c.Finalize() != Nz::CRC32C(buffer.data(), size) ||
+				    fnv1a64.Finalize() != Nz::FNV1a64(buffer.data(), size) ||
+				    wyhash.Finalize() != Nz::WyHash64(buffer.data(), size, 42))
+				{
+					INFO("size: " << size << ", max chunk size: " << maxChunkSize);
+					allMatches = false;
+				}
+			}
+		}
+		CHECK(allMatches);
+
+		Nz::WyHash64Hasher wyhash;
+		wyhash.Update(buffer.data(), 100);
+		wyhash.Reset();
+		wyhash.Update(buffer.data(), 20);
+		CHECK(wyhash.Finalize() == Nz::WyHash64(buffer.data(), 20));
+
+		WHEN("We combine CRCs of chunks")
+		{
+			for (std::size_t split : { 0, 1, 10, 1000, 5000 })
+			{
+				Nz::UInt32 crcA = Nz::CRC32(buffer.data(), split);
+				Nz::UInt32 crcB = Nz::CRC32(buffer.data() + split, buffer.size() - split);
+				CHECK(Nz::CRC32Hasher::Combine(crcA, crcB, buffer.size() - split) == Nz::CRC32(buffer.data(), buffer.size()));
+
+				Nz::UInt32 crcCA = Nz::CRC32C(buffer.data(), split);
+				Nz::UInt32 crcCB = Nz::CRC32C(buffer.data() + split, buffer.size() - split);
+				CHECK(Nz::CRC32CHasher::Combine(crcCA, crcCB, buffer.size() - split) == Nz::CRC32C(buffer.data(), buffer.size()));
+			}
+
+			static_assert(Nz::CRC32Hasher::Combine(Nz::CRC32("1234"), Nz::CRC32("56789"), 5) == Nz::CRC32("123456789"));
+		}
+	}
+
+	SECTION("Range, object and tuple hashing")
+	{
+		std::vector<Nz::UInt32> values = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		std::list<Nz::UInt32> valueList(values.begin(), values.end());
+
+		// contiguous ranges of trivial types are hashed as bytes
+		CHECK(Nz::HashRange(values) == Nz::WyHash64(reinterpret_cast<const Nz::UInt8*>(values.data()), values.size() * sizeof(Nz::UInt32)));
+		CHECK(Nz::HashRange(values) == Nz::HashRange(values.data(), values.data() + values.size()));
+		CHECK(Nz::HashRange(std::vector<Nz::UInt32>{}) == Nz::WyHash64(""));
+
+		// non-contiguous ranges hash their elements
+		CHECK(Nz::HashRange(valueList) == Nz::HashRange(valueList.begin(), valueList.end()));
+		CHECK(Nz::HashRange(valueList) != Nz::HashRange(std::list<Nz::UInt32>(values.rbegin(), values.rend())));
+
+		std::vector<std::string> strings = { "Nazara", "Engine", "Utility", "Library", "Hash", "Range", "Test" };
+		std::size_t stringsHash = Nz::HashRange(strings);
+		CHECK(stringsHash == Nz::HashRange(std::list<std::string>(strings.begin(), strings.end())));
+		std::swap(strings[0], strings[1]);
+		CHECK(stringsHash != Nz::HashRange(strings));
+
+		std::unordered_set<std::size_t> rangeHashes;
+		for (std::size_t i = 0; i <= values.size(); ++i)
+			rangeHashes.insert(Nz::HashRange(valueList.begin(), std::next(valueList.begin(), i)));
+		CHECK(rangeHashes.size() == values.size() + 1);
+
+		struct Packed
+		{
+			Nz::UInt32 a;
+			Nz::UInt32 b;
+		};
+
+		CHECK(Nz::HashObject(Packed{ 1, 2 }) == Nz::HashObject(Packed{ 1, 2 }));
+		CHECK(Nz::HashObject(Packed{ 1, 2 }) != Nz::HashObject(Packed{ 2, 1 }));
+
+		Nz::TupleHash tupleHash;
+		CHECK(tupleHash(std::make_tuple(1, std::string("two"), 3.0)) == tupleHash(std::make_tuple(1, std::string("two"), 3.0)));
+		CHECK(tupleHash(std::make_tuple(1, 2)) != tupleHash(std::make_tuple(2, 1)));
+		CHECK(tupleHash(std::make_pair(1, 2)) == tupleHash(std::make_tuple(1, 2)));
+		CHECK(tupleHash(std::tuple<>{}) == 0);
+
+		// HashCombine accepts tuples
+		std::size_t seed = 0;
+		Nz::HashCombine(seed, std::make_pair(1, 2));
+		CHECK(seed != 0);
+		CHECK(Nz::HashRange(std::vector<std::pair<int, int>>{ { 1, 2 }, { 3, 4 } }) != Nz::HashRange(std::vector<std::pair<int, int>>{ { 3, 4 }, { 1, 2 } }));
+	}
 }
@@ -0,0 +1,207 @@
+#include <NazaraUtils/HierarchicalBitset.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template<typename Block>
+	bool MatchesReference(const Nz::HierarchicalBitset<Block>& bitset, const std::vector<bool>& reference)
+	{
+		if (bitset.GetSize() != reference.size())
+			return false;
+
+		std::vector<std::size_t> expectedBits;
+		for (std::size_t i = 0; i < reference.size(); ++i)
+		{
+			if (reference[i])
+				expectedBits.push_back(i);
+		}
+
+		std::vector<std::size_t> bits;
+		for (std::size_t bit : bitset.IterBits())
+			bits.push_back(bit);
+
+		return bits == expectedBits && bitset.Count() == expectedBits.size() && bitset.TestAny() == !expectedBits.empty();
+	}
+
+	template<typename Block>
+	void CheckHierarchicalBitset(std::size_t bitCount)
+	{
+		INFO("bit count: " << bitCount << ", block size: " << sizeof(Block));
+
+		std::mt19937 rand(static_cast<unsigned int>(bitCount));
+		std::uniform_int_distribution<std::size_t> bitDis(0, (bitCount > 0) ? bitCount - 1 : 0);
+
+		Nz::HierarchicalBitset<Block> bitset(bitCount);
+		std::vector<bool> reference(bitCount, false);
+
+		CHECK(bitset.GetSize() == bitCount);
+		CHECK(bitset.TestNone());
+		CHECK(bitset.FindFirst() == bitset.npos);
+		if (bitCount == 0)
+			return;
+
+		// Sparse bits
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			std::size_t bit = bitDis(rand);
+			bitset.Set(bit);
+			reference[bit] = true;
+		}
+		CHECK(MatchesReference(bitset, reference));
+
+		// Set and reset randomly, making blocks empty and non-empty again
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			std::size_t bit = bitDis(rand);
+			bool val = (rand() % 3) == 0;
+			bitset.Set(bit, val);
+			reference[bit] = val;
+		}
+		CHECK(MatchesReference(bitset, reference));
+
+		for (std::size_t i = 0; i < bitCount; ++i)
+		{
+			if (reference[i])
+			{
+				bitset.Reset(i);
+				reference[i] = false;
+			}
+		}
+		CHECK(bitset.TestNone());
+		CHECK(MatchesReference(bitset, reference));
+
+		// Last and first bit
+		bitset.Set(bitCount - 1);
+		reference[bitCount - 1] = true;
+		CHECK(bitset.FindFirst() == bitCount - 1);
+		CHECK(bitset.FindNext(bitCount - 1) == bitset.npos);
+
+		bitset.Set(0, true);
+		reference[0] = true;
+		CHECK(bitset.FindFirst() == 0);
+		CHECK(MatchesReference(bitset, reference));
+
+		// Dense
+		bitset.Set(true);
+		CHECK(bitset.Count() == bitCount);
+		reference.assign(bitCount, true);
+		CHECK(MatchesReference(bitset, reference));
+
+		bitset.Reset();
+		reference.assign(bitCount, false);
+		CHECK(MatchesReference(bitset, reference));
+	}
+}
+
+SCENARIO("HierarchicalBitset", "[CORE][HIERARCHICALBITSET]")
+{
+	GIVEN("Hierarchical bitsets of various sizes")
+	{
+		for (std::size_t bitCount : { 0, 1, 7, 63, 64, 65, 4095, 4096, 4097, 300'000 })
+		{
+			CheckHierarchicalBitset<Nz::UInt8>(bitCount);
+			CheckHierarchicalBitset<Nz::UInt32>(bitCount);
+			CheckHierarchicalBitset<Nz::UInt64>(bitCount);
+		}
+	}
+
+	GIVEN("A large hierarchical bitset")
+	{
+		Nz::HierarchicalBitset<Nz::UInt64> bitset(300'000);
+		CHECK(bitset.GetBlockCount() == 4688);
+		CHECK(bitset.GetLevelCount() == 4);
+
+		bitset.Set(12, true);
+		bitset.Set(200'000, true);
+		bitset.Set(299'999, true);
+
+		CHECK(bitset.FindFirst() == 12);
+		CHECK(bitset.FindNext(12) == 200'000);
+		CHECK(bitset.FindNext(200'000) == 299'999);
+		CHECK(bitset.FindNext(299'999) == bitset.npos);
+
+		WHEN("We resize it")
+		{
+			bitset.Resize(250'000);
+
+			CHECK(bitset.GetSize() == 250'000);
+			CHECK(bitset.Count() == 2);
+			CHECK(bitset.FindNext(200'000) == bitset.npos);
+
+			bitset.Resize(250'010, true);
+			CHECK(bitset.Count() == 12);
+			CHECK(bitset.FindNext(200'000) == 250'000);
+			CHECK(bitset.Test(250'009));
+
+			bitset.Resize(10);
+			CHECK(bitset.TestNone());
+			CHECK(bitset.GetLevelCount() == 1);
+		}
+
+		WHEN("We resize it to zero")
+		{
+			bitset.Resize(0, true);
+
+			CHECK(bitset.GetSize() == 0);
+			CHECK(bitset.GetBlockCount() == 0);
+			CHECK(bitset.GetLevelCount() == 0);
+			CHECK(bitset.Count() == 0);
+			CHECK(bitset.FindFirst() == bitset.npos);
+
+			bitset.Resize(100, true);
+			CHECK(bitset.Count() == 100);
+			CHECK(bitset.FindFirst() == 0);
+
+			bitset.Set(false);
+			bitset.Resize(0);
+			bitset.Set(true);
+			CHECK(bitset.GetBlockCount() == 0);
+			CHECK(bitset.TestNone());
+		}
+
+		WHEN("We resize a small bitset to zero")
+		{
+			Nz::HierarchicalBitset<Nz::UInt8> small(100);
+			small.Set(26, true);
+			small.Resize(0, true);
+
+			CHECK(small.GetSize() == 0);
+			CHECK(small.GetBlockCount() == 0);
+			CHECK(small.Count() == 0);
+
+			small.Resize(20, true);
+			CHECK(small.Count() == 20);
+		}
+
+		WHEN("We use unbounded functions")
+		{
+			bitset.UnboundedSet(1'000'000);
+			CHECK(bitset.GetSize() == 1'000'001);
+			CHECK(bitset.FindNext(299'999) == 1'000'000);
+			CHECK(bitset.UnboundedTest(1'000'000));
+			CHECK_FALSE(bitset.UnboundedTest(2'000'000));
+
+			bitset.UnboundedReset(3'000'000);
+			CHECK(bitset.GetSize() == 1'000'001);
+		}
+
+		WHEN("We copy and swap it")
+		{
+			Nz::HierarchicalBitset<Nz::UInt64> copy(bitset);
+			Nz::HierarchicalBitset<Nz::UInt64> other(42);
+			other.Set(41, true);
+
+			std::swap(copy, other);
+			CHECK(copy.GetSize() == 42);
+			CHECK(copy.FindFirst() == 41);
+			CHECK(other.FindNext(12) == 200'000);
+
+			copy.Clear();
+			CHECK(copy.GetSize() == 0);
+			CHECK(copy.TestNone());
+			CHECK(copy.FindFirst() == copy.npos);
+		}
+	}
+}
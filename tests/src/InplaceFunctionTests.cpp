@@ -0,0 +1,164 @@
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <CopyCounter.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+
+namespace
+{
+	struct Foo
+	{
+		int Bar() { return m_value; }
+
+		int m_value;
+	};
+
+	struct LifetimeCounter
+	{
+		LifetimeCounter(int& counter) :
+		m_counter(&counter)
+		{
+			++*m_counter;
+		}
+
+		LifetimeCounter(const LifetimeCounter& lifetimeCounter) noexcept :
+		m_counter(lifetimeCounter.m_counter)
+		{
+			++*m_counter;
+		}
+
+		~LifetimeCounter()
+		{
+			--*m_counter;
+		}
+
+		int operator()() const { return *m_counter; }
+
+		int* m_counter;
+	};
+
+	template<int N>
+	int FuncCall()
+	{
+		return N;
+	}
+}
+
+SCENARIO("InplaceFunction", "[InplaceFunction]")
+{
+	GIVEN("Empty functions")
+	{
+		Nz::InplaceFunction<int()> func;
+		CHECK_FALSE(func);
+
+		Nz::InplaceFunction<int()> nullFunc(nullptr);
+		CHECK_FALSE(nullFunc);
+
+		int (*nullPtr)() = nullptr;
+		Nz::InplaceFunction<int()> nullPtrFunc(nullPtr);
+		CHECK_FALSE(nullPtrFunc);
+
+		Nz::InplaceFunction<int()> copy(func);
+		CHECK_FALSE(copy);
+	}
+
+	GIVEN("Various callables")
+	{
+		Nz::InplaceFunction<int()> func = FuncCall<47>;
+		CHECK(func);
+		CHECK(func() == 47);
+
+		func = &FuncCall<42>;
+		CHECK(func() == 42);
+
+		func = [] { return 1337; };
+		CHECK(func() == 1337);
+
+		Foo foo{ 42 };
+		Nz::InplaceFunction<int(Foo*)> method = &Foo::Bar;
+		CHECK(method(&foo) == 42);
+
+		Nz::InplaceFunction<int()> memberLambda = [object = &foo, memberFunc = &Foo::Bar] { return (object->*memberFunc)(); };
+		CHECK(memberLambda() == 42);
+		CHECK(decltype(memberLambda)::IsStoredInline<decltype(&Foo::Bar)>());
+
+		int counter = 0;
+		Nz::InplaceFunction<void()> mutableLambda = [counter]() mutable { counter++; };
+		mutableLambda();
+
+		func = nullptr;
+		CHECK_FALSE(func);
+	}
+
+	GIVEN("Arguments")
+	{
+		Nz::InplaceFunction<std::size_t(CopyCounter)> byValue = [](CopyCounter counter) { return counter.GetCopyCount(); };
+		CHECK(byValue(CopyCounter{}) == 0);
+
+		Nz::InplaceFunction<std::size_t(const CopyCounter&)> byRef = [](const CopyCounter& counter) { return counter.GetCopyCount() + counter.GetMoveCount(); };
+		CHECK(byRef(CopyCounter{}) == 0);
+
+		Nz::InplaceFunction<void(std::unique_ptr<int>&&, int&)> moveOnly = [](std::unique_ptr<int>&& ptr, int& value) { value = *ptr; };
+		int value = 0;
+		moveOnly(std::make_unique<int>(42), value);
+		CHECK(value == 42);
+	}
+
+	GIVEN("Inline and heap-allocated callables")
+	{
+		using Function = Nz::InplaceFunction<int(), 16>;
+
+		int counter = 0;
+		LifetimeCounter lifetimeCounter(counter);
+
+		std::array<int, 32> bigCapture{};
+		bigCapture.back() = 42;
+		auto bigLambda = [bigCapture, lifetimeCounter] { return bigCapture.back() + *lifetimeCounter.m_counter; };
+
+		CHECK(Function::IsStoredInline<LifetimeCounter>());
+		CHECK_FALSE(Function::IsStoredInline<decltype(bigLambda)>());
+
+		auto CheckLifetime = [&](const auto& callable, int baseCount, int offset)
+		{
+			Function func;
+			func = callable;
+
+			CHECK(counter == baseCount);
+			CHECK(func() == baseCount + offset);
+
+			Function copy(func);
+			CHECK(counter == baseCount + 1);
+			CHECK(copy() == baseCount + 1 + offset);
+
+			Function moved(std::move(copy));
+			CHECK_FALSE(copy);
+			CHECK(counter == baseCount + 1);
+			CHECK(moved() == baseCount + 1 + offset);
+
+			copy = moved;
+			CHECK(counter == baseCount + 2);
+
+			copy = std::move(moved);
+			CHECK_FALSE(moved);
+			CHECK(counter == baseCount + 1);
+
+			func = nullptr;
+			CHECK(counter == baseCount);
+
+			copy = nullptr;
+			CHECK(counter == baseCount - 1);
+		};
+
+		WHEN("Storing an inline callable")
+		{
+			// lifetimeCounter + bigLambda + func
+			CheckLifetime(lifetimeCounter, 3, 0);
+		}
+
+		WHEN("Storing an heap-allocated callable")
+		{
+			// lifetimeCounter + bigLambda + func
+			CheckLifetime(bigLambda, 3, 42);
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#include <NazaraUtils/MappedFile.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+SCENARIO("MappedFile", "[MappedFile]")
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "NazaraUtilsMappedFileTests";
+	std::filesystem::create_directories(directory);
+
+	std::string content;
+	for (std::size_t i = 0; i < 100'000; ++i)
+		content += static_cast<char>('a' + i % 26);
+
+	std::filesystem::path filePath = directory / "file.bin";
+	{
+		std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+		file.write(content.data(), content.size());
+	}
+
+	WHEN("Mapping a file read-only")
+	{
+		Nz::Result<Nz::MappedFile, Nz::MappedFileError> result = Nz::MappedFile::Open(filePath);
+		REQUIRE(result.IsOk());
+
+		Nz::MappedFile& file = result.GetValue();
+		CHECK(file.GetMode() == Nz::MappedFileMode::ReadOnly);
+		REQUIRE(file.GetSize() == content.size());
+		CHECK(std::memcmp(file.GetData(), content.data(), content.size()) == 0);
+
+		file.Advise(Nz::MappedFileAccess::Random);
+		file.Advise(Nz::MappedFileAccess::WillNeed, 5000, 20000);
+		file.Advise(Nz::MappedFileAccess::Sequential);
+		CHECK(file.GetData()[12345] == content[12345]);
+
+		Nz::MappedFile movedFile = std::move(file);
+		CHECK(file.IsEmpty());
+		CHECK(file.GetData() == nullptr);
+		REQUIRE(movedFile.GetSize() == content.size());
+		CHECK(movedFile.GetData()[content.size() - 1] == content.back());
+
+		movedFile.Close();
+		CHECK(movedFile.IsEmpty());
+	}
+
+	WHEN("Mapping a file copy-on-write")
+	{
+		Nz::Result<Nz::MappedFile, Nz::MappedFileError> result = Nz::MappedFile::Open(Nz::Utf8Path(Nz::PathToString(filePath)), Nz::MappedFileMode::CopyOnWrite, Nz::MappedFileAccess::Sequential);
+		REQUIRE(result.IsOk());
+
+		Nz::MappedFile& file = result.GetValue();
+		REQUIRE(file.GetSize() == content.size());
+		file.GetMutableData()[0] = 'Z';
+		CHECK(file.GetData()[0] == 'Z');
+
+		// Writes must never reach the file
+		Nz::MappedFile otherFile = Nz::MappedFile::Open(filePath).GetValue();
+		REQUIRE(otherFile.GetSize() == content.size());
+		CHECK(otherFile.GetData()[0] == 'a');
+	}
+
+	WHEN("Mapping an empty file")
+	{
+		std::filesystem::path emptyPath = directory / "empty.bin";
+		std::ofstream(emptyPath, std::ios::binary | std::ios::trunc).close();
+
+		Nz::Result<Nz::MappedFile, Nz::MappedFileError> result = Nz::MappedFile::Open(emptyPath);
+		REQUIRE(result.IsOk());
+		CHECK(result.GetValue().IsEmpty());
+	}
+
+	WHEN("Mapping a file which doesn't exist")
+	{
+		Nz::Result<Nz::MappedFile, Nz::MappedFileError> result = Nz::MappedFile::Open(directory / "missing.bin");
+		REQUIRE(result.IsErr());
+		CHECK(result.GetError() == Nz::MappedFileError::FileNotFound);
+
+		CHECK(Nz::MappedFile::Open(directory).GetError() != Nz::MappedFileError::FileNotFound);
+	}
+
+	std::filesystem::remove_all(directory);
+}
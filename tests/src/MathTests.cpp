@@ -1,6 +1,12 @@
 #include <NazaraUtils/MathUtils.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
 
 // Constexprness test
 #ifdef NAZARA_HAS_CONSTEVAL
@@ -11,6 +17,9 @@ static_assert(Nz::FindFirstBit(0b00110100) == 3);
 #endif
 
 static_assert(Nz::SetBit(0b00110001, 1) == 0b00110011);
+static_assert(Nz::MortonEncode2D<Nz::UInt32>(0b11, 0b01) == 0b0111);
+static_assert(Nz::MortonEncode3D<Nz::UInt32>(0b10, 0b01, 0b11) == 0b101110);
+static_assert(Nz::MortonDecode3D<Nz::UInt16>(0b101110)[2] == 0b11);
 static_assert(Nz::TestBit(0b00110001, 0));
 static_assert(!Nz::TestBit(0b00110001, 1));
 
@@ -42,6 +51,250 @@ void TestFindFirstBit()
 	}
 }
 
+template<typename T>
+void TestArrayBitOps()
+{
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<Nz::UInt64> dis(0, std::numeric_limits<T>::max());
+
+	for (std::size_t count : { 0, 1, 3, 17, 64, 300, 1000 })
+	{
+		std::vector<T> values(count);
+		for (T& value : values)
+			value = static_cast<T>(dis(gen));
+
+		std::size_t expectedCount = 0;
+		for (T value : values)
+			expectedCount += Nz::CountBits(value);
+
+		CHECK(Nz::CountBits(values.data(), count) == expectedCount);
+
+		std::vector<T> reversed = values;
+		Nz::ReverseBits(reversed.data(), count);
+
+		bool reversedMatches = true;
+		for (std::size_t i = 0; i < count; ++i)
+			reversedMatches = reversedMatches && (reversed[i] == Nz::ReverseBits(values[i]));
+
+		CHECK(reversedMatches);
+
+		std::vector<T> sparse(count, T(0));
+		CHECK(Nz::FindFirstBit(sparse.data(), count) == 0);
+		if (count > 0)
+		{
+			std::size_t index = count * 2 / 3;
+			sparse[index] = T(T(1) << (Nz::BitCount<T>() - 2));
+			sparse[count - 1] |= T(1);
+			CHECK(Nz::FindFirstBit(sparse.data(), count) == (index == count - 1 ? index * Nz::BitCount<T>() + 1 : index * Nz::BitCount<T>() + Nz::BitCount<T>() - 1));
+		}
+	}
+}
+
+template<typename T, std::size_t N>
+T NaiveMortonEncode(const std::array<T, N>& coords)
+{
+	T code = 0;
+	for (std::size_t bit = 0; bit < Nz::BitCount<T>() / N; ++bit)
+	{
+		for (std::size_t i = 0; i < N; ++i)
+			code |= T(((coords[i] >> bit) & 1) << (bit * N + i));
+	}
+
+	return code;
+}
+
+template<typename T>
+void TestMorton()
+{
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<Nz::UInt64> dis(0, std::numeric_limits<T>::max());
+
+	constexpr T mask2D = T(std::numeric_limits<T>::max() >> (Nz::BitCount<T>() / 2));
+	constexpr T mask3D = T(std::numeric_limits<T>::max() >> (Nz::BitCount<T>() - Nz::BitCount<T>() / 3));
+
+	CHECK(Nz::MortonEncode2D<T>(mask2D, mask2D) == std::numeric_limits<T>::max());
+	CHECK(Nz::MortonEncode3D<T>(mask3D, mask3D, mask3D) == T(std::numeric_limits<T>::max() >> (Nz::BitCount<T>() % 3)));
+
+	bool valid = true;
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		T x = static_cast<T>(dis(gen));
+		T y = static_cast<T>(dis(gen));
+		T z = static_cast<T>(dis(gen));
+
+		// Upper bits of the coordinates are ignored
+		T code2D = Nz::MortonEncode2D(x, y);
+		valid = valid && code2D == NaiveMortonEncode<T, 2>({ T(x & mask2D), T(y & mask2D) });
+		valid = valid && Nz::MortonDecode2D(code2D) == std::array<T, 2>{ T(x & mask2D), T(y & mask2D) };
+
+		T code3D = Nz::MortonEncode3D(x, y, z);
+		valid = valid && code3D == NaiveMortonEncode<T, 3>({ T(x & mask3D), T(y & mask3D), T(z & mask3D) });
+		valid = valid && Nz::MortonDecode3D(code3D) == std::array<T, 3>{ T(x & mask3D), T(y & mask3D), T(z & mask3D) };
+
+		// Unused upper bits of the code are ignored as well
+		valid = valid && Nz::MortonDecode3D(T(code3D | T(~Nz::MortonEncode3D<T>(mask3D, mask3D, mask3D)))) == Nz::MortonDecode3D(code3D);
+	}
+	CHECK(valid);
+}
+
+void TestHalfConversions()
+{
+	CHECK(Nz::FloatToHalf(1.f) == 0x3C00);
+	CHECK(Nz::FloatToHalf(-2.f) == 0xC000);
+	CHECK(Nz::FloatToHalf(0.f) == 0x0000);
+	CHECK(Nz::FloatToHalf(-0.f) == 0x8000);
+	CHECK(Nz::FloatToHalf(65504.f) == 0x7BFF);
+	CHECK(Nz::FloatToHalf(65519.99f) == 0x7BFF);
+	CHECK(Nz::FloatToHalf(65520.f) == 0x7C00);
+	CHECK(Nz::FloatToHalf(-1e10f) == 0xFC00);
+	CHECK(Nz::FloatToHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+	CHECK(Nz::FloatToHalf(std::numeric_limits<float>::quiet_NaN()) == 0x7E00);
+	CHECK(Nz::FloatToHalf(std::ldexp(1.f, -14)) == 0x0400);
+	CHECK(Nz::FloatToHalf(std::ldexp(1.f, -24)) == 0x0001);
+	CHECK(Nz::FloatToHalf(std::ldexp(1.f, -25)) == 0x0000); //< tie, rounds to even
+	CHECK(Nz::FloatToHalf(std::nextafter(std::ldexp(1.f, -25), 1.f)) == 0x0001);
+	CHECK(Nz::FloatToHalf(std::ldexp(1.5f, -24)) == 0x0002);
+	CHECK(Nz::FloatToHalf(std::ldexp(2.5f, -24)) == 0x0002);
+	CHECK(Nz::FloatToHalf(1.f + std::ldexp(1.f, -11)) == 0x3C00);
+	CHECK(Nz::FloatToHalf(1.f + std::ldexp(3.f, -11)) == 0x3C02);
+	CHECK(Nz::FloatToHalf(std::numeric_limits<float>::denorm_min()) == 0x0000);
+
+	CHECK(Nz::HalfToFloat(0x3C00) == 1.f);
+	CHECK(Nz::HalfToFloat(0x7BFF) == 65504.f);
+	CHECK(Nz::HalfToFloat(0x0001) == std::ldexp(1.f, -24));
+	CHECK(Nz::HalfToFloat(0x03FF) == std::ldexp(1023.f, -24));
+	CHECK(Nz::HalfToFloat(0xFC00) == -std::numeric_limits<float>::infinity());
+	CHECK(std::isnan(Nz::HalfToFloat(0x7C01)));
+
+	// Every half has to go through a float and back unchanged (NaNs become quiet)
+	std::vector<Nz::UInt16> halves(0x10000);
+	for (std::size_t i = 0; i < halves.size(); ++i)
+		halves[i] = Nz::UInt16(i);
+
+	std::vector<float> floats(halves.size());
+	Nz::HalfToFloat(halves.data(), floats.data(), halves.size());
+
+	std::vector<Nz::UInt16> roundTrip(halves.size());
+	Nz::FloatToHalf(floats.data(), roundTrip.data(), floats.size());
+
+	bool valid = true;
+	for (std::size_t i = 0; i < halves.size(); ++i)
+	{
+		valid = valid && Nz::BitCast<Nz::UInt32>(floats[i]) == Nz::BitCast<Nz::UInt32>(Nz::HalfToFloat(halves[i]));
+
+		bool isNaN = (halves[i] & 0x7C00) == 0x7C00 && (halves[i] & 0x03FF) != 0;
+		valid = valid && roundTrip[i] == (isNaN ? Nz::UInt16(halves[i] | 0x0200) : halves[i]);
+	}
+	CHECK(valid);
+
+	// Batch conversions of arbitrary floats have to match the scalar version
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<Nz::UInt32> dis;
+	for (std::size_t count : { 1, 7, 16, 33, 1000 })
+	{
+		std::vector<float> values(count);
+		for (float& value : values)
+			value = Nz::BitCast<float>(dis(gen));
+
+		std::vector<Nz::UInt16> converted(count);
+		Nz::FloatToHalf(values.data(), converted.data(), count);
+
+		bool matches = true;
+		for (std::size_t i = 0; i < count; ++i)
+			matches = matches && converted[i] == Nz::FloatToHalf(values[i]);
+
+		CHECK(matches);
+	}
+}
+
+template<typename T>
+bool SameBits(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+	return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+}
+
+template<typename T>
+void TestArrayMathOps()
+{
+	std::minstd_rand gen(42);
+	std::uniform_real_distribution<T> dis(T(-100.0), T(100.0));
+
+	for (std::size_t count : { 0, 1, 7, 16, 33, 64, 1000 })
+	{
+		std::vector<T> x(count);
+		std::vector<T> y(count);
+		std::vector<T> z(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			x[i] = dis(gen);
+			y[i] = dis(gen);
+			z[i] = dis(gen) / T(100.0);
+		}
+
+		// Special values have to behave exactly like the scalar versions
+		if (count >= 7)
+		{
+			x[1] = T(10.0);
+			x[2] = std::numeric_limits<T>::quiet_NaN();
+			x[3] = T(-0.0);
+			x[4] = std::numeric_limits<T>::infinity();
+			x[5] = -std::numeric_limits<T>::infinity();
+			x[6] = T(9.5);
+		}
+
+		std::vector<T> expected(count);
+		std::vector<T> output(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+			expected[i] = Nz::Approach(x[i], T(10.0), T(2.0));
+
+		Nz::Approach(x.data(), T(10.0), T(2.0), output.data(), count);
+		CHECK(SameBits(output, expected));
+
+		for (std::size_t i = 0; i < count; ++i)
+			expected[i] = Nz::Clamp(x[i], T(-50.0), T(0.0));
+
+		Nz::Clamp(x.data(), T(-50.0), T(0.0), output.data(), count);
+		CHECK(SameBits(output, expected));
+
+		output = x;
+		Nz::Clamp(output.data(), T(-50.0), T(0.0), output.data(), count);
+		CHECK(SameBits(output, expected));
+
+		std::vector<T> expectedArray(count);
+		std::vector<T> outputArray(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			expected[i] = Nz::Lerp(x[i], y[i], T(0.25));
+			expectedArray[i] = Nz::Lerp(x[i], y[i], z[i]);
+		}
+
+		Nz::Lerp(x.data(), y.data(), T(0.25), output.data(), count);
+		Nz::Lerp(x.data(), y.data(), z.data(), outputArray.data(), count);
+#if defined(FP_FAST_FMAF) || defined(FP_FAST_FMA)
+		// The compiler may contract the scalar version into a fused multiply-add
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (std::isnan(expected[i]))
+				continue;
+
+			CHECK(output[i] == Catch::Approx(expected[i]));
+			CHECK(outputArray[i] == Catch::Approx(expectedArray[i]));
+		}
+#else
+		CHECK(SameBits(output, expected));
+		CHECK(SameBits(outputArray, expectedArray));
+#endif
+
+		for (std::size_t i = 0; i < count; ++i)
+			expected[i] = Nz::MultiplyAdd(x[i], y[i], z[i]);
+
+		output = z;
+		Nz::MultiplyAdd(x.data(), y.data(), output.data(), output.data(), count);
+		CHECK(SameBits(output, expected));
+	}
+}
+
 SCENARIO("MathUtils", "[MathUtils]")
 {
 	WHEN("Testing ArithmeticRightShift")
@@ -94,6 +347,57 @@ SCENARIO("MathUtils", "[MathUtils]")
 		TestFindFirstBit<Nz::UInt64>();
 	}
 
+	WHEN("Testing bit operations on arrays")
+	{
+		TestArrayBitOps<Nz::UInt8>();
+		TestArrayBitOps<Nz::UInt16>();
+		TestArrayBitOps<Nz::UInt32>();
+		TestArrayBitOps<Nz::UInt64>();
+	}
+
+	WHEN("Testing math operations on arrays")
+	{
+		TestArrayMathOps<float>();
+		TestArrayMathOps<double>();
+
+		std::vector<int> values = { -5, 0, 3, 12, 42 };
+		std::vector<int> clamped(values.size());
+		Nz::Clamp(values.data(), 0, 10, clamped.data(), values.size());
+		CHECK(clamped == std::vector<int>{ 0, 0, 3, 10, 10 });
+
+		Nz::Approach(values.data(), 10, 4, clamped.data(), values.size());
+		CHECK(clamped == std::vector<int>{ -1, 4, 7, 10, 38 });
+	}
+
+	WHEN("Testing half-precision conversions")
+	{
+#ifdef NAZARA_HAS_CONSTEXPR_BITCAST
+		static_assert(Nz::FloatToHalf(0.5f) == 0x3800);
+		static_assert(Nz::HalfToFloat(0xC500) == -5.f);
+#endif
+
+		TestHalfConversions();
+	}
+
+	WHEN("Testing Morton codes")
+	{
+		TestMorton<Nz::UInt16>();
+		TestMorton<Nz::UInt32>();
+		TestMorton<Nz::UInt64>();
+	}
+
+	WHEN("Testing IntegralLog2")
+	{
+		static_assert(Nz::IntegralLog2(Nz::UInt32(1)) == 0);
+		static_assert(Nz::IntegralLog2(Nz::UInt32(0x80000000)) == 31);
+
+		CHECK(Nz::IntegralLog2(Nz::UInt32(5)) == 2);
+		CHECK(Nz::IntegralLog2(Nz::UInt64(1)) == 0);
+		CHECK(Nz::IntegralLog2(Nz::UInt64(1) << 32) == 32);
+		CHECK(Nz::IntegralLog2((Nz::UInt64(1) << 32) | 0xFF) == 32);
+		CHECK(Nz::IntegralLog2(Nz::UInt64(0xFFFFFFFFFFFFFFFF)) == 63);
+	}
+
 	WHEN("Testing Mod")
 	{
 #ifdef NAZARA_HAS_CONSTEVAL
@@ -0,0 +1,148 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	template<typename T>
+	bool IsAligned(const T* ptr, std::size_t alignment)
+	{
+		return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+	}
+
+	struct Counted
+	{
+		Counted(int v = 42) :
+		value(v)
+		{
+			if (value < 0)
+				throw std::runtime_error("negative value");
+
+			liveCount++;
+		}
+
+		~Counted()
+		{
+			liveCount--;
+		}
+
+		int value;
+
+		static int liveCount;
+	};
+
+	int Counted::liveCount = 0;
+}
+
+static_assert(Nz::AlignedAllocator<char, 64>::EffectiveAlignment == 64);
+static_assert(Nz::AlignedAllocator<double, 1>::EffectiveAlignment == alignof(double));
+static_assert(std::is_same_v<std::allocator_traits<Nz::AlignedAllocator<char, 32>>::rebind_alloc<int>, Nz::AlignedAllocator<int, 32>>);
+
+SCENARIO("MemoryHelper", "[CORE][MEMORYHELPER]")
+{
+	WHEN("Allocating aligned memory")
+	{
+		for (std::size_t alignment : { 1, 16, 64, 256, 4096 })
+		{
+			void* ptr = Nz::AllocateAligned(100, alignment);
+			REQUIRE(ptr);
+			CHECK(IsAligned(static_cast<const char*>(ptr), alignment));
+			Nz::FreeAligned(ptr, alignment);
+		}
+
+		Nz::FreeAligned(nullptr, 64);
+	}
+
+	WHEN("Using AlignedAllocator with containers")
+	{
+		std::vector<float, Nz::AlignedAllocator<float, 64>> values;
+		for (std::size_t i = 0; i < 1000; ++i)
+		{
+			values.push_back(float(i));
+			CHECK(IsAligned(values.data(), 64));
+		}
+
+		CHECK(values[999] == 999.f);
+
+		Nz::AlignedAllocator<float, 64> floatAllocator;
+		Nz::AlignedAllocator<int, 64> intAllocator(floatAllocator);
+		CHECK(floatAllocator == intAllocator);
+		CHECK(Nz::AlignedAllocator<int, 32>() != intAllocator);
+
+		Nz::Bitset<Nz::UInt64, Nz::AlignedAllocator<Nz::UInt64, 32>> bitset(1000, false);
+		bitset.Set(std::size_t(500));
+		bitset.Set(std::size_t(999));
+		CHECK(bitset.Count() == 2);
+		CHECK(bitset.FindFirst() == 500);
+	}
+
+	WHEN("Making aligned unique pointers")
+	{
+		{
+			auto ptr = Nz::MakeUniqueAligned<Counted, 128>(7);
+			CHECK(IsAligned(ptr.get(), 128));
+			CHECK(ptr->value == 7);
+			CHECK(Counted::liveCount == 1);
+
+			auto array = Nz::MakeUniqueAligned<Counted[], 256>(10);
+			CHECK(IsAligned(array.get(), 256));
+			CHECK(array[9].value == 42);
+			CHECK(Counted::liveCount == 11);
+
+			Nz::AlignedUniquePtr<Counted[], 256> moved = std::move(array);
+			CHECK(Counted::liveCount == 11);
+		}
+		CHECK(Counted::liveCount == 0);
+
+		CHECK_THROWS_AS((Nz::MakeUniqueAligned<Counted, 64>(-1)), std::runtime_error);
+		CHECK(Counted::liveCount == 0);
+	}
+
+	WHEN("Relocating objects")
+	{
+		AliveCounter::Counter counter;
+		{
+			alignas(AliveCounter) std::byte storage[8 * sizeof(AliveCounter)];
+			AliveCounter* objects = reinterpret_cast<AliveCounter*>(storage);
+			for (int i = 0; i < 4; ++i)
+				Nz::PlacementNew(&objects[i], &counter, i);
+
+			// Overlapping ranges, moving forward then backward
+			CHECK(Nz::RelocateRange(&objects[0], &objects[2], 4) == &objects[6]);
+			CHECK(counter.aliveCount == 4);
+			CHECK(counter.moveCount == 4);
+			for (int i = 0; i < 4; ++i)
+				CHECK(objects[i + 2] == i);
+
+			Nz::RelocateRange(&objects[2], &objects[1], 4);
+			CHECK(counter.aliveCount == 4);
+			for (int i = 0; i < 4; ++i)
+				CHECK(objects[i + 1] == i);
+
+			std::destroy(&objects[1], &objects[5]);
+		}
+		CHECK(counter.aliveCount == 0);
+
+		std::string strings[3] = { "A", "B", "C" };
+		alignas(std::string) std::byte stringStorage[3 * sizeof(std::string)];
+		std::string* relocatedStrings = reinterpret_cast<std::string*>(stringStorage);
+		for (std::size_t i = 0; i < 3; ++i)
+			Nz::PlacementNew(&relocatedStrings[i], strings[i]);
+
+		std::string* end = Nz::RelocateRange(relocatedStrings, relocatedStrings, 3);
+		CHECK(end == relocatedStrings + 3);
+		CHECK(std::equal(relocatedStrings, end, strings));
+		std::destroy(relocatedStrings, end);
+
+		int values[5] = { 1, 2, 3, 4, 5 };
+		Nz::RelocateRange(&values[0], &values[1], 4);
+		CHECK(values[1] == 1);
+		CHECK(values[4] == 4);
+		CHECK(Nz::RelocateRange(&values[0], &values[0], 0) == &values[0]);
+	}
+}
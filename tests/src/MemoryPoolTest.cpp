@@ -1,5 +1,11 @@
+#include <NazaraUtils/MappedFile.hpp>
 #include <NazaraUtils/MemoryPool.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -25,6 +31,49 @@ namespace
 		}
 	};
 
+	template<typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		explicit CountingAllocator(std::size_t& Counter) :
+		counter(&Counter)
+		{
+		}
+
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U>& allocator) :
+		counter(allocator.counter)
+		{
+		}
+
+		T* allocate(std::size_t n)
+		{
+			(*counter)++;
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n)
+		{
+			(*counter)--;
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template<typename U>
+		bool operator==(const CountingAllocator<U>& allocator) const
+		{
+			return counter == allocator.counter;
+		}
+
+		template<typename U>
+		bool operator!=(const CountingAllocator<U>& allocator) const
+		{
+			return counter != allocator.counter;
+		}
+
+		std::size_t* counter;
+	};
+
 	struct Vector2
 	{
 		Vector2(int X, int Y) :
@@ -160,5 +209,623 @@ SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 			CHECK(memoryPool.GetBlockCount() == 0);
 			CHECK(memoryPool.GetFreeEntryCount() == 0);
 		}
+
+		WHEN("We fill a lot of blocks and free entries in the middle")
+		{
+			constexpr std::size_t entryCount = 1000;
+
+			std::vector<std::size_t> indices(entryCount);
+			std::vector<T*> pointers(entryCount);
+			for (std::size_t i = 0; i < entryCount; ++i)
+			{
+				pointers[i] = memoryPool.Allocate(indices[i], int(i), 0);
+				CHECK(indices[i] == i);
+			}
+
+			bool retrieveFailure = false;
+			for (std::size_t i = 0; i < entryCount; ++i)
+			{
+				if (memoryPool.RetrieveEntryIndex(pointers[i]) != indices[i])
+					retrieveFailure = true;
+			}
+			CHECK_FALSE(retrieveFailure);
+
+			std::aligned_storage_t<sizeof(T), alignof(T)> outsider;
+			CHECK(memoryPool.RetrieveEntryIndex(reinterpret_cast<const T*>(&outsider)) == memoryPool.InvalidIndex);
+
+			CHECK(allocationCount == entryCount);
+			CHECK(memoryPool.GetBlockCount() == entryCount / 2);
+			CHECK(memoryPool.GetFreeEntryCount() == 0);
+
+			memoryPool.Free(indices[123]);
+			memoryPool.Free(indices[789]);
+			CHECK(memoryPool.GetFreeEntryCount() == 2);
+
+			THEN("Freed entries are reused before allocating new blocks")
+			{
+				std::size_t index1, index2, index3;
+				memoryPool.Allocate(index1, 1, 2);
+				memoryPool.Allocate(index2, 3, 4);
+				CHECK(index1 == 123);
+				CHECK(index2 == 789);
+				CHECK(memoryPool.GetBlockCount() == entryCount / 2);
+
+				memoryPool.Allocate(index3, 5, 6);
+				CHECK(index3 == entryCount);
+				CHECK(memoryPool.GetBlockCount() == entryCount / 2 + 1);
+			}
+
+			memoryPool.Reset();
+			CHECK(allocationCount == 0);
+			CHECK(memoryPool.GetFreeEntryCount() == memoryPool.GetBlockCount() * memoryPool.GetBlockSize());
+
+			AND_THEN("Every entry is available again after a reset")
+			{
+				std::size_t index;
+				memoryPool.Allocate(index, 1, 2);
+				CHECK(index == 0);
+				memoryPool.Allocate(index, 1, 2);
+				CHECK(index == 1);
+				memoryPool.Allocate(index, 1, 2);
+				CHECK(index == 2);
+				memoryPool.Reset();
+			}
+		}
+	}
+
+	GIVEN("A MemoryPool with blocks spanning multiple bitset words")
+	{
+		constexpr std::size_t blockSize = 100;
+
+		Nz::MemoryPool<Vector2> memoryPool(blockSize);
+
+		std::size_t index;
+		for (std::size_t i = 0; i < blockSize; ++i)
+		{
+			memoryPool.Allocate(index, int(i), 0);
+			CHECK(index == i);
+		}
+		CHECK(memoryPool.GetBlockCount() == 1);
+		CHECK(memoryPool.GetFreeEntryCount() == 0);
+
+		WHEN("We free entries from both words")
+		{
+			memoryPool.Free(70);
+			memoryPool.Free(5);
+			CHECK(memoryPool.GetFreeEntryCount() == 2);
+
+			THEN("The lowest free entries are reused without exceeding the block size")
+			{
+				memoryPool.Allocate(index, 1, 2);
+				CHECK(index == 5);
+				memoryPool.Allocate(index, 3, 4);
+				CHECK(index == 70);
+				CHECK(memoryPool.GetBlockCount() == 1);
+
+				memoryPool.Allocate(index, 5, 6);
+				CHECK(index == blockSize);
+				CHECK(memoryPool.GetBlockCount() == 2);
+			}
+		}
+
+		WHEN("We free and allocate entries in bulk")
+		{
+			std::vector<std::size_t> freedIndices;
+			for (std::size_t i = 10; i < 90; ++i)
+				freedIndices.push_back(i);
+
+			memoryPool.FreeBulk(freedIndices.data(), freedIndices.size());
+			CHECK(memoryPool.GetFreeEntryCount() == 80);
+
+			THEN("Bulk allocation reuses free entries in order before allocating new blocks")
+			{
+				std::vector<std::size_t> indices(150);
+				memoryPool.AllocateBulk(indices.size(), indices.data(), 42, 24);
+				CHECK(memoryPool.GetBlockCount() == 2);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 170);
+
+				for (std::size_t i = 0; i < 80; ++i)
+					CHECK(indices[i] == 10 + i);
+
+				for (std::size_t i = 80; i < indices.size(); ++i)
+					CHECK(indices[i] == blockSize + i - 80);
+
+				bool constructionFailure = false;
+				for (std::size_t index : indices)
+				{
+					if (!(*memoryPool.RetrieveFromIndex(index) == Vector2(42, 24)))
+						constructionFailure = true;
+				}
+				CHECK_FALSE(constructionFailure);
+
+				memoryPool.FreeBulk(indices.data() + 80, indices.size() - 80);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 100);
+				CHECK(memoryPool.GetFreeEntryCount() == blockSize);
+
+				memoryPool.Allocate(index, 1, 2);
+				CHECK(index == blockSize);
+			}
+		}
+	}
+
+	GIVEN("A sparse MemoryPool")
+	{
+		Nz::MemoryPool<Vector2> memoryPool(100);
+
+		std::vector<std::size_t> indices(1000);
+		memoryPool.AllocateBulk(indices.size(), indices.data(), 0, 0);
+
+		// Keep one entry out of seven and empty some blocks completely
+		std::vector<std::size_t> freedIndices;
+		for (std::size_t index : indices)
+		{
+			if (index % 7 == 0 && (index < 300 || index >= 600))
+				memoryPool.RetrieveFromIndex(index)->x = int(index);
+			else
+				freedIndices.push_back(index);
+		}
+		memoryPool.FreeBulk(freedIndices.data(), freedIndices.size());
+
+		std::vector<std::size_t> expectedIndices;
+		for (std::size_t index = 0; index < 1000; ++index)
+		{
+			if (index % 7 == 0 && (index < 300 || index >= 600))
+				expectedIndices.push_back(index);
+		}
+
+		WHEN("We iterate on every entry")
+		{
+			std::vector<std::size_t> visitedIndices;
+			memoryPool.ForEach([&](std::size_t index, Vector2& vec)
+			{
+				CHECK(vec.x == int(index));
+				visitedIndices.push_back(index);
+			});
+			CHECK(visitedIndices == expectedIndices);
+
+			std::size_t count = 0;
+			std::as_const(memoryPool).ForEach([&](const Vector2& /*vec*/)
+			{
+				count++;
+			});
+			CHECK(count == expectedIndices.size());
+		}
+
+		WHEN("We iterate on block ranges")
+		{
+			std::vector<std::size_t> visitedIndices;
+			for (std::size_t beginBlock = 0; beginBlock < memoryPool.GetBlockCount(); beginBlock += 3)
+			{
+				memoryPool.ForEachRange(beginBlock, beginBlock + 3, [&](std::size_t index, const Vector2& /*vec*/)
+				{
+					CHECK(index >= beginBlock * memoryPool.GetBlockSize());
+					CHECK(index < (beginBlock + 3) * memoryPool.GetBlockSize());
+					visitedIndices.push_back(index);
+				});
+			}
+			CHECK(visitedIndices == expectedIndices);
+		}
+
+		WHEN("We free entries while iterating")
+		{
+			memoryPool.ForEach([&](std::size_t index, Vector2& /*vec*/)
+			{
+				if (index % 2 == 0)
+					memoryPool.Free(index);
+			});
+
+			std::size_t count = 0;
+			for (std::size_t index : expectedIndices)
+			{
+				if (index % 2 != 0)
+					count++;
+			}
+			CHECK(memoryPool.GetAllocatedEntryCount() == count);
+		}
+	}
+
+	GIVEN("A fragmented MemoryPool")
+	{
+		Nz::MemoryPool<Vector2> memoryPool(4);
+
+		std::vector<std::size_t> indices(16);
+		memoryPool.AllocateBulk(indices.size(), indices.data(), 0, 0);
+		for (std::size_t i = 0; i < indices.size(); ++i)
+			memoryPool.RetrieveFromIndex(indices[i])->x = int(i);
+
+		CHECK(memoryPool.GetBlockCount() == 4);
+
+		// Keep entries 1, 6, 13 and 15 alive
+		for (std::size_t i : { 0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 14 })
+			memoryPool.Free(indices[i]);
+
+		WHEN("We shrink it without compacting")
+		{
+			memoryPool.ShrinkToFit();
+			CHECK(memoryPool.GetBlockCount() == 4);
+		}
+
+		WHEN("We compact it")
+		{
+			std::vector<std::pair<std::size_t, std::size_t>> relocations;
+			memoryPool.Compact([&](std::size_t oldIndex, std::size_t newIndex)
+			{
+				relocations.emplace_back(oldIndex, newIndex);
+			});
+
+			THEN("Entries from the last blocks were moved to the first free entries")
+			{
+				REQUIRE(relocations.size() == 3);
+				CHECK(relocations[0] == std::make_pair<std::size_t, std::size_t>(15, 0));
+				CHECK(relocations[1] == std::make_pair<std::size_t, std::size_t>(13, 2));
+				CHECK(relocations[2] == std::make_pair<std::size_t, std::size_t>(6, 3));
+				CHECK(memoryPool.RetrieveFromIndex(0)->x == 15);
+				CHECK(memoryPool.RetrieveFromIndex(1)->x == 1);
+				CHECK(memoryPool.RetrieveFromIndex(2)->x == 13);
+				CHECK(memoryPool.RetrieveFromIndex(3)->x == 6);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 4);
+			}
+
+			AND_THEN("Empty trailing blocks can be released")
+			{
+				memoryPool.ShrinkToFit();
+				CHECK(memoryPool.GetBlockCount() == 1);
+				CHECK(memoryPool.GetFreeEntryCount() == 0);
+
+				std::size_t index;
+				memoryPool.Allocate(index, 0, 0);
+				CHECK(index == 4);
+				CHECK(memoryPool.GetBlockCount() == 2);
+
+				std::size_t values = 0;
+				for (const Vector2& vec : memoryPool)
+					values += vec.x;
+
+				CHECK(values == 1 + 6 + 13 + 15);
+				CHECK(memoryPool.RetrieveEntryIndex(memoryPool.RetrieveFromIndex(3)) == 3);
+				CHECK(memoryPool.RetrieveEntryIndex(memoryPool.RetrieveFromIndex(4)) == 4);
+			}
+		}
+	}
+
+	GIVEN("A MemoryPool using a custom allocator")
+	{
+		std::size_t liveAllocations = 0;
+		{
+			using Pool = Nz::MemoryPool<Vector2, alignof(Vector2), Nz::MemoryPoolGenerationalPolicy, CountingAllocator<Vector2>>;
+
+			Pool memoryPool(64, CountingAllocator<Vector2>(liveAllocations));
+			CHECK(memoryPool.GetAllocator().counter == &liveAllocations);
+
+			// Block memory, block occupancy bitset and pool metadata all go through the allocator
+			std::size_t initialAllocations = liveAllocations;
+			CHECK(initialAllocations >= 3);
+
+			std::vector<std::size_t> indices(200);
+			memoryPool.AllocateBulk(indices.size(), indices.data(), 1, 2);
+			CHECK(memoryPool.GetBlockCount() == 4);
+			CHECK(liveAllocations > initialAllocations);
+
+			memoryPool.Clear();
+			memoryPool.ShrinkToFit();
+
+			Pool::Handle handle;
+			memoryPool.Allocate(handle, 3, 4);
+			CHECK(*memoryPool.TryRetrieve(handle) == Vector2(3, 4));
+		}
+		CHECK(liveAllocations == 0);
+	}
+
+	GIVEN("A MemoryPool with statistics")
+	{
+		using Pool = Nz::MemoryPool<Vector2, alignof(Vector2), Nz::MemoryPoolStatisticsPolicy>;
+
+		Pool memoryPool(64);
+		CHECK(memoryPool.GetStatistics().blockAllocationCount == 1);
+		CHECK(memoryPool.GetStatistics().peakBlockCount == 1);
+
+		std::vector<std::size_t> indices(100);
+		for (std::size_t& index : indices)
+			memoryPool.Allocate(index, 1, 2);
+
+		memoryPool.FreeBulk(indices.data(), 50);
+		memoryPool.Free(indices[50]);
+		memoryPool.AllocateBulk(10, indices.data(), 3, 4);
+
+		const Pool::Statistics& stats = memoryPool.GetStatistics();
+		CHECK(stats.allocationCount == 110);
+		CHECK(stats.freeCount == 51);
+		CHECK(stats.liveEntryCount == 59);
+		CHECK(stats.liveEntryCount == memoryPool.GetAllocatedEntryCount());
+		CHECK(stats.peakLiveEntryCount == 100);
+		CHECK(stats.blockAllocationCount == 2);
+		CHECK(stats.peakBlockCount == 2);
+		CHECK(stats.scannedBlockCount >= 100);
+		CHECK(stats.scannedWordCount >= stats.scannedBlockCount);
+
+		WHEN("We compact and shrink the pool")
+		{
+			memoryPool.Compact([](std::size_t, std::size_t) {});
+			memoryPool.ShrinkToFit();
+
+			CHECK(stats.relocationCount > 0);
+			CHECK(stats.blockReleaseCount == 1);
+			CHECK(memoryPool.GetBlockCount() == 1);
+		}
+
+		WHEN("We reset the pool and its statistics")
+		{
+			memoryPool.Reset();
+			CHECK(stats.freeCount == 110);
+			CHECK(stats.liveEntryCount == 0);
+
+			memoryPool.ResetStatistics();
+			CHECK(stats.allocationCount == 0);
+			CHECK(stats.freeCount == 0);
+			CHECK(stats.peakLiveEntryCount == 0);
+			CHECK(stats.peakBlockCount == 2);
+		}
+	}
+
+	GIVEN("A MemoryPool tracking generations")
+	{
+		using Pool = Nz::MemoryPool<Vector2, alignof(Vector2), Nz::MemoryPoolGenerationalPolicy>;
+
+		Pool memoryPool(2);
+
+		Pool::Handle handle1, handle2;
+		Vector2* vec1 = memoryPool.Allocate(handle1, 1, 2);
+		Vector2* vec2 = memoryPool.Allocate(handle2, 3, 4);
+		CHECK(handle1.index == 0);
+		CHECK(handle2.index == 1);
+		CHECK(memoryPool.IsValid(handle1));
+		CHECK(memoryPool.IsValid(handle2));
+		CHECK(memoryPool.TryRetrieve(handle1) == vec1);
+		CHECK(memoryPool.TryRetrieve(handle2) == vec2);
+		CHECK(memoryPool.GetHandle(handle1.index) == handle1);
+		CHECK(memoryPool.RetrieveEntryIndex(vec2) == handle2.index);
+		CHECK_FALSE(memoryPool.IsValid(Pool::Handle{}));
+
+		WHEN("We free an entry and reuse its slot")
+		{
+			memoryPool.Free(handle1);
+			CHECK_FALSE(memoryPool.IsValid(handle1));
+			CHECK(memoryPool.TryRetrieve(handle1) == nullptr);
+			CHECK(memoryPool.IsValid(handle2));
+
+			Pool::Handle handle3;
+			Vector2* vec3 = memoryPool.Allocate(handle3, 5, 6);
+			CHECK(handle3.index == handle1.index);
+			CHECK(handle3 != handle1);
+			CHECK(vec3 == vec1);
+
+			THEN("Only the newest handle is valid")
+			{
+				CHECK_FALSE(memoryPool.IsValid(handle1));
+				CHECK(memoryPool.TryRetrieve(handle3) == vec3);
+				CHECK(*memoryPool.TryRetrieve(handle3) == Vector2(5, 6));
+			}
+		}
+
+		WHEN("We reset the pool")
+		{
+			memoryPool.Reset();
+
+			THEN("Every handle is invalidated")
+			{
+				CHECK_FALSE(memoryPool.IsValid(handle1));
+				CHECK_FALSE(memoryPool.IsValid(handle2));
+			}
+		}
+
+		WHEN("We clear the pool and allocate again")
+		{
+			memoryPool.Clear();
+			CHECK(memoryPool.GetBlockCount() == 0);
+
+			Pool::Handle handle3;
+			memoryPool.Allocate(handle3, 5, 6);
+
+			THEN("Handles from released blocks stay invalid")
+			{
+				CHECK(handle3.index == handle1.index);
+				CHECK_FALSE(memoryPool.IsValid(handle1));
+				CHECK(memoryPool.IsValid(handle3));
+			}
+		}
+
+		WHEN("We free entries in bulk")
+		{
+			std::size_t indices[] = { handle1.index, handle2.index };
+			memoryPool.FreeBulk(indices, 2);
+
+			THEN("Their handles are invalidated")
+			{
+				CHECK_FALSE(memoryPool.IsValid(handle1));
+				CHECK_FALSE(memoryPool.IsValid(handle2));
+			}
+		}
+	}
+
+	GIVEN("A MemoryPool of over-aligned entries")
+	{
+		using Pool = Nz::MemoryPool<Nz::UInt32, 128, Nz::MemoryPoolGenerationalPolicy>;
+		Pool memoryPool(3);
+
+		std::vector<Pool::Handle> handles;
+		for (Nz::UInt32 i = 0; i < 10; ++i)
+		{
+			handles.emplace_back();
+			memoryPool.Allocate(handles.back(), i);
+		}
+
+		THEN("Every entry is aligned")
+		{
+			CHECK(memoryPool.GetBlockCount() == 4);
+			for (Nz::UInt32 i = 0; i < 10; ++i)
+			{
+				Nz::UInt32* entry = memoryPool.TryRetrieve(handles[i]);
+				REQUIRE(entry);
+				CHECK(*entry == i);
+				CHECK(reinterpret_cast<std::uintptr_t>(entry) % 128 == 0);
+			}
+		}
+	}
+
+	GIVEN("A MemoryPool of trivially copyable records")
+	{
+		struct Record
+		{
+			Nz::UInt32 id;
+			float x, y;
+		};
+
+		using Pool = Nz::MemoryPool<Record, alignof(Record), Nz::MemoryPoolGenerationalPolicy>;
+
+		// Blocks span multiple occupancy words, and some entries are freed to create holes
+		Pool memoryPool(100);
+
+		std::vector<Pool::Handle> handles(250);
+		for (Nz::UInt32 i = 0; i < 250; ++i)
+			memoryPool.Allocate(handles[i], Record{ i, float(i), float(i) * 2.f });
+
+		for (Nz::UInt32 i = 0; i < 250; i += 3)
+			memoryPool.Free(handles[i]);
+
+		for (std::size_t i = 60; i < 140; ++i)
+		{
+			if (i % 3 != 0)
+				memoryPool.Free(handles[i]);
+		}
+
+		std::size_t entryCount = memoryPool.GetAllocatedEntryCount();
+
+		std::vector<Nz::UInt8> buffer(memoryPool.GetSerializedSize());
+		Nz::ByteWriter writer(buffer.data(), buffer.size());
+		REQUIRE(memoryPool.Serialize(writer).IsOk());
+		CHECK(writer.GetCursor() == buffer.size());
+
+		// 26 bytes of header, then for each of the 3 blocks two occupancy words, allocated entries (16 bytes: generation and record)
+		// and the generations of free entries
+		static_assert(sizeof(Record) == 12);
+		CHECK(memoryPool.GetBlockCount() == 3);
+		CHECK(entryCount == 113);
+		CHECK(buffer.size() == 26 + 3 * 16 + entryCount * 16 + (300 - entryCount) * 4);
+
+		auto CheckRestoredPool = [&](const Pool& restoredPool)
+		{
+			CHECK(restoredPool.GetBlockSize() == 100);
+			CHECK(restoredPool.GetBlockCount() == memoryPool.GetBlockCount());
+			CHECK(restoredPool.GetAllocatedEntryCount() == entryCount);
+
+			for (Nz::UInt32 i = 0; i < 250; ++i)
+			{
+				const Record* original = memoryPool.TryRetrieve(handles[i]);
+				const Record* restored = restoredPool.TryRetrieve(handles[i]);
+				REQUIRE((original != nullptr) == (restored != nullptr));
+				if (restored)
+				{
+					CHECK(restored->id == i);
+					CHECK(restored->y == float(i) * 2.f);
+				}
+			}
+		};
+
+		WHEN("Restoring it in another pool")
+		{
+			Pool restoredPool(16);
+			Pool::Handle previousHandle;
+			restoredPool.Allocate(previousHandle, Record{ 1000, 0.f, 0.f });
+
+			Nz::ByteReader reader(buffer.data(), buffer.size());
+			REQUIRE(restoredPool.Deserialize(reader).IsOk());
+			CHECK(reader.IsAtEnd());
+
+			CheckRestoredPool(restoredPool);
+
+			AND_THEN("It can be used as the original pool")
+			{
+				restoredPool.Free(handles[1]);
+				CHECK_FALSE(restoredPool.IsValid(handles[1]));
+
+				Pool::Handle handle;
+				restoredPool.Allocate(handle, Record{ 2000, 0.f, 0.f });
+				CHECK(handle.index == 0); //< first free entry
+				CHECK(handle != handles[0]);
+				CHECK_FALSE(restoredPool.IsValid(handles[0]));
+			}
+		}
+
+		WHEN("Restoring it from a memory-mapped file")
+		{
+			std::filesystem::path filePath = std::filesystem::temp_directory_path() / "NazaraUtilsMemoryPoolTest.bin";
+			{
+				std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+				file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+			}
+
+			{
+				Nz::MappedFile file = Nz::MappedFile::Open(filePath).GetValue();
+
+				Pool restoredPool(100);
+				Nz::ByteReader reader(file.GetData(), file.GetSize());
+				REQUIRE(restoredPool.Deserialize(reader).IsOk());
+
+				CheckRestoredPool(restoredPool);
+			}
+
+			std::filesystem::remove(filePath);
+		}
+
+		WHEN("Restoring a truncated or incompatible snapshot")
+		{
+			Pool restoredPool(100);
+
+			Nz::ByteReader truncatedReader(buffer.data(), buffer.size() - 1);
+			CHECK(restoredPool.Deserialize(truncatedReader).GetError() == Nz::ByteStreamError::EndOfBuffer);
+			CHECK(restoredPool.GetBlockCount() == 0);
+			CHECK(restoredPool.GetAllocatedEntryCount() == 0);
+
+			Nz::MemoryPool<Record> otherPool(100);
+			Nz::ByteReader reader(buffer.data(), buffer.size());
+			CHECK(otherPool.Deserialize(reader).GetError() == Nz::ByteStreamError::InvalidData);
+
+			// Flip an occupancy bit, the generation of this entry no longer matches
+			std::vector<Nz::UInt8> corruptedBuffer = buffer;
+			corruptedBuffer[26] ^= 1;
+			Nz::ByteReader corruptedReader(corruptedBuffer.data(), corruptedBuffer.size());
+			CHECK(restoredPool.Deserialize(corruptedReader).IsErr());
+		}
+
+		WHEN("Serializing to a too small buffer")
+		{
+			std::vector<Nz::UInt8> smallBuffer(buffer.size() - 1);
+			Nz::ByteWriter smallWriter(smallBuffer.data(), smallBuffer.size());
+			CHECK(memoryPool.Serialize(smallWriter).GetError() == Nz::ByteStreamError::EndOfBuffer);
+		}
+	}
+
+	GIVEN("An empty MemoryPool without generations")
+	{
+		Nz::MemoryPool<Nz::UInt64> memoryPool(8);
+		memoryPool.Clear();
+
+		std::vector<Nz::UInt8> buffer(memoryPool.GetSerializedSize());
+		Nz::ByteWriter writer(buffer.data(), buffer.size(), Nz::Endianness::BigEndian);
+		REQUIRE(memoryPool.Serialize(writer).IsOk());
+		CHECK(buffer.size() == 26); //< header only
+
+		Nz::MemoryPool<Nz::UInt64> restoredPool(4);
+		std::size_t index;
+		restoredPool.Allocate(index, 42);
+
+		Nz::ByteReader reader(buffer.data(), buffer.size(), Nz::Endianness::BigEndian);
+		REQUIRE(restoredPool.Deserialize(reader).IsOk());
+		CHECK(restoredPool.GetBlockSize() == 8);
+		CHECK(restoredPool.GetBlockCount() == 0);
+		CHECK(restoredPool.GetAllocatedEntryCount() == 0);
+
+		restoredPool.Allocate(index, 42);
+		CHECK(index == 0);
 	}
 }
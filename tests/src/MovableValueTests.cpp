@@ -18,6 +18,11 @@ namespace
 	};
 }
 
+static_assert(Nz::IsTriviallyRelocatable_v<Nz::MovableLiteral<int, -1>>);
+static_assert(Nz::IsTriviallyRelocatable_v<Nz::MovableValue<Nz::MovableLiteral<int, -1>>>);
+static_assert(!std::is_trivially_copyable_v<Nz::MovableLiteral<int, -1>>);
+static_assert(!Nz::IsTriviallyRelocatable_v<Nz::MovableValue<CopyCounter>>);
+
 SCENARIO("MovableLiteral", "[MovableValue]")
 {
 	WHEN("testing constructors")
@@ -0,0 +1,157 @@
+#include <NazaraUtils/MpmcQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("MpmcQueue", "[CORE][MPMCQUEUE]")
+{
+	GIVEN("A queue of strings")
+	{
+		Nz::MpmcQueue<std::string, 4> queue;
+		CHECK(queue.IsEmpty());
+		CHECK(queue.GetCapacity() == 4);
+
+		std::string value;
+		CHECK_FALSE(queue.TryPop(value));
+
+		WHEN("We fill it")
+		{
+			CHECK(queue.TryPush("a"));
+			CHECK(queue.TryEmplace(3, 'b'));
+			CHECK(queue.TryPush(std::string("c")));
+			CHECK(queue.TryPush("d"));
+			CHECK_FALSE(queue.TryPush("e"));
+			CHECK(queue.GetSize() == 4);
+
+			CHECK(queue.TryPop(value));
+			CHECK(value == "a");
+			CHECK(queue.TryPop(value));
+			CHECK(value == "bbb");
+
+			CHECK(queue.TryPush("e"));
+			CHECK(queue.TryPush("f"));
+
+			std::array<std::string, 8> values;
+			CHECK(queue.TryPopN(values.begin(), values.size()) == 4);
+			CHECK(values[0] == "c");
+			CHECK(values[3] == "f");
+			CHECK(queue.IsEmpty());
+		}
+
+		WHEN("We push in batches")
+		{
+			std::vector<std::string> values = { "a", "b", "c", "d", "e", "f" };
+			CHECK(queue.TryPushN(values.begin(), values.size()) == 4);
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 0);
+
+			std::vector<std::string> output;
+			CHECK(queue.TryPopN(std::back_inserter(output), 3) == 3);
+			CHECK(output == std::vector<std::string>{ "a", "b", "c" });
+
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 2);
+			CHECK(queue.GetSize() == 3);
+		}
+	}
+
+	GIVEN("A queue of non-trivial types")
+	{
+		auto value = std::make_shared<int>(42);
+		{
+			Nz::MpmcQueue<std::shared_ptr<int>, 8> queue;
+			for (int i = 0; i < 5; ++i)
+				CHECK(queue.TryPush(value));
+
+			CHECK(value.use_count() == 6);
+
+			std::shared_ptr<int> popped;
+			CHECK(queue.TryPop(popped));
+			CHECK(popped == value);
+			CHECK(value.use_count() == 6);
+		}
+		CHECK(value.use_count() == 1);
+	}
+
+	GIVEN("Multiple producer and consumer threads")
+	{
+		constexpr std::size_t ThreadCount = 4;
+		constexpr std::size_t ValuePerThread = 50'000;
+
+		auto queue = std::make_unique<Nz::MpmcQueue<std::size_t, 128>>();
+
+		std::vector<std::thread> producers;
+		for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+		{
+			producers.emplace_back([&, threadIndex]
+			{
+				std::array<std::size_t, 8> batch;
+				std::size_t value = 0;
+				while (value < ValuePerThread)
+				{
+					std::size_t count = std::min(batch.size(), ValuePerThread - value);
+					for (std::size_t i = 0; i < count; ++i)
+						batch[i] = threadIndex * ValuePerThread + value + i;
+
+					if (value % 2 == 0)
+						value += queue->TryPushN(batch.begin(), count);
+					else if (queue->TryPush(batch[0]))
+						value++;
+				}
+			});
+		}
+
+		std::atomic<std::size_t> poppedCount = 0;
+		std::vector<std::vector<std::size_t>> popped(ThreadCount);
+		std::vector<std::thread> consumers;
+		for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+		{
+			consumers.emplace_back([&, threadIndex]
+			{
+				std::array<std::size_t, 8> batch;
+				while (poppedCount.load() < ThreadCount * ValuePerThread)
+				{
+					std::size_t count = queue->TryPopN(batch.begin(), batch.size());
+					popped[threadIndex].insert(popped[threadIndex].end(), batch.begin(), batch.begin() + count);
+					poppedCount += count;
+				}
+			});
+		}
+
+		for (std::thread& thread : producers)
+			thread.join();
+
+		for (std::thread& thread : consumers)
+			thread.join();
+
+		// every value must have been popped exactly once, in order for each producer as seen by a given consumer
+		std::vector<bool> seen(ThreadCount * ValuePerThread, false);
+		bool valid = true;
+		for (const std::vector<std::size_t>& values : popped)
+		{
+			std::vector<std::size_t> lastValues(ThreadCount, 0);
+			std::vector<bool> first(ThreadCount, true);
+			for (std::size_t value : values)
+			{
+				if (seen[value])
+					valid = false;
+
+				seen[value] = true;
+
+				std::size_t producer = value / ValuePerThread;
+				if (!first[producer] && value <= lastValues[producer])
+					valid = false;
+
+				first[producer] = false;
+				lastValues[producer] = value;
+			}
+		}
+
+		CHECK(valid);
+		CHECK(std::find(seen.begin(), seen.end(), false) == seen.end());
+		CHECK(queue->IsEmpty());
+	}
+}
@@ -0,0 +1,82 @@
+#include <NazaraUtils/PackedTuple.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+namespace
+{
+	struct Unlucky
+	{
+		char a;
+		double b;
+		char c;
+		int d;
+		short e;
+	};
+
+	using PackedUnlucky = Nz::PackedTuple<char, double, char, int, short>;
+
+	static_assert(sizeof(PackedUnlucky) < sizeof(Unlucky));
+	static_assert(sizeof(PackedUnlucky) == 2 * sizeof(double));
+	static_assert(sizeof(Nz::PackedTuple<char, double, char>) == 2 * sizeof(double));
+	static_assert(sizeof(Nz::PackedTuple<int>) == sizeof(int));
+	static_assert(std::is_trivially_copyable_v<PackedUnlucky>);
+	static_assert(std::is_same_v<PackedUnlucky::StorageTypes, Nz::TypeList<double, int, short, char, char>>);
+	static_assert(PackedUnlucky::GetStorageIndex<0>() == 3);
+	static_assert(PackedUnlucky::GetStorageIndex<1>() == 0);
+	static_assert(PackedUnlucky::GetStorageIndex<2>() == 4);
+	static_assert(std::tuple_size_v<PackedUnlucky> == 5);
+	static_assert(std::is_same_v<std::tuple_element_t<3, PackedUnlucky>, int>);
+
+	constexpr PackedUnlucky constexprTuple('a', 1.5, 'c', 4, short(5));
+	static_assert(constexprTuple.Get<0>() == 'a');
+	static_assert(constexprTuple.Get<1>() == 1.5);
+	static_assert(Nz::get<3>(constexprTuple) == 4);
+}
+
+SCENARIO("PackedTuple", "[PackedTuple]")
+{
+	WHEN("Using trivial members")
+	{
+		PackedUnlucky tuple('x', 3.0, 'y', 42, short(-7));
+		CHECK(tuple.Get<0>() == 'x');
+		CHECK(tuple.Get<1>() == 3.0);
+		CHECK(tuple.Get<2>() == 'y');
+		CHECK(tuple.Get<3>() == 42);
+		CHECK(tuple.Get<4>() == -7);
+
+		tuple.Get<3>() = 1337;
+		CHECK(tuple.Get<3>() == 1337);
+
+		auto& [a, b, c, d, e] = tuple;
+		CHECK(a == 'x');
+		CHECK(b == 3.0);
+		CHECK(c == 'y');
+		CHECK(d == 1337);
+		CHECK(e == -7);
+
+		PackedUnlucky defaultTuple;
+		CHECK(defaultTuple.Get<0>() == 0);
+		CHECK(defaultTuple.Get<1>() == 0.0);
+		CHECK(defaultTuple.Get<3>() == 0);
+
+		defaultTuple = tuple;
+		CHECK(defaultTuple.Get<4>() == -7);
+	}
+
+	WHEN("Using non-trivial members")
+	{
+		Nz::PackedTuple<bool, std::string, std::unique_ptr<int>> tuple(true, "Hello", std::make_unique<int>(42));
+		CHECK(tuple.Get<0>());
+		CHECK(tuple.Get<1>() == "Hello");
+		CHECK(*tuple.Get<2>() == 42);
+
+		Nz::PackedTuple<bool, std::string, std::unique_ptr<int>> moved = std::move(tuple);
+		CHECK(moved.Get<1>() == "Hello");
+		CHECK(*moved.Get<2>() == 42);
+		CHECK(tuple.Get<2>() == nullptr);
+
+		std::unique_ptr<int> ptr = Nz::get<2>(std::move(moved));
+		CHECK(*ptr == 42);
+	}
+}
@@ -0,0 +1,204 @@
+#include <NazaraUtils/ParallelAlgorithm.hpp>
+#include <NazaraUtils/SparsePtr.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+SCENARIO("ParallelAlgorithm", "[CORE][PARALLELALGORITHM]")
+{
+	Nz::TaskScheduler scheduler(3);
+
+	WHEN("We run a parallel for over indices")
+	{
+		std::vector<int> values(10'000, 0);
+		Nz::ParallelFor(scheduler, std::size_t(0), values.size(), 100, [&](std::size_t i) { values[i] = int(i) * 2; });
+
+		bool allSet = true;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (values[i] != int(i) * 2)
+				allSet = false;
+		}
+		CHECK(allSet);
+
+		std::atomic<int> callCount = 0;
+		Nz::ParallelFor(scheduler, 5, 5, 0, [&](int) { callCount++; });
+		CHECK(callCount == 0);
+
+		Nz::ParallelFor(scheduler, -10, 10, 0, [&](int) { callCount++; });
+		CHECK(callCount == 20);
+	}
+
+	WHEN("We run a parallel for over iterators and sparse pointers")
+	{
+		std::vector<int> values(5000);
+		std::iota(values.begin(), values.end(), 0);
+
+		Nz::ParallelFor(scheduler, values.begin(), values.end(), 0, [](int& value) { value += 1; });
+		CHECK(values.front() == 1);
+		CHECK(values.back() == 5000);
+
+		struct Vertex
+		{
+			float position;
+			int color;
+		};
+
+		std::vector<Vertex> vertices(3000, Vertex{ 0.f, 0 });
+		Nz::SparsePtr<int> colors(&vertices[0].color, sizeof(Vertex));
+		Nz::ParallelFor(scheduler, colors, colors + vertices.size(), 64, [](int& color) { color = 42; });
+
+		bool allSet = true;
+		for (const Vertex& vertex : vertices)
+		{
+			if (vertex.color != 42 || vertex.position != 0.f)
+				allSet = false;
+		}
+		CHECK(allSet);
+	}
+
+	WHEN("We run a parallel reduce")
+	{
+		std::size_t sum = Nz::ParallelReduce(scheduler, std::size_t(0), std::size_t(100'000), 0, std::size_t(0), [](std::size_t lhs, std::size_t rhs) { return lhs + rhs; });
+		CHECK(sum == 100'000ull * 99'999ull / 2);
+
+		std::vector<float> values(4096, 0.5f);
+		float floatSum = Nz::ParallelReduce(scheduler, values.begin(), values.end(), 256, 0.f, [](float lhs, float rhs) { return lhs + rhs; });
+		CHECK(floatSum == 2048.f);
+
+		// Non-commutative combination must keep the range order
+		std::string letters = Nz::ParallelReduce(scheduler, 0, 26, 1, std::string{},
+			[](std::string acc, int i) { acc += char('a' + i); return acc; },
+			[](std::string lhs, const std::string& rhs) { return lhs + rhs; });
+		CHECK(letters == "abcdefghijklmnopqrstuvwxyz");
+
+		CHECK(Nz::ParallelReduce(scheduler, 0, 0, 0, 7, [](int lhs, int rhs) { return lhs + rhs; }) == 7);
+	}
+
+	WHEN("We iterate in parallel on the bits set of a bitset")
+	{
+		Nz::Bitset<Nz::UInt64> bitset(10'000, false);
+		std::size_t expectedSum = 0;
+		for (std::size_t i = 0; i < bitset.GetSize(); i += 3)
+		{
+			bitset.Set(i);
+			expectedSum += i;
+		}
+
+		std::atomic<std::size_t> sum = 0;
+		std::atomic<std::size_t> count = 0;
+		Nz::ParallelForEachSetBit(scheduler, bitset, 100, [&](std::size_t bit)
+		{
+			sum += bit;
+			count++;
+		});
+		CHECK(count == bitset.Count());
+		CHECK(sum == expectedSum);
+
+		Nz::Bitset<Nz::UInt64> emptyBitset;
+		Nz::ParallelForEachSetBit(scheduler, emptyBitset, 0, [&](std::size_t) { count++; });
+		CHECK(count == bitset.Count());
+	}
+
+	WHEN("We run whole-bitset operations in parallel")
+	{
+		// Sizes not multiple of the block size to check extra bits, grain sizes force a few chunks (not aligned on cache lines)
+		Nz::Bitset<Nz::UInt32> a(100'003, false);
+		Nz::Bitset<Nz::UInt32> b(70'001, false);
+		for (std::size_t i = 0; i < a.GetSize(); i += 7)
+			a.Set(i);
+
+		for (std::size_t i = 5; i < b.GetSize(); i += 3)
+			b.Set(i);
+
+		for (std::size_t grainSize : { std::size_t(0), std::size_t(1), std::size_t(5'000) })
+		{
+			CHECK(Nz::ParallelCount(scheduler, a, grainSize) == a.Count());
+			CHECK(Nz::ParallelCount(scheduler, b, grainSize) == b.Count());
+
+			std::vector<std::size_t> expectedBits(a.Count());
+			a.ExtractSetBits(expectedBits.data());
+
+			std::vector<std::size_t> bits(a.Count());
+			CHECK(Nz::ParallelExtractSetBits(scheduler, a, bits.data(), grainSize) == bits.data() + bits.size());
+			CHECK(bits == expectedBits);
+
+			auto CheckOperation = [&](auto&& parallelOp, auto&& serialOp)
+			{
+				Nz::Bitset<Nz::UInt32> expected;
+				serialOp(expected, a, b);
+
+				Nz::Bitset<Nz::UInt32> result;
+				parallelOp(result, a, b);
+				CHECK(result == expected);
+
+				parallelOp(result, b, a);
+				serialOp(expected, b, a);
+				CHECK(result == expected);
+
+				// Result aliasing an operand
+				Nz::Bitset<Nz::UInt32> aliased = b;
+				parallelOp(aliased, aliased, a);
+				serialOp(expected, b, a);
+				CHECK(aliased == expected);
+
+				aliased = a;
+				parallelOp(aliased, b, aliased);
+				serialOp(expected, b, a);
+				CHECK(aliased == expected);
+			};
+
+			CheckOperation([&](auto& r, const auto& x, const auto& y) { Nz::ParallelPerformsAND(scheduler, r, x, y, grainSize); }, [](auto& r, const auto& x, const auto& y) { r.PerformsAND(x, y); });
+			CheckOperation([&](auto& r, const auto& x, const auto& y) { Nz::ParallelPerformsANDNOT(scheduler, r, x, y, grainSize); }, [](auto& r, const auto& x, const auto& y) { r.PerformsANDNOT(x, y); });
+			CheckOperation([&](auto& r, const auto& x, const auto& y) { Nz::ParallelPerformsOR(scheduler, r, x, y, grainSize); }, [](auto& r, const auto& x, const auto& y) { r.PerformsOR(x, y); });
+			CheckOperation([&](auto& r, const auto& x, const auto& y) { Nz::ParallelPerformsXOR(scheduler, r, x, y, grainSize); }, [](auto& r, const auto& x, const auto& y) { r.PerformsXOR(x, y); });
+
+			Nz::Bitset<Nz::UInt32> negated;
+			Nz::ParallelPerformsNOT(scheduler, negated, a, grainSize);
+			CHECK(negated == ~a);
+			CHECK(Nz::ParallelCount(scheduler, negated, grainSize) == a.GetSize() - a.Count());
+
+			Nz::Bitset<Nz::UInt32> sparse(a.GetSize(), false);
+			CHECK(Nz::ParallelFindFirst(scheduler, sparse, grainSize) == sparse.npos);
+			for (std::size_t bit : { std::size_t(99'999), std::size_t(40'000), std::size_t(31), std::size_t(0) })
+			{
+				sparse.Set(bit);
+				CHECK(Nz::ParallelFindFirst(scheduler, sparse, grainSize) == bit);
+			}
+		}
+
+		Nz::Bitset<Nz::UInt32> emptyBitset;
+		CHECK(Nz::ParallelCount(scheduler, emptyBitset, 0) == 0);
+		CHECK(Nz::ParallelFindFirst(scheduler, emptyBitset, 0) == emptyBitset.npos);
+
+		Nz::ParallelPerformsOR(scheduler, emptyBitset, emptyBitset, emptyBitset, 0);
+		CHECK(emptyBitset.GetSize() == 0);
+	}
+
+	WHEN("We iterate in parallel on the entries of a memory pool")
+	{
+		Nz::MemoryPool<int> memoryPool(64);
+
+		std::vector<std::size_t> indices(1000);
+		memoryPool.AllocateBulk(indices.size(), indices.data(), 1);
+		for (std::size_t index = 0; index < indices.size(); index += 2)
+			memoryPool.Free(index);
+
+		Nz::ParallelForEachEntry(scheduler, memoryPool, 1, [](std::size_t index, int& value) { value = int(index); });
+
+		std::atomic<std::size_t> count = 0;
+		std::atomic<bool> mismatch = false;
+		Nz::ParallelForEachEntry(scheduler, std::as_const(memoryPool), 0, [&](std::size_t index, const int& value)
+		{
+			if (value != int(index) || index % 2 == 0)
+				mismatch = true;
+
+			count++;
+		});
+		CHECK(count == 500);
+		CHECK_FALSE(mismatch);
+	}
+}
@@ -0,0 +1,249 @@
+#include <NazaraUtils/PoolMemoryResource.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef NAZARA_HAS_MEMORY_RESOURCE
+
+#include <NazaraUtils/Bitset.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	class CountingResource : public std::pmr::memory_resource
+	{
+		public:
+			// Pool blocks of different size classes may be allocated concurrently
+			std::atomic_size_t allocationCount = 0;
+			std::atomic_size_t liveAllocationCount = 0;
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override
+			{
+				allocationCount++;
+				liveAllocationCount++;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+			{
+				liveAllocationCount--;
+				std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+	};
+}
+
+SCENARIO("PoolMemoryResource", "[CORE][POOLMEMORYRESOURCE]")
+{
+	CountingResource upstream;
+
+	for (bool enableThreadCache : { false, true })
+	{
+		GIVEN("A resource " + std::string((enableThreadCache) ? "with" : "without") + " thread cache")
+		{
+			{
+				Nz::PoolMemoryResource resource(&upstream, enableThreadCache);
+				CHECK(resource.GetUpstreamResource() == &upstream);
+				CHECK(resource.IsThreadCacheEnabled() == enableThreadCache);
+				CHECK(resource.is_equal(resource));
+
+				WHEN("Allocating from every size class")
+				{
+					std::vector<std::pair<void*, std::size_t>> allocations;
+					for (std::size_t size = 1; size <= Nz::PoolMemoryResource::MaxPooledSize; size *= 2)
+					{
+						for (std::size_t i = 0; i < 100; ++i)
+						{
+							void* ptr = resource.allocate(size, alignof(std::max_align_t));
+							CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t) == 0);
+							std::memset(ptr, 0xCD, size);
+
+							allocations.emplace_back(ptr, size);
+						}
+					}
+
+					// Alignment up to the size class is respected
+					void* aligned = resource.allocate(64, 64);
+					CHECK(reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0);
+					resource.deallocate(aligned, 64, 64);
+
+					void* overaligned = resource.allocate(8, 256);
+					CHECK(reinterpret_cast<std::uintptr_t>(overaligned) % 256 == 0);
+					resource.deallocate(overaligned, 8, 256);
+
+					// Entries are reused after being freed
+					std::size_t upstreamAllocationCount = upstream.allocationCount;
+					for (auto it = allocations.rbegin(); it != allocations.rend(); ++it)
+						resource.deallocate(it->first, it->second, alignof(std::max_align_t));
+
+					for (std::size_t size = 1; size <= Nz::PoolMemoryResource::MaxPooledSize; size *= 2)
+					{
+						for (std::size_t i = 0; i < 100; ++i)
+							resource.deallocate(resource.allocate(size, alignof(std::max_align_t)), size, alignof(std::max_align_t));
+					}
+
+					CHECK(upstream.allocationCount == upstreamAllocationCount);
+				}
+
+				WHEN("Allocating more than MaxPooledSize")
+				{
+					std::size_t upstreamAllocationCount = upstream.allocationCount;
+					std::size_t upstreamLiveAllocationCount = upstream.liveAllocationCount;
+
+					void* ptr = resource.allocate(Nz::PoolMemoryResource::MaxPooledSize + 1);
+					CHECK(upstream.allocationCount == upstreamAllocationCount + 1);
+					CHECK(upstream.liveAllocationCount == upstreamLiveAllocationCount + 1);
+
+					resource.deallocate(ptr, Nz::PoolMemoryResource::MaxPooledSize + 1);
+					CHECK(upstream.liveAllocationCount == upstreamLiveAllocationCount);
+				}
+
+				WHEN("Using std::pmr containers")
+				{
+					std::pmr::vector<int> vec(&resource);
+					std::pmr::unordered_map<int, std::pmr::string> map(&resource);
+					for (int i = 0; i < 10'000; ++i)
+					{
+						vec.push_back(i);
+						map.emplace(i, std::to_string(i) + " is a long enough string to be allocated");
+					}
+
+					for (int i = 0; i < 10'000; i += 2)
+						map.erase(i);
+
+					CHECK(vec.size() == 10'000);
+					CHECK(vec[4242] == 4242);
+					CHECK(map.size() == 5'000);
+					CHECK(map.at(4243) == "4243 is a long enough string to be allocated");
+					CHECK(map.get_allocator().resource() == &resource);
+				}
+
+				WHEN("Using a Bitset with a polymorphic allocator")
+				{
+					Nz::Bitset<Nz::UInt64, std::pmr::polymorphic_allocator<Nz::UInt64>> bitset{ std::pmr::polymorphic_allocator<Nz::UInt64>(&resource) };
+					bitset.Resize(1000, false);
+					bitset.Set(42, true);
+					bitset.Set(999, true);
+
+					CHECK(bitset.Count() == 2);
+					CHECK(bitset.FindFirst() == 42);
+					CHECK(bitset.FindNext(42) == 999);
+				}
+
+				WHEN("Allocating and freeing from multiple threads")
+				{
+					constexpr std::size_t ThreadCount = 4;
+
+					std::atomic_bool failed = false;
+					std::vector<std::thread> threads;
+					for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+					{
+						threads.emplace_back([&, threadIndex]
+						{
+							std::vector<std::pair<Nz::UInt64*, std::size_t>> allocations;
+							for (std::size_t i = 0; i < 20'000; ++i)
+							{
+								std::size_t size = (8 << (i % 6)) / sizeof(Nz::UInt64);
+								Nz::UInt64* ptr = static_cast<Nz::UInt64*>(resource.allocate(size * sizeof(Nz::UInt64), alignof(Nz::UInt64)));
+								for (std::size_t j = 0; j < size; ++j)
+									ptr[j] = threadIndex;
+
+								allocations.emplace_back(ptr, size);
+
+								if (i % 3 == 0)
+								{
+									auto [freedPtr, freedSize] = allocations[allocations.size() / 2];
+									allocations[allocations.size() / 2] = allocations.back();
+									allocations.pop_back();
+
+									for (std::size_t j = 0; j < freedSize; ++j)
+									{
+										if (freedPtr[j] != threadIndex)
+											failed = true;
+									}
+
+									resource.deallocate(freedPtr, freedSize * sizeof(Nz::UInt64), alignof(Nz::UInt64));
+								}
+							}
+
+							for (auto [ptr, size] : allocations)
+								resource.deallocate(ptr, size * sizeof(Nz::UInt64), alignof(Nz::UInt64));
+						});
+					}
+
+					for (std::thread& thread : threads)
+						thread.join();
+
+					CHECK_FALSE(failed);
+				}
+
+				WHEN("Freeing from another thread than the allocating one")
+				{
+					std::vector<void*> allocations;
+					for (std::size_t i = 0; i < 1000; ++i)
+						allocations.push_back(resource.allocate(32));
+
+					std::thread([&]
+					{
+						for (void* ptr : allocations)
+							resource.deallocate(ptr, 32);
+
+						for (std::size_t i = 0; i < 100; ++i)
+							resource.deallocate(resource.allocate(32), 32);
+					}).join();
+
+					for (std::size_t i = 0; i < 1000; ++i)
+						allocations[i] = resource.allocate(32);
+
+					for (void* ptr : allocations)
+						resource.deallocate(ptr, 32);
+				}
+			}
+
+			// Every pool block was given back to upstream
+			CHECK(upstream.liveAllocationCount == 0);
+		}
+	}
+
+	WHEN("Using two resources with a thread cache from the same thread")
+	{
+		{
+			Nz::PoolMemoryResource first(&upstream, true);
+			Nz::PoolMemoryResource second(&upstream, true);
+
+			for (std::size_t i = 0; i < 100; ++i)
+			{
+				void* firstPtr = first.allocate(16);
+				void* secondPtr = second.allocate(16);
+				CHECK(firstPtr != secondPtr);
+
+				// Entries cached for one resource must not be used by the other
+				first.deallocate(firstPtr, 16);
+				second.deallocate(secondPtr, 16);
+			}
+
+			{
+				Nz::PoolMemoryResource third(&upstream, true);
+				third.deallocate(third.allocate(128), 128);
+			}
+
+			std::pmr::vector<int> vec(&first);
+			vec.resize(10);
+			CHECK(vec.get_allocator().resource()->is_equal(first));
+			CHECK_FALSE(first.is_equal(second));
+		}
+
+		CHECK(upstream.liveAllocationCount == 0);
+	}
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include <NazaraUtils/Profiler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::size_t CountOccurrences(const std::string& str, const std::string& pattern)
+	{
+		std::size_t count = 0;
+		for (std::size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+			count++;
+
+		return count;
+	}
+
+	std::string ExportTrace()
+	{
+		std::ostringstream stream;
+		Nz::Profiler::ExportChromeTrace(stream);
+
+		return stream.str();
+	}
+}
+
+SCENARIO("Profiler", "[CORE][PROFILER]")
+{
+	Nz::Profiler::Clear();
+
+	WHEN("Profiling macros are disabled")
+	{
+#ifndef NAZARA_PROFILING
+		// They must compile to nothing, not even evaluating their arguments
+		int evaluationCount = 0;
+		NazaraProfileScope((evaluationCount++, "Zone"));
+		NazaraProfileCounter("Counter", evaluationCount++);
+		NazaraProfileThreadName((evaluationCount++, "Thread"));
+		CHECK(evaluationCount == 0);
+
+		CHECK(ExportTrace().find("\"Zone\"") == std::string::npos);
+#endif
+	}
+
+	WHEN("Recording zones and counters")
+	{
+		Nz::UInt64 before = Nz::Profiler::ReadTimestamp();
+		{
+			Nz::ProfileScope outerScope("Outer");
+			{
+				Nz::ProfileScope innerScope("Inner \"quoted\"");
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			Nz::Profiler::RecordCounter("Live objects", 42);
+			Nz::Profiler::RecordCounter("Live objects", -3);
+		}
+		CHECK(Nz::Profiler::ReadTimestamp() >= before);
+
+		Nz::Profiler::SetCurrentThreadName("Main thread");
+
+		std::string trace = ExportTrace();
+
+		THEN("They appear in the Chrome trace")
+		{
+			CHECK(trace.find(R"({"displayTimeUnit":"ns","traceEvents":[)") == 0);
+			CHECK(CountOccurrences(trace, R"({"name":"Outer","ph":"X")") == 1);
+			CHECK(CountOccurrences(trace, R"({"name":"Inner \"quoted\"","ph":"X")") == 1);
+			CHECK(CountOccurrences(trace, R"("args":{"value":42})") == 1);
+			CHECK(CountOccurrences(trace, R"("args":{"value":-3})") == 1);
+			CHECK(CountOccurrences(trace, R"("args":{"name":"Main thread"})") == 1);
+
+			// The inner zone slept for one millisecond
+			std::size_t innerPos = trace.find("Inner");
+			std::size_t durationPos = trace.find("\"dur\":", innerPos);
+			REQUIRE(durationPos != std::string::npos);
+			CHECK(std::stod(trace.substr(durationPos + 6)) >= 900.0);
+		}
+
+		AND_WHEN("We clear the profiler")
+		{
+			Nz::Profiler::Clear();
+
+			std::string clearedTrace = ExportTrace();
+			CHECK(clearedTrace.find("Outer") == std::string::npos);
+			CHECK(clearedTrace.find("Main thread") != std::string::npos);
+		}
+	}
+
+	WHEN("Recording more events than a thread buffer can hold")
+	{
+		for (std::size_t i = 0; i < Nz::Profiler::EventsPerThread + 100; ++i)
+			Nz::Profiler::RecordCounter("Overflow", static_cast<Nz::Int64>(i));
+
+		std::string trace = ExportTrace();
+
+		THEN("Only the last events are kept")
+		{
+			CHECK(CountOccurrences(trace, R"({"name":"Overflow")") == Nz::Profiler::EventsPerThread);
+			CHECK(trace.find(R"("args":{"value":99})") == std::string::npos);
+			CHECK(trace.find(R"("args":{"value":100})") != std::string::npos);
+		}
+	}
+
+	WHEN("Threads record events while exporting")
+	{
+		constexpr std::size_t ThreadCount = 4;
+		constexpr std::size_t ZoneCount = 20'000;
+
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < ThreadCount; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				Nz::Profiler::SetCurrentThreadName("Worker");
+				for (std::size_t j = 0; j < ZoneCount; ++j)
+				{
+					Nz::ProfileScope scope("Work");
+					Nz::Profiler::RecordCounter("Iteration", static_cast<Nz::Int64>(j));
+				}
+			});
+		}
+
+		std::size_t exportCount = 0;
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			std::string trace = ExportTrace();
+			if (trace.size() > 2 && trace.substr(trace.size() - 3) == "]}\n")
+				exportCount++;
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		std::string trace = ExportTrace();
+
+		CHECK(exportCount == 5);
+		CHECK(CountOccurrences(trace, R"({"name":"Work","ph":"X")") == ThreadCount * Nz::Profiler::EventsPerThread / 2);
+		CHECK(CountOccurrences(trace, R"("args":{"name":"Worker"})") == ThreadCount);
+	}
+}
@@ -0,0 +1,141 @@
+#include <NazaraUtils/Random.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr Nz::UInt64 ConstexprXoshiro()
+	{
+		Nz::Xoshiro256StarStar rng({ 1, 2, 3, 4 });
+		return rng();
+	}
+
+	constexpr Nz::UInt32 ConstexprPcg()
+	{
+		Nz::Pcg32 rng(42, 54);
+		return rng();
+	}
+
+	constexpr Nz::UInt64 ConstexprBounded()
+	{
+		Nz::WyRand rng(1337);
+		Nz::UInt64 sum = 0;
+		for (int i = 0; i < 100; ++i)
+			sum += rng.Bounded(6);
+
+		return sum;
+	}
+
+	static_assert(ConstexprXoshiro() == 11520);
+	static_assert(ConstexprPcg() == 0xA15C02B7);
+	static_assert(ConstexprBounded() <= 500);
+
+	template<typename Rng>
+	void CheckEngine(Rng rng)
+	{
+		Rng copy = rng;
+		CHECK(copy == rng);
+		CHECK(rng() == copy());
+
+		copy.Jump();
+		CHECK(copy != rng);
+
+		// Bounded values are in range and every value is reached with roughly the same frequency
+		std::array<unsigned int, 10> histogram = {};
+		bool inRange = true;
+		for (unsigned int i = 0; i < 100'000; ++i)
+		{
+			auto value = rng.Bounded(10);
+			if (value < 10)
+				histogram[value]++;
+			else
+				inRange = false;
+		}
+		CHECK(inRange);
+
+		for (unsigned int count : histogram)
+		{
+			CHECK(count > 9'500);
+			CHECK(count < 10'500);
+		}
+
+		CHECK(rng.Bounded(1) == 0);
+
+		// Usable with standard distributions
+		std::uniform_int_distribution<int> dis(-5, 5);
+		bool distributionInRange = true;
+		for (unsigned int i = 0; i < 1000; ++i)
+		{
+			int value = dis(rng);
+			distributionInRange = distributionInRange && value >= -5 && value <= 5;
+		}
+		CHECK(distributionInRange);
+	}
+}
+
+SCENARIO("Random", "[CORE][RANDOM]")
+{
+	GIVEN("A xoshiro256** engine")
+	{
+		// Reference values from the original C implementation
+		Nz::Xoshiro256StarStar rng({ 1, 2, 3, 4 });
+		std::vector<Nz::UInt64> values;
+		for (int i = 0; i < 10; ++i)
+			values.push_back(rng());
+
+		CHECK(values == std::vector<Nz::UInt64>{ 11520ULL, 0ULL, 1509978240ULL, 1215971899390074240ULL, 1216172134540287360ULL, 607988272756665600ULL, 16172922978634559625ULL, 8476171486693032832ULL, 10595114339597558777ULL, 2904607092377533576ULL });
+
+		Nz::Xoshiro256StarStar jumped = rng;
+		jumped.Jump();
+		Nz::Xoshiro256StarStar longJumped = rng;
+		longJumped.LongJump();
+		CHECK(jumped != longJumped);
+
+		CheckEngine(Nz::Xoshiro256StarStar(42));
+	}
+
+	GIVEN("A PCG32 engine")
+	{
+		// Reference values from pcg32-demo
+		Nz::Pcg32 rng(42, 54);
+		std::vector<Nz::UInt32> values;
+		for (int i = 0; i < 6; ++i)
+			values.push_back(rng());
+
+		CHECK(values == std::vector<Nz::UInt32>{ 0xA15C02B7, 0x7B47F409, 0xBA1D3330, 0x83D2F293, 0xBFA4784B, 0xCBED606E });
+
+		Nz::Pcg32 advanced = rng;
+		for (int i = 0; i < 1000; ++i)
+			rng();
+
+		advanced.Advance(1000);
+		CHECK(advanced == rng);
+
+		CHECK(Nz::Pcg32(42, 1)() != Nz::Pcg32(42, 2)());
+
+		CheckEngine(Nz::Pcg32(42));
+	}
+
+	GIVEN("A wyrand engine")
+	{
+		Nz::WyRand rng(42);
+		Nz::WyRand advanced = rng;
+		for (int i = 0; i < 1000; ++i)
+			rng();
+
+		advanced.Advance(1000);
+		CHECK(advanced == rng);
+		CHECK(advanced() == rng());
+
+		CheckEngine(Nz::WyRand(42));
+	}
+
+	GIVEN("SplitMix64")
+	{
+		Nz::UInt64 state = 0;
+		CHECK(Nz::SplitMix64(state) == 0xE220A8397B1DCDAFULL);
+		CHECK(Nz::SplitMix64(state) == 0x6E789E6AA1B965F4ULL);
+	}
+}
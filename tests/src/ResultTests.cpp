@@ -1,4 +1,5 @@
 #include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/MovablePtr.hpp>
 #include <NazaraUtils/Result.hpp>
 #include <CopyCounter.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -48,6 +49,38 @@ namespace
 
 	struct A {};
 	struct B : A {};
+
+	enum class ErrorCode
+	{
+		Failure,
+		NotFound
+	};
+
+	struct OutOfMemory {};
+
+	static_assert(std::is_trivially_copyable_v<Nz::Result<Nz::UInt32, ErrorCode>>);
+	static_assert(std::is_trivially_copyable_v<Nz::Result<void, ErrorCode>>);
+	static_assert(std::is_trivially_destructible_v<Nz::Result<double, ErrorCode>>);
+	static_assert(sizeof(Nz::Result<Nz::UInt32, ErrorCode>) == 2 * sizeof(Nz::UInt32));
+	static_assert(sizeof(Nz::Result<void, ErrorCode>) == 2 * sizeof(ErrorCode));
+	static_assert(sizeof(Nz::Result<int*, OutOfMemory>) == sizeof(int*));
+	static_assert(sizeof(Nz::Result<Nz::MovablePtr<int>, OutOfMemory>) == sizeof(int*));
+	static_assert(sizeof(Nz::Result<void, const char*>) == 2 * sizeof(const char*));
+
+	static_assert(!std::is_copy_constructible_v<Nz::Result<std::unique_ptr<int>, ErrorCode>>);
+	static_assert(std::is_nothrow_move_constructible_v<Nz::Result<std::unique_ptr<int>, ErrorCode>>);
+	static_assert(std::is_nothrow_move_constructible_v<Nz::Result<std::string, ErrorCode>>);
+
+	constexpr Nz::Result<int, ErrorCode> ParseDigit(char c)
+	{
+		if (c < '0' || c > '9')
+			return Nz::Err(ErrorCode::Failure);
+
+		return Nz::Ok(c - '0');
+	}
+
+	static_assert(ParseDigit('7').GetValue() == 7);
+	static_assert(ParseDigit('x').IsErr());
 }
 
 SCENARIO("Result", "[Result]")
@@ -185,4 +218,63 @@ SCENARIO("Result", "[Result]")
 		CHECK(result3.IsOk());
 		CHECK(result3.GetValue() == "Ok2");
 	}
+
+	WHEN("Using compact storage")
+	{
+		int value = 42;
+
+		Nz::Result<int*, OutOfMemory> ptrResult = Nz::Ok(&value);
+		CHECK(ptrResult.IsOk());
+		CHECK(*ptrResult.GetValue() == 42);
+
+		ptrResult = Nz::Err(OutOfMemory{});
+		CHECK(ptrResult.IsErr());
+		CHECK_THROWS_WITH(ptrResult.GetValue(), "Result is not a value");
+
+		Nz::Result<Nz::MovablePtr<int>, OutOfMemory> movablePtrResult = Nz::Ok(Nz::MovablePtr<int>(&value));
+		CHECK(movablePtrResult.IsOk());
+		Nz::Result<Nz::MovablePtr<int>, OutOfMemory> movedPtrResult = std::move(movablePtrResult);
+		CHECK(movedPtrResult.GetValue().Get() == &value);
+
+		Nz::Result<void, const char*> voidResult = Nz::Ok();
+		CHECK(voidResult.IsOk());
+		voidResult = Nz::Err("failed");
+		CHECK(voidResult.IsErr());
+		CHECK(std::string_view(voidResult.GetError()) == "failed");
+
+		// A null error is still an error
+		Nz::Result<void, const char*> nullErrorResult = Nz::Err(nullptr);
+		CHECK(nullErrorResult.IsErr());
+		CHECK(nullErrorResult.GetError() == nullptr);
+
+		Nz::Result<void, int*> nullPtrErrorResult = Nz::Err(static_cast<int*>(nullptr));
+		CHECK(nullPtrErrorResult.IsErr());
+		CHECK_FALSE(nullPtrErrorResult.IsOk());
+
+		Nz::Result<Nz::UInt32, ErrorCode> intResult = Nz::Err(ErrorCode::NotFound);
+		CHECK(intResult.GetError() == ErrorCode::NotFound);
+		intResult = Nz::Ok(Nz::UInt32(7));
+		CHECK(intResult.GetValue() == 7);
+	}
+
+	WHEN("Assigning results holding non-trivial types")
+	{
+		Nz::Result<std::unique_ptr<int>, std::string> ptrResult = Nz::Ok(std::make_unique<int>(42));
+		Nz::Result<std::unique_ptr<int>, std::string> movedResult = std::move(ptrResult);
+		CHECK(*movedResult.GetValue() == 42);
+
+		movedResult = Nz::Err("Error");
+		CHECK(movedResult.GetError() == "Error");
+
+		Nz::Result<std::string, std::string> a = Nz::Ok("value");
+		Nz::Result<std::string, std::string> b = Nz::Err("error");
+		a = b;
+		CHECK(a.IsErr());
+		CHECK(a.GetError() == "error");
+
+		b = Nz::Result<std::string, std::string>(Nz::Ok("other value"));
+		a = std::move(b);
+		CHECK(a.IsOk());
+		CHECK(a.GetValue() == "other value");
+	}
 }
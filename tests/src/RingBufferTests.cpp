@@ -0,0 +1,174 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/RingBuffer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+SCENARIO("RingBuffer", "[CORE][RINGBUFFER]")
+{
+	GIVEN("A ring buffer of integers")
+	{
+		Nz::RingBuffer<int, 8> buffer;
+		CHECK(buffer.empty());
+		CHECK(buffer.capacity() == 8);
+		CHECK(buffer.begin() == buffer.end());
+
+		WHEN("We use it as a queue")
+		{
+			for (int i = 0; i < 8; ++i)
+				buffer.push_back(i);
+
+			CHECK(buffer.full());
+			CHECK(buffer.front() == 0);
+			CHECK(buffer.back() == 7);
+
+			// make the buffer wrap around its storage
+			for (int i = 8; i < 20; ++i)
+			{
+				buffer.pop_front();
+				buffer.push_back(i);
+			}
+
+			CHECK(buffer.size() == 8);
+			CHECK(std::equal(buffer.begin(), buffer.end(), std::vector<int>{ 12, 13, 14, 15, 16, 17, 18, 19 }.begin()));
+			CHECK(buffer[3] == 15);
+
+			auto [firstPtr, firstCount] = buffer.array_one();
+			auto [secondPtr, secondCount] = buffer.array_two();
+			CHECK(firstCount + secondCount == 8);
+			CHECK(firstCount == 4);
+			CHECK(firstPtr[0] == 12);
+			CHECK(secondPtr[0] == 16);
+			CHECK(secondPtr == &buffer[0] - 4);
+
+			THEN("We can release elements in bulk")
+			{
+				buffer.pop_front(5);
+				CHECK(buffer.size() == 3);
+				CHECK(buffer.front() == 17);
+				CHECK(buffer.array_one().second == 3);
+				CHECK(buffer.array_two().second == 0);
+			}
+		}
+
+		WHEN("We push and pop at both ends")
+		{
+			buffer.push_back(1);
+			buffer.push_front(0);
+			buffer.push_back(2);
+			buffer.emplace_front(-1);
+
+			CHECK(std::equal(buffer.begin(), buffer.end(), std::vector<int>{ -1, 0, 1, 2 }.begin()));
+			CHECK(std::equal(buffer.rbegin(), buffer.rend(), std::vector<int>{ 2, 1, 0, -1 }.begin()));
+
+			buffer.pop_back();
+			buffer.pop_front();
+			CHECK(buffer.size() == 2);
+			CHECK(buffer.front() == 0);
+			CHECK(buffer.back() == 1);
+
+			buffer.clear();
+			CHECK(buffer.empty());
+		}
+
+		WHEN("We append ranges")
+		{
+			for (int i = 0; i < 6; ++i)
+				buffer.push_back(i);
+
+			buffer.pop_front(5);
+
+			std::array<int, 6> values = { 10, 11, 12, 13, 14, 15 };
+			buffer.append(values.begin(), values.end());
+			CHECK(buffer.size() == 7);
+			CHECK(std::equal(buffer.begin(), buffer.end(), std::vector<int>{ 5, 10, 11, 12, 13, 14, 15 }.begin()));
+			CHECK(buffer.array_one().second == 3);
+			CHECK(buffer.array_two().second == 4);
+
+			buffer.clear();
+
+			std::istringstream ss("1 2 3");
+			buffer.append(std::istream_iterator<int>(ss), std::istream_iterator<int>());
+			CHECK(std::accumulate(buffer.cbegin(), buffer.cend(), 0) == 6);
+		}
+
+		WHEN("We copy it")
+		{
+			for (int i = 0; i < 12; ++i)
+			{
+				if (buffer.full())
+					buffer.pop_front();
+
+				buffer.push_back(i);
+			}
+
+			Nz::RingBuffer<int, 8> copy(buffer);
+			CHECK(std::equal(copy.begin(), copy.end(), buffer.begin(), buffer.end()));
+
+			Nz::RingBuffer<int, 8> moved;
+			moved = std::move(copy);
+			CHECK(moved.size() == 8);
+			CHECK(moved.front() == 4);
+			CHECK(moved.back() == 11);
+		}
+	}
+
+	GIVEN("A ring buffer of strings")
+	{
+		Nz::RingBuffer<std::string, 4> history;
+		for (int i = 0; i < 10; ++i)
+		{
+			if (history.full())
+				history.pop_front();
+
+			history.push_back("command" + std::to_string(i));
+		}
+
+		CHECK(history.size() == 4);
+		CHECK(history.front() == "command6");
+		CHECK(history.back() == "command9");
+		CHECK(history.begin()->size() == 8);
+
+		auto it = std::find(history.cbegin(), history.cend(), "command8");
+		CHECK(it.GetIndex() == 2);
+		CHECK(history.cend() - it == 2);
+
+		Nz::RingBuffer<std::string, 4> copy;
+		copy = history;
+		CHECK(copy[1] == "command7");
+
+		Nz::RingBuffer<std::string, 4> moved(std::move(copy));
+		CHECK(moved[3] == "command9");
+	}
+
+	GIVEN("A ring buffer of non-trivial types")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::RingBuffer<AliveCounter, 16> buffer;
+			for (int i = 0; i < 40; ++i)
+			{
+				if (buffer.full())
+					buffer.pop_front();
+
+				buffer.emplace_back(&counter, i);
+			}
+
+			CHECK(counter.aliveCount == 16);
+
+			buffer.pop_front(4);
+			CHECK(counter.aliveCount == 12);
+
+			buffer.emplace_front(&counter, 0);
+			CHECK(counter.aliveCount == 13);
+			CHECK(int(buffer.front()) == 0);
+			CHECK(int(buffer[1]) == 28);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+}
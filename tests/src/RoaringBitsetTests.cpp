@@ -0,0 +1,215 @@
+#include <NazaraUtils/RoaringBitset.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+	std::vector<std::size_t> GetValues(const Nz::RoaringBitset<>& bitset)
+	{
+		std::vector<std::size_t> values;
+		for (std::size_t value : bitset.IterBits())
+			values.push_back(value);
+
+		return values;
+	}
+
+	std::vector<std::size_t> GetValues(const std::set<Nz::UInt32>& reference)
+	{
+		return std::vector<std::size_t>(reference.begin(), reference.end());
+	}
+
+	// Mix of sparse values, dense ranges and long runs, spread over several containers
+	void Generate(std::mt19937& rand, Nz::RoaringBitset<>& bitset, std::set<Nz::UInt32>& reference)
+	{
+		std::uniform_int_distribution<Nz::UInt32> keyDis(0, 6);
+		std::uniform_int_distribution<Nz::UInt32> lowDis(0, 0xFFFF);
+
+		auto Add = [&](Nz::UInt32 value)
+		{
+			bitset.Set(value);
+			reference.insert(value);
+		};
+
+		for (std::size_t i = 0; i < 3000; ++i)
+			Add((keyDis(rand) << 16) | lowDis(rand));
+
+		Nz::UInt32 denseKey = keyDis(rand) << 16;
+		for (std::size_t i = 0; i < 20000; ++i)
+			Add(denseKey | lowDis(rand));
+
+		Nz::UInt32 runStart = (keyDis(rand) << 16) | lowDis(rand);
+		for (Nz::UInt32 i = 0; i < 30000; ++i)
+			Add(runStart + i);
+	}
+}
+
+SCENARIO("RoaringBitset", "[CORE][ROARINGBITSET]")
+{
+	GIVEN("An empty bitset")
+	{
+		Nz::RoaringBitset<> bitset;
+		CHECK(bitset.TestNone());
+		CHECK(bitset.Count() == 0);
+		CHECK(bitset.FindFirst() == bitset.npos);
+		CHECK(bitset.ToBitset().GetSize() == 0);
+
+		WHEN("We set and reset values")
+		{
+			bitset.Set(42);
+			bitset.Set(0xFFFFFFFF);
+			bitset.Set(65536);
+
+			CHECK(bitset.Count() == 3);
+			CHECK(bitset.GetContainerCount() == 3);
+			CHECK(bitset.Test(42));
+			CHECK(bitset.Test(65536));
+			CHECK(bitset.Test(0xFFFFFFFF));
+			CHECK_FALSE(bitset.Test(43));
+			CHECK(GetValues(bitset) == std::vector<std::size_t>{ 42, 65536, 0xFFFFFFFF });
+
+			bitset.Reset(65536);
+			bitset.Reset(65537);
+			CHECK(bitset.Count() == 2);
+			CHECK(bitset.GetContainerCount() == 2);
+			CHECK(bitset.FindNext(42) == 0xFFFFFFFF);
+			CHECK(bitset.FindNext(0xFFFFFFFF) == bitset.npos);
+		}
+	}
+
+	GIVEN("A clustered bitset")
+	{
+		Nz::RoaringBitset<> bitset;
+		std::set<Nz::UInt32> reference;
+		for (Nz::UInt32 i = 1000; i < 50000; ++i)
+		{
+			bitset.Set(i);
+			reference.insert(i);
+		}
+
+		for (Nz::UInt32 i = 70000; i < 70100; i += 2)
+		{
+			bitset.Set(i);
+			reference.insert(i);
+		}
+
+		CHECK(bitset.Count() == reference.size());
+		CHECK(GetValues(bitset) == GetValues(reference));
+
+		WHEN("We optimize it")
+		{
+			Nz::RoaringBitset<> original(bitset);
+			std::size_t memoryUsage = bitset.GetMemoryUsage();
+			bitset.Optimize();
+
+			THEN("It uses less memory and holds the same values")
+			{
+				CHECK(bitset.GetMemoryUsage() < memoryUsage);
+				CHECK(bitset == original);
+				CHECK(bitset.Count() == reference.size());
+				CHECK(GetValues(bitset) == GetValues(reference));
+			}
+
+			AND_WHEN("We modify runs")
+			{
+				// Split a run, shrink its ends, extend it and merge runs
+				for (Nz::UInt32 value : { 20000u, 1000u, 49999u, 999u, 50000u, 20001u, 30000u, 30001u, 30002u })
+				{
+					bitset.Reset(value);
+					reference.erase(value);
+				}
+
+				for (Nz::UInt32 value : { 998u, 50001u, 20000u, 30001u, 20001u, 30000u, 30002u, 70001u })
+				{
+					bitset.Set(value);
+					reference.insert(value);
+				}
+
+				CHECK(bitset.Count() == reference.size());
+				CHECK(GetValues(bitset) == GetValues(reference));
+				for (Nz::UInt32 value : { 997u, 998u, 999u, 1000u, 1001u, 19999u, 20000u, 20001u, 20002u, 49999u, 50000u, 50001u, 50002u })
+					CHECK(bitset.Test(value) == (reference.count(value) != 0));
+			}
+		}
+	}
+
+	GIVEN("Two random bitsets")
+	{
+		std::mt19937 rand(42);
+
+		Nz::RoaringBitset<> a;
+		Nz::RoaringBitset<> b;
+		std::set<Nz::UInt32> refA;
+		std::set<Nz::UInt32> refB;
+		Generate(rand, a, refA);
+		Generate(rand, b, refB);
+
+		CHECK(a.Count() == refA.size());
+		CHECK(GetValues(a) == GetValues(refA));
+
+		auto CheckOps = [&]
+		{
+			std::set<Nz::UInt32> expected;
+			std::set_intersection(refA.begin(), refA.end(), refB.begin(), refB.end(), std::inserter(expected, expected.end()));
+			CHECK(GetValues(a & b) == GetValues(expected));
+
+			expected.clear();
+			std::set_union(refA.begin(), refA.end(), refB.begin(), refB.end(), std::inserter(expected, expected.end()));
+			CHECK(GetValues(a | b) == GetValues(expected));
+
+			expected.clear();
+			std::set_symmetric_difference(refA.begin(), refA.end(), refB.begin(), refB.end(), std::inserter(expected, expected.end()));
+			CHECK(GetValues(a ^ b) == GetValues(expected));
+
+			CHECK((a ^ a).TestNone());
+			CHECK((a & a) == a);
+			CHECK((a | a) == a);
+		};
+
+		WHEN("We combine them")
+		{
+			CheckOps();
+		}
+
+		WHEN("We combine them after optimizing one of them")
+		{
+			a.Optimize();
+			CheckOps();
+		}
+
+		WHEN("We combine them in place")
+		{
+			Nz::RoaringBitset<> result(a);
+			result |= b;
+			result &= a;
+			CHECK(result == a);
+
+			result ^= a;
+			CHECK(result.TestNone());
+		}
+
+		WHEN("We convert them from and to a Bitset")
+		{
+			Nz::Bitset<Nz::UInt64> bitset = a.ToBitset<Nz::UInt64>();
+			CHECK(bitset.GetSize() == *refA.rbegin() + 1);
+			CHECK(bitset.Count() == refA.size());
+
+			std::vector<std::size_t> bits;
+			for (std::size_t bit : bitset.IterBits())
+				bits.push_back(bit);
+
+			CHECK(bits == GetValues(refA));
+
+			Nz::RoaringBitset<> roaringBitset = Nz::RoaringBitset<>::FromBitset(bitset);
+			CHECK(roaringBitset == a);
+			CHECK(roaringBitset.GetMemoryUsage() < bitset.GetBlockCount() * sizeof(Nz::UInt64));
+
+			Nz::Bitset<Nz::UInt8> smallBlockBitset = b.ToBitset<Nz::UInt8>();
+			CHECK(smallBlockBitset.Count() == refB.size());
+			CHECK(Nz::RoaringBitset<>::FromBitset(smallBlockBitset) == b);
+		}
+	}
+}
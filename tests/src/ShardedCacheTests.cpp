@@ -0,0 +1,79 @@
+#include <NazaraUtils/ClockCache.hpp>
+#include <NazaraUtils/LruCache.hpp>
+#include <NazaraUtils/ShardedCache.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("ShardedCache", "[CORE][SHARDEDCACHE]")
+{
+	WHEN("Using a sharded cache from a single thread")
+	{
+		Nz::ShardedCache<Nz::LruCache<std::string, int>, 4> cache(100);
+		CHECK(cache.GetCapacity() == 100);
+
+		cache.Put("a", 1);
+		cache.Put("b", 2, 10);
+		CHECK(cache.GetSize() == 2);
+		CHECK(cache.GetCost() == 11);
+		CHECK(cache.Contains("a"));
+
+		CHECK(cache.Get("a") == 1);
+		CHECK_FALSE(cache.Get("c").has_value());
+
+		int value = 0;
+		CHECK(cache.Get("b", [&](int& v) { value = v; v = 20; }));
+		CHECK(value == 2);
+		CHECK(cache.Get("b") == 20);
+
+		CHECK(cache.Erase("a"));
+		CHECK_FALSE(cache.Contains("a"));
+
+		cache.Clear();
+		CHECK(cache.GetSize() == 0);
+
+		// Each shard keeps at most a quarter of the capacity
+		cache.SetCapacity(8);
+		for (int i = 0; i < 100; ++i)
+			cache.Put(std::to_string(i), i);
+
+		CHECK(cache.GetSize() <= 8);
+	}
+
+	WHEN("Using a sharded cache from multiple threads")
+	{
+		constexpr int KeyCount = 1000;
+		constexpr std::size_t ThreadCount = 4;
+
+		Nz::ShardedCache<Nz::ClockCache<int, int>> cache(KeyCount / 2);
+
+		std::atomic<std::size_t> mismatchCount = 0;
+		std::vector<std::thread> threads;
+		for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]
+			{
+				for (int i = 0; i < KeyCount; ++i)
+				{
+					int key = (i * 7 + int(threadIndex) * 13) % KeyCount;
+					if (std::optional<int> value = cache.Get(key))
+					{
+						if (*value != key * 2)
+							mismatchCount++;
+					}
+					else
+						cache.Put(key, key * 2);
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		CHECK(mismatchCount == 0);
+		CHECK(cache.GetCost() <= cache.GetCapacity());
+		CHECK(cache.GetSize() > 0);
+	}
+}
@@ -0,0 +1,90 @@
+#include <NazaraUtils/SignalQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+SCENARIO("SignalQueue", "[CORE][SIGNAL]")
+{
+	GIVEN("A queue")
+	{
+		Nz::SignalQueue<int, const std::string&> queue(16);
+		CHECK_FALSE(queue.IsCoalescing());
+
+		std::vector<std::pair<int, std::string>> received;
+		Nz::SignalQueue<int, const std::string&>::ConnectionGuard guard = queue.Connect([&](int value, const std::string& str)
+		{
+			received.emplace_back(value, str);
+		});
+
+		WHEN("We emit and flush")
+		{
+			queue(1, "a");
+			queue(2, "b");
+			queue(1, "c");
+			CHECK(received.empty());
+			CHECK(queue.GetPendingCount() == 3);
+
+			queue.Flush();
+			CHECK(queue.GetPendingCount() == 0);
+			CHECK(received == std::vector<std::pair<int, std::string>>{ { 1, "a" }, { 2, "b" }, { 1, "c" } });
+
+			queue.Flush();
+			CHECK(received.size() == 3);
+		}
+
+		WHEN("We clear pending emissions")
+		{
+			queue(1, "a");
+			queue.Clear();
+			queue.Flush();
+			CHECK(received.empty());
+		}
+
+		WHEN("A slot emits during a flush")
+		{
+			Nz::SignalQueue<int, const std::string&>::ConnectionGuard reemitGuard = queue.Connect([&](int value, const std::string& str)
+			{
+				if (value > 0)
+					queue(value - 1, str);
+
+				queue.Flush(); //< does nothing
+			});
+
+			queue(1, "a");
+			queue.Flush();
+			CHECK(received == std::vector<std::pair<int, std::string>>{ { 1, "a" } });
+			CHECK(queue.GetPendingCount() == 1);
+
+			queue.Flush();
+			CHECK(received == std::vector<std::pair<int, std::string>>{ { 1, "a" }, { 0, "a" } });
+		}
+	}
+
+	GIVEN("A coalescing queue")
+	{
+		Nz::SignalQueue<int, const std::string&> queue([](int key, const std::string& /*str*/) { return std::size_t(key); });
+		CHECK(queue.IsCoalescing());
+
+		std::vector<std::pair<int, std::string>> received;
+		queue.Connect([&](int value, const std::string& str)
+		{
+			received.emplace_back(value, str);
+		});
+
+		queue(1, "a");
+		queue(2, "b");
+		queue(1, "c");
+		queue(3, "d");
+		queue(2, "e");
+		CHECK(queue.GetPendingCount() == 3);
+
+		queue.Flush();
+		CHECK(received == std::vector<std::pair<int, std::string>>{ { 1, "c" }, { 2, "e" }, { 3, "d" } });
+
+		queue(1, "f");
+		queue.Flush();
+		CHECK(received.back() == std::pair<int, std::string>{ 1, "f" });
+		CHECK(received.size() == 4);
+	}
+}
@@ -1,5 +1,8 @@
 #include <NazaraUtils/Signal.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <optional>
+#include <vector>
 
 struct Incrementer
 {
@@ -46,3 +49,163 @@ SCENARIO("Signal", "[CORE][SIGNAL]")
 		}
 	}
 }
+
+SCENARIO("Signal connections", "[CORE][SIGNAL]")
+{
+	GIVEN("A signal with multiple connections")
+	{
+		Nz::Signal<int*> signal;
+
+		int inc = 0;
+		auto first = signal.Connect([](int* value) { *value += 1; });
+		auto second = signal.Connect([](int* value) { *value += 10; });
+		auto third = signal.Connect([](int* value) { *value += 100; });
+
+		WHEN("We disconnect and reconnect slots")
+		{
+			second.Disconnect();
+			CHECK_FALSE(second.IsConnected());
+			second.Disconnect(); //< Does nothing
+
+			auto fourth = signal.Connect([](int* value) { *value += 1000; });
+			CHECK(first.IsConnected());
+			CHECK(third.IsConnected());
+			CHECK(fourth.IsConnected());
+			CHECK_FALSE(second.IsConnected()); //< The new slot reuses the handle, but not its generation
+
+			signal(&inc);
+			CHECK(inc == 1101);
+
+			second.Disconnect();
+			inc = 0;
+			signal(&inc);
+			CHECK(inc == 1101);
+		}
+
+		WHEN("We clear the signal")
+		{
+			signal.Clear();
+			CHECK_FALSE(first.IsConnected());
+			CHECK_FALSE(third.IsConnected());
+
+			signal(&inc);
+			CHECK(inc == 0);
+
+			signal.Connect([](int* value) { *value += 5; });
+			signal(&inc);
+			CHECK(inc == 5);
+		}
+
+		WHEN("We move the signal")
+		{
+			Nz::Signal<int*> otherSignal(std::move(signal));
+			CHECK(first.IsConnected());
+
+			first.Disconnect();
+			otherSignal(&inc);
+			CHECK(inc == 110);
+
+			signal(&inc);
+			CHECK(inc == 110);
+		}
+
+		WHEN("The signal is destroyed before its connections")
+		{
+			std::optional<Nz::Signal<int*>> tempSignal;
+			tempSignal.emplace();
+			auto connection = tempSignal->Connect([](int* value) { *value += 1; });
+			CHECK(connection.IsConnected());
+
+			tempSignal.reset();
+			CHECK_FALSE(connection.IsConnected());
+			connection.Disconnect();
+		}
+
+		WHEN("We use a connection guard")
+		{
+			{
+				Nz::Signal<int*>::ConnectionGuard guard(signal.Connect([](int* value) { *value += 1000; }));
+				CHECK(guard.IsConnected());
+
+				signal(&inc);
+				CHECK(inc == 1111);
+
+				guard = signal.Connect([](int* value) { *value += 2000; });
+				CHECK(guard.IsConnected());
+
+				inc = 0;
+				signal(&inc);
+				CHECK(inc == 2111);
+			}
+
+			inc = 0;
+			signal(&inc);
+			CHECK(inc == 111);
+		}
+	}
+
+	GIVEN("A signal whose slots modify it during emission")
+	{
+		Nz::Signal<> signal;
+		std::vector<int> calls;
+
+		Nz::Signal<>::Connection selfConnection;
+		Nz::Signal<>::Connection otherConnection;
+		Nz::Signal<>::Connection newConnection;
+
+		selfConnection = signal.Connect([&]
+		{
+			calls.push_back(0);
+			selfConnection.Disconnect();
+		});
+
+		signal.Connect([&]
+		{
+			calls.push_back(1);
+			otherConnection.Disconnect();
+
+			if (!newConnection.IsConnected())
+				newConnection = signal.Connect([&] { calls.push_back(3); });
+		});
+
+		otherConnection = signal.Connect([&] { calls.push_back(2); });
+
+		WHEN("We trigger it")
+		{
+			signal();
+
+			THEN("Disconnected slots aren't called and new slots are only called by next emissions")
+			{
+				CHECK(calls == std::vector<int>{ 0, 1 });
+				CHECK_FALSE(selfConnection.IsConnected());
+				CHECK_FALSE(otherConnection.IsConnected());
+				CHECK(newConnection.IsConnected());
+
+				calls.clear();
+				signal();
+				CHECK(calls.size() == 2);
+				CHECK(std::count(calls.begin(), calls.end(), 1) == 1);
+				CHECK(std::count(calls.begin(), calls.end(), 3) == 1);
+			}
+		}
+
+		WHEN("We trigger it recursively")
+		{
+			int depth = 0;
+			signal.Connect([&]
+			{
+				if (depth++ == 0)
+					signal();
+			});
+
+			signal();
+			CHECK(std::count(calls.begin(), calls.end(), 0) == 1);
+			CHECK(std::count(calls.begin(), calls.end(), 2) == 0);
+			CHECK(newConnection.IsConnected());
+
+			calls.clear();
+			signal();
+			CHECK(std::count(calls.begin(), calls.end(), 3) == 1);
+		}
+	}
+}
@@ -0,0 +1,158 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/SlotMap.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+SCENARIO("SlotMap", "[CORE][SLOTMAP]")
+{
+	GIVEN("A SlotMap of strings")
+	{
+		Nz::SlotMap<std::string> slotMap;
+		CHECK(slotMap.IsEmpty());
+		CHECK(slotMap.empty());
+		CHECK_FALSE(slotMap.Contains(Nz::SlotMap<std::string>::Key{}));
+
+		auto key1 = slotMap.Insert("Hello");
+		auto key2 = slotMap.Emplace(5, 'x');
+		std::string world = "World";
+		auto key3 = slotMap.Insert(world);
+
+		CHECK(slotMap.GetSize() == 3);
+		CHECK(slotMap[key1] == "Hello");
+		CHECK(slotMap.Get(key2) == "xxxxx");
+		CHECK(*slotMap.TryGet(key3) == "World");
+		CHECK(key1 != key2);
+		CHECK(slotMap.GetKey(1) == key2);
+
+		WHEN("We erase a value in the middle")
+		{
+			CHECK(slotMap.Erase(key2));
+			CHECK_FALSE(slotMap.Erase(key2));
+
+			THEN("The last value is moved in its place and keys stay valid")
+			{
+				CHECK(slotMap.GetSize() == 2);
+				CHECK_FALSE(slotMap.Contains(key2));
+				CHECK(slotMap.TryGet(key2) == nullptr);
+				CHECK(slotMap.GetData()[1] == "World");
+				CHECK(slotMap.GetKey(1) == key3);
+				CHECK(slotMap[key1] == "Hello");
+				CHECK(slotMap[key3] == "World");
+			}
+
+			AND_WHEN("We insert a new value")
+			{
+				auto key4 = slotMap.Insert("Again");
+
+				THEN("The slot is reused with a new generation")
+				{
+					CHECK(key4.index == key2.index);
+					CHECK(key4.generation != key2.generation);
+					CHECK_FALSE(slotMap.Contains(key2));
+					CHECK(slotMap[key4] == "Again");
+				}
+			}
+		}
+
+		WHEN("We iterate over values")
+		{
+			std::vector<std::string> values(slotMap.begin(), slotMap.end());
+			CHECK(values == std::vector<std::string>{ "Hello", "xxxxx", "World" });
+		}
+
+		WHEN("We clear the SlotMap")
+		{
+			slotMap.Clear();
+			CHECK(slotMap.IsEmpty());
+			CHECK_FALSE(slotMap.Contains(key1));
+			CHECK_FALSE(slotMap.Contains(key2));
+			CHECK_FALSE(slotMap.Contains(key3));
+
+			auto key = slotMap.Insert("New");
+			CHECK(key.index <= 2);
+			CHECK(slotMap[key] == "New");
+		}
+	}
+
+	GIVEN("A SlotMap of alive counters")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::SlotMap<AliveCounter> slotMap;
+			slotMap.Reserve(10);
+			CHECK(slotMap.GetCapacity() >= 10);
+
+			std::vector<Nz::SlotMap<AliveCounter>::Key> keys;
+			for (int i = 0; i < 10; ++i)
+				keys.push_back(slotMap.Emplace(&counter, i));
+
+			CHECK(counter.aliveCount == 10);
+
+			slotMap.Erase(keys[0]);
+			slotMap.Erase(keys[9]);
+			CHECK(counter.aliveCount == 8);
+
+			Nz::SlotMap<AliveCounter> copy(slotMap);
+			CHECK(counter.aliveCount == 16);
+			CHECK(copy[keys[5]] == 5);
+
+			slotMap.Clear();
+			CHECK(counter.aliveCount == 8);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("A SlotMap under random insertions and erasures")
+	{
+		using Key = Nz::SlotMap<int>::Key;
+
+		Nz::SlotMap<int> slotMap;
+		std::vector<std::pair<Key, int>> liveKeys;
+		std::vector<Key> deadKeys;
+
+		std::mt19937 rand(42);
+		for (int i = 0; i < 10'000; ++i)
+		{
+			if (liveKeys.empty() || rand() % 3 != 0)
+				liveKeys.emplace_back(slotMap.Insert(i), i);
+			else
+			{
+				std::size_t index = rand() % liveKeys.size();
+				CHECK(slotMap.Erase(liveKeys[index].first));
+				deadKeys.push_back(liveKeys[index].first);
+				liveKeys[index] = liveKeys.back();
+				liveKeys.pop_back();
+			}
+		}
+
+		REQUIRE(slotMap.GetSize() == liveKeys.size());
+
+		bool valid = true;
+		for (const auto& [key, value] : liveKeys)
+		{
+			const int* ptr = slotMap.TryGet(key);
+			if (!ptr || *ptr != value)
+				valid = false;
+		}
+		CHECK(valid);
+
+		CHECK(std::none_of(deadKeys.begin(), deadKeys.end(), [&](const Key& key) { return slotMap.Contains(key); }));
+
+		for (std::size_t i = 0; i < slotMap.GetSize(); ++i)
+		{
+			if (slotMap[slotMap.GetKey(i)] != slotMap.GetData()[i])
+				valid = false;
+		}
+		CHECK(valid);
+
+		long long expectedSum = 0;
+		for (const auto& pair : liveKeys)
+			expectedSum += pair.second;
+
+		CHECK(std::accumulate(slotMap.begin(), slotMap.end(), 0LL) == expectedSum);
+	}
+}
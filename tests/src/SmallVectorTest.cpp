@@ -0,0 +1,336 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/ArenaAllocator.hpp>
+#include <NazaraUtils/MovablePtr.hpp>
+#include <NazaraUtils/SmallVector.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+SCENARIO("SmallVector", "[CORE][SMALLVECTOR]")
+{
+	GIVEN("A SmallVector storing up to 8 objects inplace")
+	{
+		AliveCounter::Counter counter;
+		{
+			constexpr std::size_t inlineCapacity = 8;
+			Nz::SmallVector<AliveCounter, inlineCapacity> vector;
+
+			WHEN("At construction, the vector is empty and inline")
+			{
+				CHECK(vector.capacity() == inlineCapacity);
+				CHECK(vector.inline_capacity() == inlineCapacity);
+				CHECK(vector.empty());
+				CHECK(vector.size() == 0);
+				CHECK(vector.is_inline());
+			}
+
+			WHEN("Pushing elements past its inline capacity")
+			{
+				for (std::size_t i = 0; i < 20; ++i)
+				{
+					CHECK(vector.emplace_back(&counter, int(i)) == int(i));
+					CHECK(vector.is_inline() == (i < inlineCapacity));
+				}
+
+				CHECK(vector.size() == 20);
+				CHECK(vector.capacity() >= 20);
+				CHECK(counter.aliveCount == 20);
+				CHECK(counter.copyCount == 0);
+
+				std::array<int, 20> expectedValues;
+				std::iota(expectedValues.begin(), expectedValues.end(), 0);
+				CHECK(std::equal(vector.begin(), vector.end(), expectedValues.begin(), expectedValues.end()));
+
+				THEN("We can push a reference to one of its elements while reallocating")
+				{
+					vector.resize(vector.capacity(), AliveCounter(&counter, 0));
+					vector.push_back(vector[5]);
+					CHECK(vector.back() == 5);
+				}
+
+				THEN("We can insert at the middle")
+				{
+					vector.insert(vector.begin() + 10, AliveCounter(&counter, 42));
+					vector.emplace(vector.begin(), &counter, -1);
+					CHECK(vector.size() == 22);
+					CHECK(vector.front() == -1);
+					CHECK(vector[11] == 42);
+					CHECK(vector.back() == 19);
+					CHECK(counter.aliveCount == 22);
+				}
+
+				THEN("We erase elements")
+				{
+					vector.erase(vector.begin() + 2);
+					vector.erase(vector.begin() + 5, vector.end() - 2);
+
+					std::array<int, 7> expectedValues2 = { 0, 1, 3, 4, 5, 18, 19 };
+					CHECK(std::equal(vector.begin(), vector.end(), expectedValues2.begin(), expectedValues2.end()));
+					CHECK(counter.aliveCount == 7);
+
+					AND_THEN("We shrink it back inplace")
+					{
+						vector.shrink_to_fit();
+						CHECK(vector.is_inline());
+						CHECK(vector.capacity() == inlineCapacity);
+						CHECK(std::equal(vector.begin(), vector.end(), expectedValues2.begin(), expectedValues2.end()));
+						CHECK(counter.aliveCount == 7);
+					}
+				}
+
+				THEN("We shrink it")
+				{
+					vector.pop_back();
+					vector.shrink_to_fit();
+					CHECK(!vector.is_inline());
+					CHECK(vector.capacity() == 19);
+					CHECK(std::equal(vector.begin(), vector.end(), expectedValues.begin(), expectedValues.end() - 1));
+				}
+
+				THEN("We copy construct the vector")
+				{
+					decltype(vector) vec2(vector);
+					CHECK(vec2.size() == vector.size());
+					CHECK(counter.aliveCount == vector.size() * 2);
+					CHECK(std::equal(vector.begin(), vector.end(), vec2.begin(), vec2.end()));
+				}
+
+				THEN("We move construct the vector, which steals its memory")
+				{
+					counter.moveCount = 0;
+					const AliveCounter* ptr = vector.data();
+
+					decltype(vector) vec2(std::move(vector));
+					CHECK(vec2.data() == ptr);
+					CHECK(counter.moveCount == 0);
+					CHECK(vector.empty());
+					CHECK(vector.is_inline());
+					CHECK(std::equal(vec2.begin(), vec2.end(), expectedValues.begin(), expectedValues.end()));
+				}
+
+				THEN("We move assign the vector to an inline one")
+				{
+					decltype(vector) vec2;
+					vec2.emplace_back(&counter, 1);
+
+					vec2 = std::move(vector);
+					CHECK(vector.empty());
+					CHECK(!vec2.is_inline());
+					CHECK(counter.aliveCount == 20);
+					CHECK(std::equal(vec2.begin(), vec2.end(), expectedValues.begin(), expectedValues.end()));
+				}
+
+				THEN("We clear it")
+				{
+					vector.clear();
+					CHECK(vector.empty());
+					CHECK(counter.aliveCount == 0);
+				}
+			}
+
+			WHEN("Copying and moving an inline vector")
+			{
+				for (std::size_t i = 0; i < 5; ++i)
+					vector.emplace_back(&counter, int(i));
+
+				decltype(vector) vec2(vector);
+				CHECK(vec2.is_inline());
+				CHECK(counter.aliveCount == 10);
+
+				counter.moveCount = 0;
+				decltype(vector) vec3(std::move(vec2));
+				CHECK(vec3.is_inline());
+				CHECK(vec2.empty());
+				CHECK(counter.moveCount == 5);
+				CHECK(counter.aliveCount == 10);
+
+				vec2 = vec3;
+				CHECK(std::equal(vec2.begin(), vec2.end(), vector.begin(), vector.end()));
+
+				vec3 = std::move(vector);
+				CHECK(vector.empty());
+				CHECK(std::equal(vec2.begin(), vec2.end(), vec3.begin(), vec3.end()));
+				CHECK(counter.aliveCount == 10);
+			}
+
+			WHEN("Resizing it")
+			{
+				vector.resize(5, AliveCounter(&counter, 7));
+				CHECK(vector.is_inline());
+				vector.resize(30, AliveCounter(&counter, 8));
+				CHECK(!vector.is_inline());
+				CHECK(vector.size() == 30);
+				CHECK(counter.aliveCount == 30);
+				CHECK(vector[4] == 7);
+				CHECK(vector[5] == 8);
+				vector.resize(2);
+				CHECK(counter.aliveCount == 2);
+			}
+		}
+
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("A SmallVector of trivially relocatable types")
+	{
+		Nz::SmallVector<int, 4> ints = { 1, 2, 3 };
+		for (int i = 4; i <= 10; ++i)
+			ints.insert(ints.begin() + ints.size() / 2, i);
+
+		std::array<int, 10> expectedInts = { 1, 4, 6, 8, 10, 9, 7, 5, 2, 3 };
+		CHECK(std::equal(ints.begin(), ints.end(), expectedInts.begin(), expectedInts.end()));
+
+		ints.erase(ints.begin() + 1, ints.begin() + 4);
+		std::array<int, 7> expectedInts2 = { 1, 10, 9, 7, 5, 2, 3 };
+		CHECK(std::equal(ints.begin(), ints.end(), expectedInts2.begin(), expectedInts2.end()));
+
+		// MovablePtr specializes IsTriviallyRelocatable
+		static_assert(Nz::IsTriviallyRelocatable_v<Nz::MovablePtr<int>>);
+
+		Nz::SmallVector<Nz::MovablePtr<int>, 2> ptrs;
+		for (int& i : ints)
+			ptrs.emplace_back(&i);
+
+		CHECK(ptrs.size() == ints.size());
+		CHECK(*ptrs[1] == 10);
+
+		Nz::SmallVector<std::string, 2> strings;
+		strings.emplace_back("Hello");
+		strings.emplace_back(100, 'a');
+		strings.emplace(strings.begin(), "world");
+		CHECK(strings[0] == "world");
+		CHECK(strings[1] == "Hello");
+		CHECK(strings[2] == std::string(100, 'a'));
+	}
+
+	GIVEN("A SmallVector with a stateful allocator")
+	{
+		Nz::ArenaAllocator arena;
+		Nz::ArenaAllocator otherArena;
+
+		using Vector = Nz::SmallVector<int, 4, Nz::ArenaStlAllocator<int>>;
+		Vector vec{ Nz::ArenaStlAllocator<int>(arena) };
+		for (int i = 0; i < 10; ++i)
+			vec.push_back(i);
+
+		CHECK(arena.GetLiveAllocationCount() == 1);
+		CHECK(vec.get_allocator() == Nz::ArenaStlAllocator<int>(arena));
+
+		Vector vec2{ Nz::ArenaStlAllocator<int>(otherArena) };
+		vec2 = std::move(vec);
+		CHECK(vec2.size() == 10);
+		CHECK(vec2.back() == 9);
+		CHECK(vec2.get_allocator() == Nz::ArenaStlAllocator<int>(arena));
+	}
+
+	GIVEN("A SmallVector to contain objects without a default constructor")
+	{
+		struct NoDefaultConstructor
+		{
+			NoDefaultConstructor(std::size_t& counter) :
+			m_counter(&counter)
+			{
+				(*m_counter)++;
+			}
+
+			NoDefaultConstructor(const NoDefaultConstructor&) = delete;
+			NoDefaultConstructor(NoDefaultConstructor&& obj) noexcept :
+			m_counter(obj.m_counter)
+			{
+				(*m_counter)++;
+			}
+
+			~NoDefaultConstructor()
+			{
+				(*m_counter)--;
+			}
+
+			NoDefaultConstructor& operator=(const NoDefaultConstructor&) = delete;
+			NoDefaultConstructor& operator=(NoDefaultConstructor&&) = delete;
+
+			std::size_t* m_counter;
+		};
+
+		std::size_t counter = 0;
+		{
+			Nz::SmallVector<NoDefaultConstructor, 2> vec;
+			vec.emplace_back(counter);
+			vec.emplace_back(counter);
+			vec.emplace_back(counter);
+			CHECK(counter == 3);
+
+			vec.clear();
+			CHECK(counter == 0);
+		}
+		CHECK(counter == 0);
+	}
+
+	GIVEN("A SmallVector filled in bulk")
+	{
+		Nz::SmallVector<Nz::UInt32, 4> vec;
+		std::array<Nz::UInt32, 5> values = { 1, 2, 3, 4, 5 };
+
+		WHEN("Appending and inserting ranges")
+		{
+			CHECK(*vec.append(values.begin(), values.end()) == 1);
+			CHECK(*vec.insert(vec.begin() + 2, values.begin(), values.begin() + 2) == 1);
+			vec.insert(vec.begin(), values.end() - 1, values.end());
+			vec.insert(vec.end(), values.begin(), values.begin());
+
+			std::array<Nz::UInt32, 8> expectedValues = { 5, 1, 2, 1, 2, 3, 4, 5 };
+			CHECK(std::equal(vec.begin(), vec.end(), expectedValues.begin(), expectedValues.end()));
+
+			AND_WHEN("Inserting from non-contiguous and input iterators")
+			{
+				std::list<Nz::UInt32> list = { 7, 8 };
+				vec.insert(vec.begin() + 1, list.begin(), list.end());
+
+				std::istringstream stream("9 10 11");
+				vec.insert(vec.begin(), std::istream_iterator<Nz::UInt32>(stream), std::istream_iterator<Nz::UInt32>());
+
+				std::array<Nz::UInt32, 13> expectedValues2 = { 9, 10, 11, 5, 7, 8, 1, 2, 1, 2, 3, 4, 5 };
+				CHECK(std::equal(vec.begin(), vec.end(), expectedValues2.begin(), expectedValues2.end()));
+			}
+		}
+
+		WHEN("Resizing it without initialization")
+		{
+			vec.resize_uninitialized(values.size());
+			std::copy(values.begin(), values.end(), vec.begin());
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.end()));
+
+			vec.resize_default_init(10);
+			CHECK(vec.size() == 10);
+			vec.resize_default_init(3);
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.begin() + 3));
+		}
+
+		WHEN("Inserting ranges of non-trivial types")
+		{
+			AliveCounter::Counter counter;
+			{
+				std::array<AliveCounter, 3> counters = { AliveCounter(&counter, 1), AliveCounter(&counter, 2), AliveCounter(&counter, 3) };
+
+				Nz::SmallVector<AliveCounter, 2> counterVec;
+				counterVec.emplace_back(&counter, 0);
+				counterVec.emplace_back(&counter, 4);
+				counterVec.insert(counterVec.begin() + 1, counters.begin(), counters.end());
+				counterVec.append(counters.begin(), counters.begin() + 1);
+				CHECK(counter.copyCount == 4);
+				CHECK(counter.aliveCount == 9);
+
+				std::array<int, 6> expectedValues = { 0, 1, 2, 3, 4, 1 };
+				CHECK(std::equal(counterVec.begin(), counterVec.end(), expectedValues.begin(), expectedValues.end()));
+
+				counterVec.resize_default_init(8);
+				CHECK(counterVec[7] == 0);
+				CHECK(counter.aliveCount == 9);
+			}
+			CHECK(counter.aliveCount == 0);
+		}
+	}
+}
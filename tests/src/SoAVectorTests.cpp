@@ -0,0 +1,159 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/SoAVector.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+SCENARIO("SoAVector", "[CORE][SOAVECTOR]")
+{
+	GIVEN("A SoAVector of particles")
+	{
+		using Particles = Nz::SoAVector<Nz::TypeList<float, Nz::UInt8, std::string>>;
+		static_assert(Particles::ColumnCount == 3);
+		static_assert(std::is_same_v<Particles::value_type, std::tuple<float, Nz::UInt8, std::string>>);
+		static_assert(std::is_same_v<Particles::reference, std::tuple<float&, Nz::UInt8&, std::string&>>);
+		static_assert(std::is_same_v<Particles::column_type<1>, Nz::UInt8>);
+
+		Particles particles;
+		CHECK(particles.empty());
+		CHECK(particles.capacity() == 0);
+
+		for (int i = 0; i < 100; ++i)
+			particles.emplace_back(float(i), Nz::UInt8(i), std::to_string(i));
+
+		particles.push_back({ 100.f, Nz::UInt8(100), "100" });
+
+		CHECK(particles.size() == 101);
+		CHECK(particles.capacity() >= 101);
+
+		WHEN("We access columns")
+		{
+			auto positions = particles.column<0>();
+			CHECK(positions.size() == particles.size());
+			CHECK(std::accumulate(positions.begin(), positions.end(), 0.f) == 5050.f);
+
+			CHECK(reinterpret_cast<std::uintptr_t>(particles.data<0>()) % 64 == 0);
+			CHECK(reinterpret_cast<std::uintptr_t>(particles.data<1>()) % 64 == 0);
+			CHECK(reinterpret_cast<std::uintptr_t>(particles.data<2>()) % 64 == 0);
+
+			for (Nz::UInt8& id : particles.column<1>())
+				id *= 2;
+
+			CHECK(particles.column<1>()[42] == 84);
+			CHECK(std::as_const(particles).column<2>().back() == "100");
+		}
+
+		WHEN("We access elements")
+		{
+			auto [position, id, name] = particles[42];
+			CHECK(position == 42.f);
+			CHECK(id == 42);
+			CHECK(name == "42");
+
+			position = 1337.f;
+			CHECK(particles.column<0>()[42] == 1337.f);
+
+			CHECK(std::get<2>(particles.front()) == "0");
+			CHECK(std::get<2>(particles.back()) == "100");
+		}
+
+		WHEN("We iterate using the zip iterator")
+		{
+			int expected = 0;
+			bool valid = true;
+			for (auto&& [position, id, name] : particles)
+			{
+				if (position != float(expected) || id != Nz::UInt8(expected) || name != std::to_string(expected))
+					valid = false;
+
+				position *= 2.f;
+				expected++;
+			}
+			CHECK(valid);
+			CHECK(expected == 101);
+			CHECK(particles.column<0>()[50] == 100.f);
+
+			CHECK(particles.end() - particles.begin() == 101);
+			CHECK(std::get<0>(*(particles.begin() + 3)) == 6.f);
+			CHECK(std::get<0>(particles.cbegin()[4]) == 8.f);
+
+			auto it = std::find_if(particles.cbegin(), particles.cend(), [](const auto& particle) { return std::get<2>(particle) == "64"; });
+			CHECK(it.GetIndex() == 64);
+		}
+
+		WHEN("We erase and pop elements")
+		{
+			particles.erase(particles.begin());
+			particles.erase(particles.begin() + 10);
+			particles.pop_back();
+
+			CHECK(particles.size() == 98);
+			CHECK(std::get<2>(particles[0]) == "1");
+			CHECK(std::get<2>(particles[10]) == "12");
+			CHECK(std::get<2>(particles.back()) == "99");
+		}
+
+		WHEN("We copy and move it")
+		{
+			Particles copy(particles);
+			CHECK(copy.size() == particles.size());
+			CHECK(copy.column<2>()[77] == "77");
+
+			Particles moved(std::move(copy));
+			CHECK(copy.empty());
+			CHECK(moved.column<2>()[77] == "77");
+
+			copy = moved;
+			moved = std::move(copy);
+			CHECK(moved.size() == 101);
+			CHECK(std::get<0>(moved[99]) == 99.f);
+		}
+
+		WHEN("We resize it")
+		{
+			particles.resize(10);
+			CHECK(particles.size() == 10);
+			particles.shrink_to_fit();
+			CHECK(particles.capacity() == 10);
+
+			particles.resize(20);
+			CHECK(std::get<0>(particles[15]) == 0.f);
+			CHECK(std::get<2>(particles[15]).empty());
+			CHECK(std::get<2>(particles[9]) == "9");
+
+			particles.clear();
+			CHECK(particles.empty());
+		}
+
+		WHEN("We push one of its elements while reallocating")
+		{
+			particles.shrink_to_fit();
+			particles.push_back(particles[7]);
+			CHECK(std::get<2>(particles.back()) == "7");
+		}
+	}
+
+	GIVEN("A SoAVector of non-trivial types")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::SoAVector<Nz::TypeList<AliveCounter, int>, 16> vec;
+			for (int i = 0; i < 50; ++i)
+				vec.emplace_back(AliveCounter(&counter, i), i);
+
+			CHECK(counter.aliveCount == 50);
+			CHECK(counter.copyCount == 0);
+
+			vec.erase(vec.begin() + 5);
+			CHECK(counter.aliveCount == 49);
+			CHECK(int(std::get<0>(vec[5])) == 6);
+
+			vec.reserve(1000);
+			CHECK(counter.aliveCount == 49);
+			CHECK(int(std::get<0>(vec.back())) == 49);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+}
@@ -2,6 +2,8 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <string>
+#include <vector>
 
 SCENARIO("SparsePtr", "[CORE][SPARSEPTR]")
 {
@@ -44,4 +46,98 @@ SCENARIO("SparsePtr", "[CORE][SPARSEPTR]")
 			}
 		}
 	}
+
+	GIVEN("Interleaved vertex data")
+	{
+		struct Vertex
+		{
+			float position[3];
+			float normal[3];
+			float uv[2];
+		};
+
+		struct Position
+		{
+			float x, y, z;
+		};
+
+		std::vector<Vertex> vertices(37);
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+		{
+			float value = float(i);
+			vertices[i] = Vertex{ { value, value + 0.5f, -value }, { 0.f, 1.f, 0.f }, { value, value } };
+		}
+
+		Nz::SparsePtr<const Position> positionPtr(&vertices[0].position, sizeof(Vertex));
+		Nz::SparsePtr<float> uPtr(&vertices[0].uv[0], sizeof(Vertex));
+
+		WHEN("We gather positions")
+		{
+			std::vector<Position> positions(vertices.size());
+			Nz::CopyTo(positionPtr, positions.data(), positions.size());
+
+			bool valid = true;
+			for (std::size_t i = 0; i < vertices.size(); ++i)
+			{
+				if (positions[i].x != float(i) || positions[i].y != float(i) + 0.5f || positions[i].z != -float(i))
+					valid = false;
+			}
+			CHECK(valid);
+		}
+
+		WHEN("We scatter texture coordinates")
+		{
+			std::vector<float> us(vertices.size() - 2, 42.f);
+			Nz::CopyFrom(us.data(), uPtr + 1, us.size());
+
+			CHECK(vertices.front().uv[0] == 0.f);
+			CHECK(vertices[1].uv[0] == 42.f);
+			CHECK(vertices[35].uv[0] == 42.f);
+			CHECK(vertices[35].uv[1] == 35.f);
+			CHECK(vertices.back().uv[0] == 36.f);
+		}
+
+		WHEN("We transform positions")
+		{
+			std::vector<float> lengths(vertices.size());
+			Nz::Transform(positionPtr, lengths.data(), lengths.size(), [](const Position& position) { return position.x + position.y + position.z; });
+
+			CHECK(lengths[0] == 0.5f);
+			CHECK(lengths[36] == 36.5f);
+		}
+	}
+
+	GIVEN("Common and contiguous strides")
+	{
+		std::vector<int> values(103);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = int(i);
+
+		for (std::size_t step : { 1, 2, 3, 4, 5 })
+		{
+			std::size_t count = values.size() / step;
+
+			std::vector<int> gathered(count);
+			Nz::CopyTo(Nz::SparsePtr<const int>(values.data(), step * sizeof(int)), gathered.data(), count);
+
+			bool valid = true;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (gathered[i] != int(i * step))
+					valid = false;
+			}
+			CHECK(valid);
+
+			std::vector<int> scattered(values.size(), -1);
+			Nz::CopyFrom(gathered.data(), Nz::SparsePtr<int>(scattered.data(), step * sizeof(int)), count);
+			CHECK(scattered[(count - 1) * step] == int((count - 1) * step));
+			if (step > 1)
+				CHECK(scattered[1] == -1);
+		}
+
+		std::vector<std::string> strings = { "a", "b", "c", "d", "e", "f" };
+		std::vector<std::string> evens(3);
+		Nz::CopyTo(Nz::SparsePtr<const std::string>(strings.data(), 2 * sizeof(std::string)), evens.data(), evens.size());
+		CHECK(evens == std::vector<std::string>{ "a", "c", "e" });
+	}
 }
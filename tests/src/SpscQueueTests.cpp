@@ -0,0 +1,126 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/SpscQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("SpscQueue", "[CORE][SPSCQUEUE]")
+{
+	GIVEN("A queue of strings")
+	{
+		Nz::SpscQueue<std::string, 4> queue;
+		CHECK(queue.IsEmpty());
+		CHECK(queue.GetCapacity() == 4);
+
+		std::string value;
+		CHECK_FALSE(queue.TryPop(value));
+
+		WHEN("We fill it")
+		{
+			CHECK(queue.TryPush("a"));
+			CHECK(queue.TryEmplace(3, 'b'));
+			CHECK(queue.TryPush(std::string("c")));
+			CHECK(queue.TryPush("d"));
+			CHECK_FALSE(queue.TryPush("e"));
+			CHECK(queue.GetSize() == 4);
+
+			CHECK(queue.TryPop(value));
+			CHECK(value == "a");
+			CHECK(queue.TryPop(value));
+			CHECK(value == "bbb");
+
+			CHECK(queue.TryPush("e"));
+			CHECK(queue.TryPush("f"));
+
+			std::array<std::string, 8> values;
+			CHECK(queue.TryPopN(values.begin(), values.size()) == 4);
+			CHECK(values[0] == "c");
+			CHECK(values[3] == "f");
+			CHECK(queue.IsEmpty());
+		}
+
+		WHEN("We push in batches")
+		{
+			std::vector<std::string> values = { "a", "b", "c", "d", "e", "f" };
+			CHECK(queue.TryPushN(std::make_move_iterator(values.begin()), values.size()) == 4);
+			CHECK(values[0].empty());
+			CHECK(values[4] == "e");
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 0);
+
+			std::vector<std::string> output;
+			CHECK(queue.TryPopN(std::back_inserter(output), 3) == 3);
+			CHECK(output == std::vector<std::string>{ "a", "b", "c" });
+
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 2);
+			CHECK(queue.GetSize() == 3);
+		}
+	}
+
+	GIVEN("A queue of non-trivial types")
+	{
+		AliveCounter::Counter counter;
+		{
+			Nz::SpscQueue<AliveCounter, 8> queue;
+			for (int i = 0; i < 5; ++i)
+				CHECK(queue.TryEmplace(&counter, i));
+
+			CHECK(counter.aliveCount == 5);
+
+			AliveCounter value(&counter, -1);
+			CHECK(queue.TryPop(value));
+			CHECK(int(value) == 0);
+			CHECK(counter.aliveCount == 5);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("A producer and a consumer thread")
+	{
+		constexpr std::size_t ValueCount = 200'000;
+
+		auto queue = std::make_unique<Nz::SpscQueue<std::size_t, 256>>();
+
+		std::thread producer([&]
+		{
+			std::array<std::size_t, 16> batch;
+			std::size_t value = 0;
+			while (value < ValueCount)
+			{
+				if (value % 3 == 0)
+				{
+					if (queue->TryPush(value))
+						value++;
+				}
+				else
+				{
+					std::size_t count = std::min(batch.size(), ValueCount - value);
+					for (std::size_t i = 0; i < count; ++i)
+						batch[i] = value + i;
+
+					value += queue->TryPushN(batch.begin(), count);
+				}
+			}
+		});
+
+		bool ordered = true;
+		std::size_t expected = 0;
+		std::array<std::size_t, 32> batch;
+		while (expected < ValueCount)
+		{
+			std::size_t count = queue->TryPopN(batch.begin(), batch.size());
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (batch[i] != expected++)
+					ordered = false;
+			}
+		}
+
+		producer.join();
+
+		CHECK(ordered);
+		CHECK(queue->IsEmpty());
+	}
+}
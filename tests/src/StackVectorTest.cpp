@@ -1,9 +1,14 @@
 #include "AliveCounter.hpp"
+#include "CopyCounter.hpp"
 #include <NazaraUtils/MovablePtr.hpp>
 #include <NazaraUtils/StackVector.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <array>
+#include <iterator>
+#include <list>
 #include <numeric>
+#include <sstream>
+#include <vector>
 
 // This is a quick way to check that checks are valid
 #define USE_STD_VECTOR 0
@@ -310,4 +315,132 @@ SCENARIO("StackVector", "[CORE][STACKVECTOR]")
 
 		CHECK(counter.aliveCount == 0);
 	}
+
+	GIVEN("A StackVector of trivially copyable types")
+	{
+		struct Vertex
+		{
+			float x, y, z;
+			Nz::UInt32 color;
+		};
+		static_assert(std::is_trivially_copyable_v<Vertex>);
+
+		auto GetColors = [](const auto& vec)
+		{
+			std::vector<Nz::UInt32> colors;
+			for (const Vertex& vertex : vec)
+				colors.push_back(vertex.color);
+
+			return colors;
+		};
+
+		Nz::StackVector<Vertex> vertices = NazaraStackVector(Vertex, 16);
+		for (std::size_t i = 0; i < 8; ++i)
+			vertices.push_back(Vertex{ float(i), float(i) * 2.f, 0.f, Nz::UInt32(i) });
+
+		WHEN("Inserting and erasing elements")
+		{
+			vertices.insert(vertices.begin() + 2, Vertex{ 0.f, 0.f, 0.f, 42 });
+			vertices.emplace(vertices.begin(), Vertex{ 0.f, 0.f, 0.f, 43 });
+			vertices.insert(vertices.end(), Vertex{ 0.f, 0.f, 0.f, 44 });
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 43, 0, 1, 42, 2, 3, 4, 5, 6, 7, 44 });
+
+			vertices.erase(vertices.begin() + 3);
+			vertices.erase(vertices.begin(), vertices.begin() + 2);
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 1, 2, 3, 4, 5, 6, 7, 44 });
+			CHECK(vertices.front().y == 2.f);
+
+			vertices.erase(vertices.end() - 1);
+			vertices.resize(3);
+			CHECK(GetColors(vertices) == std::vector<Nz::UInt32>{ 1, 2, 3 });
+		}
+	}
+
+	GIVEN("A StackVector of non-trivially copyable types")
+	{
+		Nz::StackVector<CopyCounter> counters = NazaraStackVector(CopyCounter, 8);
+		counters.resize(4, CopyCounter{});
+		CHECK(std::all_of(counters.begin(), counters.end(), [](const CopyCounter& counter) { return counter.GetCopyCount() == 1; }));
+
+		WHEN("Erasing an element, following elements are moved")
+		{
+			counters.erase(counters.begin());
+			CHECK(counters.size() == 3);
+			CHECK(std::all_of(counters.begin(), counters.end(), [](const CopyCounter& counter) { return counter.GetMoveCount() == 1; }));
+		}
+
+		WHEN("Inserting an element, following elements are moved")
+		{
+			counters.insert(counters.begin(), CopyCounter{});
+			CHECK(counters.size() == 5);
+			CHECK(counters[0].GetCopyCount() == 0);
+			CHECK(counters[0].GetMoveCount() == 1);
+			CHECK(std::all_of(counters.begin() + 1, counters.end(), [](const CopyCounter& counter) { return counter.GetCopyCount() == 1 && counter.GetMoveCount() == 1; }));
+		}
+	}
+
+	GIVEN("A StackVector filled in bulk")
+	{
+		Nz::StackVector<Nz::UInt32> vec = NazaraStackVector(Nz::UInt32, 16);
+		std::array<Nz::UInt32, 5> values = { 1, 2, 3, 4, 5 };
+
+		WHEN("Appending and inserting ranges")
+		{
+			CHECK(*vec.append(values.begin(), values.end()) == 1);
+			CHECK(*vec.insert(vec.begin() + 2, values.begin(), values.begin() + 2) == 1);
+			vec.insert(vec.begin(), values.end() - 1, values.end());
+			vec.insert(vec.end(), values.begin(), values.begin());
+
+			std::array<Nz::UInt32, 8> expectedValues = { 5, 1, 2, 1, 2, 3, 4, 5 };
+			CHECK(std::equal(vec.begin(), vec.end(), expectedValues.begin(), expectedValues.end()));
+
+			AND_WHEN("Inserting from non-contiguous and input iterators")
+			{
+				std::list<Nz::UInt32> list = { 7, 8 };
+				vec.insert(vec.begin() + 1, list.begin(), list.end());
+
+				std::istringstream stream("9 10 11");
+				vec.insert(vec.begin(), std::istream_iterator<Nz::UInt32>(stream), std::istream_iterator<Nz::UInt32>());
+
+				std::array<Nz::UInt32, 13> expectedValues2 = { 9, 10, 11, 5, 7, 8, 1, 2, 1, 2, 3, 4, 5 };
+				CHECK(std::equal(vec.begin(), vec.end(), expectedValues2.begin(), expectedValues2.end()));
+			}
+		}
+
+		WHEN("Resizing it without initialization")
+		{
+			vec.resize_uninitialized(values.size());
+			std::copy(values.begin(), values.end(), vec.begin());
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.end()));
+
+			vec.resize_default_init(10);
+			CHECK(vec.size() == 10);
+			vec.resize_default_init(3);
+			CHECK(std::equal(vec.begin(), vec.end(), values.begin(), values.begin() + 3));
+		}
+
+		WHEN("Inserting ranges of non-trivial types")
+		{
+			AliveCounter::Counter counter;
+			{
+				std::array<AliveCounter, 3> counters = { AliveCounter(&counter, 1), AliveCounter(&counter, 2), AliveCounter(&counter, 3) };
+
+				Nz::StackVector<AliveCounter> counterVec = NazaraStackVector(AliveCounter, 16);
+				counterVec.emplace_back(&counter, 0);
+				counterVec.emplace_back(&counter, 4);
+				counterVec.insert(counterVec.begin() + 1, counters.begin(), counters.end());
+				counterVec.append(counters.begin(), counters.begin() + 1);
+				CHECK(counter.copyCount == 4);
+				CHECK(counter.aliveCount == 9);
+
+				std::array<int, 6> expectedValues = { 0, 1, 2, 3, 4, 1 };
+				CHECK(std::equal(counterVec.begin(), counterVec.end(), expectedValues.begin(), expectedValues.end()));
+
+				counterVec.resize_default_init(8);
+				CHECK(counterVec[7] == 0);
+				CHECK(counter.aliveCount == 9);
+			}
+			CHECK(counter.aliveCount == 0);
+		}
+	}
 }
@@ -0,0 +1,188 @@
+#include <NazaraUtils/StaticBitset.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr Nz::StaticBitset<12, Nz::UInt8> MakeConstexprBitset()
+	{
+		Nz::StaticBitset<12, Nz::UInt8> bitset("101100000011");
+		bitset.Set(5, true);
+		bitset.Reset(0);
+		return bitset;
+	}
+
+	template<std::size_t N, typename Block>
+	void CheckStaticBitset()
+	{
+		using BitsetType = Nz::StaticBitset<N, Block>;
+
+		std::mt19937 rand(static_cast<unsigned int>(N * sizeof(Block)));
+		std::bernoulli_distribution dis(0.3);
+
+		BitsetType a;
+		BitsetType b;
+		std::vector<bool> refA(N);
+		std::vector<bool> refB(N);
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			refA[i] = dis(rand);
+			refB[i] = dis(rand);
+			a.Set(i, refA[i]);
+			b.Set(i, refB[i]);
+		}
+
+		std::size_t countA = 0;
+		std::size_t countAnd = 0;
+		std::size_t countAndNot = 0;
+		bool intersects = false;
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			if (refA[i])
+				countA++;
+
+			if (refA[i] && refB[i])
+			{
+				countAnd++;
+				intersects = true;
+			}
+
+			if (refA[i] && !refB[i])
+				countAndNot++;
+		}
+
+		CHECK(a.Count() == countA);
+		CHECK(a.CountAnd(b) == countAnd);
+		CHECK(a.CountAndNot(b) == countAndNot);
+		CHECK(a.Intersects(b) == intersects);
+		CHECK(a.IntersectsAndNot(b) == (countAndNot != 0));
+
+		auto CheckResult = [&](const BitsetType& result, auto&& op)
+		{
+			bool ok = true;
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				if (result.Test(i) != op(refA[i], refB[i]))
+					ok = false;
+			}
+
+			return ok;
+		};
+
+		CHECK(CheckResult(a & b, [](bool x, bool y) { return x && y; }));
+		CHECK(CheckResult(a | b, [](bool x, bool y) { return x || y; }));
+		CHECK(CheckResult(a ^ b, [](bool x, bool y) { return x != y; }));
+		CHECK(CheckResult(~a, [](bool x, bool) { return !x; }));
+
+		BitsetType andNot;
+		andNot.PerformsANDNOT(a, b);
+		CHECK(CheckResult(andNot, [](bool x, bool y) { return x && !y; }));
+		CHECK(andNot.IsSubsetOf(a));
+		CHECK(andNot.Count() == countAndNot);
+
+		// Negation must not leak bits past N
+		CHECK((~a).Count() == N - countA);
+
+		std::vector<std::size_t> expectedBits;
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			if (refA[i])
+				expectedBits.push_back(i);
+		}
+
+		std::vector<std::size_t> bits;
+		for (std::size_t bit : a.IterBits())
+			bits.push_back(bit);
+
+		CHECK(bits == expectedBits);
+
+		BitsetType full;
+		full.Set(true);
+		CHECK(full.TestAll());
+		CHECK(full.Count() == N);
+
+		full.Reset(N - 1);
+		CHECK_FALSE(full.TestAll());
+		CHECK(full.Count() == N - 1);
+
+		full.Flip();
+		CHECK(full.Count() == 1);
+		CHECK(full.FindFirst() == N - 1);
+		CHECK(full.FindNext(N - 1) == BitsetType::npos);
+
+		BitsetType copy(a);
+		CHECK(copy == a);
+		copy ^= a;
+		CHECK(copy.TestNone());
+		CHECK((copy != a) == a.TestAny());
+	}
+}
+
+SCENARIO("StaticBitset", "[CORE][STATICBITSET]")
+{
+	static_assert(Nz::StaticBitset<12, Nz::UInt8>::GetBlockCount() == 2);
+	static_assert(Nz::StaticBitset<64, Nz::UInt64>::GetBlockCount() == 1);
+	static_assert(Nz::StaticBitset<65, Nz::UInt64>::GetBlockCount() == 2);
+	static_assert(Nz::StaticBitset<12, Nz::UInt8>::GetSize() == 12);
+
+	static_assert(MakeConstexprBitset().Test(1));
+	static_assert(!MakeConstexprBitset().Test(0));
+	static_assert(MakeConstexprBitset().Test(5));
+	static_assert(MakeConstexprBitset().Test(11));
+	static_assert(MakeConstexprBitset().To<Nz::UInt16>() == 0b1011'0010'0010);
+	static_assert((~MakeConstexprBitset()).To<Nz::UInt16>() == 0b0100'1101'1101);
+	static_assert(Nz::StaticBitset<12, Nz::UInt8>(0xFFFFu).To<Nz::UInt16>() == 0x0FFF);
+	static_assert(Nz::StaticBitset<12, Nz::UInt8>(0xFFFFu).TestAll());
+	static_assert((MakeConstexprBitset() & Nz::StaticBitset<12, Nz::UInt8>(0x0F0u)).To<Nz::UInt16>() == 0b0000'0010'0000);
+	static_assert(MakeConstexprBitset().Intersects(Nz::StaticBitset<12, Nz::UInt8>(0x002u)));
+	static_assert(Nz::StaticBitset<12, Nz::UInt8>(0x002u).IsSubsetOf(MakeConstexprBitset()));
+
+#ifdef NAZARA_HAS_CONSTEVAL
+	static_assert(MakeConstexprBitset().Count() == 5);
+	static_assert(MakeConstexprBitset().FindFirst() == 1);
+	static_assert(MakeConstexprBitset().FindNext(1) == 5);
+	static_assert(MakeConstexprBitset().FindNext(11) == Nz::StaticBitset<12, Nz::UInt8>::npos);
+#endif
+
+	GIVEN("A StaticBitset constructed from a string")
+	{
+		Nz::StaticBitset<12, Nz::UInt8> bitset("101100000011");
+
+		CHECK(bitset.ToString() == "101100000011");
+		CHECK(bitset.Count() == 5);
+		CHECK(bitset.To<Nz::UInt16>() == 0b1011'0000'0011);
+
+		WHEN("We iterate its bits")
+		{
+			std::vector<std::size_t> bits;
+			for (std::size_t bit : bitset.IterBits())
+				bits.push_back(bit);
+
+			CHECK(bits == std::vector<std::size_t>{ 0, 1, 8, 9, 11 });
+		}
+
+		WHEN("We set a block with bits past the end")
+		{
+			bitset.SetBlock(1, 0xFF);
+
+			THEN("Extra bits are discarded")
+			{
+				CHECK(bitset.GetBlock(1) == 0x0F);
+				CHECK(bitset.ToString() == "111100000011");
+			}
+		}
+	}
+
+	GIVEN("StaticBitsets of various sizes and block types")
+	{
+		CheckStaticBitset<1, Nz::UInt8>();
+		CheckStaticBitset<7, Nz::UInt8>();
+		CheckStaticBitset<64, Nz::UInt8>();
+		CheckStaticBitset<100, Nz::UInt16>();
+		CheckStaticBitset<32, Nz::UInt32>();
+		CheckStaticBitset<257, Nz::UInt32>();
+		CheckStaticBitset<1000, Nz::UInt64>();
+		CheckStaticBitset<4096, Nz::UInt64>();
+	}
+}
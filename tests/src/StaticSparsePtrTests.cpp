@@ -0,0 +1,159 @@
+#include <NazaraUtils/SparseSpan.hpp>
+#include <NazaraUtils/StaticSparsePtr.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+	struct Vertex
+	{
+		float position[3];
+		int id;
+	};
+}
+
+static_assert(std::is_same_v<std::iterator_traits<Nz::StaticSparsePtr<int, 8>>::iterator_category, std::random_access_iterator_tag>);
+static_assert(std::is_same_v<std::iterator_traits<Nz::StaticSparsePtr<const int, 8>>::reference, const int&>);
+static_assert(std::is_same_v<std::iterator_traits<Nz::StaticSparsePtr<const int, 8>>::value_type, int>);
+static_assert(Nz::StaticSparsePtr<int, 8>::GetStride() == 8);
+static_assert(sizeof(Nz::StaticSparsePtr<int, 8>) == sizeof(int*));
+
+#ifdef __cpp_lib_concepts
+static_assert(std::random_access_iterator<Nz::StaticSparsePtr<int, 8>>);
+static_assert(std::random_access_iterator<Nz::StaticSparsePtr<const Vertex, sizeof(Vertex)>>);
+#endif
+
+SCENARIO("StaticSparsePtr", "[CORE][SPARSEPTR]")
+{
+	GIVEN("A static sparse pointer pointing to an array with a stride of 2")
+	{
+		std::array<int, 6> values = { 0, 1, 2, 3, 4, 5 };
+		Nz::StaticSparsePtr<int, 2 * sizeof(int)> ptr(values.data());
+
+		WHEN("We use operators")
+		{
+			CHECK(*ptr == 0);
+			CHECK(ptr[2] == 4);
+			CHECK(*(ptr + 1) == 2);
+			CHECK(*(1 + ptr) == 2);
+			CHECK((ptr + 3) - ptr == 3);
+
+			auto it = ptr;
+			CHECK(*++it == 2);
+			CHECK(*it++ == 2);
+			CHECK(*it-- == 4);
+			CHECK(*--it == 0);
+
+			it += 2;
+			CHECK(*it == 4);
+			it -= 1;
+			CHECK(*it == 2);
+
+			CHECK(ptr < it);
+			CHECK(it > ptr);
+			CHECK(ptr <= ptr);
+			CHECK(it != ptr);
+		}
+
+		WHEN("We convert it to and from a SparsePtr")
+		{
+			Nz::SparsePtr<const int> sparsePtr = ptr;
+			CHECK(sparsePtr.GetStride() == 2 * sizeof(int));
+			CHECK(sparsePtr[2] == 4);
+
+			Nz::StaticSparsePtr<const int, 2 * sizeof(int)> staticPtr(sparsePtr + 1);
+			CHECK(*staticPtr == 2);
+
+			Nz::StaticSparsePtr<const int, 2 * sizeof(int)> constPtr = ptr;
+			CHECK(constPtr[1] == 2);
+		}
+
+		WHEN("We use standard algorithms")
+		{
+			CHECK(std::accumulate(ptr, ptr + 3, 0) == 6);
+
+			std::reverse(ptr, ptr + 3);
+			CHECK(values == std::array<int, 6>{ 4, 1, 2, 3, 0, 5 });
+
+			std::sort(ptr, ptr + 3);
+			CHECK(values == std::array<int, 6>{ 0, 1, 2, 3, 4, 5 });
+
+			CHECK(std::lower_bound(ptr, ptr + 3, 3) - ptr == 2);
+		}
+	}
+
+	GIVEN("A negative stride")
+	{
+		std::array<int, 4> values = { 0, 1, 2, 3 };
+		Nz::StaticSparsePtr<int, -int(sizeof(int))> ptr(&values[3]);
+
+		CHECK(*ptr == 3);
+		CHECK(ptr[3] == 0);
+		CHECK(ptr < ptr + 1);
+		CHECK(std::is_sorted(ptr, ptr + 4, std::greater<int>()));
+	}
+}
+
+SCENARIO("SparseSpan", "[CORE][SPARSEPTR]")
+{
+	GIVEN("Interleaved vertices")
+	{
+		std::vector<Vertex> vertices(10);
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+			vertices[i] = Vertex{ { float(i), 0.f, 0.f }, int(vertices.size() - i) };
+
+		Nz::SparseSpan ids(Nz::StaticSparsePtr<int, sizeof(Vertex)>(&vertices[0].id), vertices.size());
+		static_assert(std::is_same_v<decltype(ids), Nz::SparseSpan<int, sizeof(Vertex)>>);
+
+		CHECK(ids.size() == 10);
+		CHECK(ids.front() == 10);
+		CHECK(ids.back() == 1);
+		CHECK(ids[4] == 6);
+		CHECK(std::distance(ids.begin(), ids.end()) == 10);
+
+		WHEN("We iterate over it")
+		{
+			int sum = 0;
+			for (int id : ids)
+				sum += id;
+
+			CHECK(sum == 55);
+
+			std::sort(ids.begin(), ids.end());
+			CHECK(vertices[0].id == 1);
+			CHECK(vertices[9].id == 10);
+			CHECK(vertices[9].position[0] == 9.f);
+		}
+
+		WHEN("We take subspans")
+		{
+			CHECK(ids.first(3).back() == 8);
+			CHECK(ids.last(2).front() == 2);
+			CHECK(ids.subspan(2, 3).size() == 3);
+			CHECK(ids.subspan(2, 3)[0] == 8);
+			CHECK(ids.subspan(10, 0).empty());
+		}
+
+		WHEN("We convert it to a runtime stride span")
+		{
+			Nz::SparseSpan<const int> dynamicIds = ids;
+			CHECK(dynamicIds.data().GetStride() == sizeof(Vertex));
+			CHECK(dynamicIds.size() == 10);
+			CHECK(dynamicIds[9] == 1);
+
+			Nz::SparseSpan fromSparsePtr(Nz::SparsePtr<float>(&vertices[0].position[0], sizeof(Vertex)), vertices.size());
+			static_assert(std::is_same_v<decltype(fromSparsePtr), Nz::SparseSpan<float>>);
+
+			float sum = 0.f;
+			for (float x : fromSparsePtr)
+				sum += x;
+
+			CHECK(sum == 45.f);
+		}
+	}
+}
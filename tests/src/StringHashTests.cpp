@@ -1,8 +1,37 @@
 #include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <NazaraUtils/HashedString.hpp>
 #include <NazaraUtils/StringHash.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <unordered_map>
 
+TEST_CASE("HashedString", "[StringHash]")
+{
+	using namespace std::literals;
+
+	constexpr Nz::HashedStringView key("Nazara Engine");
+	static_assert(key.GetHash() == Nz::WyHash64("Nazara Engine"));
+	static_assert(key.GetString() == "Nazara Engine"sv);
+	static_assert(key == Nz::HashedStringView("Nazara Engine"));
+	static_assert(key != Nz::HashedStringView("Nazara"));
+
+	CHECK(Nz::StringHash<char, Nz::WyHash64Hash>{}(key) == key.GetHash());
+
+	Nz::HashedString str("Nazara Engine"s);
+	CHECK(str.GetHash() == key.GetHash());
+	CHECK(str.GetString() == "Nazara Engine");
+	CHECK(str == key);
+	CHECK(key == str);
+	CHECK(str == "Nazara Engine"sv);
+	CHECK(Nz::HashedString(key) == str);
+	CHECK(Nz::HashedStringView(str).GetString().data() == str.GetString().data());
+	CHECK(Nz::StringHash<char, Nz::WyHash64Hash>{}(str) == key.GetHash());
+
+	// precomputed hash is trusted
+	constexpr Nz::HashedStringView forcedHash("Nazara Engine"sv, 42);
+	CHECK(Nz::StringHash<char, Nz::WyHash64Hash>{}(forcedHash) == 42);
+}
+
 #if NAZARA_CHECK_CPP_VER(NAZARA_CPP20) && (!defined(NAZARA_PLATFORM_ANDROID) || NAZARA_CHECK_NDK_VER(26))
 
 TEST_CASE("StringHash", "[StringHash]")
@@ -20,6 +49,45 @@ TEST_CASE("StringHash", "[StringHash]")
 		CHECK(Nz::Retrieve(map, "test2"s) == 2);
 		CHECK(Nz::Retrieve(map, "test3") == 3);
 	}
+
+	SECTION("Test std::unordered_map with a custom hash")
+	{
+		using namespace std::literals;
+
+		std::unordered_map<std::string, unsigned int, Nz::StringHash<char, Nz::WyHash64Hash>, std::equal_to<>> map;
+		map["test1"] = 1;
+		map["test2"] = 2;
+
+		CHECK(Nz::StringHash<char, Nz::WyHash64Hash>{}("test1"sv) == Nz::WyHash64("test1"));
+		CHECK(Nz::Retrieve(map, "test1"sv) == 1);
+		CHECK(Nz::Retrieve(map, "test2"s) == 2);
+		CHECK(Nz::Retrieve(map, "test1") == 1);
+	}
+
+	SECTION("Test std::unordered_map with precomputed hashes")
+	{
+		using namespace std::literals;
+
+		static constexpr Nz::HashedStringView test1("test1");
+		static constexpr Nz::HashedStringView test2("test2");
+
+		std::unordered_map<std::string, unsigned int, Nz::StringHash<char, Nz::WyHash64Hash>, std::equal_to<>> map;
+		map["test1"] = 1;
+		map["test2"] = 2;
+
+		CHECK(Nz::Retrieve(map, test1) == 1);
+		CHECK(Nz::Retrieve(map, test2) == 2);
+		CHECK(map.find(Nz::HashedStringView("test3")) == map.end());
+
+		std::unordered_map<Nz::HashedString, unsigned int, Nz::StringHash<char, Nz::WyHash64Hash>, std::equal_to<>> hashedMap;
+		hashedMap.emplace(test1, 1);
+		hashedMap.emplace(Nz::HashedString("test2"), 2);
+
+		CHECK(Nz::Retrieve(hashedMap, test1) == 1);
+		CHECK(Nz::Retrieve(hashedMap, "test2"sv) == 2);
+		CHECK(Nz::Retrieve(hashedMap, "test2") == 2);
+		CHECK(hashedMap.find(Nz::HashedStringView("test3")) == hashedMap.end());
+	}
 }
 
 #endif
@@ -0,0 +1,137 @@
+#include <NazaraUtils/FlatHashMap.hpp>
+#include <NazaraUtils/StringPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("StringPool", "[CORE][STRINGPOOL]")
+{
+	GIVEN("A string pool")
+	{
+		Nz::StringPool pool(256);
+		CHECK(pool.GetStringCount() == 0);
+		CHECK(pool.GetAllocatedSize() == 0);
+
+		WHEN("We intern strings")
+		{
+			std::string name = "Material";
+			Nz::InternedString a = pool.Intern(name);
+			Nz::InternedString b = pool.Intern("Texture");
+			Nz::InternedString c = pool.Intern(std::string("Material"));
+
+			CHECK(pool.GetStringCount() == 2);
+			CHECK(a == c);
+			CHECK(a != b);
+			CHECK(a.GetData() == c.GetData());
+			CHECK(a.GetString() == "Material");
+			CHECK(a.GetSize() == 8);
+			CHECK(a.GetData()[a.GetSize()] == '\0');
+			CHECK(a.GetHash() == Nz::HashedStringView("Material").GetHash());
+			CHECK(b.GetHash() == std::hash<Nz::InternedString>{}(b));
+
+			name[0] = 'm';
+			CHECK(a.GetString() == "Material");
+
+			CHECK(pool.Find("Texture") == b);
+			CHECK(pool.Find(Nz::HashedStringView("Material")) == a);
+			CHECK(pool.Find("Shader").IsEmpty());
+			CHECK(pool.GetStringCount() == 2);
+
+			Nz::HashedStringView view = a;
+			CHECK(view == Nz::HashedStringView("Material"));
+
+			THEN("Handles stay valid when the pool grows or is moved")
+			{
+				std::vector<Nz::InternedString> handles;
+				for (std::size_t i = 0; i < 1000; ++i)
+					handles.push_back(pool.Intern("String #" + std::to_string(i)));
+
+				CHECK(pool.GetStringCount() == 1002);
+				CHECK(pool.GetAllocatedSize() > 256);
+
+				Nz::StringPool movedPool = std::move(pool);
+				CHECK(a.GetString() == "Material");
+				for (std::size_t i = 0; i < 1000; ++i)
+				{
+					std::string str = "String #" + std::to_string(i);
+					CHECK(handles[i].GetString() == str);
+					CHECK(movedPool.Intern(str) == handles[i]);
+				}
+				CHECK(movedPool.GetStringCount() == 1002);
+			}
+
+			THEN("Clearing the pool removes every string")
+			{
+				pool.Clear();
+				CHECK(pool.GetStringCount() == 0);
+				CHECK(pool.Find("Material").IsEmpty());
+				CHECK(pool.Intern("Material").GetString() == "Material");
+			}
+		}
+
+		WHEN("We intern the empty string")
+		{
+			Nz::InternedString empty = pool.Intern("");
+			CHECK(empty == Nz::InternedString{});
+			CHECK(empty.IsEmpty());
+			CHECK(empty.GetString().empty());
+			CHECK(empty.GetData()[0] == '\0');
+			CHECK(empty.GetHash() == Nz::HashedStringView("").GetHash());
+			CHECK(pool.GetStringCount() == 0);
+		}
+
+		WHEN("We use interned strings as keys")
+		{
+			Nz::FlatHashMap<Nz::InternedString, int> map;
+			map[pool.Intern("A")] = 1;
+			map[pool.Intern("B")] = 2;
+
+			CHECK(map[pool.Intern("A")] == 1);
+			CHECK(map[pool.Intern("B")] == 2);
+			CHECK(map.size() == 2);
+		}
+	}
+
+	GIVEN("A concurrent string pool")
+	{
+		Nz::ConcurrentStringPool pool;
+
+		constexpr std::size_t ThreadCount = 4;
+		constexpr std::size_t StringCount = 2000;
+
+		std::vector<std::vector<Nz::InternedString>> handles(ThreadCount);
+		std::vector<std::thread> threads;
+		for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]
+			{
+				for (std::size_t i = 0; i < StringCount; ++i)
+					handles[threadIndex].push_back(pool.Intern("Entity #" + std::to_string(i)));
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		CHECK(pool.GetStringCount() == StringCount);
+		CHECK(pool.GetAllocatedSize() > 0);
+
+		bool allEqual = true;
+		for (std::size_t i = 0; i < StringCount; ++i)
+		{
+			for (std::size_t threadIndex = 1; threadIndex < ThreadCount; ++threadIndex)
+				allEqual &= (handles[threadIndex][i] == handles[0][i]);
+
+			allEqual &= (handles[0][i].GetString() == "Entity #" + std::to_string(i));
+		}
+		CHECK(allEqual);
+
+		CHECK(pool.Find("Entity #42") == handles[0][42]);
+		CHECK(pool.Find("Entity").IsEmpty());
+		CHECK(pool.Intern("") == Nz::InternedString{});
+
+		pool.Clear();
+		CHECK(pool.GetStringCount() == 0);
+	}
+}
@@ -1,5 +1,10 @@
 #include <NazaraUtils/StringUtils.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
 
 SCENARIO("StringUtils", "[StringUtils]")
 {
@@ -14,4 +19,281 @@ SCENARIO("StringUtils", "[StringUtils]")
 		CHECK(Nz::ToUtf8String("test"s) == u8"test");
 		CHECK(Nz::ToUtf8String("test"sv) == u8"test");
 	}
+
+	SECTION("Validating UTF-8")
+	{
+		using namespace std::literals;
+
+		CHECK(Nz::IsValidUtf8(""));
+		CHECK(Nz::IsValidUtf8("Hello world"));
+		CHECK(Nz::IsValidUtf8("\xC3\xA9t\xC3\xA9"));               //< été
+		CHECK(Nz::IsValidUtf8("\xE2\x82\xAC"));                    //< U+20AC
+		CHECK(Nz::IsValidUtf8("\xEF\xBF\xBF"));                    //< U+FFFF
+		CHECK(Nz::IsValidUtf8("\xF0\x9F\x98\x80"));                //< U+1F600
+		CHECK(Nz::IsValidUtf8("\xF4\x8F\xBF\xBF"));                //< U+10FFFF
+		CHECK(Nz::IsValidUtf8("\0"sv));
+
+		CHECK_FALSE(Nz::IsValidUtf8("\x80"));                      //< lone continuation byte
+		CHECK_FALSE(Nz::IsValidUtf8("\xC3"));                      //< truncated sequence
+		CHECK_FALSE(Nz::IsValidUtf8("\xE2\x82"));
+		CHECK_FALSE(Nz::IsValidUtf8("\xC3\xA9\xA9"));              //< too long
+		CHECK_FALSE(Nz::IsValidUtf8("\xC0\xAF"));                  //< overlong '/'
+		CHECK_FALSE(Nz::IsValidUtf8("\xE0\x80\xAF"));
+		CHECK_FALSE(Nz::IsValidUtf8("\xF0\x80\x80\xAF"));
+		CHECK_FALSE(Nz::IsValidUtf8("\xED\xA0\x80"));              //< surrogate
+		CHECK_FALSE(Nz::IsValidUtf8("\xF4\x90\x80\x80"));          //< above U+10FFFF
+		CHECK_FALSE(Nz::IsValidUtf8("\xF8\x88\x80\x80\x80"));
+		CHECK_FALSE(Nz::IsValidUtf8("\xFF"));
+	}
+
+	SECTION("Validating long UTF-8 strings")
+	{
+		// Vectorized validation works on chunks, put every error at every offset of a string long enough to be dispatched
+		const std::string_view invalidSequences[] = { "\x80", "\xC3", "\xE2\x82", "\xF0\x9F\x98", "\xC0\xAF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xC3\xA9\xA9", "\xFF" };
+		const std::string_view validSequences[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+
+		bool matches = true;
+		for (std::string_view sequence : validSequences)
+		{
+			for (std::size_t offset = 0; offset < 80; ++offset)
+			{
+				std::string str(offset, 'x');
+				str += sequence;
+				str.append(80 - offset, 'y');
+
+				matches = matches && Nz::IsValidUtf8(str);
+			}
+		}
+
+		for (std::string_view sequence : invalidSequences)
+		{
+			for (std::size_t offset = 0; offset < 80; ++offset)
+			{
+				std::string str(offset, 'x');
+				str += sequence;
+				matches = matches && !Nz::IsValidUtf8(str); //< at the end of the string
+
+				str.append(80 - offset, 'y');
+				matches = matches && !Nz::IsValidUtf8(str);
+			}
+		}
+		CHECK(matches);
+	}
+
+	SECTION("Comparing vectorized and scalar validation on random strings")
+	{
+		std::minstd_rand gen(1337);
+		std::uniform_int_distribution<unsigned int> sequenceDis(0, 3);
+		std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+		const std::string_view sequences[] = { "hello ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+
+		bool matches = true;
+		for (std::size_t i = 0; i < 2000; ++i)
+		{
+			std::string str;
+			while (str.size() < 100)
+				str += sequences[sequenceDis(gen)];
+
+			// Corrupt some of them
+			if (i % 2 == 0)
+				str[byteDis(gen) % str.size()] = static_cast<char>(byteDis(gen));
+
+			const Nz::UInt8* data = reinterpret_cast<const Nz::UInt8*>(str.data());
+			matches = matches && (Nz::IsValidUtf8(str) == Nz::Detail::ScalarValidateUtf8(data, str.size()));
+		}
+		CHECK(matches);
+	}
+
+	SECTION("Transcoding")
+	{
+		using namespace std::literals;
+
+		// Long enough to go through ASCII chunks and mixed chunks
+		std::string utf8;
+		std::u16string utf16;
+		std::u32string utf32;
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			utf8 += "Hello world, \xC3\xA9t\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 !";
+			utf16 += u"Hello world, été € \U0001F600 !";
+			utf32 += U"Hello world, été € \U0001F600 !";
+		}
+
+		for (std::size_t size : { std::size_t(0), std::size_t(5), std::size_t(33), utf32.size() })
+		{
+			std::size_t utf8Size = 0;
+			std::size_t utf16Size = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				char32_t c = utf32[i];
+				utf8Size += (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : 4;
+				utf16Size += (c < 0x10000) ? 1 : 2;
+			}
+
+			std::string_view utf8View = std::string_view(utf8).substr(0, utf8Size);
+			std::u16string_view utf16View = std::u16string_view(utf16).substr(0, utf16Size);
+			std::u32string_view utf32View = std::u32string_view(utf32).substr(0, size);
+
+			CHECK(Nz::Utf16LengthFromUtf8(utf8View) == utf16Size);
+			CHECK(Nz::Utf32LengthFromUtf8(utf8View) == size);
+			CHECK(Nz::Utf8LengthFromUtf16(utf16View) == utf8Size);
+
+			std::u16string utf16Result(utf16Size, u'\0');
+			CHECK(Nz::Utf8ToUtf16(utf8View, utf16Result.data()) == utf16Size);
+			CHECK(utf16Result == utf16View);
+
+			std::u32string utf32Result(size, U'\0');
+			CHECK(Nz::Utf8ToUtf32(utf8View, utf32Result.data()) == size);
+			CHECK(utf32Result == utf32View);
+
+			std::string utf8Result(utf8Size, '\0');
+			CHECK(Nz::Utf16ToUtf8(utf16View, utf8Result.data()) == utf8Size);
+			CHECK(utf8Result == utf8View);
+		}
+
+		std::vector<char16_t> utf16Buffer(utf8.size() + 1);
+		std::vector<char32_t> utf32Buffer(utf8.size() + 1);
+		std::vector<char> utf8Buffer(utf16.size() * 3 + 3);
+
+		CHECK_FALSE(Nz::Utf8ToUtf16(utf8 + "\xC3", utf16Buffer.data()));
+		CHECK_FALSE(Nz::Utf8ToUtf16("\xED\xA0\x80"sv, utf16Buffer.data()));
+		CHECK_FALSE(Nz::Utf8ToUtf32(utf8 + "\xC0\xAF", utf32Buffer.data()));
+		CHECK_FALSE(Nz::Utf8ToUtf32("\xF4\x90\x80\x80"sv, utf32Buffer.data()));
+		CHECK_FALSE(Nz::Utf16ToUtf8(utf16 + u'\xD83D', utf8Buffer.data()));       //< unpaired high surrogate
+		CHECK_FALSE(Nz::Utf16ToUtf8(u"\xDE00 test"sv, utf8Buffer.data()));       //< unpaired low surrogate
+	}
+
+	SECTION("Splitting strings")
+	{
+		using namespace std::literals;
+
+		auto Split = [](std::string_view str, auto delimiter)
+		{
+			std::vector<std::string_view> tokens;
+			CHECK(Nz::SplitString(str, delimiter, [&](std::string_view token) { tokens.push_back(token); }));
+
+			// The range version must yield the same tokens
+			std::vector<std::string_view> rangeTokens;
+			for (std::string_view token : Nz::SplitStringRange(str, delimiter))
+				rangeTokens.push_back(token);
+
+			CHECK(rangeTokens == tokens);
+			return tokens;
+		};
+
+		CHECK(Split("", ',').empty());
+		CHECK(Split("a", ',') == std::vector{ "a"sv });
+		CHECK(Split("a,b,c", ',') == std::vector{ "a"sv, "b"sv, "c"sv });
+		CHECK(Split(",a,,b,", ',') == std::vector{ ""sv, "a"sv, ""sv, "b"sv, ""sv });
+		CHECK(Split(",", ',') == std::vector{ ""sv, ""sv });
+		CHECK(Split("key = value = other", " = "sv) == std::vector{ "key"sv, "value"sv, "other"sv });
+		CHECK(Split("a::b:c::", "::"sv) == std::vector{ "a"sv, "b:c"sv, ""sv });
+		CHECK(Split("a,b", ","sv) == std::vector{ "a"sv, "b"sv });
+		CHECK(Split("a,b", ""sv) == std::vector{ "a,b"sv });
+
+		// Tokens are views into the source
+		std::string_view str = "first second";
+		CHECK(Split(str, ' ')[1].data() == str.data() + 6);
+
+		std::size_t tokenCount = 0;
+		CHECK_FALSE(Nz::SplitString("a b c d", ' ', [&](std::string_view token)
+		{
+			tokenCount++;
+			return token != "b";
+		}));
+		CHECK(tokenCount == 2);
+
+		Nz::SplitRange range = Nz::SplitStringRange("a b c", ' ');
+		CHECK(std::distance(range.begin(), range.end()) == 3);
+
+		Nz::SplitIterator it = range.begin();
+		CHECK(*it++ == "a");
+		CHECK(it->size() == 1);
+		CHECK(*++it == "c");
+		CHECK(++it == range.end());
+	}
+
+	SECTION("Trimming and comparing strings")
+	{
+		static_assert(Nz::Trim("  \t hello world\r\n") == "hello world");
+		static_assert(Nz::TrimLeft("  hello  ") == "hello  ");
+		static_assert(Nz::TrimRight("  hello  ") == "  hello");
+		static_assert(Nz::Trim(" \t\n\v\f\r").empty());
+		static_assert(Nz::Trim("").empty());
+
+		static_assert(Nz::StartsWith("Nazara", "Naz"));
+		static_assert(Nz::StartsWith("Nazara", ""));
+		static_assert(!Nz::StartsWith("Naz", "Nazara"));
+		static_assert(Nz::EndsWith("Nazara", "ara"));
+		static_assert(!Nz::EndsWith("Nazara", "Ara"));
+		static_assert(!Nz::EndsWith("ara", "Nazara"));
+
+		static_assert(Nz::EqualsIgnoreCase("Content-Length", "content-LENGTH"));
+		static_assert(Nz::EqualsIgnoreCase("", ""));
+		static_assert(!Nz::EqualsIgnoreCase("Content-Length", "Content-Lengt"));
+		static_assert(!Nz::EqualsIgnoreCase("@", "`")); //< only letters are folded
+		CHECK_FALSE(Nz::EqualsIgnoreCase("\xC3\xA9", "\xC3\x89"));
+	}
+
+	SECTION("Parsing and formatting numbers")
+	{
+		CHECK(Nz::StringToNumber<int>("42").GetValue() == 42);
+		CHECK(Nz::StringToNumber<int>("-2147483648").GetValue() == std::numeric_limits<int>::min());
+		CHECK(Nz::StringToNumber<Nz::UInt64>("18446744073709551615").GetValue() == std::numeric_limits<Nz::UInt64>::max());
+		CHECK(Nz::StringToNumber<Nz::UInt8>("256").GetError() == Nz::NumberError::OutOfRange);
+		CHECK(Nz::StringToNumber<int>("").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<int>("12a").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<int>(" 12").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<int>("+12").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<unsigned int>("-1").GetError() == Nz::NumberError::InvalidFormat);
+
+		CHECK(Nz::StringToNumber<float>("0.5").GetValue() == 0.5f);
+		CHECK(Nz::StringToNumber<double>("-1.25e3").GetValue() == -1250.0);
+		CHECK(Nz::StringToNumber<double>("1e400").GetError() == Nz::NumberError::OutOfRange);
+		CHECK(Nz::StringToNumber<double>("1.5.2").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<double>("1e").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::StringToNumber<double>(".").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(std::isinf(Nz::StringToNumber<double>("-inf").GetValue()));
+		CHECK(std::isnan(Nz::StringToNumber<float>("nan").GetValue()));
+
+		char buffer[Nz::MaxNumberLength<double>()];
+		CHECK(Nz::NumberToString(42, buffer, sizeof(buffer)).GetValue() == "42");
+		CHECK(Nz::NumberToString(std::numeric_limits<Nz::Int64>::min(), buffer, sizeof(buffer)).GetValue() == "-9223372036854775808");
+		CHECK(Nz::NumberToString(0.5, buffer, sizeof(buffer)).GetValue() == "0.5");
+		CHECK(Nz::NumberToString(-1.25f, buffer, sizeof(buffer)).GetValue() == "-1.25");
+		CHECK(Nz::NumberToString(123456, buffer, 5).GetError() == Nz::NumberError::BufferTooSmall);
+
+		std::string str = "value=";
+		Nz::AppendNumber(str, 1337);
+		str += ' ';
+		Nz::AppendNumber(str, 0.25f);
+		CHECK(str == "value=1337 0.25");
+
+		// Every value must read back as itself, with both the standard library and the fallback
+		const double doubles[] = { 0.1, 1.0 / 3.0, -2.5e-300, 4.9e-324, 1.7976931348623157e308, 123456789.0 };
+		for (double value : doubles)
+		{
+			CHECK(Nz::StringToNumber<double>(Nz::NumberToString(value, buffer, sizeof(buffer)).GetValue()).GetValue() == value);
+
+			std::size_t length = Nz::Detail::FloatToStringFallback(value, buffer, sizeof(buffer));
+			REQUIRE(length > 0);
+			CHECK(Nz::Detail::StringToFloatFallback<double>(std::string_view(buffer, length)).GetValue() == value);
+		}
+
+		const float floats[] = { 0.1f, 1.0f / 3.0f, 3.4028235e38f, 1.0e-45f, -16777217.0f };
+		for (float value : floats)
+		{
+			CHECK(Nz::StringToNumber<float>(Nz::NumberToString(value, buffer, sizeof(buffer)).GetValue()).GetValue() == value);
+
+			std::size_t length = Nz::Detail::FloatToStringFallback(value, buffer, sizeof(buffer));
+			REQUIRE(length > 0);
+			CHECK(Nz::Detail::StringToFloatFallback<float>(std::string_view(buffer, length)).GetValue() == value);
+		}
+
+		CHECK(Nz::Detail::StringToFloatFallback<double>("1e400").GetError() == Nz::NumberError::OutOfRange);
+		CHECK(Nz::Detail::StringToFloatFallback<double>(" 1").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::Detail::StringToFloatFallback<double>("0x10").GetError() == Nz::NumberError::InvalidFormat);
+		CHECK(Nz::Detail::StringToFloatFallback<double>("-0.5e+1").GetValue() == -5.0);
+	}
 }
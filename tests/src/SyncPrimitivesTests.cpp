@@ -0,0 +1,227 @@
+#include <NazaraUtils/SyncPrimitives.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+static_assert(sizeof(Nz::SpinLock) == 4);
+static_assert(sizeof(Nz::FutexMutex) == 4);
+static_assert(sizeof(Nz::RWLock) == 4);
+static_assert(sizeof(Nz::SeqLock<Nz::UInt32>) == 8);
+
+namespace
+{
+	template<typename Mutex>
+	void TestMutualExclusion(Mutex& mutex)
+	{
+		constexpr unsigned int ThreadCount = 4;
+		constexpr unsigned int IterationCount = 20'000;
+
+		unsigned int counter = 0; //< not atomic, protected by the mutex
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < ThreadCount; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (unsigned int j = 0; j < IterationCount; ++j)
+				{
+					std::lock_guard lock(mutex);
+					counter++;
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		CHECK(counter == ThreadCount * IterationCount);
+	}
+}
+
+SCENARIO("SyncPrimitives", "[CORE][SYNCPRIMITIVES]")
+{
+	WHEN("Using a spinlock")
+	{
+		Nz::SpinLock spinLock;
+		CHECK_FALSE(spinLock.IsLocked());
+		CHECK(spinLock.try_lock());
+		CHECK(spinLock.IsLocked());
+		CHECK_FALSE(spinLock.try_lock());
+		spinLock.unlock();
+		CHECK_FALSE(spinLock.IsLocked());
+
+		TestMutualExclusion(spinLock);
+		CHECK_FALSE(spinLock.IsLocked());
+	}
+
+	WHEN("Using a futex mutex")
+	{
+		Nz::FutexMutex mutex;
+		CHECK_FALSE(mutex.IsLocked());
+		CHECK(mutex.try_lock());
+		CHECK(mutex.IsLocked());
+		CHECK_FALSE(mutex.try_lock());
+		mutex.unlock();
+		CHECK_FALSE(mutex.IsLocked());
+
+		TestMutualExclusion(mutex);
+		CHECK_FALSE(mutex.IsLocked());
+
+		// Hold the mutex long enough for the other thread to go to sleep
+		mutex.lock();
+		bool acquired = false;
+		std::thread thread([&]
+		{
+			std::lock_guard lock(mutex);
+			acquired = true;
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		mutex.unlock();
+		thread.join();
+		CHECK(acquired);
+	}
+
+	WHEN("Using a reader-writer lock")
+	{
+		Nz::RWLock rwLock;
+		CHECK(rwLock.try_lock_shared());
+		CHECK(rwLock.try_lock_shared());
+		CHECK_FALSE(rwLock.try_lock());
+		rwLock.unlock_shared();
+		rwLock.unlock_shared();
+		CHECK(rwLock.try_lock());
+		CHECK_FALSE(rwLock.try_lock_shared());
+		rwLock.unlock();
+
+		TestMutualExclusion(rwLock);
+
+		// Readers and writers keeping two values in sync
+		int first = 0;
+		int second = 0;
+		std::atomic<bool> mismatch = false;
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([&, i]
+			{
+				for (unsigned int j = 0; j < 5'000; ++j)
+				{
+					if (i == 0)
+					{
+						std::unique_lock lock(rwLock);
+						first++;
+						second++;
+					}
+					else
+					{
+						std::shared_lock lock(rwLock);
+						if (first != second)
+							mismatch = true;
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		CHECK_FALSE(mismatch);
+		CHECK(first == 5'000);
+	}
+
+	WHEN("A writer waits on readers")
+	{
+		Nz::RWLock rwLock;
+		rwLock.lock_shared();
+
+		std::atomic<bool> writerDone = false;
+		std::thread writer([&]
+		{
+			std::unique_lock lock(rwLock);
+			writerDone = true;
+		});
+
+		// Wait for the writer to announce itself, new readers must then be rejected
+		while (rwLock.try_lock_shared())
+		{
+			rwLock.unlock_shared();
+			std::this_thread::yield();
+		}
+
+		CHECK_FALSE(writerDone);
+		rwLock.unlock_shared();
+		writer.join();
+		CHECK(writerDone);
+		CHECK(rwLock.try_lock_shared());
+		rwLock.unlock_shared();
+	}
+
+	WHEN("Using a sequence lock")
+	{
+		struct Snapshot
+		{
+			Nz::UInt64 a;
+			Nz::UInt64 b;
+			Nz::UInt32 c;
+		};
+
+		Nz::SeqLock<Snapshot> seqLock(Snapshot{ 0, 0, 0 });
+		CHECK(seqLock.Load().c == 0);
+
+		seqLock.Store(Snapshot{ 1, 2, 3 });
+		Snapshot snapshot = seqLock.Load();
+		CHECK(snapshot.a == 1);
+		CHECK(snapshot.b == 2);
+		CHECK(snapshot.c == 3);
+
+		seqLock.Update([](Snapshot& value) { value.c = 42; });
+		CHECK(seqLock.Load().c == 42);
+		CHECK(seqLock.Load().a == 1);
+
+		seqLock.Store(Snapshot{ 1, 2, 1 });
+
+		std::atomic<bool> torn = false;
+		std::atomic<bool> stop = false;
+		std::vector<std::thread> readers;
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			readers.emplace_back([&]
+			{
+				while (!stop)
+				{
+					Snapshot value = seqLock.Load();
+					if (value.b != value.a * 2 || value.c != Nz::UInt32(value.a))
+						torn = true;
+				}
+			});
+		}
+
+		std::vector<std::thread> writers;
+		for (unsigned int i = 0; i < 2; ++i)
+		{
+			writers.emplace_back([&]
+			{
+				for (unsigned int j = 0; j < 10'000; ++j)
+				{
+					seqLock.Update([](Snapshot& value)
+					{
+						value.a++;
+						value.b = value.a * 2;
+						value.c = Nz::UInt32(value.a);
+					});
+				}
+			});
+		}
+
+		for (auto& thread : writers)
+			thread.join();
+
+		stop = true;
+		for (auto& thread : readers)
+			thread.join();
+
+		CHECK_FALSE(torn);
+		CHECK(seqLock.Load().a == 1 + 20'000);
+	}
+}
@@ -0,0 +1,151 @@
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("A task scheduler with four workers")
+	{
+		Nz::TaskScheduler scheduler(4);
+		CHECK(scheduler.GetWorkerCount() == 4);
+
+		WHEN("We submit independent tasks")
+		{
+			std::atomic<unsigned int> sum = 0;
+			std::vector<Nz::TaskScheduler::TaskHandle> handles;
+			for (unsigned int i = 1; i <= 100; ++i)
+				handles.push_back(scheduler.Submit([&sum, i] { sum += i; }));
+
+			for (const auto& handle : handles)
+			{
+				scheduler.Wait(handle);
+				CHECK(handle.IsFinished());
+			}
+
+			CHECK(sum == 5050);
+		}
+
+		WHEN("We submit more tasks than the queues can hold")
+		{
+			std::atomic<unsigned int> counter = 0;
+			for (unsigned int i = 0; i < 10'000; ++i)
+				scheduler.Submit([&counter] { counter++; });
+
+			scheduler.WaitAll();
+			CHECK(counter == 10'000);
+		}
+
+		WHEN("We submit a dependency chain")
+		{
+			std::vector<int> order;
+			Nz::TaskScheduler::TaskHandle previous;
+			for (int i = 0; i < 50; ++i)
+				previous = scheduler.Submit([&order, i] { order.push_back(i); }, { previous });
+
+			scheduler.Wait(previous);
+
+			REQUIRE(order.size() == 50);
+			for (int i = 0; i < 50; ++i)
+				CHECK(order[i] == i);
+		}
+
+		WHEN("We submit a diamond graph")
+		{
+			std::atomic<int> step = 0;
+			int leftStep = -1;
+			int rightStep = -1;
+			int lastStep = -1;
+
+			auto root = scheduler.Submit([&] { step = 1; });
+			auto left = scheduler.Submit([&] { leftStep = step.load(); }, { root });
+			auto right = scheduler.Submit([&] { rightStep = step.load(); }, { root });
+
+			Nz::TaskScheduler::TaskHandle dependencies[] = { left, right };
+			auto last = scheduler.Submit([&] { lastStep = leftStep + rightStep; }, dependencies, 2);
+
+			scheduler.Wait(last);
+			CHECK(root.IsFinished());
+			CHECK(left.IsFinished());
+			CHECK(right.IsFinished());
+			CHECK(leftStep == 1);
+			CHECK(rightStep == 1);
+			CHECK(lastStep == 2);
+		}
+
+		WHEN("We depend on an already finished task")
+		{
+			auto first = scheduler.Submit([] {});
+			scheduler.Wait(first);
+
+			bool ran = false;
+			auto second = scheduler.Submit([&] { ran = true; }, { first });
+			scheduler.Wait(second);
+			CHECK(ran);
+		}
+
+		WHEN("Tasks submit and wait on other tasks")
+		{
+			std::atomic<unsigned int> counter = 0;
+			std::vector<Nz::TaskScheduler::TaskHandle> handles;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				handles.push_back(scheduler.Submit([&]
+				{
+					Nz::TaskScheduler::TaskHandle children[8];
+					for (auto& child : children)
+						child = scheduler.Submit([&counter] { counter++; });
+
+					for (auto& child : children)
+						scheduler.Wait(child);
+				}));
+			}
+
+			for (const auto& handle : handles)
+				scheduler.Wait(handle);
+
+			CHECK(counter == 16 * 8);
+		}
+
+		WHEN("Several external threads submit tasks")
+		{
+			std::atomic<unsigned int> counter = 0;
+			std::vector<std::thread> threads;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&]
+				{
+					Nz::TaskScheduler::TaskHandle last;
+					for (unsigned int j = 0; j < 500; ++j)
+						last = scheduler.Submit([&counter] { counter++; }, { last });
+
+					scheduler.Wait(last);
+				});
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			CHECK(counter == 2000);
+		}
+	}
+
+	GIVEN("A task scheduler with a default worker count")
+	{
+		std::atomic<bool> ran = false;
+		{
+			Nz::TaskScheduler scheduler;
+			CHECK(scheduler.GetWorkerCount() >= 1);
+
+			Nz::TaskScheduler::TaskHandle handle = scheduler.Submit([&] { ran = true; });
+			CHECK(handle.IsValid());
+
+			handle.Reset();
+			CHECK_FALSE(handle.IsValid());
+		}
+
+		// Destructor waits on pending tasks
+		CHECK(ran);
+	}
+}
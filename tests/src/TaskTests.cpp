@@ -0,0 +1,126 @@
+#include <NazaraUtils/Task.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef NAZARA_HAS_COROUTINES
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+	Nz::Task<Nz::Result<int, std::string>> ParseDigit(char c)
+	{
+		if (c < '0' || c > '9')
+			co_return Nz::Err(std::string("not a digit: ") + c);
+
+		co_return c - '0';
+	}
+
+	Nz::Task<Nz::Result<int, std::string>> ParseNumber(std::string str)
+	{
+		int value = 0;
+		for (char c : str)
+		{
+			NAZARA_CO_TRY_VALUE(int digit, co_await ParseDigit(c));
+			value = value * 10 + digit;
+		}
+
+		co_return value;
+	}
+
+	Nz::Task<Nz::Result<void, std::string>> CheckPositive(std::string str)
+	{
+		NAZARA_CO_TRY(co_await ParseNumber(std::move(str)));
+		co_return Nz::Ok();
+	}
+
+	Nz::Task<int> Countdown(int depth)
+	{
+		if (depth == 0)
+			co_return 0;
+
+		co_return 1 + co_await Countdown(depth - 1);
+	}
+
+	Nz::Task<std::thread::id> ResumeOnScheduler(Nz::TaskScheduler& scheduler)
+	{
+		co_await Nz::ScheduleOn(scheduler);
+		co_return std::this_thread::get_id();
+	}
+
+	Nz::Task<int> SumOnScheduler(Nz::TaskScheduler& scheduler, int count)
+	{
+		int sum = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			co_await Nz::ScheduleOn(scheduler);
+			sum += i;
+		}
+
+		co_return sum;
+	}
+
+	Nz::Task<> Throwing()
+	{
+		throw std::runtime_error("failure");
+		co_return;
+	}
+}
+
+SCENARIO("Task", "[CORE][TASK]")
+{
+	WHEN("Running tasks returning results")
+	{
+		auto result = Nz::SyncWait(ParseNumber("1234"));
+		REQUIRE(result.IsOk());
+		CHECK(result.GetValue() == 1234);
+
+		result = Nz::SyncWait(ParseNumber("12a4"));
+		REQUIRE(result.IsErr());
+		CHECK(result.GetError() == "not a digit: a");
+
+		CHECK(Nz::SyncWait(CheckPositive("42")).IsOk());
+		CHECK(Nz::SyncWait(CheckPositive("-42")).GetError() == "not a digit: -");
+	}
+
+	WHEN("Tasks are lazy")
+	{
+		bool started = false;
+		auto task = [](bool& started) -> Nz::Task<int>
+		{
+			started = true;
+			co_return 7;
+		}(started);
+
+		CHECK(task.IsValid());
+		CHECK_FALSE(started);
+		CHECK_FALSE(task.IsDone());
+
+		CHECK(Nz::SyncWait(std::move(task)) == 7);
+		CHECK(started);
+	}
+
+	WHEN("Awaiting deeply nested tasks")
+	{
+		// Symmetric transfer keeps the stack from growing with the chain depth
+		CHECK(Nz::SyncWait(Countdown(10'000)) == 10'000);
+	}
+
+	WHEN("A task throws")
+	{
+		CHECK_THROWS_AS(Nz::SyncWait(Throwing()), std::runtime_error);
+	}
+
+	WHEN("Resuming tasks on a scheduler")
+	{
+		Nz::TaskScheduler scheduler(2);
+
+		std::thread::id workerThread = Nz::SyncWait(ResumeOnScheduler(scheduler));
+		CHECK(workerThread != std::this_thread::get_id());
+
+		CHECK(Nz::SyncWait(SumOnScheduler(scheduler, 100)) == 4950);
+	}
+}
+
+#endif
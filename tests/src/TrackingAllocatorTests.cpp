@@ -0,0 +1,178 @@
+#include <NazaraUtils/ArenaAllocator.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/SlotMap.hpp>
+#include <NazaraUtils/TrackingAllocator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("TrackingAllocator", "[CORE][TRACKINGALLOCATOR]")
+{
+	GIVEN("A tracker")
+	{
+		Nz::AllocationTracker tracker("test");
+		CHECK(tracker.GetTag() == "test");
+
+		Nz::AllocationStats initialStats = tracker.GetStats();
+		CHECK(initialStats.allocationCount == 0);
+		CHECK(initialStats.liveBytes == 0);
+		CHECK(initialStats.peakBytes == 0);
+
+		WHEN("Using it with a std::vector")
+		{
+			{
+				std::vector<Nz::UInt32, Nz::TrackingAllocator<Nz::UInt32>> vec{ Nz::TrackingAllocator<Nz::UInt32>(tracker) };
+				vec.reserve(100);
+
+				Nz::AllocationStats stats = tracker.GetStats();
+				CHECK(stats.allocationCount == 1);
+				CHECK(stats.allocatedBytes == 100 * sizeof(Nz::UInt32));
+				CHECK(stats.liveBytes == 100 * sizeof(Nz::UInt32));
+
+				vec.reserve(200);
+
+				stats = tracker.GetStats();
+				CHECK(stats.allocationCount == 2);
+				CHECK(stats.deallocationCount == 1);
+				CHECK(stats.liveBytes == 200 * sizeof(Nz::UInt32));
+				CHECK(stats.peakBytes == 300 * sizeof(Nz::UInt32));
+			}
+
+			Nz::AllocationStats stats = tracker.GetStats();
+			CHECK(stats.deallocationCount == 2);
+			CHECK(stats.liveBytes == 0);
+			CHECK(stats.peakBytes == 300 * sizeof(Nz::UInt32));
+
+			tracker.ResetPeak();
+			CHECK(tracker.GetStats().peakBytes == 0);
+
+			CHECK(Nz::AllocationTracker::ComputeAllocationRate(initialStats, stats) > 0.0);
+			CHECK(Nz::AllocationTracker::ComputeAllocationRate(stats, stats) == 0.0);
+		}
+
+		WHEN("Using it with a Bitset")
+		{
+			using Allocator = Nz::TrackingAllocator<Nz::UInt64>;
+
+			{
+				Nz::Bitset<Nz::UInt64, Allocator> bitset(1000, true, Allocator(tracker));
+				CHECK(bitset.Count() == 1000);
+				CHECK(tracker.GetStats().liveBytes >= 1000 / 8);
+			}
+
+			CHECK(tracker.GetStats().liveBytes == 0);
+		}
+
+		WHEN("Using it with a MemoryPool")
+		{
+			using Allocator = Nz::TrackingAllocator<int>;
+
+			{
+				Nz::MemoryPool<int, alignof(int), Nz::MemoryPoolDefaultPolicy, Allocator> pool(64, Allocator(tracker));
+				CHECK(tracker.GetStats().liveBytes >= 64 * sizeof(int)); //< first block
+
+				std::size_t index;
+				for (int i = 0; i < 100; ++i)
+					pool.Allocate(index, i);
+
+				Nz::AllocationStats stats = tracker.GetStats();
+				CHECK(stats.liveBytes >= 128 * sizeof(int));
+				CHECK(pool.GetAllocator().GetTracker().GetTag() == "test");
+			}
+
+			CHECK(tracker.GetStats().liveBytes == 0);
+		}
+
+		WHEN("Using it with a SlotMap")
+		{
+			using Allocator = Nz::TrackingAllocator<std::string>;
+
+			{
+				Nz::SlotMap<std::string, Allocator> slotMap{ Allocator(tracker) };
+				auto key = slotMap.Emplace("Hello");
+				slotMap.Emplace("World");
+				slotMap.Erase(key);
+				CHECK(tracker.GetStats().liveBytes > 0);
+			}
+
+			CHECK(tracker.GetStats().liveBytes == 0);
+		}
+
+		WHEN("Stacking it over another allocator")
+		{
+			Nz::ArenaAllocator arena(1024);
+
+			using Allocator = Nz::TrackingAllocator<int, Nz::ArenaStlAllocator<int>>;
+			std::vector<int, Allocator> vec{ Allocator(tracker, Nz::ArenaStlAllocator<int>(arena)) };
+			vec.resize(10);
+
+			CHECK(arena.GetLiveAllocationCount() == 1);
+			CHECK(tracker.GetStats().liveBytes == 10 * sizeof(int));
+
+			Nz::TrackingAllocator<double, Nz::ArenaStlAllocator<double>> rebound(vec.get_allocator());
+			CHECK(&rebound.GetTracker() == &tracker);
+			CHECK(&rebound.GetUpstream().GetArena() == &arena);
+			CHECK(rebound == vec.get_allocator());
+		}
+
+		WHEN("Allocating from multiple threads")
+		{
+			constexpr std::size_t ThreadCount = 4;
+			constexpr std::size_t IterationCount = 1000;
+
+			std::vector<std::thread> threads;
+			for (std::size_t i = 0; i < ThreadCount; ++i)
+			{
+				threads.emplace_back([&]
+				{
+					Nz::TrackingAllocator<int> allocator(tracker);
+					for (std::size_t j = 0; j < IterationCount; ++j)
+					{
+						int* ptr = allocator.allocate(4);
+						allocator.deallocate(ptr, 4);
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			Nz::AllocationStats stats = tracker.GetStats();
+			CHECK(stats.allocationCount == ThreadCount * IterationCount);
+			CHECK(stats.deallocationCount == ThreadCount * IterationCount);
+			CHECK(stats.liveBytes == 0);
+			CHECK(stats.peakBytes >= 4 * sizeof(int));
+			CHECK(stats.peakBytes <= ThreadCount * 4 * sizeof(int));
+		}
+
+		THEN("It is listed with the other trackers")
+		{
+			Nz::AllocationTracker otherTracker("other");
+
+			std::vector<std::string> tags;
+			Nz::AllocationTracker::ForEach([&](const Nz::AllocationTracker& registeredTracker)
+			{
+				tags.push_back(registeredTracker.GetTag());
+			});
+
+			CHECK(std::find(tags.begin(), tags.end(), "test") != tags.end());
+			CHECK(std::find(tags.begin(), tags.end(), "other") != tags.end());
+		}
+	}
+
+	GIVEN("A default-constructed allocator")
+	{
+		Nz::TrackingAllocator<int> allocator;
+		CHECK(&allocator.GetTracker() == &Nz::AllocationTracker::GetDefault());
+		CHECK(Nz::AllocationTracker::GetDefault().GetTag() == "default");
+
+		std::size_t liveBytes = Nz::AllocationTracker::GetDefault().GetStats().liveBytes;
+		int* ptr = allocator.allocate(8);
+		CHECK(Nz::AllocationTracker::GetDefault().GetStats().liveBytes == liveBytes + 8 * sizeof(int));
+		allocator.deallocate(ptr, 8);
+		CHECK(Nz::AllocationTracker::GetDefault().GetStats().liveBytes == liveBytes);
+	}
+}
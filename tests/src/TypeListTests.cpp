@@ -51,4 +51,20 @@ static_assert(std::is_same_v<T8, Nz::TypeList<float*, int*, long long*, short*>>
 
 using T9 = Nz::TypeListTransform<T8, std::remove_pointer>;
 
-static_assert(std::is_same_v<T7, T9>);
\ No newline at end of file
+static_assert(std::is_same_v<T7, T9>);
+
+template<typename A, typename B>
+struct SmallerFirst : std::bool_constant<(sizeof(A) < sizeof(B))> {};
+
+using T10 = Nz::TypeList<double, char, int, short, unsigned int, char>;
+
+static_assert(std::is_same_v<Nz::TypeListSort<T10, SmallerFirst>, Nz::TypeList<char, char, short, int, unsigned int, double>>);
+constexpr std::array<std::size_t, 6> T10SortIndices = Nz::TypeListSortIndices<T10, SmallerFirst>;
+static_assert(T10SortIndices[0] == 1 && T10SortIndices[1] == 5 && T10SortIndices[2] == 3 && T10SortIndices[3] == 2 && T10SortIndices[4] == 4 && T10SortIndices[5] == 0);
+static_assert(std::is_same_v<Nz::TypeListSort<T1, SmallerFirst>, Nz::TypeList<>>);
+
+using T11 = Nz::TypeListStablePartition<T10, std::is_integral>;
+
+static_assert(std::is_same_v<T11, Nz::TypeList<char, int, short, unsigned int, char, double>>);
+static_assert(std::is_same_v<Nz::TypeListStablePartition<T8, std::is_pointer>, T8>);
+static_assert(std::is_same_v<Nz::TypeListStablePartition<T1, std::is_pointer>, T1>);
@@ -0,0 +1,73 @@
+#include <NazaraUtils/TypeMap.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+namespace
+{
+	struct Renderer {};
+	struct AudioSystem {};
+	template<typename T> struct Component {};
+}
+
+SCENARIO("TypeMap", "[TypeMap]")
+{
+	Nz::TypeMap<std::string> map;
+	CHECK(map.IsEmpty());
+	CHECK(map.Find<Renderer>() == nullptr);
+
+	WHEN("Inserting values")
+	{
+		auto [renderer, inserted] = map.Emplace<Renderer>("Renderer");
+		CHECK(inserted);
+		CHECK(renderer == "Renderer");
+
+		auto [existing, insertedAgain] = map.Emplace<Renderer>("Other renderer");
+		CHECK_FALSE(insertedAgain);
+		CHECK(existing == "Renderer");
+
+		map.Set<AudioSystem>("Audio");
+		map.Set<Component<int>>("Component<int>");
+		map.Set<Component<float>>("Component<float>");
+
+		CHECK(map.GetSize() == 4);
+		CHECK(map.Contains<Renderer>());
+		CHECK(map.Contains(Nz::TypeId<AudioSystem>()));
+		CHECK_FALSE(map.Contains<Component<double>>());
+
+		CHECK(map.Get<AudioSystem>() == "Audio");
+		CHECK(*map.Find<Component<int>>() == "Component<int>");
+		CHECK(*map.Find(Nz::TypeId<Component<float>>()) == "Component<float>");
+
+		map.Set<AudioSystem>("New audio");
+		CHECK(map.Get<AudioSystem>() == "New audio");
+		CHECK(map.GetSize() == 4);
+
+		std::size_t count = 0;
+		for (auto&& [typeId, value] : map)
+		{
+			CHECK(map.Find(typeId) == &value);
+			count++;
+		}
+		CHECK(count == 4);
+
+		CHECK(map.Erase<Renderer>());
+		CHECK_FALSE(map.Erase<Renderer>());
+		CHECK(map.Find<Renderer>() == nullptr);
+		CHECK(map.GetSize() == 3);
+
+		map.Clear();
+		CHECK(map.IsEmpty());
+	}
+
+	WHEN("Storing move-only values")
+	{
+		Nz::TypeMap<std::unique_ptr<int>> services;
+		services.Emplace<Renderer>(std::make_unique<int>(42));
+		services.Set<AudioSystem>(std::make_unique<int>(7));
+
+		Nz::TypeMap<std::unique_ptr<int>> movedServices = std::move(services);
+		CHECK(*movedServices.Get<Renderer>() == 42);
+		CHECK(*movedServices.Get<AudioSystem>() == 7);
+	}
+}
@@ -24,6 +24,10 @@ static_assert(Nz::TypeName<Class<Foo>>() == "Class<class Foo>");
 static_assert(Nz::TypeName<Class<Foo>>() == "Class<Foo>");
 #endif
 
+static_assert(Nz::TypeId<int>() == Nz::FNV1a64("int"));
+static_assert(Nz::TypeId<Foo>() != Nz::TypeId<int>());
+static_assert(Nz::TypeId<Class<Foo>>() != Nz::TypeId<Class<int>>());
+
 TEST_CASE("Type names", "[TypeHash]")
 {
 	// This could be checked by static_assert, but runtime checks allows to see the difference between expect and result
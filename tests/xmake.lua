@@ -19,5 +19,9 @@ if has_config("tests") then
 
 		add_deps("NazaraUtils")
         add_packages("catch2")
+
+		if is_plat("linux", "bsd") then
+			add_syslinks("pthread")
+		end
 	end)
 end
@@ -29,6 +29,12 @@ if is_mode("debug") then
 	add_defines("NAZARA_DEBUG")
 end
 
+option("profiling", { description = "Enable profiling zones and counters (NazaraProfileScope, NazaraProfileCounter)", default = false })
+
+if has_config("profiling") then
+	add_defines("NAZARA_PROFILING")
+end
+
 target("NazaraUtils", function ()
 	set_kind("headeronly")
 	set_group("Library")